@@ -59,12 +59,16 @@
 #include <stdarg.h>
 #include <netinet/in.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <pthread.h>
+#include <arpa/inet.h>
 
 #include "vb_log.h"
 #include "vb_console.h"
 #include "vb_thread.h"
 #include "vb_priorities.h"
+#include "vb_util.h"
 
 /*
  ************************************************************************
@@ -73,8 +77,15 @@
  */
 
 #define VB_CONSOLE_THREAD_NAME        ("Console")
-#define VB_CONSOLE_COMMANDS_MAX       (20)
+#define VB_CONSOLE_COMMANDS_MAX       (64)
 #define VB_CONSOLE_NAME_MAX_SIZE      (21)
+#define VB_CONSOLE_SESSIONS_MAX       (8)
+#define VB_CONSOLE_POLL_TIMEOUT       (500)          // ms
+#define VB_CONSOLE_OUTPUT_INIT_SIZE   (4 * 1024)     // Bytes
+#define VB_CONSOLE_OUTPUT_MAX_SIZE    (1024 * 1024)  // Bytes (per session)
+#define VB_CONSOLE_OUTPUT_HIGH_MARK   (VB_CONSOLE_OUTPUT_MAX_SIZE / 2)
+#define VB_CONSOLE_OUTPUT_RESERVE     (128)          // Bytes allocated after the buffer for the truncation error line
+#define VB_CONSOLE_BUSY_MSG           ("Too many console sessions, try again later\n")
 
 /*
  ************************************************************************
@@ -89,6 +100,26 @@ typedef struct
   void *arg;
 } t_consoleCommand;
 
+typedef struct
+{
+  BOOL                inUse;
+  BOOL                closing;                              // Close once pending output has been sent
+  BOOL                broken;                               // Socket error, close right away
+  BOOL                truncated;                            // Output of current command did not fit
+  INT32S              fd;
+  INT32U              id;
+  struct sockaddr_in6 addr;
+  CHAR                input[VB_CONSOLE_BUFFER_SIZE];
+  INT32U              inputLen;
+  CHAR               *output;
+  INT32U              outputSize;                           // Allocated bytes
+  INT32U              outputLen;                            // Bytes written by handlers
+  INT32U              outputOffset;                         // Bytes already sent
+  INT64U              droppedBytes;
+  INT64U              numCommands;
+  CHAR                latestCommand[VB_CONSOLE_BUFFER_SIZE];
+} t_consoleSession;
+
 
 /*
  ************************************************************************
@@ -101,12 +132,16 @@ static pthread_mutex_t vbConsoleMutex;
 static BOOL            vbConsoleThreadRunning;
 
 static INT32S          vbConsoleSockFd;
-static INT32S          vbConsoleConnFd;
 static INT16U          vbConsolePort;
 static char           vbConsoleName[VB_CONSOLE_NAME_MAX_SIZE] = { 0 };
 
 static t_consoleCommand consoleCommands[VB_CONSOLE_COMMANDS_MAX];
 
+// Sessions are only accessed from console thread context
+static t_consoleSession  vbConsoleSessions[VB_CONSOLE_SESSIONS_MAX];
+static t_consoleSession *vbConsoleCurrentSession = NULL;
+static INT32U            vbConsoleSessionNextId = 0;
+
 /*
  ************************************************************************
  ** Private function declaration
@@ -118,9 +153,9 @@ static void *VbThreadConsole(void *arg);
 
 // Function in charge of finding the appropiate callback to execute for a
 // specific command
-static BOOL vbConsoleExecuteCommand(INT32S sk, CHAR* command);
+static BOOL vbConsoleExecuteCommand(t_consoleSession *session, CHAR* command);
 
-// Function that sends data to the user
+// Function that queues data to be sent to the user of current session
 static void VbConsoleWrite(const char *fmt, ...);
 
 /*
@@ -351,14 +386,468 @@ static BOOLEAN VbConsoleStateGet(void)
 
 /*******************************************************************/
 
+/**
+ * @brief Sends as much pending output as the socket accepts without blocking
+ * @param[in] session Console session
+ **/
+static void VbConsoleSessionFlush(t_consoleSession *session)
+{
+  ssize_t sent;
+
+  while ((session->broken == FALSE) && (session->outputOffset < session->outputLen))
+  {
+    sent = send(session->fd, session->output + session->outputOffset,
+                session->outputLen - session->outputOffset, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+    if (sent > 0)
+    {
+      session->outputOffset += sent;
+    }
+    else if ((sent < 0) && (errno == EINTR))
+    {
+      continue;
+    }
+    else
+    {
+      if ((sent == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK)))
+      {
+        VbLogPrint(VB_LOG_ERROR, "Error writing to console session %u [%s]", session->id, strerror(errno));
+        session->broken = TRUE;
+      }
+      break;
+    }
+  }
+
+  if (session->outputOffset == session->outputLen)
+  {
+    session->outputOffset = 0;
+    session->outputLen = 0;
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Sends what the socket accepts and moves the unsent output to the
+ * beginning of the buffer
+ * @param[in] session Console session
+ **/
+static void VbConsoleSessionDrain(t_consoleSession *session)
+{
+  VbConsoleSessionFlush(session);
+
+  if ((session->outputOffset > 0) && (session->broken == FALSE))
+  {
+    session->outputLen -= session->outputOffset;
+    memmove(session->output, session->output + session->outputOffset, session->outputLen);
+    session->outputOffset = 0;
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Queues data in session output buffer without ever blocking the
+ * handler. Queued data is sent opportunistically with non-blocking sends and
+ * the buffer grows up to VB_CONSOLE_OUTPUT_MAX_SIZE bytes per session. Output
+ * that does not fit is dropped and the reply ends with an error line (see
+ * VbConsoleSessionTruncatedEnd).
+ * @param[in] session Console session
+ * @param[in] data Data to queue
+ * @param[in] len Length of data
+ **/
+static void VbConsoleSessionAppend(t_consoleSession *session, const CHAR *data, INT32U len)
+{
+  INT32U        new_size;
+  CHAR         *new_output;
+
+  if ((session->broken == FALSE) && (session->truncated == TRUE))
+  {
+    // Never resume a reply after a gap
+    session->droppedBytes += len;
+    len = 0;
+  }
+
+  if ((session->broken == FALSE) && (len > 0))
+  {
+    if ((session->outputLen + len) > session->outputSize)
+    {
+      // Try to make room by sending (without blocking) what is already queued
+      VbConsoleSessionDrain(session);
+    }
+
+    if (((session->outputLen + len) > session->outputSize) &&
+        (session->outputSize < VB_CONSOLE_OUTPUT_MAX_SIZE))
+    {
+      new_size = (session->outputSize == 0)?VB_CONSOLE_OUTPUT_INIT_SIZE:session->outputSize;
+
+      while ((new_size < (session->outputLen + len)) && (new_size < VB_CONSOLE_OUTPUT_MAX_SIZE))
+      {
+        new_size *= 2;
+      }
+
+      new_size = MIN(new_size, VB_CONSOLE_OUTPUT_MAX_SIZE);
+      new_output = (CHAR *)realloc(session->output, new_size + VB_CONSOLE_OUTPUT_RESERVE);
+
+      if (new_output != NULL)
+      {
+        session->output = new_output;
+        session->outputSize = new_size;
+      }
+    }
+
+    if ((session->outputLen + len) > session->outputSize)
+    {
+      session->droppedBytes += (session->outputLen + len) - session->outputSize;
+      session->truncated = TRUE;
+      len = session->outputSize - session->outputLen;
+    }
+
+    if ((len > 0) && (session->broken == FALSE))
+    {
+      memcpy(session->output + session->outputLen, data, len);
+      session->outputLen += len;
+    }
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Ends a truncated reply with an error line, so clients never take
+ * partial output as complete. Session is closed once it has been sent.
+ * @param[in] session Console session
+ * @param[in] dropped Bytes dropped from the reply
+ **/
+static void VbConsoleSessionTruncatedEnd(t_consoleSession *session, INT64U dropped)
+{
+  CHAR   msg[VB_CONSOLE_OUTPUT_RESERVE];
+  INT32S msg_len;
+
+  msg_len = snprintf(msg, sizeof(msg), "\nERROR: output truncated, %llu bytes dropped (console buffer full)\n",
+      (unsigned long long)dropped);
+
+  // Reserved bytes follow the buffer, so the line always fits
+  if ((msg_len > 0) && (session->output != NULL) && (session->broken == FALSE))
+  {
+    memcpy(session->output + session->outputLen, msg, msg_len);
+    session->outputLen += msg_len;
+  }
+
+  session->truncated = FALSE;
+  session->closing = TRUE;
+}
+
+/*******************************************************************/
+
+static void VbConsoleSessionClose(t_consoleSession *session)
+{
+  VbLogPrint(VB_LOG_DEBUG, "Console session %u closed (%llu commands, %llu bytes dropped)",
+      session->id, session->numCommands, session->droppedBytes);
+
+  shutdown(session->fd, SHUT_RDWR);
+  close(session->fd);
+
+  free(session->output);
+  bzero(session, sizeof(*session));
+  session->fd = -1;
+}
+
+/*******************************************************************/
+
+static void VbConsoleSessionsAccept(void)
+{
+  INT32S              conn_fd;
+  INT32U              i;
+  struct sockaddr_in6 cli_addr;
+  socklen_t           cli_len;
+  t_consoleSession   *session;
+  CHAR                addr_str[INET6_ADDRSTRLEN];
+
+  for (;;)
+  {
+    cli_len = sizeof(cli_addr);
+    bzero((char *) &cli_addr, sizeof(cli_addr));
+    conn_fd = accept(vbConsoleSockFd, (struct sockaddr *) &cli_addr, &cli_len);
+
+    if (conn_fd < 0)
+    {
+      if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+      {
+        VbLogPrint(VB_LOG_ERROR, "Error on accept [%s]", strerror(errno));
+      }
+      break;
+    }
+
+    session = NULL;
+    for (i = 0; i < VB_CONSOLE_SESSIONS_MAX; i++)
+    {
+      if (vbConsoleSessions[i].inUse == FALSE)
+      {
+        session = &vbConsoleSessions[i];
+        break;
+      }
+    }
+
+    if (session == NULL)
+    {
+      VbLogPrint(VB_LOG_WARNING, "Console connection rejected: %d sessions already open", VB_CONSOLE_SESSIONS_MAX);
+      send(conn_fd, VB_CONSOLE_BUSY_MSG, strlen(VB_CONSOLE_BUSY_MSG), MSG_NOSIGNAL | MSG_DONTWAIT);
+      close(conn_fd);
+    }
+    else if (fcntl(conn_fd, F_SETFL, fcntl(conn_fd, F_GETFL, 0) | O_NONBLOCK) < 0)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Error configuring console connection [%s]", strerror(errno));
+      close(conn_fd);
+    }
+    else
+    {
+      bzero(session, sizeof(*session));
+      session->inUse = TRUE;
+      session->fd = conn_fd;
+      session->id = vbConsoleSessionNextId++;
+      session->addr = cli_addr;
+
+      inet_ntop(AF_INET6, &cli_addr.sin6_addr, addr_str, sizeof(addr_str));
+      VbLogPrint(VB_LOG_DEBUG, "New console session %u established from %s", session->id, addr_str);
+
+      //Show prompt
+      //
+      vbConsoleCurrentSession = session;
+      VbConsoleWrite("%s#", vbConsoleName);
+      vbConsoleCurrentSession = NULL;
+    }
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Executes every complete command line ('\r' terminated) received in
+ * given session
+ * @param[in] session Console session
+ **/
+static void VbConsoleSessionLinesProcess(t_consoleSession *session)
+{
+  CHAR   *eol;
+  CHAR    line[VB_CONSOLE_BUFFER_SIZE];
+  INT32U  line_len;
+  INT32U  consumed;
+  INT64U  dropped;
+
+  for (;;)
+  {
+    // Skip line feeds or null characters following a carriage return
+    consumed = 0;
+    while ((consumed < session->inputLen) &&
+           ((session->input[consumed] == '\n') || (session->input[consumed] == '\0')))
+    {
+      consumed++;
+    }
+
+    session->inputLen -= consumed;
+    memmove(session->input, session->input + consumed, session->inputLen);
+
+    if ((session->closing == TRUE) || (session->broken == TRUE))
+    {
+      break;
+    }
+
+    eol = memchr(session->input, '\r', session->inputLen);
+    if (eol == NULL)
+    {
+      break;
+    }
+
+    line_len = eol - session->input;
+    memcpy(line, session->input, line_len);
+    line[line_len] = '\0';
+
+    session->inputLen -= line_len + 1;
+    memmove(session->input, eol + 1, session->inputLen);
+
+    // Execute the just received command, by invoking the (previously
+    // registered) corresponding handler for such command. Handlers output
+    // is queued in session buffer and sent from the event loop.
+    //
+    dropped = session->droppedBytes;
+    vbConsoleCurrentSession = session;
+
+    if (vbConsoleExecuteCommand(session, line) == FALSE)
+    {
+      session->closing = TRUE;
+    }
+    else if (session->truncated == TRUE)
+    {
+      VbConsoleSessionTruncatedEnd(session, session->droppedBytes - dropped);
+    }
+    else
+    {
+      //Show prompt
+      //
+      VbConsoleWrite("%s#", vbConsoleName);
+    }
+
+    vbConsoleCurrentSession = NULL;
+    session->numCommands++;
+
+    if (session->droppedBytes != dropped)
+    {
+      VbLogPrint(VB_LOG_WARNING, "Console session %u: %llu bytes of output dropped (console buffer full)",
+          session->id, session->droppedBytes - dropped);
+    }
+  }
+
+  if ((session->closing == FALSE) && (session->inputLen >= (sizeof(session->input) - 1)))
+  {
+    VbLogPrint(VB_LOG_ERROR, "Console session %u: command too long", session->id);
+    session->broken = TRUE;
+  }
+}
+
+/*******************************************************************/
+
+static void VbConsoleSessionRead(t_consoleSession *session)
+{
+  ssize_t received;
+
+  received = recv(session->fd, session->input + session->inputLen,
+                  sizeof(session->input) - 1 - session->inputLen, 0);
+
+  if (received < 0)
+  {
+    if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+    {
+      // Socket error
+      //
+      VbLogPrint(VB_LOG_ERROR, "Error reading from socket [%s]",strerror(errno));
+      session->broken = TRUE;
+    }
+  }
+  else if (received == 0)
+  {
+    // Socket was orderly closed
+    //
+    VbLogPrint(VB_LOG_DEBUG,"Socket was remotely closed");
+    session->broken = TRUE;
+  }
+  else
+  {
+    session->inputLen += received;
+    VbConsoleSessionLinesProcess(session);
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Waits for console events (new connections, commands received and
+ * sockets ready to send more output) and processes them
+ **/
+static void VbConsoleEventsProcess(void)
+{
+  struct pollfd     fds[VB_CONSOLE_SESSIONS_MAX + 1];
+  t_consoleSession *sessions[VB_CONSOLE_SESSIONS_MAX + 1];
+  t_consoleSession *session;
+  INT32U            num_fds = 0;
+  INT32U            i;
+  INT32S            res;
+
+  fds[num_fds].fd = vbConsoleSockFd;
+  fds[num_fds].events = POLLIN;
+  fds[num_fds].revents = 0;
+  sessions[num_fds] = NULL;
+  num_fds++;
+
+  for (i = 0; i < VB_CONSOLE_SESSIONS_MAX; i++)
+  {
+    session = &vbConsoleSessions[i];
+
+    if (session->inUse == TRUE)
+    {
+      fds[num_fds].fd = session->fd;
+      fds[num_fds].events = 0;
+      fds[num_fds].revents = 0;
+
+      // Stop reading new commands while client is not consuming output
+      if ((session->closing == FALSE) &&
+          ((session->outputLen - session->outputOffset) < VB_CONSOLE_OUTPUT_HIGH_MARK))
+      {
+        fds[num_fds].events |= POLLIN;
+      }
+
+      if (session->outputLen > session->outputOffset)
+      {
+        fds[num_fds].events |= POLLOUT;
+      }
+
+      sessions[num_fds] = session;
+      num_fds++;
+    }
+  }
+
+  res = poll(fds, num_fds, VB_CONSOLE_POLL_TIMEOUT);
+
+  if (res < 0)
+  {
+    if (errno != EINTR)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Error on console poll [%s]", strerror(errno));
+    }
+  }
+  else if (res > 0)
+  {
+    for (i = 1; i < num_fds; i++)
+    {
+      session = sessions[i];
+
+      if (fds[i].revents & POLLNVAL)
+      {
+        session->broken = TRUE;
+      }
+
+      if (fds[i].revents & POLLOUT)
+      {
+        VbConsoleSessionFlush(session);
+      }
+
+      if (fds[i].revents & (POLLIN | POLLHUP | POLLERR))
+      {
+        VbConsoleSessionRead(session);
+      }
+
+      if (session->outputLen > session->outputOffset)
+      {
+        VbConsoleSessionFlush(session);
+      }
+    }
+
+    if (fds[0].revents & POLLIN)
+    {
+      VbConsoleSessionsAccept();
+    }
+  }
+
+  for (i = 0; i < VB_CONSOLE_SESSIONS_MAX; i++)
+  {
+    session = &vbConsoleSessions[i];
+
+    if ((session->inUse == TRUE) &&
+        ((session->broken == TRUE) ||
+         ((session->closing == TRUE) && (session->outputLen == session->outputOffset))))
+    {
+      VbConsoleSessionClose(session);
+    }
+  }
+}
+
+/*******************************************************************/
+
 static void *VbThreadConsole(void *arg)
 {
   int reuseaddr = 1;
-  struct sockaddr_in6 serv_addr, cli_addr;
-  socklen_t clilen = sizeof(cli_addr);
-
-  CHAR buffer_storage[VB_CONSOLE_BUFFER_SIZE];
-  CHAR *buffer = NULL;
+  INT32U i;
+  struct sockaddr_in6 serv_addr;
 
   // "SO_REUSEADDR" will let us reuse the same address (for the server) as in
   // a previous (crashed) execution of this same process.
@@ -384,105 +873,34 @@ static void *VbThreadConsole(void *arg)
     }
     else
     {
-      if (listen(vbConsoleSockFd,1),0)
+      if (listen(vbConsoleSockFd, VB_CONSOLE_SESSIONS_MAX) < 0)
       {
         VbLogPrint(VB_LOG_ERROR, "Error on listen [%s]",strerror(errno));
       }
+      else if (fcntl(vbConsoleSockFd, F_SETFL, fcntl(vbConsoleSockFd, F_GETFL, 0) | O_NONBLOCK) < 0)
+      {
+        VbLogPrint(VB_LOG_ERROR, "Error configuring socket (O_NONBLOCK) [%s]",strerror(errno));
+      }
       else
       {
-        while (VbConsoleStateGet() == TRUE)
+        for (i = 0; i < VB_CONSOLE_SESSIONS_MAX; i++)
         {
-          INT32S console_conn = -1;
-
-          VbLogPrint(VB_LOG_DEBUG, "Waiting for new connection...");
-
-          bzero((char *) &cli_addr, sizeof(cli_addr));
-          console_conn = accept(vbConsoleSockFd, (struct sockaddr *) &cli_addr, &clilen);
-
-          pthread_mutex_lock(&vbConsoleMutex);
-          vbConsoleConnFd = console_conn;
-          pthread_mutex_unlock(&vbConsoleMutex);
-
-          if (VbConsoleStateGet() == TRUE)
-          {
-            VbLogPrint(VB_LOG_DEBUG, "New console connection established!");
+          bzero(&vbConsoleSessions[i], sizeof(vbConsoleSessions[i]));
+          vbConsoleSessions[i].fd = -1;
+        }
 
-            if (console_conn < 0)
-            {
-              VbLogPrint(VB_LOG_ERROR, "Error on accept [%s]", strerror(errno));
-            }
-            else
-            {
-              // New connection received from the client.  Let's keep
-              // processing messages as they are received.
-              //
-              BOOL vbConsoleClientConnected = TRUE;
-
-              while(vbConsoleClientConnected)
-              {
-                int buffer_offset      = 0; // total bytes (from the current
-                // message) received
-                ssize_t bytes_received = 0; // bytes received in the last
-                // call to "recv()"
-                INT32U payload_length  = 0; // length of the current message
-                // payload (initially unknown)
-
-                bzero(buffer_storage, VB_CONSOLE_BUFFER_SIZE);
-                buffer = buffer_storage;
-
-                //Show prompt
-                //
-                VbConsoleWrite("%s#", vbConsoleName);
-
-                // Wait until a newline character is received.
-                //
-                do
-                {
-                  bytes_received = recv(console_conn, buffer+buffer_offset, VB_CONSOLE_BUFFER_SIZE - buffer_offset, 0);
-                  if (bytes_received < 0)
-                  {
-                    // Socket error
-                    //
-                    VbLogPrint(VB_LOG_ERROR, "Error reading from socket [%s]",strerror(errno));
-                    vbConsoleClientConnected = FALSE;
-                    break;
-                  }
-                  else if (bytes_received == 0)
-                  {
-                    // Socket was orderly closed
-                    //
-                    VbLogPrint(VB_LOG_DEBUG,"Socket was remotely closed");
-                    vbConsoleClientConnected = FALSE;
-                    break;
-                  }
-                  else
-                  {
-                    // Data was received
-                    //
-                    buffer_offset += bytes_received;
-                  }
-                } while (vbConsoleClientConnected && !strchr(buffer_storage, '\r'));
-
-                if (vbConsoleClientConnected)
-                {
-                  payload_length = strchr(buffer_storage, '\r') - buffer_storage;
-                  buffer_storage[payload_length] = 0x0;
-
-                  // Execute the just received command, by invoking the (previously
-                  // registered) corresponding handler for such command.
-                  //
-                  vbConsoleClientConnected = vbConsoleExecuteCommand(console_conn, buffer_storage);
-                }
-              } // while(vbConsoleClientConnected)
-            }
-          }
+        while (VbConsoleStateGet() == TRUE)
+        {
+          VbConsoleEventsProcess();
+        } // while(vbConsoleThreadRunning)
 
-          if (console_conn != -1)
+        for (i = 0; i < VB_CONSOLE_SESSIONS_MAX; i++)
+        {
+          if (vbConsoleSessions[i].inUse == TRUE)
           {
-            shutdown(console_conn, SHUT_RDWR);
-            close(console_conn);
+            VbConsoleSessionClose(&vbConsoleSessions[i]);
           }
-        } // while(vbConsoleThreadRunning)
+        }
       } // listen()
     } // bind()
   } // setsockopt(SO_REUSEADDR)
@@ -491,6 +909,7 @@ static void *VbThreadConsole(void *arg)
   {
     shutdown(vbConsoleSockFd, SHUT_RDWR);
     close(vbConsoleSockFd);
+    vbConsoleSockFd = -1;
   }
 
   VbLogPrint(VB_LOG_INFO, "Console thread finished!");
@@ -500,14 +919,38 @@ static void *VbThreadConsole(void *arg)
 
 /*******************************************************************/
 
-static BOOL vbConsoleExecuteCommand(INT32S sk, CHAR* command)
+static void vbConsoleSessionsShow(void)
+{
+  INT32U            i;
+  t_consoleSession *session;
+  CHAR              addr_str[INET6_ADDRSTRLEN];
+
+  VbConsoleWrite("  %-4s %-40s %10s %10s %12s\n", "Id", "Address", "Commands", "Pending", "Dropped");
+
+  for (i = 0; i < VB_CONSOLE_SESSIONS_MAX; i++)
+  {
+    session = &vbConsoleSessions[i];
+
+    if (session->inUse == TRUE)
+    {
+      inet_ntop(AF_INET6, &session->addr.sin6_addr, addr_str, sizeof(addr_str));
+      VbConsoleWrite("%c %-4u %-40s %10llu %10u %12llu\n",
+          (session == vbConsoleCurrentSession)?'*':' ', session->id, addr_str,
+          session->numCommands, session->outputLen - session->outputOffset, session->droppedBytes);
+    }
+  }
+}
+
+/*******************************************************************/
+
+static BOOL vbConsoleExecuteCommand(t_consoleSession *session, CHAR* command)
 {
   int         i;
   BOOL        return_value = TRUE;
   BOOL        return_command = TRUE;
   BOOL        copy_command = TRUE;
   CHAR       *args[VB_CONSOLE_PARAMS_MAXNUM];
-  static CHAR latest_valid_command[VB_CONSOLE_BUFFER_SIZE];
+  CHAR       *latest_valid_command = session->latestCommand;
 
   VbLogPrint(VB_LOG_DEBUG,"Processing console command: >>%s<<", command);
 
@@ -529,7 +972,7 @@ static BOOL vbConsoleExecuteCommand(INT32S sk, CHAR* command)
   {
     if ((!strcmp(args[0], "help")) || (!strcmp(args[0], "?")))
     {
-      VbConsoleWrite("Available commands:\n\n\thelp\n\tquit\n");
+      VbConsoleWrite("Available commands:\n\n\thelp\n\tquit\n\tsessions\n");
       if(copy_command == TRUE)
       {
         strncpy(latest_valid_command, command, VB_CONSOLE_BUFFER_SIZE);
@@ -547,6 +990,17 @@ static BOOL vbConsoleExecuteCommand(INT32S sk, CHAR* command)
 
       return_value = TRUE;
     }
+    else if (!strcmp(args[0], "sessions"))
+    {
+      if(copy_command == TRUE)
+      {
+        strncpy(latest_valid_command, command, VB_CONSOLE_BUFFER_SIZE);
+        latest_valid_command[VB_CONSOLE_BUFFER_SIZE - 1] = '\0';
+      }
+
+      vbConsoleSessionsShow();
+      VbConsoleWrite("OK\n");
+    }
     else if (!strcmp(args[0], "quit"))
     {
       //VbConsoleWrite("Console connection closed.");
@@ -611,14 +1065,13 @@ static void VbConsoleWrite(const char *fmt, ...)
 
   output_buffer[VB_CONSOLE_BUFFER_SIZE-1] = 0x0;
 
-  pthread_mutex_lock(&vbConsoleMutex);
-
-  if (vbConsoleConnFd)
+  // Handlers run in console thread context, so no lock is needed to access
+  // current session. Output is only queued here; when the buffer is full
+  // the handler waits (bounded) for the client to drain it.
+  if (vbConsoleCurrentSession != NULL)
   {
-    send(vbConsoleConnFd, output_buffer, strlen(output_buffer), MSG_NOSIGNAL );
+    VbConsoleSessionAppend(vbConsoleCurrentSession, output_buffer, strlen(output_buffer));
   }
-
-  pthread_mutex_unlock(&vbConsoleMutex);
 }
 
 /*******************************************************************/
@@ -660,7 +1113,7 @@ void VbConsoleStart(void)
 
   VbConsoleStateSet(TRUE);
 
-  if (FALSE == VbThreadCreate(VB_CONSOLE_THREAD_NAME, VbThreadConsole, NULL, VB_CONSOLE_THREAD_PRIORITY, &vbConsoleThread))
+  if (FALSE == VbThreadCreate(VB_CONSOLE_THREAD_NAME, VbThreadConsole, NULL, VB_CONSOLE_THREAD_CLASS, &vbConsoleThread))
   {
     VbLogPrint(VB_LOG_ERROR,"Can't create %s thread", VB_CONSOLE_THREAD_NAME);
     VbConsoleStateSet(FALSE);
@@ -677,20 +1130,8 @@ void VbConsoleStop( void )
 
     VbConsoleStateSet(FALSE);
 
-    pthread_mutex_lock(&vbConsoleMutex);
-
-    if (vbConsoleConnFd != -1)
-    {
-      shutdown(vbConsoleConnFd, SHUT_RDWR);
-    }
-
-    if (vbConsoleSockFd != -1)
-    {
-      shutdown(vbConsoleSockFd, SHUT_RDWR);
-    }
-
-    pthread_mutex_unlock(&vbConsoleMutex);
-
+    // Console thread wakes up periodically (VB_CONSOLE_POLL_TIMEOUT) to check
+    // running state and closes all sessions before exiting
     VbThreadJoin(vbConsoleThread , VB_CONSOLE_THREAD_NAME);
 
     // Release previously allocated memory
@@ -73,6 +73,7 @@ typedef void (*t_writeFun)(const char *fmt, ...);
 /**
  * @brief Initializes console component.
  * Clears all registered commands and configures socket.
+ * Several clients can be connected at the same time, each one in its own session.
  * @param[in] console_port Console TCP port.
  * @param[in] name String to dump in console prompt.
 **/
@@ -106,7 +107,14 @@ void VbConsoleDestroy( void );
  *                                   argument to this function.
  *                            - write_fun: A printf-like function you must use
  *                                   inside the callback function to send text
- *                                   back to the user.
+ *                                   back to the user. Text is queued in the
+ *                                   session output buffer and sent from the
+ *                                   console thread, so it never blocks on a
+ *                                   slow client; it shall only be called from
+ *                                   the callback context. Output beyond the
+ *                                   session buffer limit is dropped, and
+ *                                   callbacks shall print from a copy of any
+ *                                   shared state rather than under its lock.
  *                            - cmd: A null-terminated list of strings containing
  *                                   each of the words that make up the actual
  *                                   command that triggered the callback
@@ -372,6 +372,31 @@ BOOL VbCountersRunningTime(void *arg, void (*write_fun)(const char *fmt, ...), c
 
 /*******************************************************************/
 
+t_vb_counter_error VbCountersLoop(void (*loopCb)(const CHAR *name, INT32U value, void *args), void *args)
+{
+  t_vb_counter_error err = VB_COUNTERS_ERROR_NONE;
+  INT16U i;
+
+  if (loopCb != NULL)
+  {
+    pthread_mutex_lock(&vbCountersMutex);
+
+    for(i = 0 ; i < VB_COUNTERS_MAX ; i++ )
+    {
+      if(vbCountersUsed[i])
+      {
+        loopCb(vbCountersNames[i], vbCounters[i], args);
+      }
+    }
+
+    pthread_mutex_unlock(&vbCountersMutex);
+  }
+
+  return err;
+}
+
+/*******************************************************************/
+
 BOOL VbCountersConsoleCmd(void *arg, void (*write_fun)(const char *fmt, ...), char **cmd)
 {
   BOOL ret = FALSE;
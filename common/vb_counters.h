@@ -89,6 +89,12 @@ t_vb_counter_error VbCounterDecrease(INT16U conuterIndex);
 
 t_vb_counter_error VbCountersRunTimeGet( INT64S *elapseTimeMs );
 
+/**
+ * @brief Calls given function for every installed counter (counters lock is held
+ * during the loop, so the callback shall not block)
+ **/
+t_vb_counter_error VbCountersLoop(void (*loopCb)(const CHAR *name, INT32U value, void *args), void *args);
+
 BOOL VbCountersRunningTime(void *arg, void (*write_fun)(const char *fmt, ...), char **cmd);
 
 BOOL VbCountersConsoleCmd(void *arg, void (*write_fun)(const char *fmt, ...), char **cmd);
@@ -69,8 +69,11 @@
 #include "vb_util.h"
 #include "vb_log.h"
 #include "vb_thread.h"
+#include "vb_priorities.h"
 
 #include "vb_ea_communication.h"
+#include "vb_ea_shm.h"
+#include "vb_io_uring.h"
 
 /*
  ************************************************************************
@@ -79,12 +82,16 @@
  */
 
 #define VB_EA_TCP_NODELAY               (1) // TCP_NODELAY socket option to send messages as soon as possible, disabling Nagle's algorithm
-#define VB_EA_THREAD_PRIORITY           (0)
 #define VB_EA_INVALID_FD                (-1)
 #define VB_EA_BUFFER_SIZE               (4 * 1024) // Shall be greater than VB_EA_HEADER_SIZE
 #define VB_EA_CONNECTION_QUEUE_SIZE     (1)
 #define VB_EA_TO_CONNECTIONS            (1000) //in msecs
 #define VB_EA_DRIVER_PORT_MAX_SIZE      (6) // 5 digits + null byte
+#define VB_EA_URING_ENTRIES             (4)
+#define VB_EA_URING_NUM_BUFS            (16)
+#define VB_EA_URING_BUF_SIZE            (16 * 1024)
+#define VB_EA_URING_BUF_GROUP           (0)
+#define VB_EA_URING_RECV_TAG            (1)
 
 /*
  ************************************************************************
@@ -92,6 +99,22 @@
  ************************************************************************
  */
 
+/// Socket reception through a ring owned by the connection thread
+struct s_vbEAIoUringRx
+{
+  t_vbIoUring         ring;
+  t_vbIoUringBufRing  bufRing;           ///< Buffers the kernel fills on each multishot receive completion
+  INT8U              *stream;            ///< Partial frame carried between completions
+  INT32U              streamLen;
+  INT32U              streamCap;
+  BOOLEAN             armed;             ///< Multishot receive is pending
+  BOOLEAN             received;          ///< Some data was already received through the ring
+  INT64U              bytes;
+  INT64U              frames;
+  INT64U              copied;            ///< Frames split between completions, parsed from stream buffer
+  INT64U              rearms;            ///< Multishot receive armed again (out of buffers)
+};
+
 /*
  ************************************************************************
  ** Private variables
@@ -141,9 +164,15 @@ static const char *eaOpcodeString[VB_EA_OPCODE_LAST] =
       "EAAlignClusterStop.cnf",
       "EAANetworkChangeDiff",
       "EAASocketAlive.req",
-      "EASocketAlive.rsp"
+      "EASocketAlive.rsp",
+      "EAFlowCredit.trg",
+      "EAShm.req",
+      "EAShm.rsp",
+      "EAShmSwitch.trg"
   };
 
+static const CHAR *eaFlowClassString[VB_EA_FLOW_CLASS_LAST] = {"CONTROL", "MEASURE", "TELEMETRY"};
+
 /*
  ************************************************************************
  ** Private function implementation
@@ -305,10 +334,560 @@ static t_vbEAError VbEaSocketConf(INT32S sockFd)
 
 /*******************************************************************/
 
+static BOOLEAN VbEAShmPeerIsLocal(INT32S sockFd)
+{
+  BOOLEAN                 ret = FALSE;
+  struct sockaddr_storage local_addr;
+  struct sockaddr_storage peer_addr;
+  socklen_t               local_len = sizeof(local_addr);
+  socklen_t               peer_len = sizeof(peer_addr);
+
+  // Same address on both ends of the connection means same host
+  if ((getsockname(sockFd, (struct sockaddr *)&local_addr, &local_len) == 0) &&
+      (getpeername(sockFd, (struct sockaddr *)&peer_addr, &peer_len) == 0) &&
+      (local_addr.ss_family == peer_addr.ss_family))
+  {
+    if (local_addr.ss_family == AF_INET)
+    {
+      ret = (((struct sockaddr_in *)&local_addr)->sin_addr.s_addr == ((struct sockaddr_in *)&peer_addr)->sin_addr.s_addr)?TRUE:FALSE;
+    }
+    else if (local_addr.ss_family == AF_INET6)
+    {
+      ret = (memcmp(&((struct sockaddr_in6 *)&local_addr)->sin6_addr, &((struct sockaddr_in6 *)&peer_addr)->sin6_addr,
+          sizeof(struct in6_addr)) == 0)?TRUE:FALSE;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void VbEAShmDetach(t_vbEADesc *desc)
+{
+  if (desc->shm != NULL)
+  {
+    pthread_mutex_lock(&(desc->mutex));
+    VbEAShmDestroy(&(desc->shm));
+    pthread_mutex_unlock(&(desc->mutex));
+  }
+}
+
+/*******************************************************************/
+
+static t_vbEAError VbEAShmCtrlSend(t_vbEADesc *desc, t_vbEAOpcode opcode, const void *payload, INT32U payloadLen, BOOLEAN txSwitch)
+{
+  t_vbEAError  ret;
+  t_vbEAMsg   *msg = NULL;
+
+  ret = VbEAMsgAlloc(&msg, payloadLen, opcode);
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    if (payloadLen > 0)
+    {
+      memcpy(msg->eaPayload.msg, payload, payloadLen);
+    }
+
+    pthread_mutex_lock(&(desc->mutex));
+
+    // Always through the socket. Switching under the same lock keeps frames sent
+    // afterwards by other threads behind this one
+    if ((desc->sockFd == VB_EA_INVALID_FD) ||
+        (send(desc->sockFd, msg->eaFullMsg.msg, msg->eaFullMsg.msgLen, MSG_NOSIGNAL) != (ssize_t)msg->eaFullMsg.msgLen))
+    {
+      ret = VB_EA_ERR_SOCKET;
+    }
+    else
+    {
+      if ((txSwitch == TRUE) && (desc->shm != NULL))
+      {
+        desc->shm->txActive = TRUE;
+      }
+
+      VbEADbgMsgAdd(desc, TRUE, opcode);
+    }
+
+    pthread_mutex_unlock(&(desc->mutex));
+
+    VbEAMsgFree(&msg);
+  }
+
+  if (ret != VB_EA_ERR_NONE)
+  {
+    VbLogPrint(VB_LOG_ERROR, "EA thread %s : Error (%d) sending %s", desc->thrName, ret, VbEAOpcodeToStrGet(opcode));
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void VbEAShmOffer(t_vbEADesc *desc)
+{
+  t_vbEAError  err;
+  t_vbEAShm   *shm = NULL;
+  t_vbEAShmReq req;
+
+  err = VbEAShmCreate(&shm, desc->shmRingSize);
+
+  if (err == VB_EA_ERR_NONE)
+  {
+    pthread_mutex_lock(&(desc->mutex));
+    desc->shm = shm;
+    pthread_mutex_unlock(&(desc->mutex));
+
+    bzero(&req, sizeof(req));
+    // Both names have the same size, segment name is always NUL terminated
+    memcpy(req.name, shm->name, sizeof(req.name));
+    req.nonce = _htonl(shm->nonce);
+    req.ringSize = _htonl(shm->ringSize);
+
+    // Frames keep going through the socket until the peer answers
+    err = VbEAShmCtrlSend(desc, VB_EA_OPCODE_SHM_REQ, &req, VB_EA_SHM_REQ_SIZE, FALSE);
+  }
+
+  if (err != VB_EA_ERR_NONE)
+  {
+    VbEAShmDetach(desc);
+  }
+}
+
+/*******************************************************************/
+
+static void VbEAShmCtrlProcess(t_vbEADesc *desc, t_vbEAOpcode opcode, INT8U *payload, INT32U payloadLen)
+{
+  switch (opcode)
+  {
+    case VB_EA_OPCODE_SHM_REQ:
+    {
+      t_vbEAShmRsp  rsp;
+      t_vbEAShm    *shm = NULL;
+
+      bzero(&rsp, sizeof(rsp));
+      rsp.status = VB_EA_SHM_RSP_OK;
+
+      if ((desc->type != VB_EA_TYPE_SERVER_CONN) || (desc->shm != NULL) || (payloadLen < VB_EA_SHM_REQ_SIZE))
+      {
+        rsp.status = VB_EA_SHM_RSP_DISABLED;
+      }
+      else
+      {
+        t_vbEAShmReq *req = (t_vbEAShmReq *)payload;
+        CHAR          name[VB_EA_SHM_NAME_MAX_SIZE];
+        INT32U        ring_size = _ntohl(req->ringSize);
+
+        memcpy(name, req->name, VB_EA_SHM_NAME_MAX_SIZE);
+        name[VB_EA_SHM_NAME_MAX_SIZE - 1] = '\0';
+
+        if ((desc->shmRingSize == 0) || (ring_size > desc->shmRingSize))
+        {
+          rsp.status = VB_EA_SHM_RSP_DISABLED;
+        }
+        else if (VbEAShmAttach(&shm, name, _ntohl(req->nonce), ring_size) != VB_EA_ERR_NONE)
+        {
+          rsp.status = VB_EA_SHM_RSP_UNREACHABLE;
+        }
+        else
+        {
+          pthread_mutex_lock(&(desc->mutex));
+          desc->shm = shm;
+          pthread_mutex_unlock(&(desc->mutex));
+        }
+      }
+
+      // Own frames go through the segment right after the answer.
+      // Peer frames keep arriving through the socket until its switch trigger.
+      if (VbEAShmCtrlSend(desc, VB_EA_OPCODE_SHM_RSP, &rsp, VB_EA_SHM_RSP_SIZE, (rsp.status == VB_EA_SHM_RSP_OK)?TRUE:FALSE) != VB_EA_ERR_NONE)
+      {
+        VbEAShmDetach(desc);
+      }
+      else if (rsp.status != VB_EA_SHM_RSP_OK)
+      {
+        VbLogPrint(VB_LOG_INFO, "EA thread %s : Shared memory transport declined (%d), keeping socket", desc->thrName, rsp.status);
+      }
+
+      break;
+    }
+
+    case VB_EA_OPCODE_SHM_RSP:
+    {
+      if ((desc->type == VB_EA_TYPE_CLIENT) && (desc->shm != NULL) && (desc->shm->txActive == FALSE) &&
+          (payloadLen >= VB_EA_SHM_RSP_SIZE))
+      {
+        t_vbEAShmRsp *rsp = (t_vbEAShmRsp *)payload;
+
+        // Peer has already mapped it or never will, name is not needed anymore
+        VbEAShmUnlink(desc->shm);
+
+        if (rsp->status == VB_EA_SHM_RSP_OK)
+        {
+          // Peer frames come through the segment from now on
+          desc->shm->rxActive = TRUE;
+
+          if (VbEAShmCtrlSend(desc, VB_EA_OPCODE_SHM_SWITCH_TRG, NULL, 0, TRUE) == VB_EA_ERR_NONE)
+          {
+            VbLogPrint(VB_LOG_INFO, "EA thread %s : Switched to shared memory transport %s", desc->thrName, desc->shm->name);
+          }
+        }
+        else
+        {
+          VbLogPrint(VB_LOG_INFO, "EA thread %s : Peer declined shared memory transport (%d), keeping socket", desc->thrName, rsp->status);
+          VbEAShmDetach(desc);
+        }
+      }
+
+      break;
+    }
+
+    case VB_EA_OPCODE_SHM_SWITCH_TRG:
+    {
+      if ((desc->type == VB_EA_TYPE_SERVER_CONN) && (desc->shm != NULL) && (desc->shm->txActive == TRUE))
+      {
+        // Last frame the peer sends through the socket
+        desc->shm->rxActive = TRUE;
+
+        VbLogPrint(VB_LOG_INFO, "EA thread %s : Switched to shared memory transport %s", desc->thrName, desc->shm->name);
+      }
+
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+/*******************************************************************/
+
+static void VbEAShmRxProcess(t_vbEADesc *desc)
+{
+  t_vbEAError  err;
+  INT8U       *frame = NULL;
+  INT32U       frame_len = 0;
+
+  err = VbEAShmFramePeek(desc->shm, &frame, &frame_len, VB_EA_SHM_WAIT_MS);
+
+  if (err == VB_EA_ERR_NONE)
+  {
+    t_vbEAOpcode rx_opcode = ((struct _vbEAFrameHeader *)frame)->opcode;
+
+    // Frame is handed in place and released once processed
+    desc->processRxMsgCb(desc, frame, frame_len - VB_EA_HEADER_SIZE);
+    VbEAShmFrameRelease(desc->shm, frame_len);
+
+    // Add frame to debug table
+    pthread_mutex_lock(&(desc->mutex));
+    VbEADbgMsgAdd(desc, FALSE, rx_opcode);
+    pthread_mutex_unlock(&(desc->mutex));
+  }
+  else if (err == VB_EA_ERR_NOT_FOUND)
+  {
+    INT8U   byte;
+    ssize_t n;
+
+    // Idle for a while, check the socket is still alive. Nothing else shall arrive through it.
+    n = recv(desc->sockFd, &byte, sizeof(byte), MSG_PEEK | MSG_DONTWAIT);
+
+    if (n == 0)
+    {
+      VbLogPrint(VB_LOG_WARNING, "Socket was remotely closed");
+      desc->connected = FALSE;
+    }
+    else if ((n > 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)))
+    {
+      VbLogPrint(VB_LOG_ERROR, "Unexpected socket state on shared memory transport [%s]", (n > 0)?"data":strerror(errno));
+      desc->connected = FALSE;
+    }
+  }
+  else
+  {
+    if (err == VB_EA_ERR_SOCKET)
+    {
+      VbLogPrint(VB_LOG_WARNING, "Shared memory transport was remotely closed");
+    }
+
+    // Abort connection thread
+    desc->connected = FALSE;
+  }
+}
+
+/*******************************************************************/
+
+static t_vbEAError VbEAConnFrameProcess(t_vbEADesc *desc, INT8U *frame, INT32U payloadLen)
+{
+  t_vbEAError  ret;
+  t_vbEAOpcode rx_opcode = ((t_vbEAFrameHeader *)frame)->opcode;
+
+  if ((rx_opcode == VB_EA_OPCODE_SHM_REQ) || (rx_opcode == VB_EA_OPCODE_SHM_RSP) || (rx_opcode == VB_EA_OPCODE_SHM_SWITCH_TRG))
+  {
+    // Transport negotiation, not forwarded
+    VbEAShmCtrlProcess(desc, rx_opcode, frame + VB_EA_PAYLOAD_OFFSET, payloadLen);
+  }
+  else
+  {
+    // Process rx msg
+    desc->processRxMsgCb(desc, frame, payloadLen);
+  }
+
+  // Add frame to debug table
+  pthread_mutex_lock(&(desc->mutex));
+  ret = VbEADbgMsgAdd(desc, FALSE, rx_opcode);
+  pthread_mutex_unlock(&(desc->mutex));
+
+  return ret;
+}
+
+/*******************************************************************/
+
+#if (_IO_URING_ == 1)
+static void VbEAIoUringRxCreate(t_vbEADesc *desc)
+{
+  t_vbEAIoUringRx *rx;
+
+  rx = calloc(1, sizeof(*rx));
+
+  if (rx != NULL)
+  {
+    if (VbIoUringInit(&(rx->ring), VB_EA_URING_ENTRIES) != VB_IO_URING_ERROR_NONE)
+    {
+      free(rx);
+      rx = NULL;
+    }
+    else if ((VbIoUringOpSupported(&(rx->ring), IORING_OP_RECV) == FALSE) ||
+             (VbIoUringBufRingSetup(&(rx->ring), &(rx->bufRing), VB_EA_URING_BUF_GROUP,
+                                    VB_EA_URING_NUM_BUFS, VB_EA_URING_BUF_SIZE) != VB_IO_URING_ERROR_NONE))
+    {
+      VbIoUringDestroy(&(rx->ring));
+      free(rx);
+      rx = NULL;
+    }
+  }
+
+  if (rx == NULL)
+  {
+    VbLogPrint(VB_LOG_INFO, "%s: io_uring receive not available, using blocking receive", desc->thrName);
+  }
+
+  pthread_mutex_lock(&(desc->mutex));
+  desc->ioUringRx = rx;
+  pthread_mutex_unlock(&(desc->mutex));
+}
+
+#endif
+
+/*******************************************************************/
+
+static void VbEAIoUringRxDestroy(t_vbEADesc *desc)
+{
+  t_vbEAIoUringRx *rx;
+
+  pthread_mutex_lock(&(desc->mutex));
+  rx = desc->ioUringRx;
+  desc->ioUringRx = NULL;
+  pthread_mutex_unlock(&(desc->mutex));
+
+  if (rx != NULL)
+  {
+    // Closing the ring cancels the pending receive
+    VbIoUringBufRingDestroy(&(rx->ring), &(rx->bufRing));
+    VbIoUringDestroy(&(rx->ring));
+    free(rx->stream);
+    free(rx);
+  }
+}
+
+/*******************************************************************/
+
+#if (_IO_URING_ == 1)
+/**
+ * @brief Processes all whole frames in data
+ * @return Bytes consumed
+ **/
+static INT32U VbEAIoUringRxFramesProcess(t_vbEADesc *desc, INT8U *data, INT32U len)
+{
+  INT32U offset = 0;
+
+  while ((desc->running == TRUE) && (desc->connected == TRUE) &&
+         ((desc->shm == NULL) || (desc->shm->rxActive == FALSE)) &&
+         ((len - offset) >= VB_EA_HEADER_SIZE))
+  {
+    t_vbEAFrameHeader *frame_header = (t_vbEAFrameHeader *)(data + offset);
+    INT32U             payload_length = _ntohs(frame_header->length);
+
+    if (frame_header->VBCode != VB_EA_CODE_FLAG)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Corrupted message received");
+
+      // Abort connection thread
+      desc->connected = FALSE;
+    }
+    else if ((len - offset) >= (VB_EA_HEADER_SIZE + payload_length))
+    {
+      VbEAConnFrameProcess(desc, data + offset, payload_length);
+      desc->ioUringRx->frames++;
+      offset += VB_EA_HEADER_SIZE + payload_length;
+    }
+    else
+    {
+      // Rest of the frame comes in next completions
+      break;
+    }
+  }
+
+  return offset;
+}
+
+/*******************************************************************/
+
+static void VbEAIoUringRxData(t_vbEADesc *desc, INT8U *data, INT32U len)
+{
+  t_vbEAIoUringRx *rx = desc->ioUringRx;
+  INT32U           consumed;
+
+  if (rx->streamLen == 0)
+  {
+    // Frames fully contained in the completion buffer are parsed in place
+    consumed = VbEAIoUringRxFramesProcess(desc, data, len);
+    data += consumed;
+    len -= consumed;
+  }
+
+  if ((len > 0) && (desc->connected == TRUE))
+  {
+    if ((rx->streamLen + len) > rx->streamCap)
+    {
+      INT32U  new_cap = MAX(rx->streamLen + len, MAX(rx->streamCap * 2, VB_EA_BUFFER_SIZE));
+      INT8U  *new_stream = realloc(rx->stream, new_cap);
+
+      if (new_stream == NULL)
+      {
+        // No available memory, abort connection
+        desc->connected = FALSE;
+      }
+      else
+      {
+        rx->stream = new_stream;
+        rx->streamCap = new_cap;
+      }
+    }
+
+    if (desc->connected == TRUE)
+    {
+      memcpy(rx->stream + rx->streamLen, data, len);
+      rx->streamLen += len;
+
+      consumed = VbEAIoUringRxFramesProcess(desc, rx->stream, rx->streamLen);
+
+      if (consumed > 0)
+      {
+        rx->copied++;
+        rx->streamLen -= consumed;
+        memmove(rx->stream, rx->stream + consumed, rx->streamLen);
+      }
+    }
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Waits for socket data through the ring and processes received frames.
+ * @return VB_EA_ERR_NOT_SUPPORTED if kernel rejects multishot receive (blocking receive shall be used)
+ **/
+static t_vbEAError VbEAIoUringRxProcess(t_vbEADesc *desc)
+{
+  t_vbEAError          ret = VB_EA_ERR_NONE;
+  t_vbEAIoUringRx     *rx = desc->ioUringRx;
+  struct io_uring_cqe *cqe;
+
+  if (rx->armed == FALSE)
+  {
+    struct io_uring_sqe *sqe = VbIoUringSqeGet(&(rx->ring));
+
+    if (sqe != NULL)
+    {
+      VbIoUringPrepRecvMultishot(sqe, desc->sockFd, VB_EA_URING_BUF_GROUP, VB_EA_URING_RECV_TAG);
+      rx->armed = TRUE;
+    }
+  }
+
+  // Single syscall per batch of completions, frames of all of them are processed below
+  if (VbIoUringSubmit(&(rx->ring), 1) != VB_IO_URING_ERROR_NONE)
+  {
+    VbLogPrint(VB_LOG_ERROR, "Error waiting on io_uring [%s]", strerror(errno));
+
+    // Abort connection thread
+    desc->connected = FALSE;
+  }
+
+  while ((ret == VB_EA_ERR_NONE) && (desc->running == TRUE) && (desc->connected == TRUE) &&
+         ((desc->shm == NULL) || (desc->shm->rxActive == FALSE)) &&
+         ((cqe = VbIoUringCqePeek(&(rx->ring))) != NULL))
+  {
+    INT32S res = cqe->res;
+
+    if ((cqe->flags & IORING_CQE_F_MORE) == 0)
+    {
+      rx->armed = FALSE;
+    }
+
+    if (res > 0)
+    {
+      INT16U  buf_id;
+      INT8U  *data = VbIoUringBufRingBufGet(&(rx->bufRing), cqe, &buf_id);
+
+      VbIoUringCqeSeen(&(rx->ring));
+
+      rx->received = TRUE;
+      rx->bytes += res;
+      VbEAIoUringRxData(desc, data, res);
+
+      VbIoUringBufRingRecycle(&(rx->bufRing), buf_id);
+    }
+    else
+    {
+      VbIoUringCqeSeen(&(rx->ring));
+
+      if (res == 0)
+      {
+        // Socket was orderly closed
+        VbLogPrint(VB_LOG_WARNING, "Socket was remotely closed");
+
+        // Abort connection thread
+        desc->connected = FALSE;
+      }
+      else if (res == -ENOBUFS)
+      {
+        // All buffers were in use, data is kept in the socket until receive is armed again
+        rx->rearms++;
+      }
+      else if ((res == -EINVAL) && (rx->received == FALSE))
+      {
+        // Kernel without multishot receive
+        ret = VB_EA_ERR_NOT_SUPPORTED;
+      }
+      else
+      {
+        // Socket error
+        VbLogPrint(VB_LOG_ERROR, "Error reading from socket [%s]", strerror(-res));
+
+        // Abort connection thread
+        desc->connected = FALSE;
+      }
+    }
+  }
+
+  return ret;
+}
+
+#endif
+
+/*******************************************************************/
+
 static t_vbEAError VbEAConnProcess(t_vbEADesc *desc)
 {
   t_vbEAError  ret = VB_EA_ERR_NONE;
-  t_vbEAOpcode rx_opcode = VB_EA_OPCODE_LAST;
   CHAR         str_addr[INET6_ADDRSTRLEN];
 
   if ((desc == NULL) || (desc->sockFd == VB_EA_INVALID_FD) || (desc->processRxMsgCb == NULL))
@@ -328,6 +907,20 @@ static t_vbEAError VbEAConnProcess(t_vbEADesc *desc)
       desc->connectCb(desc, desc->clientAddr, desc->sockFd);
     }
 
+    if ((desc->type == VB_EA_TYPE_CLIENT) && (desc->shmRingSize > 0) && (VbEAShmPeerIsLocal(desc->sockFd) == TRUE))
+    {
+      // Peer runs on this host, offer a shared memory transport
+      VbEAShmOffer(desc);
+    }
+
+#if (_IO_URING_ == 1)
+    if ((desc->ioUring == TRUE) && (VbIoUringAvailable() == TRUE))
+    {
+      // NULL on failure, blocking receive is used then
+      VbEAIoUringRxCreate(desc);
+    }
+#endif
+
     while ((desc->running == TRUE) && (desc->connected == TRUE))
     {
       int     buffer_offset = 0;   // total bytes (from the current message) received
@@ -336,6 +929,27 @@ static t_vbEAError VbEAConnProcess(t_vbEADesc *desc)
 
       buffer = desc->buffer;
 
+      if ((desc->shm != NULL) && (desc->shm->rxActive == TRUE))
+      {
+        // Peer switched to shared memory, socket is only watched for closing
+        VbEAIoUringRxDestroy(desc);
+        VbEAShmRxProcess(desc);
+        continue;
+      }
+
+#if (_IO_URING_ == 1)
+      if (desc->ioUringRx != NULL)
+      {
+        if (VbEAIoUringRxProcess(desc) == VB_EA_ERR_NOT_SUPPORTED)
+        {
+          VbLogPrint(VB_LOG_INFO, "%s: multishot receive not supported, using blocking receive", desc->thrName);
+          VbEAIoUringRxDestroy(desc);
+        }
+
+        continue;
+      }
+#endif
+
       /*
        * Wait until a whole packet header is received. The payload
        * length is contained in this header and we can then resize
@@ -390,7 +1004,6 @@ static t_vbEAError VbEAConnProcess(t_vbEADesc *desc)
         else
         {
           payload_length = _ntohs(frame_header->length);
-          rx_opcode = frame_header->opcode;
         }
       }
 
@@ -453,13 +1066,7 @@ static t_vbEAError VbEAConnProcess(t_vbEADesc *desc)
 
       if ((desc->running == TRUE) && (desc->connected == TRUE))
       {
-        // Process rx msg
-        desc->processRxMsgCb(desc, buffer, payload_length);
-
-        // Add frame to debug table
-        pthread_mutex_lock(&(desc->mutex));
-        ret = VbEADbgMsgAdd(desc, FALSE, rx_opcode);
-        pthread_mutex_unlock(&(desc->mutex));
+        ret = VbEAConnFrameProcess(desc, buffer, payload_length);
       }
 
       // Clean up
@@ -481,6 +1088,11 @@ static t_vbEAError VbEAConnProcess(t_vbEADesc *desc)
 
     desc->connected = FALSE;
 
+    VbEAIoUringRxDestroy(desc);
+
+    // Leave shared memory transport (if any), peer notices it
+    VbEAShmDetach(desc);
+
     if (desc->type == VB_EA_TYPE_SERVER_CONN)
     {
       // Server connection
@@ -847,7 +1459,7 @@ t_vbEAError VbEAThreadStart(t_vbEADesc *desc)
     desc->running = TRUE;
 
     // Starting common EA thread
-    running = VbThreadCreate(desc->thrName, VbEACommonThread, (void *)desc, VB_EA_THREAD_PRIORITY, &(desc->threadId));
+    running = VbThreadCreate(desc->thrName, VbEACommonThread, (void *)desc, VB_EA_THREAD_CLASS, &(desc->threadId));
 
     if (running == FALSE)
     {
@@ -886,6 +1498,9 @@ t_vbEAError VbEAThreadStop(t_vbEADesc *desc)
         shutdown(desc->sockFd, SHUT_RDWR);
       }
 
+      // Connection thread may be parked on shared memory instead of the socket
+      VbEAShmRxWake(desc->shm);
+
       pthread_mutex_unlock(&(desc->mutex));
 
       VbThreadJoin(desc->threadId, desc->thrName);
@@ -1049,6 +1664,7 @@ t_vbEAError VbEAMsgParse(t_vbEAMsg **msg, INT8U *rxBuffer)
 t_vbEAError VbEAMsgSend(t_vbEADesc *desc, t_vbEAMsg *msg)
 {
   t_vbEAError       ret = VB_EA_ERR_NONE;
+  t_vbEAError       shm_err = VB_EA_ERR_NONE;
   INT16S            n = 0;
 
   if ((desc == NULL) || (desc->type == VB_EA_TYPE_SERVER))
@@ -1081,6 +1697,25 @@ t_vbEAError VbEAMsgSend(t_vbEADesc *desc, t_vbEAMsg *msg)
     {
       ret = VB_EA_ERR_BAD_ARGS;
     }
+    else if ((desc->shm != NULL) && (desc->shm->txActive == TRUE))
+    {
+      // Same framing, copied straight into the peer rx ring
+      do
+      {
+        shm_err = VbEAShmFrameWrite(desc->shm, msg->eaFullMsg.msg, msg->eaFullMsg.msgLen, VB_EA_SHM_WAIT_MS);
+      } while ((shm_err == VB_EA_ERR_QUEUE) && (desc->running == TRUE) && (desc->connected == TRUE));
+
+      if (shm_err != VB_EA_ERR_NONE)
+      {
+        // Connection thread closes the connection as when the socket fails
+        desc->connected = FALSE;
+        VbEAShmRxWake(desc->shm);
+      }
+      else
+      {
+        VbEADbgMsgAdd(desc, TRUE, msg->opcode);
+      }
+    }
     else
     {
       n = send(desc->sockFd, msg->eaFullMsg.msg, msg->eaFullMsg.msgLen, MSG_NOSIGNAL);
@@ -1101,6 +1736,11 @@ t_vbEAError VbEAMsgSend(t_vbEADesc *desc, t_vbEAMsg *msg)
     {
       VbLogPrint(VB_LOG_ERROR, "Error buffer empty");
     }
+    else if (shm_err != VB_EA_ERR_NONE)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Error (%d) writing to shared memory transport", shm_err);
+      ret = VB_EA_ERR_SOCKET;
+    }
     else if (n < 0)
     {
       // Error sending frame, abort connection
@@ -1195,6 +1835,48 @@ const CHAR *VbEAOpcodeToStrGet(t_vbEAOpcode opcode)
   return opcode_str;
 }
 
+/************************************************************************/
+
+t_vbEAFlowClass VbEAFlowClassGet(t_vbEAOpcode opcode)
+{
+  t_vbEAFlowClass flow_class;
+
+  switch (opcode)
+  {
+    case VB_EA_OPCODE_BGN_RESP:
+    case VB_EA_OPCODE_CFR_RESP:
+    case VB_EA_OPCODE_SNRPROBES_RESP:
+    case VB_EA_OPCODE_MEAS_COLLECT_END:
+      // Collection end travels with the measures so it never overtakes them
+      flow_class = VB_EA_FLOW_CLASS_MEASURE;
+      break;
+
+    case VB_EA_OPCODE_TRAFFIC_AWARENESS_TRG:
+      flow_class = VB_EA_FLOW_CLASS_TELEMETRY;
+      break;
+
+    default:
+      flow_class = VB_EA_FLOW_CLASS_CONTROL;
+      break;
+  }
+
+  return flow_class;
+}
+
+/************************************************************************/
+
+const CHAR *VbEAFlowClassToStr(t_vbEAFlowClass flowClass)
+{
+  const CHAR *class_str = "UNKNOWN";
+
+  if (flowClass < VB_EA_FLOW_CLASS_LAST)
+  {
+    class_str = eaFlowClassString[flowClass];
+  }
+
+  return class_str;
+}
+
 /*******************************************************************/
 
 void VbEADbgMsgReset(t_vbEADbgTable *table)
@@ -1214,6 +1896,35 @@ void VbEADbgMsgDump(t_vbEADbgTable *tables, t_writeFun writeFun)
 
 /*******************************************************************/
 
+void VbEATransportDump(t_vbEADesc *desc, t_writeFun writeFun)
+{
+  if ((desc != NULL) && (writeFun != NULL))
+  {
+    pthread_mutex_lock(&(desc->mutex));
+
+    if (desc->shm != NULL)
+    {
+      VbEAShmDump(desc->shm, writeFun);
+    }
+    else if (desc->ioUringRx != NULL)
+    {
+      t_vbEAIoUringRx *rx = desc->ioUringRx;
+
+      writeFun("Transport: socket, io_uring receive (%u x %u bytes buffers)\n", rx->bufRing.numBufs, rx->bufRing.bufSize);
+      writeFun("  Frames %llu, bytes %llu, split frames %llu, ring enters %llu, completions %llu, rearms %llu\n",
+          rx->frames, rx->bytes, rx->copied, rx->ring.stats.enters, rx->ring.stats.completed, rx->rearms);
+    }
+    else
+    {
+      writeFun("Transport: socket\n");
+    }
+
+    pthread_mutex_unlock(&(desc->mutex));
+  }
+}
+
+/*******************************************************************/
+
 t_vbEAError VbEADescDestroy(t_vbEADesc *desc)
 {
   t_vbEAError ret = VB_EA_ERR_NONE;
@@ -108,8 +108,13 @@
 #define VB_EA_ALIGN_SYNC_LOST_TRG_SIZE         (sizeof(t_vbEAAlignSyncLost))
 #define VB_EA_CLUSTER_STOP_REQ_SIZE            (sizeof(t_vbEAAlignClusterStopReq))
 #define VB_EA_SOCKET_ALIVE_REQ_SIZE            (sizeof(t_vbEASocketAliveReq))
+#define VB_EA_FLOW_CREDIT_SIZE                 (sizeof(t_vbEAFlowCredit))
+#define VB_EA_SHM_REQ_SIZE                     (sizeof(t_vbEAShmReq))
+#define VB_EA_SHM_RSP_SIZE                     (sizeof(t_vbEAShmRsp))
 #define VB_EA_VERSION_MAX_SIZE                 (31) // "xx.xx ryyyy" + null byte
 #define VB_EA_DRIVER_ID_MAX_SIZE               (21) // 20 digits + null byte
+#define VB_EA_FLOW_CREDIT_UNLIMITED            (0xFFFF) // Class not flow controlled
+#define VB_EA_SHM_NAME_MAX_SIZE                (32)     // Shared memory segment name, null byte included
 
 #define VB_EA_ALIGN_GHN_MAX_RELAYS             (VB_ALIGN_GHN_MAX_RELAYS)
 #define VB_EA_ALIGN_GHN_MAX_TX_NODES           (VB_ALIGN_GHN_MAX_TX_NODES)
@@ -133,6 +138,7 @@ typedef enum
   VB_EA_ERR_OTHER = -31,                      ///< Unknown error
   VB_EA_ERR_QUEUE = -32,                      ///< Queue related error
   VB_EA_ERR_SOCKET = -33,                     ///< Socket related error
+  VB_EA_ERR_TIMEOUT = -34,                    ///< Timeout
   // Errors specific to the component are defined here starting at -32
 
 } t_vbEAError;
@@ -188,6 +194,10 @@ typedef enum
   VB_EA_OPCODE_NETWORK_CHANGE_REPORT   = 0x27,
   VB_EA_OPCODE_SOCKET_ALIVE_REQUEST    = 0x28,
   VB_EA_OPCODE_SOCKET_ALIVE_RESP       = 0x29,
+  VB_EA_OPCODE_FLOW_CREDIT             = 0x2A,
+  VB_EA_OPCODE_SHM_REQ                 = 0x2B,
+  VB_EA_OPCODE_SHM_RSP                 = 0x2C,
+  VB_EA_OPCODE_SHM_SWITCH_TRG          = 0x2D,
   VB_EA_OPCODE_LAST,
 } t_vbEAOpcode;
 
@@ -238,6 +248,27 @@ typedef enum
   VB_EA_DOMAIN_REPORT_DIFF       = 0x01,
 } t_vbEADomainReportType;
 
+/**
+ * @brief EA flow control classes. Frames of CONTROL class are never held back;
+ * frames of the other classes are only sent while the engine has granted credits for them.
+ * Class index is also the position of its credits in @ref t_vbEAFlowCredit.
+ **/
+typedef enum
+{
+  VB_EA_FLOW_CLASS_CONTROL = 0,   ///< Requests, responses and triggers driving the FSMs
+  VB_EA_FLOW_CLASS_MEASURE,       ///< Bulk measurements (BGN, CFR, SNR probes) and their collection end
+  VB_EA_FLOW_CLASS_TELEMETRY,     ///< Periodic traffic reports
+  VB_EA_FLOW_CLASS_LAST,
+} t_vbEAFlowClass;
+
+/// Answer to a shared memory transport offer
+typedef enum
+{
+  VB_EA_SHM_RSP_OK = 0,                       ///< Segment mapped, both sides switch to it
+  VB_EA_SHM_RSP_DISABLED,                     ///< Transport disabled or ring size above own limit
+  VB_EA_SHM_RSP_UNREACHABLE,                  ///< Segment not found (peer on a different host) or not matching the offer
+} t_vbEAShmRspStatus;
+
 /// EA thread types
 typedef enum
 {
@@ -273,6 +304,8 @@ typedef struct
 } t_vbEADbgTable;
 
 typedef struct s_vbEADesc t_vbEADesc;
+typedef struct s_vbEAShm t_vbEAShm;
+typedef struct s_vbEAIoUringRx t_vbEAIoUringRx;
 typedef void (*t_vbEACloseCb)(t_vbEADesc *desc);
 typedef void (*t_vbEADisconnectCb)(t_vbEADesc *desc);
 typedef t_vbEAError (*t_vbEAConnectCb)(t_vbEADesc *desc, struct sockaddr_in6 clientAddr, INT32S sockFd);
@@ -302,6 +335,10 @@ struct s_vbEADesc
   BOOLEAN               running;               ///< OUTPUT param: TRUE: thread is running; FALSE: otherwise
   BOOLEAN               connected;             ///< OUTPUT param: TRUE: connection is opened; FALSE: otherwise
   INT32U                socketAliveCounter;    ///<
+  INT32U                shmRingSize;           ///< INPUT  param: Shared memory ring size offered (client) or max accepted (server conn). 0 disables it
+  t_vbEAShm            *shm;                   ///< OUTPUT param: Shared memory transport, NULL while frames go through the socket
+  BOOLEAN               ioUring;               ///< INPUT  param: TRUE: socket is read through an io_uring ring when kernel supports it
+  t_vbEAIoUringRx      *ioUringRx;             ///< OUTPUT param: io_uring receive context, NULL on blocking receive
   void                 *args;                  ///< INPUT  param: Generic arguments pointer
   t_vbEADbgTable        debugTable;            ///< OUTPUT param: Debug counters for this interface
 };
@@ -732,6 +769,28 @@ struct PACKMEMBER _vbEASocketAliveReq
 };
 typedef struct _vbEASocketAliveReq TYPE_ALIGNED32(t_vbEASocketAliveReq);
 
+// EA FlowCredit.trg: credits added per flow class (frames the driver may send on top of previous grants)
+// or VB_EA_FLOW_CREDIT_UNLIMITED
+struct PACKMEMBER _vbEAFlowCredit
+{
+  INT16U credits[VB_EA_FLOW_CLASS_LAST];
+};
+typedef struct _vbEAFlowCredit TYPE_ALIGNED32(t_vbEAFlowCredit);
+
+struct PACKMEMBER _vbEAShmReq
+{
+  CHAR   name[VB_EA_SHM_NAME_MAX_SIZE];
+  INT32U nonce;
+  INT32U ringSize;
+};
+typedef struct _vbEAShmReq TYPE_ALIGNED32(t_vbEAShmReq);
+
+struct PACKMEMBER _vbEAShmRsp
+{
+  INT8U status;                               ///< @ref t_vbEAShmRspStatus
+};
+typedef struct _vbEAShmRsp TYPE_ALIGNED32(t_vbEAShmRsp);
+
 /*
  ************************************************************************
  ** Public function definition
@@ -821,6 +880,20 @@ t_vbEAError VbEADescInit(t_vbEADesc *desc);
  **/
 const CHAR *VbEAOpcodeToStrGet(t_vbEAOpcode opcode);
 
+/**
+ * @brief Gets the flow control class of given opcode
+ * @param[in] opcode EA opcode
+ * @return @ref t_vbEAFlowClass
+ **/
+t_vbEAFlowClass VbEAFlowClassGet(t_vbEAOpcode opcode);
+
+/**
+ * @brief Gets the flow control class name
+ * @param[in] flowClass Flow control class
+ * @return Class name
+ **/
+const CHAR *VbEAFlowClassToStr(t_vbEAFlowClass flowClass);
+
 /**
  * @brief Dump all Messages counters
  * @param[in] writeFun Function to write to
@@ -834,6 +907,13 @@ void VbEADbgMsgDump(t_vbEADbgTable *tables, t_writeFun writeFun);
  **/
 void VbEADbgMsgReset(t_vbEADbgTable *table);
 
+/**
+ * @brief Dumps the transport in use by a connection and its counters
+ * @param[in] desc Connection descriptor
+ * @param[in] writeFun Console write function
+ **/
+void VbEATransportDump(t_vbEADesc *desc, t_writeFun writeFun);
+
 /**
  * @brief Console command related to EA messages module
  * @param[in] arg Generic argument
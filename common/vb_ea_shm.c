@@ -0,0 +1,782 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_ea_shm.c
+ * @brief Shared memory transport for EA connections between co-located processes
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "types.h"
+#include "vb_util.h"
+#include "vb_log.h"
+#include "vb_ea_shm.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_EA_SHM_PREFIX                ("/VbEAShm")
+#define VB_EA_SHM_MAGIC                 (0x56424553) // "VBES"
+#define VB_EA_SHM_LAYOUT_VERSION        (1)
+#define VB_EA_SHM_MAX_FRAME_SIZE        (VB_EA_HEADER_SIZE + 0xFFFF)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+/// Segment header. Written once by the creator, except closed flags.
+struct s_vbEAShmHdr
+{
+  INT32U          magic;                          ///< VB_EA_SHM_MAGIC
+  INT32U          version;                        ///< VB_EA_SHM_LAYOUT_VERSION
+  INT32U          hdrSize;                        ///< sizeof(t_vbEAShmHdr)
+  INT32U          ringCtrlSize;                   ///< sizeof(t_vbEAShmRing)
+  INT32U          ringSize;                       ///< Data bytes of each ring
+  INT32U          nonce;
+  volatile INT32U closed[VB_EA_SHM_SIDE_LAST];    ///< Set by each side when it leaves
+} __attribute__((aligned(64)));
+
+/// Ring control. Producer and consumer owned counters lie on different cache lines.
+struct s_vbEAShmRing
+{
+  volatile INT32U head __attribute__((aligned(64)));  ///< Bytes ever written (producer)
+  volatile INT32U frameDoorbell;                      ///< Futex bumped by producer after publishing frames
+  volatile INT32U consumerParked;                     ///< Consumer is waiting on frameDoorbell
+  volatile INT32U tail __attribute__((aligned(64)));  ///< Bytes ever released (consumer)
+  volatile INT32U roomDoorbell;                       ///< Futex bumped by consumer after releasing frames
+  volatile INT32U producerParked;                     ///< Producer is waiting on roomDoorbell
+} __attribute__((aligned(64)));
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static INT32U vbEAShmSeq = 0;
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+/*
+ * Ring indexes, doorbells and flags are shared with the peer process. They are accessed with
+ * full barriers and __sync builtins only, as older toolchains (gcc-4.4) lack __atomic ones.
+ */
+static inline INT32U VbEAShmLoad(volatile INT32U *ptr)
+{
+  INT32U val;
+
+  __sync_synchronize();
+  val = *ptr;
+  __sync_synchronize();
+
+  return val;
+}
+
+/*******************************************************************/
+
+static inline void VbEAShmStore(volatile INT32U *ptr, INT32U val)
+{
+  __sync_synchronize();
+  *ptr = val;
+  __sync_synchronize();
+}
+
+/*******************************************************************/
+
+static INT64U VbEAShmNowMs(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return ((INT64U)now.tv_sec * 1000) + ((INT64U)now.tv_nsec / 1000000);
+}
+
+/*******************************************************************/
+
+static void VbEAShmFutexWait(volatile INT32U *addr, INT32U val, INT32U timeoutMs)
+{
+  struct timespec rel;
+
+  rel.tv_sec = timeoutMs / 1000;
+  rel.tv_nsec = (timeoutMs % 1000) * 1000000;
+
+  // Segment is shared between processes, so private futexes can not be used
+  syscall(SYS_futex, addr, FUTEX_WAIT, val, &rel, NULL, 0);
+}
+
+/*******************************************************************/
+
+static void VbEAShmFutexWake(volatile INT32U *addr)
+{
+  syscall(SYS_futex, addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+/*******************************************************************/
+
+static INT32U VbEAShmMapLenGet(INT32U ringSize)
+{
+  return sizeof(t_vbEAShmHdr) + (VB_EA_SHM_SIDE_LAST * sizeof(t_vbEAShmRing)) + (VB_EA_SHM_SIDE_LAST * ringSize);
+}
+
+/*******************************************************************/
+
+static void VbEAShmLayoutSet(t_vbEAShm *shm)
+{
+  t_vbEAShmRing *rings = (t_vbEAShmRing *)((INT8U *)shm->base + sizeof(t_vbEAShmHdr));
+  INT8U         *data = (INT8U *)(rings + VB_EA_SHM_SIDE_LAST);
+
+  // Ring N carries frames sent by side N
+  shm->hdr = (t_vbEAShmHdr *)shm->base;
+  shm->txRing = &rings[shm->side];
+  shm->rxRing = &rings[VB_EA_SHM_SIDE_LAST - 1 - shm->side];
+  shm->txData = data + (shm->side * shm->ringSize);
+  shm->rxData = data + ((VB_EA_SHM_SIDE_LAST - 1 - shm->side) * shm->ringSize);
+}
+
+/*******************************************************************/
+
+static BOOLEAN VbEAShmPeerClosed(t_vbEAShm *shm)
+{
+  return (VbEAShmLoad(&(shm->hdr->closed[VB_EA_SHM_SIDE_LAST - 1 - shm->side])) != 0)?TRUE:FALSE;
+}
+
+/*******************************************************************/
+
+static void VbEAShmRingCopyOut(t_vbEAShm *shm, INT32U pos, INT8U *dst, INT32U len)
+{
+  INT32U idx = pos & (shm->ringSize - 1);
+  INT32U first = MIN(len, shm->ringSize - idx);
+
+  memcpy(dst, shm->rxData + idx, first);
+
+  if (first < len)
+  {
+    memcpy(dst + first, shm->rxData, len - first);
+  }
+}
+
+/*******************************************************************/
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+BOOLEAN VbEAShmRingSizeCheck(INT32U ringSize)
+{
+  BOOLEAN ret = FALSE;
+
+  if ((ringSize == 0) ||
+      ((ringSize >= VB_EA_SHM_RING_MIN_SIZE) &&
+       (ringSize <= VB_EA_SHM_RING_MAX_SIZE) &&
+       ((ringSize & (ringSize - 1)) == 0)))
+  {
+    ret = TRUE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_vbEAError VbEAShmCreate(t_vbEAShm **shm, INT32U ringSize)
+{
+  t_vbEAError  ret = VB_EA_ERR_NONE;
+  t_vbEAShm   *new_shm = NULL;
+  INT32S       fd = -1;
+  INT32U       seq;
+
+  if ((shm == NULL) || (ringSize == 0) || (VbEAShmRingSizeCheck(ringSize) == FALSE))
+  {
+    ret = VB_EA_ERR_BAD_ARGS;
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    new_shm = (t_vbEAShm *)calloc(1, sizeof(t_vbEAShm));
+
+    if (new_shm == NULL)
+    {
+      ret = VB_EA_ERR_NO_MEMORY;
+    }
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    struct timespec now;
+
+    seq = __sync_add_and_fetch(&vbEAShmSeq, 1);
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    snprintf(new_shm->name, sizeof(new_shm->name), "%s_%d_%u", VB_EA_SHM_PREFIX, (int)getpid(), seq);
+    new_shm->side = VB_EA_SHM_SIDE_CLIENT;
+    new_shm->ringSize = ringSize;
+    new_shm->nonce = (INT32U)now.tv_nsec ^ ((INT32U)now.tv_sec << 20) ^ (seq << 8) ^ (INT32U)getpid();
+    new_shm->mapLen = VbEAShmMapLenGet(ringSize);
+
+    fd = shm_open(new_shm->name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+
+    if (fd < 0)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Error creating EA shared memory %s [%s]", new_shm->name, strerror(errno));
+      ret = VB_EA_ERR_NO_MEMORY;
+    }
+    else
+    {
+      new_shm->linked = TRUE;
+    }
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    // Contents are zero filled, so rings start empty
+    if (ftruncate(fd, new_shm->mapLen) != 0)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Error sizing EA shared memory %s [%s]", new_shm->name, strerror(errno));
+      ret = VB_EA_ERR_NO_MEMORY;
+    }
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    new_shm->base = mmap(NULL, new_shm->mapLen, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (new_shm->base == MAP_FAILED)
+    {
+      new_shm->base = NULL;
+      VbLogPrint(VB_LOG_ERROR, "Error mapping EA shared memory %s [%s]", new_shm->name, strerror(errno));
+      ret = VB_EA_ERR_NO_MEMORY;
+    }
+  }
+
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    VbEAShmLayoutSet(new_shm);
+
+    new_shm->hdr->version = VB_EA_SHM_LAYOUT_VERSION;
+    new_shm->hdr->hdrSize = sizeof(t_vbEAShmHdr);
+    new_shm->hdr->ringCtrlSize = sizeof(t_vbEAShmRing);
+    new_shm->hdr->ringSize = ringSize;
+    new_shm->hdr->nonce = new_shm->nonce;
+
+    // Magic last, so the peer never sees a half built header
+    VbEAShmStore(&(new_shm->hdr->magic), VB_EA_SHM_MAGIC);
+
+    *shm = new_shm;
+  }
+  else if (new_shm != NULL)
+  {
+    VbEAShmDestroy(&new_shm);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_vbEAError VbEAShmAttach(t_vbEAShm **shm, const CHAR *name, INT32U nonce, INT32U ringSize)
+{
+  t_vbEAError  ret = VB_EA_ERR_NONE;
+  t_vbEAShm   *new_shm = NULL;
+  INT32S       fd = -1;
+  struct stat  shm_stat;
+
+  if ((shm == NULL) || (name == NULL) || (ringSize == 0) || (VbEAShmRingSizeCheck(ringSize) == FALSE))
+  {
+    ret = VB_EA_ERR_BAD_ARGS;
+  }
+  else if ((strnlen(name, VB_EA_SHM_NAME_MAX_SIZE) == VB_EA_SHM_NAME_MAX_SIZE) ||
+           (strncmp(name, VB_EA_SHM_PREFIX, strlen(VB_EA_SHM_PREFIX)) != 0))
+  {
+    // Only segments following own naming scheme are mapped
+    ret = VB_EA_ERR_BAD_ARGS;
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    new_shm = (t_vbEAShm *)calloc(1, sizeof(t_vbEAShm));
+
+    if (new_shm == NULL)
+    {
+      ret = VB_EA_ERR_NO_MEMORY;
+    }
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    strcpy(new_shm->name, name);
+    new_shm->side = VB_EA_SHM_SIDE_SERVER;
+    new_shm->ringSize = ringSize;
+    new_shm->nonce = nonce;
+    new_shm->mapLen = VbEAShmMapLenGet(ringSize);
+
+    fd = shm_open(name, O_RDWR, 0);
+
+    if (fd < 0)
+    {
+      // Usual case when peer runs on a different host
+      ret = VB_EA_ERR_NOT_FOUND;
+    }
+    else if ((fstat(fd, &shm_stat) != 0) || (shm_stat.st_size != (off_t)new_shm->mapLen))
+    {
+      ret = VB_EA_ERR_NOT_FOUND;
+    }
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    new_shm->base = mmap(NULL, new_shm->mapLen, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (new_shm->base == MAP_FAILED)
+    {
+      new_shm->base = NULL;
+      VbLogPrint(VB_LOG_ERROR, "Error mapping EA shared memory %s [%s]", name, strerror(errno));
+      ret = VB_EA_ERR_NO_MEMORY;
+    }
+  }
+
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    VbEAShmLayoutSet(new_shm);
+
+    if ((VbEAShmLoad(&(new_shm->hdr->magic)) != VB_EA_SHM_MAGIC) ||
+        (new_shm->hdr->version != VB_EA_SHM_LAYOUT_VERSION) ||
+        (new_shm->hdr->hdrSize != sizeof(t_vbEAShmHdr)) ||
+        (new_shm->hdr->ringCtrlSize != sizeof(t_vbEAShmRing)) ||
+        (new_shm->hdr->ringSize != ringSize) ||
+        (new_shm->hdr->nonce != nonce) ||
+        (VbEAShmPeerClosed(new_shm) == TRUE))
+    {
+      // Same name but not the segment offered on this connection
+      ret = VB_EA_ERR_NOT_FOUND;
+    }
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    *shm = new_shm;
+  }
+  else if (new_shm != NULL)
+  {
+    if (new_shm->base != NULL)
+    {
+      // Do not flag a segment that might not be ours as closed
+      munmap(new_shm->base, new_shm->mapLen);
+    }
+
+    free(new_shm);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEAShmUnlink(t_vbEAShm *shm)
+{
+  if ((shm != NULL) && (shm->linked == TRUE))
+  {
+    shm_unlink(shm->name);
+    shm->linked = FALSE;
+  }
+}
+
+/*******************************************************************/
+
+void VbEAShmDestroy(t_vbEAShm **shm)
+{
+  t_vbEAShm *this_shm;
+  INT32U     side;
+
+  if ((shm != NULL) && (*shm != NULL))
+  {
+    this_shm = *shm;
+
+    if (this_shm->base != NULL)
+    {
+      VbEAShmStore(&(this_shm->hdr->closed[this_shm->side]), 1);
+
+      // Release any thread parked on the segment, on both sides
+      for (side = 0; side < VB_EA_SHM_SIDE_LAST; side++)
+      {
+        t_vbEAShmRing *ring = (side == this_shm->side)?this_shm->txRing:this_shm->rxRing;
+
+        __sync_add_and_fetch(&(ring->frameDoorbell), 1);
+        __sync_add_and_fetch(&(ring->roomDoorbell), 1);
+        VbEAShmFutexWake(&(ring->frameDoorbell));
+        VbEAShmFutexWake(&(ring->roomDoorbell));
+      }
+
+      munmap(this_shm->base, this_shm->mapLen);
+    }
+
+    VbEAShmUnlink(this_shm);
+
+    if (this_shm->bounce != NULL)
+    {
+      free(this_shm->bounce);
+    }
+
+    free(this_shm);
+    *shm = NULL;
+  }
+}
+
+/*******************************************************************/
+
+t_vbEAError VbEAShmFrameWrite(t_vbEAShm *shm, const INT8U *frame, INT32U len, INT32U timeoutMs)
+{
+  t_vbEAError    ret = VB_EA_ERR_NONE;
+  t_vbEAShmRing *ring;
+  INT32U         head;
+  INT32U         tail;
+  INT64U         deadline;
+
+  if ((shm == NULL) || (shm->base == NULL) || (frame == NULL) || (len == 0) || (len > shm->ringSize))
+  {
+    ret = VB_EA_ERR_BAD_ARGS;
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    ring = shm->txRing;
+    head = ring->head;
+    deadline = VbEAShmNowMs() + timeoutMs;
+
+    while (ret == VB_EA_ERR_NONE)
+    {
+      INT64U now;
+
+      tail = VbEAShmLoad(&(ring->tail));
+
+      if ((shm->ringSize - (head - tail)) >= len)
+      {
+        break;
+      }
+
+      now = VbEAShmNowMs();
+
+      if (VbEAShmPeerClosed(shm) == TRUE)
+      {
+        ret = VB_EA_ERR_SOCKET;
+      }
+      else if (now >= deadline)
+      {
+        ret = VB_EA_ERR_QUEUE;
+      }
+      else
+      {
+        INT32U seq = VbEAShmLoad(&(ring->roomDoorbell));
+
+        // Announce parking before the last check, so consumer can not miss it
+        VbEAShmStore(&(ring->producerParked), 1);
+        tail = VbEAShmLoad(&(ring->tail));
+
+        if ((shm->ringSize - (head - tail)) < len)
+        {
+          VbEAShmFutexWait(&(ring->roomDoorbell), seq, (INT32U)(deadline - now));
+          shm->tx.waits++;
+        }
+
+        VbEAShmStore(&(ring->producerParked), 0);
+      }
+    }
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    INT32U idx = head & (shm->ringSize - 1);
+    INT32U first = MIN(len, shm->ringSize - idx);
+
+    memcpy(shm->txData + idx, frame, first);
+
+    if (first < len)
+    {
+      memcpy(shm->txData, frame + first, len - first);
+    }
+
+    // Publish the whole frame at once
+    VbEAShmStore(&(ring->head), head + len);
+    __sync_add_and_fetch(&(ring->frameDoorbell), 1);
+
+    if (VbEAShmLoad(&(ring->consumerParked)) != 0)
+    {
+      VbEAShmFutexWake(&(ring->frameDoorbell));
+      shm->tx.wakeups++;
+    }
+
+    shm->tx.frames++;
+    shm->tx.bytes += len;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_vbEAError VbEAShmFramePeek(t_vbEAShm *shm, INT8U **frame, INT32U *len, INT32U timeoutMs)
+{
+  t_vbEAError       ret = VB_EA_ERR_NONE;
+  t_vbEAShmRing    *ring;
+  t_vbEAFrameHeader header;
+  INT32U            head = 0;
+  INT32U            tail = 0;
+  INT32U            frame_len = 0;
+  INT64U            deadline;
+
+  if ((shm == NULL) || (shm->base == NULL) || (frame == NULL) || (len == NULL))
+  {
+    ret = VB_EA_ERR_BAD_ARGS;
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    ring = shm->rxRing;
+    tail = ring->tail;
+    deadline = VbEAShmNowMs() + timeoutMs;
+
+    while (ret == VB_EA_ERR_NONE)
+    {
+      INT64U now;
+
+      head = VbEAShmLoad(&(ring->head));
+
+      if (head != tail)
+      {
+        break;
+      }
+
+      now = VbEAShmNowMs();
+
+      if (VbEAShmPeerClosed(shm) == TRUE)
+      {
+        ret = VB_EA_ERR_SOCKET;
+      }
+      else if (now >= deadline)
+      {
+        ret = VB_EA_ERR_NOT_FOUND;
+      }
+      else
+      {
+        INT32U seq = VbEAShmLoad(&(ring->frameDoorbell));
+
+        // Announce parking before the last check, so producer can not miss it
+        VbEAShmStore(&(ring->consumerParked), 1);
+        head = VbEAShmLoad(&(ring->head));
+
+        if (head == tail)
+        {
+          VbEAShmFutexWait(&(ring->frameDoorbell), seq, (INT32U)(deadline - now));
+          shm->rx.waits++;
+        }
+
+        VbEAShmStore(&(ring->consumerParked), 0);
+      }
+    }
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    // Producer publishes whole frames, so anything short of one means a broken ring
+    if ((head - tail) < VB_EA_HEADER_SIZE)
+    {
+      ret = VB_EA_ERR_OTHER;
+    }
+    else
+    {
+      VbEAShmRingCopyOut(shm, tail, (INT8U *)&header, VB_EA_HEADER_SIZE);
+      frame_len = VB_EA_HEADER_SIZE + _ntohs(header.length);
+
+      if ((header.VBCode != VB_EA_CODE_FLAG) || (frame_len > (head - tail)))
+      {
+        ret = VB_EA_ERR_OTHER;
+      }
+    }
+
+    if (ret == VB_EA_ERR_OTHER)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Corrupted frame in EA shared memory %s", shm->name);
+    }
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    INT32U idx = tail & (shm->ringSize - 1);
+
+    if ((idx + frame_len) <= shm->ringSize)
+    {
+      // Handed in place, no copy
+      *frame = shm->rxData + idx;
+    }
+    else
+    {
+      if (shm->bounce == NULL)
+      {
+        shm->bounce = (INT8U *)malloc(VB_EA_SHM_MAX_FRAME_SIZE);
+      }
+
+      if (shm->bounce == NULL)
+      {
+        ret = VB_EA_ERR_NO_MEMORY;
+      }
+      else
+      {
+        VbEAShmRingCopyOut(shm, tail, shm->bounce, frame_len);
+        *frame = shm->bounce;
+        shm->rx.bounces++;
+      }
+    }
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    *len = frame_len;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEAShmFrameRelease(t_vbEAShm *shm, INT32U len)
+{
+  t_vbEAShmRing *ring;
+
+  if ((shm != NULL) && (shm->base != NULL))
+  {
+    ring = shm->rxRing;
+
+    VbEAShmStore(&(ring->tail), ring->tail + len);
+    __sync_add_and_fetch(&(ring->roomDoorbell), 1);
+
+    if (VbEAShmLoad(&(ring->producerParked)) != 0)
+    {
+      VbEAShmFutexWake(&(ring->roomDoorbell));
+      shm->rx.wakeups++;
+    }
+
+    shm->rx.frames++;
+    shm->rx.bytes += len;
+  }
+}
+
+/*******************************************************************/
+
+void VbEAShmRxWake(t_vbEAShm *shm)
+{
+  if ((shm != NULL) && (shm->base != NULL))
+  {
+    __sync_add_and_fetch(&(shm->rxRing->frameDoorbell), 1);
+    VbEAShmFutexWake(&(shm->rxRing->frameDoorbell));
+  }
+}
+
+/*******************************************************************/
+
+void VbEAShmDump(t_vbEAShm *shm, t_writeFun writeFun)
+{
+  if ((shm != NULL) && (shm->base != NULL) && (writeFun != NULL))
+  {
+    INT32U tx_used = shm->txRing->head - shm->txRing->tail;
+    INT32U rx_used = shm->rxRing->head - shm->rxRing->tail;
+
+    writeFun("Transport: shared memory %s (%s side, %u bytes per ring)\n",
+        shm->name, (shm->side == VB_EA_SHM_SIDE_CLIENT)?"client":"server", shm->ringSize);
+    writeFun("==================================================================================================\n");
+    writeFun("| Dir | Active | %10s | %14s | %10s | %10s | %10s | %10s |\n", "Frames", "Bytes", "Waits", "Wakeups", "Bounces", "Used");
+    writeFun("==================================================================================================\n");
+    writeFun("| TX  | %6s | %10llu | %14llu | %10llu | %10llu | %10s | %10u |\n", (shm->txActive == TRUE)?"YES":"NO",
+        (unsigned long long)shm->tx.frames, (unsigned long long)shm->tx.bytes, (unsigned long long)shm->tx.waits,
+        (unsigned long long)shm->tx.wakeups, "-", tx_used);
+    writeFun("| RX  | %6s | %10llu | %14llu | %10llu | %10llu | %10llu | %10u |\n", (shm->rxActive == TRUE)?"YES":"NO",
+        (unsigned long long)shm->rx.frames, (unsigned long long)shm->rx.bytes, (unsigned long long)shm->rx.waits,
+        (unsigned long long)shm->rx.wakeups, (unsigned long long)shm->rx.bounces, rx_used);
+    writeFun("==================================================================================================\n");
+  }
+}
+
+/**
+ * @}
+ **/
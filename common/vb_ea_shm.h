@@ -0,0 +1,213 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_ea_shm.h
+ * @brief Shared memory transport for EA connections between co-located processes
+ *
+ * @internal
+ *
+ * Segment created by the connecting side (EA client) and mapped by the accepting side.
+ * It holds two single producer / single consumer byte rings, one per direction, carrying
+ * EA frames with their usual framing. Each ring has two futex words used as doorbells:
+ * producer rings the consumer only when the consumer is parked waiting for frames, and
+ * vice versa when the producer waits for room.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_EA_SHM_H_
+#define VB_EA_SHM_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "types.h"
+#include "vb_console.h"
+#include "vb_ea_communication.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_EA_SHM_RING_MIN_SIZE                (128 * 1024)        // Shall hold the largest EA frame
+#define VB_EA_SHM_RING_MAX_SIZE                (64 * 1024 * 1024)
+#define VB_EA_SHM_RING_DEFAULT_SIZE            (1024 * 1024)
+#define VB_EA_SHM_WAIT_MS                      (100)               // Max time parked before checking connection state
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+/// Side of the connection a process plays on the segment
+typedef enum
+{
+  VB_EA_SHM_SIDE_CLIENT = 0,    ///< Creates the segment. Sends on ring 0, receives on ring 1
+  VB_EA_SHM_SIDE_SERVER,        ///< Maps the segment. Sends on ring 1, receives on ring 0
+  VB_EA_SHM_SIDE_LAST,
+} t_vbEAShmSide;
+
+typedef struct s_vbEAShmHdr     t_vbEAShmHdr;
+typedef struct s_vbEAShmRing    t_vbEAShmRing;
+
+typedef struct
+{
+  INT64U          frames;
+  INT64U          bytes;
+  INT64U          waits;        ///< Times the side had to park (ring full on tx, empty on rx)
+  INT64U          wakeups;      ///< Doorbells rung to the peer
+  INT64U          bounces;      ///< Rx only: frames wrapping the ring end copied out
+} t_vbEAShmStats;
+
+/// Shared memory transport descriptor (process local)
+struct s_vbEAShm
+{
+  CHAR            name[VB_EA_SHM_NAME_MAX_SIZE];   ///< Segment name (while linked)
+  BOOLEAN         linked;                          ///< TRUE: name still present in /dev/shm
+  t_vbEAShmSide   side;
+  INT32U          ringSize;                        ///< Data bytes of each ring (power of 2)
+  INT32U          nonce;                           ///< Value exchanged on negotiation to check segment identity
+  void           *base;
+  INT32U          mapLen;
+  t_vbEAShmHdr   *hdr;
+  t_vbEAShmRing  *txRing;
+  t_vbEAShmRing  *rxRing;
+  INT8U          *txData;
+  INT8U          *rxData;
+  INT8U          *bounce;                          ///< Private copy of frames wrapping the ring end
+  BOOLEAN         txActive;                        ///< TRUE: frames are sent through the segment
+  BOOLEAN         rxActive;                        ///< TRUE: frames are received from the segment
+  t_vbEAShmStats  tx;
+  t_vbEAShmStats  rx;
+};
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Checks a ring size is usable: 0 (transport disabled) or a power of 2 in range
+ * @param[in] ringSize Ring size in bytes
+ * @return TRUE: valid; FALSE: otherwise
+ **/
+BOOLEAN VbEAShmRingSizeCheck(INT32U ringSize);
+
+/**
+ * @brief Creates and maps a new segment (client side)
+ * @param[out] shm New descriptor
+ * @param[in] ringSize Size of each ring in bytes
+ * @return @ref t_vbEAError
+ **/
+t_vbEAError VbEAShmCreate(t_vbEAShm **shm, INT32U ringSize);
+
+/**
+ * @brief Maps a segment created by the peer (server side)
+ * @param[out] shm New descriptor
+ * @param[in] name Segment name
+ * @param[in] nonce Value the segment shall carry
+ * @param[in] ringSize Size of each ring the segment shall have
+ * @return @ref t_vbEAError
+ **/
+t_vbEAError VbEAShmAttach(t_vbEAShm **shm, const CHAR *name, INT32U nonce, INT32U ringSize);
+
+/**
+ * @brief Removes segment name. Mapping is kept until destroyed.
+ * @param[in] shm Descriptor
+ **/
+void VbEAShmUnlink(t_vbEAShm *shm);
+
+/**
+ * @brief Flags own side as closed, wakes up the peer and releases the mapping
+ * @param[in,out] shm Descriptor, set to NULL
+ **/
+void VbEAShmDestroy(t_vbEAShm **shm);
+
+/**
+ * @brief Copies a whole EA frame into the tx ring
+ * @param[in] shm Descriptor
+ * @param[in] frame EA frame (header + payload)
+ * @param[in] len Frame length
+ * @param[in] timeoutMs Max time waiting for room
+ * @return VB_EA_ERR_NONE: sent; VB_EA_ERR_QUEUE: ring full after timeout; VB_EA_ERR_SOCKET: peer closed
+ **/
+t_vbEAError VbEAShmFrameWrite(t_vbEAShm *shm, const INT8U *frame, INT32U len, INT32U timeoutMs);
+
+/**
+ * @brief Gets next EA frame from the rx ring. Frame stays valid until @ref VbEAShmFrameRelease.
+ * @param[in] shm Descriptor
+ * @param[out] frame EA frame (header + payload), in place when contiguous in the ring
+ * @param[out] len Frame length
+ * @param[in] timeoutMs Max time waiting for a frame
+ * @return VB_EA_ERR_NONE: frame available; VB_EA_ERR_NOT_FOUND: no frame after timeout;
+ *         VB_EA_ERR_SOCKET: peer closed; VB_EA_ERR_OTHER: corrupted ring
+ **/
+t_vbEAError VbEAShmFramePeek(t_vbEAShm *shm, INT8U **frame, INT32U *len, INT32U timeoutMs);
+
+/**
+ * @brief Releases the frame got by @ref VbEAShmFramePeek, making room for the peer
+ * @param[in] shm Descriptor
+ * @param[in] len Frame length
+ **/
+void VbEAShmFrameRelease(t_vbEAShm *shm, INT32U len);
+
+/**
+ * @brief Wakes up own thread parked in @ref VbEAShmFramePeek
+ * @param[in] shm Descriptor
+ **/
+void VbEAShmRxWake(t_vbEAShm *shm);
+
+/**
+ * @brief Dumps transport state and counters
+ * @param[in] shm Descriptor
+ * @param[in] writeFun Console write function
+ **/
+void VbEAShmDump(t_vbEAShm *shm, t_writeFun writeFun);
+
+#endif /* VB_EA_SHM_H_ */
+
+/**
+ * @}
+ **/
@@ -0,0 +1,1247 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_file_writer.c
+ * @brief Asynchronous buffered file writer implementation
+ *
+ * @internal
+ *
+ * Producers only touch memory: data is appended to the buffer of the target
+ * file under a mutex. The flush thread detaches those buffers and performs all
+ * disk I/O without holding the mutex. Truncating a file discards the data still
+ * pending for it, so "w+" followed by "a+" writes keep their original meaning.
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_thread.h"
+#include "vb_priorities.h"
+#include "vb_io_uring.h"
+#include "vb_file_writer.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_FILE_WRITER_THREAD_NAME         ("FileWriter")
+#define VB_FILE_WRITER_MAX_PATH_LEN        (256)
+#define VB_FILE_WRITER_MIN_BUFFER_SIZE     (1024)
+#define VB_FILE_WRITER_BATCH               (32)     // Files written per ring submission
+#define VB_FILE_WRITER_URING_ENTRIES       (2 * VB_FILE_WRITER_BATCH)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  CHAR    *name;              ///< File name relative to root folder. NULL: free slot
+  INT32S   fd;                ///< Cached descriptor. -1: not open
+  CHAR    *buf;               ///< Pending data
+  INT32U   len;
+  INT32U   cap;
+  BOOLEAN  truncatePending;
+  BOOLEAN  flushing;          ///< Flush thread is writing this file (entry can not be reclaimed)
+  INT64U   lastUse;           ///< LRU stamp
+} t_fileWriterEntry;
+
+/// Data of an entry being written by the flush thread, mutex released
+typedef struct
+{
+  t_fileWriterEntry *entry;
+  CHAR              *data;
+  INT32U             len;
+  INT32U             written;
+  INT32S             fd;
+  INT32S             err;             ///< errno of first failure
+  BOOLEAN            truncate;
+  BOOLEAN            synced;
+  BOOLEAN            ioError;
+} t_fileWriterJob;
+
+typedef struct
+{
+  INT64U writes;
+  INT64U bytesQueued;
+  INT64U drops;               ///< Writes rejected due to backpressure or lack of slots
+  INT64U bytesDropped;
+  INT64U flushes;
+  INT64U bytesWritten;
+  INT64U opens;
+  INT64U closes;
+  INT64U fsyncs;
+  INT64U ioErrors;
+  INT32U peakBuffered;
+  INT32U lastFlushUs;
+  INT32U maxFlushUs;
+} t_fileWriterStats;
+
+/// Copy of file writer state, printed once the mutex is released
+typedef struct
+{
+  t_vbFileWriterConf conf;
+  t_fileWriterStats  stats;
+  INT32U             numOpen;
+  INT32U             buffered;
+  BOOLEAN            ringReady;
+  INT64U             ringEnters;
+} t_fileWriterStatsSnapshot;
+
+typedef struct
+{
+  INT32U             idx;
+  INT32S             fd;
+  INT32U             len;
+  BOOLEAN            truncatePending;
+  CHAR               name[VB_FILE_WRITER_MAX_PATH_LEN];
+} t_fileWriterFileSnapshot;
+
+typedef struct
+{
+  CHAR               root[VB_FILE_WRITER_MAX_PATH_LEN];
+  t_vbFileWriterConf conf;
+  t_fileWriterEntry *entries;
+  t_fileWriterEntry *lastEntry;          ///< Last used entry, checked first on lookups
+  INT32U             numOpen;
+  INT32U             buffered;
+  INT64U             useStamp;
+  BOOLEAN            initialized;
+  BOOLEAN            running;
+  BOOLEAN            wakeUp;
+  pthread_t          thread;
+  t_vbIoUring        ring;               ///< Owned by flush thread
+  BOOLEAN            ringReady;
+  t_fileWriterStats  stats;
+} t_fileWriter;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static t_fileWriter    vbFileWriter;
+static pthread_mutex_t vbFileWriterMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  vbFileWriterCond = PTHREAD_COND_INITIALIZER;
+
+static const CHAR *vbFileWriterFsyncStr[VB_FILE_WRITER_FSYNC_LAST] =
+{
+  "NONE",
+  "ON_CLOSE",
+  "ON_FLUSH",
+};
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+static INT64U FileWriterTimeUsGet(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((INT64U)ts.tv_sec * 1000000ULL) + ((INT64U)ts.tv_nsec / 1000);
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Closes cached descriptor of given entry. Called with mutex locked.
+ **/
+static void FileWriterEntryClose(t_fileWriterEntry *entry)
+{
+  if (entry->fd >= 0)
+  {
+    if (vbFileWriter.conf.fsyncPolicy == VB_FILE_WRITER_FSYNC_ON_CLOSE)
+    {
+      fsync(entry->fd);
+      vbFileWriter.stats.fsyncs++;
+    }
+
+    close(entry->fd);
+    entry->fd = -1;
+    vbFileWriter.numOpen--;
+    vbFileWriter.stats.closes++;
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Releases an entry. Called with mutex locked.
+ **/
+static void FileWriterEntryRelease(t_fileWriterEntry *entry)
+{
+  FileWriterEntryClose(entry);
+
+  vbFileWriter.buffered -= entry->len;
+
+  free(entry->name);
+  free(entry->buf);
+  bzero(entry, sizeof(*entry));
+  entry->fd = -1;
+
+  if (vbFileWriter.lastEntry == entry)
+  {
+    vbFileWriter.lastEntry = NULL;
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Opens the file of given entry, evicting the least recently used
+ * descriptor if cache is full. Called with mutex locked.
+ **/
+static void FileWriterEntryOpen(t_fileWriterEntry *entry)
+{
+  t_fileWriterEntry *lru = NULL;
+  CHAR               path[VB_FILE_WRITER_MAX_PATH_LEN];
+  CHAR               dir[VB_FILE_WRITER_MAX_PATH_LEN];
+  INT32S             len;
+  INT32U             i;
+
+  if (vbFileWriter.numOpen >= vbFileWriter.conf.maxOpenFiles)
+  {
+    for (i = 0; i < vbFileWriter.conf.maxFiles; i++)
+    {
+      t_fileWriterEntry *candidate = &vbFileWriter.entries[i];
+
+      if ((candidate->fd >= 0) && (candidate->flushing == FALSE) &&
+          ((lru == NULL) || (candidate->lastUse < lru->lastUse)))
+      {
+        lru = candidate;
+      }
+    }
+
+    if (lru != NULL)
+    {
+      FileWriterEntryClose(lru);
+    }
+  }
+
+  len = snprintf(path, sizeof(path), "%s/%s", vbFileWriter.root, entry->name);
+
+  if ((len < 0) || (len >= (INT32S)sizeof(path)))
+  {
+    // Never write to a truncated path
+    vbFileWriter.stats.ioErrors++;
+    VbLogPrint(VB_LOG_ERROR, "Could not open file %s/%s (path too long)", vbFileWriter.root, entry->name);
+  }
+  else
+  {
+    // Create parent folders
+    memcpy(dir, path, len + 1);
+    VbUtilCreateFolderAndParents(dirname(dir));
+
+    entry->fd = open(path, O_WRONLY | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+    if (entry->fd >= 0)
+    {
+      vbFileWriter.numOpen++;
+      vbFileWriter.stats.opens++;
+    }
+    else
+    {
+      vbFileWriter.stats.ioErrors++;
+      VbLogPrint(VB_LOG_ERROR, "Could not open file %s (%s)", path, strerror(errno));
+    }
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Gets the entry of given file, allocating a new one if needed.
+ * Called with mutex locked.
+ **/
+static t_fileWriterEntry *FileWriterEntryGet(const CHAR *fileName)
+{
+  t_fileWriterEntry *entry = NULL;
+  t_fileWriterEntry *free_entry = NULL;
+  t_fileWriterEntry *lru = NULL;
+  INT32U             i;
+
+  if ((vbFileWriter.lastEntry != NULL) && (strcmp(vbFileWriter.lastEntry->name, fileName) == 0))
+  {
+    entry = vbFileWriter.lastEntry;
+  }
+
+  for (i = 0; (entry == NULL) && (i < vbFileWriter.conf.maxFiles); i++)
+  {
+    t_fileWriterEntry *candidate = &vbFileWriter.entries[i];
+
+    if (candidate->name == NULL)
+    {
+      if (free_entry == NULL)
+      {
+        free_entry = candidate;
+      }
+    }
+    else if (strcmp(candidate->name, fileName) == 0)
+    {
+      entry = candidate;
+    }
+    else if ((candidate->len == 0) && (candidate->truncatePending == FALSE) && (candidate->flushing == FALSE) &&
+             ((lru == NULL) || (candidate->lastUse < lru->lastUse)))
+    {
+      lru = candidate;
+    }
+  }
+
+  if (entry == NULL)
+  {
+    if ((free_entry == NULL) && (lru != NULL))
+    {
+      // Reclaim least recently used idle entry
+      FileWriterEntryRelease(lru);
+      free_entry = lru;
+    }
+
+    if (free_entry != NULL)
+    {
+      free_entry->name = strdup(fileName);
+
+      if (free_entry->name != NULL)
+      {
+        entry = free_entry;
+      }
+    }
+  }
+
+  if (entry != NULL)
+  {
+    entry->lastUse = ++vbFileWriter.useStamp;
+    vbFileWriter.lastEntry = entry;
+  }
+
+  return entry;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Makes room for len more bytes in entry buffer, once the first
+ * discarded pending bytes are dropped. Called with mutex locked.
+ **/
+static t_vbFileWriterError FileWriterEntryReserve(t_fileWriterEntry *entry, INT32U len, INT32U discarded)
+{
+  t_vbFileWriterError ret = VB_FILE_WRITER_ERROR_NONE;
+
+  if ((vbFileWriter.buffered - discarded + len) > vbFileWriter.conf.maxBufferedBytes)
+  {
+    ret = VB_FILE_WRITER_ERROR_BACKPRESSURE;
+  }
+  else if ((entry->len - discarded + len) > entry->cap)
+  {
+    INT32U new_cap = MAX(entry->cap * 2, VB_FILE_WRITER_MIN_BUFFER_SIZE);
+    CHAR  *new_buf;
+
+    new_cap = MAX(new_cap, entry->len - discarded + len);
+    new_buf = realloc(entry->buf, new_cap);
+
+    if (new_buf == NULL)
+    {
+      ret = VB_FILE_WRITER_ERROR_NO_MEMORY;
+    }
+    else
+    {
+      entry->buf = new_buf;
+      entry->cap = new_cap;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Common part of all write requests. Called with mutex locked.
+ * On success, returns the entry where len bytes can be appended.
+ **/
+static t_vbFileWriterError FileWriterWritePrepare(const CHAR *fileName, BOOLEAN truncate, INT32U len, t_fileWriterEntry **entry)
+{
+  t_vbFileWriterError ret = VB_FILE_WRITER_ERROR_NONE;
+
+  if (vbFileWriter.initialized == FALSE)
+  {
+    ret = VB_FILE_WRITER_ERROR_NOT_RUNNING;
+  }
+
+  if (ret == VB_FILE_WRITER_ERROR_NONE)
+  {
+    *entry = FileWriterEntryGet(fileName);
+
+    if (*entry == NULL)
+    {
+      ret = VB_FILE_WRITER_ERROR_NO_SLOT;
+    }
+  }
+
+  if (ret == VB_FILE_WRITER_ERROR_NONE)
+  {
+    // Pending data would be truncated anyway
+    ret = FileWriterEntryReserve(*entry, len, (truncate == TRUE)?(*entry)->len:0);
+  }
+
+  if ((ret == VB_FILE_WRITER_ERROR_NONE) && (truncate == TRUE))
+  {
+    // Only an accepted write truncates the file, a rejected one keeps its previous content
+    vbFileWriter.buffered -= (*entry)->len;
+    (*entry)->len = 0;
+    (*entry)->truncatePending = TRUE;
+  }
+
+  vbFileWriter.stats.writes++;
+
+  if (ret != VB_FILE_WRITER_ERROR_NONE)
+  {
+    vbFileWriter.stats.drops++;
+    vbFileWriter.stats.bytesDropped += len;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Accounts appended data and wakes up flush thread if buffers are
+ * getting full. Called with mutex locked.
+ **/
+static void FileWriterWriteCommit(t_fileWriterEntry *entry, INT32U len)
+{
+  entry->len += len;
+  vbFileWriter.buffered += len;
+  vbFileWriter.stats.bytesQueued += len;
+  vbFileWriter.stats.peakBuffered = MAX(vbFileWriter.stats.peakBuffered, vbFileWriter.buffered);
+
+  if (vbFileWriter.buffered > (vbFileWriter.conf.maxBufferedBytes / 2))
+  {
+    vbFileWriter.wakeUp = TRUE;
+    pthread_cond_signal(&vbFileWriterCond);
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Detaches pending data of up to VB_FILE_WRITER_BATCH entries, starting
+ * at given index. Called with mutex locked.
+ * @return Number of jobs
+ **/
+static INT32U FileWriterJobsGet(t_fileWriterJob *jobs, INT32U *next)
+{
+  INT32U num_jobs = 0;
+
+  for (; (*next < vbFileWriter.conf.maxFiles) && (num_jobs < VB_FILE_WRITER_BATCH); (*next)++)
+  {
+    t_fileWriterEntry *entry = &vbFileWriter.entries[*next];
+    t_fileWriterJob   *job = &jobs[num_jobs];
+
+    if ((entry->name == NULL) || ((entry->len == 0) && (entry->truncatePending == FALSE)))
+    {
+      continue;
+    }
+
+    // Detach pending data, producers keep writing to a new buffer
+    bzero(job, sizeof(*job));
+    job->entry = entry;
+    job->data = entry->buf;
+    job->len = entry->len;
+    job->truncate = entry->truncatePending;
+    entry->buf = NULL;
+    entry->len = 0;
+    entry->cap = 0;
+    entry->truncatePending = FALSE;
+    entry->flushing = TRUE;
+    vbFileWriter.buffered -= job->len;
+
+    if (entry->fd < 0)
+    {
+      FileWriterEntryOpen(entry);
+    }
+
+    job->fd = entry->fd;
+    num_jobs++;
+  }
+
+  return num_jobs;
+}
+
+/*******************************************************************/
+
+static void FileWriterJobError(t_fileWriterJob *job, INT32S err)
+{
+  if (job->ioError == FALSE)
+  {
+    job->ioError = TRUE;
+    job->err = err;
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Writes (the rest of) job data with blocking calls. Mutex is not locked.
+ **/
+static void FileWriterJobWrite(t_fileWriterJob *job)
+{
+  if (job->fd < 0)
+  {
+    FileWriterJobError(job, EBADF);
+  }
+  else
+  {
+    if ((job->truncate == TRUE) && (ftruncate(job->fd, 0) != 0))
+    {
+      FileWriterJobError(job, errno);
+    }
+
+    job->truncate = FALSE;
+
+    while ((job->ioError == FALSE) && (job->written < job->len))
+    {
+      ssize_t res = write(job->fd, job->data + job->written, job->len - job->written);
+
+      if (res > 0)
+      {
+        job->written += res;
+      }
+      else if ((res < 0) && (errno == EINTR))
+      {
+        continue;
+      }
+      else
+      {
+        FileWriterJobError(job, (res < 0)?errno:EIO);
+      }
+    }
+
+    if ((job->ioError == FALSE) && (job->synced == FALSE) && (vbFileWriter.conf.fsyncPolicy == VB_FILE_WRITER_FSYNC_ON_FLUSH))
+    {
+      fsync(job->fd);
+      job->synced = TRUE;
+    }
+  }
+}
+
+/*******************************************************************/
+
+#if (_IO_URING_ == 1)
+/**
+ * @brief Writes a batch of jobs with a single ring submission: one write per
+ * file, linked to its fsync when fsync policy is ON_FLUSH. Short writes are
+ * completed with blocking calls. Mutex is not locked.
+ **/
+static void FileWriterJobsRingWrite(t_fileWriterJob *jobs, INT32U numJobs)
+{
+  BOOLEAN              fsync_needed = (vbFileWriter.conf.fsyncPolicy == VB_FILE_WRITER_FSYNC_ON_FLUSH)?TRUE:FALSE;
+  struct io_uring_sqe *sqe;
+  struct io_uring_cqe *cqe;
+  INT32U               expected = 0;
+  INT32U               i;
+
+  for (i = 0; i < numJobs; i++)
+  {
+    t_fileWriterJob *job = &jobs[i];
+
+    if (job->fd < 0)
+    {
+      FileWriterJobError(job, EBADF);
+      continue;
+    }
+
+    // No truncate operation on every supported kernel, done before queuing the write
+    if ((job->truncate == TRUE) && (ftruncate(job->fd, 0) != 0))
+    {
+      FileWriterJobError(job, errno);
+      continue;
+    }
+
+    job->truncate = FALSE;
+
+    if (job->len > 0)
+    {
+      sqe = VbIoUringSqeGet(&vbFileWriter.ring);
+      VbIoUringPrepWrite(sqe, job->fd, job->data, job->len, (INT64U)i << 1);
+
+      if (fsync_needed == TRUE)
+      {
+        // fsync only runs if the write completed in full
+        sqe->flags |= IOSQE_IO_LINK;
+      }
+
+      expected++;
+    }
+
+    if (fsync_needed == TRUE)
+    {
+      sqe = VbIoUringSqeGet(&vbFileWriter.ring);
+      VbIoUringPrepFsync(sqe, job->fd, ((INT64U)i << 1) | 1);
+      expected++;
+    }
+  }
+
+  if (expected > 0)
+  {
+    if (VbIoUringSubmit(&vbFileWriter.ring, expected) != VB_IO_URING_ERROR_NONE)
+    {
+      // Completions can not be trusted, write with blocking calls from now on
+      VbLogPrint(VB_LOG_ERROR, "Error submitting file writes to io_uring [%s]; using blocking writes", strerror(errno));
+      VbIoUringDestroy(&vbFileWriter.ring);
+      vbFileWriter.ringReady = FALSE;
+
+      for (i = 0; i < numJobs; i++)
+      {
+        FileWriterJobError(&jobs[i], EIO);
+      }
+    }
+    else
+    {
+      while ((expected > 0) && ((cqe = VbIoUringCqePeek(&vbFileWriter.ring)) != NULL))
+      {
+        t_fileWriterJob *job = &jobs[cqe->user_data >> 1];
+
+        if ((cqe->user_data & 1) == 0)
+        {
+          if (cqe->res >= 0)
+          {
+            job->written += cqe->res;
+          }
+          else
+          {
+            FileWriterJobError(job, -cqe->res);
+          }
+        }
+        else if (cqe->res == 0)
+        {
+          job->synced = TRUE;
+        }
+        else if (cqe->res != -ECANCELED)
+        {
+          // Cancelled fsyncs (short write) are retried below
+          FileWriterJobError(job, -cqe->res);
+        }
+
+        VbIoUringCqeSeen(&vbFileWriter.ring);
+        expected--;
+      }
+    }
+  }
+
+  for (i = 0; i < numJobs; i++)
+  {
+    t_fileWriterJob *job = &jobs[i];
+
+    if ((job->ioError == FALSE) && ((job->written < job->len) || ((fsync_needed == TRUE) && (job->synced == FALSE))))
+    {
+      FileWriterJobWrite(job);
+    }
+  }
+}
+
+#endif
+
+/*******************************************************************/
+
+/**
+ * @brief Writes all pending data to disk. Called with mutex locked; the
+ * mutex is released while doing I/O.
+ **/
+static void FileWriterFlushAll(void)
+{
+  t_fileWriterJob jobs[VB_FILE_WRITER_BATCH];
+  INT64U          start_us = FileWriterTimeUsGet();
+  INT32U          elapsed_us;
+  INT32U          num_jobs;
+  INT32U          next = 0;
+  INT32U          i;
+
+  while ((num_jobs = FileWriterJobsGet(jobs, &next)) > 0)
+  {
+    pthread_mutex_unlock(&vbFileWriterMutex);
+
+#if (_IO_URING_ == 1)
+    if (vbFileWriter.ringReady == TRUE)
+    {
+      FileWriterJobsRingWrite(jobs, num_jobs);
+    }
+    else
+#endif
+    {
+      for (i = 0; i < num_jobs; i++)
+      {
+        FileWriterJobWrite(&jobs[i]);
+      }
+    }
+
+    for (i = 0; i < num_jobs; i++)
+    {
+      free(jobs[i].data);
+    }
+
+    pthread_mutex_lock(&vbFileWriterMutex);
+
+    for (i = 0; i < num_jobs; i++)
+    {
+      t_fileWriterJob   *job = &jobs[i];
+      t_fileWriterEntry *entry = job->entry;
+
+      entry->flushing = FALSE;
+      vbFileWriter.stats.flushes++;
+      vbFileWriter.stats.bytesWritten += job->written;
+
+      if (job->synced == TRUE)
+      {
+        vbFileWriter.stats.fsyncs++;
+      }
+
+      if (job->ioError == TRUE)
+      {
+        vbFileWriter.stats.ioErrors++;
+
+        if (job->fd >= 0)
+        {
+          VbLogPrint(VB_LOG_ERROR, "Error writing file %s (%s)", entry->name, strerror(job->err));
+
+          // Reopen on next flush
+          FileWriterEntryClose(entry);
+        }
+      }
+    }
+  }
+
+  elapsed_us = (INT32U)(FileWriterTimeUsGet() - start_us);
+  vbFileWriter.stats.lastFlushUs = elapsed_us;
+  vbFileWriter.stats.maxFlushUs = MAX(vbFileWriter.stats.maxFlushUs, elapsed_us);
+}
+
+/*******************************************************************/
+
+static void *FileWriterThread(void *arg)
+{
+  struct timespec ts;
+  t_vbIoUring     ring;
+  BOOLEAN         ring_ready = FALSE;
+
+  bzero(&ring, sizeof(ring));
+
+#if (_IO_URING_ == 1)
+  // Ring is created and used only by this thread
+  if ((vbFileWriter.conf.ioUring == TRUE) &&
+      (VbIoUringInit(&ring, VB_FILE_WRITER_URING_ENTRIES) == VB_IO_URING_ERROR_NONE))
+  {
+    if ((VbIoUringOpSupported(&ring, IORING_OP_WRITE) == TRUE) && (VbIoUringOpSupported(&ring, IORING_OP_FSYNC) == TRUE))
+    {
+      ring_ready = TRUE;
+    }
+    else
+    {
+      VbIoUringDestroy(&ring);
+    }
+  }
+#endif
+
+  pthread_mutex_lock(&vbFileWriterMutex);
+
+  vbFileWriter.ring = ring;
+  vbFileWriter.ringReady = ring_ready;
+
+  while (vbFileWriter.running == TRUE)
+  {
+    if (vbFileWriter.wakeUp == FALSE)
+    {
+      clock_gettime(CLOCK_REALTIME, &ts);
+      VbUtilTimespecMsecAdd(&ts, vbFileWriter.conf.flushPeriodMs, &ts);
+      pthread_cond_timedwait(&vbFileWriterCond, &vbFileWriterMutex, &ts);
+    }
+
+    vbFileWriter.wakeUp = FALSE;
+
+    FileWriterFlushAll();
+  }
+
+  if (vbFileWriter.ringReady == TRUE)
+  {
+    // Remaining data is written by VbFileWriterStop with blocking calls
+    VbIoUringDestroy(&vbFileWriter.ring);
+    vbFileWriter.ringReady = FALSE;
+  }
+
+  pthread_mutex_unlock(&vbFileWriterMutex);
+
+  return NULL;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Copies tracked files info. Called with mutex locked.
+ * @return Number of files copied
+ **/
+static INT32U FileWriterFilesSnapshot(t_fileWriterFileSnapshot *files)
+{
+  INT32U i;
+  INT32U num_files = 0;
+
+  for (i = 0; i < vbFileWriter.conf.maxFiles; i++)
+  {
+    t_fileWriterEntry *entry = &vbFileWriter.entries[i];
+
+    if (entry->name != NULL)
+    {
+      files[num_files].idx = i;
+      files[num_files].fd = entry->fd;
+      files[num_files].len = entry->len;
+      files[num_files].truncatePending = entry->truncatePending;
+      snprintf(files[num_files].name, sizeof(files[num_files].name), "%s", entry->name);
+      num_files++;
+    }
+  }
+
+  return num_files;
+}
+
+/*******************************************************************/
+
+static void FileWriterFilesDump(t_writeFun writeFun, const t_fileWriterFileSnapshot *files, INT32U numFiles)
+{
+  INT32U i;
+
+  writeFun("|  Idx |  Fd | Pending (bytes) | File\n");
+
+  for (i = 0; i < numFiles; i++)
+  {
+    writeFun("| %4u | %3d | %15u | %s%s\n", files[i].idx, files[i].fd, files[i].len, files[i].name,
+        (files[i].truncatePending == TRUE)? " (truncate)":"");
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Copies file writer state. Called with mutex locked.
+ **/
+static void FileWriterStatsSnapshot(t_fileWriterStatsSnapshot *snapshot)
+{
+  snapshot->conf = vbFileWriter.conf;
+  snapshot->stats = vbFileWriter.stats;
+  snapshot->numOpen = vbFileWriter.numOpen;
+  snapshot->buffered = vbFileWriter.buffered;
+  snapshot->ringReady = vbFileWriter.ringReady;
+  snapshot->ringEnters = vbFileWriter.ring.stats.enters;
+}
+
+/*******************************************************************/
+
+static void FileWriterStatsDump(t_writeFun writeFun, const t_fileWriterStatsSnapshot *snapshot)
+{
+  writeFun("===================================================\n");
+  writeFun("| %-28s | %16s |\n",  "Fsync policy",        vbFileWriterFsyncStr[snapshot->conf.fsyncPolicy]);
+  writeFun("| %-28s | %16s |\n",  "I/O backend",         (snapshot->ringReady == TRUE)?"io_uring":"blocking");
+  writeFun("| %-28s | %16u |\n",  "Flush period (ms)",   snapshot->conf.flushPeriodMs);
+  writeFun("| %-28s | %7u / %6u |\n", "Open files",      snapshot->numOpen, snapshot->conf.maxOpenFiles);
+  writeFun("| %-28s | %7u / %6u |\n", "Buffered (KB)",   snapshot->buffered / 1024, snapshot->conf.maxBufferedBytes / 1024);
+  writeFun("| %-28s | %16u |\n",  "Peak buffered (KB)",  snapshot->stats.peakBuffered / 1024);
+  writeFun("| %-28s | %16llu |\n", "Writes",             snapshot->stats.writes);
+  writeFun("| %-28s | %16llu |\n", "Bytes queued",       snapshot->stats.bytesQueued);
+  writeFun("| %-28s | %16llu |\n", "Dropped writes",     snapshot->stats.drops);
+  writeFun("| %-28s | %16llu |\n", "Dropped bytes",      snapshot->stats.bytesDropped);
+  writeFun("| %-28s | %16llu |\n", "Flushes",            snapshot->stats.flushes);
+  writeFun("| %-28s | %16llu |\n", "Bytes written",      snapshot->stats.bytesWritten);
+  writeFun("| %-28s | %16llu |\n", "Opens",              snapshot->stats.opens);
+  writeFun("| %-28s | %16llu |\n", "Closes",             snapshot->stats.closes);
+  writeFun("| %-28s | %16llu |\n", "Fsyncs",             snapshot->stats.fsyncs);
+  writeFun("| %-28s | %16llu |\n", "I/O errors",         snapshot->stats.ioErrors);
+  writeFun("| %-28s | %16llu |\n", "Ring enters",        snapshot->ringEnters);
+  writeFun("| %-28s | %16u |\n",  "Last flush (us)",     snapshot->stats.lastFlushUs);
+  writeFun("| %-28s | %16u |\n",  "Max flush (us)",      snapshot->stats.maxFlushUs);
+  writeFun("===================================================\n");
+}
+
+/*******************************************************************/
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+t_vbFileWriterError VbFileWriterInit(const CHAR *rootFolder, const t_vbFileWriterConf *conf)
+{
+  t_vbFileWriterError ret = VB_FILE_WRITER_ERROR_NONE;
+  INT32U              i;
+
+  if (rootFolder == NULL)
+  {
+    return VB_FILE_WRITER_ERROR_BAD_ARGS;
+  }
+
+  VbFileWriterStop();
+
+  pthread_mutex_lock(&vbFileWriterMutex);
+
+  bzero(&vbFileWriter, sizeof(vbFileWriter));
+  strncpy(vbFileWriter.root, rootFolder, VB_FILE_WRITER_MAX_PATH_LEN - 1);
+
+  if (conf != NULL)
+  {
+    vbFileWriter.conf = *conf;
+  }
+  else
+  {
+    vbFileWriter.conf.flushPeriodMs = VB_FILE_WRITER_DEFAULT_FLUSH_PERIOD;
+    vbFileWriter.conf.maxOpenFiles = VB_FILE_WRITER_DEFAULT_MAX_OPEN_FILES;
+    vbFileWriter.conf.maxFiles = VB_FILE_WRITER_DEFAULT_MAX_FILES;
+    vbFileWriter.conf.maxBufferedBytes = VB_FILE_WRITER_DEFAULT_MAX_BUFFERED;
+    vbFileWriter.conf.fsyncPolicy = VB_FILE_WRITER_FSYNC_NONE;
+    vbFileWriter.conf.ioUring = TRUE;
+  }
+
+  if ((vbFileWriter.conf.maxFiles == 0) || (vbFileWriter.conf.maxOpenFiles == 0) ||
+      (vbFileWriter.conf.flushPeriodMs == 0) || (vbFileWriter.conf.fsyncPolicy >= VB_FILE_WRITER_FSYNC_LAST))
+  {
+    ret = VB_FILE_WRITER_ERROR_BAD_ARGS;
+  }
+
+  if (ret == VB_FILE_WRITER_ERROR_NONE)
+  {
+    vbFileWriter.entries = calloc(vbFileWriter.conf.maxFiles, sizeof(t_fileWriterEntry));
+
+    if (vbFileWriter.entries == NULL)
+    {
+      ret = VB_FILE_WRITER_ERROR_NO_MEMORY;
+    }
+  }
+
+  if (ret == VB_FILE_WRITER_ERROR_NONE)
+  {
+    for (i = 0; i < vbFileWriter.conf.maxFiles; i++)
+    {
+      vbFileWriter.entries[i].fd = -1;
+    }
+
+    vbFileWriter.initialized = TRUE;
+  }
+
+  pthread_mutex_unlock(&vbFileWriterMutex);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbFileWriterRun(void)
+{
+  BOOLEAN ret = FALSE;
+
+  pthread_mutex_lock(&vbFileWriterMutex);
+
+  if ((vbFileWriter.initialized == TRUE) && (vbFileWriter.running == FALSE))
+  {
+    vbFileWriter.running = TRUE;
+    ret = TRUE;
+  }
+
+  pthread_mutex_unlock(&vbFileWriterMutex);
+
+  if (ret == TRUE)
+  {
+    VbLogPrint(VB_LOG_INFO, "Starting %s thread", VB_FILE_WRITER_THREAD_NAME);
+
+    ret = VbThreadCreate(VB_FILE_WRITER_THREAD_NAME, FileWriterThread, NULL, VB_FILE_WRITER_THREAD_CLASS, &vbFileWriter.thread);
+
+    if (ret == FALSE)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Can't create %s thread", VB_FILE_WRITER_THREAD_NAME);
+
+      pthread_mutex_lock(&vbFileWriterMutex);
+      vbFileWriter.running = FALSE;
+      pthread_mutex_unlock(&vbFileWriterMutex);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbFileWriterStop(void)
+{
+  BOOLEAN was_running;
+  INT32U  i;
+
+  pthread_mutex_lock(&vbFileWriterMutex);
+
+  was_running = vbFileWriter.running;
+  vbFileWriter.running = FALSE;
+  pthread_cond_signal(&vbFileWriterCond);
+
+  pthread_mutex_unlock(&vbFileWriterMutex);
+
+  if (was_running == TRUE)
+  {
+    VbThreadJoin(vbFileWriter.thread, VB_FILE_WRITER_THREAD_NAME);
+  }
+
+  pthread_mutex_lock(&vbFileWriterMutex);
+
+  if (vbFileWriter.initialized == TRUE)
+  {
+    // Write remaining data before releasing resources
+    FileWriterFlushAll();
+
+    for (i = 0; i < vbFileWriter.conf.maxFiles; i++)
+    {
+      FileWriterEntryRelease(&vbFileWriter.entries[i]);
+    }
+
+    free(vbFileWriter.entries);
+    vbFileWriter.entries = NULL;
+    vbFileWriter.initialized = FALSE;
+  }
+
+  pthread_mutex_unlock(&vbFileWriterMutex);
+}
+
+/*******************************************************************/
+
+t_vbFileWriterError VbFileWriterWrite(const CHAR *fileName, BOOLEAN truncate, const CHAR *data, INT32U len)
+{
+  t_vbFileWriterError ret;
+  t_fileWriterEntry  *entry = NULL;
+
+  if ((fileName == NULL) || ((data == NULL) && (len > 0)))
+  {
+    return VB_FILE_WRITER_ERROR_BAD_ARGS;
+  }
+
+  pthread_mutex_lock(&vbFileWriterMutex);
+
+  ret = FileWriterWritePrepare(fileName, truncate, len, &entry);
+
+  if (ret == VB_FILE_WRITER_ERROR_NONE)
+  {
+    if (len > 0)
+    {
+      memcpy(entry->buf + entry->len, data, len);
+    }
+
+    FileWriterWriteCommit(entry, len);
+  }
+
+  pthread_mutex_unlock(&vbFileWriterMutex);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_vbFileWriterError VbFileWriterPrintf(const CHAR *fileName, BOOLEAN truncate, const CHAR *fmt, ...)
+{
+  t_vbFileWriterError ret;
+  t_fileWriterEntry  *entry = NULL;
+  va_list             args;
+  INT32S              len;
+
+  if ((fileName == NULL) || (fmt == NULL))
+  {
+    return VB_FILE_WRITER_ERROR_BAD_ARGS;
+  }
+
+  va_start(args, fmt);
+  len = vsnprintf(NULL, 0, fmt, args);
+  va_end(args);
+
+  if (len < 0)
+  {
+    return VB_FILE_WRITER_ERROR_BAD_ARGS;
+  }
+
+  pthread_mutex_lock(&vbFileWriterMutex);
+
+  // Reserve room for the terminating null written by vsnprintf
+  ret = FileWriterWritePrepare(fileName, truncate, len + 1, &entry);
+
+  if (ret == VB_FILE_WRITER_ERROR_NONE)
+  {
+    // Format directly into file buffer
+    va_start(args, fmt);
+    vsnprintf(entry->buf + entry->len, len + 1, fmt, args);
+    va_end(args);
+
+    FileWriterWriteCommit(entry, len);
+  }
+
+  pthread_mutex_unlock(&vbFileWriterMutex);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbFileWriterFlushRequest(void)
+{
+  pthread_mutex_lock(&vbFileWriterMutex);
+  vbFileWriter.wakeUp = TRUE;
+  pthread_cond_signal(&vbFileWriterCond);
+  pthread_mutex_unlock(&vbFileWriterMutex);
+}
+
+/*******************************************************************/
+
+BOOL VbFileWriterConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  BOOL                       ret = FALSE;
+  BOOL                       show_help = FALSE;
+  BOOLEAN                    initialized;
+  t_fileWriterStatsSnapshot  snapshot;
+  t_fileWriterFileSnapshot  *files = NULL;
+  INT32U                     num_files = 0;
+
+  if (cmd[1] == NULL)
+  {
+    // Print from a copy, console output shall not hold writers
+    pthread_mutex_lock(&vbFileWriterMutex);
+    initialized = vbFileWriter.initialized;
+    FileWriterStatsSnapshot(&snapshot);
+    pthread_mutex_unlock(&vbFileWriterMutex);
+
+    if (initialized == TRUE)
+    {
+      FileWriterStatsDump(writeFun, &snapshot);
+    }
+    else
+    {
+      writeFun("File writer not running\n");
+    }
+
+    ret = TRUE;
+  }
+  else if (!strcmp(cmd[1], "l"))
+  {
+    pthread_mutex_lock(&vbFileWriterMutex);
+
+    if (vbFileWriter.initialized == TRUE)
+    {
+      files = (t_fileWriterFileSnapshot *)malloc(vbFileWriter.conf.maxFiles * sizeof(t_fileWriterFileSnapshot));
+
+      if (files != NULL)
+      {
+        num_files = FileWriterFilesSnapshot(files);
+      }
+    }
+
+    pthread_mutex_unlock(&vbFileWriterMutex);
+
+    if (files != NULL)
+    {
+      FileWriterFilesDump(writeFun, files, num_files);
+      free(files);
+    }
+
+    ret = TRUE;
+  }
+  else if (!strcmp(cmd[1], "f"))
+  {
+    VbFileWriterFlushRequest();
+    ret = TRUE;
+  }
+  else if (!strcmp(cmd[1], "r"))
+  {
+    pthread_mutex_lock(&vbFileWriterMutex);
+    bzero(&vbFileWriter.stats, sizeof(vbFileWriter.stats));
+    pthread_mutex_unlock(&vbFileWriterMutex);
+    ret = TRUE;
+  }
+  else if (!strcmp(cmd[1], "h"))
+  {
+    show_help = TRUE;
+    ret = TRUE;
+  }
+
+  if ((ret == FALSE) || (show_help == TRUE))
+  {
+    writeFun("Usage:\n");
+    writeFun("fwriter h       : Shows this help\n");
+    writeFun("fwriter         : Shows file writer statistics\n");
+    writeFun("fwriter l       : Lists tracked files\n");
+    writeFun("fwriter f       : Flushes pending data now\n");
+    writeFun("fwriter r       : Resets statistics\n");
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/
@@ -0,0 +1,164 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_file_writer.h
+ * @brief Asynchronous buffered file writer
+ *
+ * @internal
+ *
+ * Writes are appended to a per file buffer in memory and flushed to disk by a
+ * background thread. Open descriptors are cached (LRU) so consecutive reports
+ * to the same file do not reopen it. When the kernel supports io_uring, each
+ * flush queues the writes (and fsyncs) of all files in a single submission.
+ *
+ **/
+
+#ifndef VB_FILE_WRITER_H_
+#define VB_FILE_WRITER_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "types.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_FILE_WRITER_DEFAULT_FLUSH_PERIOD    (1000)              // In msecs
+#define VB_FILE_WRITER_DEFAULT_MAX_OPEN_FILES  (16)
+#define VB_FILE_WRITER_DEFAULT_MAX_FILES       (256)
+#define VB_FILE_WRITER_DEFAULT_MAX_BUFFERED    (4 * 1024 * 1024)   // In bytes
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef enum
+{
+  VB_FILE_WRITER_ERROR_NONE = 0,
+  VB_FILE_WRITER_ERROR_BAD_ARGS = -1,
+  VB_FILE_WRITER_ERROR_NO_MEMORY = -2,
+  VB_FILE_WRITER_ERROR_BACKPRESSURE = -3,   ///< Buffered data limit reached, data dropped
+  VB_FILE_WRITER_ERROR_NOT_RUNNING = -4,
+  VB_FILE_WRITER_ERROR_NO_SLOT = -5,        ///< All file slots have pending data
+} t_vbFileWriterError;
+
+typedef enum
+{
+  VB_FILE_WRITER_FSYNC_NONE = 0,            ///< Never fsync, rely on kernel writeback
+  VB_FILE_WRITER_FSYNC_ON_CLOSE,            ///< fsync before closing a cached descriptor
+  VB_FILE_WRITER_FSYNC_ON_FLUSH,            ///< fsync after every flush
+  VB_FILE_WRITER_FSYNC_LAST,
+} t_vbFileWriterFsyncPolicy;
+
+typedef struct
+{
+  INT32U                    flushPeriodMs;     ///< Max time data stays in memory
+  INT32U                    maxOpenFiles;      ///< Size of descriptor cache
+  INT32U                    maxFiles;          ///< Max number of files tracked at the same time
+  INT32U                    maxBufferedBytes;  ///< Total buffered data limit (backpressure)
+  t_vbFileWriterFsyncPolicy fsyncPolicy;
+  BOOLEAN                   ioUring;           ///< Flush through io_uring when kernel supports it
+} t_vbFileWriterConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Initializes the file writer
+ * @param[in] rootFolder Folder where all files are created (file names are relative to it)
+ * @param[in] conf Configuration. NULL to use default values
+ * @return @ref t_vbFileWriterError
+ **/
+t_vbFileWriterError VbFileWriterInit(const CHAR *rootFolder, const t_vbFileWriterConf *conf);
+
+/**
+ * @brief Starts the flush thread
+ * @return TRUE if thread is running; FALSE otherwise
+ **/
+BOOLEAN VbFileWriterRun(void);
+
+/**
+ * @brief Flushes all pending data, closes all descriptors and stops the flush thread
+ **/
+void VbFileWriterStop(void);
+
+/**
+ * @brief Queues data to be written to a file
+ * @param[in] fileName File name, relative to root folder
+ * @param[in] truncate TRUE: file is truncated before writing (pending data is discarded); FALSE: data is appended
+ * @param[in] data Data to write
+ * @param[in] len Data length
+ * @return @ref t_vbFileWriterError
+ **/
+t_vbFileWriterError VbFileWriterWrite(const CHAR *fileName, BOOLEAN truncate, const CHAR *data, INT32U len);
+
+/**
+ * @brief Queues a formatted string to be written to a file
+ * @param[in] fileName File name, relative to root folder
+ * @param[in] truncate TRUE: file is truncated before writing (pending data is discarded); FALSE: data is appended
+ * @param[in] fmt printf like format
+ * @return @ref t_vbFileWriterError
+ **/
+t_vbFileWriterError VbFileWriterPrintf(const CHAR *fileName, BOOLEAN truncate, const CHAR *fmt, ...) __attribute__ ((format (printf, 3, 4)));
+
+/**
+ * @brief Wakes up the flush thread to write all pending data as soon as possible
+ **/
+void VbFileWriterFlushRequest(void);
+
+/**
+ * @brief Console command to show file writer statistics
+ **/
+BOOL VbFileWriterConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_FILE_WRITER_H_ */
+
+/**
+ * @}
+ **/
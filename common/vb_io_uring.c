@@ -0,0 +1,684 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_io_uring.c
+ * @brief Thin io_uring wrapper (raw syscalls, no liburing)
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include "types.h"
+#include "vb_util.h"
+#include "vb_log.h"
+#include "vb_io_uring.h"
+
+#if (_IO_URING_ == 1)
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_IO_URING_PROBE_OPS           (256)
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static pthread_once_t vbIoUringProbeOnce = PTHREAD_ONCE_INIT;
+static BOOLEAN        vbIoUringAvailable = FALSE;
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+static INT32S IoUringSetup(INT32U entries, struct io_uring_params *params)
+{
+  return (INT32S)syscall(__NR_io_uring_setup, entries, params);
+}
+
+/*******************************************************************/
+
+static INT32S IoUringEnter(INT32S fd, INT32U toSubmit, INT32U minComplete, INT32U flags)
+{
+  return (INT32S)syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+/*******************************************************************/
+
+static INT32S IoUringRegister(INT32S fd, INT32U opcode, void *arg, INT32U nrArgs)
+{
+  return (INT32S)syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs);
+}
+
+/*******************************************************************/
+
+static void IoUringProbe(void)
+{
+  struct io_uring_params params;
+  INT32S                 fd;
+
+  bzero(&params, sizeof(params));
+  fd = IoUringSetup(1, &params);
+
+  if (fd >= 0)
+  {
+    vbIoUringAvailable = TRUE;
+    close(fd);
+  }
+  else
+  {
+    // ENOSYS: old kernel; EPERM: disabled by kernel.io_uring_disabled or seccomp
+    VbLogPrint(VB_LOG_INFO, "io_uring not available [%s], using blocking I/O", strerror(errno));
+  }
+}
+
+/*******************************************************************/
+
+static void IoUringUnmap(t_vbIoUring *ring)
+{
+  if (ring->sqes != NULL)
+  {
+    munmap(ring->sqes, ring->sqesMapLen);
+    ring->sqes = NULL;
+  }
+
+  if ((ring->cqMap != NULL) && (ring->cqMap != ring->sqMap))
+  {
+    munmap(ring->cqMap, ring->cqMapLen);
+  }
+  ring->cqMap = NULL;
+
+  if (ring->sqMap != NULL)
+  {
+    munmap(ring->sqMap, ring->sqMapLen);
+    ring->sqMap = NULL;
+  }
+}
+
+/*******************************************************************/
+
+static INT32U IoUringCqReady(t_vbIoUring *ring)
+{
+  INT32U tail = *(ring->cqTail);
+
+  // Completion entries are read after the tail
+  __sync_synchronize();
+
+  return tail - *(ring->cqHead);
+}
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+BOOLEAN VbIoUringAvailable(void)
+{
+  pthread_once(&vbIoUringProbeOnce, IoUringProbe);
+
+  return vbIoUringAvailable;
+}
+
+/*******************************************************************/
+
+t_vbIoUringError VbIoUringInit(t_vbIoUring *ring, INT32U entries)
+{
+  t_vbIoUringError       ret = VB_IO_URING_ERROR_NONE;
+  struct io_uring_params params;
+
+  if (ring == NULL)
+  {
+    ret = VB_IO_URING_ERROR_BAD_ARGS;
+  }
+  else
+  {
+    bzero(ring, sizeof(*ring));
+    ring->fd = -1;
+
+    if ((entries == 0) || (entries > VB_IO_URING_MAX_ENTRIES))
+    {
+      ret = VB_IO_URING_ERROR_BAD_ARGS;
+    }
+    else if (VbIoUringAvailable() == FALSE)
+    {
+      ret = VB_IO_URING_ERROR_NOT_SUPPORTED;
+    }
+  }
+
+  if (ret == VB_IO_URING_ERROR_NONE)
+  {
+    bzero(&params, sizeof(params));
+
+#if defined(IORING_SETUP_SINGLE_ISSUER) && defined(IORING_SETUP_COOP_TASKRUN)
+    // Ring is only used by its owner thread, completions are run when it enters the kernel
+    params.flags = IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_COOP_TASKRUN;
+#endif
+
+    ring->fd = IoUringSetup(entries, &params);
+
+    if ((ring->fd < 0) && (errno == EINVAL) && (params.flags != 0))
+    {
+      // Older kernel, retry without optional flags
+      bzero(&params, sizeof(params));
+      ring->fd = IoUringSetup(entries, &params);
+    }
+
+    if (ring->fd < 0)
+    {
+      ret = VB_IO_URING_ERROR_SYSCALL;
+    }
+  }
+
+  if (ret == VB_IO_URING_ERROR_NONE)
+  {
+    ring->sqMapLen = params.sq_off.array + (params.sq_entries * sizeof(INT32U));
+    ring->cqMapLen = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+      ring->sqMapLen = MAX(ring->sqMapLen, ring->cqMapLen);
+      ring->cqMapLen = ring->sqMapLen;
+    }
+
+    ring->sqMap = mmap(NULL, ring->sqMapLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+
+    if (ring->sqMap == MAP_FAILED)
+    {
+      ring->sqMap = NULL;
+      ret = VB_IO_URING_ERROR_NO_MEMORY;
+    }
+  }
+
+  if (ret == VB_IO_URING_ERROR_NONE)
+  {
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+      ring->cqMap = ring->sqMap;
+    }
+    else
+    {
+      ring->cqMap = mmap(NULL, ring->cqMapLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+
+      if (ring->cqMap == MAP_FAILED)
+      {
+        ring->cqMap = NULL;
+        ret = VB_IO_URING_ERROR_NO_MEMORY;
+      }
+    }
+  }
+
+  if (ret == VB_IO_URING_ERROR_NONE)
+  {
+    ring->sqesMapLen = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqesMapLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+
+    if (ring->sqes == MAP_FAILED)
+    {
+      ring->sqes = NULL;
+      ret = VB_IO_URING_ERROR_NO_MEMORY;
+    }
+  }
+
+  if (ret == VB_IO_URING_ERROR_NONE)
+  {
+    INT8U *sq = (INT8U *)ring->sqMap;
+    INT8U *cq = (INT8U *)ring->cqMap;
+
+    ring->sqEntries = params.sq_entries;
+    ring->sqHead = (volatile INT32U *)(sq + params.sq_off.head);
+    ring->sqTail = (volatile INT32U *)(sq + params.sq_off.tail);
+    ring->sqMask = *(INT32U *)(sq + params.sq_off.ring_mask);
+    ring->sqArray = (INT32U *)(sq + params.sq_off.array);
+    ring->sqLocalTail = *(ring->sqTail);
+    ring->cqHead = (volatile INT32U *)(cq + params.cq_off.head);
+    ring->cqTail = (volatile INT32U *)(cq + params.cq_off.tail);
+    ring->cqMask = *(INT32U *)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+  }
+  else if ((ring != NULL) && (ring->fd >= 0))
+  {
+    IoUringUnmap(ring);
+    close(ring->fd);
+    ring->fd = -1;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbIoUringDestroy(t_vbIoUring *ring)
+{
+  if ((ring != NULL) && (ring->fd >= 0))
+  {
+    IoUringUnmap(ring);
+    close(ring->fd);
+    ring->fd = -1;
+  }
+}
+
+/*******************************************************************/
+
+BOOLEAN VbIoUringOpSupported(t_vbIoUring *ring, INT8U opcode)
+{
+  BOOLEAN                ret = FALSE;
+  struct io_uring_probe *probe;
+  INT32U                 probe_len = sizeof(*probe) + (VB_IO_URING_PROBE_OPS * sizeof(struct io_uring_probe_op));
+
+  probe = calloc(1, probe_len);
+
+  if ((ring != NULL) && (ring->fd >= 0) && (probe != NULL))
+  {
+    if ((IoUringRegister(ring->fd, IORING_REGISTER_PROBE, probe, VB_IO_URING_PROBE_OPS) == 0) &&
+        (opcode <= probe->last_op) &&
+        (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED))
+    {
+      ret = TRUE;
+    }
+  }
+
+  free(probe);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+struct io_uring_sqe *VbIoUringSqeGet(t_vbIoUring *ring)
+{
+  struct io_uring_sqe *sqe = NULL;
+  INT32U               head = *(ring->sqHead);
+
+  __sync_synchronize();
+
+  if ((ring->sqLocalTail - head) < ring->sqEntries)
+  {
+    INT32U idx = ring->sqLocalTail & ring->sqMask;
+
+    sqe = &(ring->sqes[idx]);
+    bzero(sqe, sizeof(*sqe));
+    ring->sqArray[idx] = idx;
+    ring->sqLocalTail++;
+  }
+
+  return sqe;
+}
+
+/*******************************************************************/
+
+t_vbIoUringError VbIoUringSubmit(t_vbIoUring *ring, INT32U waitNr)
+{
+  t_vbIoUringError ret = VB_IO_URING_ERROR_NONE;
+  INT32U           tail = *(ring->sqTail);
+
+  // Publish new entries
+  ring->sqPending += ring->sqLocalTail - tail;
+  __sync_synchronize();
+  *(ring->sqTail) = ring->sqLocalTail;
+
+  while ((ret == VB_IO_URING_ERROR_NONE) && ((ring->sqPending > 0) || (IoUringCqReady(ring) < waitNr)))
+  {
+    INT32U wait_nr = MIN(waitNr, ring->cqMask + 1);
+    INT32S res;
+
+    res = IoUringEnter(ring->fd, ring->sqPending, wait_nr, (wait_nr > 0)?IORING_ENTER_GETEVENTS:0);
+    ring->stats.enters++;
+
+    if (res >= 0)
+    {
+      ring->sqPending -= MIN((INT32U)res, ring->sqPending);
+      ring->stats.submitted += res;
+
+      if (wait_nr == 0)
+      {
+        break;
+      }
+    }
+    else if ((errno != EINTR) && (errno != EAGAIN) && (errno != EBUSY))
+    {
+      ret = VB_IO_URING_ERROR_SYSCALL;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+struct io_uring_cqe *VbIoUringCqePeek(t_vbIoUring *ring)
+{
+  struct io_uring_cqe *cqe = NULL;
+
+  if (IoUringCqReady(ring) > 0)
+  {
+    cqe = &(ring->cqes[*(ring->cqHead) & ring->cqMask]);
+  }
+
+  return cqe;
+}
+
+/*******************************************************************/
+
+void VbIoUringCqeSeen(t_vbIoUring *ring)
+{
+  // Completion entry is released once fully read
+  __sync_synchronize();
+  *(ring->cqHead) = *(ring->cqHead) + 1;
+  ring->stats.completed++;
+}
+
+/*******************************************************************/
+
+void VbIoUringPrepWrite(struct io_uring_sqe *sqe, INT32S fd, const void *buf, INT32U len, INT64U userData)
+{
+  sqe->opcode = IORING_OP_WRITE;
+  sqe->fd = fd;
+  sqe->addr = (INT64U)(uintptr_t)buf;
+  sqe->len = len;
+  sqe->off = (INT64U)-1;       // Current file position (end of file on O_APPEND descriptors)
+  sqe->user_data = userData;
+}
+
+/*******************************************************************/
+
+void VbIoUringPrepFsync(struct io_uring_sqe *sqe, INT32S fd, INT64U userData)
+{
+  sqe->opcode = IORING_OP_FSYNC;
+  sqe->fd = fd;
+  sqe->user_data = userData;
+}
+
+/*******************************************************************/
+
+void VbIoUringPrepRecvMultishot(struct io_uring_sqe *sqe, INT32S fd, INT16U groupId, INT64U userData)
+{
+  sqe->opcode = IORING_OP_RECV;
+  sqe->fd = fd;
+  sqe->ioprio = IORING_RECV_MULTISHOT;
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = groupId;
+  sqe->user_data = userData;
+}
+
+/*******************************************************************/
+
+t_vbIoUringError VbIoUringBufRingSetup(t_vbIoUring *ring, t_vbIoUringBufRing *bufRing, INT16U groupId, INT32U numBufs, INT32U bufSize)
+{
+  t_vbIoUringError        ret = VB_IO_URING_ERROR_NONE;
+  struct io_uring_buf_reg reg;
+  INT32U                  i;
+
+  if ((ring == NULL) || (bufRing == NULL) || (numBufs == 0) || (numBufs > 0x8000) ||
+      ((numBufs & (numBufs - 1)) != 0) || (bufSize == 0))
+  {
+    ret = VB_IO_URING_ERROR_BAD_ARGS;
+  }
+
+  if (ret == VB_IO_URING_ERROR_NONE)
+  {
+    bzero(bufRing, sizeof(*bufRing));
+    bufRing->numBufs = numBufs;
+    bufRing->bufSize = bufSize;
+    bufRing->groupId = groupId;
+
+    // Ring entries and buffers in a single page aligned mapping
+    bufRing->mapLen = (numBufs * sizeof(struct io_uring_buf)) + (numBufs * bufSize);
+    bufRing->ring = mmap(NULL, bufRing->mapLen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (bufRing->ring == MAP_FAILED)
+    {
+      bufRing->ring = NULL;
+      ret = VB_IO_URING_ERROR_NO_MEMORY;
+    }
+  }
+
+  if (ret == VB_IO_URING_ERROR_NONE)
+  {
+    bufRing->bufs = (INT8U *)bufRing->ring + (numBufs * sizeof(struct io_uring_buf));
+
+    bzero(&reg, sizeof(reg));
+    reg.ring_addr = (INT64U)(uintptr_t)bufRing->ring;
+    reg.ring_entries = numBufs;
+    reg.bgid = groupId;
+
+    if (IoUringRegister(ring->fd, IORING_REGISTER_PBUF_RING, &reg, 1) != 0)
+    {
+      // Provided buffer rings need kernel 5.19
+      ret = VB_IO_URING_ERROR_NOT_SUPPORTED;
+      munmap(bufRing->ring, bufRing->mapLen);
+      bufRing->ring = NULL;
+    }
+  }
+
+  if (ret == VB_IO_URING_ERROR_NONE)
+  {
+    for (i = 0; i < numBufs; i++)
+    {
+      VbIoUringBufRingRecycle(bufRing, (INT16U)i);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbIoUringBufRingDestroy(t_vbIoUring *ring, t_vbIoUringBufRing *bufRing)
+{
+  struct io_uring_buf_reg reg;
+
+  if ((ring != NULL) && (bufRing != NULL) && (bufRing->ring != NULL))
+  {
+    if (ring->fd >= 0)
+    {
+      bzero(&reg, sizeof(reg));
+      reg.bgid = bufRing->groupId;
+      IoUringRegister(ring->fd, IORING_UNREGISTER_PBUF_RING, &reg, 1);
+    }
+
+    munmap(bufRing->ring, bufRing->mapLen);
+    bufRing->ring = NULL;
+    bufRing->bufs = NULL;
+  }
+}
+
+/*******************************************************************/
+
+INT8U *VbIoUringBufRingBufGet(t_vbIoUringBufRing *bufRing, const struct io_uring_cqe *cqe, INT16U *bufId)
+{
+  *bufId = (INT16U)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+
+  return bufRing->bufs + ((INT32U)(*bufId & (bufRing->numBufs - 1)) * bufRing->bufSize);
+}
+
+/*******************************************************************/
+
+void VbIoUringBufRingRecycle(t_vbIoUringBufRing *bufRing, INT16U bufId)
+{
+  struct io_uring_buf *buf = &(bufRing->ring->bufs[bufRing->tail & (bufRing->numBufs - 1)]);
+
+  buf->addr = (INT64U)(uintptr_t)(bufRing->bufs + ((INT32U)bufId * bufRing->bufSize));
+  buf->len = bufRing->bufSize;
+  buf->bid = bufId;
+
+  bufRing->tail++;
+  // Buffer is handed to the kernel once fully described
+  __sync_synchronize();
+  *((volatile INT16U *)&(bufRing->ring->tail)) = bufRing->tail;
+}
+
+#else
+
+/*
+ ************************************************************************
+ ** Public function implementation (built without io_uring support)
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+BOOLEAN VbIoUringAvailable(void)
+{
+  return FALSE;
+}
+
+/*******************************************************************/
+
+t_vbIoUringError VbIoUringInit(t_vbIoUring *ring, INT32U entries)
+{
+  return VB_IO_URING_ERROR_NOT_SUPPORTED;
+}
+
+/*******************************************************************/
+
+void VbIoUringDestroy(t_vbIoUring *ring)
+{
+}
+
+/*******************************************************************/
+
+BOOLEAN VbIoUringOpSupported(t_vbIoUring *ring, INT8U opcode)
+{
+  return FALSE;
+}
+
+/*******************************************************************/
+
+struct io_uring_sqe *VbIoUringSqeGet(t_vbIoUring *ring)
+{
+  return NULL;
+}
+
+/*******************************************************************/
+
+t_vbIoUringError VbIoUringSubmit(t_vbIoUring *ring, INT32U waitNr)
+{
+  return VB_IO_URING_ERROR_NOT_SUPPORTED;
+}
+
+/*******************************************************************/
+
+struct io_uring_cqe *VbIoUringCqePeek(t_vbIoUring *ring)
+{
+  return NULL;
+}
+
+/*******************************************************************/
+
+void VbIoUringCqeSeen(t_vbIoUring *ring)
+{
+}
+
+/*******************************************************************/
+
+void VbIoUringPrepWrite(struct io_uring_sqe *sqe, INT32S fd, const void *buf, INT32U len, INT64U userData)
+{
+}
+
+/*******************************************************************/
+
+void VbIoUringPrepFsync(struct io_uring_sqe *sqe, INT32S fd, INT64U userData)
+{
+}
+
+/*******************************************************************/
+
+void VbIoUringPrepRecvMultishot(struct io_uring_sqe *sqe, INT32S fd, INT16U groupId, INT64U userData)
+{
+}
+
+/*******************************************************************/
+
+t_vbIoUringError VbIoUringBufRingSetup(t_vbIoUring *ring, t_vbIoUringBufRing *bufRing, INT16U groupId, INT32U numBufs, INT32U bufSize)
+{
+  return VB_IO_URING_ERROR_NOT_SUPPORTED;
+}
+
+/*******************************************************************/
+
+void VbIoUringBufRingDestroy(t_vbIoUring *ring, t_vbIoUringBufRing *bufRing)
+{
+}
+
+/*******************************************************************/
+
+INT8U *VbIoUringBufRingBufGet(t_vbIoUringBufRing *bufRing, const struct io_uring_cqe *cqe, INT16U *bufId)
+{
+  return NULL;
+}
+
+/*******************************************************************/
+
+void VbIoUringBufRingRecycle(t_vbIoUringBufRing *bufRing, INT16U bufId)
+{
+}
+
+#endif /* _IO_URING_ */
+
+/**
+ * @}
+ **/
@@ -0,0 +1,258 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_io_uring.h
+ * @brief Thin io_uring wrapper (raw syscalls, no liburing)
+ *
+ * @internal
+ *
+ * Each I/O thread owns its ring: submission and completion are done by the
+ * same thread, so no locking is needed. Users check @ref VbIoUringAvailable
+ * (or the result of @ref VbIoUringInit) and keep their blocking code path as
+ * fallback for kernels without io_uring or with it disabled.
+ *
+ * io_uring needs recent kernel headers (6.0 uapi), so it is only built when
+ * _IO_URING_ is 1 (make VECTORBOOST_IO_URING=yes). Otherwise every function
+ * reports io_uring as not supported, and users guard the code that touches
+ * io_uring structures the same way.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_IO_URING_H_
+#define VB_IO_URING_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#if (_IO_URING_ == 1)
+#include <linux/io_uring.h>
+#else
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+#endif
+
+#include "types.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_IO_URING_MAX_ENTRIES                (4096)
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef enum
+{
+  VB_IO_URING_ERROR_NONE = 0,
+  VB_IO_URING_ERROR_BAD_ARGS = -1,
+  VB_IO_URING_ERROR_NOT_SUPPORTED = -2,     ///< io_uring (or a required feature) not available in this kernel
+  VB_IO_URING_ERROR_NO_MEMORY = -3,
+  VB_IO_URING_ERROR_SYSCALL = -4,
+  VB_IO_URING_ERROR_SQ_FULL = -5,           ///< No free submission entry
+} t_vbIoUringError;
+
+typedef struct
+{
+  INT64U          enters;                   ///< io_uring_enter() calls
+  INT64U          submitted;                ///< Submission entries consumed by the kernel
+  INT64U          completed;                ///< Completion entries reaped
+} t_vbIoUringStats;
+
+/// Ring owned by a single thread
+typedef struct
+{
+  INT32S                fd;
+  INT32U                sqEntries;
+  INT32U                sqMask;
+  INT32U                cqMask;
+  INT32U                sqLocalTail;        ///< Entries got by @ref VbIoUringSqeGet (published on submit)
+  INT32U                sqPending;          ///< Entries published but not consumed by the kernel yet
+  volatile INT32U      *sqHead;
+  volatile INT32U      *sqTail;
+  INT32U               *sqArray;
+  struct io_uring_sqe  *sqes;
+  volatile INT32U      *cqHead;
+  volatile INT32U      *cqTail;
+  struct io_uring_cqe  *cqes;
+  void                 *sqMap;
+  INT32U                sqMapLen;
+  void                 *cqMap;              ///< Same as sqMap on kernels with single mmap
+  INT32U                cqMapLen;
+  INT32U                sqesMapLen;
+  t_vbIoUringStats      stats;
+} t_vbIoUring;
+
+/// Provided buffers ring: kernel picks a free buffer for each completion (multishot receive)
+typedef struct
+{
+  struct io_uring_buf_ring *ring;
+  INT8U                    *bufs;
+  INT32U                    mapLen;
+  INT32U                    numBufs;        ///< Power of 2
+  INT32U                    bufSize;
+  INT16U                    groupId;
+  INT16U                    tail;
+} t_vbIoUringBufRing;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Checks (once per process) that io_uring rings can be created
+ * @return TRUE: available; FALSE: otherwise
+ **/
+BOOLEAN VbIoUringAvailable(void);
+
+/**
+ * @brief Creates a ring
+ * @param[out] ring Ring
+ * @param[in] entries Submission queue size (rounded up to a power of 2 by the kernel)
+ * @return @ref t_vbIoUringError
+ **/
+t_vbIoUringError VbIoUringInit(t_vbIoUring *ring, INT32U entries);
+
+/**
+ * @brief Releases a ring. Pending requests are cancelled by the kernel.
+ * @param[in] ring Ring
+ **/
+void VbIoUringDestroy(t_vbIoUring *ring);
+
+/**
+ * @brief Checks the kernel supports an operation
+ * @param[in] ring Ring
+ * @param[in] opcode IORING_OP_xxx
+ * @return TRUE: supported; FALSE: otherwise
+ **/
+BOOLEAN VbIoUringOpSupported(t_vbIoUring *ring, INT8U opcode);
+
+/**
+ * @brief Gets a zeroed submission entry
+ * @param[in] ring Ring
+ * @return Entry; NULL if submission queue is full
+ **/
+struct io_uring_sqe *VbIoUringSqeGet(t_vbIoUring *ring);
+
+/**
+ * @brief Submits all entries got so far and waits until there are completions
+ * @param[in] ring Ring
+ * @param[in] waitNr Completions to wait for (0: only submit)
+ * @return @ref t_vbIoUringError
+ **/
+t_vbIoUringError VbIoUringSubmit(t_vbIoUring *ring, INT32U waitNr);
+
+/**
+ * @brief Gets next completion without waiting
+ * @param[in] ring Ring
+ * @return Completion; NULL if none. Shall be released with @ref VbIoUringCqeSeen.
+ **/
+struct io_uring_cqe *VbIoUringCqePeek(t_vbIoUring *ring);
+
+/**
+ * @brief Releases the completion got by @ref VbIoUringCqePeek
+ * @param[in] ring Ring
+ **/
+void VbIoUringCqeSeen(t_vbIoUring *ring);
+
+/**
+ * @brief Prepares a write at current file position
+ **/
+void VbIoUringPrepWrite(struct io_uring_sqe *sqe, INT32S fd, const void *buf, INT32U len, INT64U userData);
+
+/**
+ * @brief Prepares an fsync
+ **/
+void VbIoUringPrepFsync(struct io_uring_sqe *sqe, INT32S fd, INT64U userData);
+
+/**
+ * @brief Prepares a multishot receive taking buffers from a provided buffers ring
+ **/
+void VbIoUringPrepRecvMultishot(struct io_uring_sqe *sqe, INT32S fd, INT16U groupId, INT64U userData);
+
+/**
+ * @brief Allocates and registers a provided buffers ring
+ * @param[in] ring Ring
+ * @param[out] bufRing Buffers ring
+ * @param[in] groupId Buffer group referenced by requests
+ * @param[in] numBufs Number of buffers (power of 2)
+ * @param[in] bufSize Size of each buffer
+ * @return @ref t_vbIoUringError
+ **/
+t_vbIoUringError VbIoUringBufRingSetup(t_vbIoUring *ring, t_vbIoUringBufRing *bufRing, INT16U groupId, INT32U numBufs, INT32U bufSize);
+
+/**
+ * @brief Unregisters and releases a provided buffers ring
+ * @param[in] ring Ring
+ * @param[in] bufRing Buffers ring
+ **/
+void VbIoUringBufRingDestroy(t_vbIoUring *ring, t_vbIoUringBufRing *bufRing);
+
+/**
+ * @brief Gets the buffer reported by a completion
+ * @param[in] bufRing Buffers ring
+ * @param[in] cqe Completion with IORING_CQE_F_BUFFER flag
+ * @param[out] bufId Buffer index, to be given back with @ref VbIoUringBufRingRecycle
+ * @return Buffer data
+ **/
+INT8U *VbIoUringBufRingBufGet(t_vbIoUringBufRing *bufRing, const struct io_uring_cqe *cqe, INT16U *bufId);
+
+/**
+ * @brief Gives a buffer back to the kernel
+ * @param[in] bufRing Buffers ring
+ * @param[in] bufId Buffer index
+ **/
+void VbIoUringBufRingRecycle(t_vbIoUringBufRing *bufRing, INT16U bufId);
+
+#endif /* VB_IO_URING_H_ */
+
+/**
+ * @}
+ **/
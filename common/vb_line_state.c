@@ -0,0 +1,288 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_line_state.c
+ * @brief Shared memory line state table reader implementation
+ *
+ * @internal
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "types.h"
+#include "vb_util.h"
+#include "vb_line_state.h"
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+static BOOLEAN VbLineStateLayoutIsValid(const t_vbLineStateHeader *header, size_t mapSize)
+{
+  BOOLEAN ret = FALSE;
+
+  if ((header != NULL) &&
+      (mapSize >= sizeof(t_vbLineStateHeader)) &&
+      (header->magic == VB_LINE_STATE_MAGIC) &&
+      (header->version == VB_LINE_STATE_LAYOUT_VERSION) &&
+      (header->headerSize == sizeof(t_vbLineStateHeader)) &&
+      (header->entrySize == sizeof(t_vbLineStateEntry)) &&
+      (VbLineStateTableSizeGet(header->maxEntries) <= mapSize))
+  {
+    ret = TRUE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+void VbLineStateShmNameBuild(const CHAR *engineId, CHAR *shmName)
+{
+  // Same naming scheme as VbUtilQueueNameBuild(), so tools do not need to link vb_util.c
+  if ((engineId != NULL) && (shmName != NULL))
+  {
+    snprintf(shmName, VB_QUEUE_NAME_LEN, "%s_%s", VB_LINE_STATE_SHM_PREFIX, engineId);
+    shmName[VB_QUEUE_NAME_LEN - 1] = '\0';
+  }
+}
+
+/*******************************************************************/
+
+size_t VbLineStateTableSizeGet(INT32U maxEntries)
+{
+  return sizeof(t_vbLineStateHeader) + ((size_t)maxEntries * sizeof(t_vbLineStateEntry));
+}
+
+/*******************************************************************/
+
+t_vbLineStateError VbLineStateReaderOpen(const CHAR *shmName, t_vbLineStateReader *reader)
+{
+  t_vbLineStateError ret = VB_LINE_STATE_ERROR_NONE;
+  struct stat        shm_stat;
+  void              *map = MAP_FAILED;
+
+  if (reader != NULL)
+  {
+    bzero(reader, sizeof(*reader));
+    reader->fd = -1;
+  }
+
+  if ((shmName == NULL) || (reader == NULL))
+  {
+    ret = VB_LINE_STATE_ERROR_BAD_ARGS;
+  }
+
+  if (ret == VB_LINE_STATE_ERROR_NONE)
+  {
+    reader->fd = shm_open(shmName, O_RDONLY, 0);
+
+    if (reader->fd < 0)
+    {
+      ret = VB_LINE_STATE_ERROR_SHM;
+    }
+  }
+
+  if (ret == VB_LINE_STATE_ERROR_NONE)
+  {
+    if ((fstat(reader->fd, &shm_stat) != 0) || (shm_stat.st_size < (off_t)sizeof(t_vbLineStateHeader)))
+    {
+      ret = VB_LINE_STATE_ERROR_LAYOUT;
+    }
+  }
+
+  if (ret == VB_LINE_STATE_ERROR_NONE)
+  {
+    map = mmap(NULL, shm_stat.st_size, PROT_READ, MAP_SHARED, reader->fd, 0);
+
+    if (map == MAP_FAILED)
+    {
+      ret = VB_LINE_STATE_ERROR_SHM;
+    }
+  }
+
+  if (ret == VB_LINE_STATE_ERROR_NONE)
+  {
+    reader->mapSize = shm_stat.st_size;
+    reader->header = (const t_vbLineStateHeader *)map;
+    reader->entries = (const t_vbLineStateEntry *)((const INT8U *)map + sizeof(t_vbLineStateHeader));
+
+    if (VbLineStateLayoutIsValid(reader->header, reader->mapSize) == FALSE)
+    {
+      ret = VB_LINE_STATE_ERROR_LAYOUT;
+    }
+  }
+
+  if ((ret != VB_LINE_STATE_ERROR_NONE) && (reader != NULL))
+  {
+    VbLineStateReaderClose(reader);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbLineStateReaderClose(t_vbLineStateReader *reader)
+{
+  if (reader != NULL)
+  {
+    if (reader->header != NULL)
+    {
+      munmap((void *)reader->header, reader->mapSize);
+    }
+
+    if (reader->fd >= 0)
+    {
+      close(reader->fd);
+    }
+
+    bzero(reader, sizeof(*reader));
+    reader->fd = -1;
+  }
+}
+
+/*******************************************************************/
+
+t_vbLineStateError VbLineStateEntryRead(const t_vbLineStateReader *reader, INT32U idx, t_vbLineStateEntry *entry)
+{
+  t_vbLineStateError        ret = VB_LINE_STATE_ERROR_BUSY;
+  const t_vbLineStateEntry *shared;
+  INT32U                    seq_start;
+  INT32U                    seq_end;
+  INT32U                    attempt;
+
+  if ((reader == NULL) || (reader->header == NULL) || (entry == NULL) ||
+      (idx >= reader->header->maxEntries))
+  {
+    ret = VB_LINE_STATE_ERROR_BAD_ARGS;
+  }
+  else
+  {
+    shared = &reader->entries[idx];
+
+    for (attempt = 0; attempt < VB_LINE_STATE_READ_MAX_RETRIES; attempt++)
+    {
+      seq_start = shared->seq;
+      __sync_synchronize();
+
+      if ((seq_start & 1) == 0)
+      {
+        memcpy(entry, (const void *)shared, sizeof(*entry));
+        __sync_synchronize();
+        seq_end = shared->seq;
+
+        if (seq_start == seq_end)
+        {
+          ret = VB_LINE_STATE_ERROR_NONE;
+          break;
+        }
+      }
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_vbLineStateError VbLineStateEntryByMacRead(const t_vbLineStateReader *reader, const INT8U *mac, t_vbLineStateEntry *entry)
+{
+  t_vbLineStateError ret = VB_LINE_STATE_ERROR_NOT_FOUND;
+  INT32U             idx;
+  INT32U             num_entries;
+
+  if ((reader == NULL) || (reader->header == NULL) || (mac == NULL) || (entry == NULL))
+  {
+    ret = VB_LINE_STATE_ERROR_BAD_ARGS;
+  }
+  else
+  {
+    num_entries = MIN(reader->header->numEntries, reader->header->maxEntries);
+
+    for (idx = 0; idx < num_entries; idx++)
+    {
+      // Cheap unlocked pre-check, confirmed below with a consistent copy
+      if (memcmp((const void *)reader->entries[idx].MAC, mac, ETH_ALEN) == 0)
+      {
+        ret = VbLineStateEntryRead(reader, idx, entry);
+
+        if ((ret == VB_LINE_STATE_ERROR_NONE) &&
+            ((entry->valid == FALSE) || (memcmp(entry->MAC, mac, ETH_ALEN) != 0)))
+        {
+          ret = VB_LINE_STATE_ERROR_NOT_FOUND;
+        }
+
+        if (ret != VB_LINE_STATE_ERROR_NOT_FOUND)
+        {
+          break;
+        }
+      }
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/
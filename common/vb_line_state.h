@@ -0,0 +1,211 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_line_state.h
+ * @brief Shared memory line state table interface
+ *
+ * @internal
+ *
+ * The engine publishes the state of every line (boost level, payload...) in a
+ * POSIX shared memory object with the fixed layout defined below. Each entry
+ * is protected by its own sequence lock, so external tools can read it without
+ * any syscall and without blocking the engine.
+ *
+ **/
+
+#ifndef VB_LINE_STATE_H_
+#define VB_LINE_STATE_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stddef.h>
+
+#include "vb_types.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_LINE_STATE_SHM_PREFIX          "/VbEngineLineState"
+#define VB_LINE_STATE_MAGIC               (0x56424C53) // "VBLS"
+#define VB_LINE_STATE_LAYOUT_VERSION      (1)
+#define VB_LINE_STATE_DEFAULT_MAX_LINES   (4096)
+#define VB_LINE_STATE_READ_MAX_RETRIES    (100)
+#define VB_LINE_STATE_DRIVER_ID_LEN       (24)
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef enum
+{
+  VB_LINE_STATE_ERROR_NONE = 0,
+  VB_LINE_STATE_ERROR_BAD_ARGS = -1,
+  VB_LINE_STATE_ERROR_SHM = -2,
+  VB_LINE_STATE_ERROR_LAYOUT = -3,
+  VB_LINE_STATE_ERROR_BUSY = -4,
+  VB_LINE_STATE_ERROR_NOT_FOUND = -5,
+} t_vbLineStateError;
+
+/// Shared memory header. Written once by the engine at creation time, except
+/// numEntries and lastUpdateNs.
+typedef struct
+{
+  INT32U          magic;             ///< VB_LINE_STATE_MAGIC
+  INT32U          version;           ///< VB_LINE_STATE_LAYOUT_VERSION
+  INT32U          headerSize;        ///< sizeof(t_vbLineStateHeader)
+  INT32U          entrySize;         ///< sizeof(t_vbLineStateEntry)
+  INT32U          maxEntries;        ///< Number of entries following the header
+  volatile INT32U numEntries;        ///< Highest used entry index + 1
+  volatile INT64U lastUpdateNs;      ///< Last table refresh (CLOCK_REALTIME, ns)
+  INT32U          updatePeriodMs;    ///< Nominal refresh period
+  INT32U          writerPid;         ///< Engine process Id
+  CHAR            engineId[VB_ENGINE_ID_MAX_SIZE];
+} __attribute__((aligned(64))) t_vbLineStateHeader;
+
+/// One entry per node. Fields are only consistent when read through
+/// @ref VbLineStateEntryRead (seqlock protocol).
+typedef struct
+{
+  volatile INT32U seq;               ///< Sequence lock. Odd while being written
+  INT8U           valid;             ///< TRUE: entry belongs to a present node
+  INT8U           type;              ///< @ref t_nodeType
+  INT8U           MAC[ETH_ALEN];
+  INT16U          boostLevel;        ///< Amount of bands in use
+  INT16U          boostPerc;         ///< Percentage of spectrum in use
+  INT16U          payloadMax;        ///< Max L2 xput (Mbps)
+  INT16U          currentPayload;    ///< Current ingress traffic (Mbps)
+  INT32S          clusterId;
+  INT64U          lastUpdateNs;      ///< Last refresh of this entry (CLOCK_REALTIME, ns)
+  INT64U          lastChangeNs;      ///< Last change of boost level (CLOCK_REALTIME, ns)
+  CHAR            driverId[VB_LINE_STATE_DRIVER_ID_LEN];
+} __attribute__((aligned(64))) t_vbLineStateEntry;
+
+/// Reader handle
+typedef struct
+{
+  INT32S                     fd;
+  size_t                     mapSize;
+  const t_vbLineStateHeader *header;
+  const t_vbLineStateEntry  *entries;
+} t_vbLineStateReader;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Builds the shared memory object name used by a given engine
+ * @param[in] engineId Engine Id (as configured in vb_engine.ini)
+ * @param[out] shmName Resulting name. Buffer size shall be @ref VB_QUEUE_NAME_LEN bytes
+ **/
+void VbLineStateShmNameBuild(const CHAR *engineId, CHAR *shmName);
+
+/**
+ * @brief Gets the total size of a table with the given number of entries
+ * @param[in] maxEntries Number of entries
+ * @return Size in bytes
+ **/
+size_t VbLineStateTableSizeGet(INT32U maxEntries);
+
+/**
+ * @brief Maps an existing line state table in read-only mode
+ * @param[in] shmName Shared memory object name
+ * @param[out] reader Reader handle
+ * @return @ref t_vbLineStateError
+ **/
+t_vbLineStateError VbLineStateReaderOpen(const CHAR *shmName, t_vbLineStateReader *reader);
+
+/**
+ * @brief Unmaps a previously opened line state table
+ * @param[in] reader Reader handle
+ **/
+void VbLineStateReaderClose(t_vbLineStateReader *reader);
+
+/**
+ * @brief Gets a consistent copy of one entry
+ * @param[in] reader Reader handle
+ * @param[in] idx Entry index
+ * @param[out] entry Copy of the entry
+ * @return @ref t_vbLineStateError. VB_LINE_STATE_ERROR_BUSY if the writer kept
+ * the entry busy for @ref VB_LINE_STATE_READ_MAX_RETRIES attempts
+ **/
+t_vbLineStateError VbLineStateEntryRead(const t_vbLineStateReader *reader, INT32U idx, t_vbLineStateEntry *entry);
+
+/**
+ * @brief Searches a valid entry by MAC address and gets a consistent copy of it
+ * @param[in] reader Reader handle
+ * @param[in] mac MAC address to search
+ * @param[out] entry Copy of the entry
+ * @return @ref t_vbLineStateError
+ **/
+t_vbLineStateError VbLineStateEntryByMacRead(const t_vbLineStateReader *reader, const INT8U *mac, t_vbLineStateEntry *entry);
+
+/**
+ * @brief Opens a write transaction on given entry (seqlock writer side)
+ * @param[in] entry Entry to update
+ **/
+static inline void VbLineStateEntryWriteBegin(t_vbLineStateEntry *entry)
+{
+  entry->seq++;
+  __sync_synchronize();
+}
+
+/**
+ * @brief Closes a write transaction on given entry (seqlock writer side)
+ * @param[in] entry Entry updated
+ **/
+static inline void VbLineStateEntryWriteEnd(t_vbLineStateEntry *entry)
+{
+  __sync_synchronize();
+  entry->seq++;
+}
+
+#endif /* VB_LINE_STATE_H_ */
+
+/**
+ * @}
+ **/
@@ -58,7 +58,6 @@
 #include <errno.h>
 #include <pthread.h>
 #include <mqueue.h>
-#include <libgen.h>
 
 #if (_WITH_SYSLOG_ == 1)
 #include <syslog.h>
@@ -72,6 +71,7 @@
 #include "vb_thread.h"
 #include "vb_priorities.h"
 #include "vb_util.h"
+#include "vb_file_writer.h"
 #include "vb_ea_communication.h"
 
 /*
@@ -129,26 +129,12 @@ typedef struct
                                  // buffer which is later automatically "free()'ed"
                                  // by the Log subsystem once the message has been
                                  // processed
-
-  // The next ones are only used when type == VB_LOG_EVENT_SAVETOFILE
-  //
-  CHAR          *file_name;      // File where data will be written. It must be a
-                                 // a pointer to a dynamically allocated buffer
-                                 // which is later automatically "free()'ed" by
-                                 // the Log subsystem once the message has been
-                                 // processed
-  const CHAR    *access_mode;    // Either "w+"  or "a+" for overwritting the whole
-                                 // file or appending the data at the end
-                                 // respectively. It must be a pointer to a
-                                 // rodata string that is never changed or freed.
 } t_vbLogMsg;
 
 
 typedef enum {
   VB_LOG_EVENT_PRINT      = 0xa1,  // Message is sent using the default Log
                                    // subsystem output mechanism (ie. socket)
-  VB_LOG_EVENT_SAVETOFILE = 0xa2,  // Message is saved to a specific file in the
-                                   // file system
   VB_LOG_EVENT_CLOSE      = 0xa3,  // Special event to end the processing of
                                    // future messages and close the queue
 } t_vbLogType;
@@ -179,7 +165,6 @@ static BOOL         vbLogThreadRunning;
 static mqd_t        vbLogQueue;
 static mqd_t        vbLogQueueBlock;
 static const CHAR   *vbQueueName;
-static CHAR         vbOutputFolder[VB_LOG_FILENAME_LEN+1];
 static t_vbLogPersistent vbLogPersistent;
 #endif
 
@@ -198,9 +183,6 @@ static void VbLogErrorPrint(const char *fmt, ...);
 // Send the message to the default Log subsystem output (typically a socket, but
 // this might change in the future)
 static void VbLogWriteToDefault(const char *str);
-
-// Save the message to a file (instead of sending it to the default output).
-static void VbLogWriteToFile(const char *file_name, const char *mode, const char *str);
 #endif
 
 // Build the "log header" string (that is pre-pended to all messages sent to the
@@ -261,46 +243,6 @@ static void VbLogWriteToDefault(const char *str)
       fflush(stdout);
   }
 }
-
-/*******************************************************************/
-
-static void VbLogWriteToFile(const char *file_name, const char *mode, const char *str)
-{
-  FILE *fd;
-  char *aux;
-
-  // Create parent folders
-  //
-  if((file_name != NULL) && (mode != NULL) && (str != NULL))
-  {
-    aux = strdup(file_name);
-    if(aux != NULL)
-    {
-      VbUtilCreateFolderAndParents(dirname(aux));
-      free(aux);
-
-      fd = fopen(file_name,mode);
-
-      if(fd != NULL)
-      {
-        fprintf(fd, "%s", str);
-        fclose(fd);
-      }
-      else
-      {
-        VbLogPrint(VB_LOG_ERROR, "Could not open file %s (%s)", file_name, strerror(errno));
-      }
-    }
-    else
-    {
-      VbLogPrint(VB_LOG_ERROR, "No Memory for file %s (%s)", file_name, strerror(errno));
-    }
-  }
-  else
-  {
-    VbLogPrint(VB_LOG_ERROR, "Bad arg (%s)", strerror(errno));
-  }
-}
 #endif
 
 /*******************************************************************/
@@ -481,20 +423,6 @@ static void *VBLogProcess(void *arg)
           }
           break;
         }
-        case VB_LOG_EVENT_SAVETOFILE:
-        {
-          if (vb_log_msg->msg != NULL)
-          {
-            VbLogWriteToFile(vb_log_msg->file_name, vb_log_msg->access_mode, (const char *)vb_log_msg->msg);
-
-            free(vb_log_msg->msg);
-            vb_log_msg->msg = NULL;
-
-            free(vb_log_msg->file_name);
-            vb_log_msg->file_name = NULL;
-          }
-          break;
-        }
         case VB_LOG_EVENT_CLOSE:
         {
           err = -1; // To abort "while" loop and finish thread
@@ -585,9 +513,6 @@ INT32S VbLogInit(const char *queueName, t_vbLogLevel verboseLevel, CHAR *outputF
   vbQueueName               = queueName;
   VbLogStateSet(FALSE);
 
-  strncpy(vbOutputFolder, outputFolder, VB_LOG_FILENAME_LEN+1);
-  vbOutputFolder[VB_LOG_FILENAME_LEN] = '\0';
-
   bzero(&attr, sizeof(attr));
   attr.mq_maxmsg  = 200;
   attr.mq_msgsize = sizeof(t_vbLogMsg);
@@ -638,7 +563,7 @@ BOOLEAN VbLogRun()
   VbLogPrint(VB_LOG_INFO, "Starting %s thread", VB_LOG_THREAD_NAME);
 
   VbLogStateSet(TRUE);
-  return_value = VbThreadCreate(VB_LOG_THREAD_NAME, VBLogProcess, NULL, VB_LOG_THREAD_PRIORITY, &vbLogThread);
+  return_value = VbThreadCreate(VB_LOG_THREAD_NAME, VBLogProcess, NULL, VB_LOG_THREAD_CLASS, &vbLogThread);
 
   if (return_value == FALSE)
   {
@@ -814,10 +739,13 @@ void VbLogSaveToTextFile(const char *file_name, const char *access_mode, int max
 {
 #if (_WITH_SYSLOG_ == 0)
   va_list           args;
-  CHAR             *fn = NULL;
   CHAR             *log_data = NULL;
-  t_vbLogMsg        vb_log_msg;
-  INT16U            file_name_length;
+  BOOLEAN           truncate;
+
+  if ((file_name == NULL) || (access_mode == NULL) || (fmt == NULL) || (strlen(file_name) == 0))
+  {
+    return;
+  }
 
   log_data = (CHAR *)malloc(maxLen);
 
@@ -831,49 +759,13 @@ void VbLogSaveToTextFile(const char *file_name, const char *access_mode, int max
     vsnprintf(log_data, maxLen, fmt, args);
     va_end(args);
 
-    file_name_length = strlen(file_name);
+    // "w" modes overwrite the whole file, "a" modes append data
+    truncate = (access_mode[0] == 'w')? TRUE:FALSE;
 
-    if (file_name_length > 0)
-    {
-      file_name_length += strlen(vbOutputFolder) + 3;
+    // File writer buffers data and writes it to disk asynchronously
+    VbFileWriterWrite(file_name, truncate, log_data, strlen(log_data));
 
-      fn = (CHAR *)calloc(1, file_name_length);
-
-      if (fn == NULL)
-      {
-        VbLogErrorPrint("No memory to allocate fn (%d bytes)", file_name_length);
-        free(log_data);
-      }
-      else
-      {
-        //strncpy(fn, file_name, VB_LOG_FILENAME_LEN+1);
-        snprintf(fn, file_name_length, "%s/%s", vbOutputFolder, file_name);
-
-        bzero(&vb_log_msg, sizeof(vb_log_msg));
-        vb_log_msg.type        = VB_LOG_EVENT_SAVETOFILE;
-        vb_log_msg.msg         = log_data;
-        vb_log_msg.file_name   = fn;
-        vb_log_msg.access_mode = access_mode;
-
-        if (vb_log_msg.msg != NULL)
-        {
-          if(0 != (mq_send(vbLogQueueBlock, ((const char *)(&vb_log_msg)), sizeof(t_vbLogMsg),VB_THREADMSG_PRIORITY)))
-          {
-            free(vb_log_msg.msg);
-            vb_log_msg.msg = NULL;
-
-            free(vb_log_msg.file_name);
-            vb_log_msg.file_name = NULL;
-
-            VbLogErrorPrint("Error posting SAVETODISK msg to Log queue [%s]", strerror(errno));
-          }
-        }
-      }
-    }
-    else
-    {
-      free(log_data);
-    }
+    free(log_data);
   }
 #endif
 }
@@ -887,6 +779,13 @@ t_vbLogLevel VbLogVerboseLevelGet(void)
 
 /*******************************************************************/
 
+void VbLogVerboseLevelSet(t_vbLogLevel verboseLevel)
+{
+  vbLogVerbose = verboseLevel;
+}
+
+/*******************************************************************/
+
 #if (_WITH_SYSLOG_ == 0)
 void VbLogPersistentReset(void)
 {
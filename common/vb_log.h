@@ -117,9 +117,10 @@ static inline CHAR * VbVerboseLevelToStr(t_vbLogLevel verboseLevel)
  * @param[in] verboseLevel    Only messages which are as important as this level
  *                            (or more) will be processed/displayed.
  *
- * @param[in] outputFolder    Messages saved to disk files (using
- *                            "VbLogSaveToTextFile()") will be placed inside this
- *                            folder.
+ * @param[in] outputFolder    Not used. Messages saved to disk files (using
+ *                            "VbLogSaveToTextFile()") are written by the file
+ *                            writer, inside the folder given to
+ *                            "VbFileWriterInit()".
  *
  * @param[in] persLogNumLines Number of lines for persistent log buffer.
  *
@@ -223,6 +224,12 @@ void VbLogSaveToTextFile(const char *file_name, const char *access_mode, int max
  **/
 t_vbLogLevel VbLogVerboseLevelGet(void);
 
+/**
+ * @brief Sets current verbose level
+ * @param[in] verboseLevel New verbose level
+ **/
+void VbLogVerboseLevelSet(t_vbLogLevel verboseLevel);
+
 /**
  * @brief Resets persistent log buffer
  **/
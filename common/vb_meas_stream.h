@@ -0,0 +1,147 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_meas_stream.h
+ * @brief Live measurement stream protocol
+ *
+ * @internal
+ *
+ * The engine streams measurements (CFR, BGN, SNR probes, computed SNR and
+ * capacities) to local subscribers through a UNIX stream socket as they are
+ * produced.
+ *
+ * After connecting, a client sends a @ref t_vbMeasStreamSubscribe request (it
+ * can be sent again at any time to change the filter). From then on the engine
+ * sends a sequence of records, each one made of a @ref t_vbMeasStreamRecordHdr
+ * followed by payloadLen bytes:
+ *  - Measures: numRx blocks of numValues bytes (Rx1 first, then Rx2).
+ *  - Capacity: one @ref t_vbMeasStreamCapacity.
+ *
+ * Every subscriber has its own bounded buffer in the engine. When a client
+ * does not keep up, the oldest records are dropped; drops are visible as gaps
+ * in the seq field. All fields are in host byte order.
+ *
+ **/
+
+#ifndef VB_MEAS_STREAM_H_
+#define VB_MEAS_STREAM_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_types.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_MEAS_STREAM_MAGIC              (0x5642534D) // "VBSM"
+#define VB_MEAS_STREAM_VERSION            (1)
+#define VB_MEAS_STREAM_DEFAULT_SOCKET     "/tmp/vb_engine_meas_stream.sock"
+#define VB_MEAS_STREAM_SOCKET_PATH_MAX    (108)        // sizeof(sun_path)
+#define VB_MEAS_STREAM_ANY_CLUSTER        (-1)
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef enum
+{
+  VB_MEAS_STREAM_TYPE_CFR = 0,
+  VB_MEAS_STREAM_TYPE_BGN,
+  VB_MEAS_STREAM_TYPE_SNR_PROBE,
+  VB_MEAS_STREAM_TYPE_SNR_FULL,
+  VB_MEAS_STREAM_TYPE_SNR_LOW,
+  VB_MEAS_STREAM_TYPE_CAPACITY,
+  VB_MEAS_STREAM_TYPE_LAST,
+} t_vbMeasStreamType;
+
+/// Subscription request (client -> engine)
+typedef struct __attribute__((packed))
+{
+  INT32U  magic;                     ///< VB_MEAS_STREAM_MAGIC
+  INT8U   version;                   ///< VB_MEAS_STREAM_VERSION
+  INT8U   macFilter;                 ///< 1: only records related to mac (as measurer or measured node)
+  INT16U  typesMask;                 ///< Bit per @ref t_vbMeasStreamType. 0: all types
+  INT32S  clusterId;                 ///< VB_MEAS_STREAM_ANY_CLUSTER: all clusters
+  INT8U   mac[ETH_ALEN];
+  INT8U   reserved[2];
+} t_vbMeasStreamSubscribe;
+
+/// Record header (engine -> client)
+typedef struct __attribute__((packed))
+{
+  INT32U  magic;                     ///< VB_MEAS_STREAM_MAGIC
+  INT8U   version;                   ///< VB_MEAS_STREAM_VERSION
+  INT8U   type;                      ///< @ref t_vbMeasStreamType
+  INT8U   numRx;                     ///< Number of reception paths in payload
+  INT8U   errorCode;                 ///< Measure error code
+  INT32U  seq;                       ///< Per subscriber sequence number
+  INT32U  payloadLen;                ///< Bytes following this header
+  INT64U  timestampNs;               ///< Publication time (CLOCK_REALTIME, ns)
+  INT32S  clusterId;
+  INT8U   mac[ETH_ALEN];             ///< Measurer node
+  INT8U   refMac[ETH_ALEN];          ///< CFR: measured node. Zero otherwise
+  INT16U  firstCarrier;
+  INT16U  numValues;                 ///< Values per reception path
+  INT8U   planId;
+  INT8U   spacing;
+  INT8U   mimoInd;
+  INT8U   mimoMeas;
+} t_vbMeasStreamRecordHdr;
+
+/// Capacity record payload
+typedef struct __attribute__((packed))
+{
+  INT32U  maxCapacity;               ///< Mbps
+  INT32U  lowBandCapacity;           ///< Mbps
+  INT16U  firstValidCarrier;
+  INT8U   maxNumBands;
+  INT8U   valid;
+} t_vbMeasStreamCapacity;
+
+#endif /* VB_MEAS_STREAM_H_ */
+
+/**
+ * @}
+ **/
@@ -65,6 +65,7 @@
 #include "vb_log.h"
 #include "vb_thread.h"
 #include "vb_util.h"
+#include "vb_file_writer.h"
 #include "vb_metrics.h"
 #include "vb_console.h"
 #include "vb_priorities.h"
@@ -469,7 +470,7 @@ t_VbMetricsErrorType VbMetricsInit(CHAR *outputPath, CHAR *queueName)
 
     vbMetricsThreadRunning = TRUE;
 
-    if (FALSE == VbThreadCreate(METRICS_THREAD_NAME, VbThreadMetrics, NULL, VB_CONSOLE_THREAD_PRIORITY, &vbMetricsThread))
+    if (FALSE == VbThreadCreate(METRICS_THREAD_NAME, VbThreadMetrics, NULL, VB_METRICS_THREAD_CLASS, &vbMetricsThread))
     {
       res = VB_METRICS_ERROR_MEMORY;
       VbLogPrint(VB_LOG_ERROR,"Can't create %s thread", METRICS_THREAD_NAME);
@@ -1175,7 +1176,7 @@ void VbMetricsDumpReportsToFiles(void)
             strncat(logsFilePath, vbMetricsReportsList[i].file, (VB_ENGINE_METRICS_MAX_PATH_LEN-1));
 
             // Save to file
-            VbLogSaveBufferToTextFile(logsFilePath, "a+", VB_METRICS_OUTPUT_BUFFER_SIZE, buffer); // Append text
+            VbFileWriterWrite(logsFilePath, FALSE, buffer, strnlen(buffer, VB_METRICS_OUTPUT_BUFFER_SIZE)); // Append text
           }
         }
       }
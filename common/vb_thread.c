@@ -50,11 +50,22 @@
  ************************************************************************
  */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <sched.h>
 #include <pthread.h>
 #include <signal.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <errno.h>
 #include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/resource.h>
 
 #include "types.h"
 #include "vb_thread.h"
@@ -75,8 +86,11 @@
 #define SIGNAL_ABORT                  (SIGINT)             // Used to cancel execution (Ctrl+C)
 #define SIGNAL_TIMER                  (TIMER_SIGNAL_NUM)   // Used to wake up after a timer expiration
 #define SIGNAL_WAKE_UP                (SIGUSR1)            // Used to wake up during a sleep
+#define SIGNAL_RELOAD                 (SIGHUP)             // Used to request a configuration reload
 #define THREAD_MAX_NUM                (50)
 #define THREAD_NAME_LEN               (30)
+#define THREAD_PLACEMENT_MAX_NUM      (256)                // Running threads (several threads may share a name)
+#define THREAD_CGROUP_THREADS_FILE    ("cgroup.threads")
 
 /*
  ************************************************************************
@@ -91,6 +105,34 @@ typedef struct
   BOOLEAN used;
 } t_threadListEntry;
 
+typedef struct
+{
+  CHAR             name[THREAD_NAME_LEN];
+  pthread_t        thread;
+  pid_t            tid;
+  t_vbThreadClass  threadClass;
+  BOOLEAN          used;
+} t_threadPlacementEntry;
+
+/// Placement of a running thread, printed once the mutex is released
+typedef struct
+{
+  CHAR             name[THREAD_NAME_LEN];
+  pid_t            tid;
+  t_vbThreadClass  threadClass;
+  const CHAR      *policyStr;
+  INT32S           priority;
+  CHAR             cpus[VB_THREAD_CPU_LIST_LEN];
+} t_threadPlacementSnapshot;
+
+typedef struct
+{
+  void           *(*f)(void *);
+  void            *arg;
+  t_vbThreadClass  threadClass;
+  CHAR             name[THREAD_NAME_LEN];
+} t_threadStartArgs;
+
 /*
  ************************************************************************
  ** Private variables
@@ -101,6 +143,11 @@ static BOOL                    vbSignalProcThreadRunning = FALSE;
 static pthread_t               vbSignalHandlerThread;
 static t_threadListEntry       vbThreadList[THREAD_MAX_NUM];
 static pthread_mutex_t         vbThreadListMutex;
+static t_threadPlacementEntry  vbThreadPlacementList[THREAD_PLACEMENT_MAX_NUM];
+static t_vbThreadPlacementConf vbThreadPlacementConf;
+static cpu_set_t               vbThreadClassCpus[VB_THREAD_CLASS_LAST];
+static cpu_set_t               vbThreadProcessCpus;
+static pthread_mutex_t         vbThreadPlacementMutex = PTHREAD_MUTEX_INITIALIZER;
 
 /*
  ************************************************************************
@@ -185,6 +232,7 @@ static void *signals_processing_thread(void *p)
 
   sigemptyset(&sigs_to_catch);  
   sigaddset(&sigs_to_catch, SIGNAL_ABORT);
+  sigaddset(&sigs_to_catch, SIGNAL_RELOAD);
 
   while (VbSignalHandlerStateGet() == TRUE)
   {  
@@ -200,6 +248,12 @@ static void *signals_processing_thread(void *p)
           f_callback(SIGNAL_ABORT);
           break;
         }
+        case SIGNAL_RELOAD:
+        {
+          VbLogPrint(VB_LOG_INFO, "Signal SIGHUP received!!");
+          f_callback(SIGNAL_RELOAD);
+          break;
+        }
         default:
         {
           VbLogPrint(VB_LOG_INFO, "ERROR!!! It is impossible to reach this point!");
@@ -307,6 +361,432 @@ static void VbThreadListThreadStop(const CHAR *name)
 
 /*******************************************************************/
 
+/**
+ * @brief Parses a CPU list ("0-1,3")
+ * @param[in] cpuList CPU list. An empty list gives an empty CPU set
+ * @param[out] cpuSet Parsed CPU set
+ * @return 0 if OK; -1 otherwise
+ **/
+static INT32S VbThreadCpuListParse(const CHAR *cpuList, cpu_set_t *cpuSet)
+{
+  INT32S         ret = 0;
+  const CHAR    *ptr = cpuList;
+  CHAR          *end;
+  unsigned long  first;
+  unsigned long  last;
+  unsigned long  cpu;
+
+  CPU_ZERO(cpuSet);
+
+  if (cpuList == NULL)
+  {
+    ret = -1;
+  }
+
+  while ((ret == 0) && (*ptr != '\0'))
+  {
+    if ((isspace((unsigned char)*ptr) != 0) || (*ptr == ','))
+    {
+      ptr++;
+    }
+    else if (isdigit((unsigned char)*ptr) == 0)
+    {
+      ret = -1;
+    }
+    else
+    {
+      first = strtoul(ptr, &end, 10);
+      last = first;
+      ptr = end;
+
+      if (*ptr == '-')
+      {
+        ptr++;
+
+        if (isdigit((unsigned char)*ptr) == 0)
+        {
+          ret = -1;
+        }
+        else
+        {
+          last = strtoul(ptr, &end, 10);
+          ptr = end;
+        }
+      }
+
+      if ((ret == 0) && ((last < first) || (last >= CPU_SETSIZE)))
+      {
+        ret = -1;
+      }
+
+      if ((ret == 0) && (*ptr != '\0') && (*ptr != ',') && (isspace((unsigned char)*ptr) == 0))
+      {
+        ret = -1;
+      }
+
+      for (cpu = first; (ret == 0) && (cpu <= last); cpu++)
+      {
+        CPU_SET(cpu, cpuSet);
+      }
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Builds a CPU list ("0-1,3") from a CPU set
+ * @param[in] cpuSet CPU set
+ * @param[out] str Output string
+ * @param[in] len Output string length
+ **/
+static void VbThreadCpuSetToStr(const cpu_set_t *cpuSet, CHAR *str, INT32U len)
+{
+  INT32U cpu;
+  INT32U first;
+  INT32U used = 0;
+
+  str[0] = '\0';
+
+  for (cpu = 0; (cpu < CPU_SETSIZE) && (used < len); cpu++)
+  {
+    if (CPU_ISSET(cpu, cpuSet))
+    {
+      first = cpu;
+
+      while (((cpu + 1) < CPU_SETSIZE) && CPU_ISSET(cpu + 1, cpuSet))
+      {
+        cpu++;
+      }
+
+      if (first == cpu)
+      {
+        used += snprintf(str + used, len - used, "%s%u", (used > 0)?",":"", cpu);
+      }
+      else
+      {
+        used += snprintf(str + used, len - used, "%s%u-%u", (used > 0)?",":"", first, cpu);
+      }
+    }
+  }
+
+  if (str[0] == '\0')
+  {
+    snprintf(str, len, "-");
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Moves a thread to the given threaded cgroup v2
+ * @param[in] cgroup cgroup directory
+ * @param[in] tid Kernel thread id
+ * @return 0 if OK; -1 otherwise
+ **/
+static INT32S VbThreadCgroupAttach(const CHAR *cgroup, pid_t tid)
+{
+  INT32S  ret = 0;
+  CHAR    path[VB_THREAD_CGROUP_PATH_LEN + sizeof(THREAD_CGROUP_THREADS_FILE) + 1];
+  FILE   *fp;
+
+  snprintf(path, sizeof(path), "%s/%s", cgroup, THREAD_CGROUP_THREADS_FILE);
+
+  fp = fopen(path, "w");
+
+  if (fp == NULL)
+  {
+    ret = -1;
+  }
+  else
+  {
+    // Buffered write errors are reported when closing the file
+    if (fprintf(fp, "%d\n", (int)tid) < 0)
+    {
+      ret = -1;
+    }
+
+    if (fclose(fp) != 0)
+    {
+      ret = -1;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Applies the placement of its class to a thread. Shall be called with vbThreadPlacementMutex locked.
+ * When placement is disabled, the thread is moved back to the CPUs the process started with and to SCHED_OTHER.
+ * @param[in] entry Thread placement entry
+ * @return 0 if OK; -1 if some setting could not be applied
+ **/
+static INT32S VbThreadPlacementApply(const t_threadPlacementEntry *entry)
+{
+  INT32S                      ret = 0;
+  int                         err;
+  int                         policy = SCHED_OTHER;
+  int                         prio;
+  struct sched_param          param;
+  t_vbThreadClassConf         neutral;
+  const t_vbThreadClassConf  *class_conf = &neutral;
+  const cpu_set_t            *cpus = &vbThreadProcessCpus;
+
+  memset(&neutral, 0, sizeof(neutral));
+
+  if ((vbThreadPlacementConf.enable == TRUE) && (entry->threadClass < VB_THREAD_CLASS_LAST))
+  {
+    class_conf = &(vbThreadPlacementConf.classes[entry->threadClass]);
+
+    if (CPU_COUNT(&(vbThreadClassCpus[entry->threadClass])) > 0)
+    {
+      cpus = &(vbThreadClassCpus[entry->threadClass]);
+    }
+  }
+
+  // CPU set is always set explicitly, otherwise threads would inherit the affinity of their creator
+  err = pthread_setaffinity_np(entry->thread, sizeof(cpu_set_t), cpus);
+
+  if (err != 0)
+  {
+    VbLogPrint(VB_LOG_WARNING, "Error %d (%s) setting CPU affinity of thread %s", err, strerror(err), entry->name);
+    ret = -1;
+  }
+
+  if (class_conf->policy == VB_THREAD_POLICY_FIFO)
+  {
+    policy = SCHED_FIFO;
+  }
+  else if (class_conf->policy == VB_THREAD_POLICY_RR)
+  {
+    policy = SCHED_RR;
+  }
+
+  param.sched_priority = 0;
+
+  if (policy != SCHED_OTHER)
+  {
+    prio = (int)MAX(class_conf->priority, 1) + sched_get_priority_min(policy) - 1;
+    param.sched_priority = MIN(prio, sched_get_priority_max(policy));
+  }
+
+  err = pthread_setschedparam(entry->thread, policy, &param);
+
+  if (err != 0)
+  {
+    VbLogPrint(VB_LOG_WARNING, "Error %d (%s) setting %s policy of thread %s", err, strerror(err),
+        VbThreadPolicyToStr(class_conf->policy), entry->name);
+    ret = -1;
+  }
+
+  if ((policy == SCHED_OTHER) && (setpriority(PRIO_PROCESS, entry->tid, class_conf->nice) != 0))
+  {
+    VbLogPrint(VB_LOG_WARNING, "Error %d (%s) setting nice %d of thread %s", errno, strerror(errno), class_conf->nice, entry->name);
+    ret = -1;
+  }
+
+  if ((class_conf->cgroup[0] != '\0') && (VbThreadCgroupAttach(class_conf->cgroup, entry->tid) != 0))
+  {
+    VbLogPrint(VB_LOG_WARNING, "Error %d (%s) moving thread %s to cgroup %s", errno, strerror(errno), entry->name, class_conf->cgroup);
+    ret = -1;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Registers the calling thread in the placement list and applies the placement of its class.
+ * @param[in] name Thread name
+ * @param[in] threadClass Thread class
+ * @param[out] idx Index in placement list; -1 if list is full
+ * @return 0 if OK; -1 otherwise
+ **/
+static INT32S VbThreadPlacementRegister(const CHAR *name, t_vbThreadClass threadClass, INT32S *idx)
+{
+  INT32S ret = -1;
+  INT32U i;
+
+  *idx = -1;
+
+  pthread_mutex_lock(&vbThreadPlacementMutex);
+
+  for (i = 0; i < THREAD_PLACEMENT_MAX_NUM; i++)
+  {
+    if (vbThreadPlacementList[i].used == FALSE)
+    {
+      vbThreadPlacementList[i].used = TRUE;
+      vbThreadPlacementList[i].thread = pthread_self();
+      vbThreadPlacementList[i].tid = (pid_t)syscall(SYS_gettid);
+      vbThreadPlacementList[i].threadClass = threadClass;
+      strncpy(vbThreadPlacementList[i].name, (name != NULL)?name:THREAD_UNKNOWN_NAME, THREAD_NAME_LEN);
+      vbThreadPlacementList[i].name[THREAD_NAME_LEN - 1] = '\0';
+      *idx = i;
+      ret = 0;
+
+      if (vbThreadPlacementConf.enable == TRUE)
+      {
+        ret = VbThreadPlacementApply(&(vbThreadPlacementList[i]));
+      }
+
+      break;
+    }
+  }
+
+  pthread_mutex_unlock(&vbThreadPlacementMutex);
+
+  if (*idx < 0)
+  {
+    VbLogPrint(VB_LOG_WARNING, "Thread placement list full, thread %s not placed", (name != NULL)?name:THREAD_UNKNOWN_NAME);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Removes a thread from the placement list
+ * @param[in] idx Index in placement list, as returned by @ref VbThreadPlacementRegister
+ **/
+static void VbThreadPlacementUnregister(INT32S idx)
+{
+  if ((idx >= 0) && (idx < THREAD_PLACEMENT_MAX_NUM))
+  {
+    pthread_mutex_lock(&vbThreadPlacementMutex);
+    vbThreadPlacementList[idx].used = FALSE;
+    pthread_mutex_unlock(&vbThreadPlacementMutex);
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Entry point of all threads created by @ref VbThreadCreate.
+ * Places the thread in its class before running the thread function.
+ * @param[in] p Start arguments (t_threadStartArgs), released here
+ **/
+static void *VbThreadStart(void *p)
+{
+  t_threadStartArgs  start = *(t_threadStartArgs *)p;
+  INT32S             idx;
+  void              *ret;
+
+  free(p);
+
+  VbThreadPlacementRegister(start.name, start.threadClass, &idx);
+
+  ret = start.f(start.arg);
+
+  VbThreadPlacementUnregister(idx);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Dumps the thread placement configuration and the running threads placement.
+ * Placement is read under vbThreadPlacementMutex and printed after releasing it,
+ * so a slow console client does not hold thread creation.
+ * @param[in] writeFun Callback used to print
+ **/
+static void VbThreadPlacementDump(t_writeFun writeFun)
+{
+  INT32U                      i;
+  INT32U                      num_thr = 0;
+  int                         policy;
+  struct sched_param          param;
+  cpu_set_t                   cpus;
+  t_vbThreadPlacementConf     conf;
+  t_threadPlacementSnapshot  *threads;
+
+  threads = (t_threadPlacementSnapshot *)malloc(THREAD_PLACEMENT_MAX_NUM * sizeof(t_threadPlacementSnapshot));
+
+  pthread_mutex_lock(&vbThreadPlacementMutex);
+
+  conf = vbThreadPlacementConf;
+
+  for (i = 0; (threads != NULL) && (i < THREAD_PLACEMENT_MAX_NUM); i++)
+  {
+    if (vbThreadPlacementList[i].used == TRUE)
+    {
+      t_threadPlacementSnapshot *thr = &threads[num_thr];
+
+      // Registered threads are alive while the mutex is held
+      memcpy(thr->name, vbThreadPlacementList[i].name, sizeof(thr->name));
+      thr->tid = vbThreadPlacementList[i].tid;
+      thr->threadClass = vbThreadPlacementList[i].threadClass;
+      thr->policyStr = "--";
+      thr->priority = 0;
+      thr->cpus[0] = '\0';
+
+      if (pthread_getschedparam(vbThreadPlacementList[i].thread, &policy, &param) == 0)
+      {
+        thr->policyStr = (policy == SCHED_FIFO)?"FIFO":(policy == SCHED_RR)?"RR":"OTHER";
+        thr->priority = param.sched_priority;
+      }
+
+      if (pthread_getaffinity_np(vbThreadPlacementList[i].thread, sizeof(cpus), &cpus) == 0)
+      {
+        VbThreadCpuSetToStr(&cpus, thr->cpus, sizeof(thr->cpus));
+      }
+
+      num_thr++;
+    }
+  }
+
+  pthread_mutex_unlock(&vbThreadPlacementMutex);
+
+  writeFun("\nThread placement : %s\n", (conf.enable == TRUE)?"Enabled":"Disabled");
+  writeFun("==================================================================================\n");
+  writeFun("|   Class    |       CPUs       | Policy | Prio | Nice |          cgroup          |\n");
+  writeFun("==================================================================================\n");
+
+  for (i = 0; i < VB_THREAD_CLASS_LAST; i++)
+  {
+    const t_vbThreadClassConf *class_conf = &(conf.classes[i]);
+
+    writeFun("| %-10s | %-16s | %-6s | %4u | %4d | %-24s |\n",
+        VbThreadClassToStr(i),
+        (class_conf->cpus[0] != '\0')?class_conf->cpus:"all",
+        VbThreadPolicyToStr(class_conf->policy),
+        class_conf->priority,
+        class_conf->nice,
+        (class_conf->cgroup[0] != '\0')?class_conf->cgroup:"-");
+  }
+
+  writeFun("==================================================================================\n");
+
+  writeFun("\nRunning threads (current kernel state):\n");
+  writeFun("===========================================================================\n");
+  writeFun("|            Name              |   TID   |   Class    |  Policy  | CPUs\n");
+  writeFun("===========================================================================\n");
+
+  for (i = 0; i < num_thr; i++)
+  {
+    writeFun("|%-30s| %7d | %-10s | %-5s%3d | %s\n",
+        threads[i].name,
+        (int)threads[i].tid,
+        VbThreadClassToStr(threads[i].threadClass),
+        threads[i].policyStr,
+        threads[i].priority,
+        threads[i].cpus);
+  }
+
+  writeFun("===========================================================================\n");
+  writeFun("Number of placed threads : %u\n", num_thr);
+
+  free(threads);
+}
+
+/*******************************************************************/
+
 /*
  * clock_nanosleep feature is not provided by ARMV7 and MIPS toolchains,
  * so, it is implemented here.
@@ -423,6 +903,12 @@ BOOLEAN VbBlockSignals(void)
     return FALSE;
   }
 
+  if (sigaddset(&mask, SIGNAL_RELOAD) == -1)
+  {
+    printf("Can't add mask! [%s]", strerror(errno));
+    return FALSE;
+  }
+
   if (pthread_sigmask(SIG_BLOCK, &mask, NULL) < 0)
   {
     printf("Could not modify signals mask! [%s]", strerror(errno));
@@ -659,9 +1145,34 @@ INT32S VbThreadCondWakeUp(pthread_mutex_t *mutex, pthread_cond_t  *cond)
 
 INT32S VbThreadInit(void)
 {
+  INT32U i;
+  long   num_cpus;
+
   pthread_mutex_init(&vbThreadListMutex, NULL);
   memset(vbThreadList, 0, sizeof(vbThreadList));
 
+  pthread_mutex_lock(&vbThreadPlacementMutex);
+  memset(vbThreadPlacementList, 0, sizeof(vbThreadPlacementList));
+  memset(&vbThreadPlacementConf, 0, sizeof(vbThreadPlacementConf));
+
+  for (i = 0; i < VB_THREAD_CLASS_LAST; i++)
+  {
+    CPU_ZERO(&(vbThreadClassCpus[i]));
+  }
+
+  // CPUs the process started with (e.g. restricted by taskset) are used by classes with no CPU list
+  if (sched_getaffinity(0, sizeof(vbThreadProcessCpus), &vbThreadProcessCpus) != 0)
+  {
+    CPU_ZERO(&vbThreadProcessCpus);
+    num_cpus = sysconf(_SC_NPROCESSORS_CONF);
+
+    for (i = 0; (num_cpus > 0) && (i < (INT32U)num_cpus) && (i < CPU_SETSIZE); i++)
+    {
+      CPU_SET(i, &vbThreadProcessCpus);
+    }
+  }
+  pthread_mutex_unlock(&vbThreadPlacementMutex);
+
   return 0;
 }
 
@@ -677,7 +1188,7 @@ BOOLEAN VbThreadHandleSignalsStart(void (*f)(INT32U signum))
 
   VbSignalHandlerStateSet(TRUE);
 
-  running = VbThreadCreate(SIGNAL_HANDLER_THREAD_NAME, signals_processing_thread, f, VB_SIGNALS_PROCESSING_PRIORITY, &vbSignalHandlerThread);
+  running = VbThreadCreate(SIGNAL_HANDLER_THREAD_NAME, signals_processing_thread, f, VB_SIGNALS_PROCESSING_CLASS, &vbSignalHandlerThread);
 
   if (running == FALSE)
   {
@@ -710,11 +1221,11 @@ void VbThreadHandleSignalsStop(void)
 
 /*******************************************************************/
 
-BOOLEAN VbThreadCreate(const CHAR *name, void *(*f)(void *), void *f_arg, int prio, pthread_t *thread_id)
+BOOLEAN VbThreadCreate(const CHAR *name, void *(*f)(void *), void *f_arg, t_vbThreadClass threadClass, pthread_t *thread_id)
 {
-  int err = 0;
-  pthread_attr_t tattr;
-  struct sched_param param;
+  int                 err = 0;
+  pthread_attr_t      tattr;
+  t_threadStartArgs  *start;
 
   *thread_id = 0;
 
@@ -727,48 +1238,34 @@ BOOLEAN VbThreadCreate(const CHAR *name, void *(*f)(void *), void *f_arg, int pr
     return FALSE;
   }
 
-  // All threads with a priority greater than "0" will be configured with a
-  // "real-time" SCHED_FIFO scheduler policy.
+  // CPU set, scheduling policy and cgroup of the thread class are applied by the
+  // new thread itself (VbThreadStart()) before running f(), as the cgroup placement
+  // needs the kernel thread id.
   //
-  if (prio != 0)
+  start = (t_threadStartArgs *)malloc(sizeof(t_threadStartArgs));
+  if (start == NULL)
   {
-    err = pthread_attr_setschedpolicy(&tattr, SCHED_FIFO);
-    if (err != 0)
-    {
-      VbLogPrint( VB_LOG_ERROR,"Error in pthread_attr_setschedpolicy() [0x%08p] (err %d)", f, err);
-
-      pthread_attr_destroy(&tattr);
-      return FALSE;
-    }
-
-    prio = prio + sched_get_priority_min(SCHED_FIFO)-1;
-    if (prio > sched_get_priority_max(SCHED_FIFO))
-    {
-      prio = sched_get_priority_max(SCHED_FIFO);
-    }
-
-    param.sched_priority = prio;
-    VbLogPrint( VB_LOG_INFO,"PRIO: %d", prio);
-
-    err = pthread_attr_setschedparam(&tattr, &param);
-    if (err != 0)
-    {
-      VbLogPrint( VB_LOG_ERROR,"Error in pthread_attr_setschedparam() [0x%08p] (err %d)", f, err);
-
-      pthread_attr_destroy(&tattr);
-      return FALSE;
-    }
+    VbLogPrint( VB_LOG_ERROR,"Error allocating thread start arguments [0x%08p]", f);
+    pthread_attr_destroy(&tattr);
+    return FALSE;
   }
 
+  start->f = f;
+  start->arg = f_arg;
+  start->threadClass = threadClass;
+  strncpy(start->name, (name != NULL)?name:THREAD_UNKNOWN_NAME, THREAD_NAME_LEN);
+  start->name[THREAD_NAME_LEN - 1] = '\0';
+
   // Adds thread name to list, for debug purposes
   VbThreadListThreadStart(name);
 
   // Here we go...
   //
-  err = pthread_create(thread_id, &tattr, f, f_arg);
+  err = pthread_create(thread_id, &tattr, VbThreadStart, start);
   if (err != 0)
   {
     VbLogPrint( VB_LOG_ERROR,"Error in pthread_create() [0x%08p] (err %d)", f, err);
+    free(start);
     pthread_attr_destroy(&tattr);
     return FALSE;
   }
@@ -829,6 +1326,284 @@ void VbThreadListThreadDump(t_writeFun writeFun)
 
 /*******************************************************************/
 
+INT32S VbThreadClassSelfAttach(const CHAR *name, t_vbThreadClass threadClass)
+{
+  INT32S idx;
+
+  return VbThreadPlacementRegister(name, threadClass, &idx);
+}
+
+/*******************************************************************/
+
+INT32S VbThreadClassConfCheck(const t_vbThreadClassConf *conf)
+{
+  INT32S    ret = 0;
+  cpu_set_t cpus;
+
+  if (conf == NULL)
+  {
+    ret = -1;
+  }
+
+  if ((ret == 0) && (VbThreadCpuListParse(conf->cpus, &cpus) != 0))
+  {
+    ret = -1;
+  }
+
+  if ((ret == 0) && (conf->policy >= VB_THREAD_POLICY_LAST))
+  {
+    ret = -1;
+  }
+
+  if ((ret == 0) && (conf->policy != VB_THREAD_POLICY_OTHER) &&
+      ((conf->priority < 1) || (conf->priority > (INT32U)(sched_get_priority_max(SCHED_FIFO) - sched_get_priority_min(SCHED_FIFO) + 1))))
+  {
+    ret = -1;
+  }
+
+  if ((ret == 0) && ((conf->nice < VB_THREAD_NICE_MIN) || (conf->nice > VB_THREAD_NICE_MAX)))
+  {
+    ret = -1;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+INT32S VbThreadPlacementConfSet(const t_vbThreadPlacementConf *conf)
+{
+  INT32S ret = 0;
+  INT32U num_err = 0;
+  INT32U i;
+
+  if (conf == NULL)
+  {
+    ret = -1;
+  }
+
+  for (i = 0; (ret == 0) && (i < VB_THREAD_CLASS_LAST); i++)
+  {
+    if (VbThreadClassConfCheck(&(conf->classes[i])) != 0)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Invalid placement of thread class %s", VbThreadClassToStr(i));
+      ret = -1;
+    }
+  }
+
+  if (ret == 0)
+  {
+    pthread_mutex_lock(&vbThreadPlacementMutex);
+
+    vbThreadPlacementConf = *conf;
+
+    for (i = 0; i < VB_THREAD_CLASS_LAST; i++)
+    {
+      VbThreadCpuListParse(vbThreadPlacementConf.classes[i].cpus, &(vbThreadClassCpus[i]));
+    }
+
+    // Running threads are moved too; when disabling, they go back to the default placement
+    for (i = 0; i < THREAD_PLACEMENT_MAX_NUM; i++)
+    {
+      if ((vbThreadPlacementList[i].used == TRUE) &&
+          (VbThreadPlacementApply(&(vbThreadPlacementList[i])) != 0))
+      {
+        num_err++;
+      }
+    }
+
+    pthread_mutex_unlock(&vbThreadPlacementMutex);
+
+    if (num_err > 0)
+    {
+      VbLogPrint(VB_LOG_WARNING, "Thread placement could not be fully applied to %u threads", num_err);
+      ret = -1;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbThreadPlacementConfGet(t_vbThreadPlacementConf *conf)
+{
+  if (conf != NULL)
+  {
+    pthread_mutex_lock(&vbThreadPlacementMutex);
+    *conf = vbThreadPlacementConf;
+    pthread_mutex_unlock(&vbThreadPlacementMutex);
+  }
+}
+
+/*******************************************************************/
+
+t_vbThreadClass VbThreadClassStrToEnum(const CHAR *str)
+{
+  t_vbThreadClass ret = VB_THREAD_CLASS_LAST;
+  INT32U          i;
+
+  for (i = 0; (str != NULL) && (i < VB_THREAD_CLASS_LAST); i++)
+  {
+    if (strcasecmp(str, VbThreadClassToStr(i)) == 0)
+    {
+      ret = i;
+      break;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_vbThreadPolicy VbThreadPolicyStrToEnum(const CHAR *str)
+{
+  t_vbThreadPolicy ret = VB_THREAD_POLICY_LAST;
+  INT32U           i;
+
+  for (i = 0; (str != NULL) && (i < VB_THREAD_POLICY_LAST); i++)
+  {
+    if (strcasecmp(str, VbThreadPolicyToStr(i)) == 0)
+    {
+      ret = i;
+      break;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOL VbThreadConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  BOOL                     ret = FALSE;
+  BOOL                     show_help = FALSE;
+  BOOL                     conf_changed = FALSE;
+  t_vbThreadPlacementConf  conf;
+  t_vbThreadClass          thr_class = VB_THREAD_CLASS_LAST;
+  t_vbThreadClassConf     *class_conf = NULL;
+  INT32U                   i;
+
+  VbThreadPlacementConfGet(&conf);
+
+  if ((cmd[1] != NULL) && (cmd[2] != NULL))
+  {
+    thr_class = VbThreadClassStrToEnum(cmd[2]);
+
+    if (thr_class < VB_THREAD_CLASS_LAST)
+    {
+      class_conf = &(conf.classes[thr_class]);
+    }
+  }
+
+  if (cmd[1] == NULL)
+  {
+    VbThreadPlacementDump(writeFun);
+    ret = TRUE;
+  }
+  else if (!strcmp(cmd[1], "h"))
+  {
+    show_help = TRUE;
+    ret = TRUE;
+  }
+  else if ((!strcmp(cmd[1], "on")) || (!strcmp(cmd[1], "off")))
+  {
+    conf.enable = (!strcmp(cmd[1], "on"))?TRUE:FALSE;
+    conf_changed = TRUE;
+    ret = TRUE;
+  }
+  else if ((!strcmp(cmd[1], "cpus")) && (class_conf != NULL) && (cmd[3] != NULL))
+  {
+    snprintf(class_conf->cpus, sizeof(class_conf->cpus), "%s", (!strcmp(cmd[3], "all"))?"":cmd[3]);
+    conf_changed = TRUE;
+    ret = TRUE;
+  }
+  else if ((!strcmp(cmd[1], "policy")) && (class_conf != NULL) && (cmd[3] != NULL))
+  {
+    class_conf->policy = VbThreadPolicyStrToEnum(cmd[3]);
+
+    if (cmd[4] != NULL)
+    {
+      class_conf->priority = strtoul(cmd[4], NULL, 0);
+    }
+
+    conf_changed = TRUE;
+    ret = TRUE;
+  }
+  else if ((!strcmp(cmd[1], "nice")) && (class_conf != NULL) && (cmd[3] != NULL))
+  {
+    class_conf->nice = strtol(cmd[3], NULL, 0);
+    conf_changed = TRUE;
+    ret = TRUE;
+  }
+  else if ((!strcmp(cmd[1], "cgroup")) && (class_conf != NULL) && (cmd[3] != NULL))
+  {
+    snprintf(class_conf->cgroup, sizeof(class_conf->cgroup), "%s", (!strcmp(cmd[3], "none"))?"":cmd[3]);
+    conf_changed = TRUE;
+    ret = TRUE;
+  }
+  else if ((!strcmp(cmd[1], "move")) && (cmd[2] != NULL) && (cmd[3] != NULL))
+  {
+    pid_t tid = (pid_t)strtol(cmd[2], NULL, 0);
+
+    thr_class = VbThreadClassStrToEnum(cmd[3]);
+
+    if (thr_class < VB_THREAD_CLASS_LAST)
+    {
+      pthread_mutex_lock(&vbThreadPlacementMutex);
+
+      for (i = 0; i < THREAD_PLACEMENT_MAX_NUM; i++)
+      {
+        if ((vbThreadPlacementList[i].used == TRUE) && (vbThreadPlacementList[i].tid == tid))
+        {
+          vbThreadPlacementList[i].threadClass = thr_class;
+          VbThreadPlacementApply(&(vbThreadPlacementList[i]));
+          ret = TRUE;
+          break;
+        }
+      }
+
+      pthread_mutex_unlock(&vbThreadPlacementMutex);
+
+      writeFun("Thread %d %s\n", (int)tid, (ret == TRUE)?"moved":"not found");
+      ret = TRUE;
+    }
+  }
+
+  if (conf_changed == TRUE)
+  {
+    // Runtime change, applied to all running threads (not saved to .ini file)
+    if (VbThreadPlacementConfSet(&conf) == 0)
+    {
+      writeFun("Thread placement updated\n");
+    }
+    else
+    {
+      writeFun("Thread placement not valid or not fully applied (check log)\n");
+    }
+  }
+
+  if ((ret == FALSE) || (show_help == TRUE))
+  {
+    writeFun("Usage:\n");
+    writeFun("threads h                                 : Shows this help\n");
+    writeFun("threads                                   : Dumps thread classes and running threads placement\n");
+    writeFun("threads on|off                            : Enables / disables thread placement\n");
+    writeFun("threads cpus <class> <list|all>           : Sets CPU list of a class (e.g. 0-1,3)\n");
+    writeFun("threads policy <class> <OTHER|FIFO|RR> [prio] : Sets scheduling policy of a class\n");
+    writeFun("threads nice <class> <nice>               : Sets nice value of a class (OTHER policy)\n");
+    writeFun("threads cgroup <class> <path|none>        : Sets threaded cgroup v2 of a class\n");
+    writeFun("threads move <tid> <class>                : Moves a running thread to another class\n");
+    writeFun("Classes: fsm, io, compute, background\n");
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
 /**
  * @}
 **/
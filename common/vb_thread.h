@@ -61,12 +61,53 @@
  ************************************************************************
  */
 
+#define VB_THREAD_CPU_LIST_LEN         (64)
+#define VB_THREAD_CGROUP_PATH_LEN      (128)
+#define VB_THREAD_NICE_MIN             (-20)
+#define VB_THREAD_NICE_MAX             (19)
+
 /*
  ************************************************************************
  ** Public type definitions
  ************************************************************************
  */
 
+/**
+ * @brief Thread classes. Every thread is created in one class and all the threads
+ * of a class share the same CPU set, scheduling policy and cgroup.
+ **/
+typedef enum
+{
+  VB_THREAD_CLASS_FSM = 0,      ///< Event processing (latency critical)
+  VB_THREAD_CLASS_IO,           ///< Socket and LCMP readers
+  VB_THREAD_CLASS_COMPUTE,      ///< Bulk computation (SNR, measures)
+  VB_THREAD_CLASS_BACKGROUND,   ///< Console, log, file writer, ...
+  VB_THREAD_CLASS_LAST,
+} t_vbThreadClass;
+
+typedef enum
+{
+  VB_THREAD_POLICY_OTHER = 0,
+  VB_THREAD_POLICY_FIFO,
+  VB_THREAD_POLICY_RR,
+  VB_THREAD_POLICY_LAST,
+} t_vbThreadPolicy;
+
+typedef struct s_vbThreadClassConf
+{
+  CHAR              cpus[VB_THREAD_CPU_LIST_LEN];       ///< CPU list ("0-1,3"); empty means all the CPUs the process started with
+  t_vbThreadPolicy  policy;                             ///< Scheduling policy
+  INT32U            priority;                           ///< Real-time priority (1 = lowest); only used by FIFO and RR
+  INT32S            nice;                               ///< Nice value; only used by OTHER
+  CHAR              cgroup[VB_THREAD_CGROUP_PATH_LEN];  ///< Threaded cgroup v2 directory; empty means no cgroup placement
+} t_vbThreadClassConf;
+
+typedef struct s_vbThreadPlacementConf
+{
+  BOOLEAN             enable;
+  t_vbThreadClassConf classes[VB_THREAD_CLASS_LAST];
+} t_vbThreadPlacementConf;
+
 
 /*
  ************************************************************************
@@ -148,18 +189,12 @@ void VbThreadHandleSignalsStop(void);
  *
  * @param[in] f_arg  Argument passed to f() when called at creation time.
  *
- * @param[in] prio   Thread priority. It works like this:
- *                   - If set to "0", the thread will be configured with the
- *                     default scheduler policy (ie. "SCHED_OTHER"). This means
- *                     it will share CPU with the rest of "normal" processes on
- *                     the system.
- *                   - If set to a value bigger than "0", the thread will be
- *                     configured with a SCHED_FIFO scheduler policy. This is a
- *                     "real-time" policy (meaning it takes precedence over all
- *                     other "normal" processes on the system) that causes the
- *                     thread to execute until it has nothing else to do or is
- *                     interrupted by another SCHED_FIFO thread with a higher
- *                     priority number.
+ * @param[in] threadClass  Thread class. When thread placement is enabled
+ *                         (see @ref VbThreadPlacementConfSet) the new thread is
+ *                         moved to the CPU set, scheduling policy and cgroup
+ *                         configured for its class before running f().
+ *                         Otherwise it shares CPU with the rest of "normal"
+ *                         processes on the system.
  *
  * @param[out] thread_id  Thread ID which can be used to later identify the
  *                        just created thread.
@@ -167,7 +202,7 @@ void VbThreadHandleSignalsStop(void);
  * @return TRUE if the new thread could be created without problems.
  *         FALSE otherwise.
  **/
-BOOLEAN VbThreadCreate(const CHAR *name, void *(*f)(void *), void *f_arg, int prio, pthread_t *thread_id);
+BOOLEAN VbThreadCreate(const CHAR *name, void *(*f)(void *), void *f_arg, t_vbThreadClass threadClass, pthread_t *thread_id);
 
 /**
  * @brief Waits for given thread to finish.
@@ -234,6 +269,93 @@ INT32S VbThreadCondWakeUp(pthread_mutex_t *mutex, pthread_cond_t  *cond);
  **/
 void VbThreadListThreadDump(t_writeFun writeFun);
 
+/**
+ * @brief Places the calling thread (not created by @ref VbThreadCreate, e.g. main thread) in a thread class
+ * @param[in] name Thread name
+ * @param[in] threadClass Thread class
+ * @return 0 if OK; -1 otherwise
+ **/
+INT32S VbThreadClassSelfAttach(const CHAR *name, t_vbThreadClass threadClass);
+
+/**
+ * @brief Checks a thread class configuration
+ * @param[in] conf Thread class configuration
+ * @return 0 if OK; -1 otherwise
+ **/
+INT32S VbThreadClassConfCheck(const t_vbThreadClassConf *conf);
+
+/**
+ * @brief Sets the thread placement configuration and applies it to all running threads
+ * @param[in] conf Thread placement configuration
+ * @return 0 if OK; -1 if configuration is not valid or could not be applied to some thread
+ **/
+INT32S VbThreadPlacementConfSet(const t_vbThreadPlacementConf *conf);
+
+/**
+ * @brief Gets the thread placement configuration in use
+ * @param[out] conf Thread placement configuration
+ **/
+void VbThreadPlacementConfGet(t_vbThreadPlacementConf *conf);
+
+/**
+ * @brief Gets the thread class from its name
+ * @param[in] str Thread class name ("fsm", "io", "compute" or "background")
+ * @return Thread class; VB_THREAD_CLASS_LAST if not found
+ **/
+t_vbThreadClass VbThreadClassStrToEnum(const CHAR *str);
+
+/**
+ * @brief Gets the scheduling policy from its name
+ * @param[in] str Policy name ("OTHER", "FIFO" or "RR")
+ * @return Scheduling policy; VB_THREAD_POLICY_LAST if not found
+ **/
+t_vbThreadPolicy VbThreadPolicyStrToEnum(const CHAR *str);
+
+/**
+ * @brief Gets the thread class name
+ * @param[in] threadClass Thread class
+ * @return Thread class name
+ **/
+static inline const CHAR *VbThreadClassToStr(t_vbThreadClass threadClass)
+{
+  static const CHAR *threadClassStr[VB_THREAD_CLASS_LAST] = {"fsm", "io", "compute", "background"};
+  const CHAR *ret = "--";
+
+  if (threadClass < VB_THREAD_CLASS_LAST)
+  {
+    ret = threadClassStr[threadClass];
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Gets the scheduling policy name
+ * @param[in] policy Scheduling policy
+ * @return Scheduling policy name
+ **/
+static inline const CHAR *VbThreadPolicyToStr(t_vbThreadPolicy policy)
+{
+  static const CHAR *policyStr[VB_THREAD_POLICY_LAST] = {"OTHER", "FIFO", "RR"};
+  const CHAR *ret = "--";
+
+  if (policy < VB_THREAD_POLICY_LAST)
+  {
+    ret = policyStr[policy];
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Console command to inspect and adjust the thread placement
+ * @param[in] arg Not used
+ * @param[in] writeFun Callback used to print
+ * @param[in] cmd Command arguments
+ * @return TRUE if command was processed; FALSE otherwise
+ **/
+BOOL VbThreadConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
 #endif /* VB_THREAD_H_ */
 
 /**
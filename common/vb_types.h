@@ -182,6 +182,9 @@ typedef struct s_crossMeasure
   INT8U             MAC[ETH_ALEN];
   BOOL              ownCFR;
   t_processMeasure  measure;
+  INT8U            *spareRx1;
+  INT8U            *spareRx2;
+  INT16U            spareSize;
 } t_crossMeasure;
 
 typedef struct s_crossMeasureList
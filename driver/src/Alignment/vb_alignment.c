@@ -59,6 +59,7 @@
 #include "vb_driver_conf.h"
 #include "vb_alignment.h"
 #include "vb_LCMP_com.h"
+#include "vb_LCMP_async.h"
 #include "vb_LCMP_socket.h"
 #include "vb_log.h"
 #include "vb_EA_interface.h"
@@ -90,6 +91,7 @@
 #define VB_MACSEQNUM_SIZE                         (sizeof(t_lcmpMacSeqNum))
 #define TIMEOUT_CYCQUERY                          (VbDriverConfLcmpDefaultTimeoutGet()) //ms
 #define ALIGN_CHANGE_NODES_WAIT                   (MAC_CYCLE_DURATION * 2) // Time required by G.hn nodes to apply new alignment parameters (in ms)
+#define ALIGN_CYCCHANGE_MIN_REQS                  (8)
 
 /*
  ************************************************************************
@@ -240,6 +242,15 @@ typedef struct
   struct timespec schedTime;
 } t_VBAlignCycQueryParams;
 
+typedef struct
+{
+  t_lcmpAsyncReq **reqs;                ///< CycChange.req pending confirmation
+  INT8U           *macs;                ///< DM MAC of each request
+  INT32U           numReqs;
+  INT32U           maxReqs;
+  INT32U           numFailed;           ///< Requests not confirmed (their MACs are moved to the beginning of macs)
+} t_alignCycChangeReqs;
+
 /*
  ************************************************************************
  ** Private variables
@@ -318,14 +329,14 @@ static BOOLEAN VBAlignmentSyncLostMonitorStateGet(void)
 
 /*******************************************************************/
 
-static t_VB_comErrorCode LCMPCycChangeSend(const INT8U *mac, INT8U clockEdge, INT16U seqNumOffset)
+static t_VB_comErrorCode LCMPCycChangeSend(const INT8U *mac, INT8U clockEdge, INT16U seqNumOffset, t_lcmpAsyncReq **req)
 {
   t_VB_comErrorCode        ret = VB_COM_ERROR_NONE;
   t_ValuesArray           *control_values_array = NULL;
   t_HGF_LCMP_ErrorCode     lcmp_err;
   t_lcmpComParams          lcmp_params;
 
-  if (mac == NULL)
+  if ((mac == NULL) || (req == NULL))
   {
     ret = VB_COM_ERROR_BAD_ARGS;
   }
@@ -367,9 +378,11 @@ static t_VB_comErrorCode LCMPCycChangeSend(const INT8U *mac, INT8U clockEdge, IN
     lcmp_params.dstMac          = mac;
     lcmp_params.paramIdReq      = VB_CYCCHANGE;
     lcmp_params.reqValues       = control_values_array;
+    // Offset and clock edge are relative, a retransmission could apply them twice
+    lcmp_params.noRetx          = TRUE;
 
-    // Send control frame to modigy alignment
-    lcmp_err = VbLcmpControl(&lcmp_params);
+    // Send control frame to modify alignment (confirmation is awaited by caller)
+    lcmp_err = VbLcmpAsyncControl(&lcmp_params, NULL, NULL, req);
 
     if (lcmp_err != HGF_LCMP_ERROR_NONE)
     {
@@ -553,21 +566,59 @@ static t_VB_comErrorCode LCMPAlignmentModeSend(t_vbAlignModeParam *engAlignMode,
 static t_VB_comErrorCode CycChangeLoopCb(t_Domains *domain, void *args)
 {
   t_VB_comErrorCode        ret = VB_COM_ERROR_NONE;
+  t_alignCycChangeReqs    *reqs = (t_alignCycChangeReqs *)args;
+  t_lcmpAsyncReq          *req = NULL;
 
-  if (domain == NULL)
+  if ((domain == NULL) || (reqs == NULL))
   {
     ret = VB_COM_ERROR_BAD_ARGS;
   }
 
   if ((ret == VB_COM_ERROR_NONE) && (domain->alignChange.updated == TRUE))
   {
-    ret = LCMPCycChangeSend(domain->dm.MAC, domain->alignChange.clockEdge, domain->alignChange.seqNumOffset);
-  }
+    if (reqs->numReqs == reqs->maxReqs)
+    {
+      INT32U            max_reqs = MAX(2 * reqs->maxReqs, ALIGN_CYCCHANGE_MIN_REQS);
+      t_lcmpAsyncReq  **new_reqs;
+      INT8U            *new_macs;
 
-  if (ret == VB_COM_ERROR_NONE)
-  {
-    // Clear flag
-    domain->alignChange.updated = FALSE;
+      new_reqs = (t_lcmpAsyncReq **)realloc(reqs->reqs, max_reqs * sizeof(t_lcmpAsyncReq *));
+      if (new_reqs != NULL)
+      {
+        reqs->reqs = new_reqs;
+      }
+
+      new_macs = (INT8U *)realloc(reqs->macs, max_reqs * ETH_ALEN);
+      if (new_macs != NULL)
+      {
+        reqs->macs = new_macs;
+      }
+
+      if ((new_reqs == NULL) || (new_macs == NULL))
+      {
+        ret = VB_COM_ERROR_MALLOC;
+      }
+      else
+      {
+        reqs->maxReqs = max_reqs;
+      }
+    }
+
+    if (ret == VB_COM_ERROR_NONE)
+    {
+      // Requests to all DMs are sent without waiting for their confirmations
+      ret = LCMPCycChangeSend(domain->dm.MAC, domain->alignChange.clockEdge, domain->alignChange.seqNumOffset, &req);
+    }
+
+    if (ret == VB_COM_ERROR_NONE)
+    {
+      reqs->reqs[reqs->numReqs] = req;
+      MACAddrClone(&(reqs->macs[reqs->numReqs * ETH_ALEN]), domain->dm.MAC);
+      reqs->numReqs++;
+
+      // Clear flag (set again if CycChange.cnf is not received)
+      domain->alignChange.updated = FALSE;
+    }
   }
 
   if (VBAlignmentChangeStateGet() == FALSE)
@@ -581,12 +632,80 @@ static t_VB_comErrorCode CycChangeLoopCb(t_Domains *domain, void *args)
 
 /*******************************************************************/
 
+static t_VB_comErrorCode CycChangeFailedLoopCb(t_Domains *domain, void *args)
+{
+  t_VB_comErrorCode        ret = VB_COM_ERROR_NONE;
+  t_alignCycChangeReqs    *reqs = (t_alignCycChangeReqs *)args;
+  INT32U                   i;
+
+  if ((domain == NULL) || (reqs == NULL))
+  {
+    ret = VB_COM_ERROR_BAD_ARGS;
+  }
+
+  for (i = 0; (ret == VB_COM_ERROR_NONE) && (i < reqs->numFailed); i++)
+  {
+    if (memcmp(&(reqs->macs[i * ETH_ALEN]), domain->dm.MAC, ETH_ALEN) == 0)
+    {
+      domain->alignChange.updated = TRUE;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
 static t_VB_comErrorCode CycChangeProcess(void)
 {
   t_VB_comErrorCode        ret;
+  t_HGF_LCMP_ErrorCode     lcmp_err;
+  t_alignCycChangeReqs     reqs;
+  INT32U                   i;
+  CHAR                     mac_str[MAC_STR_LEN];
+
+  bzero(&reqs, sizeof(reqs));
+
+  // Loop through domains to send CycChange.req to updated DMs
+  ret = VbDatamodelDomainsLoop(CycChangeLoopCb, &reqs);
+
+  // Wait for all confirmations, even if loop was interrupted
+  for (i = 0; i < reqs.numReqs; i++)
+  {
+    lcmp_err = VbLcmpAsyncWait(reqs.reqs[i], NULL);
+    reqs.reqs[i] = NULL;
 
-  // Loop through domains to build the response
-  ret = VbDatamodelDomainsLoop(CycChangeLoopCb, NULL);
+    if (lcmp_err != HGF_LCMP_ERROR_NONE)
+    {
+      MACAddrMem2str(mac_str, &(reqs.macs[i * ETH_ALEN]));
+      VbLogPrint(VB_LOG_ERROR, "Error %d sending CycChange.req to node %s", lcmp_err, mac_str);
+
+      // Keep failed MACs at the beginning of the array
+      memmove(&(reqs.macs[reqs.numFailed * ETH_ALEN]), &(reqs.macs[i * ETH_ALEN]), ETH_ALEN);
+      reqs.numFailed++;
+    }
+  }
+
+  if (reqs.numFailed > 0)
+  {
+    // Restore update flag of DMs not confirming the change
+    VbDatamodelDomainsLoop(CycChangeFailedLoopCb, &reqs);
+
+    if (ret == VB_COM_ERROR_NONE)
+    {
+      ret = VB_COM_ERROR_LCMP_CONTROL;
+    }
+  }
+
+  if (reqs.reqs != NULL)
+  {
+    free(reqs.reqs);
+  }
+
+  if (reqs.macs != NULL)
+  {
+    free(reqs.macs);
+  }
 
   return ret;
 }
@@ -1166,7 +1285,7 @@ static BOOLEAN VbAlignmentCheckProcessStart(struct timespec *schedTime)
     VBAlignmentCheckStateSet(TRUE);
 
     // Start the thread
-    running = VbThreadCreate(ALIGN_CHECK_THREAD_NAME, VBAlignmentCheckProcess, NULL, VB_DRIVER_ALIGNMENT_THREAD_PRIORITY, &vbAlignmentCheckThread);
+    running = VbThreadCreate(ALIGN_CHECK_THREAD_NAME, VBAlignmentCheckProcess, NULL, VB_DRIVER_ALIGNMENT_THREAD_CLASS, &vbAlignmentCheckThread);
 
     if (running == FALSE)
     {
@@ -1197,7 +1316,7 @@ static BOOLEAN VbAlignmentChangeProcessStart(void)
   VBAlignmentChangeStateSet(TRUE);
 
   // Start the thread
-  running = VbThreadCreate(ALIGN_CHANGE_THREAD_NAME, VBAlignmentChangeProcess, NULL, VB_DRIVER_ALIGNMENT_THREAD_PRIORITY, &vbAlignmentChangeThread);
+  running = VbThreadCreate(ALIGN_CHANGE_THREAD_NAME, VBAlignmentChangeProcess, NULL, VB_DRIVER_ALIGNMENT_THREAD_CLASS, &vbAlignmentChangeThread);
 
   if (running == FALSE)
   {
@@ -1848,7 +1967,7 @@ BOOLEAN VbAlignmentSyncLostMonitorRun(void)
   else
   {
     // Start the thread
-    running = VbThreadCreate(ALIGN_SYNC_LOST_THREAD_NAME, VbAlignmentSyncLostThread, NULL, VB_DRIVER_ALIGNMENT_THREAD_PRIORITY, &vbAlignmentSyncLostThread);
+    running = VbThreadCreate(ALIGN_SYNC_LOST_THREAD_NAME, VbAlignmentSyncLostThread, NULL, VB_DRIVER_ALIGNMENT_THREAD_CLASS, &vbAlignmentSyncLostThread);
   }
 
   if (running == FALSE)
@@ -54,6 +54,7 @@
 
 #include <string.h>
 #include <errno.h>
+#include <pthread.h>
 
 #include "vb_LCMP_com.h"
 #include "vb_log.h"
@@ -123,6 +124,15 @@ typedef struct _vectorboostTlvCdtaHeaderConf TYPE_ALIGNED32(t_vectorboostTlvCdta
 static pthread_t vbCdtaThread = 0;
 static BOOL      vbCdtaThreadRunning = FALSE;
 
+/*
+ * Last CDTA TLV written to the nodes (seqNumber cleared) and the nodes join counter at that time.
+ * The mutex protects them as PSD shaping thread invalidates them.
+ */
+static pthread_mutex_t vbCdtaLastConfMutex = PTHREAD_MUTEX_INITIALIZER;
+static INT8U          *vbCdtaLastConf = NULL;
+static INT32U          vbCdtaLastConfLength = 0;
+static INT32U          vbCdtaLastConfJoinCnt = 0;
+
 /*
  ************************************************************************
  ** Private function definition
@@ -137,6 +147,53 @@ static BOOL      vbCdtaThreadRunning = FALSE;
 
 /*******************************************************************/
 
+static BOOLEAN VbCdtaLastConfMatch(const INT8U *tlv, INT32U length, INT32U joinCnt)
+{
+  BOOLEAN                        match = FALSE;
+  t_vectorboostTlvCdtaHeaderConf hdr;
+
+  hdr = *((const t_vectorboostTlvCdtaHeaderConf *)tlv);
+  hdr.seqNumber = 0;
+
+  pthread_mutex_lock(&vbCdtaLastConfMutex);
+
+  if ((vbCdtaLastConf != NULL) &&
+      (vbCdtaLastConfLength == length) &&
+      (vbCdtaLastConfJoinCnt == joinCnt) &&
+      (memcmp(vbCdtaLastConf, &hdr, sizeof(hdr)) == 0) &&
+      (memcmp(vbCdtaLastConf + sizeof(hdr), tlv + sizeof(hdr), length - sizeof(hdr)) == 0))
+  {
+    match = TRUE;
+  }
+
+  pthread_mutex_unlock(&vbCdtaLastConfMutex);
+
+  return match;
+}
+
+/*******************************************************************/
+
+static void VbCdtaLastConfSet(const INT8U *tlv, INT32U length, INT32U joinCnt)
+{
+  pthread_mutex_lock(&vbCdtaLastConfMutex);
+
+  free(vbCdtaLastConf);
+  vbCdtaLastConfLength = 0;
+  vbCdtaLastConf = (INT8U *)malloc(length);
+
+  if (vbCdtaLastConf != NULL)
+  {
+    memcpy(vbCdtaLastConf, tlv, length);
+    ((t_vectorboostTlvCdtaHeaderConf *)vbCdtaLastConf)->seqNumber = 0;
+    vbCdtaLastConfLength = length;
+    vbCdtaLastConfJoinCnt = joinCnt;
+  }
+
+  pthread_mutex_unlock(&vbCdtaLastConfMutex);
+}
+
+/*******************************************************************/
+
 static t_vbCdtaError VBCdtaConf(t_Transmision transmisionType, INT8U *dstMac, INT8U *pld)
 {
   t_vbCdtaError                      ret = VB_CDTA_ERR_NONE;
@@ -149,10 +206,12 @@ static t_vbCdtaError VBCdtaConf(t_Transmision transmisionType, INT8U *dstMac, IN
   t_vbEAPSDShapeStep                *psd_shape_step;
   t_vectorboostCdtaDmHeaderConf     *lcmp_psdshape_dm_header_conf_tlv;
   t_vectorboostCdtaDmBandConf       *vbCdtaDmBandConf_tlv;
-  INT8U                             *tlv;
+  INT8U                             *tlv = NULL;
   INT8U                             *pld_aux;
   INT8U                             *tlv_aux;
   INT32U                             lcmp_length = 0;
+  INT32U                             join_cnt = 0;
+  BOOLEAN                            write = TRUE;
   INT32U                             i;
   INT32U                             j;
   INT16U                             num_bands;
@@ -229,9 +288,6 @@ static t_vbCdtaError VBCdtaConf(t_Transmision transmisionType, INT8U *dstMac, IN
 
       com_err = VbDatamodelValueToArrayAdd(lcmp_length, tlv, &control_values_array);
 
-      free(tlv);
-      tlv = NULL;
-
       if (com_err != VB_COM_ERROR_NONE)
       {
         ret = VB_CDTA_ERR_COM;
@@ -245,6 +301,22 @@ static t_vbCdtaError VBCdtaConf(t_Transmision transmisionType, INT8U *dstMac, IN
   }
 
   if (ret == VB_CDTA_ERR_NONE)
+  {
+    /*
+     * The TLV carries the whole configuration, so it is only skipped when it is identical to the last one
+     * written and no node has joined since then. Forced channel estimations are always written.
+     */
+    join_cnt = VbDatamodelNodesJoinCntGet();
+
+    if ((cdta_hdr->forceChannelEstimation == 0) &&
+        (VbCdtaLastConfMatch(tlv, lcmp_length, join_cnt) == TRUE))
+    {
+      VbLogPrint(VB_LOG_INFO, "Cdta configuration already applied -> Skip CdtaWrite.req");
+      write = FALSE;
+    }
+  }
+
+  if ((ret == VB_CDTA_ERR_NONE) && (write == TRUE))
   {
     // Init LCMP params
     lcmp_err = VbLcmpParamsInit(&lcmp_params);
@@ -256,7 +328,7 @@ static t_vbCdtaError VBCdtaConf(t_Transmision transmisionType, INT8U *dstMac, IN
     }
   }
 
-  if (ret == VB_CDTA_ERR_NONE)
+  if ((ret == VB_CDTA_ERR_NONE) && (write == TRUE))
   {
     // Configure LCMP params
     lcmp_params.transmisionType = transmisionType;
@@ -275,9 +347,24 @@ static t_vbCdtaError VBCdtaConf(t_Transmision transmisionType, INT8U *dstMac, IN
     }
   }
 
+  if ((ret == VB_CDTA_ERR_NONE) && (write == TRUE))
+  {
+    VbCdtaLastConfSet(tlv, lcmp_length, join_cnt);
+  }
+  else if (ret != VB_CDTA_ERR_NONE)
+  {
+    // Unknown state in nodes, next configuration shall be written
+    VbCdtaLastConfReset();
+  }
+
   // Always release allocated memory
   VbDatamodelHTLVsArrayDestroy(&control_values_array);
 
+  if (tlv != NULL)
+  {
+    free(tlv);
+  }
+
   return ret;
 }
 
@@ -364,7 +451,7 @@ void VbCdtaWriteRun(INT8U *payload, INT16U length)
       VbLogPrint(VB_LOG_INFO, "Starting %s thread", CDTA_THREAD_NAME);
 
       vbCdtaThreadRunning = TRUE;
-      if (FALSE == VbThreadCreate(CDTA_THREAD_NAME, VBCdtaProcess, payload_copy, VB_DRIVER_CDTA_THREAD_PRIORITY, &vbCdtaThread))
+      if (FALSE == VbThreadCreate(CDTA_THREAD_NAME, VBCdtaProcess, payload_copy, VB_DRIVER_CDTA_THREAD_CLASS, &vbCdtaThread))
       {
         VbLogPrint(VB_LOG_ERROR,"Can't create %s thread", CDTA_THREAD_NAME);
         free(payload_copy);
@@ -391,6 +478,19 @@ void VbCdtaStop(void)
 
 /*******************************************************************/
 
+void VbCdtaLastConfReset(void)
+{
+  pthread_mutex_lock(&vbCdtaLastConfMutex);
+
+  free(vbCdtaLastConf);
+  vbCdtaLastConf = NULL;
+  vbCdtaLastConfLength = 0;
+
+  pthread_mutex_unlock(&vbCdtaLastConfMutex);
+}
+
+/*******************************************************************/
+
 void VbCdtaInit(void)
 {
   vbCdtaThread = 0;
@@ -98,6 +98,11 @@ typedef enum
 **/
 void VbCdtaStop(void);
 
+/**
+ * @brief Forgets the last CDTA configuration written, so next one is always written
+**/
+void VbCdtaLastConfReset(void);
+
 /**
  * @brief Executes the PSD shape write process
  * @param[in] payload PSD Shape message to process
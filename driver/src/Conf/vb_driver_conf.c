@@ -67,6 +67,8 @@
 #include "vb_driver_conf.h"
 #include "ezxml.h"
 #include "vb_measurement.h"
+#include "vb_thread.h"
+#include "vb_ea_shm.h"
 
 /*
  ************************************************************************
@@ -85,9 +87,15 @@
 #define VB_DRIVER_CONF_DEFAULT_MEAS_COLLECT_THREAD_INT (0)
 #define VB_DRIVER_CONF_DEFAULT_LCMP_TIMEOUT            (200)
 #define VB_DRIVER_CONF_DEFAULT_LCMP_N_ATTEMPT          (2)
+#define VB_DRIVER_CONF_DEFAULT_LCMP_MIN_TIMEOUT        (20)
+#define VB_DRIVER_CONF_DEFAULT_LCMP_MAX_IN_FLIGHT      (4)
+#define VB_DRIVER_CONF_DEFAULT_EA_FLOW_BUDGET          (1048576)
+#define VB_DRIVER_CONF_DEFAULT_EA_SHM_RING_SIZE        (VB_EA_SHM_RING_DEFAULT_SIZE)
+#define VB_DRIVER_CONF_DEFAULT_EA_IO_URING             (TRUE)
 #define VB_DRIVER_CONF_DEFAULT_PERSLOG_NUMLINES        (100)
 #define VB_DRIVER_CONF_DEFAULT_PERSLOG_VERBOSE         (VB_LOG_ERROR)
 #define VB_DRIVER_CONF_DEFAULT_PERSLOG_CIRCULAR        (TRUE)
+#define VB_DRIVER_CONF_DEFAULT_THREAD_PLACEMENT        (FALSE)
 
 #define MAX_FILE_NAME_LENGTH                           (150)
 
@@ -122,7 +130,13 @@ typedef struct s_vbDriverConf
   INT16U          family;                             ///< Family address type (IPv4 or IPv6)
   INT32U          lcmpDefaultTimeout;                 ///< Default timeout for LCMP requests (in ms)
   INT32U          lcmpDefaultNAttempt;                ///< Number of attempt
+  INT32U          lcmpMinTimeout;                     ///< Lower bound of adaptive LCMP retransmission timeout (in ms)
+  INT32U          lcmpMaxInFlight;                    ///< Max number of asynchronous LCMP requests in flight per node
+  INT32U          eaFlowBudget;                       ///< Max bytes of EA frames held back while engine has no credits
+  INT32U          eaShmRingSize;                      ///< Ring size of shared memory EA transport with a co-located engine (0: disabled)
+  BOOLEAN         eaIoUring;                          ///< Read EA socket through io_uring when kernel supports it
   t_persistentLog persistentLog;                      ///< Persistent log parameters
+  t_vbThreadPlacementConf threadPlacement;            ///< CPU sets, scheduling policy and cgroup of each thread class
 } t_vbDriverConf;
 
 /*
@@ -198,6 +212,78 @@ static t_VB_comErrorCode VbDriverPersistentLogParse( ezxml_t persistentLogConf )
 
 /*******************************************************************/
 
+static t_VB_comErrorCode VbDriverThreadPlacementParse( ezxml_t threadPlacementConf )
+{
+  t_VB_comErrorCode    ret = VB_COM_ERROR_NONE;
+  ezxml_t              ez_class;
+  ezxml_t              ez_temp;
+  t_vbThreadClassConf *class_conf;
+  const CHAR          *class_tags[VB_THREAD_CLASS_LAST] = {"Fsm", "Io", "Compute", "Background"};
+  INT32U               i;
+
+  ez_temp = ezxml_child(threadPlacementConf, "Enable");
+
+  if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+  {
+    vbDriverConf.threadPlacement.enable = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+  }
+
+  for (i = 0; (i < VB_THREAD_CLASS_LAST) && (ret == VB_COM_ERROR_NONE); i++)
+  {
+    ez_class = ezxml_child(threadPlacementConf, class_tags[i]);
+    class_conf = &(vbDriverConf.threadPlacement.classes[i]);
+
+    if (ez_class != NULL)
+    {
+      ez_temp = ezxml_child(ez_class, "Cpus");
+
+      if (ez_temp != NULL)
+      {
+        strncpy(class_conf->cpus, ezxml_trimtxt(ez_temp), VB_THREAD_CPU_LIST_LEN - 1);
+      }
+
+      ez_temp = ezxml_child(ez_class, "Policy");
+
+      if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp)[0] != '\0'))
+      {
+        class_conf->policy = VbThreadPolicyStrToEnum(ezxml_trimtxt(ez_temp));
+      }
+
+      ez_temp = ezxml_child(ez_class, "Priority");
+
+      if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+      {
+        class_conf->priority = strtoul(ez_temp->txt, NULL, 0);
+      }
+
+      ez_temp = ezxml_child(ez_class, "Nice");
+
+      if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+      {
+        class_conf->nice = strtol(ez_temp->txt, NULL, 0);
+      }
+
+      ez_temp = ezxml_child(ez_class, "Cgroup");
+
+      if (ez_temp != NULL)
+      {
+        strncpy(class_conf->cgroup, ezxml_trimtxt(ez_temp), VB_THREAD_CGROUP_PATH_LEN - 1);
+      }
+
+      if (VbThreadClassConfCheck(class_conf) != 0)
+      {
+        printf("ERROR parsing .ini file: Invalid ThreadPlacement/%s values (Cpus list, Policy OTHER/FIFO/RR, Priority >= 1 for FIFO/RR, Nice [%d, %d])\n",
+            class_tags[i], VB_THREAD_NICE_MIN, VB_THREAD_NICE_MAX);
+        ret = VB_COM_ERROR_INI_FILE;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
 static t_VB_comErrorCode  VbDriverFileInit( const char *path )
 {
   t_VB_comErrorCode         error = VB_COM_ERROR_NONE;
@@ -221,9 +307,15 @@ static t_VB_comErrorCode  VbDriverFileInit( const char *path )
   vbDriverConf.family                     = PF_UNSPEC;
   vbDriverConf.lcmpDefaultTimeout         = VB_DRIVER_CONF_DEFAULT_LCMP_TIMEOUT;
   vbDriverConf.lcmpDefaultNAttempt        = VB_DRIVER_CONF_DEFAULT_LCMP_N_ATTEMPT;
+  vbDriverConf.lcmpMinTimeout             = VB_DRIVER_CONF_DEFAULT_LCMP_MIN_TIMEOUT;
+  vbDriverConf.lcmpMaxInFlight            = VB_DRIVER_CONF_DEFAULT_LCMP_MAX_IN_FLIGHT;
+  vbDriverConf.eaFlowBudget               = VB_DRIVER_CONF_DEFAULT_EA_FLOW_BUDGET;
+  vbDriverConf.eaShmRingSize              = VB_DRIVER_CONF_DEFAULT_EA_SHM_RING_SIZE;
+  vbDriverConf.eaIoUring                  = VB_DRIVER_CONF_DEFAULT_EA_IO_URING;
   vbDriverConf.persistentLog.numLines     = VB_DRIVER_CONF_DEFAULT_PERSLOG_NUMLINES;
   vbDriverConf.persistentLog.verboseLevel = VB_DRIVER_CONF_DEFAULT_PERSLOG_VERBOSE;
   vbDriverConf.persistentLog.circular     = VB_DRIVER_CONF_DEFAULT_PERSLOG_CIRCULAR;
+  vbDriverConf.threadPlacement.enable     = VB_DRIVER_CONF_DEFAULT_THREAD_PLACEMENT;
 
   if (path == NULL)
   {
@@ -535,6 +627,85 @@ static t_VB_comErrorCode  VbDriverFileInit( const char *path )
     }
   }
 
+  if (error == VB_COM_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(driver, "LcmpMinTimeout");
+
+    if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
+    {
+      errno = 0;
+      vbDriverConf.lcmpMinTimeout = (INT32U)strtoul(ezxml_txt(ez_temp), NULL, 0);
+
+      if (errno != 0)
+      {
+        error = VB_COM_ERROR_INI_FILE;
+        printf("ERROR (%d:%s) parsing .ini file: Invalid LcmpMinTimeout value\n", errno, strerror(errno));
+      }
+    }
+  }
+
+  if (error == VB_COM_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(driver, "LcmpMaxInFlight");
+
+    if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
+    {
+      errno = 0;
+      vbDriverConf.lcmpMaxInFlight = (INT32U)strtoul(ezxml_txt(ez_temp), NULL, 0);
+
+      if ((errno != 0) || (vbDriverConf.lcmpMaxInFlight == 0))
+      {
+        error = VB_COM_ERROR_INI_FILE;
+        printf("ERROR (%d:%s) parsing .ini file: Invalid LcmpMaxInFlight value\n", errno, strerror(errno));
+      }
+    }
+  }
+
+  if (error == VB_COM_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(driver, "EAFlowBudget");
+
+    if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
+    {
+      errno = 0;
+      vbDriverConf.eaFlowBudget = (INT32U)strtoul(ezxml_txt(ez_temp), NULL, 0);
+
+      if ((errno != 0) || (vbDriverConf.eaFlowBudget == 0))
+      {
+        error = VB_COM_ERROR_INI_FILE;
+        printf("ERROR (%d:%s) parsing .ini file: Invalid EAFlowBudget value\n", errno, strerror(errno));
+      }
+    }
+  }
+
+  if (error == VB_COM_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(driver, "EAShmRingSize");
+
+    if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
+    {
+      errno = 0;
+      vbDriverConf.eaShmRingSize = (INT32U)strtoul(ezxml_txt(ez_temp), NULL, 0);
+
+      if ((errno != 0) || (VbEAShmRingSizeCheck(vbDriverConf.eaShmRingSize) == FALSE))
+      {
+        error = VB_COM_ERROR_INI_FILE;
+        printf("ERROR (%d:%s) parsing .ini file: Invalid EAShmRingSize value (0 or power of 2 in [%u, %u])\n",
+            errno, strerror(errno), VB_EA_SHM_RING_MIN_SIZE, VB_EA_SHM_RING_MAX_SIZE);
+      }
+    }
+  }
+
+  if (error == VB_COM_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(driver, "EAIoUring");
+
+    if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
+    {
+      vbDriverConf.eaIoUring = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+    }
+  }
+
   if (error == VB_COM_ERROR_NONE)
   {
     ez_temp = ezxml_child(driver, "PersistentLog");
@@ -545,6 +716,16 @@ static t_VB_comErrorCode  VbDriverFileInit( const char *path )
     }
   }
 
+  if (error == VB_COM_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(driver, "ThreadPlacement");
+
+    if (ez_temp != NULL)
+    {
+      error = VbDriverThreadPlacementParse( ez_temp );
+    }
+  }
+
   if(driver != NULL)
   {
     ezxml_free(driver);
@@ -737,6 +918,42 @@ INT32U VbDriverConfLcmpDefaultNAttemptGet(void)
 {
   return vbDriverConf.lcmpDefaultNAttempt;
 }
+
+/*******************************************************************/
+
+INT32U VbDriverConfLcmpMinTimeoutGet(void)
+{
+  return vbDriverConf.lcmpMinTimeout;
+}
+
+/*******************************************************************/
+
+INT32U VbDriverConfLcmpMaxInFlightGet(void)
+{
+  return vbDriverConf.lcmpMaxInFlight;
+}
+
+/*******************************************************************/
+
+INT32U VbDriverConfEaFlowBudgetGet(void)
+{
+  return vbDriverConf.eaFlowBudget;
+}
+
+/*******************************************************************/
+
+INT32U VbDriverConfEaShmRingSizeGet(void)
+{
+  return vbDriverConf.eaShmRingSize;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbDriverConfEaIoUringGet(void)
+{
+  return vbDriverConf.eaIoUring;
+}
+
 /*******************************************************************/
 
 void VbDriverConfDump(t_writeFun writeFun)
@@ -758,9 +975,15 @@ void VbDriverConfDump(t_writeFun writeFun)
   writeFun("| %-48s | %15u ms |\n",   "Meas collect thread int",          vbDriverConf.measCollectThreadInt);
   writeFun("| %-48s | %15u ms |\n",   "LCMP default timeout",             vbDriverConf.lcmpDefaultTimeout);
   writeFun("| %-48s | %15u ms |\n",   "LCMP default N Attempt",           vbDriverConf.lcmpDefaultNAttempt);
+  writeFun("| %-48s | %15u ms |\n",   "LCMP min timeout",                 vbDriverConf.lcmpMinTimeout);
+  writeFun("| %-48s | %18u |\n",      "LCMP max in flight per node",      vbDriverConf.lcmpMaxInFlight);
+  writeFun("| %-48s | %12u bytes |\n", "EA flow control budget",           vbDriverConf.eaFlowBudget);
+  writeFun("| %-48s | %12u bytes |\n", "EA shared memory ring size",       vbDriverConf.eaShmRingSize);
+  writeFun("| %-48s | %18s |\n",      "EA io_uring receive",              vbDriverConf.eaIoUring?"ENABLED":"DISABLED");
   writeFun("| %-48s | %18u |\n",      "Persistent log - Number of lines", vbDriverConf.persistentLog.numLines);
   writeFun("| %-48s | %18s |\n",      "Persistent log - Verbose level",   VbVerboseLevelToStr(vbDriverConf.persistentLog.verboseLevel));
   writeFun("| %-48s | %18s |\n",      "Persistent log - Circular",        vbDriverConf.persistentLog.circular?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %18s |\n",      "Thread placement",                 vbDriverConf.threadPlacement.enable?"ENABLED":"DISABLED");
   writeFun("=========================================================================\n");
 }
 
@@ -787,6 +1010,13 @@ BOOLEAN VbDriverConfPersistentLogIsCircular(void)
 
 /*******************************************************************/
 
+const t_vbThreadPlacementConf *VbDriverConfThreadPlacementGet(void)
+{
+  return &(vbDriverConf.threadPlacement);
+}
+
+/*******************************************************************/
+
 /**
  * @}
  **/
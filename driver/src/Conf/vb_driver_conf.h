@@ -55,6 +55,7 @@
 
 #include "vb_DataModel.h"
 #include "vb_log.h"
+#include "vb_thread.h"
 
 /*
  ************************************************************************
@@ -178,6 +179,36 @@ INT32U VbDriverConfLcmpDefaultTimeoutGet(void);
  **/
 INT32U VbDriverConfLcmpDefaultNAttemptGet(void);
 
+/**
+ * @brief Gets lower bound of adaptive LCMP retransmission timeout
+ * @return Min timeout for LCMP requests (in ms)
+ **/
+INT32U VbDriverConfLcmpMinTimeoutGet(void);
+
+/**
+ * @brief Gets max number of asynchronous LCMP requests in flight per node
+ * @return Max number of requests in flight
+ **/
+INT32U VbDriverConfLcmpMaxInFlightGet(void);
+
+/**
+ * @brief Gets max bytes of EA frames held back while engine has no credits for them
+ * @return Budget in bytes
+ **/
+INT32U VbDriverConfEaFlowBudgetGet(void);
+
+/**
+ * @brief Gets ring size of shared memory EA transport, used when engine runs on the same host
+ * @return Ring size in bytes (0: disabled)
+ **/
+INT32U VbDriverConfEaShmRingSizeGet(void);
+
+/**
+ * @brief Gets whether EA socket is read through io_uring (when kernel supports it)
+ * @return TRUE: io_uring receive; FALSE: blocking receive
+ **/
+BOOLEAN VbDriverConfEaIoUringGet(void);
+
 /**
  * @brief Gets counfigured align method
  * @return Align method
@@ -208,6 +239,12 @@ t_vbLogLevel VbDriverConfPeristentLogVerboseLevelGet(void);
  **/
 BOOLEAN VbDriverConfPersistentLogIsCircular(void);
 
+/**
+ * @brief Gets the thread placement configuration (CPU set, scheduling policy and cgroup of each thread class)
+ * @return Thread placement configuration
+ **/
+const t_vbThreadPlacementConf *VbDriverConfThreadPlacementGet(void);
+
 #endif /* _VB_DRIVER_CONF_H_ */
 
 /**
@@ -215,7 +215,7 @@ void VbDomainsMonitorRun(void)
 
   VbDomainsMonitorStateSet(TRUE);
 
-  if (FALSE == VbThreadCreate(VB_DOMAINS_MONITOR_THREAD_NAME, VBDomainsMonitorProcess, NULL, VB_DRIVER_DOMAINS_MONITOR_THREAD_PRIORITY, &vbDomainsMonitorThread))
+  if (FALSE == VbThreadCreate(VB_DOMAINS_MONITOR_THREAD_NAME, VBDomainsMonitorProcess, NULL, VB_DRIVER_DOMAINS_MONITOR_THREAD_CLASS, &vbDomainsMonitorThread))
   {
     VbLogPrint(VB_LOG_ERROR,"Can't create %s thread", VB_DOMAINS_MONITOR_THREAD_NAME);
 
@@ -0,0 +1,692 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_EA_flow.c
+ * @brief Credit based flow control of frames sent to engine
+ *
+ * @internal
+ *
+ * Engine advertises, per EA flow class, how many frames it can take
+ * (VB_EA_OPCODE_FLOW_CREDIT) and returns credits as it processes them.
+ * Measure and telemetry frames are sent while credits are left; otherwise
+ * they are held back in a per class FIFO, within a byte budget shared by all
+ * classes, and sent by a dedicated thread as credits arrive. When the budget
+ * is exhausted the sender blocks until held back frames are drained, and the
+ * frame fails with VB_EA_ERR_TIMEOUT if that takes too long. Control frames
+ * always go out immediately.
+ *
+ * Flow control is only enabled once engine advertises credits, so older
+ * engines keep working as before.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <errno.h>
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_thread.h"
+#include "vb_priorities.h"
+#include "vb_EA_flow.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_EA_FLOW_THREAD_NAME                  ("EAFlow")
+#define VB_EA_FLOW_BUDGET_WAIT_TIMEOUT          (2000) // msecs a sender waits for room in the budget
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct s_eaFlowNode
+{
+  t_vbEAMsg           *msg;
+  struct timespec      queuedTs;
+  struct s_eaFlowNode *next;
+} t_eaFlowNode;
+
+typedef struct
+{
+  INT32U   queued;                    ///< Frames held back
+  INT32U   sent;                      ///< Frames sent (directly or after being held back)
+  INT32U   timeouts;                  ///< Frames not sent because the budget stayed exhausted
+  INT32U   drained;                   ///< Held back frames sent by flow control thread
+  INT32U   peakDepth;
+  INT64U   waitSum;                   ///< Time held back frames waited (usecs)
+  INT32U   waitMax;                   ///< usecs
+  INT32U   stalls;                    ///< Periods with frames held back
+  INT64U   stallSum;                  ///< usecs
+  INT32U   stallMax;                  ///< usecs
+} t_eaFlowStats;
+
+typedef struct
+{
+  t_eaFlowNode    *head;
+  t_eaFlowNode    *tail;
+  INT32U           depth;
+  BOOLEAN          limited;           ///< Engine advertised credits for this class
+  INT32U           credits;           ///< Frames that can be sent right now
+  BOOLEAN          sending;           ///< A frame of this class is being sent, later ones shall wait
+  BOOLEAN          stalled;
+  struct timespec  stallStartTs;
+  t_eaFlowStats    stats;
+} t_eaFlowQueue;
+
+typedef struct
+{
+  pthread_mutex_t  mutex;
+  pthread_cond_t   cond;
+  pthread_t        threadId;
+  BOOLEAN          running;
+  t_vbEADesc      *desc;
+  BOOLEAN          enabled;           ///< Engine advertised credits on current connection
+  INT32U           budget;            ///< Max bytes held back
+  INT32U           bytes;
+  INT32U           peakBytes;
+  INT32U           creditFrames;      ///< FlowCredit frames received
+  t_eaFlowQueue    queues[VB_EA_FLOW_CLASS_LAST];
+} t_eaFlow;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static t_eaFlow vbEAFlow =
+{
+  .mutex = PTHREAD_MUTEX_INITIALIZER,
+  .cond  = PTHREAD_COND_INITIALIZER,
+};
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+static INT32U EAFlowElapsedUs(const struct timespec *since)
+{
+  struct timespec now;
+  INT64S          elapsed;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  elapsed = VbUtilElapsetimeTimespecUs((struct timespec *)since, &now);
+
+  return (INT32U)MIN(MAX(elapsed, 0), MAX_INT32U);
+}
+
+/*******************************************************************/
+
+static void EAFlowStallEnd(t_eaFlowQueue *queue)
+{
+  INT32U stall;
+
+  if (queue->stalled == TRUE)
+  {
+    stall = EAFlowElapsedUs(&queue->stallStartTs);
+
+    queue->stats.stallSum += stall;
+    queue->stats.stallMax = MAX(queue->stats.stallMax, stall);
+    queue->stalled = FALSE;
+  }
+}
+
+/*******************************************************************/
+
+static BOOLEAN EAFlowQueueReady(const t_eaFlowQueue *queue)
+{
+  return ((queue->head != NULL) && (queue->sending == FALSE) &&
+          ((queue->limited == FALSE) || (queue->credits > 0)))?TRUE:FALSE;
+}
+
+/*******************************************************************/
+
+static BOOLEAN EAFlowHoldBack(const t_eaFlowQueue *queue)
+{
+  return ((vbEAFlow.enabled == TRUE) &&
+          ((queue->head != NULL) || (queue->sending == TRUE) || ((queue->limited == TRUE) && (queue->credits == 0))))?TRUE:FALSE;
+}
+
+/*******************************************************************/
+
+static t_eaFlowNode *EAFlowQueuePop(t_eaFlowQueue *queue)
+{
+  t_eaFlowNode *node = queue->head;
+
+  queue->head = node->next;
+
+  if (queue->head == NULL)
+  {
+    queue->tail = NULL;
+  }
+
+  queue->depth--;
+  vbEAFlow.bytes -= node->msg->eaFullMsg.msgLen;
+
+  return node;
+}
+
+/*******************************************************************/
+
+static void EAFlowQueueRelease(t_eaFlowQueue *queue)
+{
+  t_eaFlowNode *node;
+
+  while (queue->head != NULL)
+  {
+    node = EAFlowQueuePop(queue);
+
+    VbEAMsgFree(&node->msg);
+    free(node);
+  }
+
+  EAFlowStallEnd(queue);
+}
+
+/*******************************************************************/
+
+static void *EAFlowThread(void *arg)
+{
+  t_eaFlowQueue  *queue = NULL;
+  t_eaFlowNode   *node;
+  t_vbEADesc     *desc;
+  t_vbEAError     err;
+  INT32U          wait;
+  INT32U          i;
+
+  pthread_mutex_lock(&vbEAFlow.mutex);
+
+  while (vbEAFlow.running == TRUE)
+  {
+    queue = NULL;
+
+    for (i = VB_EA_FLOW_CLASS_MEASURE; (i < VB_EA_FLOW_CLASS_LAST) && (queue == NULL); i++)
+    {
+      if (EAFlowQueueReady(&vbEAFlow.queues[i]) == TRUE)
+      {
+        queue = &vbEAFlow.queues[i];
+      }
+    }
+
+    if (queue == NULL)
+    {
+      // Wait for credits or new frames
+      pthread_cond_wait(&vbEAFlow.cond, &vbEAFlow.mutex);
+    }
+    else
+    {
+      node = EAFlowQueuePop(queue);
+
+      // Room left in the budget, wake up blocked senders
+      pthread_cond_broadcast(&vbEAFlow.cond);
+
+      if (queue->limited == TRUE)
+      {
+        queue->credits--;
+      }
+
+      wait = EAFlowElapsedUs(&node->queuedTs);
+      queue->stats.waitSum += wait;
+      queue->stats.waitMax = MAX(queue->stats.waitMax, wait);
+      queue->stats.sent++;
+      queue->stats.drained++;
+
+      if (queue->head == NULL)
+      {
+        EAFlowStallEnd(queue);
+      }
+
+      // Keep frames of this class behind the one being sent
+      queue->sending = TRUE;
+      desc = vbEAFlow.desc;
+
+      pthread_mutex_unlock(&vbEAFlow.mutex);
+
+      err = VbEAMsgSend(desc, node->msg);
+
+      if (err != VB_EA_ERR_NONE)
+      {
+        VbLogPrint(VB_LOG_ERROR, "Error (%d) sending held back %s frame", err, VbEAOpcodeToStrGet(node->msg->opcode));
+      }
+
+      VbEAMsgFree(&node->msg);
+      free(node);
+
+      pthread_mutex_lock(&vbEAFlow.mutex);
+
+      queue->sending = FALSE;
+    }
+  }
+
+  pthread_mutex_unlock(&vbEAFlow.mutex);
+
+  return NULL;
+}
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+t_VB_comErrorCode VbEAFlowStart(t_vbEADesc *desc, INT32U budget)
+{
+  t_VB_comErrorCode ret = VB_COM_ERROR_NONE;
+  BOOLEAN           running;
+
+  if ((desc == NULL) || (budget == 0))
+  {
+    ret = VB_COM_ERROR_BAD_ARGS;
+  }
+
+  if (ret == VB_COM_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbEAFlow.mutex);
+
+    running = vbEAFlow.running;
+    vbEAFlow.desc = desc;
+    vbEAFlow.budget = budget;
+    vbEAFlow.running = TRUE;
+
+    pthread_mutex_unlock(&vbEAFlow.mutex);
+
+    if (running == FALSE)
+    {
+      running = VbThreadCreate(VB_EA_FLOW_THREAD_NAME, EAFlowThread, NULL, VB_EA_FLOW_THREAD_CLASS, &vbEAFlow.threadId);
+
+      if (running == FALSE)
+      {
+        VbLogPrint(VB_LOG_ERROR, "Can't create %s thread", VB_EA_FLOW_THREAD_NAME);
+
+        pthread_mutex_lock(&vbEAFlow.mutex);
+        vbEAFlow.running = FALSE;
+        pthread_mutex_unlock(&vbEAFlow.mutex);
+
+        ret = VB_COM_ERROR_THREAD;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEAFlowStop(void)
+{
+  BOOLEAN running;
+
+  pthread_mutex_lock(&vbEAFlow.mutex);
+
+  running = vbEAFlow.running;
+  vbEAFlow.running = FALSE;
+  pthread_cond_broadcast(&vbEAFlow.cond);
+
+  pthread_mutex_unlock(&vbEAFlow.mutex);
+
+  if (running == TRUE)
+  {
+    VbThreadJoin(vbEAFlow.threadId, VB_EA_FLOW_THREAD_NAME);
+  }
+
+  VbEAFlowReset();
+}
+
+/*******************************************************************/
+
+void VbEAFlowReset(void)
+{
+  t_eaFlowQueue *queue;
+  INT32U         i;
+
+  pthread_mutex_lock(&vbEAFlow.mutex);
+
+  for (i = 0; i < VB_EA_FLOW_CLASS_LAST; i++)
+  {
+    queue = &vbEAFlow.queues[i];
+
+    EAFlowQueueRelease(queue);
+    queue->limited = FALSE;
+    queue->credits = 0;
+  }
+
+  vbEAFlow.enabled = FALSE;
+
+  // Senders waiting for room in the budget go on without flow control
+  pthread_cond_broadcast(&vbEAFlow.cond);
+
+  pthread_mutex_unlock(&vbEAFlow.mutex);
+}
+
+/*******************************************************************/
+
+t_vbEAError VbEAFlowMsgSend(t_vbEADesc *desc, t_vbEAMsg **msg)
+{
+  t_vbEAError      ret = VB_EA_ERR_NONE;
+  t_vbEAFlowClass  flow_class = VB_EA_FLOW_CLASS_CONTROL;
+  t_eaFlowQueue   *queue = NULL;
+  t_eaFlowNode    *node;
+  struct timespec  deadline;
+  INT32U           len;
+
+  if ((desc == NULL) || (msg == NULL) || (*msg == NULL))
+  {
+    ret = VB_EA_ERR_BAD_ARGS;
+  }
+
+  if (ret == VB_EA_ERR_NONE)
+  {
+    flow_class = VbEAFlowClassGet((*msg)->opcode);
+  }
+
+  if ((ret == VB_EA_ERR_NONE) && (flow_class != VB_EA_FLOW_CLASS_CONTROL))
+  {
+    queue = &vbEAFlow.queues[flow_class];
+    len = (*msg)->eaFullMsg.msgLen;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += VB_EA_FLOW_BUDGET_WAIT_TIMEOUT / 1000;
+    deadline.tv_nsec += (VB_EA_FLOW_BUDGET_WAIT_TIMEOUT % 1000) * 1000000;
+    deadline.tv_sec += deadline.tv_nsec / 1000000000;
+    deadline.tv_nsec %= 1000000000;
+
+    pthread_mutex_lock(&vbEAFlow.mutex);
+
+    // Block until held back frames leave room in the budget. Collection end is a few bytes and engine waits for it, never block it
+    while ((ret == VB_EA_ERR_NONE) &&
+           (EAFlowHoldBack(queue) == TRUE) &&
+           ((vbEAFlow.bytes + len) > vbEAFlow.budget) &&
+           ((*msg)->opcode != VB_EA_OPCODE_MEAS_COLLECT_END))
+    {
+      if (pthread_cond_timedwait(&vbEAFlow.cond, &vbEAFlow.mutex, &deadline) == ETIMEDOUT)
+      {
+        ret = VB_EA_ERR_TIMEOUT;
+      }
+    }
+
+    if ((ret == VB_EA_ERR_TIMEOUT) &&
+        ((EAFlowHoldBack(queue) == FALSE) || ((vbEAFlow.bytes + len) <= vbEAFlow.budget)))
+    {
+      // Room made just when timing out
+      ret = VB_EA_ERR_NONE;
+    }
+
+    if (ret != VB_EA_ERR_NONE)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Flow control budget (%u bytes) exhausted for %u ms, %s frame not sent",
+          vbEAFlow.budget, VB_EA_FLOW_BUDGET_WAIT_TIMEOUT, VbEAOpcodeToStrGet((*msg)->opcode));
+
+      queue->stats.timeouts++;
+      VbEAMsgFree(msg);
+
+      // Nothing else to do
+      queue = NULL;
+    }
+    else if (EAFlowHoldBack(queue) == TRUE)
+    {
+      node = (t_eaFlowNode *)malloc(sizeof(t_eaFlowNode));
+
+      if (node == NULL)
+      {
+        VbEAMsgFree(msg);
+        ret = VB_EA_ERR_NO_MEMORY;
+      }
+      else
+      {
+        node->msg = *msg;
+        node->next = NULL;
+        clock_gettime(CLOCK_MONOTONIC, &node->queuedTs);
+
+        if (queue->tail == NULL)
+        {
+          queue->head = node;
+          queue->stalled = TRUE;
+          queue->stallStartTs = node->queuedTs;
+          queue->stats.stalls++;
+        }
+        else
+        {
+          queue->tail->next = node;
+        }
+
+        queue->tail = node;
+        queue->depth++;
+        queue->stats.queued++;
+        queue->stats.peakDepth = MAX(queue->stats.peakDepth, queue->depth);
+        vbEAFlow.bytes += len;
+        vbEAFlow.peakBytes = MAX(vbEAFlow.peakBytes, vbEAFlow.bytes);
+
+        // Ownership taken, frame is sent by flow control thread
+        *msg = NULL;
+
+        pthread_cond_broadcast(&vbEAFlow.cond);
+      }
+
+      // Nothing else to do
+      queue = NULL;
+    }
+    else
+    {
+      if ((vbEAFlow.enabled == TRUE) && (queue->limited == TRUE))
+      {
+        queue->credits--;
+      }
+
+      queue->stats.sent++;
+      queue->sending = TRUE;
+    }
+
+    pthread_mutex_unlock(&vbEAFlow.mutex);
+  }
+
+  if ((ret == VB_EA_ERR_NONE) && (*msg != NULL))
+  {
+    ret = VbEAMsgSend(desc, *msg);
+
+    if (queue != NULL)
+    {
+      pthread_mutex_lock(&vbEAFlow.mutex);
+
+      queue->sending = FALSE;
+
+      // Frames may have been held back while sending this one
+      pthread_cond_broadcast(&vbEAFlow.cond);
+
+      pthread_mutex_unlock(&vbEAFlow.mutex);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEAFlowCreditRx(const t_vbEAMsg *msg)
+{
+  const t_vbEAFlowCredit *credit;
+  t_eaFlowQueue          *queue;
+  INT16U                  credits;
+  INT32U                  i;
+
+  if ((msg == NULL) || (msg->eaPayload.msg == NULL) || (msg->eaPayload.msgLen < VB_EA_FLOW_CREDIT_SIZE))
+  {
+    VbLogPrint(VB_LOG_ERROR, "Invalid FlowCredit frame");
+  }
+  else
+  {
+    credit = (const t_vbEAFlowCredit *)msg->eaPayload.msg;
+
+    pthread_mutex_lock(&vbEAFlow.mutex);
+
+    vbEAFlow.enabled = TRUE;
+    vbEAFlow.creditFrames++;
+
+    for (i = VB_EA_FLOW_CLASS_MEASURE; i < VB_EA_FLOW_CLASS_LAST; i++)
+    {
+      queue = &vbEAFlow.queues[i];
+      credits = _ntohs(credit->credits[i]);
+
+      if (credits == VB_EA_FLOW_CREDIT_UNLIMITED)
+      {
+        queue->limited = FALSE;
+        queue->credits = 0;
+      }
+      else if (credits > 0)
+      {
+        queue->limited = TRUE;
+        queue->credits += credits;
+      }
+    }
+
+    pthread_cond_broadcast(&vbEAFlow.cond);
+
+    pthread_mutex_unlock(&vbEAFlow.mutex);
+  }
+}
+
+/*******************************************************************/
+
+BOOL VbEAFlowConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  t_eaFlowQueue  queues[VB_EA_FLOW_CLASS_LAST];
+  BOOLEAN        enabled;
+  INT32U         budget;
+  INT32U         bytes;
+  INT32U         peak_bytes;
+  INT32U         credit_frames;
+  INT32U         i;
+
+  if ((cmd != NULL) && (cmd[1] != NULL) && (strcmp(cmd[1], "reset") == 0))
+  {
+    pthread_mutex_lock(&vbEAFlow.mutex);
+
+    for (i = 0; i < VB_EA_FLOW_CLASS_LAST; i++)
+    {
+      bzero(&vbEAFlow.queues[i].stats, sizeof(vbEAFlow.queues[i].stats));
+    }
+
+    vbEAFlow.peakBytes = vbEAFlow.bytes;
+    vbEAFlow.creditFrames = 0;
+
+    pthread_mutex_unlock(&vbEAFlow.mutex);
+
+    writeFun("EA flow control statistics reset\n");
+  }
+  else if ((cmd != NULL) && (cmd[1] != NULL))
+  {
+    writeFun("Usage:\n");
+    writeFun("eaflow       : Shows EA credits, frames held back per class and stall times\n");
+    writeFun("eaflow reset : Resets statistics\n");
+  }
+  else
+  {
+    pthread_mutex_lock(&vbEAFlow.mutex);
+    memcpy(queues, vbEAFlow.queues, sizeof(queues));
+    enabled = vbEAFlow.enabled;
+    budget = vbEAFlow.budget;
+    bytes = vbEAFlow.bytes;
+    peak_bytes = vbEAFlow.peakBytes;
+    credit_frames = vbEAFlow.creditFrames;
+    pthread_mutex_unlock(&vbEAFlow.mutex);
+
+    writeFun("Flow control   : %s\n", enabled?"ENABLED":"DISABLED (no credits advertised by engine)");
+    writeFun("Budget         : %u bytes (used %u, peak %u)\n", budget, bytes, peak_bytes);
+    writeFun("Credit frames  : %u\n", credit_frames);
+    writeFun("==============================================================================================================================\n");
+    writeFun("| %-9s | %7s | %5s | %5s | %7s | %7s | %8s | %9s | %9s | %6s | %11s | %10s |\n",
+        "Class", "Credits", "Depth", "Peak", "Queued", "Sent", "Timeouts", "AvgWait", "MaxWait", "Stalls", "StallTime", "MaxStall");
+    writeFun("==============================================================================================================================\n");
+
+    for (i = VB_EA_FLOW_CLASS_MEASURE; i < VB_EA_FLOW_CLASS_LAST; i++)
+    {
+      t_eaFlowQueue *queue = &queues[i];
+      CHAR           credits_str[16];
+
+      if (queue->limited == TRUE)
+      {
+        snprintf(credits_str, sizeof(credits_str), "%u", queue->credits);
+      }
+      else
+      {
+        snprintf(credits_str, sizeof(credits_str), "-");
+      }
+
+      writeFun("| %-9s | %7s | %5u | %5u | %7u | %7u | %8u | %6llu ms | %6u ms | %6u | %8llu ms | %7u ms |\n",
+          VbEAFlowClassToStr((t_vbEAFlowClass)i),
+          credits_str,
+          queue->depth,
+          queue->stats.peakDepth,
+          queue->stats.queued,
+          queue->stats.sent,
+          queue->stats.timeouts,
+          (queue->stats.drained > 0)?(unsigned long long)(queue->stats.waitSum / queue->stats.drained / 1000):0ULL,
+          queue->stats.waitMax / 1000,
+          queue->stats.stalls,
+          (unsigned long long)(queue->stats.stallSum / 1000),
+          queue->stats.stallMax / 1000);
+    }
+
+    writeFun("==============================================================================================================================\n");
+  }
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
@@ -0,0 +1,112 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_EA_flow.h
+ * @brief Credit based flow control of frames sent to engine
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_EA_FLOW_H_
+#define VB_EA_FLOW_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_ea_communication.h"
+#include "vb_DataModel.h"
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Starts the thread sending frames held back by flow control
+ * @param[in] desc Connection descriptor frames are sent through
+ * @param[in] budget Max bytes of frames held back
+ * @return @ref t_VB_comErrorCode
+ **/
+t_VB_comErrorCode VbEAFlowStart(t_vbEADesc *desc, INT32U budget);
+
+/**
+ * @brief Stops the sender thread and releases frames held back
+ **/
+void VbEAFlowStop(void);
+
+/**
+ * @brief Releases frames held back and disables flow control until engine advertises credits again.
+ * Shall be called when a connection is established or lost.
+ **/
+void VbEAFlowReset(void);
+
+/**
+ * @brief Sends a frame to engine, or holds it back while engine has no credits for its flow class.
+ * Blocks while the budget of held back frames is exhausted.
+ * @param[in] desc Connection descriptor
+ * @param[in,out] msg Frame to send. It is set to NULL when the frame is held back or not sent (ownership is taken)
+ * @return @ref t_vbEAError; VB_EA_ERR_TIMEOUT if the budget stayed exhausted
+ **/
+t_vbEAError VbEAFlowMsgSend(t_vbEADesc *desc, t_vbEAMsg **msg);
+
+/**
+ * @brief Processes credits advertised by engine
+ * @param[in] msg EA FlowCredit frame
+ **/
+void VbEAFlowCreditRx(const t_vbEAMsg *msg);
+
+/**
+ * @brief Console command to show flow control credits, queue depths and stall times
+ * @param[in] arg Generic argument
+ * @param[in] writeFun Function to write output
+ * @param[in] cmd Command arguments
+ * @return TRUE
+ **/
+BOOL VbEAFlowConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_EA_FLOW_H_ */
+
+/**
+ * @}
+ **/
@@ -72,6 +72,7 @@
 #include "vb_main_timer.h"
 #include "vb_alignment.h"
 #include "vb_driver_conf.h"
+#include "vb_EA_flow.h"
 
 /*
  ************************************************************************
@@ -483,7 +484,13 @@ static void VbEARxMsgCb(t_vbEADesc *desc, INT8U *rxMsg, INT32U rxMsgLen)
     }
   }
 
-  if (err == VB_COM_ERROR_NONE)
+  if ((err == VB_COM_ERROR_NONE) && (msg->opcode == VB_EA_OPCODE_FLOW_CREDIT))
+  {
+    // Credits are applied right away, frames held back shall not wait for main thread
+    VbEAFlowCreditRx(msg);
+    VbEAMsgFree(&msg);
+  }
+  else if (err == VB_COM_ERROR_NONE)
   {
 #if (_VALGRIND_ == 1)
     ANNOTATE_HAPPENS_BEFORE(msg);
@@ -505,6 +512,9 @@ static void VbEADisconnectCb(t_vbEADesc *desc)
 {
   if (desc != NULL)
   {
+    // Frames held back belong to the lost connection
+    VbEAFlowReset();
+
     // Send event
     VbMainQEvSend(DRIVER_EV_DISCONNECT, desc->queueId, NULL);
   }
@@ -523,6 +533,9 @@ static t_vbEAError VbEAConnectCb(t_vbEADesc *desc, struct sockaddr_in6 clientAdd
 
   if (ret == VB_EA_ERR_NONE)
   {
+    // No flow control until engine advertises credits on this connection
+    VbEAFlowReset();
+
     if(vbEAServerMode == TRUE)
     {
       // Stop previous connection
@@ -545,6 +558,8 @@ static t_vbEAError VbEAConnectCb(t_vbEADesc *desc, struct sockaddr_in6 clientAdd
         vbEAConnDesc.clientAddr         = clientAddr;
         vbEAConnDesc.sockFd             = sockFd;
         vbEAConnDesc.socketAliveCounter = 0;
+        vbEAConnDesc.shmRingSize        = VbDriverConfEaShmRingSizeGet();
+        vbEAConnDesc.ioUring            = VbDriverConfEaIoUringGet();
 
         // Start new connection thread
         VbEAThreadStart(&vbEAConnDesc);
@@ -574,6 +589,9 @@ void VbEAStart( void )
 
   desc = (vbEAServerMode == TRUE) ? &vbEAServerDesc : &vbEAConnDesc;
 
+  // Frames to engine always go through the connection descriptor
+  VbEAFlowStart(&vbEAConnDesc, VbDriverConfEaFlowBudgetGet());
+
   VbEAThreadStart(desc);
 }
 
@@ -581,6 +599,7 @@ void VbEAStart( void )
 
 void VbEAStop( void )
 {
+  VbEAFlowStop();
   VbEAThreadStop(&vbEAConnDesc);
   if(vbEAServerMode == TRUE)
   {
@@ -628,6 +647,8 @@ void VbEAInit( const char *ifeth, INT16U eaiPort, CHAR *remoteIp, BOOL serverMod
     vbEAConnDesc.processRxMsgCb = VbEARxMsgCb;
     vbEAConnDesc.args           = NULL;
     vbEAConnDesc.clientInfo     = NULL;
+    vbEAConnDesc.shmRingSize    = VbDriverConfEaShmRingSizeGet();
+    vbEAConnDesc.ioUring        = VbDriverConfEaIoUringGet();
 
     VbEAClientAddrSet(&vbEAConnDesc, remoteIp, eaiPort,family);
   }
@@ -787,7 +808,7 @@ void VbEAMsgTrafficAwarenessTrgSend(t_vbEAMsg **msg)
   t_vbEAError err;
 
   // Send frame
-  err = VbEAMsgSend(&vbEAConnDesc, *msg);
+  err = VbEAFlowMsgSend(&vbEAConnDesc, msg);
 
   if(err != VB_EA_ERR_NONE)
   {
@@ -998,7 +1019,7 @@ t_VB_comErrorCode VbEACfrRspSend(const INT8U *macMeasurer, const INT8U *macMeasu
     }
 
     // Send frame
-    VbEAMsgSend(&vbEAConnDesc, msg);
+    VbEAFlowMsgSend(&vbEAConnDesc, &msg);
   }
 
   // Always release memory
@@ -1111,7 +1132,7 @@ t_VB_comErrorCode VbEABgnRspSend(const INT8U *mac, INT8U planId, t_processMeasur
     }
 
     // Send frame
-    VbEAMsgSend(&vbEAConnDesc, msg);
+    VbEAFlowMsgSend(&vbEAConnDesc, &msg);
   }
 
   // Always release memory
@@ -1199,7 +1220,7 @@ t_VB_comErrorCode VbEASnrProbesRspSend(const INT8U *mac, t_processMeasure *proce
     }
 
     // Send frame
-    VbEAMsgSend(&vbEAConnDesc, msg);
+    VbEAFlowMsgSend(&vbEAConnDesc, &msg);
   }
 
   // Always release memory
@@ -1240,7 +1261,7 @@ t_VB_comErrorCode VbEAMeasCollectionEndSend(INT8U planId)
     measDone->PlanID = planId;
 
     // Send frame
-    VbEAMsgSend(&vbEAConnDesc, msg);
+    VbEAFlowMsgSend(&vbEAConnDesc, &msg);
 
     VbLogPrint(VB_LOG_INFO, "CFRs collection end sent (err %d)", ret);
   }
@@ -1711,6 +1732,9 @@ void VbEAConnDbgMsgDump(t_writeFun writeFun)
   VbEADbgMsgDump(&(vbEAConnDesc.debugTable), writeFun);
 
   pthread_mutex_unlock(&(vbEAConnDesc.mutex));
+
+  writeFun("\n");
+  VbEATransportDump(&vbEAConnDesc, writeFun);
 }
 
 /*******************************************************************/
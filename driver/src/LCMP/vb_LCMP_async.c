@@ -0,0 +1,1353 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_LCMP_async.c
+ * @brief Asynchronous LCMP requests
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "types.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "vb_driver_conf.h"
+#include "vb_LCMP_async.h"
+#include "vb_LCMP_socket.h"
+#include "vb_DataModel.h"
+#include "vb_log.h"
+#include "vb_mac_utils.h"
+#include "vb_counters.h"
+#include "vb_thread.h"
+#include "vb_priorities.h"
+#include "vb_util.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define LCMP_ASYNC_THREAD_NAME            "LCMPAsync"
+#define LCMP_ASYNC_IDLE_WAIT_MS           (1000)
+#define LCMP_ASYNC_CLOCK_GRANULARITY_US   (1000)   ///< Clock granularity (G) used in RTO computation (RFC 6298)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef enum
+{
+  LCMP_ASYNC_REQ_STATE_QUEUED = 0,                 ///< Waiting for a free in flight slot
+  LCMP_ASYNC_REQ_STATE_IN_FLIGHT,                  ///< Sent, waiting for confirmation
+  LCMP_ASYNC_REQ_STATE_DONE,                       ///< Completed, result available
+} t_lcmpAsyncReqState;
+
+typedef enum
+{
+  LCMP_ASYNC_ACTION_SEND = 0,
+  LCMP_ASYNC_ACTION_RX,
+  LCMP_ASYNC_ACTION_TIMEOUT,
+} t_lcmpAsyncAction;
+
+typedef struct s_lcmpAsyncPeer
+{
+  INT8U                    mac[ETH_ALEN];          ///< Node MAC (or group address for multicast requests)
+  BOOLEAN                  rttValid;               ///< TRUE when at least one RTT sample was taken
+  INT64S                   srttUs;                 ///< Smoothed RTT (us)
+  INT64S                   rttVarUs;               ///< RTT variance (us)
+  INT64S                   lastRttUs;              ///< Last RTT sample (us)
+  INT32U                   rtoMs;                  ///< Current retransmission timeout (ms)
+  INT32U                   inFlight;               ///< Requests currently in flight
+  INT64U                   numReqs;                ///< Requests sent
+  INT64U                   numSamples;             ///< RTT samples taken
+  INT64U                   numTimeouts;            ///< Retransmission timer expirations
+  INT64U                   numRetx;                ///< Retransmissions
+  INT64U                   numEarly;               ///< Multicast requests completed before timeout
+  struct s_lcmpAsyncPeer  *next;
+} t_lcmpAsyncPeer;
+
+struct s_lcmpAsyncReq
+{
+  t_LCMP_OPCODE            opcode;
+  t_Transmision            transmisionType;
+  t_lcmpReqFrame           frame;                  ///< Frame to (re)transmit
+  INT8U                    dstMac[ETH_ALEN];
+  t_ValuesArray           *reqValues;              ///< Copy of requested values (to check confirmation)
+  INT8U                    paramIdReq;
+  INT16U                   transactionId;
+  INT32U                   timeoutMs;              ///< Maximum retransmission timeout
+  t_lcmpNodesListRespCb    respCb;
+  t_Callbacks             *callback;
+  t_lcmpAsyncPeer         *peer;                   ///< Destination (node or group address)
+  INT16U                   numExpected;            ///< Number of nodes expected to answer a multicast request
+  INT8U                   *expectedMacs;
+  t_lcmpAsyncPeer        **expectedPeers;          ///< Peers of expected nodes (their in flight slots are taken)
+  BOOLEAN                  noRetx;                 ///< Never retransmitted (not idempotent)
+  t_HTLVsLists            *rspValues;
+  INT32U                   nAttempts;
+  struct timespec          tsTx;
+  struct timespec          deadline;
+  t_lcmpAsyncReqState      state;
+  BOOLEAN                  rxPending;              ///< Confirmation received, not processed yet
+  BOOLEAN                  finished;               ///< Result is final (set by LCMP async thread)
+  t_HGF_LCMP_ErrorCode     result;
+  t_lcmpAsyncDoneCb        doneCb;
+  void                    *doneArgs;
+  struct s_lcmpAsyncReq   *next;
+};
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static pthread_mutex_t     vbLcmpAsyncMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t      vbLcmpAsyncCond;
+static pthread_cond_t      vbLcmpAsyncDoneCond;
+static pthread_t           vbLcmpAsyncThread;
+static BOOLEAN             vbLcmpAsyncRunning = FALSE;
+static t_lcmpAsyncReq     *vbLcmpAsyncReqHead = NULL;
+static t_lcmpAsyncReq     *vbLcmpAsyncReqTail = NULL;
+static t_lcmpAsyncPeer    *vbLcmpAsyncPeers = NULL;
+
+/*
+ ************************************************************************
+ ** Private function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Gets the peer associated to given MAC. Shall be called with vbLcmpAsyncMutex locked.
+ * @param[in] mac MAC address
+ * @param[in] create Create peer if not found
+ * @return Pointer to peer or NULL
+ **/
+static t_lcmpAsyncPeer *LcmpAsyncPeerGet(const INT8U *mac, BOOLEAN create);
+
+/**
+ * @brief Returns TRUE if the request shall be sent to more than one node
+ **/
+static BOOLEAN LcmpAsyncIsMulticast(const t_lcmpAsyncReq *req);
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+static t_lcmpAsyncPeer *LcmpAsyncPeerGet(const INT8U *mac, BOOLEAN create)
+{
+  t_lcmpAsyncPeer *peer = vbLcmpAsyncPeers;
+
+  while ((peer != NULL) && (memcmp(peer->mac, mac, ETH_ALEN) != 0))
+  {
+    peer = peer->next;
+  }
+
+  if ((peer == NULL) && (create == TRUE))
+  {
+    peer = (t_lcmpAsyncPeer *)calloc(1, sizeof(*peer));
+
+    if (peer != NULL)
+    {
+      MACAddrClone(peer->mac, mac);
+      peer->next = vbLcmpAsyncPeers;
+      vbLcmpAsyncPeers = peer;
+    }
+  }
+
+  return peer;
+}
+
+/*******************************************************************/
+
+static BOOLEAN LcmpAsyncIsMulticast(const t_lcmpAsyncReq *req)
+{
+  return (req->transmisionType == UNICAST)?FALSE:TRUE;
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncPeerRttUpdate(t_lcmpAsyncPeer *peer, INT64S rttUs)
+{
+  INT64S rto_us;
+
+  if (peer->rttValid == FALSE)
+  {
+    // First measurement (RFC 6298, 2.2)
+    peer->srttUs   = rttUs;
+    peer->rttVarUs = rttUs / 2;
+    peer->rttValid = TRUE;
+  }
+  else
+  {
+    // Subsequent measurements (RFC 6298, 2.3): beta = 1/4, alpha = 1/8
+    peer->rttVarUs = ((3 * peer->rttVarUs) + llabs(peer->srttUs - rttUs)) / 4;
+    peer->srttUs   = ((7 * peer->srttUs) + rttUs) / 8;
+  }
+
+  rto_us = peer->srttUs + MAX(LCMP_ASYNC_CLOCK_GRANULARITY_US, 4 * peer->rttVarUs);
+
+  peer->rtoMs     = (INT32U)((rto_us + 999) / 1000);
+  peer->lastRttUs = rttUs;
+  peer->numSamples++;
+}
+
+/*******************************************************************/
+
+static INT32U LcmpAsyncPeerRtoGet(const t_lcmpAsyncPeer *peer, INT32U timeoutMs)
+{
+  INT32U rto_ms = timeoutMs;
+
+  if ((peer != NULL) && (peer->rttValid == TRUE))
+  {
+    rto_ms = MAX(peer->rtoMs, VbDriverConfLcmpMinTimeoutGet());
+    rto_ms = MIN(rto_ms, timeoutMs);
+  }
+
+  return rto_ms;
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncPeerBackoff(t_lcmpAsyncPeer *peer, INT32U timeoutMs)
+{
+  if (peer != NULL)
+  {
+    peer->numTimeouts++;
+
+    if (peer->rttValid == TRUE)
+    {
+      // Exponential backoff (RFC 6298, 5.5), next RTT sample recomputes it
+      peer->rtoMs = MIN(2 * MAX(peer->rtoMs, 1), timeoutMs);
+    }
+  }
+}
+
+/*******************************************************************/
+
+static BOOLEAN LcmpAsyncMacResponded(const t_lcmpAsyncReq *req, const INT8U *mac)
+{
+  BOOLEAN           found = FALSE;
+  t_HTLVValuesList *values = req->rspValues->head;
+
+  while ((values != NULL) && (found == FALSE))
+  {
+    if (memcmp(values->srcMAC, mac, ETH_ALEN) == 0)
+    {
+      found = TRUE;
+    }
+
+    values = values->nextList;
+  }
+
+  return found;
+}
+
+/*******************************************************************/
+
+static INT32U LcmpAsyncReqRtoGet(t_lcmpAsyncReq *req)
+{
+  INT32U rto_ms;
+  INT32U i;
+
+  if (LcmpAsyncIsMulticast(req) == FALSE)
+  {
+    rto_ms = LcmpAsyncPeerRtoGet(req->peer, req->timeoutMs);
+  }
+  else if (req->numExpected == 0)
+  {
+    rto_ms = req->timeoutMs;
+  }
+  else
+  {
+    // Wait for the slowest node not answered yet
+    rto_ms = 0;
+
+    for (i = 0; i < req->numExpected; i++)
+    {
+      const INT8U *mac = &(req->expectedMacs[i * ETH_ALEN]);
+
+      if (LcmpAsyncMacResponded(req, mac) == FALSE)
+      {
+        rto_ms = MAX(rto_ms, LcmpAsyncPeerRtoGet(LcmpAsyncPeerGet(mac, FALSE), req->timeoutMs));
+      }
+    }
+
+    if (rto_ms == 0)
+    {
+      rto_ms = req->timeoutMs;
+    }
+  }
+
+  return rto_ms;
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncReqBackoff(t_lcmpAsyncReq *req)
+{
+  INT32U i;
+
+  pthread_mutex_lock(&vbLcmpAsyncMutex);
+
+  if (LcmpAsyncIsMulticast(req) == FALSE)
+  {
+    LcmpAsyncPeerBackoff(req->peer, req->timeoutMs);
+  }
+  else
+  {
+    req->peer->numTimeouts++;
+
+    for (i = 0; i < req->numExpected; i++)
+    {
+      const INT8U *mac = &(req->expectedMacs[i * ETH_ALEN]);
+
+      if (LcmpAsyncMacResponded(req, mac) == FALSE)
+      {
+        LcmpAsyncPeerBackoff(LcmpAsyncPeerGet(mac, FALSE), req->timeoutMs);
+      }
+    }
+  }
+
+  pthread_mutex_unlock(&vbLcmpAsyncMutex);
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncRttSamplesAdd(t_lcmpAsyncReq *req, const t_HTLVsLists *rspValues)
+{
+  const t_HTLVValuesList *values;
+  t_lcmpAsyncPeer        *peer;
+  INT64S                  rtt_us;
+
+  // Karn's algorithm: confirmations of retransmitted requests are ambiguous
+  if (req->nAttempts == 1)
+  {
+    pthread_mutex_lock(&vbLcmpAsyncMutex);
+
+    for (values = rspValues->head; values != NULL; values = values->nextList)
+    {
+      if (VbUtilTimespecCmp(&(values->timeStamp), &(req->tsTx)) >= 0)
+      {
+        rtt_us = VbUtilElapsetimeTimespecUs(&(req->tsTx), (struct timespec *)&(values->timeStamp));
+
+        if (LcmpAsyncIsMulticast(req) == FALSE)
+        {
+          peer = req->peer;
+        }
+        else
+        {
+          peer = LcmpAsyncPeerGet(values->srcMAC, TRUE);
+        }
+
+        if (peer != NULL)
+        {
+          LcmpAsyncPeerRttUpdate(peer, rtt_us);
+        }
+      }
+    }
+
+    pthread_mutex_unlock(&vbLcmpAsyncMutex);
+  }
+}
+
+/*******************************************************************/
+
+static BOOL LcmpAsyncRxCb(const INT8U *lcmpValue, INT16U length, t_CallbackData *callbackData)
+{
+  t_lcmpAsyncReq *req = NULL;
+  BOOL            found;
+
+  found = VbLcmpRspValuesAdd(lcmpValue, length, callbackData);
+
+  if (found == TRUE)
+  {
+    pthread_mutex_lock(&(callbackData->mutex));
+    callbackData->frameReceived = TRUE;
+    req = (t_lcmpAsyncReq *)callbackData->args;
+    pthread_mutex_unlock(&(callbackData->mutex));
+  }
+
+  if (req != NULL)
+  {
+    // Wake up LCMP async thread
+    pthread_mutex_lock(&vbLcmpAsyncMutex);
+    req->rxPending = TRUE;
+    pthread_cond_signal(&vbLcmpAsyncCond);
+    pthread_mutex_unlock(&vbLcmpAsyncMutex);
+  }
+
+  return found;
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncReqFinish(t_lcmpAsyncReq *req, t_HGF_LCMP_ErrorCode result)
+{
+  if (req->callback != NULL)
+  {
+    LcmpCallBackUninstall(req->callback);
+    req->callback = NULL;
+  }
+
+  req->result   = result;
+  req->finished = TRUE;
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncReqSend(t_lcmpAsyncReq *req)
+{
+  t_HGF_LCMP_ErrorCode result = HGF_LCMP_ERROR_NONE;
+  INT32U               rto_ms;
+  CHAR                 mac_str[MAC_STR_LEN];
+
+  if (req->callback == NULL)
+  {
+    req->callback = LcmpCallBackInstall(LcmpAsyncRxCb,
+                                        req->frame.rxOpcode,
+                                        req->frame.rxHgfOpcode,
+                                        req->frame.rxParamId,
+                                        req->transactionId,
+                                        TRUE);
+
+    if (req->callback == NULL)
+    {
+      result = HGF_LCMP_ERROR_CALLBACK_INSTALATION_ERROR;
+    }
+    else
+    {
+      pthread_mutex_lock(&(req->callback->CallbackData.mutex));
+      req->callback->CallbackData.args = req;
+      pthread_mutex_unlock(&(req->callback->CallbackData.mutex));
+    }
+  }
+
+  if (result == HGF_LCMP_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbLcmpAsyncMutex);
+    rto_ms = LcmpAsyncReqRtoGet(req);
+    if (req->nAttempts == 0)
+    {
+      req->peer->numReqs++;
+    }
+    else
+    {
+      req->peer->numRetx++;
+    }
+    pthread_mutex_unlock(&vbLcmpAsyncMutex);
+
+    result = LcmpPacketSend(req->frame.dstMac, req->opcode, req->frame.mmplLength, req->frame.mmpl);
+
+    clock_gettime(CLOCK_MONOTONIC, &(req->tsTx));
+    VbUtilTimespecMsecAdd(&(req->tsTx), rto_ms, &(req->deadline));
+    req->nAttempts++;
+
+    if (result != HGF_LCMP_ERROR_NONE)
+    {
+      MACAddrMem2str(mac_str, req->frame.dstMac);
+      VbLogPrint(VB_LOG_ERROR,
+                 "Error %d sending async request; LCMP Opcode 0x%X; Param Id %u; Dest MAC %s",
+                 result, req->opcode, req->paramIdReq, mac_str);
+      VbCounterIncrease(VB_DRIVER_COUNTER_LCMP_REQ_TX_ERROR);
+    }
+  }
+
+  if (result != HGF_LCMP_ERROR_NONE)
+  {
+    LcmpAsyncReqFinish(req, result);
+  }
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncReqRetry(t_lcmpAsyncReq *req, t_HGF_LCMP_ErrorCode result, BOOLEAN resetRsp)
+{
+  if ((req->noRetx == FALSE) && (req->nAttempts < MAX(VbDriverConfLcmpDefaultNAttemptGet(), 1)))
+  {
+    if (resetRsp == TRUE)
+    {
+      VbDatamodelHtlvsListValueDestroy(&(req->rspValues));
+      req->rspValues = VbDatamodelHtlvListCreate();
+    }
+
+    if (req->rspValues == NULL)
+    {
+      LcmpAsyncReqFinish(req, HGF_LCMP_ERROR_MALLOC);
+    }
+    else
+    {
+      LcmpAsyncReqSend(req);
+    }
+  }
+  else
+  {
+    LcmpAsyncReqFinish(req, result);
+  }
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncUnicastCheck(t_lcmpAsyncReq *req, BOOLEAN frameReceived, BOOLEAN noResp, BOOLEAN timeout)
+{
+  t_HTLVsLists *rsp = req->rspValues;
+  INT8U         param_id_not_found;
+  CHAR          mac_str[MAC_STR_LEN];
+
+  MACAddrMem2str(mac_str, req->dstMac);
+
+  if ((frameReceived == TRUE) && (noResp == TRUE) &&
+      ((req->frame.rxHgfOpcode == HGF_CONTROL_CONFIRM) || (req->frame.rxHgfOpcode == HGF_WRITE_PARAMETER_CONFIRM)))
+  {
+    // Frame received but confirmation was not present
+    VbLogPrint(VB_LOG_WARNING,
+               "LCMP Cnf invalid (ParamId %u not found); Op 0x%X; ParamId %u; MAC %s;",
+               req->frame.rxHgfOpcode, req->opcode, req->paramIdReq, mac_str);
+    VbCounterIncrease(VB_DRIVER_COUNTER_LCMP_CNF_PARAMID_NOT_FOUND);
+
+    LcmpAsyncReqRetry(req, HGF_LCMP_ERROR_CNF_INVALID, TRUE);
+  }
+  else if ((rsp->NumLists == req->reqValues->NumValues) &&
+           (rsp->head != NULL) &&
+           (rsp->head->HTLVsArray != NULL) &&
+           (rsp->head->HTLVsArray->NumValues > 0))
+  {
+    if (((req->opcode == LCMP_CTRL_REQ) || (req->opcode == LCMP_WRITE_REQ)) &&
+        (memcmp(rsp->head->srcMAC, req->dstMac, ETH_ALEN) == 0) &&
+        (VbLcmpCnfParamsCheck(req->reqValues, rsp->head->HTLVsArray, &param_id_not_found) == FALSE))
+    {
+      VbLogPrint(VB_LOG_WARNING,
+                 "LCMP Cnf invalid (ParamId %u not found); Op 0x%X; ParamId %u; MAC %s; Exp Cnf Val %u; Rx Cnf Values %u;",
+                 param_id_not_found, req->opcode, req->paramIdReq, mac_str,
+                 req->reqValues->NumValues, rsp->NumLists);
+      VbCounterIncrease(VB_DRIVER_COUNTER_LCMP_CNF_PARAMID_NOT_FOUND);
+
+      LcmpAsyncReqRetry(req, HGF_LCMP_ERROR_CNF_INVALID, TRUE);
+    }
+    else
+    {
+      LcmpAsyncReqFinish(req, HGF_LCMP_ERROR_NONE);
+    }
+  }
+  else if (timeout == TRUE)
+  {
+    LcmpAsyncReqBackoff(req);
+
+    if (rsp->NumLists == 0)
+    {
+      VbLogPrint(VB_LOG_WARNING,
+                 "No response; LCMP Opcode 0x%X; Param Id %u; Dest MAC %s",
+                 req->opcode, req->paramIdReq, mac_str);
+      VbCounterIncrease(VB_DRIVER_COUNTER_LCMP_REQ_NO_RESPONSE);
+
+      LcmpAsyncReqRetry(req, HGF_LCMP_ERROR_NO_RESPONSE, TRUE);
+    }
+    else
+    {
+      VbLogPrint(VB_LOG_ERROR,
+                 "LCMP Cnf error; Op 0x%X; ParamId %u; MAC %s; Exp Cnf Val %u; Rx Cnf Values %u;",
+                 req->opcode, req->paramIdReq, mac_str,
+                 req->reqValues->NumValues, rsp->NumLists);
+      VbCounterIncrease(VB_DRIVER_COUNTER_LCMP_CNF_ERROR);
+
+      LcmpAsyncReqRetry(req, HGF_LCMP_ERROR_CNF_INCOMPLETE, TRUE);
+    }
+  }
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncMulticastCheck(t_lcmpAsyncReq *req, BOOLEAN timeout)
+{
+  t_vb_LCMP_BroadcastResponseCheck check;
+  BOOLEAN                          all_responded;
+  INT32U                           i;
+  CHAR                             mac_str[MAC_STR_LEN];
+
+  all_responded = (req->numExpected > 0)?TRUE:FALSE;
+
+  for (i = 0; (i < req->numExpected) && (all_responded == TRUE); i++)
+  {
+    all_responded = LcmpAsyncMacResponded(req, &(req->expectedMacs[i * ETH_ALEN]));
+  }
+
+  if ((all_responded == TRUE) && (timeout == FALSE))
+  {
+    pthread_mutex_lock(&vbLcmpAsyncMutex);
+    req->peer->numEarly++;
+    pthread_mutex_unlock(&vbLcmpAsyncMutex);
+  }
+
+  if ((all_responded == TRUE) || (timeout == TRUE))
+  {
+    MACAddrMem2str(mac_str, req->frame.dstMac);
+
+    if (timeout == TRUE)
+    {
+      LcmpAsyncReqBackoff(req);
+    }
+
+    if (req->rspValues->head == NULL)
+    {
+      VbLogPrint(VB_LOG_WARNING,
+                 "No response; LCMP Opcode 0x%X; Param Id %u; Dest MAC %s",
+                 req->opcode, req->paramIdReq, mac_str);
+      VbCounterIncrease(VB_DRIVER_COUNTER_LCMP_REQ_NO_RESPONSE);
+
+      LcmpAsyncReqRetry(req, HGF_LCMP_ERROR_NO_RESPONSE, FALSE);
+    }
+    else if ((req->opcode == LCMP_CTRL_REQ) || (req->opcode == LCMP_WRITE_REQ))
+    {
+      check = VbLcmpNodesListResponseCheck(req->rspValues,
+                                           (req->transmisionType == MULTICAST)?FALSE:TRUE,
+                                           req->respCb, req->tsTx);
+
+      switch (check)
+      {
+        case VB_LCMP_BROADCAST_RESPONSE_OK:
+        {
+          LcmpAsyncReqFinish(req, HGF_LCMP_ERROR_NONE);
+          break;
+        }
+        case VB_LCMP_BROADCAST_RESPONSE_ERROR_NOT_ALL_RESPONSE:
+        case VB_LCMP_BROADCAST_RESPONSE_ERROR_NOONE_RESPONSE:
+        {
+          VbLogPrint(VB_LOG_WARNING,
+                     "LCMP Multicast Request not received by all devices; Op 0x%X; ParamId 0x%X; MAC %s;",
+                     req->opcode, req->paramIdReq, mac_str);
+          VbCounterIncrease(VB_DRIVER_COUNTER_LCMP_REQ_NOT_ALL_DEV);
+
+          // Keep received confirmations, only missing nodes are awaited
+          LcmpAsyncReqRetry(req, HGF_LCMP_ERROR_REQ_NOT_ALL_DEVICES, FALSE);
+          break;
+        }
+        default:
+        {
+          VbLogPrint(VB_LOG_ERROR,
+                     "LCMP Multicast Request unknown error (%d); Op 0x%X; ParamId 0x%X; MAC %s;",
+                     check, req->opcode, req->paramIdReq, mac_str);
+          VbCounterIncrease(VB_DRIVER_COUNTER_LCMP_REQ_UNKNOWN_ERROR);
+
+          LcmpAsyncReqFinish(req, HGF_LCMP_ERROR_REQ_UNKOWN_ERR);
+          break;
+        }
+      }
+    }
+    else
+    {
+      LcmpAsyncReqFinish(req, HGF_LCMP_ERROR_NONE);
+    }
+  }
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncReqCollect(t_lcmpAsyncReq *req, BOOLEAN timeout)
+{
+  t_HTLVsLists *rsp_values;
+  BOOLEAN       frame_received = FALSE;
+  BOOLEAN       no_resp = TRUE;
+
+  rsp_values = LcmpCallBackReceiveGet(req->callback, &frame_received);
+
+  if (rsp_values != NULL)
+  {
+    no_resp = (rsp_values->NumLists == 0)?TRUE:FALSE;
+
+    LcmpAsyncRttSamplesAdd(req, rsp_values);
+    vbLcmpTempListToListAdd(req->rspValues, rsp_values);
+  }
+
+  if (LcmpAsyncIsMulticast(req) == FALSE)
+  {
+    LcmpAsyncUnicastCheck(req, frame_received, no_resp, timeout);
+  }
+  else
+  {
+    LcmpAsyncMulticastCheck(req, timeout);
+  }
+}
+
+/*******************************************************************/
+
+static void LcmpAsyncReqFree(t_lcmpAsyncReq *req)
+{
+  if (req != NULL)
+  {
+    if (req->frame.mmpl != NULL)
+    {
+      free(req->frame.mmpl);
+    }
+
+    if (req->expectedMacs != NULL)
+    {
+      free(req->expectedMacs);
+    }
+
+    if (req->expectedPeers != NULL)
+    {
+      free(req->expectedPeers);
+    }
+
+    VbDatamodelHTLVsArrayDestroy(&(req->reqValues));
+    VbDatamodelHtlvsListValueDestroy(&(req->rspValues));
+
+    free(req);
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Takes one in flight slot of every destination node: the node of a
+ * unicast request or each node expected to answer a multicast request.
+ * Shall be called with vbLcmpAsyncMutex locked.
+ * @return TRUE if slots were taken; FALSE if any destination has no free slot
+ **/
+static BOOLEAN LcmpAsyncReqSlotsTake(t_lcmpAsyncReq *req)
+{
+  BOOLEAN free_slots = TRUE;
+  INT32U  i;
+
+  if (req->expectedPeers == NULL)
+  {
+    free_slots = (req->peer->inFlight < VbDriverConfLcmpMaxInFlightGet())?TRUE:FALSE;
+  }
+
+  for (i = 0; (req->expectedPeers != NULL) && (i < req->numExpected) && (free_slots == TRUE); i++)
+  {
+    free_slots = (req->expectedPeers[i]->inFlight < VbDriverConfLcmpMaxInFlightGet())?TRUE:FALSE;
+  }
+
+  if (free_slots == TRUE)
+  {
+    req->peer->inFlight++;
+
+    for (i = 0; (req->expectedPeers != NULL) && (i < req->numExpected); i++)
+    {
+      req->expectedPeers[i]->inFlight++;
+    }
+  }
+
+  return free_slots;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Releases the in flight slots taken by @ref LcmpAsyncReqSlotsTake.
+ * Shall be called with vbLcmpAsyncMutex locked.
+ **/
+static void LcmpAsyncReqSlotsRelease(t_lcmpAsyncReq *req)
+{
+  INT32U i;
+
+  if (req->peer->inFlight > 0)
+  {
+    req->peer->inFlight--;
+  }
+
+  for (i = 0; (req->expectedPeers != NULL) && (i < req->numExpected); i++)
+  {
+    if (req->expectedPeers[i]->inFlight > 0)
+    {
+      req->expectedPeers[i]->inFlight--;
+    }
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Removes a finished request from queue and notifies its completion.
+ * Shall be called with vbLcmpAsyncMutex locked; it is temporarily released to run completion callback.
+ **/
+static void LcmpAsyncReqComplete(t_lcmpAsyncReq *req)
+{
+  t_lcmpAsyncReq *prev = NULL;
+  t_lcmpAsyncReq *curr = vbLcmpAsyncReqHead;
+
+  while ((curr != NULL) && (curr != req))
+  {
+    prev = curr;
+    curr = curr->next;
+  }
+
+  if (curr != NULL)
+  {
+    if (prev == NULL)
+    {
+      vbLcmpAsyncReqHead = req->next;
+    }
+    else
+    {
+      prev->next = req->next;
+    }
+
+    if (vbLcmpAsyncReqTail == req)
+    {
+      vbLcmpAsyncReqTail = prev;
+    }
+  }
+
+  req->next = NULL;
+
+  if (req->state == LCMP_ASYNC_REQ_STATE_IN_FLIGHT)
+  {
+    LcmpAsyncReqSlotsRelease(req);
+  }
+
+  req->state = LCMP_ASYNC_REQ_STATE_DONE;
+
+  if (req->doneCb != NULL)
+  {
+    pthread_mutex_unlock(&vbLcmpAsyncMutex);
+
+    req->doneCb(req->result, &(req->rspValues), req->doneArgs);
+    LcmpAsyncReqFree(req);
+
+    pthread_mutex_lock(&vbLcmpAsyncMutex);
+  }
+  else
+  {
+    pthread_cond_broadcast(&vbLcmpAsyncDoneCond);
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Looks for the next request to process. Shall be called with vbLcmpAsyncMutex locked.
+ * @param[out] action Action to perform
+ * @param[out] wakeUp Time to wake up if no request has to be processed now
+ * @return Request to process or NULL
+ **/
+static t_lcmpAsyncReq *LcmpAsyncNextActionGet(t_lcmpAsyncAction *action, struct timespec *wakeUp)
+{
+  t_lcmpAsyncReq  *req;
+  struct timespec  now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  VbUtilTimespecMsecAdd(&now, LCMP_ASYNC_IDLE_WAIT_MS, wakeUp);
+
+  for (req = vbLcmpAsyncReqHead; req != NULL; req = req->next)
+  {
+    if (req->state == LCMP_ASYNC_REQ_STATE_QUEUED)
+    {
+      // Requests to the same peer are sent in order as in flight slots get free
+      if (LcmpAsyncReqSlotsTake(req) == TRUE)
+      {
+        req->state = LCMP_ASYNC_REQ_STATE_IN_FLIGHT;
+        *action = LCMP_ASYNC_ACTION_SEND;
+        break;
+      }
+    }
+    else if (req->state == LCMP_ASYNC_REQ_STATE_IN_FLIGHT)
+    {
+      if (req->rxPending == TRUE)
+      {
+        req->rxPending = FALSE;
+        *action = LCMP_ASYNC_ACTION_RX;
+        break;
+      }
+      else if (VbUtilTimespecCmp(&now, &(req->deadline)) >= 0)
+      {
+        *action = LCMP_ASYNC_ACTION_TIMEOUT;
+        break;
+      }
+      else if (VbUtilTimespecCmp(&(req->deadline), wakeUp) < 0)
+      {
+        *wakeUp = req->deadline;
+      }
+    }
+  }
+
+  return req;
+}
+
+/*******************************************************************/
+
+static void *LcmpAsyncThreadProcess(void *arg)
+{
+  t_lcmpAsyncReq    *req;
+  t_lcmpAsyncAction  action = LCMP_ASYNC_ACTION_SEND;
+  struct timespec    wake_up;
+
+  pthread_mutex_lock(&vbLcmpAsyncMutex);
+
+  while (vbLcmpAsyncRunning == TRUE)
+  {
+    req = LcmpAsyncNextActionGet(&action, &wake_up);
+
+    if (req == NULL)
+    {
+      pthread_cond_timedwait(&vbLcmpAsyncCond, &vbLcmpAsyncMutex, &wake_up);
+    }
+    else
+    {
+      // LCMP calls are done without holding the lock (Rx callbacks take it)
+      pthread_mutex_unlock(&vbLcmpAsyncMutex);
+
+      switch (action)
+      {
+        case LCMP_ASYNC_ACTION_SEND:
+        {
+          LcmpAsyncReqSend(req);
+          break;
+        }
+        case LCMP_ASYNC_ACTION_RX:
+        {
+          LcmpAsyncReqCollect(req, FALSE);
+          break;
+        }
+        case LCMP_ASYNC_ACTION_TIMEOUT:
+        default:
+        {
+          LcmpAsyncReqCollect(req, TRUE);
+          break;
+        }
+      }
+
+      pthread_mutex_lock(&vbLcmpAsyncMutex);
+
+      if (req->finished == TRUE)
+      {
+        LcmpAsyncReqComplete(req);
+      }
+    }
+  }
+
+  // Abort pending requests
+  while (vbLcmpAsyncReqHead != NULL)
+  {
+    req = vbLcmpAsyncReqHead;
+
+    pthread_mutex_unlock(&vbLcmpAsyncMutex);
+    LcmpAsyncReqFinish(req, HGF_LCMP_ERROR_ABORTED);
+    pthread_mutex_lock(&vbLcmpAsyncMutex);
+
+    LcmpAsyncReqComplete(req);
+  }
+
+  pthread_mutex_unlock(&vbLcmpAsyncMutex);
+
+  return NULL;
+}
+
+/*******************************************************************/
+
+static t_HGF_LCMP_ErrorCode LcmpAsyncReqPost(t_LCMP_OPCODE lcmpOpcode, t_lcmpComParams *lcmpParams,
+                                            t_lcmpAsyncDoneCb doneCb, void *args, t_lcmpAsyncReq **reqHandle)
+{
+  t_HGF_LCMP_ErrorCode result = HGF_LCMP_ERROR_NONE;
+  t_lcmpAsyncReq      *req = NULL;
+  INT32U               i;
+
+  if ((lcmpParams == NULL) ||
+      (lcmpParams->reqValues == NULL) ||
+      ((doneCb == NULL) && (reqHandle == NULL)))
+  {
+    result = HGF_LCMP_ERROR_BAD_ARGS;
+  }
+
+  if (result == HGF_LCMP_ERROR_NONE)
+  {
+    req = (t_lcmpAsyncReq *)calloc(1, sizeof(*req));
+
+    if (req == NULL)
+    {
+      result = HGF_LCMP_ERROR_MALLOC;
+    }
+  }
+
+  if (result == HGF_LCMP_ERROR_NONE)
+  {
+    result = VbLcmpReqBuild(lcmpOpcode, lcmpParams, &(req->frame));
+  }
+
+  if (result == HGF_LCMP_ERROR_NONE)
+  {
+    // Keep own copy of destination MAC, caller memory may be released
+    MACAddrClone(req->dstMac, req->frame.dstMac);
+    if (lcmpParams->transmisionType == UNICAST)
+    {
+      req->frame.dstMac = req->dstMac;
+    }
+
+    req->opcode          = lcmpOpcode;
+    req->transmisionType = lcmpParams->transmisionType;
+    req->paramIdReq      = lcmpParams->paramIdReq;
+    req->transactionId   = lcmpParams->transactionId;
+    req->respCb          = lcmpParams->respCb;
+    req->timeoutMs       = (lcmpParams->timeoutMs > 0)?lcmpParams->timeoutMs:VbDriverConfLcmpDefaultTimeoutGet();
+    req->noRetx          = lcmpParams->noRetx;
+    req->doneCb          = doneCb;
+    req->doneArgs        = args;
+    req->result          = HGF_LCMP_ERROR_NONE;
+    req->rspValues       = VbDatamodelHtlvListCreate();
+
+    if ((req->rspValues == NULL) ||
+        (VbDatamodelHTLVsArrayCopy(lcmpParams->reqValues, &(req->reqValues)) != VB_COM_ERROR_NONE))
+    {
+      result = HGF_LCMP_ERROR_MALLOC;
+    }
+  }
+
+  if ((result == HGF_LCMP_ERROR_NONE) && (LcmpAsyncIsMulticast(req) == TRUE))
+  {
+    // Snapshot the set of nodes expected to answer, each of them is charged an in flight slot
+    if (VbDatamodelGetActiveMacsArray(&(req->numExpected), &(req->expectedMacs),
+                                      (req->transmisionType == MULTICAST_DMS)?TRUE:FALSE) != VB_COM_ERROR_NONE)
+    {
+      req->numExpected = 0;
+      req->expectedMacs = NULL;
+    }
+
+    if (req->numExpected > 0)
+    {
+      req->expectedPeers = (t_lcmpAsyncPeer **)calloc(req->numExpected, sizeof(t_lcmpAsyncPeer *));
+
+      if (req->expectedPeers == NULL)
+      {
+        result = HGF_LCMP_ERROR_MALLOC;
+      }
+    }
+  }
+
+  if (result == HGF_LCMP_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbLcmpAsyncMutex);
+
+    if (vbLcmpAsyncRunning == FALSE)
+    {
+      result = HGF_LCMP_ERROR_NOT_RUNNING;
+    }
+    else
+    {
+      req->peer = LcmpAsyncPeerGet(req->dstMac, TRUE);
+
+      if (req->peer == NULL)
+      {
+        result = HGF_LCMP_ERROR_MALLOC;
+      }
+    }
+
+    for (i = 0; (result == HGF_LCMP_ERROR_NONE) && (req->expectedPeers != NULL) && (i < req->numExpected); i++)
+    {
+      req->expectedPeers[i] = LcmpAsyncPeerGet(&(req->expectedMacs[i * ETH_ALEN]), TRUE);
+
+      if (req->expectedPeers[i] == NULL)
+      {
+        result = HGF_LCMP_ERROR_MALLOC;
+      }
+    }
+
+    if (result == HGF_LCMP_ERROR_NONE)
+    {
+      if (vbLcmpAsyncReqTail == NULL)
+      {
+        vbLcmpAsyncReqHead = req;
+      }
+      else
+      {
+        vbLcmpAsyncReqTail->next = req;
+      }
+      vbLcmpAsyncReqTail = req;
+
+      pthread_cond_signal(&vbLcmpAsyncCond);
+    }
+
+    pthread_mutex_unlock(&vbLcmpAsyncMutex);
+  }
+
+  if (reqHandle != NULL)
+  {
+    // Requests with completion callback are released by LCMP async thread
+    *reqHandle = ((result == HGF_LCMP_ERROR_NONE) && (doneCb == NULL))?req:NULL;
+  }
+
+  if (result != HGF_LCMP_ERROR_NONE)
+  {
+    LcmpAsyncReqFree(req);
+  }
+
+  return result;
+}
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+void VbLcmpAsyncInit(void)
+{
+  pthread_condattr_t attr;
+
+  pthread_condattr_init(&attr);
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  pthread_cond_init(&vbLcmpAsyncCond, &attr);
+  pthread_condattr_destroy(&attr);
+
+  pthread_cond_init(&vbLcmpAsyncDoneCond, NULL);
+
+  vbLcmpAsyncRunning = FALSE;
+  vbLcmpAsyncReqHead = NULL;
+  vbLcmpAsyncReqTail = NULL;
+  vbLcmpAsyncPeers = NULL;
+}
+
+/*******************************************************************/
+
+t_HGF_LCMP_ErrorCode VbLcmpAsyncStart(void)
+{
+  t_HGF_LCMP_ErrorCode result = HGF_LCMP_ERROR_NONE;
+  BOOLEAN              running;
+
+  pthread_mutex_lock(&vbLcmpAsyncMutex);
+  vbLcmpAsyncRunning = TRUE;
+  pthread_mutex_unlock(&vbLcmpAsyncMutex);
+
+  running = VbThreadCreate(LCMP_ASYNC_THREAD_NAME, LcmpAsyncThreadProcess, NULL, VB_DRIVER_LCMP_ASYNC_THREAD_CLASS, &vbLcmpAsyncThread);
+
+  if (running == FALSE)
+  {
+    VbLogPrint(VB_LOG_ERROR,"Can't create %s thread", LCMP_ASYNC_THREAD_NAME);
+
+    pthread_mutex_lock(&vbLcmpAsyncMutex);
+    vbLcmpAsyncRunning = FALSE;
+    pthread_mutex_unlock(&vbLcmpAsyncMutex);
+
+    result = HGF_LCMP_ERROR_PTHREAD_CREATE;
+  }
+
+  return result;
+}
+
+/*******************************************************************/
+
+void VbLcmpAsyncStop(void)
+{
+  BOOLEAN          running;
+  t_lcmpAsyncPeer *peer;
+
+  pthread_mutex_lock(&vbLcmpAsyncMutex);
+  running = vbLcmpAsyncRunning;
+  vbLcmpAsyncRunning = FALSE;
+  pthread_cond_signal(&vbLcmpAsyncCond);
+  pthread_mutex_unlock(&vbLcmpAsyncMutex);
+
+  if (running == TRUE)
+  {
+    VbThreadJoin(vbLcmpAsyncThread, LCMP_ASYNC_THREAD_NAME);
+  }
+
+  pthread_mutex_lock(&vbLcmpAsyncMutex);
+  while (vbLcmpAsyncPeers != NULL)
+  {
+    peer = vbLcmpAsyncPeers;
+    vbLcmpAsyncPeers = peer->next;
+    free(peer);
+  }
+  pthread_mutex_unlock(&vbLcmpAsyncMutex);
+}
+
+/*******************************************************************/
+
+t_HGF_LCMP_ErrorCode VbLcmpAsyncRead(t_lcmpComParams *lcmpParams, t_lcmpAsyncDoneCb doneCb, void *args, t_lcmpAsyncReq **req)
+{
+  return LcmpAsyncReqPost(LCMP_READ_REQ, lcmpParams, doneCb, args, req);
+}
+
+/*******************************************************************/
+
+t_HGF_LCMP_ErrorCode VbLcmpAsyncWrite(t_lcmpComParams *lcmpParams, t_lcmpAsyncDoneCb doneCb, void *args, t_lcmpAsyncReq **req)
+{
+  return LcmpAsyncReqPost(LCMP_WRITE_REQ, lcmpParams, doneCb, args, req);
+}
+
+/*******************************************************************/
+
+t_HGF_LCMP_ErrorCode VbLcmpAsyncControl(t_lcmpComParams *lcmpParams, t_lcmpAsyncDoneCb doneCb, void *args, t_lcmpAsyncReq **req)
+{
+  return LcmpAsyncReqPost(LCMP_CTRL_REQ, lcmpParams, doneCb, args, req);
+}
+
+/*******************************************************************/
+
+t_HGF_LCMP_ErrorCode VbLcmpAsyncWait(t_lcmpAsyncReq *req, t_HTLVsLists **rspValuesList)
+{
+  t_HGF_LCMP_ErrorCode result;
+
+  if (req == NULL)
+  {
+    result = HGF_LCMP_ERROR_BAD_ARGS;
+  }
+  else
+  {
+    pthread_mutex_lock(&vbLcmpAsyncMutex);
+    while (req->state != LCMP_ASYNC_REQ_STATE_DONE)
+    {
+      pthread_cond_wait(&vbLcmpAsyncDoneCond, &vbLcmpAsyncMutex);
+    }
+    pthread_mutex_unlock(&vbLcmpAsyncMutex);
+
+    result = req->result;
+
+    if (rspValuesList != NULL)
+    {
+      // Its allocated memory shall be released by caller
+      *rspValuesList = req->rspValues;
+      req->rspValues = NULL;
+    }
+
+    LcmpAsyncReqFree(req);
+  }
+
+  return result;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbLcmpAsyncDoneGet(t_lcmpAsyncReq *req)
+{
+  BOOLEAN done = FALSE;
+
+  if (req != NULL)
+  {
+    pthread_mutex_lock(&vbLcmpAsyncMutex);
+    done = (req->state == LCMP_ASYNC_REQ_STATE_DONE)?TRUE:FALSE;
+    pthread_mutex_unlock(&vbLcmpAsyncMutex);
+  }
+
+  return done;
+}
+
+/*******************************************************************/
+
+void VbLcmpAsyncPeersDump(t_writeFun writeFun)
+{
+  t_lcmpAsyncPeer *peer;
+  t_lcmpAsyncReq  *req;
+  INT32U           num_reqs = 0;
+  CHAR             mac_str[MAC_STR_LEN];
+
+  pthread_mutex_lock(&vbLcmpAsyncMutex);
+
+  for (req = vbLcmpAsyncReqHead; req != NULL; req = req->next)
+  {
+    num_reqs++;
+  }
+
+  writeFun("Async LCMP running                 %s\n", (vbLcmpAsyncRunning == TRUE)?"YES":"NO");
+  writeFun("Pending requests                   %lu\n", num_reqs);
+  writeFun("Min / max RTO (ms)                 %lu / %lu\n", VbDriverConfLcmpMinTimeoutGet(), VbDriverConfLcmpDefaultTimeoutGet());
+  writeFun("Max in flight per node             %lu\n\n", VbDriverConfLcmpMaxInFlightGet());
+
+  writeFun("===============================================================================================================\n");
+  writeFun("|       MAC         | SRTT(us) | RTTVAR(us) | Last(us) | RTO(ms) | Flight |  Reqs  | Tmout  | Retx   | Early  |\n");
+  writeFun("===============================================================================================================\n");
+
+  for (peer = vbLcmpAsyncPeers; peer != NULL; peer = peer->next)
+  {
+    MACAddrMem2str(mac_str, peer->mac);
+
+    writeFun("| %17s | %8lld | %10lld | %8lld | %7lu | %6lu | %6llu | %6llu | %6llu | %6llu |\n",
+             mac_str,
+             peer->srttUs,
+             peer->rttVarUs,
+             peer->lastRttUs,
+             LcmpAsyncPeerRtoGet(peer, VbDriverConfLcmpDefaultTimeoutGet()),
+             peer->inFlight,
+             peer->numReqs,
+             peer->numTimeouts,
+             peer->numRetx,
+             peer->numEarly);
+  }
+
+  writeFun("===============================================================================================================\n");
+
+  pthread_mutex_unlock(&vbLcmpAsyncMutex);
+}
+
+/*******************************************************************/
+
+void VbLcmpAsyncPeersReset(void)
+{
+  t_lcmpAsyncPeer *peer;
+
+  pthread_mutex_lock(&vbLcmpAsyncMutex);
+
+  for (peer = vbLcmpAsyncPeers; peer != NULL; peer = peer->next)
+  {
+    peer->rttValid    = FALSE;
+    peer->srttUs      = 0;
+    peer->rttVarUs    = 0;
+    peer->lastRttUs   = 0;
+    peer->rtoMs       = 0;
+    peer->numReqs     = 0;
+    peer->numSamples  = 0;
+    peer->numTimeouts = 0;
+    peer->numRetx     = 0;
+    peer->numEarly    = 0;
+  }
+
+  pthread_mutex_unlock(&vbLcmpAsyncMutex);
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/
@@ -0,0 +1,173 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_LCMP_async.h
+ * @brief Asynchronous LCMP requests
+ *
+ * @internal
+ *
+ * Requests are sent by a dedicated thread and completed through a callback
+ * or a future (@ref VbLcmpAsyncWait). Retransmission timeouts are adapted
+ * per node from smoothed RTT and RTT variance (as TCP does), multicast
+ * requests complete as soon as every expected node has answered and the
+ * number of requests in flight per node is limited (a multicast request
+ * takes a slot of every node expected to answer). Requests flagged as not
+ * idempotent (noRetx) are never retransmitted.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_LCMP_ASYNC_H_
+#define VB_LCMP_ASYNC_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_console.h"
+#include "vb_LCMP_com.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef struct s_lcmpAsyncReq t_lcmpAsyncReq;
+
+/**
+ * @brief Completion callback of an asynchronous LCMP request. Executed by LCMP async thread.
+ * @param[in] result Result of request
+ * @param[in,out] rspValuesList HTLVs received in confirmation frames. Callback can take ownership setting it to NULL,
+ * otherwise it is released when callback returns.
+ * @param[in] args Generic argument given when request was sent
+ **/
+typedef void (*t_lcmpAsyncDoneCb)(t_HGF_LCMP_ErrorCode result, t_HTLVsLists **rspValuesList, void *args);
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Initializes asynchronous LCMP component
+ **/
+void VbLcmpAsyncInit(void);
+
+/**
+ * @brief Starts LCMP async thread
+ * @return @ref t_HGF_LCMP_ErrorCode
+ **/
+t_HGF_LCMP_ErrorCode VbLcmpAsyncStart(void);
+
+/**
+ * @brief Stops LCMP async thread. Pending requests are completed with error.
+ **/
+void VbLcmpAsyncStop(void);
+
+/**
+ * @brief Sends an asynchronous read request
+ * @param[in] lcmpParams LCMP parameters (as for @ref VbLcmpRead). Request values are copied, so they can be released
+ * as soon as this function returns. rspValuesList and notifyValues fields are not used.
+ * @param[in] doneCb Completion callback. If NULL, request shall be completed with @ref VbLcmpAsyncWait.
+ * @param[in] args Generic argument passed to doneCb
+ * @param[out] req Request handle (only when doneCb is NULL)
+ * @return @ref t_HGF_LCMP_ErrorCode
+ **/
+t_HGF_LCMP_ErrorCode VbLcmpAsyncRead(t_lcmpComParams *lcmpParams, t_lcmpAsyncDoneCb doneCb, void *args, t_lcmpAsyncReq **req);
+
+/**
+ * @brief Sends an asynchronous write request
+ * @param[in] lcmpParams LCMP parameters (see @ref VbLcmpAsyncRead)
+ * @param[in] doneCb Completion callback. If NULL, request shall be completed with @ref VbLcmpAsyncWait.
+ * @param[in] args Generic argument passed to doneCb
+ * @param[out] req Request handle (only when doneCb is NULL)
+ * @return @ref t_HGF_LCMP_ErrorCode
+ **/
+t_HGF_LCMP_ErrorCode VbLcmpAsyncWrite(t_lcmpComParams *lcmpParams, t_lcmpAsyncDoneCb doneCb, void *args, t_lcmpAsyncReq **req);
+
+/**
+ * @brief Sends an asynchronous control request
+ * @param[in] lcmpParams LCMP parameters (see @ref VbLcmpAsyncRead)
+ * @param[in] doneCb Completion callback. If NULL, request shall be completed with @ref VbLcmpAsyncWait.
+ * @param[in] args Generic argument passed to doneCb
+ * @param[out] req Request handle (only when doneCb is NULL)
+ * @return @ref t_HGF_LCMP_ErrorCode
+ **/
+t_HGF_LCMP_ErrorCode VbLcmpAsyncControl(t_lcmpComParams *lcmpParams, t_lcmpAsyncDoneCb doneCb, void *args, t_lcmpAsyncReq **req);
+
+/**
+ * @brief Waits until given request is completed and releases it
+ * @param[in] req Request handle returned by @ref VbLcmpAsyncRead, @ref VbLcmpAsyncWrite or @ref VbLcmpAsyncControl
+ * @param[out] rspValuesList HTLVs received in confirmation frames (optional). Shall be released by caller.
+ * @return Result of request
+ **/
+t_HGF_LCMP_ErrorCode VbLcmpAsyncWait(t_lcmpAsyncReq *req, t_HTLVsLists **rspValuesList);
+
+/**
+ * @brief Checks whether given request is completed, without blocking
+ * @param[in] req Request handle
+ * @return TRUE if completed (@ref VbLcmpAsyncWait will not block); FALSE otherwise
+ **/
+BOOLEAN VbLcmpAsyncDoneGet(t_lcmpAsyncReq *req);
+
+/**
+ * @brief Dumps per node RTT estimations and retransmission timeouts
+ * @param[in] writeFun Function to dump info
+ **/
+void VbLcmpAsyncPeersDump(t_writeFun writeFun);
+
+/**
+ * @brief Resets per node RTT estimations and counters
+ **/
+void VbLcmpAsyncPeersReset(void);
+
+#endif /* VB_LCMP_ASYNC_H_ */
+
+/**
+ * @}
+**/
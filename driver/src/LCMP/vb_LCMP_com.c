@@ -559,126 +559,27 @@ static BOOL VbLcmpCallback( const INT8U *lcmpValue, INT16U length, t_CallbackDat
 
 static t_HGF_LCMP_ErrorCode VbLcmpReq(t_LCMP_OPCODE lcmpOpcode, t_lcmpComParams *lcmpParams)
 {
-  INT8U                           *mmpl = NULL;
   t_HGF_LCMP_ErrorCode             result = HGF_LCMP_ERROR_NONE;
-  t_VB_comErrorCode                vb_com_err = VB_COM_ERROR_NONE;
   t_vb_LCMP_BroadcastResponseCheck broadcast_response_check_result = VB_LCMP_BROADCAST_RESPONSE_OK;
-  INT16U                           mmpl_length;
+  t_lcmpReqFrame                   req_frame;
   const INT8U *                   dest_mac = NULL;
-  INT16U                           lcmp_value_length = 0;
-  INT8U                           *lcmp_value;
-  INT16U                           offset_htlv;
   t_Callbacks                     *callback_installed = NULL;
-  t_LCMP_OPCODE                    receive_opcode = 0;
-  t_HGF_TLV                        receivehgf_opcode = 0;
-  t_HGF_TLV                        sendhgf_opcode = 0;
   t_HTLVsLists                    *confirm_values = NULL;
   t_HTLVsLists                    *final_confirm_values = NULL;
-  INT32U                           params_to_check_idx = 0;
-  INT32U                           confirm_idx = 0;
-  INT16U                           num_control;
-  BOOLEAN                          param_confirmed = FALSE;
   BOOLEAN                          check_only_dms = FALSE;
-  BOOLEAN                          store_ts_rx = FALSE;
   CHAR                             mac_str[MAC_STR_LEN];
-  INT8U                            receive_param_id;
 
-  if ((lcmpParams == NULL) ||
-      (lcmpParams->reqValues == NULL))
-  {
-    result = HGF_LCMP_ERROR_BAD_ARGS;
-  }
-
-  if (result == HGF_LCMP_ERROR_NONE)
-  {
-    switch(lcmpOpcode)
-    {
-      case LCMP_CTRL_REQ:
-      {
-        receive_opcode    =  LCMP_CTRL_CNF;
-        receivehgf_opcode = HGF_CONTROL_CONFIRM;
-        receive_param_id  = lcmpParams->paramIdReq;
-        sendhgf_opcode    = HGF_CONTROL;
-        break;
-      }
-      case LCMP_WRITE_REQ:
-      {
-        receive_opcode    = LCMP_WRITE_CNF;
-        receivehgf_opcode = HGF_WRITE_PARAMETER_CONFIRM;
-        receive_param_id  = lcmpParams->paramIdReq;
-        sendhgf_opcode    = HGF_PARAMETER;
-        break;
-      }
-      case LCMP_READ_REQ:
-      {
-        receive_opcode    = LCMP_READ_CNF;
-        receivehgf_opcode = HGF_PARAMETER;
-        receive_param_id  = lcmpParams->paramIdReq;
-        sendhgf_opcode    = HGF_READ_PARAMETER;
-        break;
-      }
-      case LCMP_NOTIFY_IND:
-      {
-        receive_opcode    = LCMP_NOTIFY_IND;
-        receivehgf_opcode = HGF_NOTIFY;
-        receive_param_id  = lcmpParams->paramIdRsp;
-        sendhgf_opcode    = HGF_NOTIFY;
-
-        lcmpParams->transactionId = 0; // Force transaction id to 0 for IND packets
-        break;
-      }
-      default:
-      {
-        result = HGF_LCMP_ERROR_BAD_ARGS;
-        break;
-      }
-    }
-  }
+  bzero(&req_frame, sizeof(req_frame));
 
-  if (result == HGF_LCMP_ERROR_NONE)
-  {
-    // Get proper destination MAC address
-    result = VbLcmpDestMacGet(lcmpParams->dstMac, lcmpParams->transmisionType, &dest_mac);
-  }
+  result = VbLcmpReqBuild(lcmpOpcode, lcmpParams, &req_frame);
 
   if (result == HGF_LCMP_ERROR_NONE)
   {
-    // Store Tx/Rx time if needed by stats
-    if(vbLcmpTimeStats.enable == TRUE)
-    {
-      clock_gettime(CLOCK_MONOTONIC, &lcmpParams->tsTx);
-      store_ts_rx = TRUE;
-    }
+    dest_mac = req_frame.dstMac;
 
     // Get MAC string to be used in debug logs
     MACAddrMem2str(mac_str, dest_mac);
 
-    LcmpDbgMsgAdd(dest_mac, TRUE, FALSE, lcmpOpcode, lcmpParams->paramIdReq);
-
-    for (num_control = 0 ; num_control < lcmpParams->reqValues->NumValues ; num_control++ )
-    {
-      lcmp_value_length += HGFTL_SIZE + lcmpParams->reqValues->values[num_control].ValueLength;
-    }
-
-    if (lcmpOpcode == LCMP_NOTIFY_IND)
-    {
-      mmpl_length = lcmp_value_length + LCMP_IND_HEADER_SIZE;
-    }
-    else
-    {
-      mmpl_length = lcmp_value_length + LCMP_REQ_HEADER_SIZE;
-    }
-
-    mmpl = (INT8U *) calloc(1, mmpl_length); // Buffer for ethernet frame
-
-    if (mmpl == NULL)
-    {
-      result = HGF_LCMP_ERROR_MALLOC;
-    }
-  }
-
-  if (result == HGF_LCMP_ERROR_NONE)
-  {
     final_confirm_values = VbDatamodelHtlvListCreate();
     if(final_confirm_values == NULL)
     {
@@ -693,22 +594,22 @@ static t_HGF_LCMP_ErrorCode VbLcmpReq(t_LCMP_OPCODE lcmpOpcode, t_lcmpComParams
       callback_installed =
           LcmpCallBackInstall(
               VbLcmpCallbackAndCondSignal,
-              receive_opcode,
-              receivehgf_opcode,
-              receive_param_id,
+              req_frame.rxOpcode,
+              req_frame.rxHgfOpcode,
+              req_frame.rxParamId,
               lcmpParams->transactionId,
-              store_ts_rx);
+              vbLcmpTimeStats.enable);
     }
     else
     {
       callback_installed =
           LcmpCallBackInstall(
               VbLcmpCallback,
-              receive_opcode,
-              receivehgf_opcode,
-              receive_param_id,
+              req_frame.rxOpcode,
+              req_frame.rxHgfOpcode,
+              req_frame.rxParamId,
               lcmpParams->transactionId,
-              store_ts_rx);
+              vbLcmpTimeStats.enable);
     }
 
     if (callback_installed == NULL)
@@ -719,60 +620,8 @@ static t_HGF_LCMP_ErrorCode VbLcmpReq(t_LCMP_OPCODE lcmpOpcode, t_lcmpComParams
 
   if (result == HGF_LCMP_ERROR_NONE)
   {
-    if (lcmpOpcode == LCMP_NOTIFY_IND)
-    {
-      t_LCMP_ind_Header       *lcmp_header = NULL;
-      lcmp_header                = (t_LCMP_ind_Header *)mmpl;
-      lcmp_header->control       = LCMP_CONTROL_VB;
-      lcmp_header->length        = _htons_ghn(lcmp_value_length);
-      lcmp_header->transactionId = _htons_ghn(lcmpParams->transactionId);
-      lcmp_header->notifAck      = 0;
-    }
-    else
-    {
-      t_LCMP_req_Header *lcmp_header;
-      lcmp_header                = (t_LCMP_req_Header *)mmpl;
-      lcmp_header->control       = LCMP_CONTROL_VB;
-      lcmp_header->transactionId = _htons_ghn(lcmpParams->transactionId);
-      lcmp_header->length        = _htons_ghn(lcmp_value_length);
-      vb_com_err = LcmpMacGet(lcmp_header->AEMAC);
-    }
-
-    if (vb_com_err != VB_COM_ERROR_NONE)
-    {
-      result = HGF_LCMP_ERROR_ETH_IF;
-    }
-  }
-
-  if (result == HGF_LCMP_ERROR_NONE)
-  {
-    t_HGFTL *hgftl;
-
-    if (lcmpOpcode == LCMP_NOTIFY_IND)
-    {
-      lcmp_value = &mmpl[LCMP_IND_VALUE_OFFSET];
-    }
-    else
-    {
-      lcmp_value = &mmpl[LCMP_REQ_VALUE_OFFSET];
-    }
-    offset_htlv = 0;
-
-    for (num_control = 0 ; num_control < lcmpParams->reqValues->NumValues ; num_control++ )
-    {
-      lcmp_value += offset_htlv;
-      hgftl = (t_HGFTL *)lcmp_value;
-      hgftl->Type = sendhgf_opcode;
-      hgftl->length = _htons_ghn(lcmpParams->reqValues->values[num_control].ValueLength);
-
-      memcpy(&lcmp_value[offset_htlv + HGFTL_SIZE],
-          lcmpParams->reqValues->values[num_control].Value,
-          lcmpParams->reqValues->values[num_control].ValueLength);
-      offset_htlv = HGFTL_SIZE + lcmpParams->reqValues->values[num_control].ValueLength;
-    }
-
     // Send LCMP
-    result = LcmpPacketSend(dest_mac, lcmpOpcode, mmpl_length, mmpl);
+    result = LcmpPacketSend(dest_mac, lcmpOpcode, req_frame.mmplLength, req_frame.mmpl);
 
     if (result != HGF_LCMP_ERROR_NONE)
     {
@@ -911,50 +760,32 @@ static t_HGF_LCMP_ErrorCode VbLcmpReq(t_LCMP_OPCODE lcmpOpcode, t_lcmpComParams
         {
           if (memcmp(final_confirm_values->head->srcMAC, dest_mac, ETH_ALEN) == 0)
           {
-            t_ValuesArray *confirmation_array;
+            INT8U param_id_not_found;
 
             vbLcmpUcastStatsUpdate(lcmpParams->tsTx, final_confirm_values->head->timeStamp);
 
-            confirmation_array = final_confirm_values->head->HTLVsArray;
-            for (params_to_check_idx = 0 ; params_to_check_idx < lcmpParams->reqValues->NumValues ; params_to_check_idx++ )
+            // Only one frame received, so check position #0 of confirmation array
+            if (VbLcmpCnfParamsCheck(lcmpParams->reqValues, final_confirm_values->head->HTLVsArray, &param_id_not_found) == FALSE)
             {
-              param_confirmed = FALSE;
+              VbLogPrint(VB_LOG_WARNING,
+                         "LCMP Cnf invalid (ParamId %u not found); Op 0x%X; ParamId %u; MAC %s; Exp Cnf Val %u; Rx Cnf Values %u;",
+                         param_id_not_found,
+                         lcmpOpcode,
+                         lcmpParams->paramIdReq,
+                         mac_str,
+                         lcmpParams->reqValues->NumValues,
+                         final_confirm_values->NumLists);
+              VbCounterIncrease(VB_DRIVER_COUNTER_LCMP_CNF_PARAMID_NOT_FOUND);
 
-              // Only one frame received, so check position #0 of "confirmation_array"
-              for (confirm_idx = 0 ; confirm_idx < confirmation_array[0].NumValues ; confirm_idx++)
+              wait_resp = (++n_retries < n_retries_max)?TRUE:FALSE;
+              if(wait_resp == TRUE)
               {
-                // ParamId to check is located in first byte of "Value" (payload) array
-                if((lcmpParams->reqValues->values[params_to_check_idx].Value[0]) ==
-                   (confirmation_array[0].values[confirm_idx].Value[0]))
-                {
-                  param_confirmed = TRUE;
-                  break;
-                }
+                VbDatamodelHtlvsListValueDestroy(&final_confirm_values);
+                final_confirm_values = VbDatamodelHtlvListCreate();
+                vbLcmpTimeStats.ucastRetry++;
               }
 
-              if (param_confirmed == FALSE)
-              {
-                VbLogPrint(VB_LOG_WARNING,
-                           "LCMP Cnf invalid (ParamId %u not found); Op 0x%X; ParamId %u; MAC %s; Exp Cnf Val %u; Rx Cnf Values %u;",
-                           lcmpParams->reqValues->values[params_to_check_idx].Value[0],
-                           lcmpOpcode,
-                           lcmpParams->paramIdReq,
-                           mac_str,
-                           lcmpParams->reqValues->NumValues,
-                           final_confirm_values->NumLists);
-                VbCounterIncrease(VB_DRIVER_COUNTER_LCMP_CNF_PARAMID_NOT_FOUND);
-
-                wait_resp = (++n_retries < n_retries_max)?TRUE:FALSE;
-                if(wait_resp == TRUE)
-                {
-                  VbDatamodelHtlvsListValueDestroy(&final_confirm_values);
-                  final_confirm_values = VbDatamodelHtlvListCreate();
-                  vbLcmpTimeStats.ucastRetry++;
-                }
-
-                result = HGF_LCMP_ERROR_CNF_INVALID;
-                break;
-              }
+              result = HGF_LCMP_ERROR_CNF_INVALID;
             }
           }
         }
@@ -1041,10 +872,10 @@ static t_HGF_LCMP_ErrorCode VbLcmpReq(t_LCMP_OPCODE lcmpOpcode, t_lcmpComParams
     LcmpCallBackUninstall(callback_installed);
   }
 
-  if(mmpl != NULL)
+  if (req_frame.mmpl != NULL)
   {
-    free(mmpl);
-    mmpl = NULL;
+    free(req_frame.mmpl);
+    req_frame.mmpl = NULL;
   }
 
   return result;
@@ -1802,6 +1633,221 @@ t_HGF_LCMP_ErrorCode vbLcmpTempListToListAdd(t_HTLVsLists *finalList, t_HTLVsLis
   return ret;
 }
 
+/*******************************************************************/
+
+t_HGF_LCMP_ErrorCode VbLcmpReqBuild(t_LCMP_OPCODE lcmpOpcode, t_lcmpComParams *lcmpParams, t_lcmpReqFrame *reqFrame)
+{
+  t_HGF_LCMP_ErrorCode result = HGF_LCMP_ERROR_NONE;
+  t_VB_comErrorCode    vb_com_err = VB_COM_ERROR_NONE;
+  INT16U               lcmp_value_length = 0;
+  INT8U               *lcmp_value;
+  INT16U               offset_htlv;
+  INT16U               num_control;
+  t_HGF_TLV            sendhgf_opcode = 0;
+
+  if ((lcmpParams == NULL) ||
+      (lcmpParams->reqValues == NULL) ||
+      (reqFrame == NULL))
+  {
+    result = HGF_LCMP_ERROR_BAD_ARGS;
+  }
+
+  if (result == HGF_LCMP_ERROR_NONE)
+  {
+    bzero(reqFrame, sizeof(*reqFrame));
+
+    switch(lcmpOpcode)
+    {
+      case LCMP_CTRL_REQ:
+      {
+        reqFrame->rxOpcode    = LCMP_CTRL_CNF;
+        reqFrame->rxHgfOpcode = HGF_CONTROL_CONFIRM;
+        reqFrame->rxParamId   = lcmpParams->paramIdReq;
+        sendhgf_opcode        = HGF_CONTROL;
+        break;
+      }
+      case LCMP_WRITE_REQ:
+      {
+        reqFrame->rxOpcode    = LCMP_WRITE_CNF;
+        reqFrame->rxHgfOpcode = HGF_WRITE_PARAMETER_CONFIRM;
+        reqFrame->rxParamId   = lcmpParams->paramIdReq;
+        sendhgf_opcode        = HGF_PARAMETER;
+        break;
+      }
+      case LCMP_READ_REQ:
+      {
+        reqFrame->rxOpcode    = LCMP_READ_CNF;
+        reqFrame->rxHgfOpcode = HGF_PARAMETER;
+        reqFrame->rxParamId   = lcmpParams->paramIdReq;
+        sendhgf_opcode        = HGF_READ_PARAMETER;
+        break;
+      }
+      case LCMP_NOTIFY_IND:
+      {
+        reqFrame->rxOpcode    = LCMP_NOTIFY_IND;
+        reqFrame->rxHgfOpcode = HGF_NOTIFY;
+        reqFrame->rxParamId   = lcmpParams->paramIdRsp;
+        sendhgf_opcode        = HGF_NOTIFY;
+
+        lcmpParams->transactionId = 0; // Force transaction id to 0 for IND packets
+        break;
+      }
+      default:
+      {
+        result = HGF_LCMP_ERROR_BAD_ARGS;
+        break;
+      }
+    }
+  }
+
+  if (result == HGF_LCMP_ERROR_NONE)
+  {
+    // Get proper destination MAC address
+    result = VbLcmpDestMacGet(lcmpParams->dstMac, lcmpParams->transmisionType, &(reqFrame->dstMac));
+  }
+
+  if (result == HGF_LCMP_ERROR_NONE)
+  {
+    // Store Tx/Rx time if needed by stats
+    if(vbLcmpTimeStats.enable == TRUE)
+    {
+      clock_gettime(CLOCK_MONOTONIC, &lcmpParams->tsTx);
+    }
+
+    LcmpDbgMsgAdd(reqFrame->dstMac, TRUE, FALSE, lcmpOpcode, lcmpParams->paramIdReq);
+
+    for (num_control = 0 ; num_control < lcmpParams->reqValues->NumValues ; num_control++ )
+    {
+      lcmp_value_length += HGFTL_SIZE + lcmpParams->reqValues->values[num_control].ValueLength;
+    }
+
+    if (lcmpOpcode == LCMP_NOTIFY_IND)
+    {
+      reqFrame->mmplLength = lcmp_value_length + LCMP_IND_HEADER_SIZE;
+    }
+    else
+    {
+      reqFrame->mmplLength = lcmp_value_length + LCMP_REQ_HEADER_SIZE;
+    }
+
+    reqFrame->mmpl = (INT8U *) calloc(1, reqFrame->mmplLength); // Buffer for ethernet frame
+
+    if (reqFrame->mmpl == NULL)
+    {
+      result = HGF_LCMP_ERROR_MALLOC;
+    }
+  }
+
+  if (result == HGF_LCMP_ERROR_NONE)
+  {
+    if (lcmpOpcode == LCMP_NOTIFY_IND)
+    {
+      t_LCMP_ind_Header       *lcmp_header = NULL;
+      lcmp_header                = (t_LCMP_ind_Header *)reqFrame->mmpl;
+      lcmp_header->control       = LCMP_CONTROL_VB;
+      lcmp_header->length        = _htons_ghn(lcmp_value_length);
+      lcmp_header->transactionId = _htons_ghn(lcmpParams->transactionId);
+      lcmp_header->notifAck      = 0;
+      lcmp_value                 = &(reqFrame->mmpl[LCMP_IND_VALUE_OFFSET]);
+    }
+    else
+    {
+      t_LCMP_req_Header *lcmp_header;
+      lcmp_header                = (t_LCMP_req_Header *)reqFrame->mmpl;
+      lcmp_header->control       = LCMP_CONTROL_VB;
+      lcmp_header->transactionId = _htons_ghn(lcmpParams->transactionId);
+      lcmp_header->length        = _htons_ghn(lcmp_value_length);
+      lcmp_value                 = &(reqFrame->mmpl[LCMP_REQ_VALUE_OFFSET]);
+      vb_com_err = LcmpMacGet(lcmp_header->AEMAC);
+    }
+
+    if (vb_com_err != VB_COM_ERROR_NONE)
+    {
+      result = HGF_LCMP_ERROR_ETH_IF;
+    }
+  }
+
+  if (result == HGF_LCMP_ERROR_NONE)
+  {
+    t_HGFTL *hgftl;
+
+    offset_htlv = 0;
+
+    for (num_control = 0 ; num_control < lcmpParams->reqValues->NumValues ; num_control++ )
+    {
+      lcmp_value += offset_htlv;
+      hgftl = (t_HGFTL *)lcmp_value;
+      hgftl->Type = sendhgf_opcode;
+      hgftl->length = _htons_ghn(lcmpParams->reqValues->values[num_control].ValueLength);
+
+      memcpy(&lcmp_value[HGFTL_SIZE],
+          lcmpParams->reqValues->values[num_control].Value,
+          lcmpParams->reqValues->values[num_control].ValueLength);
+      offset_htlv = HGFTL_SIZE + lcmpParams->reqValues->values[num_control].ValueLength;
+    }
+  }
+
+  if ((result != HGF_LCMP_ERROR_NONE) && (reqFrame != NULL) && (reqFrame->mmpl != NULL))
+  {
+    free(reqFrame->mmpl);
+    reqFrame->mmpl = NULL;
+  }
+
+  return result;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbLcmpCnfParamsCheck(const t_ValuesArray *reqValues, const t_ValuesArray *cnfValues, INT8U *paramIdNotFound)
+{
+  BOOLEAN params_confirmed = TRUE;
+  INT32U  params_to_check_idx;
+  INT32U  confirm_idx;
+
+  if ((reqValues == NULL) || (cnfValues == NULL))
+  {
+    params_confirmed = FALSE;
+  }
+  else
+  {
+    for (params_to_check_idx = 0 ; params_to_check_idx < reqValues->NumValues ; params_to_check_idx++ )
+    {
+      BOOLEAN param_confirmed = FALSE;
+
+      for (confirm_idx = 0 ; confirm_idx < cnfValues->NumValues ; confirm_idx++)
+      {
+        // ParamId to check is located in first byte of "Value" (payload) array
+        if ((reqValues->values[params_to_check_idx].Value[0]) ==
+            (cnfValues->values[confirm_idx].Value[0]))
+        {
+          param_confirmed = TRUE;
+          break;
+        }
+      }
+
+      if (param_confirmed == FALSE)
+      {
+        if (paramIdNotFound != NULL)
+        {
+          *paramIdNotFound = reqValues->values[params_to_check_idx].Value[0];
+        }
+
+        params_confirmed = FALSE;
+        break;
+      }
+    }
+  }
+
+  return params_confirmed;
+}
+
+/*******************************************************************/
+
+BOOL VbLcmpRspValuesAdd(const INT8U *lcmpValue, INT16U length, t_CallbackData *callbackData)
+{
+  return VbLcmpCallback(lcmpValue, length, callbackData);
+}
+
 /******************************************************************/
 
 /**
@@ -100,6 +100,8 @@ typedef enum {
   HGF_LCMP_ERROR_REQ_UNKOWN_ERR = -27,
   HGF_LCMP_ERROR_NOTIFY_INVALID = -28,
   HGF_LCMP_ERROR_INVALID_VER = -29,
+  HGF_LCMP_ERROR_NOT_RUNNING = -30,
+  HGF_LCMP_ERROR_ABORTED = -31,
 } t_HGF_LCMP_ErrorCode;
 
 typedef enum {
@@ -120,6 +122,7 @@ typedef struct s_CallbackData{
   BOOL sendack;
   BOOL markTimeStamp;
   INT8U srcMAC[ETH_ALEN];
+  void *args;
 }t_CallbackData;
 
 typedef struct s_Callbacks
@@ -147,9 +150,20 @@ typedef struct s_LcmpComParams
   INT8U                    paramIdReq;               ///< Parameter Id to request
   INT8U                    paramIdRsp;               ///< Expected parameter Id to receive (used in @ref VbLcmpNotifyAndWait and @ref VbLcmpControlWaitNotify)
   BOOLEAN                  ack;                      ///< ACK requested (used in @ref VbLcmpNotify)
+  BOOLEAN                  noRetx;                   ///< Request is not idempotent, it is never retransmitted (used in asynchronous requests)
   struct timespec          tsTx;                     ///< Time Stamp of transmitted packet
 } t_lcmpComParams;
 
+typedef struct s_LcmpReqFrame
+{
+  INT8U                   *mmpl;                     ///< LCMP payload to send (allocated by @ref VbLcmpReqBuild)
+  INT16U                   mmplLength;               ///< Length of LCMP payload
+  const INT8U             *dstMac;                   ///< Destination MAC (unicast, multicast or broadcast address)
+  t_LCMP_OPCODE            rxOpcode;                 ///< Expected LCMP opcode in response
+  t_HGF_TLV                rxHgfOpcode;              ///< Expected HGF opcode in response
+  INT8U                    rxParamId;                ///< Expected parameter Id in response
+} t_lcmpReqFrame;
+
 /*
  ************************************************************************
  ** Public function definition
@@ -282,6 +296,33 @@ void vbLcmpTimeStatsReset(void);
  **/
 t_HGF_LCMP_ErrorCode vbLcmpTempListToListAdd(t_HTLVsLists *finalList, t_HTLVsLists *tempList);
 
+/**
+ * @brief Builds the LCMP payload of a request and gets the response to expect
+ * @param[in] lcmpOpcode LCMP opcode to use
+ * @param[in,out] lcmpParams LCMP parameters
+ * @param[out] reqFrame Frame to send. reqFrame->mmpl shall be released by caller.
+ * @return @ref t_HGF_LCMP_ErrorCode.
+ **/
+t_HGF_LCMP_ErrorCode VbLcmpReqBuild(t_LCMP_OPCODE lcmpOpcode, t_lcmpComParams *lcmpParams, t_lcmpReqFrame *reqFrame);
+
+/**
+ * @brief Checks that every requested parameter Id is present in a confirmation
+ * @param[in] reqValues Requested HTLVs
+ * @param[in] cnfValues HTLVs received in confirmation frame
+ * @param[out] paramIdNotFound First parameter Id not confirmed (optional)
+ * @return TRUE if all parameters were confirmed; FALSE otherwise
+ **/
+BOOLEAN VbLcmpCnfParamsCheck(const t_ValuesArray *reqValues, const t_ValuesArray *cnfValues, INT8U *paramIdNotFound);
+
+/**
+ * @brief Parses a received LCMP payload and adds expected HTLVs to callback data
+ * @param[in] lcmpValue Data received
+ * @param[in] length Length of data received
+ * @param[in,out] callbackData Callback data
+ * @return TRUE if expected frame was received; FALSE otherwise
+ **/
+BOOL VbLcmpRspValuesAdd(const INT8U *lcmpValue, INT16U length, t_CallbackData *callbackData);
+
 #endif /* VB_LCMP_COM_H_ */
 
 /**
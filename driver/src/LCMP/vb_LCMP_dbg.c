@@ -57,6 +57,7 @@
 
 #include "vb_mac_utils.h"
 #include "vb_LCMP_com.h"
+#include "vb_LCMP_async.h"
 #include "vb_LCMP_dbg.h"
 #include "vb_log.h"
 
@@ -507,6 +508,18 @@ BOOL VbLcmpConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
       vbLcmpTimeStatsReset();
       ret = TRUE;
     }
+    else if (!strcmp(cmd[1], "a"))
+    {
+      // Async LCMP per node RTT estimations
+      VbLcmpAsyncPeersDump(writeFun);
+      ret = TRUE;
+    }
+    else if (!strcmp(cmd[1], "ar"))
+    {
+      // Reset async LCMP per node RTT estimations
+      VbLcmpAsyncPeersReset();
+      ret = TRUE;
+    }
     else if (!strcmp(cmd[1], "h"))
     {
       show_help = TRUE;
@@ -530,6 +543,8 @@ BOOL VbLcmpConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
     writeFun("lcmp r : Reset LCMP Tx/Rx table\n");
     writeFun("lcmp t : Shows LCMP time related stats\n");
     writeFun("lcmp tr: Reset LCMP time related stats\n");
+    writeFun("lcmp a : Shows async LCMP per node RTT and retransmission timeout\n");
+    writeFun("lcmp ar: Reset async LCMP per node RTT and retransmission timeout\n");
   }
 
   return ret;
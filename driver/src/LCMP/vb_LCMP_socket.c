@@ -733,7 +733,7 @@ static void LcmpReceiveThreadExecute( void )
   VbLogPrint(VB_LOG_INFO, "Starting %s thread", LCMP_THREAD_NAME);
 
   LcmpStateSet(TRUE);
-  if (FALSE == VbThreadCreate(LCMP_THREAD_NAME, LcmpReceiveThread, NULL, VB_DRIVER_LCMP_THREAD_PRIORITY, &lcmpReceiveThread))
+  if (FALSE == VbThreadCreate(LCMP_THREAD_NAME, LcmpReceiveThread, NULL, VB_DRIVER_LCMP_THREAD_CLASS, &lcmpReceiveThread))
   {
     VbLogPrint(VB_LOG_ERROR,"Can't create receiveThread");
     LcmpStateSet(FALSE);
@@ -1483,7 +1483,7 @@ static t_VB_comErrorCode VbMeasureMeasuresCollectThreadNew(INT8U planId, INT8U d
 
     // Launch thread
     running =  VbThreadCreate(MEASURE_COLLECT_THREAD_NAME, VBMeasurementMeasCollectProcess,
-    		meas_collect_info, VB_DRIVER_MEAS_COLLECT_THREAD_PRIORITY, &meas_collect_info->threadId);
+    		meas_collect_info, VB_DRIVER_MEAS_COLLECT_THREAD_CLASS, &meas_collect_info->threadId);
 
     if (running == FALSE)
     {
@@ -1584,7 +1584,7 @@ t_VB_comErrorCode VbMeasurePlanReqRun(t_vbMsg planReqMsg)
 
     vbMeasurePlanThreadRunning = TRUE;
 
-    if (FALSE == VbThreadCreate(MEASURE_PLAN_THREAD_NAME, VBMeasurementPlanReqProcess, (void *)&vbMeasurePlanReqCpy, VB_DRIVER_MEASUREMENT_THREAD_PRIORITY, &vbMeasurePlanThread))
+    if (FALSE == VbThreadCreate(MEASURE_PLAN_THREAD_NAME, VBMeasurementPlanReqProcess, (void *)&vbMeasurePlanReqCpy, VB_DRIVER_MEASUREMENT_THREAD_CLASS, &vbMeasurePlanThread))
     {
       VbLogPrint(VB_LOG_ERROR,"Can't create %s thread", MEASURE_PLAN_THREAD_NAME);
       free(vbMeasurePlanReqCpy.msg);
@@ -1621,7 +1621,7 @@ t_VB_comErrorCode VbMeasureSNRProbeReqRun(t_vbMsg snrProbeMsg)
 
     vbMeasureSNRProbeThreadRunning = TRUE;
 
-    if (FALSE == VbThreadCreate(SNRPROBE_THREAD_NAME, VBMeasurementSNRProbeProcess, (void *)&vbMeasureSNRProbeReqCpy, VB_DRIVER_SNRPROBE_THREAD_PRIORITY, &vbMeasureSNRProbeThread))
+    if (FALSE == VbThreadCreate(SNRPROBE_THREAD_NAME, VBMeasurementSNRProbeProcess, (void *)&vbMeasureSNRProbeReqCpy, VB_DRIVER_SNRPROBE_THREAD_CLASS, &vbMeasureSNRProbeThread))
     {
       VbLogPrint(VB_LOG_ERROR,"Can't create %s thread", SNRPROBE_THREAD_NAME);
       vbMeasureSNRProbeThreadRunning = FALSE;
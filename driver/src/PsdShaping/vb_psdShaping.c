@@ -60,6 +60,7 @@
 #include "vb_LCMP_socket.h"
 #include "vb_main.h"
 #include "vb_psdShaping.h"
+#include "vb_cdta.h"
 #include "vb_thread.h"
 #include "vb_priorities.h"
 
@@ -211,18 +212,18 @@ static t_vbPsdShapeError VBPsdShapeConf(t_Transmision transmisionType, INT8U *ds
 
       free(tlv);
       tlv = NULL;
-    }
 
-    if (com_err != VB_COM_ERROR_NONE)
+      if (com_err != VB_COM_ERROR_NONE)
+      {
+        ret = VB_PSDSHAPE_ERR_COM;
+        VbLogPrint(VB_LOG_ERROR, "VbDatamodelValueToArrayAdd; error %d",com_err);
+      }
+    }
+    else
     {
-      ret = VB_PSDSHAPE_ERR_COM;
-      VbLogPrint(VB_LOG_ERROR, "VbDatamodelValueToArrayAdd; error %d",com_err);
+      ret = VB_PSDSHAPE_ERR_NO_MEMORY;
     }
   }
-  else
-  {
-    ret = VB_PSDSHAPE_ERR_NO_MEMORY;
-  }
 
   if (ret == VB_PSDSHAPE_ERR_NONE)
   {
@@ -255,6 +256,9 @@ static t_vbPsdShapeError VBPsdShapeConf(t_Transmision transmisionType, INT8U *ds
     }
   }
 
+  // PSD shape requests are forced resends, nodes configuration no longer matches last CDTA written
+  VbCdtaLastConfReset();
+
   // Always release memory
   VbDatamodelHTLVsArrayDestroy(&control_values_array);
 
@@ -344,7 +348,7 @@ void VbPsdShapeWriteRun(INT8U *payload, INT16U length)
       VbLogPrint(VB_LOG_INFO, "Starting %s thread", PSD_SHAPING_THREAD_NAME);
 
       vbPsdShapeThreadRunning = TRUE;
-      if (FALSE == VbThreadCreate(PSD_SHAPING_THREAD_NAME, VBPsdShapeProcess, payload_copy, VB_DRIVER_PSD_THREAD_PRIORITY, &vbPsdShapeThread))
+      if (FALSE == VbThreadCreate(PSD_SHAPING_THREAD_NAME, VBPsdShapeProcess, payload_copy, VB_DRIVER_PSD_THREAD_CLASS, &vbPsdShapeThread))
       {
         VbLogPrint(VB_LOG_ERROR,"Can't create %s thread", PSD_SHAPING_THREAD_NAME);
         free(payload_copy);
@@ -567,7 +567,7 @@ void VbTrafficAwarenessRun(void)
     VbLogPrint(VB_LOG_INFO, "Starting %s thread", VB_TRAFFIC_THREAD_NAME);
 
     VBTrafficStateSet(TRUE);
-    if (FALSE == VbThreadCreate(VB_TRAFFIC_THREAD_NAME, VBTrafficProcess, NULL, VB_DRIVER_TRAFFIC_THREAD_PRIORITY, &vbTrafficThread))
+    if (FALSE == VbThreadCreate(VB_TRAFFIC_THREAD_NAME, VBTrafficProcess, NULL, VB_DRIVER_TRAFFIC_THREAD_CLASS, &vbTrafficThread))
     {
       VbLogPrint(VB_LOG_ERROR,"Can't create %s thread", VB_TRAFFIC_THREAD_NAME);
       VBTrafficStateSet(FALSE);
@@ -124,6 +124,7 @@ static t_DomainsList         vbDatamodelDomainsList[VB_DOMAINS_LISTS];
 static t_DomainsList        *vbDatamodelDomains;
 static t_DomainsList        *vbDatamodelDomainsNew;
 static t_DomainChangeDetails vbDatamodelDomainsChanges = {0};
+static INT32U                vbDatamodelNodesJoinCnt = 0;    ///< Incremented every time a node joins or rejoins (protected by vbDatamodelMutexDomains)
 
 /*
  ************************************************************************
@@ -1068,6 +1069,12 @@ static t_VB_comErrorCode VbDatamodelDomainListDataRecover(void)
         // Copy old info to new container
         memcpy(&(domain->dm), &(domain_old->dm), sizeof(domain->dm));
 
+        // A new device Id means the node has joined again
+        if (domain->dm.devID != device_id)
+        {
+          vbDatamodelNodesJoinCnt++;
+        }
+
         // Restore seed and device Id
         domain->dm.addInfo1.extSeed = seed;
         domain->dm.devID = device_id;
@@ -1099,6 +1106,11 @@ static t_VB_comErrorCode VbDatamodelDomainListDataRecover(void)
             // Copy old info to new container
             memcpy(ep, ep_old, sizeof(*ep));
 
+            if (ep->devID != device_id)
+            {
+              vbDatamodelNodesJoinCnt++;
+            }
+
             // Restore seed and device Id
             ep->addInfo1.extSeed = seed;
             ep->devID = device_id;
@@ -1116,6 +1128,7 @@ static t_VB_comErrorCode VbDatamodelDomainListDataRecover(void)
           {
             // New EP detected
             ep->state = VB_DEV_NEW;
+            vbDatamodelNodesJoinCnt++;
             VbLogPrint(VB_LOG_INFO, "EP detected -> %s : NEW", ep->MACStr);
           }
         }
@@ -1128,6 +1141,7 @@ static t_VB_comErrorCode VbDatamodelDomainListDataRecover(void)
       {
         // New domain
         domain->dm.state = VB_DEV_NEW;
+        vbDatamodelNodesJoinCnt++;
 
         VbLogPrint(VB_LOG_INFO, "DM detected -> %s : NEW", domain->dm.MACStr);
 
@@ -2732,6 +2746,19 @@ t_VB_comErrorCode VbDatamodelNodeCapTrafficReportSet(const INT8U *mac, BOOLEAN e
 
 /*******************************************************************/
 
+INT32U VbDatamodelNodesJoinCntGet(void)
+{
+  INT32U join_cnt;
+
+  pthread_mutex_lock( &vbDatamodelMutexDomains );
+  join_cnt = vbDatamodelNodesJoinCnt;
+  pthread_mutex_unlock( &vbDatamodelMutexDomains );
+
+  return join_cnt;
+}
+
+/*******************************************************************/
+
 t_VB_comErrorCode VbDatamodelActiveNodeLoop(t_nodeLoopCb loopCb, BOOLEAN lock, void *args)
 {
   t_VB_comErrorCode ret = VB_COM_ERROR_NONE;
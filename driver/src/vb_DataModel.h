@@ -565,6 +565,12 @@ BOOLEAN VbDatamodelNodeIsActive(t_node *node);
  **/
 t_VB_comErrorCode VbDatamodelNodeCapTrafficReportSet(const INT8U *mac, BOOLEAN enable);
 
+/**
+ * @brief Gets the number of times a node has joined or rejoined (new device Id) since start
+ * @return Join counter
+ **/
+INT32U VbDatamodelNodesJoinCntGet(void);
+
 /**
  * @brief Loops through all nodes (DMs and EPs) and executes given callback for each one
  * @param[in] loopCb Callback to execute
@@ -68,6 +68,7 @@
 
 #include "vb_alignment.h"
 #include "vb_LCMP_com.h"
+#include "vb_LCMP_async.h"
 #include "vb_LCMP_socket.h"
 #include "vb_log.h"
 #include "vb_EA_interface.h"
@@ -94,6 +95,7 @@
 #define DRIVER_NUM_QUEUE_ELEMS                       (50)
 #define DRIVER_MSG_SIZE                              (sizeof(t_driverMsg))
 #define DRIVER_LOG_QUEUE_NAME                        ("/VbDriverLogQ")
+#define DRIVER_MAIN_THREAD_NAME                      ("Main")
 #define DRIVER_WAIT_TO_IDLE                          (1000) // in ms
 #define DRIVER_WAIT_TO_RETRY_CONN                    (1000) // in ms
 #define DRIVER_MAX_TCP_REDIRECT_PORT                 (0x10000)
@@ -124,7 +126,7 @@ typedef struct
  */
 
 /**
- * @brief Define the function to be called when ctrl-c (SIGINT) signal is sent to process
+ * @brief Define the function to be called when ctrl-c (SIGINT) or SIGHUP signal is sent to process
  **/
 static void VbDriverSignalHandler(INT32U signum);
 
@@ -342,6 +344,10 @@ static const t_driverEvent eaLookupEvents[VB_EA_OPCODE_LAST] =
     DRIVER_EV_LAST,                    //VB_EA_OPCODE_NETWORK_CHANGE_REPORT      = 0x27,
     DRIVER_EV_RX_SOCKET_ALIVE_REQ,     //VB_EA_OPCODE_SOCKET_ALIVE_REQUEST       = 0x28,
     DRIVER_EV_LAST,                    //VB_EA_OPCODE_SOCKET_ALIVE_RESP          = 0x29
+    DRIVER_EV_LAST,                    //VB_EA_OPCODE_FLOW_CREDIT                = 0x2A
+    DRIVER_EV_LAST,                    //VB_EA_OPCODE_SHM_REQ                    = 0x2B
+    DRIVER_EV_LAST,                    //VB_EA_OPCODE_SHM_RSP                    = 0x2C
+    DRIVER_EV_LAST,                    //VB_EA_OPCODE_SHM_SWITCH_TRG             = 0x2D
 };
 
 static t_driverState driverState = DRIVER_STT_IDLE;
@@ -787,7 +793,12 @@ static t_VB_comErrorCode ComponentsInit(void)
 
   if (ret == VB_COM_ERROR_NONE)
   {
+    // Place threads in their classes (CPU set, scheduling policy and cgroup); failures are only logged
+    VbThreadPlacementConfSet(VbDriverConfThreadPlacementGet());
+    VbThreadClassSelfAttach(DRIVER_MAIN_THREAD_NAME, VB_DRIVER_MAIN_THREAD_CLASS);
+
     VbLcmpInit(VbDriverConfLcmpIfGet());
+    VbLcmpAsyncInit();
     VbEAInit(VbDriverConfEaIfGet(), VbDriverConfEaPortGet(), VbDriverConfRemoteIPGet(), VbDriverConfServerModeGet(), VbDriverConfFamilyGet());
     VbTrafficInit();
     VbMainConsoleInit(VbDriverConfConsolePortGet());
@@ -825,6 +836,17 @@ static t_VB_comErrorCode ComponentsStart(void)
     }
   }
 
+  if (ret == VB_COM_ERROR_NONE)
+  {
+    // Start async LCMP requests thread
+    lcmp_err = VbLcmpAsyncStart();
+
+    if (lcmp_err != HGF_LCMP_ERROR_NONE)
+    {
+      ret = VB_COM_ERROR_THREAD;
+    }
+  }
+
   if (ret == VB_COM_ERROR_NONE)
   {
     // Start log
@@ -853,6 +875,9 @@ static void ComponentsStop()
   // Stop Console thread
   VbConsoleStop();
 
+  // Stop async LCMP requests thread (pending requests are aborted)
+  VbLcmpAsyncStop();
+
   // Stop LCMP thread
   LcmpEnd();
 
@@ -1767,7 +1792,9 @@ static void MainQueueFlush(void)
 
 static void VbDriverSignalHandler(INT32U signum)
 {
-  if (signum == SIGINT)
+  // SIGHUP is also blocked and caught (configuration reload in the engine);
+  // driver has no reload, so it keeps its default meaning and terminates
+  if ((signum == SIGINT) || (signum == SIGHUP))
   {
     VbMainKill();
   }
@@ -64,10 +64,12 @@
 #include "vb_traffic.h"
 #include "vb_domainsMonitor.h"
 #include "vb_EA_interface.h"
+#include "vb_EA_flow.h"
 #include "vb_console.h"
 #include "vb_driver_conf.h"
 #include "vb_thread.h"
 #include "vb_timer.h"
+#include "vb_priorities.h"
 
 /*
  ************************************************************************
@@ -227,7 +229,7 @@ static BOOL VbDiagnosticConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
             params[i].numDomainsOrig = num_domains_first;
             params[i].transactionId = i + VB_CONSOLE_DIAG_TRANS_ID_OFFSET;
             params[i].writeFun = writeFun;
-            params[i].running =  VbThreadCreate(VB_CONSOLE_DIAG_THREAD_NAME, VbDiagnosticThread, (void *)&(params[i]), 0, &(params[i].threadId));
+            params[i].running =  VbThreadCreate(VB_CONSOLE_DIAG_THREAD_NAME, VbDiagnosticThread, (void *)&(params[i]), VB_DRIVER_DIAG_THREAD_CLASS, &(params[i].threadId));
 
             if (params[i].running == FALSE)
             {
@@ -633,6 +635,8 @@ t_VB_comErrorCode VbMainConsoleInit(INT16U port)
     VbConsoleCommandRegister("conf",     VbDriverConfConsoleCmd,     NULL);
     VbConsoleCommandRegister("ea",       VbEAConsoleCmd,             NULL);
     VbConsoleCommandRegister("log",      VbLogConsoleCmd,            NULL);
+    VbConsoleCommandRegister("threads",  VbThreadConsoleCmd,         NULL);
+    VbConsoleCommandRegister("eaflow",   VbEAFlowConsoleCmd,         NULL);
   }
 
   return ret;
@@ -59,22 +59,34 @@
  ************************************************************************
  */
 
-// "Regular" (ie. low priority) threads
-#define VB_DRIVER_MEASUREMENT_THREAD_PRIORITY       (0)
-#define VB_DRIVER_MEAS_COLLECT_THREAD_PRIORITY      (0)
-#define VB_DRIVER_SNRPROBE_THREAD_PRIORITY          (0)
-#define VB_DRIVER_DOMAINS_MONITOR_THREAD_PRIORITY   (0)
-#define VB_DRIVER_PSD_THREAD_PRIORITY               (0)
-#define VB_DRIVER_CDTA_THREAD_PRIORITY              (0)
-#define VB_DRIVER_TRAFFIC_THREAD_PRIORITY           (0)
+// Thread classes (see t_vbThreadClass); placement of each class is configured in ThreadPlacement section of .ini file
 
-#define VB_CONSOLE_THREAD_PRIORITY                  (0)
-#define VB_LOG_THREAD_PRIORITY                      (0)
-#define VB_SIGNALS_PROCESSING_PRIORITY              (0)
+// Event processing and alignment (timing critical) threads
+#define VB_DRIVER_MAIN_THREAD_CLASS                 (VB_THREAD_CLASS_FSM)
+#define VB_DRIVER_ALIGNMENT_THREAD_CLASS            (VB_THREAD_CLASS_FSM)
 
-// Real-time (ie. high priority) threads
-#define VB_DRIVER_LCMP_THREAD_PRIORITY              (1)
-#define VB_DRIVER_ALIGNMENT_THREAD_PRIORITY         (1)
+// LCMP and EA readers, EA held back frames sender
+#define VB_DRIVER_LCMP_THREAD_CLASS                 (VB_THREAD_CLASS_IO)
+#define VB_DRIVER_LCMP_ASYNC_THREAD_CLASS           (VB_THREAD_CLASS_IO)
+#define VB_EA_THREAD_CLASS                          (VB_THREAD_CLASS_IO)
+#define VB_EA_FLOW_THREAD_CLASS                     (VB_THREAD_CLASS_IO)
+
+// Measures and configuration requests towards nodes
+#define VB_DRIVER_MEASUREMENT_THREAD_CLASS          (VB_THREAD_CLASS_COMPUTE)
+#define VB_DRIVER_MEAS_COLLECT_THREAD_CLASS         (VB_THREAD_CLASS_COMPUTE)
+#define VB_DRIVER_SNRPROBE_THREAD_CLASS             (VB_THREAD_CLASS_COMPUTE)
+#define VB_DRIVER_PSD_THREAD_CLASS                  (VB_THREAD_CLASS_COMPUTE)
+#define VB_DRIVER_CDTA_THREAD_CLASS                 (VB_THREAD_CLASS_COMPUTE)
+
+// Background threads
+#define VB_DRIVER_DOMAINS_MONITOR_THREAD_CLASS      (VB_THREAD_CLASS_BACKGROUND)
+#define VB_DRIVER_TRAFFIC_THREAD_CLASS              (VB_THREAD_CLASS_BACKGROUND)
+#define VB_DRIVER_DIAG_THREAD_CLASS                 (VB_THREAD_CLASS_BACKGROUND)
+#define VB_CONSOLE_THREAD_CLASS                     (VB_THREAD_CLASS_BACKGROUND)
+#define VB_METRICS_THREAD_CLASS                     (VB_THREAD_CLASS_BACKGROUND)
+#define VB_LOG_THREAD_CLASS                         (VB_THREAD_CLASS_BACKGROUND)
+#define VB_FILE_WRITER_THREAD_CLASS                 (VB_THREAD_CLASS_BACKGROUND)
+#define VB_SIGNALS_PROCESSING_CLASS                 (VB_THREAD_CLASS_BACKGROUND)
 
 #define VB_THREADMSG_PRIORITY (0)
 
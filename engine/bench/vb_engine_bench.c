@@ -0,0 +1,1069 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_bench.c
+ * @brief Microbenchmark of engine computation kernels over synthetic clusters
+ *
+ * @internal
+ *
+ * A synthetic cluster (drivers, lines, measures and traffic reports) is built
+ * through the same datamodel entry points used when domains are discovered.
+ * Then each kernel is run several times as warmup and timed over the
+ * requested number of repetitions. Results are printed as a table and can be
+ * saved in JSON format to compare builds and architectures.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/utsname.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_engine_datamodel.h"
+#include "vb_engine_drivers_list.h"
+#include "vb_engine_cluster_list.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_measure.h"
+#include "vb_engine_cdta.h"
+#include "vb_engine_l2rPSD_calculation.h"
+#include "vb_engine_alignment.h"
+#include "vb_engine_main.h"
+#include "vb_engine_bench.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define BENCH_NAME                                   ("vector_boost_bench")
+#define BENCH_DEFAULT_INI                            ("vb_engine_bench.ini")
+#define BENCH_EA_SUBCOMMAND                          ("ea")
+#define BENCH_CLUSTER_ID                             (1)
+#define BENCH_PLAN_ID                                (1)
+#define BENCH_FIRST_CARRIER                          (74)
+#define BENCH_MAX_LINES                              (4096)
+#define BENCH_MAX_DRIVERS                            (64)
+#define BENCH_MAX_CARRIERS                           (8192)
+#define BENCH_DMS_PER_ADD                            (128)   // Domains added per datamodel call
+#define BENCH_RXG_COMPENSATION                       (127)
+#define BENCH_FILE_NAME_LENGTH                       (150)
+
+// Synthetic levels (quarter of dB before rx gain compensation)
+#define BENCH_BGN_MIN                                (0)
+#define BENCH_BGN_RANGE                              (40)
+#define BENCH_CFR_OWN_MIN                            (200)
+#define BENCH_CFR_OWN_RANGE                          (55)
+#define BENCH_CFR_XTALK_MIN                          (60)
+#define BENCH_CFR_XTALK_RANGE                        (80)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  CHAR     iniFile[BENCH_FILE_NAME_LENGTH];
+  CHAR     outFile[BENCH_FILE_NAME_LENGTH];
+  CHAR     kernels[256];
+  INT32U   numLines;
+  INT32U   numDrivers;
+  INT32U   numCarriers;
+  INT32U   xtalkDensity;      ///< Percentage of other lines present in each node CFR list
+  BOOLEAN  mimo;
+  INT32U   warmup;
+  INT32U   reps;
+  INT32U   seed;
+} t_benchConf;
+
+typedef struct
+{
+  t_benchConf  conf;
+  INT32U       numNodes;
+  INT8U       *snrRx1;
+  INT8U       *snrRx2;
+  float        capacity[VB_PSD_NUM_BANDS];
+  INT32U       randState;
+  INT32U       errors;
+} t_benchCtx;
+
+typedef t_VB_engineErrorCode (*t_benchKernelRun)(t_benchCtx *ctx);
+
+typedef struct
+{
+  const CHAR       *name;
+  t_benchKernelRun  run;
+  const CHAR       *desc;
+} t_benchKernel;
+
+typedef struct
+{
+  const CHAR  *name;
+  INT32U       reps;
+  INT32U       errors;
+  INT64U       minNs;
+  INT64U       p50Ns;
+  INT64U       p90Ns;
+  INT64U       p99Ns;
+  INT64U       maxNs;
+  double       meanNs;
+  double       nsPerCarrier;
+  double       nsPerNode;
+} t_benchResult;
+
+/*
+ ************************************************************************
+ ** Private function declaration
+ ************************************************************************
+ */
+
+static t_VB_engineErrorCode BenchSnrRun(t_benchCtx *ctx);
+static t_VB_engineErrorCode BenchSnrSparseRun(t_benchCtx *ctx);
+static t_VB_engineErrorCode BenchCapacityRun(t_benchCtx *ctx);
+static t_VB_engineErrorCode BenchSnrCapacityRun(t_benchCtx *ctx);
+static t_VB_engineErrorCode BenchCdtaRun(t_benchCtx *ctx);
+static t_VB_engineErrorCode BenchL2rPsdRun(t_benchCtx *ctx);
+static t_VB_engineErrorCode BenchAlignRun(t_benchCtx *ctx);
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static const t_benchKernel benchKernels[] =
+{
+  {"snr",          BenchSnrRun,         "SNR with full crosstalk (SISO or MIMO kernel)"},
+  {"snr_sparse",   BenchSnrSparseRun,   "Crosstalk significance analysis + SNR with significant disturbers only"},
+  {"capacity",     BenchCapacityRun,    "Channel capacity per band"},
+  {"snr_capacity", BenchSnrCapacityRun, "SNR (full and low band) + capacities, as computation thread"},
+  {"cdta",         BenchCdtaRun,        "CDTA analysis (VbCdtaAnalyseRun)"},
+  {"l2r_psd",      BenchL2rPsdRun,      "Left to right PSD shape build"},
+  {"align",        BenchAlignRun,       "Alignment check passes"},
+};
+
+#define BENCH_NUM_KERNELS                            (sizeof(benchKernels) / sizeof(benchKernels[0]))
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+static INT32U BenchRand(t_benchCtx *ctx)
+{
+  // xorshift32, deterministic for a given seed
+  ctx->randState ^= ctx->randState << 13;
+  ctx->randState ^= ctx->randState >> 17;
+  ctx->randState ^= ctx->randState << 5;
+
+  return ctx->randState;
+}
+
+/*******************************************************************/
+
+static void BenchNodeMacBuild(INT32U line, BOOLEAN endPoint, INT8U *mac)
+{
+  mac[0] = 0x02;
+  mac[1] = 0xBE;
+  mac[2] = 0x00;
+  mac[3] = (INT8U)(line >> 8);
+  mac[4] = (INT8U)(line & 0xFF);
+  mac[5] = (endPoint == TRUE)?0x01:0x00;
+}
+
+/*******************************************************************/
+
+static INT32U BenchNodeLineGet(const t_node *node)
+{
+  return ((INT32U)node->MAC[3] << 8) | node->MAC[4];
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchMeasureFill(t_benchCtx *ctx, t_processMeasure *measure, INT32U minVal, INT32U range)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT32U               idx;
+
+  bzero(measure, sizeof(*measure));
+  measure->planID = BENCH_PLAN_ID;
+  measure->errorCode = VB_MEAS_ERRCODE_VALID;
+  measure->firstCarrier = BENCH_FIRST_CARRIER;
+  measure->spacing = 1;
+  measure->numMeasures = ctx->conf.numCarriers;
+  measure->rxg1Compensation = BENCH_RXG_COMPENSATION;
+  measure->rxg2Compensation = BENCH_RXG_COMPENSATION;
+  measure->mimoInd = ctx->conf.mimo;
+  measure->mimoMeas = ctx->conf.mimo;
+  measure->carrierGridIdxCutProfile = ctx->conf.numCarriers;
+
+  measure->measuresRx1 = malloc(ctx->conf.numCarriers);
+  if (measure->measuresRx1 == NULL)
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (ctx->conf.mimo == TRUE))
+  {
+    measure->measuresRx2 = malloc(ctx->conf.numCarriers);
+    if (measure->measuresRx2 == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    for (idx = 0; idx < ctx->conf.numCarriers; idx++)
+    {
+      measure->measuresRx1[idx] = (INT8U)(minVal + (BenchRand(ctx) % range));
+
+      if (measure->measuresRx2 != NULL)
+      {
+        measure->measuresRx2[idx] = (INT8U)(minVal + (BenchRand(ctx) % range));
+      }
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchNodeFillCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_benchCtx          *ctx = (t_benchCtx *)args;
+  t_crossMeasureList  *cfr_list;
+  INT32U               line;
+  INT32U               other;
+  INT32U               num_xtalk = 0;
+  BOOLEAN              end_point;
+
+  if ((node == NULL) || (ctx == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    line = BenchNodeLineGet(node);
+    end_point = (node->type == VB_NODE_END_POINT)?TRUE:FALSE;
+    node->state = VB_DEV_PRESENT;
+
+    ret = BenchMeasureFill(ctx, &(node->measures.BGNMeasure), BENCH_BGN_MIN, BENCH_BGN_RANGE);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    cfr_list = &(node->measures.CFRMeasureList);
+
+    // Own CFR plus crosstalk from a share of the other lines
+    cfr_list->crossMeasureArray = calloc(ctx->conf.numLines, sizeof(t_crossMeasure));
+    if (cfr_list->crossMeasureArray == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    BenchNodeMacBuild(line, !end_point, cfr_list->crossMeasureArray[0].MAC);
+    cfr_list->crossMeasureArray[0].ownCFR = TRUE;
+    cfr_list->numCrossMeasures = 1;
+
+    ret = BenchMeasureFill(ctx, &(cfr_list->crossMeasureArray[0].measure), BENCH_CFR_OWN_MIN, BENCH_CFR_OWN_RANGE);
+
+    for (other = 0; (ret == VB_ENGINE_ERROR_NONE) && (other < ctx->conf.numLines); other++)
+    {
+      if ((other != line) && ((BenchRand(ctx) % 100) < ctx->conf.xtalkDensity))
+      {
+        t_crossMeasure *xtalk = &(cfr_list->crossMeasureArray[cfr_list->numCrossMeasures]);
+
+        BenchNodeMacBuild(other, !end_point, xtalk->MAC);
+        xtalk->ownCFR = FALSE;
+        cfr_list->numCrossMeasures++;
+        num_xtalk++;
+
+        ret = BenchMeasureFill(ctx, &(xtalk->measure), BENCH_CFR_XTALK_MIN, BENCH_CFR_XTALK_RANGE);
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    t_trafficReport *report = &(node->trafficReports);
+
+    report->ingressTrafficP0 = (INT16U)(BenchRand(ctx) % 200);
+    report->ingressTrafficP1 = (INT16U)(BenchRand(ctx) % 200);
+    report->ingressTrafficP2 = (INT16U)(BenchRand(ctx) % 100);
+    report->ingressTrafficP3 = (INT16U)(BenchRand(ctx) % 50);
+    report->neededL2Xput = report->ingressTrafficP0 + report->ingressTrafficP1 +
+                           report->ingressTrafficP2 + report->ingressTrafficP3;
+    report->macEfficiency = 80;
+    report->rxReports = 1;
+    report->reportsReceived = TRUE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchClusterBuild(t_benchCtx *ctx)
+{
+  t_VB_engineErrorCode       ret;
+  t_VBCluster               *cluster = NULL;
+  t_reqMeasurement          *meas_req = NULL;
+  t_vbEADomainDiffRspDMAdded *dms = NULL;
+  t_vbEADomainDiffRspEPAdded *eps = NULL;
+  INT32U                     drv_idx;
+
+  ret = VbEngineDatamodelCreateCluster(&cluster);
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    cluster->clusterInfo.clusterId = BENCH_CLUSTER_ID;
+    cluster->clusterInfo.numLines = ctx->conf.numLines;
+    ret = VbEngineCltListClusterAdd(cluster);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineMeasurePlanClusterResourcesAlloc(BENCH_CLUSTER_ID, &meas_req);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    meas_req->planId = BENCH_PLAN_ID;
+    ret = VbEngineCdtaClusterResourcesAlloc(BENCH_CLUSTER_ID);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    dms = calloc(BENCH_DMS_PER_ADD, sizeof(*dms));
+    eps = calloc(BENCH_DMS_PER_ADD, sizeof(*eps));
+
+    if ((dms == NULL) || (eps == NULL))
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  for (drv_idx = 0; (ret == VB_ENGINE_ERROR_NONE) && (drv_idx < ctx->conf.numDrivers); drv_idx++)
+  {
+    t_VBDriver *driver = NULL;
+    CHAR        driver_id[VB_EA_DRIVER_ID_MAX_SIZE];
+    INT32U      first_line;
+    INT32U      last_line;
+    INT32U      line;
+    INT32U      num;
+
+    // Lines are shared evenly among drivers
+    first_line = (drv_idx * ctx->conf.numLines) / ctx->conf.numDrivers;
+    last_line = ((drv_idx + 1) * ctx->conf.numLines) / ctx->conf.numDrivers;
+
+    snprintf(driver_id, sizeof(driver_id), "bench%u", drv_idx);
+    ret = VbEngineDatamodelCreateDriver(driver_id, &driver);
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      driver->clusterId = BENCH_CLUSTER_ID;
+      driver->FSMState = ENGINE_STT_BOOSTING_WAIT_TRGS;
+      ret = VbEngineDrvListDriverAdd(driver);
+    }
+
+    for (line = first_line; (ret == VB_ENGINE_ERROR_NONE) && (line < last_line); line += num)
+    {
+      INT32U idx;
+
+      num = MIN(BENCH_DMS_PER_ADD, last_line - line);
+
+      for (idx = 0; idx < num; idx++)
+      {
+        bzero(&dms[idx], sizeof(dms[idx]));
+        BenchNodeMacBuild(line + idx, FALSE, dms[idx].dmMAC);
+        dms[idx].dmDevId = 1;
+        dms[idx].numEps = 1;
+
+        bzero(&eps[idx], sizeof(eps[idx]));
+        BenchNodeMacBuild(line + idx, FALSE, eps[idx].dmMAC);
+        BenchNodeMacBuild(line + idx, TRUE, eps[idx].epMAC);
+        eps[idx].epDevId = 2;
+      }
+
+      ret = VbEngineDatamodelListDomainsDMsAdd(driver, num, dms);
+
+      if (ret == VB_ENGINE_ERROR_NONE)
+      {
+        ret = VbEngineDatamodelListDomainsEPsAdd(driver, num, eps);
+      }
+    }
+  }
+
+  if (dms != NULL)
+  {
+    free(dms);
+  }
+
+  if (eps != NULL)
+  {
+    free(eps);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineDatamodelClusterXAllNodesLoop(BenchNodeFillCb, BENCH_CLUSTER_ID, ctx);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    t_vbEngineQosRate qos_rate;
+
+    // Derived data needed by CDTA and PSD shape kernels
+    ret = VbEngineBenchSnrAndCapacityRun(BENCH_CLUSTER_ID);
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      ret = VbCdtaAnalyseRun(&qos_rate, BENCH_CLUSTER_ID);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void BenchClusterDestroy(void)
+{
+  VbEngineDrvListDriversDestroy();
+  VbEngineCltListClustersDestroy();
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchSnrLoopCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_benchCtx *ctx = (t_benchCtx *)args;
+
+  if (VbEngineBenchSnrNodeRun(driver, node, ctx->snrRx1, ctx->snrRx2) != VB_ENGINE_ERROR_NONE)
+  {
+    ctx->errors++;
+  }
+
+  return VB_ENGINE_ERROR_NONE;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchSnrRun(t_benchCtx *ctx)
+{
+  return VbEngineDatamodelClusterXAllNodesLoop(BenchSnrLoopCb, BENCH_CLUSTER_ID, ctx);
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchSnrSparseLoopCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_benchCtx *ctx = (t_benchCtx *)args;
+
+  if (VbEngineBenchSnrSparseNodeRun(driver, node, ctx->snrRx1, ctx->snrRx2) != VB_ENGINE_ERROR_NONE)
+  {
+    ctx->errors++;
+  }
+
+  return VB_ENGINE_ERROR_NONE;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchSnrSparseRun(t_benchCtx *ctx)
+{
+  return VbEngineDatamodelClusterXAllNodesLoop(BenchSnrSparseLoopCb, BENCH_CLUSTER_ID, ctx);
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchCapacityLoopCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_benchCtx *ctx = (t_benchCtx *)args;
+
+  if (VbEngineBenchCapacityNodeRun(node, ctx->capacity) != VB_ENGINE_ERROR_NONE)
+  {
+    ctx->errors++;
+  }
+
+  return VB_ENGINE_ERROR_NONE;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchCapacityRun(t_benchCtx *ctx)
+{
+  return VbEngineDatamodelClusterXAllNodesLoop(BenchCapacityLoopCb, BENCH_CLUSTER_ID, ctx);
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchSnrCapacityRun(t_benchCtx *ctx)
+{
+  return VbEngineBenchSnrAndCapacityRun(BENCH_CLUSTER_ID);
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchCdtaRun(t_benchCtx *ctx)
+{
+  t_vbEngineQosRate qos_rate;
+
+  return VbCdtaAnalyseRun(&qos_rate, BENCH_CLUSTER_ID);
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchL2rPsdRun(t_benchCtx *ctx)
+{
+  t_psdl2rArgs psd_l2r_args;
+
+  psd_l2r_args.qos = VbCdtaQosRateGet(BENCH_CLUSTER_ID);
+  psd_l2r_args.psdBandsAllocation = VbEngineConfPSDBandAllocationGet();
+
+  return VbEngineDatamodelClusterXAllNodesLoop(VbEngineLeftToRightPSDShapeRun, BENCH_CLUSTER_ID, &psd_l2r_args);
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchAlignRun(t_benchCtx *ctx)
+{
+  // Result (aligned or not) is not relevant, only the passes over the cluster
+  VbEngineAlignCheck(BENCH_CLUSTER_ID);
+
+  return VB_ENGINE_ERROR_NONE;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchKernelMeasure(t_benchCtx *ctx, const t_benchKernel *kernel, t_benchResult *result)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT64U              *samples;
+  INT32U               rep;
+  INT64U               total = 0;
+
+  bzero(result, sizeof(*result));
+  result->name = kernel->name;
+
+  samples = calloc(ctx->conf.reps, sizeof(INT64U));
+  if (samples == NULL)
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ctx->errors = 0;
+
+    for (rep = 0; rep < ctx->conf.warmup; rep++)
+    {
+      if (kernel->run(ctx) != VB_ENGINE_ERROR_NONE)
+      {
+        ctx->errors++;
+      }
+    }
+
+    for (rep = 0; rep < ctx->conf.reps; rep++)
+    {
+      struct timespec start;
+      struct timespec end;
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+
+      if (kernel->run(ctx) != VB_ENGINE_ERROR_NONE)
+      {
+        ctx->errors++;
+      }
+
+      clock_gettime(CLOCK_MONOTONIC, &end);
+
+      samples[rep] = (INT64U)VbUtilElapsetimeTimespecNs(&start, &end);
+      total += samples[rep];
+    }
+
+    qsort(samples, ctx->conf.reps, sizeof(INT64U), VbEngineBenchSampleCmp);
+
+    result->reps = ctx->conf.reps;
+    result->errors = ctx->errors;
+    result->minNs = samples[0];
+    result->maxNs = samples[ctx->conf.reps - 1];
+    result->p50Ns = VbEngineBenchPercentileGet(samples, ctx->conf.reps, 500);
+    result->p90Ns = VbEngineBenchPercentileGet(samples, ctx->conf.reps, 900);
+    result->p99Ns = VbEngineBenchPercentileGet(samples, ctx->conf.reps, 990);
+    result->meanNs = (double)total / ctx->conf.reps;
+    result->nsPerNode = (double)result->p50Ns / ctx->numNodes;
+    result->nsPerCarrier = result->nsPerNode / ctx->conf.numCarriers;
+
+    free(samples);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static BOOLEAN BenchKernelSelected(const t_benchConf *conf, const CHAR *name)
+{
+  BOOLEAN selected = FALSE;
+  CHAR    list[sizeof(conf->kernels)];
+  CHAR   *save_ptr = NULL;
+  CHAR   *token;
+
+  strncpy(list, conf->kernels, sizeof(list));
+  list[sizeof(list) - 1] = '\0';
+
+  for (token = strtok_r(list, ",", &save_ptr); token != NULL; token = strtok_r(NULL, ",", &save_ptr))
+  {
+    if ((strcmp(token, "all") == 0) || (strcmp(token, name) == 0))
+    {
+      selected = TRUE;
+      break;
+    }
+  }
+
+  return selected;
+}
+
+/*******************************************************************/
+
+static void BenchResultsPrint(const t_benchCtx *ctx, const t_benchResult *results, INT32U numResults)
+{
+  INT32U idx;
+
+  printf("Lines %u (nodes %u), drivers %u, carriers %u, %s, crosstalk density %u%%, warmup %u, reps %u\n",
+      ctx->conf.numLines, ctx->numNodes, ctx->conf.numDrivers, ctx->conf.numCarriers,
+      ctx->conf.mimo?"MIMO":"SISO", ctx->conf.xtalkDensity, ctx->conf.warmup, ctx->conf.reps);
+  printf("=========================================================================================================================\n");
+  printf("|    Kernel    |   min (us)   |   p50 (us)   |   p90 (us)   |   p99 (us)   |   max (us)   |  ns/carrier  |   ns/node    | Err |\n");
+  printf("=========================================================================================================================\n");
+
+  for (idx = 0; idx < numResults; idx++)
+  {
+    printf("| %-12s | %12.1f | %12.1f | %12.1f | %12.1f | %12.1f | %12.3f | %12.1f | %3u |\n",
+        results[idx].name,
+        results[idx].minNs / 1000.0,
+        results[idx].p50Ns / 1000.0,
+        results[idx].p90Ns / 1000.0,
+        results[idx].p99Ns / 1000.0,
+        results[idx].maxNs / 1000.0,
+        results[idx].nsPerCarrier,
+        results[idx].nsPerNode,
+        results[idx].errors);
+  }
+
+  printf("=========================================================================================================================\n");
+}
+
+/*******************************************************************/
+
+static INT32S BenchResultsSave(const t_benchCtx *ctx, const t_benchResult *results, INT32U numResults)
+{
+  INT32S         ret = 0;
+  FILE          *fp;
+  INT32U         idx;
+
+  fp = fopen(ctx->conf.outFile, "w");
+  if (fp == NULL)
+  {
+    ret = -1;
+  }
+
+  if (ret == 0)
+  {
+    fprintf(fp, "{\n");
+    VbEngineBenchJsonHeaderWrite(fp);
+    fprintf(fp, "  \"config\": {\"lines\": %u, \"nodes\": %u, \"drivers\": %u, \"carriers\": %u, \"mimo\": %s, "
+                "\"xtalk_density\": %u, \"warmup\": %u, \"reps\": %u, \"seed\": %u},\n",
+        ctx->conf.numLines, ctx->numNodes, ctx->conf.numDrivers, ctx->conf.numCarriers,
+        ctx->conf.mimo?"true":"false", ctx->conf.xtalkDensity, ctx->conf.warmup, ctx->conf.reps, ctx->conf.seed);
+    fprintf(fp, "  \"results\": [\n");
+
+    for (idx = 0; idx < numResults; idx++)
+    {
+      fprintf(fp, "    {\"kernel\": \"%s\", \"reps\": %u, \"errors\": %u, \"min_ns\": %llu, \"p50_ns\": %llu, "
+                  "\"p90_ns\": %llu, \"p99_ns\": %llu, \"max_ns\": %llu, \"mean_ns\": %.1f, "
+                  "\"ns_per_carrier\": %.3f, \"ns_per_node\": %.1f}%s\n",
+          results[idx].name, results[idx].reps, results[idx].errors,
+          (unsigned long long)results[idx].minNs, (unsigned long long)results[idx].p50Ns,
+          (unsigned long long)results[idx].p90Ns, (unsigned long long)results[idx].p99Ns,
+          (unsigned long long)results[idx].maxNs,
+          results[idx].meanNs, results[idx].nsPerCarrier, results[idx].nsPerNode,
+          (idx + 1 < numResults)?",":"");
+    }
+
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+
+    fclose(fp);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void BenchUsage(void)
+{
+  INT32U idx;
+
+  printf("Command line:\n\t%s %s -h\t(EA protocol loopback benchmark)\n", BENCH_NAME, BENCH_EA_SUBCOMMAND);
+  printf("\t%s [-f PATHFILEINI] [-n LINES] [-d DRIVERS] [-c CARRIERS] [-x DENSITY] [-m] [-w WARMUP] [-r REPS] [-s SEED] [-k KERNELS] [-o FILE] [-h]\n", BENCH_NAME);
+  printf("Where:\n");
+  printf("\t-f\tEngine ini file (default %s)\n", BENCH_DEFAULT_INI);
+  printf("\t-n\tNumber of lines (DM + EP) in the cluster (max %u)\n", BENCH_MAX_LINES);
+  printf("\t-d\tNumber of drivers the lines are shared among (max %u)\n", BENCH_MAX_DRIVERS);
+  printf("\t-c\tNumber of measured carriers per node (max %u)\n", BENCH_MAX_CARRIERS);
+  printf("\t-x\tCrosstalk density: percentage of other lines in each CFR list\n");
+  printf("\t-m\tMIMO measures\n");
+  printf("\t-w\tWarmup runs per kernel\n");
+  printf("\t-r\tTimed repetitions per kernel\n");
+  printf("\t-s\tSeed of synthetic data\n");
+  printf("\t-k\tComma separated list of kernels (default all):\n");
+
+  for (idx = 0; idx < BENCH_NUM_KERNELS; idx++)
+  {
+    printf("\t\t%-14s%s\n", benchKernels[idx].name, benchKernels[idx].desc);
+  }
+
+  printf("\t-o\tSave results to FILE (JSON)\n");
+  printf("\t-h\tShow this help\n");
+}
+
+/*******************************************************************/
+
+static BOOLEAN BenchArgsParse(int argc, char **argv, t_benchConf *conf)
+{
+  BOOLEAN ret = TRUE;
+  int     opt;
+
+  bzero(conf, sizeof(*conf));
+  strncpy(conf->iniFile, BENCH_DEFAULT_INI, sizeof(conf->iniFile) - 1);
+  strncpy(conf->kernels, "all", sizeof(conf->kernels) - 1);
+  conf->numLines = 64;
+  conf->numDrivers = 1;
+  conf->numCarriers = 4096;
+  conf->xtalkDensity = 100;
+  conf->warmup = 3;
+  conf->reps = 20;
+  conf->seed = 1;
+
+  while ((ret == TRUE) && ((opt = getopt(argc, argv, "f:n:d:c:x:mw:r:s:k:o:h")) != -1))
+  {
+    switch (opt)
+    {
+      case ('f'):
+      {
+        strncpy(conf->iniFile, optarg, sizeof(conf->iniFile) - 1);
+        break;
+      }
+      case ('n'):
+      {
+        conf->numLines = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('d'):
+      {
+        conf->numDrivers = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('c'):
+      {
+        conf->numCarriers = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('x'):
+      {
+        conf->xtalkDensity = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('m'):
+      {
+        conf->mimo = TRUE;
+        break;
+      }
+      case ('w'):
+      {
+        conf->warmup = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('r'):
+      {
+        conf->reps = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('s'):
+      {
+        conf->seed = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('k'):
+      {
+        strncpy(conf->kernels, optarg, sizeof(conf->kernels) - 1);
+        break;
+      }
+      case ('o'):
+      {
+        strncpy(conf->outFile, optarg, sizeof(conf->outFile) - 1);
+        break;
+      }
+      default:
+      {
+        ret = FALSE;
+        break;
+      }
+    }
+  }
+
+  if ((ret == TRUE) &&
+      ((conf->numLines == 0) || (conf->numLines > BENCH_MAX_LINES) ||
+       (conf->numDrivers == 0) || (conf->numDrivers > BENCH_MAX_DRIVERS) || (conf->numDrivers > conf->numLines) ||
+       (conf->numCarriers < 2) || (conf->numCarriers > BENCH_MAX_CARRIERS) ||
+       (conf->xtalkDensity > 100) || (conf->reps == 0) || (conf->seed == 0)))
+  {
+    printf("Invalid parameters\n");
+    ret = FALSE;
+  }
+
+  if (ret == TRUE)
+  {
+    // Keep even number of carriers (MIMO measures interleave streams)
+    conf->numCarriers &= ~1U;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static int BenchKernelsRun(int argc, char **argv)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_benchCtx           ctx;
+  t_benchResult        results[BENCH_NUM_KERNELS];
+  INT32U               num_results = 0;
+  INT32U               idx;
+
+  bzero(&ctx, sizeof(ctx));
+
+  if (BenchArgsParse(argc, argv, &ctx.conf) == FALSE)
+  {
+    BenchUsage();
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    char *conf_argv[] = {BENCH_NAME, "-f", ctx.conf.iniFile, NULL};
+
+    // Reuse engine configuration parser (bands allocation, CDTA and alignment settings)
+    optind = 1;
+    ret = VbEngineConfParse(3, conf_argv);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Only errors, kernels log per node
+    VbLogVerboseLevelSet(VB_LOG_ERROR);
+    VbEngineDatamodelStart();
+
+    ctx.randState = ctx.conf.seed;
+    ctx.numNodes = 2 * ctx.conf.numLines;
+    ctx.snrRx1 = calloc(1, ctx.conf.numCarriers);
+    ctx.snrRx2 = calloc(1, ctx.conf.numCarriers);
+
+    if ((ctx.snrRx1 == NULL) || (ctx.snrRx2 == NULL))
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = BenchClusterBuild(&ctx);
+
+    if (ret != VB_ENGINE_ERROR_NONE)
+    {
+      printf("Error %d building synthetic cluster\n", ret);
+    }
+  }
+
+  for (idx = 0; (ret == VB_ENGINE_ERROR_NONE) && (idx < BENCH_NUM_KERNELS); idx++)
+  {
+    if (BenchKernelSelected(&ctx.conf, benchKernels[idx].name) == TRUE)
+    {
+      ret = BenchKernelMeasure(&ctx, &benchKernels[idx], &results[num_results]);
+
+      if (ret == VB_ENGINE_ERROR_NONE)
+      {
+        num_results++;
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    BenchResultsPrint(&ctx, results, num_results);
+
+    if ((ctx.conf.outFile[0] != '\0') && (BenchResultsSave(&ctx, results, num_results) != 0))
+    {
+      printf("Error saving results to %s\n", ctx.conf.outFile);
+      ret = VB_ENGINE_ERROR_PARAMS;
+    }
+  }
+
+  BenchClusterDestroy();
+  VbEngineConfReleaseResources();
+
+  if (ctx.snrRx1 != NULL)
+  {
+    free(ctx.snrRx1);
+  }
+
+  if (ctx.snrRx2 != NULL)
+  {
+    free(ctx.snrRx2);
+  }
+
+  return (ret == VB_ENGINE_ERROR_NONE)?0:1;
+}
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+int VbEngineBenchSampleCmp(const void *a, const void *b)
+{
+  INT64U va = *(const INT64U *)a;
+  INT64U vb = *(const INT64U *)b;
+
+  return (va > vb) - (va < vb);
+}
+
+/*******************************************************************/
+
+INT64U VbEngineBenchPercentileGet(const INT64U *sorted, INT32U num, INT32U permille)
+{
+  INT64U idx;
+
+  // Nearest rank
+  idx = (((INT64U)permille * num) + 999) / 1000;
+  idx = (idx == 0)?0:(idx - 1);
+
+  return sorted[MIN(idx, (INT64U)num - 1)];
+}
+
+/*******************************************************************/
+
+void VbEngineBenchJsonHeaderWrite(FILE *fp)
+{
+  struct utsname sys_info;
+
+  if (uname(&sys_info) != 0)
+  {
+    strcpy(sys_info.machine, "unknown");
+  }
+
+  fprintf(fp, "  \"tool\": \"%s\",\n", BENCH_NAME);
+  fprintf(fp, "  \"version\": \"%s\",\n", VB_ENGINE_VERSION);
+  fprintf(fp, "  \"arch\": \"%s\",\n", sys_info.machine);
+  fprintf(fp, "  \"compiler\": \"%s\",\n", __VERSION__);
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineKill(void)
+{
+  // No engine threads to stop, vb_engine_main.c is not linked in the bench
+  return VB_ENGINE_ERROR_NONE;
+}
+
+/*******************************************************************/
+
+int main(int argc, char **argv)
+{
+  int exit_code;
+
+  if ((argc > 1) && (strcmp(argv[1], BENCH_EA_SUBCOMMAND) == 0))
+  {
+    // EA protocol loopback benchmark
+    exit_code = VbEngineBenchEARun(argc - 1, argv + 1);
+  }
+  else
+  {
+    exit_code = BenchKernelsRun(argc, argv);
+  }
+
+  return exit_code;
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/
@@ -0,0 +1,154 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_bench.h
+ * @brief Entry points to engine kernels and helpers shared by the benchmark tools
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_BENCH_H_
+#define VB_ENGINE_BENCH_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+
+#include "types.h"
+#include "vb_types.h"
+#include "vb_ea_communication.h"
+#include "vb_engine_datamodel.h"
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Runs SISO or MIMO SNR kernel (depending on BGN measure) for given node with full crosstalk
+ * @param[in] driver Driver the node belongs to
+ * @param[in] node Node with BGN and CFR measures
+ * @param[out] snrRx1 SNR output buffer (stream 1). Size: number of BGN carriers
+ * @param[out] snrRx2 SNR output buffer (stream 2, MIMO only). Size: number of BGN carriers
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineBenchSnrNodeRun(t_VBDriver *driver, t_node *node, INT8U *snrRx1, INT8U *snrRx2);
+
+/**
+ * @brief Runs crosstalk significance analysis and then SISO or MIMO SNR kernel accumulating only significant disturbers
+ * @param[in] driver Driver the node belongs to
+ * @param[in,out] node Node with BGN and CFR measures
+ * @param[out] snrRx1 SNR output buffer (stream 1). Size: number of BGN carriers
+ * @param[out] snrRx2 SNR output buffer (stream 2, MIMO only). Size: number of BGN carriers
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineBenchSnrSparseNodeRun(t_VBDriver *driver, t_node *node, INT8U *snrRx1, INT8U *snrRx2);
+
+/**
+ * @brief Runs channel capacity kernel over the full crosstalk SNR of given node
+ * @param[in] node Node with SNR already calculated
+ * @param[out] capacity Capacity per band. Size: VB_PSD_NUM_BANDS
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineBenchCapacityNodeRun(t_node *node, float *capacity);
+
+/**
+ * @brief Runs the engine SNR and channel capacity computation over a cluster (same steps as computation thread)
+ * @param[in] clusterId Cluster Id
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineBenchSnrAndCapacityRun(INT32U clusterId);
+
+/**
+ * @brief Returns the callback the engine installs to process frames received from drivers
+ * @return Engine EA rx callback
+ **/
+t_vbEAProcessRxMsgCb VbEngineBenchEAFrameRxCbGet(void);
+
+/**
+ * @brief Runs the EA protocol loopback benchmark
+ * @param[in] argc Number of arguments (first one is the subcommand name)
+ * @param[in] argv Arguments
+ * @return 0 on success; 1 otherwise
+ **/
+int VbEngineBenchEARun(int argc, char **argv);
+
+/**
+ * @brief qsort compare function for INT64U samples
+ **/
+int VbEngineBenchSampleCmp(const void *a, const void *b);
+
+/**
+ * @brief Gets a percentile (nearest rank) from a sorted array of samples
+ * @param[in] sorted Samples sorted in ascending order
+ * @param[in] num Number of samples (> 0)
+ * @param[in] permille Percentile in tenths of percent (ex.: 990 for p99)
+ * @return Sample value
+ **/
+INT64U VbEngineBenchPercentileGet(const INT64U *sorted, INT32U num, INT32U permille);
+
+/**
+ * @brief Writes the common fields (tool, version, architecture and compiler) of a JSON results file
+ * @param[in] fp Opened file
+ **/
+void VbEngineBenchJsonHeaderWrite(FILE *fp);
+
+/**
+ * @brief Resets allocator call counters
+ **/
+void VbEngineBenchAllocCountersReset(void);
+
+/**
+ * @brief Gets allocator call counters since last reset
+ * @param[out] allocs Number of malloc, calloc and realloc calls
+ * @param[out] frees Number of free calls
+ **/
+void VbEngineBenchAllocCountersGet(INT64U *allocs, INT64U *frees);
+
+#endif /* VB_ENGINE_BENCH_H_ */
+
+/**
+ * @}
+ **/
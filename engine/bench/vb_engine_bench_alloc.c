@@ -0,0 +1,161 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_bench_alloc.c
+ * @brief Allocator call counters for the benchmark tools
+ *
+ * @internal
+ *
+ * The benchmark is linked with "--wrap" for malloc, calloc, realloc and free,
+ * so every call done from engine and common objects goes through these
+ * wrappers. Calls done inside libc itself are not counted.
+ * When malloc debug wrappers are built (_USE_MALLOC_MUTEX_) they take
+ * precedence and counters stay at 0.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdlib.h>
+
+#include "types.h"
+#include "vb_engine_bench.h"
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+// Updated with __sync builtins (as in vb_ea_shm.c), so gcc-4.4 toolchains build the bench
+static INT32U vbBenchAllocCalls;
+static INT32U vbBenchFreeCalls;
+
+#if (_USE_MALLOC_MUTEX_ != 1)
+
+/*
+ ************************************************************************
+ ** Allocator wrappers
+ ************************************************************************
+ */
+
+extern void *__real_malloc(size_t size);
+extern void *__real_calloc(size_t nmemb, size_t size);
+extern void *__real_realloc(void *ptr, size_t size);
+extern void  __real_free(void *ptr);
+
+/*******************************************************************/
+
+void *__wrap_malloc(size_t size)
+{
+  __sync_fetch_and_add(&vbBenchAllocCalls, 1);
+
+  return __real_malloc(size);
+}
+
+/*******************************************************************/
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+  __sync_fetch_and_add(&vbBenchAllocCalls, 1);
+
+  return __real_calloc(nmemb, size);
+}
+
+/*******************************************************************/
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+  __sync_fetch_and_add(&vbBenchAllocCalls, 1);
+
+  return __real_realloc(ptr, size);
+}
+
+/*******************************************************************/
+
+void __wrap_free(void *ptr)
+{
+  if (ptr != NULL)
+  {
+    __sync_fetch_and_add(&vbBenchFreeCalls, 1);
+  }
+
+  __real_free(ptr);
+}
+
+#endif
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+void VbEngineBenchAllocCountersReset(void)
+{
+  __sync_fetch_and_and(&vbBenchAllocCalls, 0);
+  __sync_fetch_and_and(&vbBenchFreeCalls, 0);
+}
+
+/*******************************************************************/
+
+void VbEngineBenchAllocCountersGet(INT64U *allocs, INT64U *frees)
+{
+  if (allocs != NULL)
+  {
+    *allocs = __sync_fetch_and_add(&vbBenchAllocCalls, 0);
+  }
+
+  if (frees != NULL)
+  {
+    *frees = __sync_fetch_and_add(&vbBenchFreeCalls, 0);
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/
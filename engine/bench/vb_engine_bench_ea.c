@@ -0,0 +1,1866 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_bench_ea.c
+ * @brief EA protocol loopback benchmark
+ *
+ * @internal
+ *
+ * K driver connections push synthetic CFR, BGN, traffic awareness and
+ * domains frames (configurable mix and sizes) into the engine reception path:
+ *
+ *  - "tcp" transport: frames are sent over loopback TCP sockets and received
+ *    by engine EA connection threads (VbEAConnProcess).
+ *  - "direct" transport: sender threads call the engine rx callback directly,
+ *    so socket and kernel costs are left out.
+ *  - "shm" transport: loopback connections negotiate the shared memory
+ *    transport and frames are written into its rings, read by the same
+ *    engine EA connection threads.
+ *
+ * In all cases frames are parsed (VbEAMsgParse), translated and posted to the
+ * event scheduler (VbEngineProcessEAFrameRx) exactly as in the engine. A
+ * consumer thread plays the engine process thread role: it pops the events
+ * and releases the messages, timestamping each frame end to end.
+ * FSM handlers are not run.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <mqueue.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/resource.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_thread.h"
+#include "vb_ea_communication.h"
+#include "vb_ea_shm.h"
+#include "vb_engine_datamodel.h"
+#include "vb_engine_process.h"
+#include "vb_engine_event_sched.h"
+#include "vb_priorities.h"
+#include "vb_engine_bench.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define BENCH_EA_QUEUE_NAME                          ("/VbBenchEAQ")
+#define BENCH_EA_TX_THREAD_NAME                      ("bench_ea_tx")
+#define BENCH_EA_RX_THREAD_NAME                      ("bench_ea_process")
+#define BENCH_EA_CONN_THREAD_NAME                    ("bench_ea_conn%u")
+#define BENCH_EA_DRIVER_ID                           ("bench_ea%u")
+#define BENCH_EA_MAX_CONNS                           (256)
+#define BENCH_EA_MAX_PRODUCERS                       (64)
+#define BENCH_EA_MAX_WINDOW                          (65536)
+#define BENCH_EA_MAX_SAMPLES                         (16 * 1024 * 1024)
+#define BENCH_EA_MAX_PAYLOAD                         (0xFFFF)
+#define BENCH_EA_FIRST_CARRIER                       (74)
+#define BENCH_EA_PLAN_ID                             (1)
+#define BENCH_EA_TX_TIMEOUT                          (100)    // In ms
+#define BENCH_EA_STALL_TIMEOUT                       (10000)  // In ms, without any frame received
+#define BENCH_EA_CONNECT_TIMEOUT                     (2000)   // In ms
+#define BENCH_EA_POLL_PERIOD                         (1)      // In ms
+#define BENCH_EA_DEFAULT_MIX                         ("cfr=70,bgn=10,traffic=15,domains=5")
+#define BENCH_EA_MIX_LEN                             (128)
+#define BENCH_EA_FILE_NAME_LENGTH                    (150)
+#define BENCH_EA_INVALID_FD                          (-1)
+#define BENCH_EA_MQ_MSG_MAX_FILE                     ("/proc/sys/fs/mqueue/msg_max")
+#define BENCH_EA_MQ_MSG_MAX_DEFAULT                  (10)     // Kernel default of msg_max
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef enum
+{
+  BENCH_EA_TRANSPORT_TCP = 0,
+  BENCH_EA_TRANSPORT_DIRECT,
+  BENCH_EA_TRANSPORT_SHM,
+  BENCH_EA_TRANSPORT_LAST,
+} t_benchEATransport;
+
+typedef enum
+{
+  BENCH_EA_FRAME_CFR = 0,
+  BENCH_EA_FRAME_BGN,
+  BENCH_EA_FRAME_TRAFFIC,
+  BENCH_EA_FRAME_DOMAINS,
+  BENCH_EA_FRAME_LAST,
+} t_benchEAFrameType;
+
+typedef struct
+{
+  const CHAR   *name;
+  t_vbEAOpcode  opcode;
+} t_benchEAFrameDesc;
+
+typedef struct
+{
+  CHAR                outFile[BENCH_EA_FILE_NAME_LENGTH];
+  CHAR                mix[BENCH_EA_MIX_LEN];
+  t_benchEATransport  transport;
+  INT32U              numConns;
+  INT32U              numProducers;
+  INT32U              frames;          ///< Timed frames per connection
+  INT32U              warmup;          ///< Warmup frames per connection
+  INT32U              window;          ///< Max frames in flight per connection
+  INT32U              queueDepth;      ///< Process queue depth (messages)
+  INT32U              numCarriers;
+  INT32U              numDomains;      ///< Domains per domains frame and reports per traffic frame
+  BOOLEAN             mimo;
+  BOOLEAN             ioUring;         ///< EA connection threads read sockets through io_uring
+  INT32U              seed;
+  INT32U              weights[BENCH_EA_FRAME_LAST];
+  INT32U              totalWeight;
+} t_benchEAConf;
+
+typedef struct
+{
+  INT64U              sendNs;
+  t_benchEAFrameType  type;
+  BOOLEAN             done;             ///< Received, slot released once it reaches ring head
+} t_benchEAInFlight;
+
+typedef struct s_benchEAProducer t_benchEAProducer;
+
+typedef struct
+{
+  INT32U              idx;
+  t_VBDriver         *driver;
+  INT32S              clientFd;
+  t_vbEAShm          *shm;              ///< Driver side of shared memory transport
+  t_benchEAProducer  *producer;
+  t_vbEAMsg          *frames[BENCH_EA_FRAME_LAST];
+  t_benchEAInFlight  *ring;             ///< Frames in flight, in sending order (protected by producer mutex)
+  INT32U              ringHead;
+  INT32U              ringTail;
+  INT32U              inFlight;
+  INT32U              sent;
+  INT32U              toSend;
+} t_benchEAConn;
+
+struct s_benchEAProducer
+{
+  INT32U              idx;
+  pthread_t           threadId;
+  pthread_mutex_t     mutex;
+  pthread_cond_t      cond;
+  t_benchEAConn     **conns;
+  INT32U              numConns;
+  INT32U              randState;
+  INT64U              cpuNs;
+  struct s_benchEACtx *ctx;
+};
+
+typedef struct
+{
+  INT64U              frames;
+  INT64U              bytes;
+  INT64U              elapsedNs;
+  INT64U              cpuNs;           ///< Whole process CPU time
+  INT64U              rxCpuNs;         ///< CPU time of reception threads (EA threads or direct senders) and consumer
+  INT64U              allocs;
+  INT64U              frees;
+  INT64U              count[BENCH_EA_FRAME_LAST];
+  INT64U              p50Ns[BENCH_EA_FRAME_LAST];
+  INT64U              p90Ns[BENCH_EA_FRAME_LAST];
+  INT64U              p99Ns[BENCH_EA_FRAME_LAST];
+  INT64U              p999Ns[BENCH_EA_FRAME_LAST];
+  INT64U              maxNs[BENCH_EA_FRAME_LAST];
+} t_benchEAResult;
+
+typedef struct s_benchEACtx
+{
+  t_benchEAConf       conf;
+  t_benchEAConn      *conns;
+  t_benchEAConn     **connsByDriver;    ///< Sorted by driver pointer
+  t_benchEAProducer  *producers;
+  t_vbQueueName       queueName;
+  mqd_t               queueId;
+  BOOLEAN             queueCreated;
+  BOOLEAN             schedStarted;
+  INT32S              listenFd;
+  pthread_t           rxThreadId;
+  BOOLEAN             rxRunning;
+  BOOLEAN             abort;
+  BOOLEAN             recording;
+  INT32U              received;               ///< Updated with __sync builtins
+  INT32U              errors;
+  INT64U              rxBytes;
+  INT64U             *latNs;
+  INT8U              *latType;
+  INT64U              numSamples;
+  INT64U              maxSamples;
+} t_benchEACtx;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static const CHAR *benchEATransportStr[BENCH_EA_TRANSPORT_LAST] = {"tcp", "direct", "shm"};
+
+static const t_benchEAFrameDesc benchEAFrames[BENCH_EA_FRAME_LAST] =
+{
+  {"cfr",     VB_EA_OPCODE_CFR_RESP},
+  {"bgn",     VB_EA_OPCODE_BGN_RESP},
+  {"traffic", VB_EA_OPCODE_TRAFFIC_AWARENESS_TRG},
+  {"domains", VB_EA_OPCODE_DOMAIN_RESP},
+};
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+static INT64U BenchEANowNs(clockid_t clockId)
+{
+  struct timespec ts;
+
+  clock_gettime(clockId, &ts);
+
+  return ((INT64U)ts.tv_sec * NSEC_IN_SEC) + ts.tv_nsec;
+}
+
+/*******************************************************************/
+
+static INT64U BenchEAThreadCpuNs(pthread_t threadId)
+{
+  clockid_t clock_id;
+  INT64U    cpu_ns = 0;
+
+  if ((threadId != 0) && (pthread_getcpuclockid(threadId, &clock_id) == 0))
+  {
+    cpu_ns = BenchEANowNs(clock_id);
+  }
+
+  return cpu_ns;
+}
+
+/*******************************************************************/
+
+static INT64U BenchEAProcessCpuNs(void)
+{
+  struct rusage usage;
+  INT64U        cpu_ns = 0;
+
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+    cpu_ns = ((INT64U)usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * NSEC_IN_SEC;
+    cpu_ns += ((INT64U)usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1000;
+  }
+
+  return cpu_ns;
+}
+
+/*******************************************************************/
+
+static INT32U BenchEARand(INT32U *state)
+{
+  // xorshift32, deterministic for a given seed
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+
+  return *state;
+}
+
+/*******************************************************************/
+
+static void BenchEAMacBuild(INT32U conn, INT32U node, INT8U *mac)
+{
+  mac[0] = 0x02;
+  mac[1] = 0xEA;
+  mac[2] = (INT8U)conn;
+  mac[3] = (INT8U)(node >> 8);
+  mac[4] = (INT8U)(node & 0xFF);
+  mac[5] = 0x00;
+}
+
+/*******************************************************************/
+
+static INT32U BenchEAPayloadLenGet(const t_benchEAConf *conf, t_benchEAFrameType type)
+{
+  INT32U len = 0;
+  INT32U carriers_len = conf->numCarriers * ((conf->mimo == TRUE)?2:1);
+
+  switch (type)
+  {
+    case (BENCH_EA_FRAME_CFR):
+    {
+      len = VB_EA_CFRFRAME_MEASURE_HEADER_SIZE + carriers_len;
+      break;
+    }
+    case (BENCH_EA_FRAME_BGN):
+    {
+      len = VB_EA_BGNFRAME_MEASURE_HEADER_SIZE + carriers_len;
+      break;
+    }
+    case (BENCH_EA_FRAME_TRAFFIC):
+    {
+      len = VB_EA_TRAFFIC_REPORT_HDR_SIZE + (conf->numDomains * VB_EA_TRAFFIC_REPORT_RSP_SIZE);
+      break;
+    }
+    case (BENCH_EA_FRAME_DOMAINS):
+    {
+      len = VB_EA_DOMAINSFRAME_DOMAINS_OFFSET + (conf->numDomains * (VB_EA_DOMAINS_FRAME_DM_SIZE + VB_EA_DOMAINS_FRAME_EP_SIZE));
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  return len;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchEAFrameBuild(t_benchEACtx *ctx, t_benchEAConn *conn, t_benchEAFrameType type, INT32U *randState)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  const t_benchEAConf *conf = &(ctx->conf);
+  t_vbEAMsg           *msg = NULL;
+  INT8U               *pld;
+  INT32U               idx;
+
+  if (VbEAMsgAlloc(&msg, BenchEAPayloadLenGet(conf, type), benchEAFrames[type].opcode) != VB_EA_ERR_NONE)
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pld = msg->eaPayload.msg;
+    bzero(pld, msg->eaPayload.msgLen);
+
+    switch (type)
+    {
+      case (BENCH_EA_FRAME_CFR):
+      {
+        t_vbEACFRMeasure *cfr = (t_vbEACFRMeasure *)pld;
+
+        BenchEAMacBuild(conn->idx, 0, cfr->MACMeasurer);
+        BenchEAMacBuild(conn->idx, 1, cfr->MACMeasured);
+        cfr->ErrorCode = VB_MEAS_ERRCODE_VALID;
+        cfr->numCarriers = _htons(conf->numCarriers);
+        cfr->firstCarrier = _htons(BENCH_EA_FIRST_CARRIER);
+        cfr->spacing = 1;
+        cfr->mimoInd = conf->mimo;
+        cfr->mimoMeas = conf->mimo;
+        cfr->planId = BENCH_EA_PLAN_ID;
+        pld += VB_EA_CFRFRAME_MEASURE_HEADER_SIZE;
+        break;
+      }
+      case (BENCH_EA_FRAME_BGN):
+      {
+        t_vbEABGNMeasure *bgn = (t_vbEABGNMeasure *)pld;
+
+        BenchEAMacBuild(conn->idx, 0, bgn->MAC);
+        bgn->ErrorCode = VB_MEAS_ERRCODE_VALID;
+        bgn->numCarriers = _htons(conf->numCarriers);
+        bgn->firstCarrier = _htons(BENCH_EA_FIRST_CARRIER);
+        bgn->spacing = 1;
+        bgn->mimoInd = conf->mimo;
+        bgn->mimoMeas = conf->mimo;
+        bgn->planId = BENCH_EA_PLAN_ID;
+        pld += VB_EA_BGNFRAME_MEASURE_HEADER_SIZE;
+        break;
+      }
+      case (BENCH_EA_FRAME_TRAFFIC):
+      {
+        t_vbEATrafficReportHdr *hdr = (t_vbEATrafficReportHdr *)pld;
+        t_vbEATrafficReportRsp *report = (t_vbEATrafficReportRsp *)(pld + VB_EA_TRAFFIC_REPORT_HDR_SIZE);
+
+        hdr->numReports = _htonl(conf->numDomains);
+
+        for (idx = 0; idx < conf->numDomains; idx++)
+        {
+          BenchEAMacBuild(conn->idx, idx, report[idx].MAC);
+          report[idx].trafficPrio0 = BenchEARand(randState) % 200;
+          report[idx].trafficPrio1 = BenchEARand(randState) % 200;
+          report[idx].macEfficiency = 80;
+        }
+        break;
+      }
+      case (BENCH_EA_FRAME_DOMAINS):
+      {
+        INT8U *dom = pld + VB_EA_DOMAINSFRAME_DOMAINS_OFFSET;
+
+        *((INT16U *)pld) = _htons(conf->numDomains);
+
+        for (idx = 0; idx < conf->numDomains; idx++)
+        {
+          t_vbEADomainRspDM *dm = (t_vbEADomainRspDM *)dom;
+          t_vbEADomainRspEP *ep = (t_vbEADomainRspEP *)(dom + VB_EA_DOMAINS_FRAME_DM_SIZE);
+
+          BenchEAMacBuild(conn->idx, 2 * idx, dm->DM_MAC);
+          dm->DM_ID = 1;
+          dm->NumEps = _htons(1);
+          BenchEAMacBuild(conn->idx, (2 * idx) + 1, ep->EP_MAC);
+          ep->EP_ID = 2;
+
+          dom += VB_EA_DOMAINS_FRAME_DM_SIZE + VB_EA_DOMAINS_FRAME_EP_SIZE;
+        }
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+
+    if ((type == BENCH_EA_FRAME_CFR) || (type == BENCH_EA_FRAME_BGN))
+    {
+      // Measured carriers
+      for (idx = 0; idx < conf->numCarriers * ((conf->mimo == TRUE)?2:1); idx++)
+      {
+        pld[idx] = (INT8U)BenchEARand(randState);
+      }
+    }
+
+    conn->frames[type] = msg;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static int BenchEAConnDriverCmp(const void *a, const void *b)
+{
+  const t_VBDriver *da = (*(t_benchEAConn * const *)a)->driver;
+  const t_VBDriver *db = (*(t_benchEAConn * const *)b)->driver;
+
+  return (da > db) - (da < db);
+}
+
+/*******************************************************************/
+
+static t_benchEAConn *BenchEAConnByDriverGet(t_benchEACtx *ctx, const t_VBDriver *driver)
+{
+  t_benchEAConn  *conn = NULL;
+  INT32U          low = 0;
+  INT32U          high = ctx->conf.numConns;
+
+  while (low < high)
+  {
+    INT32U mid = (low + high) / 2;
+
+    if (ctx->connsByDriver[mid]->driver == driver)
+    {
+      conn = ctx->connsByDriver[mid];
+      break;
+    }
+    else if (ctx->connsByDriver[mid]->driver < driver)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  return conn;
+}
+
+/*******************************************************************/
+
+static void BenchEAFrameDone(t_benchEACtx *ctx, t_VBProcessMsg *processMsg, INT64U rxNs)
+{
+  t_benchEAConn      *conn = NULL;
+  t_benchEAInFlight   sent;
+  BOOLEAN             found = FALSE;
+
+  if (processMsg->msg != NULL)
+  {
+    conn = BenchEAConnByDriverGet(ctx, processMsg->senderDriver);
+  }
+
+  if (conn != NULL)
+  {
+    t_benchEAProducer *producer = conn->producer;
+    INT32U             pos = conn->ringHead;
+    INT32U             i;
+
+    pthread_mutex_lock(&(producer->mutex));
+
+    // Event scheduler keeps order per event class only, so the oldest frame of same type is matched
+    for (i = 0; (found == FALSE) && (i < conn->inFlight); i++)
+    {
+      t_benchEAInFlight *slot = &(conn->ring[pos]);
+
+      if ((slot->done == FALSE) && (benchEAFrames[slot->type].opcode == processMsg->msg->opcode))
+      {
+        sent = *slot;
+        slot->done = TRUE;
+        found = TRUE;
+      }
+
+      pos = (pos + 1) % ctx->conf.window;
+    }
+
+    while ((conn->inFlight > 0) && (conn->ring[conn->ringHead].done == TRUE))
+    {
+      conn->ringHead = (conn->ringHead + 1) % ctx->conf.window;
+      conn->inFlight--;
+    }
+
+    pthread_cond_signal(&(producer->cond));
+    pthread_mutex_unlock(&(producer->mutex));
+  }
+
+  if (found == FALSE)
+  {
+    // Unexpected event
+    __sync_fetch_and_add(&(ctx->errors), 1);
+  }
+  else if ((ctx->recording == TRUE) && (ctx->numSamples < ctx->maxSamples))
+  {
+    ctx->latNs[ctx->numSamples] = rxNs - sent.sendNs;
+    ctx->latType[ctx->numSamples] = (INT8U)sent.type;
+    ctx->numSamples++;
+    ctx->rxBytes += processMsg->msg->eaFullMsg.msgLen;
+  }
+}
+
+/*******************************************************************/
+
+static void *BenchEAProcessThread(void *arg)
+{
+  t_benchEACtx         *ctx = (t_benchEACtx *)arg;
+  t_VBProcessMsg        process_msg;
+  t_VB_engineErrorCode  err;
+
+  while (ctx->rxRunning == TRUE)
+  {
+    // Same role as engine process thread, without FSM
+    err = VbEngineEventSchedPop(&process_msg);
+
+    if (err == VB_ENGINE_ERROR_NONE)
+    {
+      BenchEAFrameDone(ctx, &process_msg, BenchEANowNs(CLOCK_MONOTONIC));
+
+      if (process_msg.msg != NULL)
+      {
+        VbEAMsgFree(&(process_msg.msg));
+      }
+
+      __sync_fetch_and_add(&(ctx->received), 1);
+    }
+    else if (err != VB_ENGINE_ERROR_NOT_STARTED)
+    {
+      __sync_fetch_and_add(&(ctx->errors), 1);
+    }
+  }
+
+  return NULL;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchEAFrameSend(t_benchEACtx *ctx, t_benchEAConn *conn, t_vbEAMsg *msg)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+
+  if (ctx->conf.transport == BENCH_EA_TRANSPORT_TCP)
+  {
+    INT32U offset = 0;
+
+    while ((ret == VB_ENGINE_ERROR_NONE) && (offset < msg->eaFullMsg.msgLen))
+    {
+      ssize_t n = send(conn->clientFd, msg->eaFullMsg.msg + offset, msg->eaFullMsg.msgLen - offset, MSG_NOSIGNAL);
+
+      if (n > 0)
+      {
+        offset += n;
+      }
+      else if ((n < 0) && (errno == EINTR))
+      {
+        // Retry
+      }
+      else
+      {
+        ret = VB_ENGINE_ERROR_SEND_FRAME;
+      }
+    }
+  }
+  else if (ctx->conf.transport == BENCH_EA_TRANSPORT_SHM)
+  {
+    t_vbEAError shm_err;
+
+    do
+    {
+      shm_err = VbEAShmFrameWrite(conn->shm, msg->eaFullMsg.msg, msg->eaFullMsg.msgLen, BENCH_EA_TX_TIMEOUT);
+    } while ((shm_err == VB_EA_ERR_QUEUE) && (ctx->abort == FALSE));
+
+    if (shm_err != VB_EA_ERR_NONE)
+    {
+      ret = VB_ENGINE_ERROR_SEND_FRAME;
+    }
+  }
+  else
+  {
+    // Same call done by EA connection thread once a frame is received
+    conn->driver->vbEAConnDesc.processRxMsgCb(&(conn->driver->vbEAConnDesc), msg->eaFullMsg.msg, msg->eaPayload.msgLen);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_benchEAFrameType BenchEAFrameTypePick(const t_benchEAConf *conf, INT32U *randState)
+{
+  t_benchEAFrameType type;
+  INT32U             r = BenchEARand(randState) % conf->totalWeight;
+
+  for (type = 0; type < (BENCH_EA_FRAME_LAST - 1); type++)
+  {
+    if (r < conf->weights[type])
+    {
+      break;
+    }
+
+    r -= conf->weights[type];
+  }
+
+  return type;
+}
+
+/*******************************************************************/
+
+static void *BenchEAProducerThread(void *arg)
+{
+  t_benchEAProducer *producer = (t_benchEAProducer *)arg;
+  t_benchEACtx      *ctx = producer->ctx;
+  INT64U             cpu_start = BenchEANowNs(CLOCK_THREAD_CPUTIME_ID);
+  INT32U             next = 0;
+
+  pthread_mutex_lock(&(producer->mutex));
+
+  while (ctx->abort == FALSE)
+  {
+    t_benchEAConn *conn = NULL;
+    BOOLEAN        pending = FALSE;
+    INT32U         idx;
+
+    // Round robin among own connections with room in their window
+    for (idx = 0; idx < producer->numConns; idx++)
+    {
+      t_benchEAConn *candidate = producer->conns[(next + idx) % producer->numConns];
+
+      if (candidate->sent < candidate->toSend)
+      {
+        pending = TRUE;
+
+        if (candidate->inFlight < ctx->conf.window)
+        {
+          conn = candidate;
+          next = (next + idx + 1) % producer->numConns;
+          break;
+        }
+      }
+    }
+
+    if (pending == FALSE)
+    {
+      break;
+    }
+
+    if (conn == NULL)
+    {
+      struct timespec abs_time;
+
+      clock_gettime(CLOCK_REALTIME, &abs_time);
+      VbUtilTimespecMsecAdd(&abs_time, BENCH_EA_TX_TIMEOUT, &abs_time);
+      pthread_cond_timedwait(&(producer->cond), &(producer->mutex), &abs_time);
+    }
+    else
+    {
+      t_benchEAFrameType type = BenchEAFrameTypePick(&(ctx->conf), &(producer->randState));
+
+      conn->ring[conn->ringTail].type = type;
+      conn->ring[conn->ringTail].sendNs = BenchEANowNs(CLOCK_MONOTONIC);
+      conn->ring[conn->ringTail].done = FALSE;
+      conn->ringTail = (conn->ringTail + 1) % ctx->conf.window;
+      conn->inFlight++;
+      conn->sent++;
+
+      pthread_mutex_unlock(&(producer->mutex));
+
+      if (BenchEAFrameSend(ctx, conn, conn->frames[type]) != VB_ENGINE_ERROR_NONE)
+      {
+        __sync_fetch_and_add(&(ctx->errors), 1);
+        ctx->abort = TRUE;
+      }
+
+      pthread_mutex_lock(&(producer->mutex));
+    }
+  }
+
+  pthread_mutex_unlock(&(producer->mutex));
+
+  producer->cpuNs += BenchEANowNs(CLOCK_THREAD_CPUTIME_ID) - cpu_start;
+
+  return NULL;
+}
+
+/*******************************************************************/
+
+static INT64U BenchEARxThreadsCpuNs(t_benchEACtx *ctx)
+{
+  INT64U cpu_ns;
+  INT32U idx;
+
+  cpu_ns = BenchEAThreadCpuNs(ctx->rxThreadId);
+
+  if (ctx->conf.transport != BENCH_EA_TRANSPORT_DIRECT)
+  {
+    for (idx = 0; idx < ctx->conf.numConns; idx++)
+    {
+      cpu_ns += BenchEAThreadCpuNs(ctx->conns[idx].driver->vbEAConnDesc.threadId);
+    }
+  }
+  else
+  {
+    // Senders run the reception path themselves
+    for (idx = 0; idx < ctx->conf.numProducers; idx++)
+    {
+      cpu_ns += ctx->producers[idx].cpuNs;
+    }
+  }
+
+  return cpu_ns;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchEAPhaseRun(t_benchEACtx *ctx, INT32U framesPerConn, BOOLEAN record, t_benchEAResult *result)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT64U               expected;
+  INT64U               last_received;
+  INT64U               start_ns = 0;
+  INT64U               cpu_start = 0;
+  INT64U               rx_cpu_start = 0;
+  INT64U               stall_ms = 0;
+  INT32U               idx;
+
+  for (idx = 0; idx < ctx->conf.numConns; idx++)
+  {
+    ctx->conns[idx].sent = 0;
+    ctx->conns[idx].toSend = framesPerConn;
+  }
+
+  last_received = __sync_fetch_and_add(&(ctx->received), 0);
+  expected = last_received + ((INT64U)framesPerConn * ctx->conf.numConns);
+
+  if (record == TRUE)
+  {
+    ctx->numSamples = 0;
+    ctx->rxBytes = 0;
+    ctx->recording = TRUE;
+    VbEngineBenchAllocCountersReset();
+    rx_cpu_start = BenchEARxThreadsCpuNs(ctx);
+    cpu_start = BenchEAProcessCpuNs();
+    start_ns = BenchEANowNs(CLOCK_MONOTONIC);
+  }
+
+  for (idx = 0; (ret == VB_ENGINE_ERROR_NONE) && (idx < ctx->conf.numProducers); idx++)
+  {
+    if (VbThreadCreate(BENCH_EA_TX_THREAD_NAME, BenchEAProducerThread, &(ctx->producers[idx]), VB_EA_THREAD_CLASS, &(ctx->producers[idx].threadId)) == FALSE)
+    {
+      ctx->abort = TRUE;
+      ret = VB_ENGINE_ERROR_EA_THREAD_CREATE;
+    }
+  }
+
+  for (idx = 0; idx < ctx->conf.numProducers; idx++)
+  {
+    if (ctx->producers[idx].threadId != 0)
+    {
+      VbThreadJoin(ctx->producers[idx].threadId, BENCH_EA_TX_THREAD_NAME);
+      ctx->producers[idx].threadId = 0;
+    }
+  }
+
+  // Wait until every frame is dequeued from process queue
+  while ((ret == VB_ENGINE_ERROR_NONE) && (ctx->abort == FALSE))
+  {
+    INT64U received = __sync_fetch_and_add(&(ctx->received), 0);
+
+    if (received >= expected)
+    {
+      break;
+    }
+
+    if (received == last_received)
+    {
+      stall_ms += BENCH_EA_POLL_PERIOD;
+
+      if (stall_ms >= BENCH_EA_STALL_TIMEOUT)
+      {
+        printf("Timeout waiting for %llu frames\n", (unsigned long long)(expected - received));
+        ret = VB_ENGINE_ERROR_NOT_READY;
+      }
+    }
+    else
+    {
+      stall_ms = 0;
+      last_received = received;
+    }
+
+    VbThreadSleep(BENCH_EA_POLL_PERIOD);
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (ctx->abort == TRUE))
+  {
+    ret = VB_ENGINE_ERROR_SEND_FRAME;
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (record == TRUE))
+  {
+    result->elapsedNs = BenchEANowNs(CLOCK_MONOTONIC) - start_ns;
+    result->cpuNs = BenchEAProcessCpuNs() - cpu_start;
+    result->rxCpuNs = BenchEARxThreadsCpuNs(ctx) - rx_cpu_start;
+    VbEngineBenchAllocCountersGet(&(result->allocs), &(result->frees));
+    ctx->recording = FALSE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchEAResultBuild(t_benchEACtx *ctx, t_benchEAResult *result)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT64U              *samples;
+  t_benchEAFrameType   type;
+  INT64U               idx;
+
+  result->frames = ctx->numSamples;
+  result->bytes = ctx->rxBytes;
+
+  samples = malloc(MAX(ctx->numSamples, 1) * sizeof(INT64U));
+  if (samples == NULL)
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+
+  for (type = 0; (ret == VB_ENGINE_ERROR_NONE) && (type < BENCH_EA_FRAME_LAST); type++)
+  {
+    INT32U num = 0;
+
+    for (idx = 0; idx < ctx->numSamples; idx++)
+    {
+      if (ctx->latType[idx] == type)
+      {
+        samples[num++] = ctx->latNs[idx];
+      }
+    }
+
+    result->count[type] = num;
+
+    if (num > 0)
+    {
+      qsort(samples, num, sizeof(INT64U), VbEngineBenchSampleCmp);
+      result->p50Ns[type] = VbEngineBenchPercentileGet(samples, num, 500);
+      result->p90Ns[type] = VbEngineBenchPercentileGet(samples, num, 900);
+      result->p99Ns[type] = VbEngineBenchPercentileGet(samples, num, 990);
+      result->p999Ns[type] = VbEngineBenchPercentileGet(samples, num, 999);
+      result->maxNs[type] = samples[num - 1];
+    }
+  }
+
+  if (samples != NULL)
+  {
+    free(samples);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void BenchEAResultPrint(t_benchEACtx *ctx, const t_benchEAResult *result)
+{
+  const t_benchEAConf *conf = &(ctx->conf);
+  double               secs = (double)result->elapsedNs / NSEC_IN_SEC;
+  double               frames = (result->frames > 0)?(double)result->frames:1.0;
+  t_benchEAFrameType   type;
+
+  printf("Transport %s%s, connections %u, senders %u, frames/conn %u (warmup %u), window %u, queue %u, carriers %u%s, domains %u, mix %s\n",
+      benchEATransportStr[conf->transport], conf->ioUring?" (io_uring rx)":"", conf->numConns, conf->numProducers, conf->frames, conf->warmup,
+      conf->window, conf->queueDepth, conf->numCarriers, conf->mimo?" MIMO":"", conf->numDomains, conf->mix);
+  printf("Frames %llu in %.3f s: %.0f frames/s, %.2f MB/s\n",
+      (unsigned long long)result->frames, secs, result->frames / secs, (result->bytes / 1e6) / secs);
+  printf("CPU per frame: %.2f us (process), %.2f us (rx threads); allocs per frame %.2f, frees per frame %.2f; errors %llu\n",
+      (result->cpuNs / 1000.0) / frames, (result->rxCpuNs / 1000.0) / frames,
+      result->allocs / frames, result->frees / frames, (unsigned long long)ctx->errors);
+  printf("==========================================================================================\n");
+  printf("|  Frame   |   Count    |  p50 (us)  |  p90 (us)  |  p99 (us)  | p99.9 (us) |  max (us)  |\n");
+  printf("==========================================================================================\n");
+
+  for (type = 0; type < BENCH_EA_FRAME_LAST; type++)
+  {
+    if (result->count[type] > 0)
+    {
+      printf("| %-8s | %10llu | %10.1f | %10.1f | %10.1f | %10.1f | %10.1f |\n",
+          benchEAFrames[type].name,
+          (unsigned long long)result->count[type],
+          result->p50Ns[type] / 1000.0,
+          result->p90Ns[type] / 1000.0,
+          result->p99Ns[type] / 1000.0,
+          result->p999Ns[type] / 1000.0,
+          result->maxNs[type] / 1000.0);
+    }
+  }
+
+  printf("==========================================================================================\n");
+}
+
+/*******************************************************************/
+
+static INT32S BenchEAResultSave(t_benchEACtx *ctx, const t_benchEAResult *result)
+{
+  INT32S               ret = 0;
+  const t_benchEAConf *conf = &(ctx->conf);
+  double               secs = (double)result->elapsedNs / NSEC_IN_SEC;
+  double               frames = (result->frames > 0)?(double)result->frames:1.0;
+  t_benchEAFrameType   type;
+  BOOLEAN              first = TRUE;
+  FILE                *fp;
+
+  fp = fopen(conf->outFile, "w");
+  if (fp == NULL)
+  {
+    ret = -1;
+  }
+
+  if (ret == 0)
+  {
+    fprintf(fp, "{\n");
+    VbEngineBenchJsonHeaderWrite(fp);
+    fprintf(fp, "  \"config\": {\"transport\": \"%s\", \"io_uring\": %s, \"connections\": %u, \"senders\": %u, \"frames_per_conn\": %u, "
+                "\"warmup\": %u, \"window\": %u, \"queue_depth\": %u, \"carriers\": %u, \"mimo\": %s, \"domains\": %u, "
+                "\"mix\": \"%s\", \"seed\": %u},\n",
+        benchEATransportStr[conf->transport], conf->ioUring?"true":"false", conf->numConns, conf->numProducers, conf->frames,
+        conf->warmup, conf->window, conf->queueDepth, conf->numCarriers, conf->mimo?"true":"false", conf->numDomains,
+        conf->mix, conf->seed);
+    fprintf(fp, "  \"summary\": {\"frames\": %llu, \"bytes\": %llu, \"elapsed_ns\": %llu, \"frames_per_s\": %.1f, "
+                "\"mb_per_s\": %.3f, \"cpu_us_per_frame\": %.3f, \"rx_cpu_us_per_frame\": %.3f, "
+                "\"allocs_per_frame\": %.3f, \"frees_per_frame\": %.3f, \"errors\": %llu},\n",
+        (unsigned long long)result->frames, (unsigned long long)result->bytes, (unsigned long long)result->elapsedNs,
+        result->frames / secs, (result->bytes / 1e6) / secs,
+        (result->cpuNs / 1000.0) / frames, (result->rxCpuNs / 1000.0) / frames,
+        result->allocs / frames, result->frees / frames, (unsigned long long)ctx->errors);
+    fprintf(fp, "  \"latency\": [\n");
+
+    for (type = 0; type < BENCH_EA_FRAME_LAST; type++)
+    {
+      if (result->count[type] > 0)
+      {
+        fprintf(fp, "%s    {\"frame\": \"%s\", \"opcode\": %u, \"count\": %llu, \"p50_ns\": %llu, \"p90_ns\": %llu, "
+                    "\"p99_ns\": %llu, \"p999_ns\": %llu, \"max_ns\": %llu}",
+            (first == TRUE)?"":",\n", benchEAFrames[type].name, benchEAFrames[type].opcode,
+            (unsigned long long)result->count[type], (unsigned long long)result->p50Ns[type],
+            (unsigned long long)result->p90Ns[type], (unsigned long long)result->p99Ns[type],
+            (unsigned long long)result->p999Ns[type], (unsigned long long)result->maxNs[type]);
+        first = FALSE;
+      }
+    }
+
+    fprintf(fp, "\n  ]\n");
+    fprintf(fp, "}\n");
+
+    fclose(fp);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchEARawFrameSend(INT32S fd, t_vbEAOpcode opcode, const void *payload, INT32U payloadLen)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_vbEAMsg           *msg = NULL;
+
+  if (VbEAMsgAlloc(&msg, payloadLen, opcode) != VB_EA_ERR_NONE)
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+  else
+  {
+    if (payloadLen > 0)
+    {
+      memcpy(msg->eaPayload.msg, payload, payloadLen);
+    }
+
+    if (send(fd, msg->eaFullMsg.msg, msg->eaFullMsg.msgLen, MSG_NOSIGNAL) != (ssize_t)msg->eaFullMsg.msgLen)
+    {
+      ret = VB_ENGINE_ERROR_SEND_FRAME;
+    }
+
+    VbEAMsgFree(&msg);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchEAShmNegotiate(t_benchEAConn *conn)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_vbEAShmReq         req;
+  INT8U                rsp[VB_EA_HEADER_SIZE + VB_EA_SHM_RSP_SIZE];
+  INT32U               offset = 0;
+
+  if (VbEAShmCreate(&(conn->shm), VB_EA_SHM_RING_DEFAULT_SIZE) != VB_EA_ERR_NONE)
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    bzero(&req, sizeof(req));
+    // Both names have the same size, segment name is always NUL terminated
+    memcpy(req.name, conn->shm->name, sizeof(req.name));
+    req.nonce = _htonl(conn->shm->nonce);
+    req.ringSize = _htonl(conn->shm->ringSize);
+
+    ret = BenchEARawFrameSend(conn->clientFd, VB_EA_OPCODE_SHM_REQ, &req, VB_EA_SHM_REQ_SIZE);
+  }
+
+  while ((ret == VB_ENGINE_ERROR_NONE) && (offset < sizeof(rsp)))
+  {
+    ssize_t n = recv(conn->clientFd, rsp + offset, sizeof(rsp) - offset, 0);
+
+    if (n > 0)
+    {
+      offset += n;
+    }
+    else if ((n < 0) && (errno == EINTR))
+    {
+      // Retry
+    }
+    else
+    {
+      ret = VB_ENGINE_ERROR_NOT_READY;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    VbEAShmUnlink(conn->shm);
+
+    if ((rsp[VB_EA_HEADER_SIZE - 1] != VB_EA_OPCODE_SHM_RSP) || (rsp[VB_EA_HEADER_SIZE] != VB_EA_SHM_RSP_OK))
+    {
+      ret = VB_ENGINE_ERROR_NOT_READY;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Last frame through the socket
+    ret = BenchEARawFrameSend(conn->clientFd, VB_EA_OPCODE_SHM_SWITCH_TRG, NULL, 0);
+    conn->shm->txActive = TRUE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchEAConnOpen(t_benchEACtx *ctx, t_benchEAConn *conn)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_vbEADesc          *desc = &(conn->driver->vbEAConnDesc);
+  INT32S               server_fd = BENCH_EA_INVALID_FD;
+  INT32U               wait_ms = 0;
+  int                  no_delay = 1;
+
+  VbEADescInit(desc);
+  snprintf(desc->thrName, sizeof(desc->thrName), BENCH_EA_CONN_THREAD_NAME, conn->idx);
+  desc->type           = VB_EA_TYPE_SERVER_CONN;
+  desc->queueName      = ctx->queueName;
+  desc->processRxMsgCb = VbEngineBenchEAFrameRxCbGet();
+  desc->args           = conn->driver;
+
+  if (ctx->conf.transport == BENCH_EA_TRANSPORT_DIRECT)
+  {
+    // Connection descriptor as left by EA connection thread once started
+    desc->queueId = mq_open(ctx->queueName, O_WRONLY);
+    desc->connected = TRUE;
+    desc->running = TRUE;
+
+    if (desc->queueId == (mqd_t)-1)
+    {
+      ret = VB_ENGINE_ERROR_QUEUE;
+    }
+  }
+  else
+  {
+    struct sockaddr_in addr;
+    socklen_t          addr_len = sizeof(addr);
+
+    conn->clientFd = socket(AF_INET, SOCK_STREAM, 0);
+
+    if ((conn->clientFd < 0) ||
+        (getsockname(ctx->listenFd, (struct sockaddr *)&addr, &addr_len) != 0) ||
+        (connect(conn->clientFd, (struct sockaddr *)&addr, addr_len) != 0))
+    {
+      ret = VB_ENGINE_ERROR_SEND_FRAME;
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      server_fd = accept(ctx->listenFd, NULL, NULL);
+
+      if (server_fd < 0)
+      {
+        ret = VB_ENGINE_ERROR_SEND_FRAME;
+      }
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      // Same socket options as EA connections
+      setsockopt(conn->clientFd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+      setsockopt(server_fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+      desc->sockFd = server_fd;
+      desc->shmRingSize = (ctx->conf.transport == BENCH_EA_TRANSPORT_SHM)?VB_EA_SHM_RING_DEFAULT_SIZE:0;
+      desc->ioUring = ctx->conf.ioUring;
+
+      if (VbEAThreadStart(desc) != VB_EA_ERR_NONE)
+      {
+        close(server_fd);
+        ret = VB_ENGINE_ERROR_EA_THREAD_CREATE;
+      }
+    }
+
+    while ((ret == VB_ENGINE_ERROR_NONE) && (desc->connected == FALSE))
+    {
+      if (wait_ms >= BENCH_EA_CONNECT_TIMEOUT)
+      {
+        ret = VB_ENGINE_ERROR_NOT_READY;
+      }
+      else
+      {
+        VbThreadSleep(BENCH_EA_POLL_PERIOD);
+        wait_ms += BENCH_EA_POLL_PERIOD;
+      }
+    }
+
+    if ((ret == VB_ENGINE_ERROR_NONE) && (ctx->conf.transport == BENCH_EA_TRANSPORT_SHM))
+    {
+      // Driver side of the negotiation done by VbEAConnProcess on EA clients
+      ret = BenchEAShmNegotiate(conn);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void BenchEAConnClose(t_benchEACtx *ctx, t_benchEAConn *conn)
+{
+  t_vbEADesc *desc = &(conn->driver->vbEAConnDesc);
+
+  if (ctx->conf.transport == BENCH_EA_TRANSPORT_DIRECT)
+  {
+    if ((desc->queueId != (mqd_t)-1) && (desc->queueId != 0))
+    {
+      mq_close(desc->queueId);
+    }
+
+    desc->running = FALSE;
+    desc->connected = FALSE;
+  }
+  else
+  {
+    VbEAThreadStop(desc);
+  }
+
+  VbEAShmDestroy(&(conn->shm));
+
+  if (conn->clientFd >= 0)
+  {
+    close(conn->clientFd);
+    conn->clientFd = BENCH_EA_INVALID_FD;
+  }
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BenchEASetup(t_benchEACtx *ctx)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_benchEAConf       *conf = &(ctx->conf);
+  struct mq_attr       attr;
+  INT32U               rand_state = conf->seed;
+  INT32U               idx;
+
+  ctx->queueId = (mqd_t)-1;
+  ctx->listenFd = BENCH_EA_INVALID_FD;
+  ctx->maxSamples = (INT64U)conf->frames * conf->numConns;
+
+  ctx->conns = calloc(conf->numConns, sizeof(t_benchEAConn));
+  ctx->connsByDriver = calloc(conf->numConns, sizeof(t_benchEAConn *));
+  ctx->producers = calloc(conf->numProducers, sizeof(t_benchEAProducer));
+  ctx->latNs = malloc(ctx->maxSamples * sizeof(INT64U));
+  ctx->latType = malloc(ctx->maxSamples * sizeof(INT8U));
+
+  if ((ctx->conns == NULL) || (ctx->connsByDriver == NULL) || (ctx->producers == NULL) ||
+      (ctx->latNs == NULL) || (ctx->latType == NULL))
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Process queue with same message size as engine one
+    snprintf(ctx->queueName, sizeof(ctx->queueName), "%s%d", BENCH_EA_QUEUE_NAME, (int)getpid());
+    mq_unlink(ctx->queueName);
+
+    bzero(&attr, sizeof(attr));
+    attr.mq_maxmsg = conf->queueDepth;
+    attr.mq_msgsize = sizeof(t_VBProcessMsg);
+
+    ctx->queueId = mq_open(ctx->queueName, O_CREAT | O_RDWR, 0666, &attr);
+
+    if (ctx->queueId == (mqd_t)-1)
+    {
+      printf("Error creating queue %s (depth %u) [%s]; check /proc/sys/fs/mqueue/msg_max or use -q\n",
+          ctx->queueName, conf->queueDepth, strerror(errno));
+      ret = VB_ENGINE_ERROR_QUEUE;
+    }
+    else
+    {
+      ctx->queueCreated = TRUE;
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (conf->transport != BENCH_EA_TRANSPORT_DIRECT))
+  {
+    struct sockaddr_in addr;
+
+    bzero(&addr, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    ctx->listenFd = socket(AF_INET, SOCK_STREAM, 0);
+
+    if ((ctx->listenFd < 0) ||
+        (bind(ctx->listenFd, (struct sockaddr *)&addr, sizeof(addr)) != 0) ||
+        (listen(ctx->listenFd, conf->numConns) != 0))
+    {
+      printf("Error opening loopback socket [%s]\n", strerror(errno));
+      ret = VB_ENGINE_ERROR_SEND_FRAME;
+    }
+  }
+
+  for (idx = 0; (ret == VB_ENGINE_ERROR_NONE) && (idx < conf->numProducers); idx++)
+  {
+    t_benchEAProducer *producer = &(ctx->producers[idx]);
+
+    producer->idx = idx;
+    producer->ctx = ctx;
+    producer->randState = conf->seed + idx + 1;
+    pthread_mutex_init(&(producer->mutex), NULL);
+    pthread_cond_init(&(producer->cond), NULL);
+
+    producer->conns = calloc((conf->numConns / conf->numProducers) + 1, sizeof(t_benchEAConn *));
+    if (producer->conns == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    t_vbEngineEventSchedConf sched_conf;
+
+    // Events are queued per class as in the engine; every class may hold a whole process queue
+    bzero(&sched_conf, sizeof(sched_conf));
+    for (idx = 0; idx < VB_ENGINE_EVENT_CLASS_LAST; idx++)
+    {
+      sched_conf.classes[idx].weight = 1;
+      sched_conf.classes[idx].maxDepth = conf->queueDepth;
+    }
+
+    ret = VbEngineEventSchedStart(&sched_conf);
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      ctx->schedStarted = TRUE;
+    }
+  }
+
+  // Engine reception path only posts frames while process thread is running
+  VbEngineProcessThreadRunningSet(TRUE);
+
+  for (idx = 0; (ret == VB_ENGINE_ERROR_NONE) && (idx < conf->numConns); idx++)
+  {
+    t_benchEAConn *conn = &(ctx->conns[idx]);
+    CHAR           driver_id[VB_EA_DRIVER_ID_MAX_SIZE];
+    INT32U         type;
+
+    conn->idx = idx;
+    conn->clientFd = BENCH_EA_INVALID_FD;
+    conn->producer = &(ctx->producers[idx % conf->numProducers]);
+    conn->producer->conns[conn->producer->numConns++] = conn;
+    ctx->connsByDriver[idx] = conn;
+
+    conn->ring = calloc(conf->window, sizeof(t_benchEAInFlight));
+    if (conn->ring == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      snprintf(driver_id, sizeof(driver_id), BENCH_EA_DRIVER_ID, idx);
+      ret = VbEngineDatamodelCreateDriver(driver_id, &(conn->driver));
+    }
+
+    for (type = 0; (ret == VB_ENGINE_ERROR_NONE) && (type < BENCH_EA_FRAME_LAST); type++)
+    {
+      ret = BenchEAFrameBuild(ctx, conn, type, &rand_state);
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      ret = BenchEAConnOpen(ctx, conn);
+
+      if (ret != VB_ENGINE_ERROR_NONE)
+      {
+        printf("Error %d opening connection %u\n", ret, idx);
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    qsort(ctx->connsByDriver, conf->numConns, sizeof(t_benchEAConn *), BenchEAConnDriverCmp);
+
+    ctx->rxRunning = TRUE;
+
+    if (VbThreadCreate(BENCH_EA_RX_THREAD_NAME, BenchEAProcessThread, ctx, VB_ENGINE_PROCESS_THREAD_CLASS, &(ctx->rxThreadId)) == FALSE)
+    {
+      ctx->rxRunning = FALSE;
+      ret = VB_ENGINE_ERROR_EA_THREAD_CREATE;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void BenchEATeardown(t_benchEACtx *ctx)
+{
+  INT32U idx;
+  INT32U type;
+
+  if (ctx->conns != NULL)
+  {
+    // Stop senders side first, then consumer drains what is left in the queue
+    for (idx = 0; idx < ctx->conf.numConns; idx++)
+    {
+      t_benchEAConn *conn = &(ctx->conns[idx]);
+
+      if (conn->driver != NULL)
+      {
+        BenchEAConnClose(ctx, conn);
+      }
+    }
+  }
+
+  if (ctx->schedStarted == TRUE)
+  {
+    // Wakes up consumer and blocked producers
+    VbEngineEventSchedStop();
+  }
+
+  if (ctx->rxRunning == TRUE)
+  {
+    ctx->rxRunning = FALSE;
+    VbThreadJoin(ctx->rxThreadId, BENCH_EA_RX_THREAD_NAME);
+  }
+
+  VbEngineProcessThreadRunningSet(FALSE);
+
+  if (ctx->schedStarted == TRUE)
+  {
+    // Release frames still queued (only after errors)
+    VbEngineEventSchedFlush();
+    ctx->schedStarted = FALSE;
+  }
+
+  if (ctx->queueCreated == TRUE)
+  {
+    mq_close(ctx->queueId);
+    mq_unlink(ctx->queueName);
+  }
+
+  if (ctx->listenFd >= 0)
+  {
+    close(ctx->listenFd);
+  }
+
+  if (ctx->conns != NULL)
+  {
+    for (idx = 0; idx < ctx->conf.numConns; idx++)
+    {
+      t_benchEAConn *conn = &(ctx->conns[idx]);
+
+      for (type = 0; type < BENCH_EA_FRAME_LAST; type++)
+      {
+        if (conn->frames[type] != NULL)
+        {
+          VbEAMsgFree(&(conn->frames[type]));
+        }
+      }
+
+      if (conn->driver != NULL)
+      {
+        VbEngineDatamodelDriverDel(&(conn->driver));
+      }
+
+      if (conn->ring != NULL)
+      {
+        free(conn->ring);
+      }
+    }
+
+    free(ctx->conns);
+  }
+
+  if (ctx->producers != NULL)
+  {
+    for (idx = 0; idx < ctx->conf.numProducers; idx++)
+    {
+      if (ctx->producers[idx].conns != NULL)
+      {
+        free(ctx->producers[idx].conns);
+        pthread_mutex_destroy(&(ctx->producers[idx].mutex));
+        pthread_cond_destroy(&(ctx->producers[idx].cond));
+      }
+    }
+
+    free(ctx->producers);
+  }
+
+  if (ctx->connsByDriver != NULL)
+  {
+    free(ctx->connsByDriver);
+  }
+
+  if (ctx->latNs != NULL)
+  {
+    free(ctx->latNs);
+  }
+
+  if (ctx->latType != NULL)
+  {
+    free(ctx->latType);
+  }
+}
+
+/*******************************************************************/
+
+static INT32U BenchEAMqMsgMaxGet(void)
+{
+  FILE          *fp;
+  unsigned long  msg_max = BENCH_EA_MQ_MSG_MAX_DEFAULT;
+
+  fp = fopen(BENCH_EA_MQ_MSG_MAX_FILE, "r");
+
+  if (fp != NULL)
+  {
+    if ((fscanf(fp, "%lu", &msg_max) != 1) || (msg_max == 0))
+    {
+      msg_max = BENCH_EA_MQ_MSG_MAX_DEFAULT;
+    }
+
+    fclose(fp);
+  }
+
+  return (INT32U)msg_max;
+}
+
+/*******************************************************************/
+
+static BOOLEAN BenchEAMixParse(t_benchEAConf *conf)
+{
+  BOOLEAN ret = TRUE;
+  CHAR    mix[BENCH_EA_MIX_LEN];
+  CHAR   *save_ptr = NULL;
+  CHAR   *token;
+
+  bzero(conf->weights, sizeof(conf->weights));
+  conf->totalWeight = 0;
+
+  strncpy(mix, conf->mix, sizeof(mix));
+  mix[sizeof(mix) - 1] = '\0';
+
+  for (token = strtok_r(mix, ",", &save_ptr); (ret == TRUE) && (token != NULL); token = strtok_r(NULL, ",", &save_ptr))
+  {
+    CHAR               *value = strchr(token, '=');
+    t_benchEAFrameType  type;
+
+    ret = FALSE;
+
+    if (value != NULL)
+    {
+      *value = '\0';
+      value++;
+
+      for (type = 0; type < BENCH_EA_FRAME_LAST; type++)
+      {
+        if (strcmp(token, benchEAFrames[type].name) == 0)
+        {
+          conf->weights[type] = strtoul(value, NULL, 0);
+          ret = TRUE;
+          break;
+        }
+      }
+    }
+  }
+
+  if (ret == TRUE)
+  {
+    t_benchEAFrameType type;
+
+    for (type = 0; type < BENCH_EA_FRAME_LAST; type++)
+    {
+      conf->totalWeight += conf->weights[type];
+    }
+
+    ret = (conf->totalWeight > 0)?TRUE:FALSE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void BenchEAUsage(void)
+{
+  printf("Command line:\n\tvector_boost_bench ea [-T TRANSPORT] [-k CONNS] [-p SENDERS] [-n FRAMES] [-w WARMUP] [-W WINDOW] [-q DEPTH] "
+         "[-M MIX] [-c CARRIERS] [-m] [-D DOMAINS] [-u] [-s SEED] [-o FILE] [-h]\n");
+  printf("Where:\n");
+  printf("\t-T\tTransport: \"tcp\" (loopback sockets and EA connection threads), \"direct\" (senders call engine rx callback) "
+         "or \"shm\" (shared memory rings and EA connection threads)\n");
+  printf("\t-k\tNumber of driver connections (max %u)\n", BENCH_EA_MAX_CONNS);
+  printf("\t-p\tNumber of sender threads, connections are shared among them (max %u)\n", BENCH_EA_MAX_PRODUCERS);
+  printf("\t-n\tTimed frames per connection\n");
+  printf("\t-w\tWarmup frames per connection\n");
+  printf("\t-W\tMax frames in flight per connection (max %u)\n", BENCH_EA_MAX_WINDOW);
+  printf("\t-q\tProcess queue depth (messages, default and max %s)\n", BENCH_EA_MQ_MSG_MAX_FILE);
+  printf("\t-M\tFrames mix as name=weight list (default %s)\n", BENCH_EA_DEFAULT_MIX);
+  printf("\t-c\tNumber of carriers of CFR and BGN frames\n");
+  printf("\t-m\tMIMO CFR and BGN frames\n");
+  printf("\t-D\tDomains per domains frame and reports per traffic awareness frame\n");
+  printf("\t-u\tEA connection threads read sockets through io_uring (tcp transport)\n");
+  printf("\t-s\tSeed of synthetic data and mix\n");
+  printf("\t-o\tSave results to FILE (JSON)\n");
+  printf("\t-h\tShow this help\n");
+}
+
+/*******************************************************************/
+
+static BOOLEAN BenchEAArgsParse(int argc, char **argv, t_benchEAConf *conf)
+{
+  BOOLEAN ret = TRUE;
+  int     opt;
+
+  bzero(conf, sizeof(*conf));
+  strncpy(conf->mix, BENCH_EA_DEFAULT_MIX, sizeof(conf->mix) - 1);
+  conf->transport = BENCH_EA_TRANSPORT_TCP;
+  conf->numConns = 4;
+  conf->numProducers = 4;
+  conf->frames = 20000;
+  conf->warmup = 1000;
+  conf->window = 64;
+  conf->queueDepth = 0;             // System limit
+  conf->numCarriers = 1024;
+  conf->numDomains = 16;
+  conf->seed = 1;
+
+  optind = 1;
+
+  while ((ret == TRUE) && ((opt = getopt(argc, argv, "T:k:p:n:w:W:q:M:c:mD:us:o:h")) != -1))
+  {
+    switch (opt)
+    {
+      case ('T'):
+      {
+        if (strcmp(optarg, benchEATransportStr[BENCH_EA_TRANSPORT_TCP]) == 0)
+        {
+          conf->transport = BENCH_EA_TRANSPORT_TCP;
+        }
+        else if (strcmp(optarg, benchEATransportStr[BENCH_EA_TRANSPORT_DIRECT]) == 0)
+        {
+          conf->transport = BENCH_EA_TRANSPORT_DIRECT;
+        }
+        else if (strcmp(optarg, benchEATransportStr[BENCH_EA_TRANSPORT_SHM]) == 0)
+        {
+          conf->transport = BENCH_EA_TRANSPORT_SHM;
+        }
+        else
+        {
+          ret = FALSE;
+        }
+        break;
+      }
+      case ('k'):
+      {
+        conf->numConns = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('p'):
+      {
+        conf->numProducers = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('n'):
+      {
+        conf->frames = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('w'):
+      {
+        conf->warmup = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('W'):
+      {
+        conf->window = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('q'):
+      {
+        conf->queueDepth = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('M'):
+      {
+        strncpy(conf->mix, optarg, sizeof(conf->mix) - 1);
+        break;
+      }
+      case ('c'):
+      {
+        conf->numCarriers = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('m'):
+      {
+        conf->mimo = TRUE;
+        break;
+      }
+      case ('D'):
+      {
+        conf->numDomains = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('u'):
+      {
+        conf->ioUring = TRUE;
+        break;
+      }
+      case ('s'):
+      {
+        conf->seed = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('o'):
+      {
+        strncpy(conf->outFile, optarg, sizeof(conf->outFile) - 1);
+        break;
+      }
+      default:
+      {
+        ret = FALSE;
+        break;
+      }
+    }
+  }
+
+  if (ret == TRUE)
+  {
+    conf->numProducers = MIN(conf->numProducers, conf->numConns);
+
+    if (conf->queueDepth == 0)
+    {
+      conf->queueDepth = BenchEAMqMsgMaxGet();
+    }
+    else if (conf->queueDepth > BenchEAMqMsgMaxGet())
+    {
+      printf("Queue depth %u exceeds %s, using %u\n", conf->queueDepth, BENCH_EA_MQ_MSG_MAX_FILE, BenchEAMqMsgMaxGet());
+      conf->queueDepth = BenchEAMqMsgMaxGet();
+    }
+
+    if ((BenchEAMixParse(conf) == FALSE) ||
+        (conf->numConns == 0) || (conf->numConns > BENCH_EA_MAX_CONNS) ||
+        (conf->numProducers == 0) || (conf->numProducers > BENCH_EA_MAX_PRODUCERS) ||
+        (conf->frames == 0) || (((INT64U)conf->frames * conf->numConns) > BENCH_EA_MAX_SAMPLES) ||
+        (conf->window == 0) || (conf->window > BENCH_EA_MAX_WINDOW) ||
+        (conf->numCarriers == 0) || (conf->seed == 0) ||
+        (BenchEAPayloadLenGet(conf, BENCH_EA_FRAME_CFR) > BENCH_EA_MAX_PAYLOAD) ||
+        (BenchEAPayloadLenGet(conf, BENCH_EA_FRAME_DOMAINS) > BENCH_EA_MAX_PAYLOAD) ||
+        (BenchEAPayloadLenGet(conf, BENCH_EA_FRAME_TRAFFIC) > BENCH_EA_MAX_PAYLOAD))
+    {
+      printf("Invalid parameters\n");
+      ret = FALSE;
+    }
+  }
+
+  return ret;
+}
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+int VbEngineBenchEARun(int argc, char **argv)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_benchEACtx         ctx;
+  t_benchEAResult      result;
+
+  bzero(&ctx, sizeof(ctx));
+  bzero(&result, sizeof(result));
+
+  if (BenchEAArgsParse(argc, argv, &(ctx.conf)) == FALSE)
+  {
+    BenchEAUsage();
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    VbLogVerboseLevelSet(VB_LOG_ERROR);
+    VbThreadInit();
+
+    ret = BenchEASetup(&ctx);
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (ctx.conf.warmup > 0))
+  {
+    ret = BenchEAPhaseRun(&ctx, ctx.conf.warmup, FALSE, &result);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = BenchEAPhaseRun(&ctx, ctx.conf.frames, TRUE, &result);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = BenchEAResultBuild(&ctx, &result);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    BenchEAResultPrint(&ctx, &result);
+
+    if ((ctx.conf.outFile[0] != '\0') && (BenchEAResultSave(&ctx, &result) != 0))
+    {
+      printf("Error saving results to %s\n", ctx.conf.outFile);
+      ret = VB_ENGINE_ERROR_PARAMS;
+    }
+  }
+
+  if ((ret != VB_ENGINE_ERROR_NONE) && (ret != VB_ENGINE_ERROR_BAD_ARGUMENTS))
+  {
+    printf("EA benchmark error %d\n", ret);
+  }
+
+  BenchEATeardown(&ctx);
+
+  return (ret == VB_ENGINE_ERROR_NONE)?0:1;
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/
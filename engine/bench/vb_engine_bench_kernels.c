@@ -0,0 +1,183 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_bench_kernels.c
+ * @brief Access to SNR and channel capacity kernels for the microbenchmark tool
+ *
+ * @internal
+ *
+ * SNR and channel capacity kernels are private to their module. This file
+ * builds that module inside the benchmark binary (its object file is left out
+ * of the benchmark link) and exports thin wrappers around the kernels.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_SNR_calculation.c"
+#include "vb_engine_bench.h"
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineBenchSnrNodeRun(t_VBDriver *driver, t_node *node, INT8U *snrRx1, INT8U *snrRx2)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_processMeasure    *bgn;
+
+  if ((driver == NULL) || (node == NULL) || (snrRx1 == NULL) || (snrRx2 == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    bgn = &(node->measures.BGNMeasure);
+
+    if (bgn->mimoInd == FALSE)
+    {
+      ret = VbSnrSISOIndCalculate(driver, node, snrRx1, &(node->measures.CFRMeasureList), bgn, bgn->numMeasures, NULL);
+    }
+    else
+    {
+      ret = VbSnrMIMOIndCalculate(driver, node, snrRx1, snrRx2, &(node->measures.CFRMeasureList), bgn, bgn->numMeasures, NULL);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineBenchSnrSparseNodeRun(t_VBDriver *driver, t_node *node, INT8U *snrRx1, INT8U *snrRx2)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_processMeasure    *bgn;
+
+  if ((driver == NULL) || (node == NULL) || (snrRx1 == NULL) || (snrRx2 == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineXtalkSparsityAnalyze(driver, node);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    bgn = &(node->measures.BGNMeasure);
+
+    if (bgn->mimoInd == FALSE)
+    {
+      ret = VbSnrSISOIndCalculate(driver, node, snrRx1, &(node->measures.CFRMeasureList), bgn, bgn->numMeasures,
+                                  &(node->xtalkSparsity));
+    }
+    else
+    {
+      ret = VbSnrMIMOIndCalculate(driver, node, snrRx1, snrRx2, &(node->measures.CFRMeasureList), bgn, bgn->numMeasures,
+                                  &(node->xtalkSparsity));
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineBenchCapacityNodeRun(t_node *node, float *capacity)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_processMeasure    *snr;
+
+  if ((node == NULL) || (capacity == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    snr = &(node->measures.snrFullXtalk);
+
+    if (snr->measuresRx1 == NULL)
+    {
+      ret = VB_ENGINE_ERROR_SNRCALCERROR_NOMEASURES;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbChannelCapacityCalculate(snr->spacing, snr->measuresRx1, node->channelSettings.firstValidCarrier,
+                                     snr->numMeasures, capacity, node->channelSettings.boostInfo.maxNumBands);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineBenchSnrAndCapacityRun(INT32U clusterId)
+{
+  t_VB_engineErrorCode ret;
+  BOOL                 cont = TRUE;
+
+  ret = VbSnrListDomainMacsCalculate(clusterId, &cont);
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineChannelCapacityCalculate(clusterId, &cont);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/
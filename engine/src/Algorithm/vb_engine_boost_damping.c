@@ -0,0 +1,392 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost_engine
+ * @{
+ **/
+
+/**
+ * @file vb_engine_boost_damping.c
+ * @brief Boost reconfiguration damping
+ *
+ * @internal
+ *
+ * Sits between the boost decision (CDTA analysis and left to right PSD) and the
+ * PSD shape / CDTA push. A node keeps its boost level for at least NodeDwell ms;
+ * a decision which only reverts or replaces a change not applied yet is merged
+ * with it. A cluster is reconfigured at most once every ClusterDwell ms, within
+ * a token bucket of ReconfPerMin reconfigurations per minute (Burst back to
+ * back), and pending changes are batched until the next apply window. Apply
+ * windows are aligned to the MAC cycle sequence numbers given by
+ * VbEngineClockFutureTSGet, the same grid used to schedule the change.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_counters.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_cluster_list.h"
+#include "vb_engine_clock.h"
+#include "vb_engine_boost_damping.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define BOOST_DAMPING_TOKEN                (1000)  // Token units (thousandths of reconfiguration)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  t_writeFun writeFun;
+} t_boostDampingConsoleArgs;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static pthread_mutex_t vbEngineBoostDampingMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ ************************************************************************
+ ** Private function definition
+ ************************************************************************
+ */
+
+static void BoostDampingTokensRefill(t_boostDamping *damping, const t_vbEngineBoostDampingConf *conf, struct timespec now)
+{
+  INT64S elapsed;
+  INT64U tokens;
+  INT64U max_tokens = (INT64U)conf->burst * BOOST_DAMPING_TOKEN;
+
+  if ((damping->lastRefill.tv_sec == 0) && (damping->lastRefill.tv_nsec == 0))
+  {
+    // First reconfiguration, bucket starts full
+    tokens = max_tokens;
+  }
+  else
+  {
+    elapsed = VbUtilElapsetimeTimespecMs(damping->lastRefill, now);
+    tokens = damping->tokens;
+
+    if (elapsed > 0)
+    {
+      // reconfPerMin tokens every 60000 ms
+      tokens += ((INT64U)elapsed * conf->reconfPerMin * BOOST_DAMPING_TOKEN) / 60000;
+    }
+  }
+
+  damping->tokens = (INT32U)MIN(tokens, max_tokens);
+  damping->lastRefill = now;
+}
+
+/*******************************************************************/
+
+static BOOLEAN BoostDampingWindowGet(INT32U clusterId, const t_vbEngineBoostDampingConf *conf, INT32U *window)
+{
+  BOOLEAN              found = FALSE;
+  t_VB_engineErrorCode err;
+  INT16U               seq_num;
+  INT32U               window_cycles = conf->applyWindow / MAC_CYCLE_DURATION;
+
+  if (window_cycles > 0)
+  {
+    // Same sequence number grid used to schedule the change
+    err = VbEngineClockFutureTSGet(NULL, clusterId, &seq_num, NULL);
+
+    if (err == VB_ENGINE_ERROR_NONE)
+    {
+      *window = seq_num / window_cycles;
+      found = TRUE;
+    }
+  }
+
+  return found;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode BoostDampingConsoleClusterCb(t_VBCluster *cluster, void *args)
+{
+  t_VB_engineErrorCode       ret = VB_ENGINE_ERROR_NONE;
+  t_boostDampingConsoleArgs *console_args = (t_boostDampingConsoleArgs *)args;
+  t_boostDamping             damping;
+
+  if ((cluster == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else
+  {
+    pthread_mutex_lock(&vbEngineBoostDampingMutex);
+    damping = cluster->boostDamping;
+    pthread_mutex_unlock(&vbEngineBoostDampingMutex);
+
+    console_args->writeFun("| %7u | %10u | %10u | %10u | %10u | %4u.%03u | %7s |\n",
+        cluster->clusterInfo.clusterId,
+        damping.numApplied,
+        damping.numDeferred,
+        damping.numSuppressed,
+        damping.numMerged,
+        damping.tokens / BOOST_DAMPING_TOKEN, damping.tokens % BOOST_DAMPING_TOKEN,
+        (damping.pending == TRUE)?"YES":"NO");
+  }
+
+  return ret;
+}
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+INT8U VbEngineBoostDampingNodeFilter(t_node *node, INT8U nBands, INT32U *numSuppressed, INT32U *numMerged)
+{
+  const t_vbEngineBoostDampingConf *conf = VbEngineConfBoostDampingGet();
+  t_boostInfo                      *boost_info;
+  struct timespec                   now;
+  INT8U                             n_bands = nBands;
+
+  if ((conf->enable == TRUE) && (node != NULL) && (numSuppressed != NULL) && (numMerged != NULL))
+  {
+    boost_info = &node->channelSettings.boostInfo;
+
+    if ((nBands != boost_info->level) && (boost_info->level != 0))
+    {
+      clock_gettime(CLOCK_MONOTONIC, &now);
+
+      if (boost_info->level != boost_info->levelCnf)
+      {
+        // Previous change not applied yet, replace it
+        (*numMerged)++;
+        VbCounterIncrease(VB_ENGINE_COUNTER_BOOST_DAMPING_MERGED);
+      }
+      else if (VbUtilElapsetimeTimespecMs(boost_info->levelChangeTs, now) < conf->nodeDwell)
+      {
+        // Keep current level until dwell time expires
+        n_bands = boost_info->level;
+        (*numSuppressed)++;
+        VbCounterIncrease(VB_ENGINE_COUNTER_BOOST_DAMPING_SUPPRESSED);
+      }
+
+      if (n_bands != boost_info->level)
+      {
+        boost_info->levelChangeTs = now;
+      }
+    }
+  }
+
+  return n_bands;
+}
+
+/*******************************************************************/
+
+void VbEngineBoostDampingNodeSettle(t_node *node)
+{
+  const t_vbEngineBoostDampingConf *conf = VbEngineConfBoostDampingGet();
+
+  if ((conf->enable == TRUE) &&
+      (node != NULL) &&
+      (node->channelSettings.psdShape.sendUpdate == TRUE) &&
+      (node->channelSettings.boostInfo.levelCnf != 0) &&
+      (node->channelSettings.boostInfo.level == node->channelSettings.boostInfo.levelCnf))
+  {
+    // Pending change reverted before being applied, nodes already run this PSD
+    node->channelSettings.psdShape.sendUpdate = FALSE;
+  }
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineBoostDampingGate(INT32U clusterId, INT32U numSuppressed, INT32U numMerged,
+    BOOLEAN *sendUpdate, BOOLEAN *qosRateChange)
+{
+  t_VB_engineErrorCode              ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineBoostDampingConf *conf = VbEngineConfBoostDampingGet();
+  t_VBCluster                      *cluster = NULL;
+  t_boostDamping                   *damping;
+  struct timespec                   now;
+  const CHAR                       *reason = NULL;
+  BOOLEAN                           window_found;
+  INT32U                            window = 0;
+
+  if ((sendUpdate == NULL) || (qosRateChange == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (conf->enable == FALSE))
+  {
+    ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineClusterByIdGet(clusterId, &cluster);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Get apply window out of damping lock, it loops through drivers
+    window_found = BoostDampingWindowGet(clusterId, conf, &window);
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    pthread_mutex_lock(&vbEngineBoostDampingMutex);
+    damping = &cluster->boostDamping;
+
+    damping->numSuppressed += numSuppressed;
+    damping->numMerged += numMerged;
+
+    if (damping->qosRatePending == TRUE)
+    {
+      // QoS rate changed while reconfiguration was held
+      *qosRateChange = TRUE;
+    }
+
+    if ((*sendUpdate == TRUE) || (*qosRateChange == TRUE))
+    {
+      BoostDampingTokensRefill(damping, conf, now);
+
+      if (damping->pending == FALSE)
+      {
+        damping->pending = TRUE;
+        damping->pendingWindow = window;
+      }
+
+      if ((damping->numApplied > 0) &&
+          (VbUtilElapsetimeTimespecMs(damping->lastApply, now) < conf->clusterDwell))
+      {
+        reason = "cluster dwell";
+      }
+      else if ((window_found == TRUE) && (window == damping->pendingWindow))
+      {
+        reason = "apply window";
+      }
+      else if (damping->tokens < BOOST_DAMPING_TOKEN)
+      {
+        reason = "rate limit";
+      }
+
+      if (reason == NULL)
+      {
+        damping->tokens -= BOOST_DAMPING_TOKEN;
+        damping->lastApply = now;
+        damping->pending = FALSE;
+        damping->qosRatePending = FALSE;
+        damping->numApplied++;
+      }
+      else
+      {
+        damping->qosRatePending = *qosRateChange;
+        damping->numDeferred++;
+
+        *sendUpdate = FALSE;
+        *qosRateChange = FALSE;
+      }
+    }
+    pthread_mutex_unlock(&vbEngineBoostDampingMutex);
+
+    if (reason != NULL)
+    {
+      VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Cluster %u: boost reconfiguration held (%s)", clusterId, reason);
+      VbCounterIncrease(VB_ENGINE_COUNTER_BOOST_DAMPING_DEFERRED);
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_EXIT_LOOP_OK)
+  {
+    ret = VB_ENGINE_ERROR_NONE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOL VbEngineBoostDampingConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  const t_vbEngineBoostDampingConf *conf = VbEngineConfBoostDampingGet();
+  t_boostDampingConsoleArgs         console_args;
+
+  console_args.writeFun = writeFun;
+
+  writeFun("Boost damping : %s (node dwell %u ms, cluster dwell %u ms, %u reconf/min, burst %u, apply window %u ms)\n",
+      (conf->enable == TRUE)?"ENABLED":"DISABLED",
+      conf->nodeDwell,
+      conf->clusterDwell,
+      conf->reconfPerMin,
+      conf->burst,
+      conf->applyWindow);
+
+  writeFun("===========================================================================================\n");
+  writeFun("| %7s | %10s | %10s | %10s | %10s | %8s | %7s |\n",
+      "Cluster", "Applied", "Deferred", "Suppressed", "Merged", "Tokens", "Pending");
+  writeFun("===========================================================================================\n");
+  VbEngineDatamodelClustersLoop(BoostDampingConsoleClusterCb, &console_args);
+  writeFun("===========================================================================================\n");
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
@@ -0,0 +1,134 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost_engine
+ * @{
+ **/
+
+/**
+ * @file vb_engine_boost_damping.h
+ * @brief Boost reconfiguration damping
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_BOOST_DAMPING_H_
+#define VB_ENGINE_BOOST_DAMPING_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_BOOST_DAMPING_DEFAULT_NODE_DWELL         (5000)  // ms
+#define VB_ENGINE_BOOST_DAMPING_DEFAULT_CLUSTER_DWELL      (1000)  // ms
+#define VB_ENGINE_BOOST_DAMPING_DEFAULT_RECONF_PER_MIN     (12)
+#define VB_ENGINE_BOOST_DAMPING_DEFAULT_BURST              (3)
+#define VB_ENGINE_BOOST_DAMPING_DEFAULT_APPLY_WINDOW       (400)   // ms
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  BOOLEAN  enable;                       ///< Damp boost reconfigurations
+  INT32U   nodeDwell;                    ///< Minimum time a node keeps a boost level (ms)
+  INT32U   clusterDwell;                 ///< Minimum time between reconfigurations of a cluster (ms)
+  INT32U   reconfPerMin;                 ///< Sustained reconfigurations per minute allowed in a cluster
+  INT32U   burst;                        ///< Reconfigurations allowed back to back
+  INT32U   applyWindow;                  ///< Length of apply windows where pending changes are batched (ms, 0 to disable)
+} t_vbEngineBoostDampingConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Filters the boost level decided for a node. A change is suppressed when the
+ * node changed its level less than NodeDwell ms ago, unless it replaces a pending change.
+ * Shall be called with driver domains locked.
+ * @param[in] node Node
+ * @param[in] nBands Number of bands decided by boost algorithm
+ * @param[in,out] numSuppressed Incremented when the change is suppressed
+ * @param[in,out] numMerged Incremented when the change replaces a pending one
+ * @return Number of bands to apply
+ **/
+INT8U VbEngineBoostDampingNodeFilter(t_node *node, INT8U nBands, INT32U *numSuppressed, INT32U *numMerged);
+
+/**
+ * @brief Drops the PSD update of a node whose pending change went back to the confirmed level.
+ * Shall be called with driver domains locked, after applying the filtered level.
+ * @param[in] node Node
+ **/
+void VbEngineBoostDampingNodeSettle(t_node *node);
+
+/**
+ * @brief Decides whether a cluster reconfiguration is applied now or held.
+ * Held reconfigurations are retried from next boost algorithm runs.
+ * @param[in] clusterId Cluster Id
+ * @param[in] numSuppressed Node changes suppressed in current run
+ * @param[in] numMerged Node changes merged in current run
+ * @param[in,out] sendUpdate PSD update required; cleared if held
+ * @param[in,out] qosRateChange QoS rate change required; cleared if held and set if a held change is released
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineBoostDampingGate(INT32U clusterId, INT32U numSuppressed, INT32U numMerged,
+    BOOLEAN *sendUpdate, BOOLEAN *qosRateChange);
+
+/**
+ * @brief Console command to show boost damping state
+ **/
+BOOL VbEngineBoostDampingConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_BOOST_DAMPING_H_ */
+
+/**
+ * @}
+ **/
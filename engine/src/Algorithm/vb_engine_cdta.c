@@ -69,6 +69,7 @@
 #include "vb_engine_cdta.h"
 #include "vb_engine_conf.h"
 #include "vb_engine_metrics_reports.h"
+#include "vb_engine_traffic_forecast.h"
 
 
 /*
@@ -421,6 +422,7 @@ static t_VB_engineErrorCode VbCdtaBoostingAnalyseCb(t_VBDriver *driver, t_domain
       INT32U n_lines_boosted;
       INT32U perc;
       INT32U capacity_current_band;
+      INT16U demand;
       INT16U allowed_SLA_xput;
       INT16U n_bands = ((t_cdtaAnalyseArgs *)(args))->nBands;
       INT8U  band_idx = ((t_cdtaAnalyseArgs *)(args))->bandIdx;
@@ -437,7 +439,9 @@ static t_VB_engineErrorCode VbCdtaBoostingAnalyseCb(t_VBDriver *driver, t_domain
 
       if(node->cdtaInfo.bandSet.skipBand == FALSE)
       {
-        allowed_SLA_xput = (node->cdtaInfo.profile.userSLA != 0)?(MIN(node->cdtaInfo.profile.userSLA, node->trafficReports.neededL2Xput)):node->trafficReports.neededL2Xput;
+        // Provision forecast demand when it is above current one
+        demand = VbEngineTrafficForecastDemandGet(&node->trafficReports);
+        allowed_SLA_xput = (node->cdtaInfo.profile.userSLA != 0)?(MIN(node->cdtaInfo.profile.userSLA, demand)):demand;
         n_lines_boosted = (node->type == VB_NODE_DOMAIN_MASTER)?cluster_cdta_info->stats.nBoostedDownLines[band_idx][rate_idx]:cluster_cdta_info->stats.nBoostedUpLines[band_idx][rate_idx];
 
         ret = VbCdtaGetBandCapacity(&node->cdtaInfo, cluster_cdta_info->stats.bpsValidBandsBitmap, n_lines_boosted, rate_idx, band_idx, &capacity_current_band, num_nodes);
@@ -562,27 +566,28 @@ static t_VB_engineErrorCode VbCdtaAdequationMetricFillCb(t_VBDriver *driver, t_d
     else
     {
       INT32U i;
+      INT16U demand = VbEngineTrafficForecastDemandGet(&node->trafficReports);
 
       for(i = VB_ENGINE_QOS_RATE_10_90; i < VB_ENGINE_QOS_RATE_90_10; i++)
       {
         // Fill metric for this Qos Rate
         VbCdtaAdequationMetricsSet(&node->cdtaInfo,
                                    cluster_cdta_info,
-                                   node->trafficReports.neededL2Xput,
+                                   demand,
                                    node->type,
                                    node->channelSettings.boostInfo.maxNumBands,
                                    i);
       }
 
-      if( (node->type == VB_NODE_DOMAIN_MASTER) && (node->trafficReports.neededL2Xput > VB_ENGINE_CDTA_MIN_TRAFFIC) )
+      if( (node->type == VB_NODE_DOMAIN_MASTER) && (demand > VB_ENGINE_CDTA_MIN_TRAFFIC) )
       {
         cluster_cdta_info->stats.nDowns++;
-        cluster_cdta_info->stats.aggregatedDowns += node->trafficReports.neededL2Xput;
+        cluster_cdta_info->stats.aggregatedDowns += demand;
       }
-      else if ( (node->type == VB_NODE_END_POINT) && (node->trafficReports.neededL2Xput > VB_ENGINE_CDTA_MIN_TRAFFIC) )
+      else if ( (node->type == VB_NODE_END_POINT) && (demand > VB_ENGINE_CDTA_MIN_TRAFFIC) )
       {
         cluster_cdta_info->stats.nUps++;
-        cluster_cdta_info->stats.aggregatedUps += node->trafficReports.neededL2Xput;
+        cluster_cdta_info->stats.aggregatedUps += demand;
       }
     }
   }
@@ -1007,7 +1012,6 @@ static t_VB_engineErrorCode VbEngineCDTADriverCb(t_VBDriver *driver, void *args)
   {
     // Add room for header
     shape_args.length = VB_EA_CDTA_REQ_HDR_SIZE;
-
     // Loop through all nodes to calculate message length
     ret = VbEngineDatamodelNodesLoop(driver, VbEnginePSDShapeLengthCalcCb, &shape_args);
   }
@@ -1116,6 +1120,7 @@ static t_VB_engineErrorCode VbEngineCdtaCnfNotifyLoopCb(t_VBDriver *driver, t_do
   {
     node->channelSettings.psdShape.sendUpdate = FALSE;
     node->channelSettings.boostInfo.levelCnf = node->channelSettings.boostInfo.level;
+    node->channelSettings.cfgSync.versionCnf = node->channelSettings.cfgSync.versionSent;
   }
 
   return ret;
@@ -1511,20 +1516,14 @@ t_VB_engineErrorCode VbCdtaGlobalHistInfoDump(t_writeFun writeFun, INT32U cluste
 
 /*******************************************************************/
 
-t_VB_engineErrorCode VbEngineCDTAConfigurationParse( ezxml_t cdta_conf )
+t_VB_engineErrorCode VbEngineCDTAConfigurationParse( ezxml_t cdta_conf, t_cdtaConf *cdta_conf_data )
 {
-  t_VB_engineErrorCode err_code;
+  t_VB_engineErrorCode err_code = VB_ENGINE_ERROR_NONE;
   ezxml_t              ez_temp;
-  t_cdtaConf           *cdta_conf_data = NULL;
-
-  err_code = VbEngineConfCDTADataGet(&cdta_conf_data);
 
-  if (err_code == VB_ENGINE_ERROR_NONE)
+  if ((cdta_conf == NULL) || (cdta_conf_data == NULL))
   {
-    if (cdta_conf == NULL)
-    {
-      err_code = VB_ENGINE_ERROR_BAD_ARGUMENTS;
-    }
+    err_code = VB_ENGINE_ERROR_BAD_ARGUMENTS;
   }
 
   if (err_code == VB_ENGINE_ERROR_NONE)
@@ -1563,19 +1562,10 @@ t_VB_engineErrorCode VbEngineCDTAConfigurationParse( ezxml_t cdta_conf )
         printf("ERROR (%d:%s) parsing .ini file: Invalid DownUpWeight value\n", errno, strerror(errno));
         err_code = VB_ENGINE_ERROR_INI_FILE;
       }
-      else
+      else if(cdta_conf_data->downUpWeight > VB_ENGINE_MAX_DOWN_UP_WEIGHT)
       {
-        if(cdta_conf_data->downUpWeight <= VB_ENGINE_MAX_DOWN_UP_WEIGHT)
-        {
-          cdtaGlobalConf.weights.downPref = cdta_conf_data->downUpWeight;
-          cdtaGlobalConf.weights.upPref = VB_ENGINE_MAX_DOWN_UP_WEIGHT - cdta_conf_data->downUpWeight;
-          cdtaGlobalConf.weights.downUpMultFactor = 0;
-        }
-        else
-        {
-          printf("ERROR (%d:%s) parsing .ini file: Invalid DownUpWeight value\n", errno, strerror(errno));
-          err_code = VB_ENGINE_ERROR_INI_FILE;
-        }
+        printf("ERROR (%d:%s) parsing .ini file: Invalid DownUpWeight value\n", errno, strerror(errno));
+        err_code = VB_ENGINE_ERROR_INI_FILE;
       }
     }
     else
@@ -1599,10 +1589,6 @@ t_VB_engineErrorCode VbEngineCDTAConfigurationParse( ezxml_t cdta_conf )
         printf("ERROR (%d:%s) parsing .ini file: Invalid MinDownUpRate value\n", errno, strerror(errno));
         err_code = VB_ENGINE_ERROR_INI_FILE;
       }
-      else
-      {
-        cdtaGlobalConf.minQosRate = cdta_conf_data->minDownUpRate;
-      }
     }
     else
     {
@@ -1625,10 +1611,6 @@ t_VB_engineErrorCode VbEngineCDTAConfigurationParse( ezxml_t cdta_conf )
         printf("ERROR (%d:%s) parsing .ini file: Invalid MaxDownUpRate value\n", errno, strerror(errno));
         err_code = VB_ENGINE_ERROR_INI_FILE;
       }
-      else
-      {
-        cdtaGlobalConf.maxQosRate = cdta_conf_data->maxDownUpRate;
-      }
     }
     else
     {
@@ -1651,16 +1633,6 @@ t_VB_engineErrorCode VbEngineCDTAConfigurationParse( ezxml_t cdta_conf )
         printf("ERROR (%d:%s) parsing .ini file: Invalid DefaultDownUpRate value\n", errno, strerror(errno));
         err_code = VB_ENGINE_ERROR_INI_FILE;
       }
-      else
-      {
-        cdtaGlobalConf.defaultQosRate = cdta_conf_data->defaultDownUpRate;
-        if(cdta_conf_data->enabled == FALSE)
-        {
-          // CDTA disabled, max = min
-          cdtaGlobalConf.maxQosRate = cdtaGlobalConf.defaultQosRate;
-          cdtaGlobalConf.minQosRate = cdtaGlobalConf.defaultQosRate;
-        }
-      }
     }
     else
     {
@@ -1683,10 +1655,6 @@ t_VB_engineErrorCode VbEngineCDTAConfigurationParse( ezxml_t cdta_conf )
         printf("ERROR (%d:%s) parsing .ini file: Invalid percMetricChange value\n", errno, strerror(errno));
         err_code = VB_ENGINE_ERROR_INI_FILE;
       }
-      else
-      {
-        cdtaGlobalConf.percMetricChange = cdta_conf_data->percMetricChange;
-      }
     }
     else
     {
@@ -1700,6 +1668,29 @@ t_VB_engineErrorCode VbEngineCDTAConfigurationParse( ezxml_t cdta_conf )
 
 /*******************************************************************/
 
+void VbEngineCDTAConfApply( const t_cdtaConf *cdtaConf )
+{
+  if (cdtaConf != NULL)
+  {
+    cdtaGlobalConf.weights.downPref = cdtaConf->downUpWeight;
+    cdtaGlobalConf.weights.upPref = VB_ENGINE_MAX_DOWN_UP_WEIGHT - cdtaConf->downUpWeight;
+    cdtaGlobalConf.weights.downUpMultFactor = 0;
+    cdtaGlobalConf.minQosRate = cdtaConf->minDownUpRate;
+    cdtaGlobalConf.maxQosRate = cdtaConf->maxDownUpRate;
+    cdtaGlobalConf.defaultQosRate = cdtaConf->defaultDownUpRate;
+    cdtaGlobalConf.percMetricChange = cdtaConf->percMetricChange;
+
+    if (cdtaConf->enabled == FALSE)
+    {
+      // CDTA disabled, max = min
+      cdtaGlobalConf.maxQosRate = cdtaGlobalConf.defaultQosRate;
+      cdtaGlobalConf.minQosRate = cdtaGlobalConf.defaultQosRate;
+    }
+  }
+}
+
+/*******************************************************************/
+
 t_vbEngineQosRate VbCdtaQosRateGet(INT32U clusterId)
 {
   t_VB_engineErrorCode ret;
@@ -192,9 +192,16 @@ t_VB_engineErrorCode VbCdtaGlobalHistInfoDump(t_writeFun writeFun, INT32U cluste
 /**
  * @brief Parse CDTA info in vb_engine.ini file
  * @param[in] cdta_conf processed cdta info fom ini file
+ * @param[out] cdta_conf_data CDTA configuration to fill
  * @return @ref t_VB_engineErrorCodee
  **/
-t_VB_engineErrorCode VbEngineCDTAConfigurationParse( ezxml_t cdta_conf );
+t_VB_engineErrorCode VbEngineCDTAConfigurationParse( ezxml_t cdta_conf, t_cdtaConf *cdta_conf_data );
+
+/**
+ * @brief Applies CDTA configuration (weights and Qos rates) to the CDTA algorithm
+ * @param[in] cdtaConf CDTA configuration
+ **/
+void VbEngineCDTAConfApply( const t_cdtaConf *cdtaConf );
 
 /**
  * @brief Run CDTA analysis
@@ -64,6 +64,8 @@
 #include "vb_engine_process.h"
 #include "vb_engine_cdta.h"
 #include "vb_measure_utils.h"
+#include "vb_engine_snr_tracking.h"
+#include "vb_engine_boost_damping.h"
 
 /*
  ************************************************************************
@@ -209,7 +211,7 @@
 /*******************************************************************/
 
 t_VB_engineErrorCode VbEngineSnrCalculatedCheck(t_trafficReport* trafficReport, t_nodeChannelSettings *nodeChannelSettings,
-                                                t_VBDriver *thisDriver)
+                                                t_VBDriver *thisDriver, const INT8U *mac)
 {
   t_VB_engineErrorCode result = VB_ENGINE_ERROR_NONE;
   float capacity_difference;
@@ -229,8 +231,12 @@ t_VB_engineErrorCode VbEngineSnrCalculatedCheck(t_trafficReport* trafficReport,
           nodeChannelSettings->interferenceDetectionCounter = 0;
           VbLogPrintExt(VB_LOG_INFO, thisDriver->vbDriverID, "Measurement necessary. Non boosted and capacity_difference == %f", capacity_difference);
 
-          // EP CHANGE will trigger a new measure plan
-          result = VbEngineProcessClusterXDriversEvSend(ENGINE_EV_NETWORK_DIFF_EP_CHANGE, NULL, thisDriver->clusterId);
+          // Check the node with a SNR probe first, if tracking is enabled
+          if (VbEngineSnrTrackingDefer(thisDriver, mac) != VB_ENGINE_ERROR_NONE)
+          {
+            // EP CHANGE will trigger a new measure plan
+            result = VbEngineProcessClusterXDriversEvSend(ENGINE_EV_NETWORK_DIFF_EP_CHANGE, NULL, thisDriver->clusterId);
+          }
         }
       }
       else
@@ -287,13 +293,27 @@ t_VB_engineErrorCode VbEngineLeftToRightPSDShapeRun(t_VBDriver *driver, t_domain
 
       if (node->channelSettings.boostInfo.mode == VB_ENGINE_BOOST_MODE_AUTO)
       {
+        INT8U n_bands;
+
         VbLogPrintExt(VB_LOG_DEBUG, driver->vbDriverID, "Node %s, num Bands %u", node->MACStr, node->cdtaInfo.bandSet.numActiveBands[psd_l2r_args->qos]);
+
+        // Damp level changes of fluctuating nodes
+        n_bands = VbEngineBoostDampingNodeFilter(node,
+                                                 node->cdtaInfo.bandSet.numActiveBands[psd_l2r_args->qos],
+                                                 &psd_l2r_args->numSuppressed,
+                                                 &psd_l2r_args->numMerged);
+
         ret = VbChannelCapacityPSDNBandsSet( &(node->channelSettings),
-                                             node->cdtaInfo.bandSet.numActiveBands[psd_l2r_args->qos],
+                                             n_bands,
                                              psd_l2r_args->psdBandsAllocation );
 
+        if (ret == VB_ENGINE_ERROR_NONE)
+        {
+          VbEngineBoostDampingNodeSettle(node);
+        }
+
 #if VB_ENGINE_METRICS_ENABLED
-        nBands = node->cdtaInfo.bandSet.numActiveBands[psd_l2r_args->qos];
+        nBands = n_bands;
 #endif
 
         if (ret != VB_ENGINE_ERROR_NONE)
@@ -69,6 +69,8 @@ typedef struct s_psdl2rArgs
 {
   INT32U qos;
   t_psdBandAllocation *psdBandsAllocation;
+  INT32U numSuppressed;   ///< Level changes suppressed by boost damping
+  INT32U numMerged;       ///< Level changes merged with a pending one by boost damping
 } t_psdl2rArgs;
 /*
  ************************************************************************
@@ -88,10 +90,12 @@ t_VB_engineErrorCode VbEngineLastRelativeLowBandCarrierIdxGet(INT16U firstValidC
  * @brief Detects discrepancies between capacity calculated by Engine and capacity reported by the node.
  * @param[in] trafficReport Traffic report info
  * @param[in] nodeChannelSettings Node channel settings
+ * @param[in] thisDriver Pointer to driver
+ * @param[in] mac MAC address of the reporting node
  * @return @ref t_VB_engineErrorCode
  **/
 t_VB_engineErrorCode VbEngineSnrCalculatedCheck(t_trafficReport* trafficReport, t_nodeChannelSettings* nodeChannelSettings,
-    t_VBDriver *thisDriver);
+    t_VBDriver *thisDriver, const INT8U *mac);
 
 /**
  * @brief Updates low band capacity with value conveyed in last traffic report received from a node.
@@ -107,7 +107,76 @@
 
 /*******************************************************************/
 
+static void VbEnginePSDShapeCfgSyncUpdate(t_domain *domain, t_node *node)
+{
+  t_nodeCfgSync        cfg;
+  t_psdBandAllocation *psd_band_allocation = VbEngineConfPSDBandAllocationGet();
+  INT32U               band_idx;
+
+  // Clear padding, configurations are compared with memcmp
+  memset(&cfg, 0, sizeof(cfg));
+
+  cfg.numPSDBands = MIN(node->channelSettings.psdShape.numPSDBands, VB_PSD_NUM_BANDS);
+  memcpy(cfg.psdBandLevel, node->channelSettings.psdShape.psdBandLevel, cfg.numPSDBands * sizeof(t_psdBandLevel));
+
+  // Calculate Upstream and Downstream phy rates
+  if (node->type == VB_NODE_DOMAIN_MASTER)
+  {
+    if (domain->eps.epsArray != NULL)
+    {
+      cfg.maxPhyRateDown = node->cdtaInfo.bandCapacities[0][VB_ENGINE_QOS_RATE_80_20].capacityAllBoosted;
+      cfg.maxPhyRateUp = domain->eps.epsArray[0].cdtaInfo.bandCapacities[0][VB_ENGINE_QOS_RATE_20_80].capacityAllBoosted;
+
+      for(band_idx = 1; band_idx < psd_band_allocation->numBands200Mhz; band_idx++)
+      {
+        cfg.maxPhyRateDown += node->cdtaInfo.bandCapacities[band_idx][VB_ENGINE_QOS_RATE_80_20].capacity1Boosted;
+        cfg.maxPhyRateUp += domain->eps.epsArray[0].cdtaInfo.bandCapacities[band_idx][VB_ENGINE_QOS_RATE_20_80].capacity1Boosted;
+      }
+    }
+  }
+  else
+  {
+    cfg.maxPhyRateDown = domain->dm.cdtaInfo.bandCapacities[0][VB_ENGINE_QOS_RATE_80_20].capacityAllBoosted;
+    cfg.maxPhyRateUp = node->cdtaInfo.bandCapacities[0][VB_ENGINE_QOS_RATE_20_80].capacityAllBoosted;
+
+    for(band_idx = 1; band_idx < psd_band_allocation->numBands200Mhz; band_idx++)
+    {
+      cfg.maxPhyRateDown += domain->dm.cdtaInfo.bandCapacities[band_idx][VB_ENGINE_QOS_RATE_80_20].capacity1Boosted;
+      cfg.maxPhyRateUp += node->cdtaInfo.bandCapacities[band_idx][VB_ENGINE_QOS_RATE_20_80].capacity1Boosted;
+    }
+  }
+
+  // Keep versions, compare only the configuration itself
+  cfg.version = node->channelSettings.cfgSync.version;
+  cfg.versionSent = node->channelSettings.cfgSync.versionSent;
+  cfg.versionCnf = node->channelSettings.cfgSync.versionCnf;
 
+  if (memcmp(&cfg, &node->channelSettings.cfgSync, sizeof(cfg)) != 0)
+  {
+    cfg.version++;
+    node->channelSettings.cfgSync = cfg;
+  }
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode VbEnginePSDShapeCfgSyncResetLoopCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+
+  if (node == NULL)
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Forget last confirmation, node shall be confirmed again by its driver
+    node->channelSettings.cfgSync.versionCnf = 0;
+  }
+
+  return ret;
+}
 
 /*******************************************************************/
 
@@ -150,6 +219,7 @@ static t_VB_engineErrorCode VbEnginePsdShapeCnfNotifyLoopCb(t_VBDriver *driver,
   {
     node->channelSettings.psdShape.sendUpdate = FALSE;
     node->channelSettings.boostInfo.levelCnf = node->channelSettings.boostInfo.level;
+    node->channelSettings.cfgSync.versionCnf = node->channelSettings.cfgSync.versionSent;
   }
 
   return ret;
@@ -169,7 +239,8 @@ static t_VB_engineErrorCode VbEnginePsdShapeCnfCheckLoopCb(t_VBDriver *driver, t
   if (ret == VB_ENGINE_ERROR_NONE)
   {
     if ((node->channelSettings.psdShape.sendUpdate == TRUE) ||
-        (node->channelSettings.boostInfo.levelCnf != node->channelSettings.boostInfo.level))
+        (node->channelSettings.boostInfo.levelCnf != node->channelSettings.boostInfo.level) ||
+        (node->channelSettings.cfgSync.versionCnf != node->channelSettings.cfgSync.versionSent))
     {
       ret = VB_ENGINE_ERROR_NOT_READY;
     }
@@ -309,6 +380,12 @@ t_VB_engineErrorCode VbEnginePSDShapeConfigureAll(INT32U clusterId)
     ret = VbEngineClockFutureTSGet(NULL, clusterId, &apply_seq_num, &apply_ts);
   }
 
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Forced resend, previous confirmations are no longer trusted
+    ret = VbEngineDatamodelClusterXAllNodesLoop(VbEnginePSDShapeCfgSyncResetLoopCb, clusterId, NULL);
+  }
+
   if (ret == VB_ENGINE_ERROR_NONE)
   {
     // Loop through all drivers to build and send PSD Shape message
@@ -436,8 +513,13 @@ t_VB_engineErrorCode VbEnginePSDShapeLengthCalcCb(t_VBDriver *driver, t_domain *
     }
     else if (node->channelSettings.boostInfo.level != 0)
     {
-      shape_args->length += VB_EA_PSD_SHAPE_REQ_STEP_HDR_SIZE + (node->channelSettings.psdShape.numPSDBands * VB_EA_PSD_SHAPE_REQ_STEP_SIZE);
+      // Bump node configuration version if PSD or phy rates changed
+      VbEnginePSDShapeCfgSyncUpdate(domain, node);
+
+      // Every boosted node is always sent, drivers replace the whole configuration
+      shape_args->length += VB_EA_PSD_SHAPE_REQ_STEP_HDR_SIZE + (node->channelSettings.cfgSync.numPSDBands * VB_EA_PSD_SHAPE_REQ_STEP_SIZE);
       (shape_args->numPsds)++;
+      node->channelSettings.cfgSync.versionSent = node->channelSettings.cfgSync.version;
     }
     else if (node->trafficReports.reportsReceived == FALSE)
     {
@@ -454,6 +536,7 @@ t_VB_engineErrorCode VbEnginePSDShapeBuildCb(t_VBDriver *driver, t_domain *domai
 {
   t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
   t_psdShapeArgs      *shape_args = (t_psdShapeArgs *)args;
+  t_nodeCfgSync       *cfg_sync = NULL;
   INT32U               i = 0;
   INT8U               *pld = NULL;
 
@@ -471,64 +554,39 @@ t_VB_engineErrorCode VbEnginePSDShapeBuildCb(t_VBDriver *driver, t_domain *domai
       (VbEngineDatamodelDomainIsComplete(domain) == TRUE) &&
       (node->channelSettings.boostInfo.level != 0))
   {
-    INT32U band_idx;
-    t_psdBandAllocation *psd_band_allocation = VbEngineConfPSDBandAllocationGet();
+    cfg_sync = &node->channelSettings.cfgSync;
 
     // Get pointer to write
     pld = shape_args->ptrToWrite;
 
-    memcpy(((t_vbEAPSDShapeStepHdr *)pld)->MAC, node->MAC, ETH_ALEN);
-    ((t_vbEAPSDShapeStepHdr *)pld)->numPSDSteps = _htons(node->channelSettings.psdShape.numPSDBands);
-
-    // Calculate Upstream and Downstream phy rates
-    if (node->type == VB_NODE_DOMAIN_MASTER)
+    if ((pld + VB_EA_PSD_SHAPE_REQ_STEP_HDR_SIZE + (cfg_sync->numPSDBands * VB_EA_PSD_SHAPE_REQ_STEP_SIZE)) >
+        (shape_args->payload + shape_args->length))
     {
-      if (domain->eps.epsArray != NULL)
-      {
-        ((t_vbEAPSDShapeStepHdr *)pld)->maxPhyRateDown =
-            node->cdtaInfo.bandCapacities[0][VB_ENGINE_QOS_RATE_80_20].capacityAllBoosted;
-
-        ((t_vbEAPSDShapeStepHdr *)pld)->maxPhyRateUp =
-            domain->eps.epsArray[0].cdtaInfo.bandCapacities[0][VB_ENGINE_QOS_RATE_20_80].capacityAllBoosted;
-
-        for(band_idx = 1; band_idx < psd_band_allocation->numBands200Mhz; band_idx++)
-        {
-          ((t_vbEAPSDShapeStepHdr *)pld)->maxPhyRateDown +=
-              node->cdtaInfo.bandCapacities[band_idx][VB_ENGINE_QOS_RATE_80_20].capacity1Boosted;
-          ((t_vbEAPSDShapeStepHdr *)pld)->maxPhyRateUp +=
-              domain->eps.epsArray[0].cdtaInfo.bandCapacities[band_idx][VB_ENGINE_QOS_RATE_20_80].capacity1Boosted;
-        }
-      }
+      // Node configuration changed after calculating message length
+      ret = VB_ENGINE_ERROR_NOT_READY;
     }
-    else
-    {
-      ((t_vbEAPSDShapeStepHdr *)pld)->maxPhyRateDown =
-          domain->dm.cdtaInfo.bandCapacities[0][VB_ENGINE_QOS_RATE_80_20].capacityAllBoosted;
-
-      ((t_vbEAPSDShapeStepHdr *)pld)->maxPhyRateUp =
-          node->cdtaInfo.bandCapacities[0][VB_ENGINE_QOS_RATE_20_80].capacityAllBoosted;
+  }
 
-      for(band_idx = 1; band_idx < psd_band_allocation->numBands200Mhz; band_idx++)
-      {
-        ((t_vbEAPSDShapeStepHdr *)pld)->maxPhyRateDown +=
-            domain->dm.cdtaInfo.bandCapacities[band_idx][VB_ENGINE_QOS_RATE_80_20].capacity1Boosted;
-        ((t_vbEAPSDShapeStepHdr *)pld)->maxPhyRateUp +=
-            node->cdtaInfo.bandCapacities[band_idx][VB_ENGINE_QOS_RATE_20_80].capacity1Boosted;
-      }
-    }
+  if ((ret == VB_ENGINE_ERROR_NONE) && (pld != NULL))
+  {
+    memcpy(((t_vbEAPSDShapeStepHdr *)pld)->MAC, node->MAC, ETH_ALEN);
+    ((t_vbEAPSDShapeStepHdr *)pld)->numPSDSteps = _htons(cfg_sync->numPSDBands);
+    ((t_vbEAPSDShapeStepHdr *)pld)->maxPhyRateDown = cfg_sync->maxPhyRateDown;
+    ((t_vbEAPSDShapeStepHdr *)pld)->maxPhyRateUp = cfg_sync->maxPhyRateUp;
 
     pld += VB_EA_PSD_SHAPE_REQ_STEP_HDR_SIZE;
 
-    VbLogPrintExt(VB_LOG_INFO, driver->vbDriverID, "%s MAC %s; numBands %u; level %u",
+    VbLogPrintExt(VB_LOG_INFO, driver->vbDriverID, "%s MAC %s; numBands %u; level %u; version %u",
         VbNodeTypeToStr(node->type),
         node->MACStr,
-        node->channelSettings.psdShape.numPSDBands,
-        node->channelSettings.boostInfo.level);
+        cfg_sync->numPSDBands,
+        node->channelSettings.boostInfo.level,
+        cfg_sync->version);
 
-    for (i = 0; i < node->channelSettings.psdShape.numPSDBands; i++)
+    for (i = 0; i < cfg_sync->numPSDBands; i++)
     {
-      ((t_vbEAPSDShapeStep*)pld)->stopCarrier = _htons(node->channelSettings.psdShape.psdBandLevel[i].stopCarrier);
-      ((t_vbEAPSDShapeStep*)pld)->attPSD = node->channelSettings.psdShape.psdBandLevel[i].attLevel;
+      ((t_vbEAPSDShapeStep*)pld)->stopCarrier = _htons(cfg_sync->psdBandLevel[i].stopCarrier);
+      ((t_vbEAPSDShapeStep*)pld)->attPSD = cfg_sync->psdBandLevel[i].attLevel;
       pld += VB_EA_PSD_SHAPE_REQ_STEP_SIZE;
     }
 
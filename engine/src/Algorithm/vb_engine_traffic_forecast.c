@@ -0,0 +1,457 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost_engine
+ * @{
+ **/
+
+/**
+ * @file vb_engine_traffic_forecast.c
+ * @brief Per node traffic demand forecast
+ *
+ * @internal
+ *
+ * Demand reported by traffic reports (neededL2Xput) is modelled per node with
+ * additive Holt-Winters smoothing: an exponentially weighted level, a trend in
+ * Mbps per second and a seasonal offset per time of day slot. A report exceeding
+ * the one step prediction by BurstThr times the mean deviation starts a burst,
+ * whose peak is provisioned during BurstHold seconds. The forecast at Horizon
+ * seconds is used by CDTA instead of current demand when larger, so bands and
+ * QoS rates are provisioned ahead of expected demand. Trend is estimated from
+ * report to report differences, so its projection over the horizon is bounded
+ * in both directions to half the level plus the mean deviation. Each forecast
+ * is scored against actual demand once its horizon expires.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_counters.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_traffic_forecast.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_TRAFFIC_FORECAST_WARMUP_REPORTS          (10)
+#define VB_ENGINE_TRAFFIC_FORECAST_MIN_BURST_STEP          (1.0)   // Mbps
+#define VB_ENGINE_TRAFFIC_FORECAST_MIN_DT                  (0.001) // s
+#define VB_ENGINE_TRAFFIC_FORECAST_MAX_DEMAND              (MAX_INT16U)
+#define VB_ENGINE_TRAFFIC_FORECAST_MAX_TREND_GAIN          (0.5)   // Of current level, over the horizon
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  t_writeFun writeFun;
+} t_trafficForecastConsoleArgs;
+
+/*
+ ************************************************************************
+ ** Private function definition
+ ************************************************************************
+ */
+
+static INT32U TrafficForecastSlotGet(time_t t, INT32U numSlots)
+{
+  struct tm tmu;
+  INT32U    slot = 0;
+
+  if ((numSlots > 0) && (localtime_r(&t, &tmu) != NULL))
+  {
+    slot = ((tmu.tm_hour * 60 + tmu.tm_min) * numSlots) / (24 * 60);
+    slot = MIN(slot, numSlots - 1);
+  }
+
+  return slot;
+}
+
+/*******************************************************************/
+
+static float TrafficForecastSeasonGet(const t_trafficForecast *forecast, INT32U slot)
+{
+  float season = 0;
+
+  if ((forecast->numSlots > 0) && (forecast->seasonValid[slot] == TRUE))
+  {
+    season = forecast->season[slot];
+  }
+
+  return season;
+}
+
+/*******************************************************************/
+
+static INT16U TrafficForecastDemandClamp(float demand)
+{
+  INT16U ret = 0;
+
+  if (demand >= VB_ENGINE_TRAFFIC_FORECAST_MAX_DEMAND)
+  {
+    ret = VB_ENGINE_TRAFFIC_FORECAST_MAX_DEMAND;
+  }
+  else if (demand > 0)
+  {
+    ret = (INT16U)lroundf(demand);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void TrafficForecastScore(t_trafficForecast *forecast, INT16U actual, struct timespec now)
+{
+  double err;
+
+  if ((forecast->pendingValid == TRUE) &&
+      (VbUtilElapsetimeTimespecMs(forecast->pendingDue, now) >= 0))
+  {
+    err = (double)forecast->pendingForecast - (double)actual;
+
+    forecast->numErrors++;
+    forecast->absErrorSum += fabs(err);
+    forecast->errorSum += err;
+    forecast->pendingValid = FALSE;
+  }
+}
+
+/*******************************************************************/
+
+static void TrafficForecastBurstCheck(const t_vbEngineTrafficForecastConf *conf, t_trafficReport *trafficReport,
+    float error, struct timespec now)
+{
+  t_trafficForecast *forecast = &trafficReport->forecast;
+  float              thr = (forecast->deviation * conf->burstThr) / 100;
+
+  if ((trafficReport->rxReports > VB_ENGINE_TRAFFIC_FORECAST_WARMUP_REPORTS) &&
+      (error > MAX(thr, VB_ENGINE_TRAFFIC_FORECAST_MIN_BURST_STEP)))
+  {
+    if (forecast->burst == FALSE)
+    {
+      forecast->burst = TRUE;
+      forecast->burstPeak = 0;
+      forecast->numBursts++;
+      VbCounterIncrease(VB_ENGINE_COUNTER_TRAFFIC_FORECAST_BURSTS);
+    }
+
+    forecast->burstStart = now;
+  }
+
+  if (forecast->burst == TRUE)
+  {
+    if (VbUtilElapsetimeTimespecMs(forecast->burstStart, now) > ((INT64S)conf->burstHold * 1000))
+    {
+      forecast->burst = FALSE;
+      forecast->burstPeak = 0;
+    }
+    else
+    {
+      forecast->burstPeak = MAX(forecast->burstPeak, trafficReport->neededL2Xput);
+    }
+  }
+}
+
+/*******************************************************************/
+
+static void TrafficForecastModelUpdate(const t_vbEngineTrafficForecastConf *conf, t_trafficForecast *forecast,
+    float actual, INT32U slot, float dt)
+{
+  float alpha = (float)conf->alpha / 100;
+  float beta = (float)conf->beta / 100;
+  float gamma = (float)conf->gamma / 100;
+  float season = TrafficForecastSeasonGet(forecast, slot);
+  float prev_level = forecast->level;
+
+  forecast->level = alpha * (actual - season) + (1 - alpha) * (forecast->level + forecast->trend * dt);
+  forecast->trend = beta * ((forecast->level - prev_level) / dt) + (1 - beta) * forecast->trend;
+
+  if (forecast->numSlots > 0)
+  {
+    if (forecast->seasonValid[slot] == FALSE)
+    {
+      forecast->season[slot] = actual - forecast->level;
+      forecast->seasonValid[slot] = TRUE;
+    }
+    else
+    {
+      forecast->season[slot] = gamma * (actual - forecast->level) + (1 - gamma) * forecast->season[slot];
+    }
+  }
+}
+
+/*******************************************************************/
+
+static float TrafficForecastTrendProject(const t_trafficForecast *forecast, INT32U horizon)
+{
+  float max_step = fabsf(forecast->level) * VB_ENGINE_TRAFFIC_FORECAST_MAX_TREND_GAIN + forecast->deviation;
+  float step = forecast->trend * horizon;
+
+  step = MIN(step, max_step);
+  step = MAX(step, -max_step);
+
+  return step;
+}
+
+/*******************************************************************/
+
+static void TrafficForecastRun(const t_vbEngineTrafficForecastConf *conf, t_trafficReport *trafficReport)
+{
+  t_trafficForecast *forecast = &trafficReport->forecast;
+  struct timespec    now;
+  time_t             wall;
+  INT32U             num_slots;
+  INT32U             slot;
+  INT32U             slot_horizon;
+  float              actual;
+  float              dt;
+  float              predicted;
+  float              demand;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  wall = time(NULL);
+  actual = trafficReport->neededL2Xput;
+
+  num_slots = MIN(conf->seasonSlots, VB_ENGINE_TRAFFIC_FORECAST_MAX_SLOTS);
+  if (forecast->numSlots != num_slots)
+  {
+    memset(forecast->season, 0, sizeof(forecast->season));
+    memset(forecast->seasonValid, 0, sizeof(forecast->seasonValid));
+    forecast->numSlots = num_slots;
+  }
+
+  slot = TrafficForecastSlotGet(wall, num_slots);
+  slot_horizon = TrafficForecastSlotGet(wall + conf->horizon, num_slots);
+
+  TrafficForecastScore(forecast, trafficReport->neededL2Xput, now);
+
+  if (forecast->valid == FALSE)
+  {
+    forecast->level = actual - TrafficForecastSeasonGet(forecast, slot);
+    forecast->trend = 0;
+    forecast->deviation = 0;
+    forecast->burst = FALSE;
+    forecast->burstPeak = 0;
+    forecast->valid = TRUE;
+  }
+  else
+  {
+    dt = (float)VbUtilElapsetimeTimespecMs(forecast->lastUpdate, now) / 1000;
+    dt = MAX(dt, VB_ENGINE_TRAFFIC_FORECAST_MIN_DT);
+
+    predicted = forecast->level + forecast->trend * dt + TrafficForecastSeasonGet(forecast, slot);
+
+    TrafficForecastBurstCheck(conf, trafficReport, actual - predicted, now);
+    TrafficForecastModelUpdate(conf, forecast, actual, slot, dt);
+
+    forecast->deviation += ((float)conf->alpha / 100) * (fabsf(actual - predicted) - forecast->deviation);
+  }
+
+  forecast->lastUpdate = now;
+
+  demand = forecast->level + TrafficForecastTrendProject(forecast, conf->horizon) +
+           TrafficForecastSeasonGet(forecast, slot_horizon);
+  forecast->demand = TrafficForecastDemandClamp(demand);
+  if (forecast->burst == TRUE)
+  {
+    forecast->demand = MAX(forecast->demand, forecast->burstPeak);
+  }
+
+  if (forecast->pendingValid == FALSE)
+  {
+    forecast->pendingForecast = forecast->demand;
+    forecast->pendingDue = now;
+    forecast->pendingDue.tv_sec += conf->horizon;
+    forecast->pendingValid = TRUE;
+  }
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode TrafficForecastConsoleNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode          ret = VB_ENGINE_ERROR_NONE;
+  t_trafficForecastConsoleArgs *console_args = (t_trafficForecastConsoleArgs *)args;
+  const t_trafficForecast      *forecast;
+  CHAR                          level_str[12];
+  CHAR                          trend_str[12];
+  CHAR                          mae_str[12];
+  CHAR                          bias_str[12];
+
+  if ((driver == NULL) || (node == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else
+  {
+    forecast = &node->trafficReports.forecast;
+
+    if (forecast->valid == TRUE)
+    {
+      snprintf(level_str, sizeof(level_str), "%8.1f", forecast->level);
+      snprintf(trend_str, sizeof(trend_str), "%8.2f", forecast->trend);
+    }
+    else
+    {
+      snprintf(level_str, sizeof(level_str), "%8s", "-");
+      snprintf(trend_str, sizeof(trend_str), "%8s", "-");
+    }
+
+    if (forecast->numErrors > 0)
+    {
+      snprintf(mae_str, sizeof(mae_str), "%8.2f", forecast->absErrorSum / forecast->numErrors);
+      snprintf(bias_str, sizeof(bias_str), "%8.2f", forecast->errorSum / forecast->numErrors);
+    }
+    else
+    {
+      snprintf(mae_str, sizeof(mae_str), "%8s", "-");
+      snprintf(bias_str, sizeof(bias_str), "%8s", "-");
+    }
+
+    console_args->writeFun("| %-20s | %7u | %2s | %17s | %6u | %8s | %8s | %8u | %5s | %8s | %8s | %8u |\n",
+        driver->vbDriverID,
+        driver->clusterId,
+        VbNodeTypeToStr(node->type),
+        node->MACStr,
+        node->trafficReports.neededL2Xput,
+        level_str,
+        trend_str,
+        VbEngineTrafficForecastDemandGet(&node->trafficReports),
+        forecast->burst?"YES":"NO",
+        mae_str,
+        bias_str,
+        forecast->numErrors);
+  }
+
+  return ret;
+}
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+void VbEngineTrafficForecastUpdate(t_trafficReport *trafficReport)
+{
+  const t_vbEngineTrafficForecastConf *conf = VbEngineConfTrafficForecastGet();
+
+  if (trafficReport != NULL)
+  {
+    if (conf->enable == TRUE)
+    {
+      TrafficForecastRun(conf, trafficReport);
+    }
+    else
+    {
+      // Restart model from scratch when enabled again
+      trafficReport->forecast.valid = FALSE;
+      trafficReport->forecast.burst = FALSE;
+      trafficReport->forecast.pendingValid = FALSE;
+    }
+  }
+}
+
+/*******************************************************************/
+
+INT16U VbEngineTrafficForecastDemandGet(const t_trafficReport *trafficReport)
+{
+  const t_vbEngineTrafficForecastConf *conf = VbEngineConfTrafficForecastGet();
+  INT16U                               demand = 0;
+
+  if (trafficReport != NULL)
+  {
+    demand = trafficReport->neededL2Xput;
+
+    if ((conf->enable == TRUE) && (trafficReport->forecast.valid == TRUE))
+    {
+      demand = MAX(demand, trafficReport->forecast.demand);
+    }
+  }
+
+  return demand;
+}
+
+/*******************************************************************/
+
+BOOL VbEngineTrafficForecastConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  const t_vbEngineTrafficForecastConf *conf = VbEngineConfTrafficForecastGet();
+  t_trafficForecastConsoleArgs         console_args;
+
+  console_args.writeFun = writeFun;
+
+  writeFun("Traffic forecast : %s (horizon %u s, alpha %u%%, beta %u%%, gamma %u%%, %u season slots, burst thr %u.%02u, burst hold %u s)\n",
+      (conf->enable == TRUE)?"ENABLED":"DISABLED",
+      conf->horizon,
+      conf->alpha,
+      conf->beta,
+      conf->gamma,
+      conf->seasonSlots,
+      conf->burstThr / 100, conf->burstThr % 100,
+      conf->burstHold);
+
+  writeFun("===============================================================================================================================================\n");
+  writeFun("| %-20s | %7s | %2s | %17s | %6s | %8s | %8s | %8s | %5s | %8s | %8s | %8s |\n",
+      "Driver Id", "Cluster", "Ty", "MAC", "Actual", "Level", "Trend", "Forecast", "Burst", "MAE", "Bias", "Scored");
+  writeFun("===============================================================================================================================================\n");
+  VbEngineDatamodelAllNodesLoop(TrafficForecastConsoleNodeCb, &console_args);
+  writeFun("===============================================================================================================================================\n");
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
@@ -0,0 +1,122 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost_engine
+ * @{
+ **/
+
+/**
+ * @file vb_engine_traffic_forecast.h
+ * @brief Per node traffic demand forecast
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_TRAFFIC_FORECAST_H_
+#define VB_ENGINE_TRAFFIC_FORECAST_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_HORIZON         (10)    // s
+#define VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_ALPHA           (30)    // %
+#define VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_BETA            (10)    // %
+#define VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_GAMMA           (10)    // %
+#define VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_SEASON_SLOTS    (24)
+#define VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_BURST_THR       (300)   // Hundredths of mean deviation
+#define VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_BURST_HOLD      (30)    // s
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  BOOLEAN  enable;                       ///< Provision boost with forecast demand
+  INT32U   horizon;                      ///< Forecast horizon (s)
+  INT32U   alpha;                        ///< Level smoothing factor (%)
+  INT32U   beta;                         ///< Trend smoothing factor (%)
+  INT32U   gamma;                        ///< Seasonal smoothing factor (%)
+  INT32U   seasonSlots;                  ///< Time of day slots of the seasonal profile (0 to disable seasonality)
+  INT32U   burstThr;                     ///< One step error that starts a burst (hundredths of mean deviation)
+  INT32U   burstHold;                    ///< Time the burst peak is provisioned (s)
+} t_vbEngineTrafficForecastConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Updates the forecast model of a node with its last traffic report.
+ * Shall be called with driver domains locked, once neededL2Xput has been updated.
+ * @param[in,out] trafficReport Traffic report of the node
+ **/
+void VbEngineTrafficForecastUpdate(t_trafficReport *trafficReport);
+
+/**
+ * @brief Gets the demand to provision for a node: the largest of the current demand
+ * and the forecast demand at horizon. Current demand if forecast is disabled.
+ * Shall be called with driver domains locked.
+ * @param[in] trafficReport Traffic report of the node
+ * @return Demand (Mbps)
+ **/
+INT16U VbEngineTrafficForecastDemandGet(const t_trafficReport *trafficReport);
+
+/**
+ * @brief Console command to compare forecast and actual demand
+ **/
+BOOL VbEngineTrafficForecastConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_TRAFFIC_FORECAST_H_ */
+
+/**
+ * @}
+ **/
@@ -1361,9 +1361,9 @@ static t_VB_engineErrorCode NextReferenceNodeGet(t_domain **domain, INT32U clust
       {
         t_VB_engineErrorCode  vb_err;
         t_domain             *target_domain;
-        INT8U                *prio_mac;
+        INT8U                 prio_mac[ETH_ALEN];
 
-        vb_err = VbEngineConfAlignPrioRefItemGet(idx, &prio_mac);
+        vb_err = VbEngineConfAlignPrioRefItemGet(idx, prio_mac);
 
         if (vb_err == VB_ENGINE_ERROR_NONE)
         {
@@ -2543,25 +2543,11 @@ static BOOLEAN VbEngineAutomaticSeedIsMacAllowed (INT8U  *dm_mac_ptr)
   {
     allowed = FALSE;
   }
-  else if (VbEngineConfSeedExcludedMacListGet() != NULL)
+  else if (VbEngineConfSeedMacIsExcluded(dm_mac_ptr) == TRUE)
   {
-    INT16U idx;
-    INT8U  *excluded_mac_ptr;
-
-    for (idx = 0; idx < VbEngineConfSeedExcludedMacListSizeGet(); idx++)
-    {
-      // Set pointer to excluded MAC list
-      excluded_mac_ptr = VbEngineConfSeedExcludedMacListGet() + (ETH_ALEN * idx);
-
-      // Check if DM MAC matches with an excluded MAC
-      if ((excluded_mac_ptr != NULL) && (memcmp(excluded_mac_ptr, dm_mac_ptr, ETH_ALEN) == 0))
-      {
-        VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "%X:%X:%X:%X:%X:%X excluded from automatic seed",
-            dm_mac_ptr[0],dm_mac_ptr[1], dm_mac_ptr[2],dm_mac_ptr[3],dm_mac_ptr[4],dm_mac_ptr[5]);
-        allowed = FALSE;
-        break;
-      }
-    }
+    VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "%X:%X:%X:%X:%X:%X excluded from automatic seed",
+        dm_mac_ptr[0],dm_mac_ptr[1], dm_mac_ptr[2],dm_mac_ptr[3],dm_mac_ptr[4],dm_mac_ptr[5]);
+    allowed = FALSE;
   }
 
   return allowed;
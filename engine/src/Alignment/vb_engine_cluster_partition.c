@@ -0,0 +1,961 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost_engine
+ * @{
+ **/
+
+/**
+ * @file vb_engine_cluster_partition.c
+ * @brief Crosstalk based cluster partitioning
+ *
+ * @internal
+ *
+ * Vertices of the interference graph are the drivers of a cluster. The weight
+ * of an edge is the crosstalk both drivers inject into each other, as the sum
+ * over victim nodes of the linearized peak crosstalk to BGN ratio. The graph
+ * is recursively split by its minimum cut (Stoer-Wagner) while the cut weight
+ * is under CouplingThr or the group exceeds MaxLines.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_drivers_list.h"
+#include "vb_engine_cluster_list.h"
+#include "vb_engine_process.h"
+#include "vb_engine_xtalk_sparsity.h"
+#include "vb_engine_cluster_partition.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_CLUSTER_PARTITION_NONE                 (MAX_INT32U)
+#define VB_CLUSTER_PARTITION_COUPLING_MIN_DB      (-100.0)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  CHAR    driverId[VB_EA_DRIVER_ID_MAX_SIZE];
+  INT32U  numLines;
+  INT32U  numVictims;                    ///< Nodes with measures (0: driver out of the analysis)
+  INT32U  part;
+} t_clusterPartitionDriver;
+
+typedef struct
+{
+  INT32U                    numDrivers;
+  INT32U                    numParts;
+  INT32U                    keptPart;    ///< Part that stays in the cluster
+  float                     cutWeight;   ///< Coupling between parts (linear, relative to BGN)
+  BOOLEAN                   applied;
+  t_clusterPartitionDriver *drivers;
+  float                    *coupling;    ///< numDrivers x numDrivers symmetric matrix
+} t_clusterPartition;
+
+typedef struct
+{
+  INT8U   MAC[ETH_ALEN];
+  INT32U  driverIdx;
+} t_clusterPartitionMac;
+
+typedef struct
+{
+  INT32U                  numDrivers;
+  INT32U                  maxDrivers;
+  t_VBDriver            **drivers;
+  INT32U                  numMacs;
+  INT32U                  maxMacs;
+  t_clusterPartitionMac  *macs;
+  t_clusterPartition     *partition;
+} t_clusterPartitionArgs;
+
+typedef struct
+{
+  t_writeFun writeFun;
+} t_clusterPartitionConsoleArgs;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static pthread_mutex_t vbEngineClusterPartitionMutex = PTHREAD_MUTEX_INITIALIZER;
+static struct timespec vbEngineClusterPartitionLastApply;
+static BOOLEAN         vbEngineClusterPartitionAppliedOnce = FALSE;
+
+/*
+ ************************************************************************
+ ** Private function definition
+ ************************************************************************
+ */
+
+static int ClusterPartitionMacCmp(const void *a, const void *b)
+{
+  return memcmp(((const t_clusterPartitionMac *)a)->MAC, ((const t_clusterPartitionMac *)b)->MAC, ETH_ALEN);
+}
+
+/*******************************************************************/
+
+static INT32U ClusterPartitionDriverIdxGet(t_clusterPartitionArgs *partArgs, t_VBDriver *driver)
+{
+  INT32U idx = VB_CLUSTER_PARTITION_NONE;
+  INT32U i;
+
+  for (i = 0; i < partArgs->numDrivers; i++)
+  {
+    if (partArgs->drivers[i] == driver)
+    {
+      idx = i;
+      break;
+    }
+  }
+
+  return idx;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode ClusterPartitionDriverCollectCb(t_VBDriver *driver, void *args)
+{
+  t_VB_engineErrorCode    ret = VB_ENGINE_ERROR_NONE;
+  t_clusterPartitionArgs *part_args = (t_clusterPartitionArgs *)args;
+
+  if ((driver == NULL) || (part_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (part_args->numDrivers < part_args->maxDrivers)
+  {
+    part_args->drivers[part_args->numDrivers++] = driver;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode ClusterPartitionMacCollectCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode    ret = VB_ENGINE_ERROR_NONE;
+  t_clusterPartitionArgs *part_args = (t_clusterPartitionArgs *)args;
+  INT32U                  driver_idx;
+
+  if ((driver == NULL) || (node == NULL) || (part_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (part_args->numMacs < part_args->maxMacs)
+  {
+    driver_idx = ClusterPartitionDriverIdxGet(part_args, driver);
+
+    if (driver_idx != VB_CLUSTER_PARTITION_NONE)
+    {
+      memcpy(part_args->macs[part_args->numMacs].MAC, node->MAC, ETH_ALEN);
+      part_args->macs[part_args->numMacs].driverIdx = driver_idx;
+      part_args->numMacs++;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode ClusterPartitionCouplingCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode    ret = VB_ENGINE_ERROR_NONE;
+  t_clusterPartitionArgs *part_args = (t_clusterPartitionArgs *)args;
+  t_clusterPartition     *partition;
+  t_processMeasure       *bgn_measure;
+  t_crossMeasureList     *cfr_measure_list;
+  t_crossMeasure         *cross_measure;
+  t_clusterPartitionMac   key;
+  t_clusterPartitionMac  *found;
+  INT32U                  victim_idx;
+  INT32U                  i;
+  float                   margin;
+
+  if ((driver == NULL) || (node == NULL) || (part_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    partition = part_args->partition;
+    bgn_measure = &node->measures.BGNMeasure;
+    cfr_measure_list = &node->measures.CFRMeasureList;
+    victim_idx = ClusterPartitionDriverIdxGet(part_args, driver);
+
+    if ((victim_idx != VB_CLUSTER_PARTITION_NONE) &&
+        (bgn_measure->measuresRx1 != NULL) &&
+        (bgn_measure->numMeasures > 0) &&
+        (cfr_measure_list->crossMeasureArray != NULL) &&
+        (cfr_measure_list->numCrossMeasures > 0))
+    {
+      partition->drivers[victim_idx].numVictims++;
+
+      for (i = 0; i < cfr_measure_list->numCrossMeasures; i++)
+      {
+        cross_measure = &cfr_measure_list->crossMeasureArray[i];
+
+        if (cross_measure->ownCFR == FALSE)
+        {
+          memcpy(key.MAC, cross_measure->MAC, ETH_ALEN);
+          found = (t_clusterPartitionMac *)bsearch(&key, part_args->macs, part_args->numMacs,
+                                                   sizeof(t_clusterPartitionMac), ClusterPartitionMacCmp);
+
+          if ((found != NULL) && (found->driverIdx != victim_idx) &&
+              (VbEngineXtalkMarginGet(bgn_measure, &cross_measure->measure, &margin) == TRUE))
+          {
+            // Accumulated as disturber -> victim, symmetrized later
+            partition->coupling[(found->driverIdx * partition->numDrivers) + victim_idx] += powf(10, margin / 10);
+          }
+        }
+      }
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Stoer-Wagner global minimum cut of a group of drivers
+ * @param[in] partition Partition info (coupling matrix)
+ * @param[in] members Driver indexes of the group
+ * @param[in] numMembers Number of drivers in group
+ * @param[out] side TRUE for members on one side of the cut
+ * @param[out] cutWeight Weight of the cut
+ * @return @ref t_VB_engineErrorCode
+ **/
+static t_VB_engineErrorCode ClusterPartitionMinCutGet(const t_clusterPartition *partition, const INT32U *members,
+                                                      INT32U numMembers, BOOLEAN *side, float *cutWeight)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  float               *graph;
+  float               *conn;
+  INT32U              *rep;
+  BOOLEAN             *merged;
+  BOOLEAN             *added;
+  INT32U               phase;
+  INT32U               step;
+  INT32U               v;
+  INT32U               prev = 0;
+  INT32U               last = 0;
+  float                best = INFINITY;
+
+  graph = (float *)malloc(numMembers * numMembers * sizeof(float));
+  conn = (float *)malloc(numMembers * sizeof(float));
+  rep = (INT32U *)malloc(numMembers * sizeof(INT32U));
+  merged = (BOOLEAN *)calloc(numMembers, sizeof(BOOLEAN));
+  added = (BOOLEAN *)malloc(numMembers * sizeof(BOOLEAN));
+
+  if ((graph == NULL) || (conn == NULL) || (rep == NULL) || (merged == NULL) || (added == NULL))
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    for (v = 0; v < numMembers; v++)
+    {
+      INT32U u;
+
+      for (u = 0; u < numMembers; u++)
+      {
+        graph[(v * numMembers) + u] = partition->coupling[(members[v] * partition->numDrivers) + members[u]];
+      }
+
+      rep[v] = v;
+    }
+
+    for (phase = 0; phase < (numMembers - 1); phase++)
+    {
+      memset(added, 0, numMembers * sizeof(BOOLEAN));
+      memset(conn, 0, numMembers * sizeof(float));
+
+      // Add vertices in order of connectivity to the growing set
+      for (step = 0; step < (numMembers - phase); step++)
+      {
+        INT32U sel = VB_CLUSTER_PARTITION_NONE;
+
+        for (v = 0; v < numMembers; v++)
+        {
+          if ((merged[v] == FALSE) && (added[v] == FALSE) &&
+              ((sel == VB_CLUSTER_PARTITION_NONE) || (conn[v] > conn[sel])))
+          {
+            sel = v;
+          }
+        }
+
+        added[sel] = TRUE;
+        prev = last;
+        last = sel;
+
+        for (v = 0; v < numMembers; v++)
+        {
+          if ((merged[v] == FALSE) && (added[v] == FALSE))
+          {
+            conn[v] += graph[(sel * numMembers) + v];
+          }
+        }
+      }
+
+      // Cut of the phase separates last added vertex from the rest
+      if (conn[last] < best)
+      {
+        best = conn[last];
+        for (v = 0; v < numMembers; v++)
+        {
+          side[v] = (rep[v] == last)?TRUE:FALSE;
+        }
+      }
+
+      // Merge last into previous
+      for (v = 0; v < numMembers; v++)
+      {
+        graph[(prev * numMembers) + v] += graph[(last * numMembers) + v];
+        graph[(v * numMembers) + prev] = graph[(prev * numMembers) + v];
+        if (rep[v] == last)
+        {
+          rep[v] = prev;
+        }
+      }
+      merged[last] = TRUE;
+    }
+
+    *cutWeight = best;
+  }
+
+  free(graph);
+  free(conn);
+  free(rep);
+  free(merged);
+  free(added);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode ClusterPartitionSplit(t_clusterPartition *partition, const INT32U *members, INT32U numMembers,
+                                                  float couplingThr, INT32U maxLines)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  BOOLEAN             *side = NULL;
+  INT32U              *groups = NULL;
+  INT32U               num_lines = 0;
+  INT32U               num_side = 0;
+  INT32U               num_groups;
+  INT32U               i;
+  float                cut_weight = INFINITY;
+  BOOLEAN              split = FALSE;
+
+  for (i = 0; i < numMembers; i++)
+  {
+    num_lines += partition->drivers[members[i]].numLines;
+  }
+
+  if (numMembers > 1)
+  {
+    side = (BOOLEAN *)malloc(numMembers * sizeof(BOOLEAN));
+    groups = (INT32U *)malloc(numMembers * sizeof(INT32U));
+
+    if ((side == NULL) || (groups == NULL))
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      ret = ClusterPartitionMinCutGet(partition, members, numMembers, side, &cut_weight);
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      split = ((cut_weight <= couplingThr) || ((maxLines > 0) && (num_lines > maxLines)))?TRUE:FALSE;
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (split == TRUE))
+  {
+    // Cut side first, rest after
+    for (i = 0; i < numMembers; i++)
+    {
+      if (side[i] == TRUE)
+      {
+        groups[num_side++] = members[i];
+      }
+    }
+
+    num_groups = num_side;
+    for (i = 0; i < numMembers; i++)
+    {
+      if (side[i] == FALSE)
+      {
+        groups[num_groups++] = members[i];
+      }
+    }
+
+    ret = ClusterPartitionSplit(partition, groups, num_side, couplingThr, maxLines);
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      ret = ClusterPartitionSplit(partition, groups + num_side, numMembers - num_side, couplingThr, maxLines);
+    }
+  }
+  else if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    for (i = 0; i < numMembers; i++)
+    {
+      partition->drivers[members[i]].part = partition->numParts;
+    }
+    partition->numParts++;
+  }
+
+  free(side);
+  free(groups);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_clusterPartition *ClusterPartitionAlloc(INT32U numDrivers)
+{
+  t_clusterPartition *partition;
+  size_t              size;
+
+  // Single block, so the cluster can release it with a plain free()
+  size = sizeof(t_clusterPartition) +
+         (numDrivers * sizeof(t_clusterPartitionDriver)) +
+         (numDrivers * numDrivers * sizeof(float));
+
+  partition = (t_clusterPartition *)calloc(1, size);
+
+  if (partition != NULL)
+  {
+    partition->numDrivers = numDrivers;
+    partition->drivers = (t_clusterPartitionDriver *)(partition + 1);
+    partition->coupling = (float *)(partition->drivers + numDrivers);
+  }
+
+  return partition;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode ClusterPartitionCompute(t_clusterPartition *partition, const t_vbEngineClusterPartitionConf *conf)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT32U              *members;
+  INT32U              *part_lines = NULL;
+  INT32U               num_members = 0;
+  INT32U               a;
+  INT32U               b;
+  float                w;
+
+  members = (INT32U *)malloc(partition->numDrivers * sizeof(INT32U));
+
+  if (members == NULL)
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    for (a = 0; a < partition->numDrivers; a++)
+    {
+      for (b = a + 1; b < partition->numDrivers; b++)
+      {
+        w = partition->coupling[(a * partition->numDrivers) + b] + partition->coupling[(b * partition->numDrivers) + a];
+        partition->coupling[(a * partition->numDrivers) + b] = w;
+        partition->coupling[(b * partition->numDrivers) + a] = w;
+      }
+
+      partition->drivers[a].part = VB_CLUSTER_PARTITION_NONE;
+
+      // Drivers without measures are kept where they are
+      if (partition->drivers[a].numVictims > 0)
+      {
+        members[num_members++] = a;
+      }
+    }
+
+    ret = ClusterPartitionSplit(partition, members, num_members,
+                                powf(10, -(float)conf->couplingThr / 10), conf->maxLines);
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (partition->numParts > 1))
+  {
+    part_lines = (INT32U *)calloc(partition->numParts, sizeof(INT32U));
+
+    if (part_lines == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (partition->numParts > 1))
+  {
+    for (a = 0; a < partition->numDrivers; a++)
+    {
+      if (partition->drivers[a].part != VB_CLUSTER_PARTITION_NONE)
+      {
+        part_lines[partition->drivers[a].part] += partition->drivers[a].numLines;
+      }
+    }
+
+    partition->keptPart = 0;
+    for (a = 1; a < partition->numParts; a++)
+    {
+      if (part_lines[a] > part_lines[partition->keptPart])
+      {
+        partition->keptPart = a;
+      }
+    }
+
+    partition->cutWeight = 0;
+    for (a = 0; a < partition->numDrivers; a++)
+    {
+      for (b = a + 1; b < partition->numDrivers; b++)
+      {
+        if ((partition->drivers[a].part != VB_CLUSTER_PARTITION_NONE) &&
+            (partition->drivers[b].part != VB_CLUSTER_PARTITION_NONE) &&
+            (partition->drivers[a].part != partition->drivers[b].part))
+        {
+          partition->cutWeight += partition->coupling[(a * partition->numDrivers) + b];
+        }
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    for (a = 0; a < partition->numDrivers; a++)
+    {
+      if (partition->drivers[a].part == VB_CLUSTER_PARTITION_NONE)
+      {
+        partition->drivers[a].part = partition->keptPart;
+      }
+    }
+  }
+
+  free(members);
+  free(part_lines);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static float ClusterPartitionDbGet(float linear)
+{
+  return (linear > 0)?(10 * log10f(linear)):VB_CLUSTER_PARTITION_COUPLING_MIN_DB;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode ClusterPartitionConsoleCb(t_VBCluster *cluster, void *args)
+{
+  t_VB_engineErrorCode           ret = VB_ENGINE_ERROR_NONE;
+  t_clusterPartitionConsoleArgs *console_args = (t_clusterPartitionConsoleArgs *)args;
+  t_clusterPartition            *partition;
+  t_clusterPartitionDriver      *part_driver;
+  INT32U                         a;
+  INT32U                         b;
+  float                          inner;
+  float                          outer;
+
+  if ((cluster == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbEngineClusterPartitionMutex);
+
+    partition = (t_clusterPartition *)cluster->partitionData;
+
+    if (partition == NULL)
+    {
+      console_args->writeFun("Cluster %u : no analysis\n", cluster->clusterInfo.clusterId);
+    }
+    else
+    {
+      console_args->writeFun("Cluster %u : %u drivers; %u groups; cut coupling %.1f dB%s\n",
+          cluster->clusterInfo.clusterId,
+          partition->numDrivers,
+          partition->numParts,
+          ClusterPartitionDbGet(partition->cutWeight),
+          (partition->applied == TRUE)?" (applied)":"");
+
+      console_args->writeFun("| %-20s | %5s | %7s | %5s | %12s | %12s |\n",
+          "Driver", "Lines", "Victims", "Group", "Inner (dB)", "Outer (dB)");
+
+      for (a = 0; a < partition->numDrivers; a++)
+      {
+        part_driver = &partition->drivers[a];
+        inner = 0;
+        outer = 0;
+
+        for (b = 0; b < partition->numDrivers; b++)
+        {
+          if (b != a)
+          {
+            if (partition->drivers[b].part == part_driver->part)
+            {
+              inner += partition->coupling[(a * partition->numDrivers) + b];
+            }
+            else
+            {
+              outer += partition->coupling[(a * partition->numDrivers) + b];
+            }
+          }
+        }
+
+        console_args->writeFun("| %-20s | %5u | %7u | %4u%s | %12.1f | %12.1f |\n",
+            part_driver->driverId,
+            part_driver->numLines,
+            part_driver->numVictims,
+            part_driver->part,
+            (part_driver->part == partition->keptPart)?"*":" ",
+            ClusterPartitionDbGet(inner),
+            ClusterPartitionDbGet(outer));
+      }
+    }
+
+    pthread_mutex_unlock(&vbEngineClusterPartitionMutex);
+  }
+
+  return ret;
+}
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+t_VB_engineErrorCode VbEngineClusterPartitionAnalyze(INT32U clusterId)
+{
+  t_VB_engineErrorCode                  ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineClusterPartitionConf *conf = VbEngineConfClusterPartitionGet();
+  t_clusterPartitionArgs                part_args;
+  t_vbEngineNumNodes                    num_nodes;
+  t_VBCluster                          *cluster = NULL;
+  void                                 *old_partition = NULL;
+  INT32U                                i;
+
+  memset(&part_args, 0, sizeof(part_args));
+
+  if (conf == NULL)
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (conf->enable == FALSE)
+  {
+    ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineClusterByIdGet(clusterId, &cluster);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    part_args.maxDrivers = VbEngineDataModelNumDriversInCLusterXGet(clusterId);
+    ret = VbEngineDataModelNumNodesInClusterXGet(clusterId, &num_nodes);
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (part_args.maxDrivers < 2))
+  {
+    // Nothing to split
+    ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    part_args.maxMacs = num_nodes.numDms + num_nodes.numEps;
+    part_args.drivers = (t_VBDriver **)malloc(part_args.maxDrivers * sizeof(t_VBDriver *));
+    part_args.macs = (t_clusterPartitionMac *)malloc(MAX(1, part_args.maxMacs) * sizeof(t_clusterPartitionMac));
+
+    if ((part_args.drivers == NULL) || (part_args.macs == NULL))
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineDatamodelClusterXDriversLoop(ClusterPartitionDriverCollectCb, clusterId, &part_args);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineDatamodelClusterXAllNodesLoop(ClusterPartitionMacCollectCb, clusterId, &part_args);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    qsort(part_args.macs, part_args.numMacs, sizeof(t_clusterPartitionMac), ClusterPartitionMacCmp);
+
+    part_args.partition = ClusterPartitionAlloc(part_args.numDrivers);
+
+    if (part_args.partition == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    for (i = 0; (i < part_args.numDrivers) && (ret == VB_ENGINE_ERROR_NONE); i++)
+    {
+      snprintf(part_args.partition->drivers[i].driverId, sizeof(part_args.partition->drivers[i].driverId), "%s", part_args.drivers[i]->vbDriverID);
+
+      ret = VbEngineDatamodelNumNodesInDriverGet(part_args.drivers[i], &num_nodes);
+      part_args.partition->drivers[i].numLines = num_nodes.numCompleteLines;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineDatamodelClusterXAllNodesLoop(ClusterPartitionCouplingCb, clusterId, &part_args);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = ClusterPartitionCompute(part_args.partition, conf);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    if (part_args.partition->numParts > 1)
+    {
+      VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Cluster %u: %u weakly coupled groups found (cut coupling %.1f dB)",
+          clusterId, part_args.partition->numParts, ClusterPartitionDbGet(part_args.partition->cutWeight));
+    }
+
+    pthread_mutex_lock(&vbEngineClusterPartitionMutex);
+    old_partition = cluster->partitionData;
+    cluster->partitionData = part_args.partition;
+    pthread_mutex_unlock(&vbEngineClusterPartitionMutex);
+
+    part_args.partition = NULL;
+  }
+
+  free(old_partition);
+  free(part_args.partition);
+  free(part_args.drivers);
+  free(part_args.macs);
+
+  if (ret == VB_ENGINE_ERROR_EXIT_LOOP_OK)
+  {
+    ret = VB_ENGINE_ERROR_NONE;
+  }
+  else if (ret != VB_ENGINE_ERROR_NONE)
+  {
+    VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Cluster %u: partition analysis error %d", clusterId, ret);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineClusterPartitionApply(INT32U clusterId, BOOLEAN *applied)
+{
+  t_VB_engineErrorCode                  ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineClusterPartitionConf *conf = VbEngineConfClusterPartitionGet();
+  t_VBAlignmentMode                     align_mode = VB_ALIGN_MODE_LAST;
+  t_VBCluster                          *cluster = NULL;
+  t_clusterPartition                   *partition;
+  t_VBDriver                           *driver;
+  struct timespec                       now;
+  INT32U                                num_moved = 0;
+  INT32U                                i;
+
+  if ((conf == NULL) || (applied == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else
+  {
+    *applied = FALSE;
+
+    if ((conf->enable == FALSE) || (conf->apply == FALSE) || (clusterId == 0))
+    {
+      ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineConfAlignmentModeGet(&align_mode);
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (align_mode == VB_ALIGN_MODE_GHN))
+  {
+    // G.hn alignment only keeps TX enabled in the biggest cluster
+    ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    if ((vbEngineClusterPartitionAppliedOnce == TRUE) &&
+        ((now.tv_sec - vbEngineClusterPartitionLastApply.tv_sec) < (time_t)conf->holdTime))
+    {
+      ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineClusterByIdGet(clusterId, &cluster);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbEngineClusterPartitionMutex);
+
+    partition = (t_clusterPartition *)cluster->partitionData;
+
+    if ((partition != NULL) && (partition->numParts > 1) && (partition->applied == FALSE))
+    {
+      // Drivers out of the biggest group go back to cluster 0, next alignment builds their cluster
+      for (i = 0; i < partition->numDrivers; i++)
+      {
+        if ((partition->drivers[i].part != partition->keptPart) &&
+            (VbEngineDriverByIdGet(partition->drivers[i].driverId, &driver) == VB_ENGINE_ERROR_NONE) &&
+            (driver->clusterId == (INT32S)clusterId))
+        {
+          driver->clusterId = 0;
+          num_moved++;
+        }
+      }
+
+      partition->applied = TRUE;
+    }
+
+    pthread_mutex_unlock(&vbEngineClusterPartitionMutex);
+
+    if (num_moved == 0)
+    {
+      ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    VbLogPrintExt(VB_LOG_WARNING, VB_ENGINE_ALL_DRIVERS_STR, "Cluster %u: splitting %u weakly coupled drivers to a new cluster",
+        clusterId, num_moved);
+
+    vbEngineClusterPartitionLastApply = now;
+    vbEngineClusterPartitionAppliedOnce = TRUE;
+    *applied = TRUE;
+
+    ret = VbEngineProcessClusterXDriversEvSend(ENGINE_EV_ALIGN_CLUSTER_I, NULL, clusterId);
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      ret = VbEngineProcessClusterXDriversEvSend(ENGINE_EV_ALIGN_CLUSTER_I, NULL, 0);
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_EXIT_LOOP_OK)
+  {
+    ret = VB_ENGINE_ERROR_NONE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOL VbEngineClusterPartitionConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  const t_vbEngineClusterPartitionConf *conf = VbEngineConfClusterPartitionGet();
+  t_clusterPartitionConsoleArgs         console_args;
+
+  console_args.writeFun = writeFun;
+
+  writeFun("Cluster partition : %s; apply %s (threshold %u dB, max lines %u, hold time %u s)\n",
+      (conf->enable == TRUE)?"ENABLED":"DISABLED",
+      (conf->apply == TRUE)?"YES":"NO",
+      conf->couplingThr,
+      conf->maxLines,
+      conf->holdTime);
+  writeFun("Group marked with * stays in cluster; Inner/Outer: coupling with drivers of the same/other groups\n");
+
+  VbEngineDatamodelClustersLoop(ClusterPartitionConsoleCb, &console_args);
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
@@ -0,0 +1,121 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost_engine
+ * @{
+ **/
+
+/**
+ * @file vb_engine_cluster_partition.h
+ * @brief Crosstalk based cluster partitioning
+ *
+ * @internal
+ *
+ * Builds a driver interference graph from the CFR measures of a cluster and
+ * splits it (minimum cut) into groups of drivers that barely couple. The
+ * proposal can be applied, moving the split drivers to a new cluster.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_CLUSTER_PARTITION_H_
+#define VB_ENGINE_CLUSTER_PARTITION_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_CLUSTER_PARTITION_DEFAULT_COUPLING_THR   (20)    // dB below BGN
+#define VB_ENGINE_CLUSTER_PARTITION_DEFAULT_MAX_LINES      (0)     // No limit
+#define VB_ENGINE_CLUSTER_PARTITION_DEFAULT_HOLD_TIME      (600)   // Seconds
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  BOOLEAN  enable;                       ///< Analyse coupling after each computation
+  BOOLEAN  apply;                        ///< Apply proposed splits (otherwise only reported)
+  INT32U   couplingThr;                  ///< Groups whose crosstalk is this many dB below BGN (or more) are independent
+  INT32U   maxLines;                     ///< Maximum lines per cluster (0: no limit)
+  INT32U   holdTime;                     ///< Minimum time between applied splits (seconds)
+} t_vbEngineClusterPartitionConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Builds the driver coupling graph of a cluster from its current measures and computes a partition proposal.
+ * Shall be called once SNR of the cluster has been computed.
+ * @param[in] clusterId Cluster Id
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineClusterPartitionAnalyze(INT32U clusterId);
+
+/**
+ * @brief Applies the pending partition proposal of a cluster, if enabled and allowed.
+ * Drivers out of the biggest group are moved to cluster 0 and both clusters are realigned,
+ * so a new cluster is built with them. Shall be called from engine process thread.
+ * @param[in] clusterId Cluster Id
+ * @param[out] applied TRUE if cluster has been split and realignment requested
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineClusterPartitionApply(INT32U clusterId, BOOLEAN *applied);
+
+/**
+ * @brief Console command to show cluster partition proposals
+ **/
+BOOL VbEngineClusterPartitionConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_CLUSTER_PARTITION_H_ */
+
+/**
+ * @}
+ **/
@@ -52,6 +52,7 @@
 
 #include "types.h"
 #include <time.h>
+#include <math.h>
 #include <pthread.h>
 #include <strings.h>
 
@@ -65,6 +66,7 @@
 #include "vb_engine_drivers_list.h"
 #include "vb_engine_cluster_list.h"
 #include "vb_engine_process.h"
+#include "vb_engine_conf.h"
 
 /*
  ************************************************************************
@@ -79,10 +81,19 @@
  */
 
 #define CLOCK_TASK_NAME                  ("ClockMonitor")
-#define CLOCK_FUTURE_FIXED_GUARD         (500)   // In msec
-#define CLOCK_WAIT_RSP                   (2000)  // In msec
-#define CLOCK_UPDATE_INTERVAL            (60000) // In msec
-#define CLOCK_MAX_DEV_SPAN               (20)    // In msec
+#define CLOCK_WAIT_RSP                   (2000)   // In msec
+#define CLOCK_UPDATE_INTERVAL            (60000)  // In msec (NTP deviation check period)
+#define CLOCK_MAX_DEV_SPAN               (20)     // In msec
+#define CLOCK_POLL_TICK                  (5000)   // In msec
+#define CLOCK_POLL_MIN_INTERVAL          (5000)   // In msec
+#define CLOCK_POLL_MAX_INTERVAL          (120000) // In msec
+#define CLOCK_MODEL_MIN_SAMPLES          (3)
+#define CLOCK_MODEL_TARGET_ERR           (1000)   // In usec. Poll faster if predicted error is bigger
+#define CLOCK_MODEL_MAX_DRIFT            (500.0)  // In ppm
+#define CLOCK_MODEL_STEP_ERR             (50000)  // In usec. Offset jump considered a clock step
+#define CLOCK_RTT_OUTLIER_FACTOR         (3)
+#define CLOCK_RTT_OUTLIER_MARGIN         (2000)   // In usec
+#define CLOCK_RTT_MAX_REJECTS            (3)      // Consecutive RTT outliers before restarting the model
 
 /*
  ************************************************************************
@@ -103,8 +114,17 @@ typedef struct
   struct timespec  futureOwnClock;
   INT16U           futureSeqNum;
   BOOLEAN          found;
+  INT64S           refBoundUs;          ///< Error bound of reference driver clock prediction
+  INT64S           maxDeliveryUs;       ///< Max one-way delay to drivers in cluster
+  BOOLEAN          allModelsValid;      ///< All drivers in cluster have a valid clock model
 } t_clockFuture;
 
+typedef struct
+{
+  BOOLEAN          expiredOnly;         ///< Only request clock to drivers whose poll period has expired
+  struct timespec  now;                 ///< Monotonic clock
+} t_clockPoll;
+
 typedef struct
 {
   t_clockStats     stats;
@@ -122,6 +142,7 @@ static timer_t          vbEngineClockMonitorTimer;
 static BOOLEAN          vbEngineClockMonitorRunning = FALSE;
 static t_clockStats     vbEngineClockStats;
 static pthread_mutex_t  vbEngineClockStatsMutex;
+static INT32U           vbEngineClockMonitorTicks;
 
 /*
  ************************************************************************
@@ -153,25 +174,246 @@ static BOOLEAN VbEngineClockMonitorStateGet(void)
 
 static void VbEngineClockMonitor(sigval_t sigval)
 {
-  // Send an event to update the clock from all drivers
-  VbEngineProcessAllDriversEvSend(ENGINE_EV_CLOCK_REQ, NULL);
+  // Send a single event to request the clock of the drivers whose poll period has expired
+  VbEngineProcessAllDriversEvSend(ENGINE_EV_CLOCK_REQ, INT2VOIDP(TRUE));
+
+  vbEngineClockMonitorTicks++;
+
+  if ((vbEngineClockMonitorTicks * CLOCK_POLL_TICK) >= CLOCK_UPDATE_INTERVAL)
+  {
+    vbEngineClockMonitorTicks = 0;
+
+    // Wait to receive Clock responses
+    VbThreadSleep(CLOCK_WAIT_RSP);
+
+    // Check maximum deviation of Drivers time
+    VbEngineClockAllDriversNTPDeviationCheck();
+  }
+}
+
+/*******************************************************************/
+
+static void ClockTimespecUsAdd(const struct timespec *t0, INT64S usec, struct timespec *result)
+{
+  INT64S nsec;
+
+  nsec = (INT64S)t0->tv_nsec + (usec % 1000000LL) * 1000LL;
+  result->tv_sec = t0->tv_sec + (usec / 1000000LL);
+
+  if (nsec < 0)
+  {
+    nsec += 1000000000LL;
+    result->tv_sec--;
+  }
+  else if (nsec >= 1000000000LL)
+  {
+    nsec -= 1000000000LL;
+    result->tv_sec++;
+  }
+
+  result->tv_nsec = nsec;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Returns the error bound (usecs) of a model prediction done elapsedUs after its base clock.
+ * It includes the residual noise, the asymmetry of the best path (up to RTT/2) and the drift uncertainty.
+ **/
+static INT64S ClockModelBoundUs(const t_ClockModel *model, INT64S elapsedUs)
+{
+  double bound;
+
+  bound = (2 * model->residualUs) +
+          (NS_TO_US((double)model->rttMinNs) / 2) +
+          (2 * model->driftErrPpm * fabs((double)elapsedUs) / 1000000.0);
+
+  return (INT64S)ceil(bound);
+}
+
+/*******************************************************************/
+
+static void ClockModelPredict(const t_ClockModel *model, const struct timespec *ownClock, INT64S *offsetUs, INT64S *boundUs)
+{
+  INT64S elapsed_us;
+
+  elapsed_us = VbUtilDiffTimespecUs((struct timespec *)ownClock, (struct timespec *)&(model->baseClock));
+
+  *offsetUs = (INT64S)llround(model->offsetUs + (model->driftPpm * (double)elapsed_us / 1000000.0));
+  *boundUs = ClockModelBoundUs(model, elapsed_us);
+}
+
+/*******************************************************************/
+
+static void ClockModelReset(t_ClockModel *model)
+{
+  INT32U num_rejects = model->numRejects;
+  INT32U num_resets = model->numResets;
+
+  bzero(model, sizeof(*model));
+  model->numRejects = num_rejects;
+  model->numResets = num_resets;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Least squares fit of offset vs own clock over the accepted samples
+ **/
+static void ClockModelFit(t_ClockModel *model)
+{
+  INT32U idx;
+  INT32U n = model->numSamples;
+  double x[VB_ENGINE_CLOCK_MODEL_SAMPLES];
+  double mean_x = 0;
+  double mean_y = 0;
+  double sxx = 0;
+  double sxy = 0;
+  double sse = 0;
+  double slope = 0;
+
+  model->rttMinNs = 0;
+  model->rttMaxNs = 0;
+
+  for (idx = 0; idx < n; idx++)
+  {
+    // Own clock in secs relative to last sample
+    x[idx] = (double)VbUtilDiffTimespecUs(&(model->samples[idx].ownClock), &(model->baseClock)) / 1000000.0;
+    mean_x += x[idx];
+    mean_y += (double)model->samples[idx].offsetUs;
+
+    if ((idx == 0) || (model->samples[idx].rttNs < model->rttMinNs))
+    {
+      model->rttMinNs = model->samples[idx].rttNs;
+    }
+
+    if (model->samples[idx].rttNs > model->rttMaxNs)
+    {
+      model->rttMaxNs = model->samples[idx].rttNs;
+    }
+  }
+
+  mean_x /= n;
+  mean_y /= n;
+
+  for (idx = 0; idx < n; idx++)
+  {
+    sxx += (x[idx] - mean_x) * (x[idx] - mean_x);
+    sxy += (x[idx] - mean_x) * ((double)model->samples[idx].offsetUs - mean_y);
+  }
+
+  if ((n >= 2) && (sxx > 0))
+  {
+    slope = sxy / sxx;
+    slope = MIN(MAX(slope, -CLOCK_MODEL_MAX_DRIFT), CLOCK_MODEL_MAX_DRIFT);
+  }
+
+  model->driftPpm = slope;
+  model->offsetUs = mean_y - (slope * mean_x);
+
+  for (idx = 0; idx < n; idx++)
+  {
+    double err = (double)model->samples[idx].offsetUs - (model->offsetUs + (slope * x[idx]));
+
+    sse += err * err;
+  }
+
+  if ((n > 2) && (sxx > 0))
+  {
+    model->residualUs = sqrt(sse / (n - 2));
+    model->driftErrPpm = model->residualUs / sqrt(sxx);
+  }
+  else
+  {
+    model->residualUs = 0;
+    model->driftErrPpm = CLOCK_MODEL_MAX_DRIFT;
+  }
+
+  model->valid = (n >= CLOCK_MODEL_MIN_SAMPLES)?TRUE:FALSE;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Adds a new clock measure to the model and updates the poll interval of the driver.
+ * Samples with an RTT much bigger than the best one are discarded, as their offset can be biased up to RTT/2.
+ **/
+static void ClockModelSampleAdd(t_ClockModel *model, const struct timespec *ownClock, INT64S offsetUs, INT64S rttNs, const struct timespec *nowMonotonic)
+{
+  BOOLEAN accepted = TRUE;
+  INT32U  poll_interval = model->pollIntervalMs;
+
+  if ((model->valid == TRUE) &&
+      (rttNs > ((CLOCK_RTT_OUTLIER_FACTOR * model->rttMinNs) + US_TO_NS(CLOCK_RTT_OUTLIER_MARGIN))))
+  {
+    model->numRejects++;
+    model->consecutiveRejects++;
+    accepted = FALSE;
+
+    if (model->consecutiveRejects >= CLOCK_RTT_MAX_REJECTS)
+    {
+      // Network path has changed, restart model
+      ClockModelReset(model);
+      accepted = TRUE;
+    }
+  }
+
+  if ((accepted == TRUE) && (model->valid == TRUE))
+  {
+    INT64S predicted_us;
+    INT64S bound_us;
+
+    ClockModelPredict(model, ownClock, &predicted_us, &bound_us);
 
-  // Wait to receive Clock responses
-  VbThreadSleep(CLOCK_WAIT_RSP);
+    if (llabs(offsetUs - predicted_us) > MAX(CLOCK_MODEL_STEP_ERR, 8 * bound_us))
+    {
+      // Driver or own clock has been stepped, restart model
+      ClockModelReset(model);
+      model->numResets++;
+    }
+  }
+
+  if (accepted == TRUE)
+  {
+    model->consecutiveRejects = 0;
+    model->samples[model->nextSample].ownClock = *ownClock;
+    model->samples[model->nextSample].offsetUs = offsetUs;
+    model->samples[model->nextSample].rttNs = rttNs;
+    model->nextSample = (model->nextSample + 1) % VB_ENGINE_CLOCK_MODEL_SAMPLES;
+
+    if (model->numSamples < VB_ENGINE_CLOCK_MODEL_SAMPLES)
+    {
+      model->numSamples++;
+    }
+
+    model->baseClock = *ownClock;
+    ClockModelFit(model);
+  }
 
-  // Check maximum deviation of Drivers time
-  VbEngineClockAllDriversNTPDeviationCheck();
+  // Adapt poll interval to model confidence
+  if ((accepted == TRUE) && (model->valid == TRUE) &&
+      (ClockModelBoundUs(model, MS_TO_US((INT64S)MAX(poll_interval, CLOCK_POLL_MIN_INTERVAL) * 2)) < CLOCK_MODEL_TARGET_ERR))
+  {
+    poll_interval = MIN(MAX(poll_interval, CLOCK_POLL_MIN_INTERVAL) * 2, CLOCK_POLL_MAX_INTERVAL);
+  }
+  else
+  {
+    poll_interval = MAX(poll_interval / 2, CLOCK_POLL_MIN_INTERVAL);
+  }
+
+  model->pollIntervalMs = poll_interval;
+  VbUtilTimespecMsecAdd(nowMonotonic, poll_interval, &(model->nextPollTS));
 }
 
 /*******************************************************************/
 
-static t_VB_engineErrorCode CurrentDriverClockCalc(t_VBDriver *driver, struct timespec *ownCurrClock, struct timespec *driverCurrClock, INT16U *numSeq)
+static t_VB_engineErrorCode CurrentDriverClockCalc(t_VBDriver *driver, struct timespec *ownCurrClock, struct timespec *driverCurrClock, INT16U *numSeq, INT64S *boundUs)
 {
   t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
   struct timespec     own_clock_monotonic;
   INT64S               elapsed_time_in_us;
 
-  if ((driver == NULL) || (ownCurrClock == NULL) || (driverCurrClock == NULL) || (numSeq == NULL))
+  if ((driver == NULL) || (ownCurrClock == NULL) || (driverCurrClock == NULL) || (numSeq == NULL) || (boundUs == NULL))
   {
     ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
   }
@@ -185,7 +427,7 @@ static t_VB_engineErrorCode CurrentDriverClockCalc(t_VBDriver *driver, struct ti
 
     elapsed_time_in_us = VbUtilElapsetimeTimespecUs(&(driver->time.lastClockReqTS), &own_clock_monotonic);
 
-    if (elapsed_time_in_us > (2 * MS_TO_US(CLOCK_UPDATE_INTERVAL)))
+    if (elapsed_time_in_us > (2 * MS_TO_US((INT64S)CLOCK_POLL_MAX_INTERVAL)))
     {
       // Timings out-of-date
       VbLogPrintExt(VB_LOG_ERROR, driver->vbDriverID, "Clock measure out-of-date");
@@ -212,11 +454,25 @@ static t_VB_engineErrorCode CurrentDriverClockCalc(t_VBDriver *driver, struct ti
     // Get own time
     clock_gettime(CLOCK_REALTIME, ownCurrClock);
 
-    // Calculate elapsed time since last driver clock update
-    VbUtilTimespecSubtract(&(driver->time.ownClock), ownCurrClock, &diff);
+    if (driver->time.model.valid == TRUE)
+    {
+      INT64S offset_us;
+
+      // Predict current driver clock from offset / drift model
+      ClockModelPredict(&(driver->time.model), ownCurrClock, &offset_us, boundUs);
+      ClockTimespecUsAdd(ownCurrClock, offset_us, driverCurrClock);
+    }
+    else
+    {
+      // Calculate elapsed time since last driver clock update
+      VbUtilTimespecSubtract(&(driver->time.ownClock), ownCurrClock, &diff);
+
+      // Calculate current driver clock (aprox)
+      VbUtilTimespecAdd(&(driver->time.adjClock), &diff, driverCurrClock);
 
-    // Calculate current driver clock (aprox)
-    VbUtilTimespecAdd(&(driver->time.adjClock), &diff, driverCurrClock);
+      // No model, last measure can be wrong up to RTT/2
+      *boundUs = NS_TO_US(driver->time.rttNs) / 2;
+    }
 
     // Calculate elapsed time from own clock
     elapsed_time_in_ms = VbUtilElapsetimeTimespecMs(driver->time.ownClock, *ownCurrClock);
@@ -236,9 +492,13 @@ static t_VB_engineErrorCode CurrentDriverClockCalc(t_VBDriver *driver, struct ti
 static t_VB_engineErrorCode FutureClockDriverLoopCb(t_VBDriver *driver, void *args)
 {
   t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_clockFuture       *future_params = (t_clockFuture *)args;
   struct timespec     own_curr_clock;
   struct timespec     driver_curr_clock;
   INT16U               driver_curr_seq = 0;
+  INT64S               bound_us = 0;
+  INT64S               delivery_us = 0;
+  BOOLEAN              model_valid = FALSE;
 
   if ((args == NULL) || (driver == NULL))
   {
@@ -257,7 +517,15 @@ static t_VB_engineErrorCode FutureClockDriverLoopCb(t_VBDriver *driver, void *ar
     if (ret == VB_ENGINE_ERROR_NONE)
     {
       // Get current Driver time
-      ret = CurrentDriverClockCalc(driver, &own_curr_clock, &driver_curr_clock, &driver_curr_seq);
+      ret = CurrentDriverClockCalc(driver, &own_curr_clock, &driver_curr_clock, &driver_curr_seq, &bound_us);
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      model_valid = driver->time.model.valid;
+
+      // One-way delay to deliver the change: worst RTT/2 of samples accepted by the model (RTT outliers excluded)
+      delivery_us = NS_TO_US((model_valid == TRUE)?driver->time.model.rttMaxNs:driver->time.rttNs) / 2;
     }
 
     pthread_mutex_unlock(&(driver->time.mutex));
@@ -265,31 +533,22 @@ static t_VB_engineErrorCode FutureClockDriverLoopCb(t_VBDriver *driver, void *ar
 
   if (ret == VB_ENGINE_ERROR_NONE)
   {
-    t_clockFuture *future_params;
-    INT32U         guard_time;
-
-    // Get args
-    future_params = (t_clockFuture *)args;
-
-    pthread_mutex_lock(&vbEngineClockStatsMutex);
-    // Take into account RTT to calculate guard time
-    guard_time = (INT32U)(NS_TO_MS(vbEngineClockStats.maxRtt)) + CLOCK_FUTURE_FIXED_GUARD;
-    pthread_mutex_unlock(&vbEngineClockStatsMutex);
-
-    // Add guard time to current time
-    VbUtilTimespecMsecAdd(&driver_curr_clock, guard_time, &(future_params->futureClock));
-
-    // Add guard time to current Own time
-    VbUtilTimespecMsecAdd(&own_curr_clock, guard_time, &(future_params->futureOwnClock));
-
-    // Calculate seq number
-    future_params->futureSeqNum = driver_curr_seq + (guard_time / MAC_CYCLE_DURATION);
+    if (model_valid == FALSE)
+    {
+      future_params->allModelsValid = FALSE;
+    }
 
-    // Mark as found
-    future_params->found = TRUE;
+    future_params->maxDeliveryUs = MAX(future_params->maxDeliveryUs, delivery_us);
 
-    // Break drivers loop
-    ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+    if (future_params->found == FALSE)
+    {
+      // First valid driver is the time reference
+      future_params->futureClock = driver_curr_clock;
+      future_params->futureOwnClock = own_curr_clock;
+      future_params->futureSeqNum = driver_curr_seq;
+      future_params->refBoundUs = bound_us;
+      future_params->found = TRUE;
+    }
   }
 
   if (ret == VB_ENGINE_ERROR_SKIP)
@@ -306,6 +565,7 @@ static t_VB_engineErrorCode FutureClockDriverLoopCb(t_VBDriver *driver, void *ar
 static t_VB_engineErrorCode ClockMonitorLoopCb(t_VBDriver *driver, void *args)
 {
   t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_clockPoll         *poll_params = (t_clockPoll *)args;
 
   if (driver == NULL)
   {
@@ -320,6 +580,19 @@ static t_VB_engineErrorCode ClockMonitorLoopCb(t_VBDriver *driver, void *args)
     }
   }
 
+  if ((ret == VB_ENGINE_ERROR_NONE) && (poll_params != NULL) && (poll_params->expiredOnly == TRUE))
+  {
+    pthread_mutex_lock(&(driver->time.mutex));
+
+    if (VbUtilTimespecCmp(&(poll_params->now), &(driver->time.model.nextPollTS)) < 0)
+    {
+      // Driver clock model is still accurate enough
+      ret = VB_ENGINE_ERROR_SKIP;
+    }
+
+    pthread_mutex_unlock(&(driver->time.mutex));
+  }
+
   if (ret == VB_ENGINE_ERROR_NONE)
   {
     ret = VbEngineClockRequest(driver);
@@ -467,8 +740,16 @@ t_VB_engineErrorCode    VbEngineClockRspProcess(INT8U* payload, INT32U length, t
 
     if (vb_err == VB_ENGINE_ERROR_NONE)
     {
-      // Calculate driver clock deviation (in usec)
-      thisDriver->time.deviationAbs = US_TO_MS(VbUtilDiffTimespecUs(&(thisDriver->time.adjClock), &(thisDriver->time.ownClock)));
+      t_ClockModel *model = &(thisDriver->time.model);
+      INT64S        offset_us;
+
+      offset_us = VbUtilDiffTimespecUs(&(thisDriver->time.adjClock), &(thisDriver->time.ownClock));
+
+      // Update offset / drift model and next poll time
+      ClockModelSampleAdd(model, &(thisDriver->time.ownClock), offset_us, thisDriver->time.rttNs, &end_time);
+
+      // Calculate driver clock deviation (in msec)
+      thisDriver->time.deviationAbs = US_TO_MS((model->valid == TRUE)?llround(model->offsetUs):offset_us);
     }
 
     pthread_mutex_unlock(&(thisDriver->time.mutex));
@@ -494,6 +775,7 @@ t_VB_engineErrorCode VbEngineClockFutureTSGet(struct timespec *futureTs, INT32U
   if (ret == VB_ENGINE_ERROR_NONE)
   {
     future_params.found = FALSE;
+    future_params.allModelsValid = TRUE;
     ret = VbEngineDatamodelClusterXDriversLoop(FutureClockDriverLoopCb, clusterId, &future_params);
   }
 
@@ -501,6 +783,32 @@ t_VB_engineErrorCode VbEngineClockFutureTSGet(struct timespec *futureTs, INT32U
   {
     if (future_params.found == TRUE)
     {
+      INT32U guard_time;
+      INT32U fixed_guard = VbEngineConfClockFutureGuardGet();
+
+      if (future_params.allModelsValid == TRUE)
+      {
+        // Guard covers the delivery to the slowest driver and the prediction error of reference clock
+        guard_time = (INT32U)US_TO_MS(future_params.maxDeliveryUs + future_params.refBoundUs + (MSEC_IN_SEC - 1)) +
+                     fixed_guard;
+      }
+      else
+      {
+        pthread_mutex_lock(&vbEngineClockStatsMutex);
+        // Take into account worst RTT to calculate guard time
+        guard_time = (INT32U)(NS_TO_MS(vbEngineClockStats.maxRtt)) + fixed_guard;
+        pthread_mutex_unlock(&vbEngineClockStatsMutex);
+      }
+
+      // Add guard time to current time
+      VbUtilTimespecMsecAdd(&(future_params.futureClock), guard_time, &(future_params.futureClock));
+
+      // Add guard time to current Own time
+      VbUtilTimespecMsecAdd(&(future_params.futureOwnClock), guard_time, &(future_params.futureOwnClock));
+
+      // Calculate seq number
+      future_params.futureSeqNum += (guard_time / MAC_CYCLE_DURATION);
+
       if (futureTs != NULL)
       {
         *futureTs = future_params.futureClock;
@@ -540,6 +848,21 @@ t_VB_engineErrorCode VbEngineClockAllDriversUpdate(void)
 
 /*******************************************************************/
 
+t_VB_engineErrorCode VbEngineClockExpiredDriversUpdate(void)
+{
+  t_VB_engineErrorCode ret;
+  t_clockPoll          poll_params;
+
+  poll_params.expiredOnly = TRUE;
+  clock_gettime(CLOCK_MONOTONIC, &(poll_params.now));
+
+  ret = VbEngineDatamodelDriversLoop(ClockMonitorLoopCb, &poll_params);
+
+  return ret;
+}
+
+/*******************************************************************/
+
 t_VB_engineErrorCode VbEngineClockAllDriversNTPDeviationCheck(void)
 {
   t_VB_engineErrorCode ret;
@@ -592,6 +915,7 @@ t_VB_engineErrorCode VbEngineClockClusterUpdate(INT32U clusterId)
 void VbEngineClockMonitorInit(void)
 {
   VbEngineClockMonitorStateSet(FALSE);
+  vbEngineClockMonitorTicks = 0;
   pthread_mutex_lock(&vbEngineClockStatsMutex);
   bzero(&vbEngineClockStats, sizeof(vbEngineClockStats));
   pthread_mutex_unlock(&vbEngineClockStatsMutex);
@@ -630,7 +954,7 @@ BOOLEAN VbEngineClockMonitorRun(void)
   pthread_mutex_init(&vbEngineClockStatsMutex, NULL);
 
   // Create periodic task
-  err = TimerPeriodicTaskSet(CLOCK_TASK_NAME, CLOCK_UPDATE_INTERVAL, VbEngineClockMonitor, NULL, &vbEngineClockMonitorTimer);
+  err = TimerPeriodicTaskSet(CLOCK_TASK_NAME, CLOCK_POLL_TICK, VbEngineClockMonitor, NULL, &vbEngineClockMonitorTimer);
 
   if (err == 0)
   {
@@ -61,6 +61,8 @@
  ************************************************************************
  */
 
+#define VB_ENGINE_CLOCK_DEFAULT_FUTURE_GUARD   (500)    // In msec
+
 /*
  ************************************************************************
  ** Public type definitions
@@ -110,6 +112,12 @@ t_VB_engineErrorCode VbEngineClockFutureTSGet(struct timespec *futureTs, INT32U
  **/
 t_VB_engineErrorCode VbEngineClockAllDriversUpdate(void);
 
+/**
+ * @brief Launch a EAClock.req frame only to drivers whose clock model poll interval has expired
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineClockExpiredDriversUpdate(void);
+
 /**
  * @brief Check NTP deviation of all drivers
  * @return @ref t_VB_engineErrorCode
@@ -55,6 +55,7 @@
 #include <stdlib.h>
 #include <getopt.h>
 #include <arpa/inet.h>
+#include <pthread.h>
 
 #include "types.h"
 
@@ -69,6 +70,8 @@
 #include "vb_engine_cdta.h"
 #include "vb_engine_socket_alive.h"
 #include "vb_engine_alignment.h"
+#include "vb_line_state.h"
+#include "vb_ea_shm.h"
 #include "ezxml.h"
 
 /*
@@ -83,6 +86,10 @@
 #define VB_ENGINE_CONF_DEFAULT_TRAFFIC_METRICS_ENABLED   (TRUE)
 #define VB_ENGINE_CONF_DEFAULT_SAVE_METRICS              (FALSE)
 #define VB_ENGINE_CONF_DEFAULT_METRICS_MAX_LOG_KB_SPACE  (1024)
+#define VB_ENGINE_CONF_DEFAULT_EA_SHM_RING_SIZE          (VB_EA_SHM_RING_DEFAULT_SIZE)
+#define VB_ENGINE_CONF_DEFAULT_EA_IO_URING               (TRUE)
+#define VB_ENGINE_CONF_DEFAULT_CLOCK_FUTURE_GUARD        (VB_ENGINE_CLOCK_DEFAULT_FUTURE_GUARD)
+#define VB_ENGINE_CONF_CLOCK_FUTURE_GUARD_MAX            (10000) // In ms
 #define VB_ENGINE_CONF_DEFAULT_BOOSTTHR_DEC_BOOST        (70)
 #define VB_ENGINE_CONF_DEFAULT_BOOSTTHR_INC_BOOST        (85)
 #define VB_ENGINE_CONF_MAX_IFACE_LENGTH                  (32)
@@ -137,6 +144,59 @@
 #define VB_ENGINE_CONF_DEFAULT_PERSLOG_NUMLINES          (500)
 #define VB_ENGINE_CONF_DEFAULT_PERSLOG_VERBOSE           (VB_LOG_ERROR)
 #define VB_ENGINE_CONF_DEFAULT_PERSLOG_CIRCULAR          (TRUE)
+#define VB_ENGINE_CONF_DEFAULT_LINESTATE_ENABLE          (TRUE)
+#define VB_ENGINE_CONF_DEFAULT_LINESTATE_MAXLINES        (VB_LINE_STATE_DEFAULT_MAX_LINES)
+#define VB_ENGINE_CONF_DEFAULT_LINESTATE_TEXTFILES       (FALSE)
+#define VB_ENGINE_CONF_DEFAULT_FWRITER_FLUSH_PERIOD      (VB_FILE_WRITER_DEFAULT_FLUSH_PERIOD)
+#define VB_ENGINE_CONF_DEFAULT_FWRITER_MAX_OPEN_FILES    (VB_FILE_WRITER_DEFAULT_MAX_OPEN_FILES)
+#define VB_ENGINE_CONF_DEFAULT_FWRITER_MAX_FILES         (VB_FILE_WRITER_DEFAULT_MAX_FILES)
+#define VB_ENGINE_CONF_DEFAULT_FWRITER_MAX_BUFFERED      (VB_FILE_WRITER_DEFAULT_MAX_BUFFERED)
+#define VB_ENGINE_CONF_DEFAULT_FWRITER_FSYNC             (VB_FILE_WRITER_FSYNC_NONE)
+#define VB_ENGINE_CONF_DEFAULT_FWRITER_IO_URING          (TRUE)
+#define VB_ENGINE_CONF_DEFAULT_MSTREAM_ENABLE            (FALSE)
+#define VB_ENGINE_CONF_DEFAULT_MSTREAM_SOCKET            (VB_MEAS_STREAM_DEFAULT_SOCKET)
+#define VB_ENGINE_CONF_DEFAULT_MSTREAM_MAX_SUBSCRIBERS   (VB_ENGINE_MEAS_STREAM_DEFAULT_MAX_SUBSCRIBERS)
+#define VB_ENGINE_CONF_DEFAULT_MSTREAM_BUFFER            (VB_ENGINE_MEAS_STREAM_DEFAULT_BUFFER)
+#define VB_ENGINE_CONF_DEFAULT_XTALK_SPARSITY_ENABLE     (TRUE)
+#define VB_ENGINE_CONF_DEFAULT_XTALK_SPARSITY_THR        (VB_ENGINE_XTALK_SPARSITY_DEFAULT_THR)
+#define VB_ENGINE_CONF_DEFAULT_XTALK_SPARSITY_MAX_ERROR  (VB_ENGINE_XTALK_SPARSITY_DEFAULT_MAX_ERROR)
+#define VB_ENGINE_CONF_DEFAULT_CLUSTER_PARTITION_ENABLE  (TRUE)
+#define VB_ENGINE_CONF_DEFAULT_CLUSTER_PARTITION_APPLY   (FALSE)
+#define VB_ENGINE_CONF_DEFAULT_CLUSTER_PARTITION_THR     (VB_ENGINE_CLUSTER_PARTITION_DEFAULT_COUPLING_THR)
+#define VB_ENGINE_CONF_DEFAULT_CLUSTER_PARTITION_LINES   (VB_ENGINE_CLUSTER_PARTITION_DEFAULT_MAX_LINES)
+#define VB_ENGINE_CONF_DEFAULT_CLUSTER_PARTITION_HOLD    (VB_ENGINE_CLUSTER_PARTITION_DEFAULT_HOLD_TIME)
+#define VB_ENGINE_CONF_DEFAULT_CFR_RESOLUTION_ENABLE     (FALSE)
+#define VB_ENGINE_CONF_DEFAULT_CFR_RESOLUTION_MAX_DECIM  (VB_ENGINE_CFR_RESOLUTION_DEFAULT_MAX_DECIMATION)
+#define VB_ENGINE_CONF_DEFAULT_CFR_RESOLUTION_MAX_ERROR  (VB_ENGINE_CFR_RESOLUTION_DEFAULT_MAX_ERROR)
+#define VB_ENGINE_CONF_DEFAULT_CFR_RESOLUTION_REFRESH    (VB_ENGINE_CFR_RESOLUTION_DEFAULT_REFRESH_PLANS)
+#define VB_ENGINE_CONF_DEFAULT_SNR_TRACKING_ENABLE       (FALSE)
+#define VB_ENGINE_CONF_DEFAULT_SNR_TRACKING_PERIOD       (VB_ENGINE_SNR_TRACKING_DEFAULT_PERIOD)
+#define VB_ENGINE_CONF_DEFAULT_SNR_TRACKING_LINES        (VB_ENGINE_SNR_TRACKING_DEFAULT_LINES_PER_ROUND)
+#define VB_ENGINE_CONF_DEFAULT_SNR_TRACKING_ERROR_THR    (VB_ENGINE_SNR_TRACKING_DEFAULT_ERROR_THR)
+#define VB_ENGINE_CONF_DEFAULT_SNR_TRACKING_HOLD         (VB_ENGINE_SNR_TRACKING_DEFAULT_ESCALATE_HOLD)
+#define VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_ENABLE      (FALSE)
+#define VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_NODE_DWELL  (VB_ENGINE_BOOST_DAMPING_DEFAULT_NODE_DWELL)
+#define VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_CLUST_DWELL (VB_ENGINE_BOOST_DAMPING_DEFAULT_CLUSTER_DWELL)
+#define VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_RECONF_MIN  (VB_ENGINE_BOOST_DAMPING_DEFAULT_RECONF_PER_MIN)
+#define VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_BURST       (VB_ENGINE_BOOST_DAMPING_DEFAULT_BURST)
+#define VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_WINDOW      (VB_ENGINE_BOOST_DAMPING_DEFAULT_APPLY_WINDOW)
+#define VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_ENABLE   (FALSE)
+#define VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_HORIZON  (VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_HORIZON)
+#define VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_ALPHA    (VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_ALPHA)
+#define VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_BETA     (VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_BETA)
+#define VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_GAMMA    (VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_GAMMA)
+#define VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_SLOTS    (VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_SEASON_SLOTS)
+#define VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_BURST    (VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_BURST_THR)
+#define VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_HOLD     (VB_ENGINE_TRAFFIC_FORECAST_DEFAULT_BURST_HOLD)
+#define VB_ENGINE_CONF_DEFAULT_SNR_LINEAR_CACHE_ENABLE   (TRUE)
+#define VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_ENABLE       (FALSE)
+#define VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_DEPTH        (VB_ENGINE_MEAS_HISTORY_DEFAULT_DEPTH)
+#define VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_BUDGET       (VB_ENGINE_MEAS_HISTORY_DEFAULT_MEMORY_BUDGET)
+#define VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_MIN_PLANS    (VB_ENGINE_MEAS_HISTORY_DEFAULT_MIN_PLANS)
+#define VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_TREND        (VB_ENGINE_MEAS_HISTORY_DEFAULT_STABLE_TREND)
+#define VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_DEVIATION    (VB_ENGINE_MEAS_HISTORY_DEFAULT_STABLE_DEVIATION)
+#define VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_KEEP         (TRUE)
+#define VB_ENGINE_CONF_DEFAULT_THREAD_PLACEMENT_ENABLE   (FALSE)
 
 /*
  ************************************************************************
@@ -210,6 +270,25 @@ typedef struct s_persistentLog
   BOOLEAN         circular;
 } t_persistentLog;
 
+typedef struct s_lineStateConf
+{
+  BOOLEAN         enable;
+  INT32U          maxLines;
+  BOOLEAN         textFiles;
+} t_lineStateConf;
+
+typedef struct s_driverConfEntry
+{
+  struct in6_addr  ipAddr;
+  INT16U           port;
+} t_driverConfEntry;
+
+typedef struct s_driversListConf
+{
+  INT32U              size;
+  t_driverConfEntry  *entries;
+} t_driversListConf;
+
 typedef struct s_vbEngineConf
 {
   CHAR                      engineId[VB_ENGINE_ID_MAX_SIZE];
@@ -222,6 +301,9 @@ typedef struct s_vbEngineConf
   BOOL                      trafficMetricsEnabled;
   BOOL                      saveMetricsEnabled;
   INT32U                    maxMetricsLogSize;
+  INT32U                    eaShmRingSize;                                   ///< Shared memory EA transport ring size with co-located drivers (0: disabled)
+  BOOLEAN                   eaIoUring;                                       ///< Read EA sockets through io_uring when kernel supports it
+  INT32U                    clockFutureGuard;                                ///< Fixed margin (ms) added to future timestamps sent to drivers
   INT32U                    boostThresholds[VB_BOOST_THR_TYPE_LAST];         ///< Boost thresholds
   BOOLEAN                   vdslCoex;
   t_measconfdata            measPlanConf;
@@ -235,16 +317,76 @@ typedef struct s_vbEngineConf
   INT16U                    boostAlgPeriod;
   t_alignParams             alignParams;
   t_persistentLog           persistentLog;
+  t_lineStateConf           lineState;
+  t_vbFileWriterConf        fileWriter;
+  t_vbEngineMeasStreamConf  measStream;
+  t_vbEngineXtalkSparsityConf xtalkSparsity;
+  t_vbEngineClusterPartitionConf clusterPartition;
+  t_vbEngineCfrResolutionConf cfrResolution;
+  t_vbEngineSnrTrackingConf   snrTracking;
+  t_vbEngineBoostDampingConf  boostDamping;
+  t_vbEngineTrafficForecastConf trafficForecast;
+  t_vbEngineSnrLinearCacheConf  snrLinearCache;
+  t_vbEngineMeasHistoryConf     measHistory;
+  t_vbThreadPlacementConf       threadPlacement;
+  t_vbEngineEventSchedConf      eventSched;
   t_socketAlive             socketAlive;
+  t_driversListConf         driversList;                                     ///< Drivers read from ini file (client mode)
 } t_vbEngineConf;
 
+typedef struct s_vbEngineConfReload
+{
+  t_vbEngineConf            conf;                                            ///< Candidate configuration
+  INT32U                    changes;                                         ///< Bitmap of t_vbEngineConfReloadSection
+} t_vbEngineConfReload;
+
 /*
  ************************************************************************
  ** Private variables
  ************************************************************************
  */
 
-static t_vbEngineConf vbEngineConf;
+static t_vbEngineConf   vbEngineConf;
+
+/*
+ * Configuration filled by the parser: running configuration at startup and a
+ * candidate one on reload. Parsing and pending reload are protected by vbEngineConfReloadMutex.
+ */
+static t_vbEngineConf       *vbEngineConfParsing = &vbEngineConf;
+static BOOLEAN               vbEngineConfParsingReload = FALSE;
+static t_vbEngineConfReload *vbEngineConfReloadPending = NULL;
+static pthread_mutex_t       vbEngineConfReloadMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Alignment and seed MAC lists of running configuration are swapped on reload
+ * while other threads read them, so they are only accessed with this mutex
+ * locked and handed out as copies.
+ */
+static pthread_mutex_t       vbEngineConfListsMutex = PTHREAD_MUTEX_INITIALIZER;
+static CHAR             vbEngineConfIniFile[MAX_FILE_NAME_LENGTH] = VB_ENGINE_CONF_DEFAULT_INI_FILE;
+
+static const CHAR *vbEngineConfReloadSectionString[VB_ENGINE_CONF_RELOAD_SECTION_LAST] =
+{
+  "VerboseLevel",
+  "BoostThr",
+  "BoostAlgPeriod",
+  "Profiles",
+  "CDTA",
+  "MeasureConfiguration",
+  "AlignParams",
+  "AutomaticSeed",
+  "SaveMeasuresToDisk",
+  "XtalkSparsity",
+  "ClusterPartition",
+  "CfrResolution",
+  "SnrTracking",
+  "BoostDamping",
+  "TrafficForecast",
+  "SnrLinearCache",
+  "MeasHistory",
+  "ThreadPlacement",
+  "EventScheduler",
+};
 
 /*
  ************************************************************************
@@ -291,12 +433,12 @@ static t_VB_engineErrorCode UserProfileSLAInfoSet(INT8U *slaName, INT32U userPro
   t_VB_engineErrorCode err_code = VB_ENGINE_ERROR_NOT_FOUND;
   INT32U i;
 
-  for(i=0; i< vbEngineConf.sla.numSlas; i++)
+  for(i=0; i< vbEngineConfParsing->sla.numSlas; i++)
   {
-    if(strncmp((char *)slaName, (char *)vbEngineConf.sla.definition[i].name, VB_ENGINE_CONF_SLA_NAME_MAX) == 0)
+    if(strncmp((char *)slaName, (char *)vbEngineConfParsing->sla.definition[i].name, VB_ENGINE_CONF_SLA_NAME_MAX) == 0)
     {
-      vbEngineConf.userProfile[userProfileIdx].sla = vbEngineConf.sla.definition[i].slaMbps;
-      vbEngineConf.userProfile[userProfileIdx].slaWeight = vbEngineConf.sla.definition[i].weight;
+      vbEngineConfParsing->userProfile[userProfileIdx].sla = vbEngineConfParsing->sla.definition[i].slaMbps;
+      vbEngineConfParsing->userProfile[userProfileIdx].slaWeight = vbEngineConfParsing->sla.definition[i].weight;
       err_code = VB_ENGINE_ERROR_NONE;
       break;
     }
@@ -317,7 +459,7 @@ static t_VB_engineErrorCode UserProfileFileParse( ezxml_t userProfile, INT32U us
     ez_temp = ezxml_child(userProfile, "MAC");
     if ((ez_temp != NULL) && (ez_temp->txt != NULL))
     {
-      MACAddrStr2mem(vbEngineConf.userProfile[userProfileIdx].mac, ez_temp->txt);
+      MACAddrStr2mem(vbEngineConfParsing->userProfile[userProfileIdx].mac, ez_temp->txt);
       errno = 0;
 
       if (errno != 0)
@@ -359,7 +501,7 @@ static t_VB_engineErrorCode UserProfileFileParse( ezxml_t userProfile, INT32U us
     if ((ez_temp != NULL) && (ez_temp->txt != NULL))
     {
       errno = 0;
-      vbEngineConf.userProfile[userProfileIdx].userWeight = strtol(ez_temp->txt,NULL,10);
+      vbEngineConfParsing->userProfile[userProfileIdx].userWeight = strtol(ez_temp->txt,NULL,10);
       if (errno != 0)
       {
         printf("ERROR (%d:%s) parsing .ini file: Invalid Weight value\n", errno, strerror(errno));
@@ -388,8 +530,8 @@ static t_VB_engineErrorCode SLAsDefinitionFileParse( ezxml_t slaDefinition, INT3
     ez_temp = ezxml_child(slaDefinition, "Name");
     if ((ez_temp != NULL) && (ez_temp->txt != NULL))
     {
-      strncpy((char*)vbEngineConf.sla.definition[slaIdx].name, ez_temp->txt, VB_ENGINE_CONF_SLA_NAME_MAX);
-      vbEngineConf.sla.definition[slaIdx].name[VB_ENGINE_CONF_SLA_NAME_MAX-1] = 0;
+      strncpy((char*)vbEngineConfParsing->sla.definition[slaIdx].name, ez_temp->txt, VB_ENGINE_CONF_SLA_NAME_MAX);
+      vbEngineConfParsing->sla.definition[slaIdx].name[VB_ENGINE_CONF_SLA_NAME_MAX-1] = 0;
       errno = 0;
 
       if (errno != 0)
@@ -411,7 +553,7 @@ static t_VB_engineErrorCode SLAsDefinitionFileParse( ezxml_t slaDefinition, INT3
     if ((ez_temp != NULL) && (ez_temp->txt != NULL))
     {
       errno = 0;
-      vbEngineConf.sla.definition[slaIdx].slaMbps = strtol(ez_temp->txt,NULL,10);
+      vbEngineConfParsing->sla.definition[slaIdx].slaMbps = strtol(ez_temp->txt,NULL,10);
       if (errno != 0)
       {
         printf("ERROR (%d:%s) parsing .ini file: Invalid SLAMbps value\n", errno, strerror(errno));
@@ -431,7 +573,7 @@ static t_VB_engineErrorCode SLAsDefinitionFileParse( ezxml_t slaDefinition, INT3
     if ((ez_temp != NULL) && (ez_temp->txt != NULL))
     {
       errno = 0;
-      vbEngineConf.sla.definition[slaIdx].weight = strtol(ez_temp->txt,NULL,10);
+      vbEngineConfParsing->sla.definition[slaIdx].weight = strtol(ez_temp->txt,NULL,10);
       if (errno != 0)
       {
         printf("ERROR (%d:%s) parsing .ini file: Invalid weight value\n", errno, strerror(errno));
@@ -472,37 +614,6 @@ static t_VB_engineErrorCode DriverListParse(ezxml_t driversList)
 
     for (ez_driver = ezxml_child(driversList, "Driver"); ez_driver != NULL; ez_driver = ez_driver->next)
     {
-      ret = VbEngineDatamodelCreateDriver(NULL, &driver);
-
-      if (ret != VB_ENGINE_ERROR_NONE)
-      {
-        printf("Engine Conf: Error %d creating new Driver\n", ret);
-      }
-
-      if (ret == VB_ENGINE_ERROR_NONE)
-      {
-        ret = VbEngineDrvListDriverAdd(driver);
-
-        if (ret != VB_ENGINE_ERROR_NONE)
-        {
-          printf("Engine Conf: Error %d Adding Driver to the driver list\n", ret);
-        }
-      }
-
-      if (ret == VB_ENGINE_ERROR_NONE)
-      {
-        // Set a default name based on the index inside the linked list. This index is unique
-        sprintf(driver_id, VB_ENGINE_DEFAULT_DRIVER_ID, (unsigned int)driver->l.index);
-
-        // Set driver name
-        ret = VbEngineDatamodelDriverIdSet(driver_id, driver, TRUE);
-
-        if (ret != VB_ENGINE_ERROR_NONE)
-        {
-          printf("Engine Conf: Error %d setting Driver name\n", ret);
-        }
-      }
-
       if (ret == VB_ENGINE_ERROR_NONE)
       {
         ez_temp = ezxml_child(ez_driver, "Port");
@@ -569,6 +680,62 @@ static t_VB_engineErrorCode DriverListParse(ezxml_t driversList)
       }
 
       if (ret == VB_ENGINE_ERROR_NONE)
+      {
+        // Keep a copy of the driver settings to detect changes on reload
+        t_driverConfEntry *entries;
+
+        entries = (t_driverConfEntry *)realloc(vbEngineConfParsing->driversList.entries,
+            (vbEngineConfParsing->driversList.size + 1) * sizeof(t_driverConfEntry));
+
+        if (entries == NULL)
+        {
+          printf("Engine Conf: Error allocating driver list\n");
+          ret = VB_ENGINE_ERROR_MALLOC;
+        }
+        else
+        {
+          entries[vbEngineConfParsing->driversList.size].ipAddr = ip_addr;
+          entries[vbEngineConfParsing->driversList.size].port = driver_port;
+          vbEngineConfParsing->driversList.entries = entries;
+          vbEngineConfParsing->driversList.size++;
+        }
+      }
+
+      if ((ret == VB_ENGINE_ERROR_NONE) && (vbEngineConfParsingReload == FALSE))
+      {
+        ret = VbEngineDatamodelCreateDriver(NULL, &driver);
+
+        if (ret != VB_ENGINE_ERROR_NONE)
+        {
+          printf("Engine Conf: Error %d creating new Driver\n", ret);
+        }
+      }
+
+      if ((ret == VB_ENGINE_ERROR_NONE) && (vbEngineConfParsingReload == FALSE))
+      {
+        ret = VbEngineDrvListDriverAdd(driver);
+
+        if (ret != VB_ENGINE_ERROR_NONE)
+        {
+          printf("Engine Conf: Error %d Adding Driver to the driver list\n", ret);
+        }
+      }
+
+      if ((ret == VB_ENGINE_ERROR_NONE) && (vbEngineConfParsingReload == FALSE))
+      {
+        // Set a default name based on the index inside the linked list. This index is unique
+        sprintf(driver_id, VB_ENGINE_DEFAULT_DRIVER_ID, (unsigned int)driver->l.index);
+
+        // Set driver name
+        ret = VbEngineDatamodelDriverIdSet(driver_id, driver, TRUE);
+
+        if (ret != VB_ENGINE_ERROR_NONE)
+        {
+          printf("Engine Conf: Error %d setting Driver name\n", ret);
+        }
+      }
+
+      if ((ret == VB_ENGINE_ERROR_NONE) && (vbEngineConfParsingReload == FALSE))
       {
         // Associate EAinterface in client mode to the driver
         ret = VbEngineEAInterfaceInit(NULL, ip_addr, driver_port, driver, VB_EA_TYPE_CLIENT);
@@ -611,7 +778,7 @@ static t_VB_engineErrorCode VbEngineSeedConfigurationParse( ezxml_t seed_conf )
     if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
     {
       errno = 0;
-      vbEngineConf.seedConf.enabled =  (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;;
+      vbEngineConfParsing->seedConf.enabled =  (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;;
 
       if (errno != 0)
       {
@@ -633,7 +800,7 @@ static t_VB_engineErrorCode VbEngineSeedConfigurationParse( ezxml_t seed_conf )
     if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
     {
       errno = 0;
-      vbEngineConf.seedConf.minSeedIndex = strtol(ezxml_txt(ez_temp),NULL,10);
+      vbEngineConfParsing->seedConf.minSeedIndex = strtol(ezxml_txt(ez_temp),NULL,10);
 
       if (errno != 0)
       {
@@ -655,7 +822,7 @@ static t_VB_engineErrorCode VbEngineSeedConfigurationParse( ezxml_t seed_conf )
     if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
     {
       errno = 0;
-      vbEngineConf.seedConf.maxSeedindex = strtol(ezxml_txt(ez_temp),NULL,10);
+      vbEngineConfParsing->seedConf.maxSeedindex = strtol(ezxml_txt(ez_temp),NULL,10);
 
       if (errno != 0)
       {
@@ -684,12 +851,12 @@ static t_VB_engineErrorCode VbEngineSeedConfigurationParse( ezxml_t seed_conf )
       numberOfExcludedMacs = VbEngineNumEntriesGet(ez_temp, "MAC");
 
       // Store the number of excluded MACs
-      vbEngineConf.seedConf.excludedMacListSize = numberOfExcludedMacs;
+      vbEngineConfParsing->seedConf.excludedMacListSize = numberOfExcludedMacs;
 
       // Reserve memory to store the list of excluded MACs
-      vbEngineConf.seedConf.excludedMacList = (INT8U *)malloc(numberOfExcludedMacs*ETH_ALEN*sizeof(INT8U));
+      vbEngineConfParsing->seedConf.excludedMacList = (INT8U *)malloc(numberOfExcludedMacs*ETH_ALEN*sizeof(INT8U));
 
-      if (vbEngineConf.seedConf.excludedMacList == NULL)
+      if (vbEngineConfParsing->seedConf.excludedMacList == NULL)
       {
         printf("ERROR (no memory) parsing .ini file: Invalid AutomaticSeed/ExcludedMacList value\n");
         err_code = VB_ENGINE_ERROR_NO_MEMORY;
@@ -701,7 +868,7 @@ static t_VB_engineErrorCode VbEngineSeedConfigurationParse( ezxml_t seed_conf )
         numberOfExcludedMacs = 0;
         for (ez_excluded_mac = ezxml_child(ez_temp, "MAC"); ez_excluded_mac != NULL; ez_excluded_mac = ez_excluded_mac->next)
         {
-          MACAddrStr2mem(vbEngineConf.seedConf.excludedMacList+(numberOfExcludedMacs*ETH_ALEN), ez_excluded_mac->txt);
+          MACAddrStr2mem(vbEngineConfParsing->seedConf.excludedMacList+(numberOfExcludedMacs*ETH_ALEN), ez_excluded_mac->txt);
           numberOfExcludedMacs++;
         }
       }
@@ -713,34 +880,64 @@ static t_VB_engineErrorCode VbEngineSeedConfigurationParse( ezxml_t seed_conf )
 
 /*******************************************************************/
 
-static void VbEngineAlignCustomRelease(void)
+static void VbEngineAlignCustomRelease(t_alignParamsCustom *customList)
 {
   INT32U entry_idx;
 
-  if (vbEngineConf.alignParams.nodeCustomList.entries != NULL)
+  if (customList->entries != NULL)
   {
-    for (entry_idx = 0; entry_idx < vbEngineConf.alignParams.nodeCustomList.size; entry_idx++)
+    for (entry_idx = 0; entry_idx < customList->size; entry_idx++)
     {
-      if (vbEngineConf.alignParams.nodeCustomList.entries[entry_idx].blackList.list != NULL)
+      if (customList->entries[entry_idx].blackList.list != NULL)
       {
-        free(vbEngineConf.alignParams.nodeCustomList.entries[entry_idx].blackList.list);
-        vbEngineConf.alignParams.nodeCustomList.entries[entry_idx].blackList.list = NULL;
-        vbEngineConf.alignParams.nodeCustomList.entries[entry_idx].blackList.size = 0;
+        free(customList->entries[entry_idx].blackList.list);
+        customList->entries[entry_idx].blackList.list = NULL;
+        customList->entries[entry_idx].blackList.size = 0;
       }
     }
 
-    free(vbEngineConf.alignParams.nodeCustomList.entries);
-    vbEngineConf.alignParams.nodeCustomList.entries = NULL;
-    vbEngineConf.alignParams.nodeCustomList.size = 0;
+    free(customList->entries);
+    customList->entries = NULL;
+    customList->size = 0;
+  }
+}
+
+/*******************************************************************/
+
+static void VbEngineConfListsRelease(t_vbEngineConf *conf)
+{
+  if (conf->seedConf.excludedMacList != NULL)
+  {
+    free(conf->seedConf.excludedMacList);
+    conf->seedConf.excludedMacList = NULL;
+    conf->seedConf.excludedMacListSize = 0;
+  }
+
+  if (conf->alignParams.prioRefList.list != NULL)
+  {
+    free(conf->alignParams.prioRefList.list);
+    conf->alignParams.prioRefList.list = NULL;
+    conf->alignParams.prioRefList.size = 0;
+  }
+
+  VbEngineAlignCustomRelease(&conf->alignParams.nodeCustomList);
+
+  if (conf->driversList.entries != NULL)
+  {
+    free(conf->driversList.entries);
+    conf->driversList.entries = NULL;
+    conf->driversList.size = 0;
   }
 }
 
 /*******************************************************************/
 
-static t_VB_engineErrorCode VbEngineAlignBlackListItemGet(INT32U entryIdx, INT32U blackListIdx, INT8U **blackListMac)
+static t_VB_engineErrorCode VbEngineAlignBlackListItemGet(INT32U entryIdx, INT32U blackListIdx, INT8U *blackListMac)
 {
   t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
 
+  pthread_mutex_lock(&vbEngineConfListsMutex);
+
   if ((blackListMac == NULL) ||
       (vbEngineConf.alignParams.nodeCustomList.entries == NULL) ||
       (entryIdx >= vbEngineConf.alignParams.nodeCustomList.size) ||
@@ -752,9 +949,62 @@ static t_VB_engineErrorCode VbEngineAlignBlackListItemGet(INT32U entryIdx, INT32
 
   if (ret == VB_ENGINE_ERROR_NONE)
   {
-    *blackListMac = vbEngineConf.alignParams.nodeCustomList.entries[entryIdx].blackList.list + (blackListIdx * ETH_ALEN);
+    memcpy(blackListMac, vbEngineConf.alignParams.nodeCustomList.entries[entryIdx].blackList.list + (blackListIdx * ETH_ALEN), ETH_ALEN);
+  }
+
+  pthread_mutex_unlock(&vbEngineConfListsMutex);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode VbEngineAlignCustomEntryGet(INT32U entryIdx, INT8U *targetMac, INT32U *blackListSize)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+
+  pthread_mutex_lock(&vbEngineConfListsMutex);
+
+  if ((targetMac == NULL) || (blackListSize == NULL) ||
+      (vbEngineConf.alignParams.nodeCustomList.entries == NULL) ||
+      (entryIdx >= vbEngineConf.alignParams.nodeCustomList.size))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    memcpy(targetMac, vbEngineConf.alignParams.nodeCustomList.entries[entryIdx].targetNode, ETH_ALEN);
+    *blackListSize = vbEngineConf.alignParams.nodeCustomList.entries[entryIdx].blackList.size;
+  }
+
+  pthread_mutex_unlock(&vbEngineConfListsMutex);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode VbEngineConfSeedExcludedMacItemGet(INT32U idx, INT8U *excludedMac)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+
+  pthread_mutex_lock(&vbEngineConfListsMutex);
+
+  if ((excludedMac == NULL) ||
+      (vbEngineConf.seedConf.excludedMacList == NULL) ||
+      (idx >= vbEngineConf.seedConf.excludedMacListSize))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    memcpy(excludedMac, vbEngineConf.seedConf.excludedMacList + (idx * ETH_ALEN), ETH_ALEN);
   }
 
+  pthread_mutex_unlock(&vbEngineConfListsMutex);
+
   return ret;
 }
 
@@ -932,14 +1182,14 @@ static t_VB_engineErrorCode VbEngineAlignCustomListParse(ezxml_t customList)
   custom_entries_num = VbEngineNumEntriesGet(customList, "Entry");
 
   // Store the number of custom entries
-  vbEngineConf.alignParams.nodeCustomList.size = custom_entries_num;
+  vbEngineConfParsing->alignParams.nodeCustomList.size = custom_entries_num;
 
   if (custom_entries_num > 0)
   {
     // Allocate memory for custom entries
-    vbEngineConf.alignParams.nodeCustomList.entries = (t_alignParamsCustomEntry *)calloc(custom_entries_num, sizeof(t_alignParamsCustomEntry));
+    vbEngineConfParsing->alignParams.nodeCustomList.entries = (t_alignParamsCustomEntry *)calloc(custom_entries_num, sizeof(t_alignParamsCustomEntry));
 
-    if (vbEngineConf.alignParams.nodeCustomList.entries == NULL)
+    if (vbEngineConfParsing->alignParams.nodeCustomList.entries == NULL)
     {
       printf("ERROR (no memory) parsing .ini file: Invalid AlignParams/CustomList value\n");
       ret = VB_ENGINE_ERROR_NO_MEMORY;
@@ -952,10 +1202,10 @@ static t_VB_engineErrorCode VbEngineAlignCustomListParse(ezxml_t customList)
 
       for (ez_custom_entry = ezxml_child(customList, "Entry"); ez_custom_entry != NULL; ez_custom_entry = ez_custom_entry->next)
       {
-        if (custom_idx < vbEngineConf.alignParams.nodeCustomList.size)
+        if (custom_idx < vbEngineConfParsing->alignParams.nodeCustomList.size)
         {
           // Parse custom entry
-          ret = VbEngineAlignCustomEntryParse(ez_custom_entry, &(vbEngineConf.alignParams.nodeCustomList.entries[custom_idx]));
+          ret = VbEngineAlignCustomEntryParse(ez_custom_entry, &(vbEngineConfParsing->alignParams.nodeCustomList.entries[custom_idx]));
           custom_idx++;
         }
         else
@@ -974,7 +1224,7 @@ static t_VB_engineErrorCode VbEngineAlignCustomListParse(ezxml_t customList)
   else
   {
     // No custom entries
-    vbEngineConf.alignParams.nodeCustomList.entries = NULL;
+    vbEngineConfParsing->alignParams.nodeCustomList.entries = NULL;
   }
 
   return ret;
@@ -991,14 +1241,14 @@ static t_VB_engineErrorCode VbEngineAlignPrioRefListParse(ezxml_t prioRefList)
   prio_ref_num = VbEngineNumEntriesGet(prioRefList, "MAC");
 
   // Store the number of entries
-  vbEngineConf.alignParams.prioRefList.size = prio_ref_num;
+  vbEngineConfParsing->alignParams.prioRefList.size = prio_ref_num;
 
   if (prio_ref_num > 0)
   {
     // Allocate memory for entries
-    vbEngineConf.alignParams.prioRefList.list = (INT8U *)calloc(prio_ref_num, sizeof(INT8U) * ETH_ALEN);
+    vbEngineConfParsing->alignParams.prioRefList.list = (INT8U *)calloc(prio_ref_num, sizeof(INT8U) * ETH_ALEN);
 
-    if (vbEngineConf.alignParams.prioRefList.list == NULL)
+    if (vbEngineConfParsing->alignParams.prioRefList.list == NULL)
     {
       printf("ERROR (no memory) parsing .ini file: Invalid AlignParams/PrioRefList value\n");
       ret = VB_ENGINE_ERROR_NO_MEMORY;
@@ -1011,10 +1261,10 @@ static t_VB_engineErrorCode VbEngineAlignPrioRefListParse(ezxml_t prioRefList)
 
       for (ez_mac_entry = ezxml_child(prioRefList, "MAC"); ez_mac_entry != NULL; ez_mac_entry = ez_mac_entry->next)
       {
-        if (mac_idx < vbEngineConf.alignParams.prioRefList.size)
+        if (mac_idx < vbEngineConfParsing->alignParams.prioRefList.size)
         {
           // Parse MAC entry
-          MACAddrStr2mem(vbEngineConf.alignParams.prioRefList.list + (mac_idx * ETH_ALEN), ezxml_trimtxt(ez_mac_entry));
+          MACAddrStr2mem(vbEngineConfParsing->alignParams.prioRefList.list + (mac_idx * ETH_ALEN), ezxml_trimtxt(ez_mac_entry));
 
           mac_idx++;
         }
@@ -1034,7 +1284,7 @@ static t_VB_engineErrorCode VbEngineAlignPrioRefListParse(ezxml_t prioRefList)
   else
   {
     // No custom entries
-    vbEngineConf.alignParams.prioRefList.list = NULL;
+    vbEngineConfParsing->alignParams.prioRefList.list = NULL;
   }
 
   return ret;
@@ -1052,7 +1302,7 @@ static t_VB_engineErrorCode VbEngineAlignParamsParse( ezxml_t alignConf )
   if ((ez_temp != NULL) && (ez_temp->txt != NULL))
   {
     errno = 0;
-    vbEngineConf.alignParams.reliabilityThr = strtol(ez_temp->txt, NULL, 0);
+    vbEngineConfParsing->alignParams.reliabilityThr = strtol(ez_temp->txt, NULL, 0);
 
     if (errno != 0)
     {
@@ -1068,7 +1318,7 @@ static t_VB_engineErrorCode VbEngineAlignParamsParse( ezxml_t alignConf )
     if ((ez_temp != NULL) && (ez_temp->txt != NULL))
     {
       errno = 0;
-      vbEngineConf.alignParams.minPow = strtoul(ez_temp->txt, NULL, 0);
+      vbEngineConfParsing->alignParams.minPow = strtoul(ez_temp->txt, NULL, 0);
 
       if (errno != 0)
       {
@@ -1085,7 +1335,7 @@ static t_VB_engineErrorCode VbEngineAlignParamsParse( ezxml_t alignConf )
     if ((ez_temp != NULL) && (ez_temp->txt != NULL))
     {
       errno = 0;
-      vbEngineConf.alignParams.minPowHyst = strtoul(ez_temp->txt, NULL, 0);
+      vbEngineConfParsing->alignParams.minPowHyst = strtoul(ez_temp->txt, NULL, 0);
 
       if (errno != 0)
       {
@@ -1114,7 +1364,7 @@ static t_VB_engineErrorCode VbEngineAlignParamsParse( ezxml_t alignConf )
     if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
     {
       errno = 0;
-      vbEngineConf.alignParams.metrics = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+      vbEngineConfParsing->alignParams.metrics = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
 
       if (errno != 0)
       {
@@ -1150,7 +1400,7 @@ static t_VB_engineErrorCode VbEnginePersistentLogParse( ezxml_t persistentLogCon
   if ((ez_temp != NULL) && (ez_temp->txt != NULL))
   {
     errno = 0;
-    vbEngineConf.persistentLog.numLines = strtoul(ez_temp->txt, NULL, 0);
+    vbEngineConfParsing->persistentLog.numLines = strtoul(ez_temp->txt, NULL, 0);
 
     if (errno != 0)
     {
@@ -1166,7 +1416,7 @@ static t_VB_engineErrorCode VbEnginePersistentLogParse( ezxml_t persistentLogCon
     if ((ez_temp != NULL) && (ez_temp->txt != NULL))
     {
       errno = 0;
-      vbEngineConf.persistentLog.verboseLevel = strtoul(ez_temp->txt, NULL, 0);
+      vbEngineConfParsing->persistentLog.verboseLevel = strtoul(ez_temp->txt, NULL, 0);
 
       if (errno != 0)
       {
@@ -1182,184 +1432,1152 @@ static t_VB_engineErrorCode VbEnginePersistentLogParse( ezxml_t persistentLogCon
 
     if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
     {
-      vbEngineConf.persistentLog.circular = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+      vbEngineConfParsing->persistentLog.circular = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
     }
   }
 
   return ret;
 }
 
-/************************************************************************/
+/*******************************************************************/
 
-static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
+static t_VB_engineErrorCode VbEngineLineStateParse( ezxml_t lineStateConf )
 {
-  t_VB_engineErrorCode error =  VB_ENGINE_ERROR_NONE;
-  ezxml_t              engine = NULL;
-  ezxml_t              drivers_list;
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
   ezxml_t              ez_temp;
-  ezxml_t              measure_conf;
-  ezxml_t              cdta_conf;
-  ezxml_t              socket_alive_conf;
-  ezxml_t              user_profiles;
-  ezxml_t              align_params;
-  struct in6_addr      ip_addr;
-  INT16U               num_user_profiles;
 
-  // Init default values
-  vbEngineConf.engineId[0] = '\0';
-  vbEngineConf.serverMode = VB_ENGINE_CONF_DEFAULT_SERVER_MODE;
-  vbEngineConf.serverPort = 0;
-  vbEngineConf.serverIface[0] = '\0';
-  vbEngineConf.outputPath[0] = '\0';
-  vbEngineConf.verboseLevel  = VB_ENGINE_CONF_DEFAULT_VERBOSE_LEVEL;
-  vbEngineConf.consolePort   = VB_ENGINE_CONF_DEFAULT_CONSOLE_PORT;
-  vbEngineConf.trafficMetricsEnabled = VB_ENGINE_CONF_DEFAULT_TRAFFIC_METRICS_ENABLED;
-  vbEngineConf.saveMetricsEnabled = VB_ENGINE_CONF_DEFAULT_SAVE_METRICS;
-  vbEngineConf.maxMetricsLogSize = VB_ENGINE_CONF_DEFAULT_METRICS_MAX_LOG_KB_SPACE;
-  vbEngineConf.boostThresholds[VB_BOOST_THR_TYPE_DEC_BOOST] = VB_ENGINE_CONF_DEFAULT_BOOSTTHR_DEC_BOOST;
-  vbEngineConf.boostThresholds[VB_BOOST_THR_TYPE_INC_BOOST] = VB_ENGINE_CONF_DEFAULT_BOOSTTHR_INC_BOOST;
-  vbEngineConf.vdslCoex = VB_ENGINE_CONF_DEFAULT_VDSL_COEX;
-  vbEngineConf.saveMeasures = VB_ENGINE_CONF_DEFAULT_SAVE_MEASURES;
-  vbEngineConf.vbInUpstream = VB_ENGINE_CONF_DEFAULT_IN_UPSTREAM;
-  vbEngineConf.boostAlgPeriod = VB_ENGINE_CONF_DEFAULT_BOOST_ALG_PERIOD;
-
-  vbEngineConf.psdBandAllocation.numBands200Mhz = VB_ENGINE_HIGH_GRANULARITY_PSD_MNGT;
-  vbEngineConf.psdBandAllocation.numBands100Mhz = VB_ENGINE_MEDIUM_GRANULARITY_PSD_MNGT;
-  vbEngineConf.psdBandAllocation.lastCarrier[0] = VB_ENGINE_CONF_PSD_BAND_0_END; ///< 28  MHz (SISO & MIMO)
-  vbEngineConf.psdBandAllocation.lastCarrier[1] = VB_ENGINE_CONF_PSD_BAND_1_END; ///< 50  MHz (SISO & MIMO)
-  vbEngineConf.psdBandAllocation.lastCarrier[2] = VB_ENGINE_CONF_PSD_BAND_2_END; ///< 96  MHz (SISO & MIMO)
-  vbEngineConf.psdBandAllocation.lastCarrier[3] = VB_ENGINE_CONF_PSD_BAND_3_END; ///< 140 MHz (SISO)
-  vbEngineConf.psdBandAllocation.lastCarrier[4] = VB_ENGINE_CONF_PSD_BAND_4_END; ///< 200 MHz (SISO)
-
-  vbEngineConf.measPlanConf.NumCycles          = VB_ENGINE_CONF_DEFAULT_MEAS_NUM_CYCLES;
-  vbEngineConf.measPlanConf.StorageType        = VB_ENGINE_CONF_DEFAULT_MEAS_STORAGE_TYPE;
-  vbEngineConf.measPlanConf.SymbolsNumber      = VB_ENGINE_CONF_DEFAULT_MEAS_SYMBOLS_NUMBER;
-  vbEngineConf.measPlanConf.TimeAveraging      = VB_ENGINE_CONF_DEFAULT_MEAS_TIME_AVG;
-  vbEngineConf.measPlanConf.FrecuencyAveraging = VB_ENGINE_CONF_DEFAULT_MEAS_FREQ_AVG;
-  vbEngineConf.measPlanConf.Offset             = VB_ENGINE_CONF_DEFAULT_MEAS_OFFSET;
-  vbEngineConf.measPlanConf.Duration           = VB_ENGINE_CONF_DEFAULT_MEAS_DURATION;
-  vbEngineConf.measPlanConf.CFRMeasureType     = VB_ENGINE_CONF_DEFAULT_MEAS_CFR_TYPE;
-  vbEngineConf.measPlanConf.MeasureDataType    = VB_ENGINE_CONF_DEFAULT_MEAS_DATA_TYPE;
-  vbEngineConf.measPlanConf.MeasureDataFormat  = VB_ENGINE_CONF_DEFAULT_MEAS_DATA_FORMAT;
-
-  vbEngineConf.seedConf.enabled                = VB_ENGINE_CONF_DEFAULT_SEED_ENABLE;
-  vbEngineConf.seedConf.minSeedIndex           = VB_ENGINE_CONF_DEFAULT_SEED_MIN_INDEX;
-  vbEngineConf.seedConf.maxSeedindex           = VB_ENGINE_CONF_DEFAULT_SEED_MAX_INDEX;
-  vbEngineConf.seedConf.excludedMacListSize    = 0;
-  vbEngineConf.seedConf.excludedMacList        = NULL;
-
-  vbEngineConf.alignParams.alignMode           = VB_ENGINE_CONF_DEFAULT_ALIGN_MODE;
-  vbEngineConf.alignParams.minPow              = VB_ENGINE_CONF_DEFAULT_ALIGN_MINPOW;
-  vbEngineConf.alignParams.minPowHyst          = VB_ENGINE_CONF_DEFAULT_ALIGN_MINPOWHYST;
-  vbEngineConf.alignParams.reliabilityThr      = VB_ENGINE_CONF_DEFAULT_ALIGN_RELTHR;
-  vbEngineConf.alignParams.prioRefList.size    = 0;
-  vbEngineConf.alignParams.prioRefList.list    = NULL;
-  vbEngineConf.alignParams.metrics             = VB_ENGINE_CONF_DEFAULT_ALIGN_METRICS;
-  vbEngineConf.alignParams.nodeCustomList.size = 0;
-  vbEngineConf.alignParams.nodeCustomList.entries = NULL;
-
-  vbEngineConf.socketAlive.enable              = VB_ENGINE_CONF_DEFAULT_SOCKALIVE_ENABLE;
-  vbEngineConf.socketAlive.period              = VB_ENGINE_CONF_DEFAULT_SOCKALIVE_PERIOD;
-  vbEngineConf.socketAlive.nLostMsgThr         = VB_ENGINE_CONF_DEFAULT_SOCKALIVE_NLOST_THR;
-  
-  vbEngineConf.persistentLog.numLines          = VB_ENGINE_CONF_DEFAULT_PERSLOG_NUMLINES;
-  vbEngineConf.persistentLog.verboseLevel      = VB_ENGINE_CONF_DEFAULT_PERSLOG_VERBOSE;
-  vbEngineConf.persistentLog.circular          = VB_ENGINE_CONF_DEFAULT_PERSLOG_CIRCULAR;
+  ez_temp = ezxml_child(lineStateConf, "Enable");
 
-  if (path == NULL)
+  if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
   {
-    error = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+    vbEngineConfParsing->lineState.enable = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
   }
-  else
+
+  ez_temp = ezxml_child(lineStateConf, "MaxLines");
+
+  if ((ez_temp != NULL) && (ez_temp->txt != NULL))
   {
-    engine = ezxml_parse_file(path);
+    errno = 0;
+    vbEngineConfParsing->lineState.maxLines = strtoul(ez_temp->txt, NULL, 0);
 
-    if(engine == NULL)
+    if ((errno != 0) || (vbEngineConfParsing->lineState.maxLines == 0))
     {
-      printf("Engine Conf: .ini file could not be opened\n");
-      error = VB_ENGINE_ERROR_INI_FILE;
+      printf("ERROR (%d:%s) parsing .ini file: Invalid LineState/MaxLines value\n", errno, strerror(errno));
+      ret = VB_ENGINE_ERROR_INI_FILE;
     }
   }
 
-  if (error == VB_ENGINE_ERROR_NONE)
+  if (ret == VB_ENGINE_ERROR_NONE)
   {
-    // Read ConnectionMode
-    ez_temp = ezxml_child(engine, "ServerConnMode");
-    if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+    ez_temp = ezxml_child(lineStateConf, "TextFiles");
+
+    if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+    {
+      vbEngineConfParsing->lineState.textFiles = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode VbEngineFileWriterParse( ezxml_t fileWriterConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_temp;
+  INT32U               value;
+
+  ez_temp = ezxml_child(fileWriterConf, "FlushPeriod");
+
+  if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+  {
+    errno = 0;
+    value = strtoul(ez_temp->txt, NULL, 0);
+
+    if ((errno != 0) || (value == 0))
     {
-      vbEngineConf.serverMode = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+      printf("ERROR (%d:%s) parsing .ini file: Invalid FileWriter/FlushPeriod value\n", errno, strerror(errno));
+      ret = VB_ENGINE_ERROR_INI_FILE;
     }
     else
     {
-      printf("Engine Conf: Error reading ServerConnMode parameter\n");
-      error = VB_ENGINE_ERROR_INI_FILE;
+      vbEngineConfParsing->fileWriter.flushPeriodMs = value;
     }
   }
 
-  if (error == VB_ENGINE_ERROR_NONE)
+  if (ret == VB_ENGINE_ERROR_NONE)
   {
-    if (vbEngineConf.serverMode)
+    ez_temp = ezxml_child(fileWriterConf, "MaxOpenFiles");
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
     {
-      // Read ServerIface
-      ez_temp = ezxml_child(engine, "ServerIface");
-      if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if ((errno != 0) || (value == 0))
       {
-        strncpy(vbEngineConf.serverIface, ezxml_trimtxt(ez_temp), VB_ENGINE_CONF_MAX_IFACE_LENGTH);
-        vbEngineConf.serverIface[VB_ENGINE_CONF_MAX_IFACE_LENGTH - 1] = '\0';
+        printf("ERROR (%d:%s) parsing .ini file: Invalid FileWriter/MaxOpenFiles value\n", errno, strerror(errno));
+        ret = VB_ENGINE_ERROR_INI_FILE;
       }
       else
       {
-        printf("Engine Conf: Error reading ServerIface parameter\n");
-        error = VB_ENGINE_ERROR_INI_FILE;
-      }
-
-      if (error == VB_ENGINE_ERROR_NONE)
-      {
-        // Read ServerPort
-        ez_temp = ezxml_child(engine, "ServerPort");
-        if((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
-        {
-          errno = 0;
-          vbEngineConf.serverPort = strtol(ezxml_txt(ez_temp), NULL, 0);
-
-          if(errno != 0)
-          {
-            printf("Engine Conf: Error reading ServerPort parameter\n");
-            error = VB_ENGINE_ERROR_INI_FILE;
-          }
-        }
-        else
-        {
-          error = VB_ENGINE_ERROR_INI_FILE;
-        }
+        vbEngineConfParsing->fileWriter.maxOpenFiles = value;
       }
-    } //serverMode
+    }
   }
 
-  if (error == VB_ENGINE_ERROR_NONE)
+  if (ret == VB_ENGINE_ERROR_NONE)
   {
-    // Read vdslCoex
-    ez_temp = ezxml_child(engine, "vdslCoex");
-    if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
-    {
-      vbEngineConf.vdslCoex = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
-    }
-    else
+    ez_temp = ezxml_child(fileWriterConf, "MaxBufferedKB");
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
     {
-      printf("Engine Conf: Error reading vdslCoex parameter\n");
-      error = VB_ENGINE_ERROR_INI_FILE;
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if ((errno != 0) || (value == 0))
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid FileWriter/MaxBufferedKB value\n", errno, strerror(errno));
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        vbEngineConfParsing->fileWriter.maxBufferedBytes = value * 1024;
+      }
     }
   }
 
-  if (error == VB_ENGINE_ERROR_NONE)
+  if (ret == VB_ENGINE_ERROR_NONE)
   {
-    // Read SaveMeasuresToDisk
-    ez_temp = ezxml_child(engine, "SaveMeasuresToDisk");
-    if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+    ez_temp = ezxml_child(fileWriterConf, "Fsync");
+
+    if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
     {
-      vbEngineConf.saveMeasures = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
-    }
-    else
+      if (strcmp(ezxml_trimtxt(ez_temp), "NONE") == 0)
+      {
+        vbEngineConfParsing->fileWriter.fsyncPolicy = VB_FILE_WRITER_FSYNC_NONE;
+      }
+      else if (strcmp(ezxml_trimtxt(ez_temp), "CLOSE") == 0)
+      {
+        vbEngineConfParsing->fileWriter.fsyncPolicy = VB_FILE_WRITER_FSYNC_ON_CLOSE;
+      }
+      else if (strcmp(ezxml_trimtxt(ez_temp), "FLUSH") == 0)
+      {
+        vbEngineConfParsing->fileWriter.fsyncPolicy = VB_FILE_WRITER_FSYNC_ON_FLUSH;
+      }
+      else
+      {
+        printf("ERROR parsing .ini file: Invalid FileWriter/Fsync value (NONE, CLOSE or FLUSH)\n");
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(fileWriterConf, "IoUring");
+
+    if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+    {
+      vbEngineConfParsing->fileWriter.ioUring = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+    }
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineMeasStreamParse( ezxml_t measStreamConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_temp;
+  INT32U               value;
+
+  ez_temp = ezxml_child(measStreamConf, "Enable");
+
+  if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+  {
+    if (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)
+    {
+      vbEngineConfParsing->measStream.enable = TRUE;
+    }
+    else if (strcmp(ezxml_trimtxt(ez_temp), "NO") == 0)
+    {
+      vbEngineConfParsing->measStream.enable = FALSE;
+    }
+    else
+    {
+      printf("ERROR parsing .ini file: Invalid MeasStream/Enable value (YES or NO)\n");
+      ret = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(measStreamConf, "Socket");
+
+    if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+    {
+      if ((strlen(ezxml_trimtxt(ez_temp)) == 0) ||
+          (strlen(ezxml_trimtxt(ez_temp)) >= sizeof(vbEngineConfParsing->measStream.socketPath)))
+      {
+        // Path must fit in sun_path, null terminator included
+        printf("ERROR parsing .ini file: Invalid MeasStream/Socket value (1 to %u characters)\n", VB_MEAS_STREAM_SOCKET_PATH_MAX - 1);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        strcpy(vbEngineConfParsing->measStream.socketPath, ezxml_trimtxt(ez_temp));
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(measStreamConf, "MaxSubscribers");
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+    {
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if ((errno != 0) || (value == 0))
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid MeasStream/MaxSubscribers value\n", errno, strerror(errno));
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        vbEngineConfParsing->measStream.maxSubscribers = value;
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(measStreamConf, "BufferKB");
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+    {
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if ((errno != 0) || (value == 0))
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid MeasStream/BufferKB value\n", errno, strerror(errno));
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        vbEngineConfParsing->measStream.bufferBytes = value * 1024;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineXtalkSparsityParse( ezxml_t xtalkSparsityConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_temp;
+  INT32U               value;
+
+  ez_temp = ezxml_child(xtalkSparsityConf, "Enable");
+
+  if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+  {
+    if (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)
+    {
+      vbEngineConfParsing->xtalkSparsity.enable = TRUE;
+    }
+    else if (strcmp(ezxml_trimtxt(ez_temp), "NO") == 0)
+    {
+      vbEngineConfParsing->xtalkSparsity.enable = FALSE;
+    }
+    else
+    {
+      printf("ERROR parsing .ini file: Invalid XtalkSparsity/Enable value (YES or NO)\n");
+      ret = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(xtalkSparsityConf, "SignificanceThr");
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+    {
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if ((errno != 0) || (value == 0))
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid XtalkSparsity/SignificanceThr value\n", errno, strerror(errno));
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        vbEngineConfParsing->xtalkSparsity.significanceThr = value;
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ez_temp = ezxml_child(xtalkSparsityConf, "MaxError");
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+    {
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if (errno != 0)
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid XtalkSparsity/MaxError value\n", errno, strerror(errno));
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        vbEngineConfParsing->xtalkSparsity.maxError = value;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineClusterPartitionParse( ezxml_t clusterPartitionConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_temp;
+  INT32U               value;
+  const CHAR          *bool_params[] = {"Enable", "Apply"};
+  BOOLEAN             *bool_values[] = {&vbEngineConfParsing->clusterPartition.enable, &vbEngineConfParsing->clusterPartition.apply};
+  const CHAR          *int_params[] = {"CouplingThr", "MaxLines", "HoldTime"};
+  INT32U              *int_values[] = {&vbEngineConfParsing->clusterPartition.couplingThr,
+                                       &vbEngineConfParsing->clusterPartition.maxLines,
+                                       &vbEngineConfParsing->clusterPartition.holdTime};
+  INT32U               i;
+
+  for (i = 0; (i < (sizeof(bool_params) / sizeof(bool_params[0]))) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    ez_temp = ezxml_child(clusterPartitionConf, bool_params[i]);
+
+    if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+    {
+      if (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)
+      {
+        *bool_values[i] = TRUE;
+      }
+      else if (strcmp(ezxml_trimtxt(ez_temp), "NO") == 0)
+      {
+        *bool_values[i] = FALSE;
+      }
+      else
+      {
+        printf("ERROR parsing .ini file: Invalid ClusterPartition/%s value (YES or NO)\n", bool_params[i]);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+    }
+  }
+
+  for (i = 0; (i < (sizeof(int_params) / sizeof(int_params[0]))) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    ez_temp = ezxml_child(clusterPartitionConf, int_params[i]);
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+    {
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if (errno != 0)
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid ClusterPartition/%s value\n", errno, strerror(errno), int_params[i]);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        *int_values[i] = value;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineCfrResolutionParse( ezxml_t cfrResolutionConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_temp;
+  INT32U               value;
+  const CHAR          *int_params[] = {"MaxDecimation", "MaxError", "RefreshPlans"};
+  INT32U              *int_values[] = {&vbEngineConfParsing->cfrResolution.maxDecimation,
+                                       &vbEngineConfParsing->cfrResolution.maxError,
+                                       &vbEngineConfParsing->cfrResolution.refreshPlans};
+  INT32U               i;
+
+  ez_temp = ezxml_child(cfrResolutionConf, "Enable");
+
+  if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+  {
+    if (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)
+    {
+      vbEngineConfParsing->cfrResolution.enable = TRUE;
+    }
+    else if (strcmp(ezxml_trimtxt(ez_temp), "NO") == 0)
+    {
+      vbEngineConfParsing->cfrResolution.enable = FALSE;
+    }
+    else
+    {
+      printf("ERROR parsing .ini file: Invalid CfrResolution/Enable value (YES or NO)\n");
+      ret = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  for (i = 0; (i < (sizeof(int_params) / sizeof(int_params[0]))) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    ez_temp = ezxml_child(cfrResolutionConf, int_params[i]);
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+    {
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if (errno != 0)
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid CfrResolution/%s value\n", errno, strerror(errno), int_params[i]);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        *int_values[i] = value;
+      }
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (vbEngineConfParsing->cfrResolution.maxDecimation == 0))
+  {
+    printf("ERROR parsing .ini file: Invalid CfrResolution/MaxDecimation value (1, 2, 4 or 8)\n");
+    ret = VB_ENGINE_ERROR_INI_FILE;
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineSnrTrackingParse( ezxml_t snrTrackingConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_temp;
+  INT32U               value;
+  const CHAR          *int_params[] = {"Period", "LinesPerRound", "ErrorThr", "EscalateHold"};
+  INT32U              *int_values[] = {&vbEngineConfParsing->snrTracking.period,
+                                       &vbEngineConfParsing->snrTracking.linesPerRound,
+                                       &vbEngineConfParsing->snrTracking.errorThr,
+                                       &vbEngineConfParsing->snrTracking.escalateHold};
+  INT32U               i;
+
+  ez_temp = ezxml_child(snrTrackingConf, "Enable");
+
+  if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+  {
+    if (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)
+    {
+      vbEngineConfParsing->snrTracking.enable = TRUE;
+    }
+    else if (strcmp(ezxml_trimtxt(ez_temp), "NO") == 0)
+    {
+      vbEngineConfParsing->snrTracking.enable = FALSE;
+    }
+    else
+    {
+      printf("ERROR parsing .ini file: Invalid SnrTracking/Enable value (YES or NO)\n");
+      ret = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  for (i = 0; (i < (sizeof(int_params) / sizeof(int_params[0]))) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    ez_temp = ezxml_child(snrTrackingConf, int_params[i]);
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+    {
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if (errno != 0)
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid SnrTracking/%s value\n", errno, strerror(errno), int_params[i]);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        *int_values[i] = value;
+      }
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) &&
+      ((vbEngineConfParsing->snrTracking.period == 0) || (vbEngineConfParsing->snrTracking.linesPerRound == 0)))
+  {
+    printf("ERROR parsing .ini file: SnrTracking/Period and SnrTracking/LinesPerRound shall be greater than 0\n");
+    ret = VB_ENGINE_ERROR_INI_FILE;
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineBoostDampingParse( ezxml_t boostDampingConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_temp;
+  INT32U               value;
+  const CHAR          *int_params[] = {"NodeDwell", "ClusterDwell", "ReconfPerMin", "Burst", "ApplyWindow"};
+  INT32U              *int_values[] = {&vbEngineConfParsing->boostDamping.nodeDwell,
+                                       &vbEngineConfParsing->boostDamping.clusterDwell,
+                                       &vbEngineConfParsing->boostDamping.reconfPerMin,
+                                       &vbEngineConfParsing->boostDamping.burst,
+                                       &vbEngineConfParsing->boostDamping.applyWindow};
+  INT32U               i;
+
+  ez_temp = ezxml_child(boostDampingConf, "Enable");
+
+  if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+  {
+    if (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)
+    {
+      vbEngineConfParsing->boostDamping.enable = TRUE;
+    }
+    else if (strcmp(ezxml_trimtxt(ez_temp), "NO") == 0)
+    {
+      vbEngineConfParsing->boostDamping.enable = FALSE;
+    }
+    else
+    {
+      printf("ERROR parsing .ini file: Invalid BoostDamping/Enable value (YES or NO)\n");
+      ret = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  for (i = 0; (i < (sizeof(int_params) / sizeof(int_params[0]))) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    ez_temp = ezxml_child(boostDampingConf, int_params[i]);
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+    {
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if (errno != 0)
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid BoostDamping/%s value\n", errno, strerror(errno), int_params[i]);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        *int_values[i] = value;
+      }
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) &&
+      ((vbEngineConfParsing->boostDamping.reconfPerMin == 0) || (vbEngineConfParsing->boostDamping.burst == 0)))
+  {
+    printf("ERROR parsing .ini file: BoostDamping/ReconfPerMin and BoostDamping/Burst shall be greater than 0\n");
+    ret = VB_ENGINE_ERROR_INI_FILE;
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineTrafficForecastParse( ezxml_t trafficForecastConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_temp;
+  INT32U               value;
+  const CHAR          *int_params[] = {"Horizon", "Alpha", "Beta", "Gamma", "SeasonSlots", "BurstThr", "BurstHold"};
+  INT32U              *int_values[] = {&vbEngineConfParsing->trafficForecast.horizon,
+                                       &vbEngineConfParsing->trafficForecast.alpha,
+                                       &vbEngineConfParsing->trafficForecast.beta,
+                                       &vbEngineConfParsing->trafficForecast.gamma,
+                                       &vbEngineConfParsing->trafficForecast.seasonSlots,
+                                       &vbEngineConfParsing->trafficForecast.burstThr,
+                                       &vbEngineConfParsing->trafficForecast.burstHold};
+  INT32U               i;
+
+  ez_temp = ezxml_child(trafficForecastConf, "Enable");
+
+  if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+  {
+    if (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)
+    {
+      vbEngineConfParsing->trafficForecast.enable = TRUE;
+    }
+    else if (strcmp(ezxml_trimtxt(ez_temp), "NO") == 0)
+    {
+      vbEngineConfParsing->trafficForecast.enable = FALSE;
+    }
+    else
+    {
+      printf("ERROR parsing .ini file: Invalid TrafficForecast/Enable value (YES or NO)\n");
+      ret = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  for (i = 0; (i < (sizeof(int_params) / sizeof(int_params[0]))) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    ez_temp = ezxml_child(trafficForecastConf, int_params[i]);
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+    {
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if (errno != 0)
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid TrafficForecast/%s value\n", errno, strerror(errno), int_params[i]);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        *int_values[i] = value;
+      }
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) &&
+      ((vbEngineConfParsing->trafficForecast.alpha == 0) || (vbEngineConfParsing->trafficForecast.alpha > 100) ||
+       (vbEngineConfParsing->trafficForecast.beta > 100) || (vbEngineConfParsing->trafficForecast.gamma > 100)))
+  {
+    printf("ERROR parsing .ini file: TrafficForecast/Alpha shall be in range [1, 100] and TrafficForecast/Beta and TrafficForecast/Gamma in range [0, 100]\n");
+    ret = VB_ENGINE_ERROR_INI_FILE;
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) &&
+      (vbEngineConfParsing->trafficForecast.seasonSlots > VB_ENGINE_TRAFFIC_FORECAST_MAX_SLOTS))
+  {
+    printf("ERROR parsing .ini file: TrafficForecast/SeasonSlots shall not exceed %u\n", VB_ENGINE_TRAFFIC_FORECAST_MAX_SLOTS);
+    ret = VB_ENGINE_ERROR_INI_FILE;
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineSnrLinearCacheParse( ezxml_t snrLinearCacheConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_temp;
+
+  ez_temp = ezxml_child(snrLinearCacheConf, "Enable");
+
+  if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+  {
+    if (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)
+    {
+      vbEngineConfParsing->snrLinearCache.enable = TRUE;
+    }
+    else if (strcmp(ezxml_trimtxt(ez_temp), "NO") == 0)
+    {
+      vbEngineConfParsing->snrLinearCache.enable = FALSE;
+    }
+    else
+    {
+      printf("ERROR parsing .ini file: Invalid SnrLinearCache/Enable value (YES or NO)\n");
+      ret = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineMeasHistoryParse( ezxml_t measHistoryConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_temp;
+  INT32U               value;
+  const CHAR          *bool_params[] = {"Enable", "KeepStable"};
+  BOOLEAN             *bool_values[] = {&vbEngineConfParsing->measHistory.enable,
+                                        &vbEngineConfParsing->measHistory.keepStable};
+  const CHAR          *int_params[] = {"Depth", "MemoryBudget", "MinPlans", "StableTrend", "StableDeviation"};
+  INT32U              *int_values[] = {&vbEngineConfParsing->measHistory.depth,
+                                       &vbEngineConfParsing->measHistory.memoryBudget,
+                                       &vbEngineConfParsing->measHistory.minPlans,
+                                       &vbEngineConfParsing->measHistory.stableTrend,
+                                       &vbEngineConfParsing->measHistory.stableDeviation};
+  INT32U               i;
+
+  for (i = 0; (i < (sizeof(bool_params) / sizeof(bool_params[0]))) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    ez_temp = ezxml_child(measHistoryConf, bool_params[i]);
+
+    if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+    {
+      if (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)
+      {
+        *bool_values[i] = TRUE;
+      }
+      else if (strcmp(ezxml_trimtxt(ez_temp), "NO") == 0)
+      {
+        *bool_values[i] = FALSE;
+      }
+      else
+      {
+        printf("ERROR parsing .ini file: Invalid MeasHistory/%s value (YES or NO)\n", bool_params[i]);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+    }
+  }
+
+  for (i = 0; (i < (sizeof(int_params) / sizeof(int_params[0]))) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    ez_temp = ezxml_child(measHistoryConf, int_params[i]);
+
+    if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+    {
+      errno = 0;
+      value = strtoul(ez_temp->txt, NULL, 0);
+
+      if (errno != 0)
+      {
+        printf("ERROR (%d:%s) parsing .ini file: Invalid MeasHistory/%s value\n", errno, strerror(errno), int_params[i]);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+      else
+      {
+        *int_values[i] = value;
+      }
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) &&
+      ((vbEngineConfParsing->measHistory.depth < 2) ||
+       (vbEngineConfParsing->measHistory.depth > VB_ENGINE_MEAS_HISTORY_MAX_DEPTH)))
+  {
+    printf("ERROR parsing .ini file: MeasHistory/Depth shall be in range [2, %u]\n", VB_ENGINE_MEAS_HISTORY_MAX_DEPTH);
+    ret = VB_ENGINE_ERROR_INI_FILE;
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineThreadPlacementParse( ezxml_t threadPlacementConf )
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t              ez_class;
+  ezxml_t              ez_temp;
+  t_vbThreadClassConf *class_conf;
+  const CHAR          *class_tags[VB_THREAD_CLASS_LAST] = {"Fsm", "Io", "Compute", "Background"};
+  INT32U               i;
+
+  ez_temp = ezxml_child(threadPlacementConf, "Enable");
+
+  if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+  {
+    if (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)
+    {
+      vbEngineConfParsing->threadPlacement.enable = TRUE;
+    }
+    else if (strcmp(ezxml_trimtxt(ez_temp), "NO") == 0)
+    {
+      vbEngineConfParsing->threadPlacement.enable = FALSE;
+    }
+    else
+    {
+      printf("ERROR parsing .ini file: Invalid ThreadPlacement/Enable value (YES or NO)\n");
+      ret = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  for (i = 0; (i < VB_THREAD_CLASS_LAST) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    ez_class = ezxml_child(threadPlacementConf, class_tags[i]);
+    class_conf = &(vbEngineConfParsing->threadPlacement.classes[i]);
+
+    if (ez_class != NULL)
+    {
+      ez_temp = ezxml_child(ez_class, "Cpus");
+
+      if (ez_temp != NULL)
+      {
+        strncpy(class_conf->cpus, ezxml_trimtxt(ez_temp), VB_THREAD_CPU_LIST_LEN - 1);
+      }
+
+      ez_temp = ezxml_child(ez_class, "Policy");
+
+      if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp)[0] != '\0'))
+      {
+        class_conf->policy = VbThreadPolicyStrToEnum(ezxml_trimtxt(ez_temp));
+      }
+
+      ez_temp = ezxml_child(ez_class, "Priority");
+
+      if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+      {
+        class_conf->priority = strtoul(ez_temp->txt, NULL, 0);
+      }
+
+      ez_temp = ezxml_child(ez_class, "Nice");
+
+      if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+      {
+        class_conf->nice = strtol(ez_temp->txt, NULL, 0);
+      }
+
+      ez_temp = ezxml_child(ez_class, "Cgroup");
+
+      if (ez_temp != NULL)
+      {
+        strncpy(class_conf->cgroup, ezxml_trimtxt(ez_temp), VB_THREAD_CGROUP_PATH_LEN - 1);
+      }
+
+      if (VbThreadClassConfCheck(class_conf) != 0)
+      {
+        printf("ERROR parsing .ini file: Invalid ThreadPlacement/%s values (Cpus list, Policy OTHER/FIFO/RR, Priority >= 1 for FIFO/RR, Nice [%d, %d])\n",
+            class_tags[i], VB_THREAD_NICE_MIN, VB_THREAD_NICE_MAX);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineEventSchedParse( ezxml_t eventSchedConf )
+{
+  t_VB_engineErrorCode      ret = VB_ENGINE_ERROR_NONE;
+  ezxml_t                   ez_class;
+  ezxml_t                   ez_temp;
+  t_vbEngineEventClassConf *class_conf;
+  const CHAR               *class_tags[VB_ENGINE_EVENT_CLASS_LAST] = {"Control", "Alignment", "Timeout", "Measure", "Telemetry"};
+  const CHAR               *flow_tags[VB_EA_FLOW_CLASS_LAST] = {"Control", "Measure", "Telemetry"};
+  INT32U                    i;
+
+  for (i = 0; (i < VB_ENGINE_EVENT_CLASS_LAST) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    ez_class = ezxml_child(eventSchedConf, class_tags[i]);
+    class_conf = &(vbEngineConfParsing->eventSched.classes[i]);
+
+    if (ez_class != NULL)
+    {
+      ez_temp = ezxml_child(ez_class, "Weight");
+
+      if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+      {
+        class_conf->weight = strtoul(ez_temp->txt, NULL, 0);
+      }
+
+      ez_temp = ezxml_child(ez_class, "MaxDepth");
+
+      if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+      {
+        class_conf->maxDepth = strtoul(ez_temp->txt, NULL, 0);
+      }
+
+      if ((class_conf->weight < 1) || (class_conf->weight > VB_ENGINE_EVENT_SCHED_MAX_WEIGHT) ||
+          (class_conf->maxDepth < 1) || (class_conf->maxDepth > VB_ENGINE_EVENT_SCHED_MAX_DEPTH))
+      {
+        printf("ERROR parsing .ini file: Invalid EventScheduler/%s values (Weight [1, %u], MaxDepth [1, %u])\n",
+            class_tags[i], VB_ENGINE_EVENT_SCHED_MAX_WEIGHT, VB_ENGINE_EVENT_SCHED_MAX_DEPTH);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+    }
+  }
+
+  ez_class = ezxml_child(eventSchedConf, "DriverCredits");
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (ez_class != NULL))
+  {
+    // Credits advertised to each driver per EA flow class (control frames are never held back)
+    for (i = VB_EA_FLOW_CLASS_MEASURE; (i < VB_EA_FLOW_CLASS_LAST) && (ret == VB_ENGINE_ERROR_NONE); i++)
+    {
+      ez_temp = ezxml_child(ez_class, flow_tags[i]);
+
+      if ((ez_temp != NULL) && (ez_temp->txt != NULL))
+      {
+        vbEngineConfParsing->eventSched.driverCredits[i] = strtoul(ez_temp->txt, NULL, 0);
+      }
+
+      if (vbEngineConfParsing->eventSched.driverCredits[i] > VB_ENGINE_EVENT_SCHED_MAX_DRIVER_CREDITS)
+      {
+        printf("ERROR parsing .ini file: Invalid EventScheduler/DriverCredits/%s value ([0, %u])\n",
+            flow_tags[i], VB_ENGINE_EVENT_SCHED_MAX_DRIVER_CREDITS);
+        ret = VB_ENGINE_ERROR_INI_FILE;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+
+static t_VB_engineErrorCode VbEngineConfFileRead(const char *path, t_vbEngineConf *conf, BOOLEAN reload)
+{
+  t_VB_engineErrorCode error =  VB_ENGINE_ERROR_NONE;
+  ezxml_t              engine = NULL;
+  ezxml_t              drivers_list;
+  ezxml_t              ez_temp;
+  ezxml_t              measure_conf;
+  ezxml_t              cdta_conf;
+  ezxml_t              socket_alive_conf;
+  ezxml_t              user_profiles;
+  ezxml_t              align_params;
+  struct in6_addr      ip_addr;
+  INT16U               num_user_profiles;
+
+  // Section parsers fill the given configuration
+  vbEngineConfParsing = conf;
+  vbEngineConfParsingReload = reload;
+
+  // Init default values
+  vbEngineConfParsing->engineId[0] = '\0';
+  vbEngineConfParsing->serverMode = VB_ENGINE_CONF_DEFAULT_SERVER_MODE;
+  vbEngineConfParsing->serverPort = 0;
+  vbEngineConfParsing->serverIface[0] = '\0';
+  vbEngineConfParsing->outputPath[0] = '\0';
+  vbEngineConfParsing->verboseLevel  = VB_ENGINE_CONF_DEFAULT_VERBOSE_LEVEL;
+  vbEngineConfParsing->consolePort   = VB_ENGINE_CONF_DEFAULT_CONSOLE_PORT;
+  vbEngineConfParsing->trafficMetricsEnabled = VB_ENGINE_CONF_DEFAULT_TRAFFIC_METRICS_ENABLED;
+  vbEngineConfParsing->saveMetricsEnabled = VB_ENGINE_CONF_DEFAULT_SAVE_METRICS;
+  vbEngineConfParsing->maxMetricsLogSize = VB_ENGINE_CONF_DEFAULT_METRICS_MAX_LOG_KB_SPACE;
+  vbEngineConfParsing->eaShmRingSize = VB_ENGINE_CONF_DEFAULT_EA_SHM_RING_SIZE;
+  vbEngineConfParsing->eaIoUring = VB_ENGINE_CONF_DEFAULT_EA_IO_URING;
+  vbEngineConfParsing->clockFutureGuard = VB_ENGINE_CONF_DEFAULT_CLOCK_FUTURE_GUARD;
+  vbEngineConfParsing->boostThresholds[VB_BOOST_THR_TYPE_DEC_BOOST] = VB_ENGINE_CONF_DEFAULT_BOOSTTHR_DEC_BOOST;
+  vbEngineConfParsing->boostThresholds[VB_BOOST_THR_TYPE_INC_BOOST] = VB_ENGINE_CONF_DEFAULT_BOOSTTHR_INC_BOOST;
+  vbEngineConfParsing->vdslCoex = VB_ENGINE_CONF_DEFAULT_VDSL_COEX;
+  vbEngineConfParsing->saveMeasures = VB_ENGINE_CONF_DEFAULT_SAVE_MEASURES;
+  vbEngineConfParsing->vbInUpstream = VB_ENGINE_CONF_DEFAULT_IN_UPSTREAM;
+  vbEngineConfParsing->boostAlgPeriod = VB_ENGINE_CONF_DEFAULT_BOOST_ALG_PERIOD;
+
+  vbEngineConfParsing->psdBandAllocation.numBands200Mhz = VB_ENGINE_HIGH_GRANULARITY_PSD_MNGT;
+  vbEngineConfParsing->psdBandAllocation.numBands100Mhz = VB_ENGINE_MEDIUM_GRANULARITY_PSD_MNGT;
+  vbEngineConfParsing->psdBandAllocation.lastCarrier[0] = VB_ENGINE_CONF_PSD_BAND_0_END; ///< 28  MHz (SISO & MIMO)
+  vbEngineConfParsing->psdBandAllocation.lastCarrier[1] = VB_ENGINE_CONF_PSD_BAND_1_END; ///< 50  MHz (SISO & MIMO)
+  vbEngineConfParsing->psdBandAllocation.lastCarrier[2] = VB_ENGINE_CONF_PSD_BAND_2_END; ///< 96  MHz (SISO & MIMO)
+  vbEngineConfParsing->psdBandAllocation.lastCarrier[3] = VB_ENGINE_CONF_PSD_BAND_3_END; ///< 140 MHz (SISO)
+  vbEngineConfParsing->psdBandAllocation.lastCarrier[4] = VB_ENGINE_CONF_PSD_BAND_4_END; ///< 200 MHz (SISO)
+
+  vbEngineConfParsing->measPlanConf.NumCycles          = VB_ENGINE_CONF_DEFAULT_MEAS_NUM_CYCLES;
+  vbEngineConfParsing->measPlanConf.StorageType        = VB_ENGINE_CONF_DEFAULT_MEAS_STORAGE_TYPE;
+  vbEngineConfParsing->measPlanConf.SymbolsNumber      = VB_ENGINE_CONF_DEFAULT_MEAS_SYMBOLS_NUMBER;
+  vbEngineConfParsing->measPlanConf.TimeAveraging      = VB_ENGINE_CONF_DEFAULT_MEAS_TIME_AVG;
+  vbEngineConfParsing->measPlanConf.FrecuencyAveraging = VB_ENGINE_CONF_DEFAULT_MEAS_FREQ_AVG;
+  vbEngineConfParsing->measPlanConf.Offset             = VB_ENGINE_CONF_DEFAULT_MEAS_OFFSET;
+  vbEngineConfParsing->measPlanConf.Duration           = VB_ENGINE_CONF_DEFAULT_MEAS_DURATION;
+  vbEngineConfParsing->measPlanConf.CFRMeasureType     = VB_ENGINE_CONF_DEFAULT_MEAS_CFR_TYPE;
+  vbEngineConfParsing->measPlanConf.MeasureDataType    = VB_ENGINE_CONF_DEFAULT_MEAS_DATA_TYPE;
+  vbEngineConfParsing->measPlanConf.MeasureDataFormat  = VB_ENGINE_CONF_DEFAULT_MEAS_DATA_FORMAT;
+
+  vbEngineConfParsing->seedConf.enabled                = VB_ENGINE_CONF_DEFAULT_SEED_ENABLE;
+  vbEngineConfParsing->seedConf.minSeedIndex           = VB_ENGINE_CONF_DEFAULT_SEED_MIN_INDEX;
+  vbEngineConfParsing->seedConf.maxSeedindex           = VB_ENGINE_CONF_DEFAULT_SEED_MAX_INDEX;
+  vbEngineConfParsing->seedConf.excludedMacListSize    = 0;
+  vbEngineConfParsing->seedConf.excludedMacList        = NULL;
+
+  vbEngineConfParsing->alignParams.alignMode           = VB_ENGINE_CONF_DEFAULT_ALIGN_MODE;
+  vbEngineConfParsing->alignParams.minPow              = VB_ENGINE_CONF_DEFAULT_ALIGN_MINPOW;
+  vbEngineConfParsing->alignParams.minPowHyst          = VB_ENGINE_CONF_DEFAULT_ALIGN_MINPOWHYST;
+  vbEngineConfParsing->alignParams.reliabilityThr      = VB_ENGINE_CONF_DEFAULT_ALIGN_RELTHR;
+  vbEngineConfParsing->alignParams.prioRefList.size    = 0;
+  vbEngineConfParsing->alignParams.prioRefList.list    = NULL;
+  vbEngineConfParsing->alignParams.metrics             = VB_ENGINE_CONF_DEFAULT_ALIGN_METRICS;
+  vbEngineConfParsing->alignParams.nodeCustomList.size = 0;
+  vbEngineConfParsing->alignParams.nodeCustomList.entries = NULL;
+
+  vbEngineConfParsing->socketAlive.enable              = VB_ENGINE_CONF_DEFAULT_SOCKALIVE_ENABLE;
+  vbEngineConfParsing->socketAlive.period              = VB_ENGINE_CONF_DEFAULT_SOCKALIVE_PERIOD;
+  vbEngineConfParsing->socketAlive.nLostMsgThr         = VB_ENGINE_CONF_DEFAULT_SOCKALIVE_NLOST_THR;
+  
+  vbEngineConfParsing->persistentLog.numLines          = VB_ENGINE_CONF_DEFAULT_PERSLOG_NUMLINES;
+  vbEngineConfParsing->persistentLog.verboseLevel      = VB_ENGINE_CONF_DEFAULT_PERSLOG_VERBOSE;
+  vbEngineConfParsing->persistentLog.circular          = VB_ENGINE_CONF_DEFAULT_PERSLOG_CIRCULAR;
+  vbEngineConfParsing->lineState.enable                = VB_ENGINE_CONF_DEFAULT_LINESTATE_ENABLE;
+  vbEngineConfParsing->lineState.maxLines              = VB_ENGINE_CONF_DEFAULT_LINESTATE_MAXLINES;
+  vbEngineConfParsing->lineState.textFiles             = VB_ENGINE_CONF_DEFAULT_LINESTATE_TEXTFILES;
+  vbEngineConfParsing->fileWriter.flushPeriodMs        = VB_ENGINE_CONF_DEFAULT_FWRITER_FLUSH_PERIOD;
+  vbEngineConfParsing->fileWriter.maxOpenFiles         = VB_ENGINE_CONF_DEFAULT_FWRITER_MAX_OPEN_FILES;
+  vbEngineConfParsing->fileWriter.maxFiles             = VB_ENGINE_CONF_DEFAULT_FWRITER_MAX_FILES;
+  vbEngineConfParsing->fileWriter.maxBufferedBytes     = VB_ENGINE_CONF_DEFAULT_FWRITER_MAX_BUFFERED;
+  vbEngineConfParsing->fileWriter.fsyncPolicy          = VB_ENGINE_CONF_DEFAULT_FWRITER_FSYNC;
+  vbEngineConfParsing->fileWriter.ioUring              = VB_ENGINE_CONF_DEFAULT_FWRITER_IO_URING;
+  vbEngineConfParsing->measStream.enable               = VB_ENGINE_CONF_DEFAULT_MSTREAM_ENABLE;
+  vbEngineConfParsing->measStream.maxSubscribers       = VB_ENGINE_CONF_DEFAULT_MSTREAM_MAX_SUBSCRIBERS;
+  vbEngineConfParsing->measStream.bufferBytes          = VB_ENGINE_CONF_DEFAULT_MSTREAM_BUFFER;
+  strcpy(vbEngineConfParsing->measStream.socketPath, VB_ENGINE_CONF_DEFAULT_MSTREAM_SOCKET);
+  vbEngineConfParsing->xtalkSparsity.enable            = VB_ENGINE_CONF_DEFAULT_XTALK_SPARSITY_ENABLE;
+  vbEngineConfParsing->xtalkSparsity.significanceThr   = VB_ENGINE_CONF_DEFAULT_XTALK_SPARSITY_THR;
+  vbEngineConfParsing->xtalkSparsity.maxError          = VB_ENGINE_CONF_DEFAULT_XTALK_SPARSITY_MAX_ERROR;
+  vbEngineConfParsing->clusterPartition.enable         = VB_ENGINE_CONF_DEFAULT_CLUSTER_PARTITION_ENABLE;
+  vbEngineConfParsing->clusterPartition.apply          = VB_ENGINE_CONF_DEFAULT_CLUSTER_PARTITION_APPLY;
+  vbEngineConfParsing->clusterPartition.couplingThr    = VB_ENGINE_CONF_DEFAULT_CLUSTER_PARTITION_THR;
+  vbEngineConfParsing->clusterPartition.maxLines       = VB_ENGINE_CONF_DEFAULT_CLUSTER_PARTITION_LINES;
+  vbEngineConfParsing->clusterPartition.holdTime       = VB_ENGINE_CONF_DEFAULT_CLUSTER_PARTITION_HOLD;
+  vbEngineConfParsing->cfrResolution.enable            = VB_ENGINE_CONF_DEFAULT_CFR_RESOLUTION_ENABLE;
+  vbEngineConfParsing->cfrResolution.maxDecimation     = VB_ENGINE_CONF_DEFAULT_CFR_RESOLUTION_MAX_DECIM;
+  vbEngineConfParsing->cfrResolution.maxError          = VB_ENGINE_CONF_DEFAULT_CFR_RESOLUTION_MAX_ERROR;
+  vbEngineConfParsing->cfrResolution.refreshPlans      = VB_ENGINE_CONF_DEFAULT_CFR_RESOLUTION_REFRESH;
+  vbEngineConfParsing->snrTracking.enable              = VB_ENGINE_CONF_DEFAULT_SNR_TRACKING_ENABLE;
+  vbEngineConfParsing->snrTracking.period              = VB_ENGINE_CONF_DEFAULT_SNR_TRACKING_PERIOD;
+  vbEngineConfParsing->snrTracking.linesPerRound       = VB_ENGINE_CONF_DEFAULT_SNR_TRACKING_LINES;
+  vbEngineConfParsing->snrTracking.errorThr            = VB_ENGINE_CONF_DEFAULT_SNR_TRACKING_ERROR_THR;
+  vbEngineConfParsing->snrTracking.escalateHold        = VB_ENGINE_CONF_DEFAULT_SNR_TRACKING_HOLD;
+  vbEngineConfParsing->boostDamping.enable             = VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_ENABLE;
+  vbEngineConfParsing->boostDamping.nodeDwell          = VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_NODE_DWELL;
+  vbEngineConfParsing->boostDamping.clusterDwell       = VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_CLUST_DWELL;
+  vbEngineConfParsing->boostDamping.reconfPerMin       = VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_RECONF_MIN;
+  vbEngineConfParsing->boostDamping.burst              = VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_BURST;
+  vbEngineConfParsing->boostDamping.applyWindow        = VB_ENGINE_CONF_DEFAULT_BOOST_DAMPING_WINDOW;
+  vbEngineConfParsing->trafficForecast.enable          = VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_ENABLE;
+  vbEngineConfParsing->trafficForecast.horizon         = VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_HORIZON;
+  vbEngineConfParsing->trafficForecast.alpha           = VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_ALPHA;
+  vbEngineConfParsing->trafficForecast.beta            = VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_BETA;
+  vbEngineConfParsing->trafficForecast.gamma           = VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_GAMMA;
+  vbEngineConfParsing->trafficForecast.seasonSlots     = VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_SLOTS;
+  vbEngineConfParsing->trafficForecast.burstThr        = VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_BURST;
+  vbEngineConfParsing->trafficForecast.burstHold       = VB_ENGINE_CONF_DEFAULT_TRAFFIC_FORECAST_HOLD;
+  vbEngineConfParsing->snrLinearCache.enable           = VB_ENGINE_CONF_DEFAULT_SNR_LINEAR_CACHE_ENABLE;
+  vbEngineConfParsing->measHistory.enable              = VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_ENABLE;
+  vbEngineConfParsing->measHistory.depth               = VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_DEPTH;
+  vbEngineConfParsing->measHistory.memoryBudget        = VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_BUDGET;
+  vbEngineConfParsing->measHistory.minPlans            = VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_MIN_PLANS;
+  vbEngineConfParsing->measHistory.stableTrend         = VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_TREND;
+  vbEngineConfParsing->measHistory.stableDeviation     = VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_DEVIATION;
+  vbEngineConfParsing->measHistory.keepStable          = VB_ENGINE_CONF_DEFAULT_MEAS_HISTORY_KEEP;
+  vbEngineConfParsing->threadPlacement.enable          = VB_ENGINE_CONF_DEFAULT_THREAD_PLACEMENT_ENABLE;
+  vbEngineConfParsing->eventSched.classes[VB_ENGINE_EVENT_CLASS_CONTROL].weight     = VB_ENGINE_EVENT_SCHED_DEFAULT_CONTROL_WEIGHT;
+  vbEngineConfParsing->eventSched.classes[VB_ENGINE_EVENT_CLASS_CONTROL].maxDepth   = VB_ENGINE_EVENT_SCHED_DEFAULT_CONTROL_DEPTH;
+  vbEngineConfParsing->eventSched.classes[VB_ENGINE_EVENT_CLASS_ALIGNMENT].weight   = VB_ENGINE_EVENT_SCHED_DEFAULT_ALIGNMENT_WEIGHT;
+  vbEngineConfParsing->eventSched.classes[VB_ENGINE_EVENT_CLASS_ALIGNMENT].maxDepth = VB_ENGINE_EVENT_SCHED_DEFAULT_ALIGNMENT_DEPTH;
+  vbEngineConfParsing->eventSched.classes[VB_ENGINE_EVENT_CLASS_TIMEOUT].weight     = VB_ENGINE_EVENT_SCHED_DEFAULT_TIMEOUT_WEIGHT;
+  vbEngineConfParsing->eventSched.classes[VB_ENGINE_EVENT_CLASS_TIMEOUT].maxDepth   = VB_ENGINE_EVENT_SCHED_DEFAULT_TIMEOUT_DEPTH;
+  vbEngineConfParsing->eventSched.classes[VB_ENGINE_EVENT_CLASS_MEASURE].weight     = VB_ENGINE_EVENT_SCHED_DEFAULT_MEASURE_WEIGHT;
+  vbEngineConfParsing->eventSched.classes[VB_ENGINE_EVENT_CLASS_MEASURE].maxDepth   = VB_ENGINE_EVENT_SCHED_DEFAULT_MEASURE_DEPTH;
+  vbEngineConfParsing->eventSched.classes[VB_ENGINE_EVENT_CLASS_TELEMETRY].weight   = VB_ENGINE_EVENT_SCHED_DEFAULT_TELEMETRY_WEIGHT;
+  vbEngineConfParsing->eventSched.classes[VB_ENGINE_EVENT_CLASS_TELEMETRY].maxDepth = VB_ENGINE_EVENT_SCHED_DEFAULT_TELEMETRY_DEPTH;
+  vbEngineConfParsing->eventSched.driverCredits[VB_EA_FLOW_CLASS_CONTROL]          = 0;
+  vbEngineConfParsing->eventSched.driverCredits[VB_EA_FLOW_CLASS_MEASURE]          = VB_ENGINE_EVENT_SCHED_DEFAULT_MEASURE_CREDITS;
+  vbEngineConfParsing->eventSched.driverCredits[VB_EA_FLOW_CLASS_TELEMETRY]        = VB_ENGINE_EVENT_SCHED_DEFAULT_TELEMETRY_CREDITS;
+  vbEngineConfParsing->driversList.size                = 0;
+  vbEngineConfParsing->driversList.entries             = NULL;
+
+  if (path == NULL)
+  {
+    error = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else
+  {
+    engine = ezxml_parse_file(path);
+
+    if(engine == NULL)
+    {
+      printf("Engine Conf: .ini file could not be opened\n");
+      error = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    // Read ConnectionMode
+    ez_temp = ezxml_child(engine, "ServerConnMode");
+    if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+    {
+      vbEngineConfParsing->serverMode = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+    }
+    else
+    {
+      printf("Engine Conf: Error reading ServerConnMode parameter\n");
+      error = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    if (vbEngineConfParsing->serverMode)
+    {
+      // Read ServerIface
+      ez_temp = ezxml_child(engine, "ServerIface");
+      if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+      {
+        strncpy(vbEngineConfParsing->serverIface, ezxml_trimtxt(ez_temp), VB_ENGINE_CONF_MAX_IFACE_LENGTH);
+        vbEngineConfParsing->serverIface[VB_ENGINE_CONF_MAX_IFACE_LENGTH - 1] = '\0';
+      }
+      else
+      {
+        printf("Engine Conf: Error reading ServerIface parameter\n");
+        error = VB_ENGINE_ERROR_INI_FILE;
+      }
+
+      if (error == VB_ENGINE_ERROR_NONE)
+      {
+        // Read ServerPort
+        ez_temp = ezxml_child(engine, "ServerPort");
+        if((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
+        {
+          errno = 0;
+          vbEngineConfParsing->serverPort = strtol(ezxml_txt(ez_temp), NULL, 0);
+
+          if(errno != 0)
+          {
+            printf("Engine Conf: Error reading ServerPort parameter\n");
+            error = VB_ENGINE_ERROR_INI_FILE;
+          }
+        }
+        else
+        {
+          error = VB_ENGINE_ERROR_INI_FILE;
+        }
+      }
+    } //serverMode
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    // Read vdslCoex
+    ez_temp = ezxml_child(engine, "vdslCoex");
+    if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+    {
+      vbEngineConfParsing->vdslCoex = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+    }
+    else
+    {
+      printf("Engine Conf: Error reading vdslCoex parameter\n");
+      error = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    // Read SaveMeasuresToDisk
+    ez_temp = ezxml_child(engine, "SaveMeasuresToDisk");
+    if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
+    {
+      vbEngineConfParsing->saveMeasures = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+    }
+    else
     {
       // Use default value
     }
@@ -1368,8 +2586,8 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     ez_temp = ezxml_child(engine, "OutputPath");
     if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
     {
-      strncpy(vbEngineConf.outputPath, ezxml_trimtxt(ez_temp), VB_PARSE_MAX_PATH_LEN);
-      vbEngineConf.outputPath[VB_PARSE_MAX_PATH_LEN - 1] = '\0';
+      strncpy(vbEngineConfParsing->outputPath, ezxml_trimtxt(ez_temp), VB_PARSE_MAX_PATH_LEN);
+      vbEngineConfParsing->outputPath[VB_PARSE_MAX_PATH_LEN - 1] = '\0';
     }
     else
     {
@@ -1385,7 +2603,7 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     if((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
     {
       errno = 0;
-      vbEngineConf.verboseLevel = strtol(ezxml_txt(ez_temp), NULL, 0);
+      vbEngineConfParsing->verboseLevel = strtol(ezxml_txt(ez_temp), NULL, 0);
       if(errno != 0)
       {
         printf("Engine Conf: Error incorrect value in VerboseLevel parameter\n");
@@ -1405,7 +2623,7 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
     {
       errno = 0;
-      vbEngineConf.consolePort = (INT16U)strtol(ezxml_txt(ez_temp), NULL, 0);
+      vbEngineConfParsing->consolePort = (INT16U)strtol(ezxml_txt(ez_temp), NULL, 0);
 
       if (errno != 0)
       {
@@ -1425,7 +2643,7 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     ez_temp = ezxml_child(engine, "VbInUpstream");
     if ((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
     {
-      vbEngineConf.vbInUpstream = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+      vbEngineConfParsing->vbInUpstream = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
     }
     else
     {
@@ -1436,7 +2654,7 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     ez_temp = ezxml_child(engine, "EnableTrafficAndBoostMetrics");
     if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
     {
-      vbEngineConf.trafficMetricsEnabled = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+      vbEngineConfParsing->trafficMetricsEnabled = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
     }
     else
     {
@@ -1447,7 +2665,7 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     ez_temp = ezxml_child(engine, "SaveMetricsToDisk");
     if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
     {
-      vbEngineConf.saveMetricsEnabled = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+      vbEngineConfParsing->saveMetricsEnabled = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
     }
     else
     {
@@ -1459,7 +2677,7 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     if((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
     {
       errno = 0;
-      vbEngineConf.maxMetricsLogSize = strtol(ezxml_txt(ez_temp), NULL, 0);
+      vbEngineConfParsing->maxMetricsLogSize = strtol(ezxml_txt(ez_temp), NULL, 0);
 
       if(errno != 0)
       {
@@ -1471,6 +2689,58 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     {
       // Use default value
     }
+
+    // Read EAShmRingSize
+    ez_temp = ezxml_child(engine, "EAShmRingSize");
+    if((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
+    {
+      errno = 0;
+      vbEngineConfParsing->eaShmRingSize = (INT32U)strtoul(ezxml_txt(ez_temp), NULL, 0);
+
+      if((errno != 0) || (VbEAShmRingSizeCheck(vbEngineConfParsing->eaShmRingSize) == FALSE))
+      {
+        printf("Engine Conf: Error incorrect value in EAShmRingSize parameter (0 or power of 2 in [%u, %u])\n",
+            VB_EA_SHM_RING_MIN_SIZE, VB_EA_SHM_RING_MAX_SIZE);
+        error = VB_ENGINE_ERROR_INI_FILE;
+      }
+    }
+    else
+    {
+      // Use default value
+    }
+
+    // Read EAIoUring
+    ez_temp = ezxml_child(engine, "EAIoUring");
+    if((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
+    {
+      vbEngineConfParsing->eaIoUring = (strcmp(ezxml_trimtxt(ez_temp), "YES") == 0)? TRUE:FALSE;
+    }
+    else
+    {
+      // Use default value
+    }
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    // Read fixed guard of future timestamps
+    ez_temp = ezxml_child(engine, "ClockFutureGuard");
+    if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
+    {
+      errno = 0;
+      vbEngineConfParsing->clockFutureGuard = (INT32U)strtoul(ezxml_txt(ez_temp), NULL, 0);
+
+      if ((errno != 0) || (vbEngineConfParsing->clockFutureGuard > VB_ENGINE_CONF_CLOCK_FUTURE_GUARD_MAX))
+      {
+        printf("Engine Conf: Error incorrect value in ClockFutureGuard parameter (max %u ms)\n",
+            VB_ENGINE_CONF_CLOCK_FUTURE_GUARD_MAX);
+        error = VB_ENGINE_ERROR_INI_FILE;
+      }
+    }
+    else
+    {
+      // Use default value
+    }
   }
 
   if (error == VB_ENGINE_ERROR_NONE)
@@ -1480,7 +2750,7 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
     {
       errno = 0;
-      vbEngineConf.alignParams.alignMode = (t_VBAlignmentMode)strtol(ezxml_txt(ez_temp), NULL, 0);
+      vbEngineConfParsing->alignParams.alignMode = (t_VBAlignmentMode)strtol(ezxml_txt(ez_temp), NULL, 0);
 
       if (errno != 0)
       {
@@ -1501,7 +2771,7 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     if ((ez_temp != NULL) && (ezxml_txt(ez_temp) != NULL))
     {
       errno = 0;
-      vbEngineConf.boostAlgPeriod = (INT16U)strtol(ezxml_txt(ez_temp), NULL, 0);
+      vbEngineConfParsing->boostAlgPeriod = (INT16U)strtol(ezxml_txt(ez_temp), NULL, 0);
 
       if (errno != 0)
       {
@@ -1521,8 +2791,8 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     ez_temp = ezxml_child(engine, "EngineId");
     if((ez_temp != NULL) && (ezxml_trimtxt(ez_temp) != NULL))
     {
-      strncpy(vbEngineConf.engineId, ezxml_trimtxt(ez_temp), VB_ENGINE_ID_MAX_SIZE);
-      vbEngineConf.engineId[VB_ENGINE_ID_MAX_SIZE - 1] = '\0';
+      strncpy(vbEngineConfParsing->engineId, ezxml_trimtxt(ez_temp), VB_ENGINE_ID_MAX_SIZE);
+      vbEngineConfParsing->engineId[VB_ENGINE_ID_MAX_SIZE - 1] = '\0';
     }
     else
     {
@@ -1560,7 +2830,7 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
 
       if (error == VB_ENGINE_ERROR_NONE)
       {
-        vbEngineConf.boostThresholds[VB_BOOST_THR_TYPE_DEC_BOOST] = strtoul(dec_boost_thr, NULL, 0);
+        vbEngineConfParsing->boostThresholds[VB_BOOST_THR_TYPE_DEC_BOOST] = strtoul(dec_boost_thr, NULL, 0);
 
         if (errno != 0)
         {
@@ -1570,7 +2840,7 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
 
       if (error == VB_ENGINE_ERROR_NONE)
       {
-        vbEngineConf.boostThresholds[VB_BOOST_THR_TYPE_INC_BOOST] = strtoul(inc_boost_thr, NULL, 0);
+        vbEngineConfParsing->boostThresholds[VB_BOOST_THR_TYPE_INC_BOOST] = strtoul(inc_boost_thr, NULL, 0);
 
         if (errno != 0)
         {
@@ -1580,138 +2850,268 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     }
     else
     {
-      // Use default value
+      // Use default value
+    }
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    cdta_conf = ezxml_child(engine, "CDTA");
+
+    if(cdta_conf != NULL)
+    {
+      error = VbEngineCDTAConfigurationParse( cdta_conf, &vbEngineConfParsing->cdtaConf );
+    }
+    else
+    {
+      printf("Engine Conf: Error reading CDTA Configuration section\n");
+      error = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    ezxml_t              seed_conf;
+
+    seed_conf = ezxml_child(engine, "AutomaticSeed");
+
+    if(seed_conf != NULL)
+    {
+      error = VbEngineSeedConfigurationParse(seed_conf);
+    }
+    else
+    {
+      printf("Engine Conf: Error reading Automatic Seed Configuration section\n");
+      error = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    measure_conf = ezxml_child(engine, "MeasureConfiguration");
+
+    if(measure_conf != NULL)
+    {
+      error = VbEngineMeasureConfigurationParse( measure_conf, &vbEngineConfParsing->measPlanConf );
+    }
+    else
+    {
+      // Use default value
+    }
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    socket_alive_conf = ezxml_child(engine, "SocketAlive");
+
+    if(socket_alive_conf != NULL)
+    {
+      error = VbEngineSocketAliveConfigurationParse( socket_alive_conf, &vbEngineConfParsing->socketAlive );
+    }
+    else
+    {
+      // Use default value
+    }
+  }
+
+  //Parse drivers list only in client mode
+  if ((error == VB_ENGINE_ERROR_NONE) && (vbEngineConfParsing->serverMode == FALSE))
+  {
+    drivers_list = ezxml_child(engine, "DriversList");
+
+    if (drivers_list != NULL)
+    {
+      error = DriverListParse(drivers_list);
+    }
+    else
+    {
+      printf("Engine Conf: Error DriversList not defined\n");
+      error = VB_ENGINE_ERROR_INI_FILE;
+    }
+  }
+  else if((error == VB_ENGINE_ERROR_NONE) && (vbEngineConfParsing->serverMode == TRUE) && (reload == FALSE))
+  {
+    // Init EAInterface with the server thread
+    error = VbEngineEAInterfaceInit(vbEngineConfParsing->serverIface, ip_addr,
+        vbEngineConfParsing->serverPort, NULL, VB_EA_TYPE_SERVER);
+  }
+
+  if(error == VB_ENGINE_ERROR_NONE)
+  {
+    ezxml_t              slas_definition;
+
+    slas_definition = ezxml_child(engine, "SLAsDefinition");
+    if(slas_definition != NULL)
+    {
+      for (slas_definition = ezxml_child(slas_definition, "SLAx"), vbEngineConfParsing->sla.numSlas = 0;
+          ((slas_definition != NULL) && (vbEngineConfParsing->sla.numSlas < VB_ENGINE_CONF_SLA_DEFINITION_MAX)) ; slas_definition = slas_definition->next, vbEngineConfParsing->sla.numSlas++)
+      {
+        error = SLAsDefinitionFileParse(slas_definition, vbEngineConfParsing->sla.numSlas);
+      }
+    }
+  }
+
+  if(error == VB_ENGINE_ERROR_NONE)
+  {
+    user_profiles = ezxml_child(engine, "UserProfiles");
+    if(user_profiles != NULL)
+    {
+      for (user_profiles = ezxml_child(user_profiles, "UserProfile"), num_user_profiles = 0;
+           user_profiles != NULL ; user_profiles = user_profiles->next, num_user_profiles++)
+      {
+        error = UserProfileFileParse(user_profiles, num_user_profiles);
+      }
+    }
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    align_params = ezxml_child(engine, "AlignParams");
+
+    if (align_params != NULL)
+    {
+      error = VbEngineAlignParamsParse( align_params );
+    }
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    align_params = ezxml_child(engine, "PersistentLog");
+
+    if (align_params != NULL)
+    {
+      error = VbEnginePersistentLogParse( align_params );
+    }
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    align_params = ezxml_child(engine, "LineState");
+
+    if (align_params != NULL)
+    {
+      error = VbEngineLineStateParse( align_params );
     }
   }
 
   if (error == VB_ENGINE_ERROR_NONE)
   {
-    cdta_conf = ezxml_child(engine, "CDTA");
+    align_params = ezxml_child(engine, "FileWriter");
 
-    if(cdta_conf != NULL)
-    {
-      error = VbEngineCDTAConfigurationParse( cdta_conf );
-    }
-    else
+    if (align_params != NULL)
     {
-      printf("Engine Conf: Error reading CDTA Configuration section\n");
-      error = VB_ENGINE_ERROR_INI_FILE;
+      error = VbEngineFileWriterParse( align_params );
     }
   }
 
   if (error == VB_ENGINE_ERROR_NONE)
   {
-    ezxml_t              seed_conf;
-
-    seed_conf = ezxml_child(engine, "AutomaticSeed");
+    align_params = ezxml_child(engine, "MeasStream");
 
-    if(seed_conf != NULL)
-    {
-      error = VbEngineSeedConfigurationParse(seed_conf);
-    }
-    else
+    if (align_params != NULL)
     {
-      printf("Engine Conf: Error reading Automatic Seed Configuration section\n");
-      error = VB_ENGINE_ERROR_INI_FILE;
+      error = VbEngineMeasStreamParse( align_params );
     }
   }
 
-
   if (error == VB_ENGINE_ERROR_NONE)
   {
-    measure_conf = ezxml_child(engine, "MeasureConfiguration");
+    align_params = ezxml_child(engine, "XtalkSparsity");
 
-    if(measure_conf != NULL)
-    {
-      error = VbEngineMeasureConfigurationParse( measure_conf );
-    }
-    else
+    if (align_params != NULL)
     {
-      // Use default value
+      error = VbEngineXtalkSparsityParse( align_params );
     }
   }
 
   if (error == VB_ENGINE_ERROR_NONE)
   {
-    socket_alive_conf = ezxml_child(engine, "SocketAlive");
+    align_params = ezxml_child(engine, "ClusterPartition");
 
-    if(socket_alive_conf != NULL)
+    if (align_params != NULL)
     {
-      error = VbEngineSocketAliveConfigurationParse( socket_alive_conf );
+      error = VbEngineClusterPartitionParse( align_params );
     }
-    else
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    align_params = ezxml_child(engine, "CfrResolution");
+
+    if (align_params != NULL)
     {
-      // Use default value
+      error = VbEngineCfrResolutionParse( align_params );
     }
   }
 
-  //Parse drivers list only in client mode
-  if ((error == VB_ENGINE_ERROR_NONE) && (vbEngineConf.serverMode == FALSE))
+  if (error == VB_ENGINE_ERROR_NONE)
   {
-    drivers_list = ezxml_child(engine, "DriversList");
+    align_params = ezxml_child(engine, "SnrTracking");
 
-    if (drivers_list != NULL)
+    if (align_params != NULL)
     {
-      error = DriverListParse(drivers_list);
+      error = VbEngineSnrTrackingParse( align_params );
     }
-    else
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    align_params = ezxml_child(engine, "BoostDamping");
+
+    if (align_params != NULL)
     {
-      printf("Engine Conf: Error DriversList not defined\n");
-      error = VB_ENGINE_ERROR_INI_FILE;
+      error = VbEngineBoostDampingParse( align_params );
     }
   }
-  else if((error == VB_ENGINE_ERROR_NONE) && (vbEngineConf.serverMode == TRUE))
+
+  if (error == VB_ENGINE_ERROR_NONE)
   {
-    // Init EAInterface with the server thread
-    error = VbEngineEAInterfaceInit(vbEngineConf.serverIface, ip_addr,
-        vbEngineConf.serverPort, NULL, VB_EA_TYPE_SERVER);
+    align_params = ezxml_child(engine, "TrafficForecast");
+
+    if (align_params != NULL)
+    {
+      error = VbEngineTrafficForecastParse( align_params );
+    }
   }
 
-  if(error == VB_ENGINE_ERROR_NONE)
+  if (error == VB_ENGINE_ERROR_NONE)
   {
-    ezxml_t              slas_definition;
+    align_params = ezxml_child(engine, "SnrLinearCache");
 
-    slas_definition = ezxml_child(engine, "SLAsDefinition");
-    if(slas_definition != NULL)
+    if (align_params != NULL)
     {
-      for (slas_definition = ezxml_child(slas_definition, "SLAx"), vbEngineConf.sla.numSlas = 0;
-          ((slas_definition != NULL) && (vbEngineConf.sla.numSlas < VB_ENGINE_CONF_SLA_DEFINITION_MAX)) ; slas_definition = slas_definition->next, vbEngineConf.sla.numSlas++)
-      {
-        error = SLAsDefinitionFileParse(slas_definition, vbEngineConf.sla.numSlas);
-      }
+      error = VbEngineSnrLinearCacheParse( align_params );
     }
   }
 
-  if(error == VB_ENGINE_ERROR_NONE)
+  if (error == VB_ENGINE_ERROR_NONE)
   {
-    user_profiles = ezxml_child(engine, "UserProfiles");
-    if(user_profiles != NULL)
+    align_params = ezxml_child(engine, "MeasHistory");
+
+    if (align_params != NULL)
     {
-      for (user_profiles = ezxml_child(user_profiles, "UserProfile"), num_user_profiles = 0;
-           user_profiles != NULL ; user_profiles = user_profiles->next, num_user_profiles++)
-      {
-        error = UserProfileFileParse(user_profiles, num_user_profiles);
-      }
+      error = VbEngineMeasHistoryParse( align_params );
     }
   }
 
   if (error == VB_ENGINE_ERROR_NONE)
   {
-    align_params = ezxml_child(engine, "AlignParams");
+    align_params = ezxml_child(engine, "ThreadPlacement");
 
     if (align_params != NULL)
     {
-      error = VbEngineAlignParamsParse( align_params );
+      error = VbEngineThreadPlacementParse( align_params );
     }
   }
 
   if (error == VB_ENGINE_ERROR_NONE)
   {
-    align_params = ezxml_child(engine, "PersistentLog");
+    align_params = ezxml_child(engine, "EventScheduler");
 
     if (align_params != NULL)
     {
-      error = VbEnginePersistentLogParse( align_params );
+      error = VbEngineEventSchedParse( align_params );
     }
   }
 
@@ -1720,11 +3120,269 @@ static t_VB_engineErrorCode VbEngineConfFileRead(const char *path)
     ezxml_free(engine);
   }
 
+  vbEngineConfParsing = &vbEngineConf;
+  vbEngineConfParsingReload = FALSE;
+
   return error;
 }
 
 /************************************************************************/
 
+static BOOLEAN VbEngineConfMacListEqual(const t_macList *a, const t_macList *b)
+{
+  BOOLEAN equal;
+
+  equal = (a->size == b->size)?TRUE:FALSE;
+
+  if ((equal == TRUE) && (a->size > 0))
+  {
+    equal = (memcmp(a->list, b->list, a->size * ETH_ALEN) == 0)?TRUE:FALSE;
+  }
+
+  return equal;
+}
+
+/************************************************************************/
+
+static BOOLEAN VbEngineConfAlignEqual(const t_alignParams *a, const t_alignParams *b)
+{
+  BOOLEAN equal;
+  INT32U  entry_idx;
+
+  equal = ((a->reliabilityThr == b->reliabilityThr) &&
+           (a->minPow == b->minPow) &&
+           (a->minPowHyst == b->minPowHyst) &&
+           (a->metrics == b->metrics) &&
+           (a->nodeCustomList.size == b->nodeCustomList.size))?TRUE:FALSE;
+
+  if (equal == TRUE)
+  {
+    equal = VbEngineConfMacListEqual(&a->prioRefList, &b->prioRefList);
+  }
+
+  for (entry_idx = 0; (equal == TRUE) && (entry_idx < a->nodeCustomList.size); entry_idx++)
+  {
+    if (MACAddrQuickCmp(a->nodeCustomList.entries[entry_idx].targetNode,
+                        b->nodeCustomList.entries[entry_idx].targetNode) == FALSE)
+    {
+      equal = FALSE;
+    }
+    else
+    {
+      equal = VbEngineConfMacListEqual(&a->nodeCustomList.entries[entry_idx].blackList,
+                                       &b->nodeCustomList.entries[entry_idx].blackList);
+    }
+  }
+
+  return equal;
+}
+
+/************************************************************************/
+
+static BOOLEAN VbEngineConfSeedEqual(const t_seedConf *a, const t_seedConf *b)
+{
+  BOOLEAN equal;
+
+  equal = ((a->enabled == b->enabled) &&
+           (a->minSeedIndex == b->minSeedIndex) &&
+           (a->maxSeedindex == b->maxSeedindex) &&
+           (a->excludedMacListSize == b->excludedMacListSize))?TRUE:FALSE;
+
+  if ((equal == TRUE) && (a->excludedMacListSize > 0))
+  {
+    equal = (memcmp(a->excludedMacList, b->excludedMacList, a->excludedMacListSize * ETH_ALEN) == 0)?TRUE:FALSE;
+  }
+
+  return equal;
+}
+
+/************************************************************************/
+
+/**
+ * @brief Looks for a parameter that can not be changed without restarting the engine
+ * @return Name of first changed parameter or NULL if none has changed
+ **/
+static const CHAR *VbEngineConfRestartParamFind(const t_vbEngineConf *running, const t_vbEngineConf *candidate)
+{
+  const CHAR *param = NULL;
+
+  if (strcmp(running->engineId, candidate->engineId) != 0)
+  {
+    param = "EngineId";
+  }
+  else if ((running->serverMode != candidate->serverMode) ||
+           (running->serverPort != candidate->serverPort) ||
+           (strcmp(running->serverIface, candidate->serverIface) != 0))
+  {
+    param = "EngineConnection";
+  }
+  else if (strcmp(running->outputPath, candidate->outputPath) != 0)
+  {
+    param = "DebugOutputPath";
+  }
+  else if (running->consolePort != candidate->consolePort)
+  {
+    param = "ConsolePort";
+  }
+  else if ((running->trafficMetricsEnabled != candidate->trafficMetricsEnabled) ||
+           (running->saveMetricsEnabled != candidate->saveMetricsEnabled) ||
+           (running->maxMetricsLogSize != candidate->maxMetricsLogSize))
+  {
+    param = "TrafficMetrics";
+  }
+  else if (running->vdslCoex != candidate->vdslCoex)
+  {
+    param = "VDSLCoex";
+  }
+  else if (running->vbInUpstream != candidate->vbInUpstream)
+  {
+    param = "VBInUpstream";
+  }
+  else if (running->alignParams.alignMode != candidate->alignParams.alignMode)
+  {
+    param = "AlignParams>Mode";
+  }
+  else if (memcmp(&running->persistentLog, &candidate->persistentLog, sizeof(t_persistentLog)) != 0)
+  {
+    param = "PersistentLog";
+  }
+  else if (memcmp(&running->lineState, &candidate->lineState, sizeof(t_lineStateConf)) != 0)
+  {
+    param = "LineState";
+  }
+  else if (memcmp(&running->fileWriter, &candidate->fileWriter, sizeof(t_vbFileWriterConf)) != 0)
+  {
+    param = "FileWriter";
+  }
+  else if ((running->measStream.enable != candidate->measStream.enable) ||
+           (running->measStream.maxSubscribers != candidate->measStream.maxSubscribers) ||
+           (running->measStream.bufferBytes != candidate->measStream.bufferBytes) ||
+           (strcmp(running->measStream.socketPath, candidate->measStream.socketPath) != 0))
+  {
+    param = "MeasStream";
+  }
+  else if (memcmp(&running->socketAlive, &candidate->socketAlive, sizeof(t_socketAlive)) != 0)
+  {
+    param = "SocketAlive";
+  }
+  else if ((running->driversList.size != candidate->driversList.size) ||
+           ((running->driversList.size > 0) &&
+            (memcmp(running->driversList.entries, candidate->driversList.entries,
+                    running->driversList.size * sizeof(t_driverConfEntry)) != 0)))
+  {
+    param = "DriversList";
+  }
+
+  return param;
+}
+
+/************************************************************************/
+
+static INT32U VbEngineConfLiveChangesGet(const t_vbEngineConf *running, const t_vbEngineConf *candidate)
+{
+  INT32U changes = 0;
+
+  if (running->verboseLevel != candidate->verboseLevel)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_VERBOSE);
+  }
+
+  if (memcmp(running->boostThresholds, candidate->boostThresholds, sizeof(running->boostThresholds)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_BOOST_THR);
+  }
+
+  if (running->boostAlgPeriod != candidate->boostAlgPeriod)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_BOOST_PERIOD);
+  }
+
+  if ((memcmp(running->userProfile, candidate->userProfile, sizeof(running->userProfile)) != 0) ||
+      (memcmp(&running->sla, &candidate->sla, sizeof(t_vbEngineSLAs)) != 0))
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_PROFILES);
+  }
+
+  if (memcmp(&running->cdtaConf, &candidate->cdtaConf, sizeof(t_cdtaConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_CDTA);
+  }
+
+  if (memcmp(&running->measPlanConf, &candidate->measPlanConf, sizeof(t_measconfdata)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_MEAS_PLAN);
+  }
+
+  if (VbEngineConfAlignEqual(&running->alignParams, &candidate->alignParams) == FALSE)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_ALIGN);
+  }
+
+  if (VbEngineConfSeedEqual(&running->seedConf, &candidate->seedConf) == FALSE)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_SEED);
+  }
+
+  if (running->saveMeasures != candidate->saveMeasures)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_SAVE_MEASURES);
+  }
+
+  if (memcmp(&running->xtalkSparsity, &candidate->xtalkSparsity, sizeof(t_vbEngineXtalkSparsityConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_XTALK_SPARSITY);
+  }
+
+  if (memcmp(&running->clusterPartition, &candidate->clusterPartition, sizeof(t_vbEngineClusterPartitionConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_CLUSTER_PARTITION);
+  }
+
+  if (memcmp(&running->cfrResolution, &candidate->cfrResolution, sizeof(t_vbEngineCfrResolutionConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_CFR_RESOLUTION);
+  }
+
+  if (memcmp(&running->snrTracking, &candidate->snrTracking, sizeof(t_vbEngineSnrTrackingConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_SNR_TRACKING);
+  }
+
+  if (memcmp(&running->boostDamping, &candidate->boostDamping, sizeof(t_vbEngineBoostDampingConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_BOOST_DAMPING);
+  }
+
+  if (memcmp(&running->trafficForecast, &candidate->trafficForecast, sizeof(t_vbEngineTrafficForecastConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_TRAFFIC_FORECAST);
+  }
+
+  if (memcmp(&running->snrLinearCache, &candidate->snrLinearCache, sizeof(t_vbEngineSnrLinearCacheConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_SNR_LINEAR_CACHE);
+  }
+
+  if (memcmp(&running->measHistory, &candidate->measHistory, sizeof(t_vbEngineMeasHistoryConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_MEAS_HISTORY);
+  }
+
+  if (memcmp(&running->threadPlacement, &candidate->threadPlacement, sizeof(t_vbThreadPlacementConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_THREAD_PLACEMENT);
+  }
+
+  if (memcmp(&running->eventSched, &candidate->eventSched, sizeof(t_vbEngineEventSchedConf)) != 0)
+  {
+    changes |= (1U << VB_ENGINE_CONF_RELOAD_SECTION_EVENT_SCHED);
+  }
+
+  return changes;
+}
+
+/************************************************************************/
+
 /*
  ************************************************************************
  ** Public function implementation
@@ -1737,7 +3395,6 @@ t_VB_engineErrorCode VbEngineConfParse(int argc, char **argv)
 {
   t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
   int                  opt;
-  CHAR                 engine_ini_file[MAX_FILE_NAME_LENGTH] = VB_ENGINE_CONF_DEFAULT_INI_FILE;
 
   while ((opt = getopt(argc, argv, "cf:h")) != -1)
   {
@@ -1745,8 +3402,8 @@ t_VB_engineErrorCode VbEngineConfParse(int argc, char **argv)
     {
       case ('f'):
       {
-        strncpy(engine_ini_file, optarg, MAX_FILE_NAME_LENGTH);
-        engine_ini_file[MAX_FILE_NAME_LENGTH - 1] = '\0';
+        strncpy(vbEngineConfIniFile, optarg, MAX_FILE_NAME_LENGTH);
+        vbEngineConfIniFile[MAX_FILE_NAME_LENGTH - 1] = '\0';
         break;
       }
       default:
@@ -1767,14 +3424,21 @@ t_VB_engineErrorCode VbEngineConfParse(int argc, char **argv)
 
   if (ret == VB_ENGINE_ERROR_NONE)
   {
-    ret = VbEngineConfFileRead(engine_ini_file);
+    pthread_mutex_lock(&vbEngineConfReloadMutex);
+    ret = VbEngineConfFileRead(vbEngineConfIniFile, &vbEngineConf, FALSE);
+    pthread_mutex_unlock(&vbEngineConfReloadMutex);
 
     if (ret != VB_ENGINE_ERROR_NONE)
     {
-      printf("Configuration error (%d) parsing file %s!\n", ret, engine_ini_file);
+      printf("Configuration error (%d) parsing file %s!\n", ret, vbEngineConfIniFile);
     }
   }
 
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    VbEngineCDTAConfApply(&vbEngineConf.cdtaConf);
+  }
+
   return ret;
 }
 
@@ -1797,6 +3461,9 @@ void VbEngineConfDump(t_writeFun writeFun)
   writeFun("| %-48s | %28s |\n",               "Debug Output Path",    vbEngineConf.outputPath);
   writeFun("| %-48s | %28s |\n",               "Log Verbose Level",    VbVerboseLevelToStr(vbEngineConf.verboseLevel));
   writeFun("| %-48s | %28u |\n",               "Console Port",         vbEngineConf.consolePort);
+  writeFun("| %-48s | %28u |\n",               "EA shared memory ring size", vbEngineConf.eaShmRingSize);
+  writeFun("| %-48s | %28s |\n",               "EA io_uring receive",  vbEngineConf.eaIoUring?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %25u ms |\n",            "Clock future guard",   vbEngineConf.clockFutureGuard);
   writeFun("| %-48s | %28s |\n",               "Save Meas to disk",    vbEngineConf.saveMeasures?"ENABLED":"DISABLED");
   writeFun("| %-48s | %28s |\n",               "Traffic metrics",      vbEngineConf.trafficMetricsEnabled?"ENABLED":"DISABLED");
   writeFun("| %-48s | %28s |\n",               "Save metrics to disk", vbEngineConf.saveMetricsEnabled?"ENABLED":"DISABLED");
@@ -1849,12 +3516,12 @@ void VbEngineConfDump(t_writeFun writeFun)
   {
     INT32U idx;
 
-    for (idx = 0; idx < vbEngineConf.alignParams.prioRefList.size; idx++)
+    for (idx = 0; idx < VbEngineConfAlignPrioRefListSizeGet(); idx++)
     {
       t_VB_engineErrorCode err;
-      INT8U               *prio_ref_mac;
+      INT8U                prio_ref_mac[ETH_ALEN];
 
-      err = VbEngineConfAlignPrioRefItemGet(idx, &prio_ref_mac);
+      err = VbEngineConfAlignPrioRefItemGet(idx, prio_ref_mac);
 
       if (err == VB_ENGINE_ERROR_NONE)
       {
@@ -1873,20 +3540,27 @@ void VbEngineConfDump(t_writeFun writeFun)
     for (entry_idx = 0; entry_idx < vbEngineConf.alignParams.nodeCustomList.size; entry_idx++)
     {
       INT32U black_list_idx;
+      INT32U black_list_size;
+      INT8U  target_mac[ETH_ALEN];
+
+      if (VbEngineAlignCustomEntryGet(entry_idx, target_mac, &black_list_size) != VB_ENGINE_ERROR_NONE)
+      {
+        break;
+      }
 
       writeFun("| %-40s (%2lu)    |         " MAC_PRINTF_FORMAT "    |\n",  "Alignment - custom entry - target MAC",
           entry_idx,
-          MAC_PRINTF_DATA(vbEngineConf.alignParams.nodeCustomList.entries[entry_idx].targetNode));
+          MAC_PRINTF_DATA(target_mac));
 
       writeFun("| %-48s | %28u |\n", "Alignment - custom entry - blacklist items",
-          vbEngineConf.alignParams.nodeCustomList.entries[entry_idx].blackList.size);
+          black_list_size);
 
-      for (black_list_idx = 0; black_list_idx < vbEngineConf.alignParams.nodeCustomList.entries[entry_idx].blackList.size; black_list_idx++)
+      for (black_list_idx = 0; black_list_idx < black_list_size; black_list_idx++)
       {
         t_VB_engineErrorCode err;
-        INT8U               *black_list_mac;
+        INT8U                black_list_mac[ETH_ALEN];
 
-        err = VbEngineAlignBlackListItemGet(entry_idx, black_list_idx, &black_list_mac);
+        err = VbEngineAlignBlackListItemGet(entry_idx, black_list_idx, black_list_mac);
 
         if (err == VB_ENGINE_ERROR_NONE)
         {
@@ -1905,14 +3579,16 @@ void VbEngineConfDump(t_writeFun writeFun)
   {
     INT32U idx;
 
-    for (idx = 0; idx < vbEngineConf.seedConf.excludedMacListSize; idx++)
+    INT8U  excluded_mac[ETH_ALEN];
+
+    for (idx = 0; VbEngineConfSeedExcludedMacItemGet(idx, excluded_mac) == VB_ENGINE_ERROR_NONE; idx++)
     {
-      writeFun("| %-43s (%2lu) |            %02x:%02x:%02x:%02x:%02x:%02x |\n",  "Automatic seeds - Excluded MAC ", idx, vbEngineConf.seedConf.excludedMacList[0 + (idx*ETH_ALEN)],
-                                                                                                              vbEngineConf.seedConf.excludedMacList[1 + (idx*ETH_ALEN)],
-                                                                                                              vbEngineConf.seedConf.excludedMacList[2 + (idx*ETH_ALEN)],
-                                                                                                              vbEngineConf.seedConf.excludedMacList[3 + (idx*ETH_ALEN)],
-                                                                                                              vbEngineConf.seedConf.excludedMacList[4 + (idx*ETH_ALEN)],
-                                                                                                              vbEngineConf.seedConf.excludedMacList[5 + (idx*ETH_ALEN)]);
+      writeFun("| %-43s (%2lu) |            %02x:%02x:%02x:%02x:%02x:%02x |\n",  "Automatic seeds - Excluded MAC ", idx, excluded_mac[0],
+                                                                                                              excluded_mac[1],
+                                                                                                              excluded_mac[2],
+                                                                                                              excluded_mac[3],
+                                                                                                              excluded_mac[4],
+                                                                                                              excluded_mac[5]);
     }
   }
 
@@ -1920,6 +3596,74 @@ void VbEngineConfDump(t_writeFun writeFun)
   writeFun("| %-48s | %28s |\n",               "Persistent log - Verbose level",    VbVerboseLevelToStr(vbEngineConf.persistentLog.verboseLevel));
   writeFun("| %-48s | %28s |\n",               "Persistent log - Circular",         vbEngineConf.persistentLog.circular?"ENABLED":"DISABLED");
 
+  writeFun("| %-48s | %28s |\n",               "Line state - Shared memory table",  vbEngineConf.lineState.enable?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %28u |\n",               "Line state - Max lines",            vbEngineConf.lineState.maxLines);
+  writeFun("| %-48s | %28s |\n",               "Line state - Text files",           vbEngineConf.lineState.textFiles?"ENABLED":"DISABLED");
+
+  writeFun("| %-48s | %28u |\n",               "File writer - Flush period (ms)",   vbEngineConf.fileWriter.flushPeriodMs);
+  writeFun("| %-48s | %28u |\n",               "File writer - Max open files",      vbEngineConf.fileWriter.maxOpenFiles);
+  writeFun("| %-48s | %28u |\n",               "File writer - Max buffered (KB)",   vbEngineConf.fileWriter.maxBufferedBytes / 1024);
+  writeFun("| %-48s | %28s |\n",               "File writer - Fsync",
+      (vbEngineConf.fileWriter.fsyncPolicy == VB_FILE_WRITER_FSYNC_ON_FLUSH)?"FLUSH":
+      ((vbEngineConf.fileWriter.fsyncPolicy == VB_FILE_WRITER_FSYNC_ON_CLOSE)?"CLOSE":"NONE"));
+  writeFun("| %-48s | %28s |\n",               "File writer - io_uring",            vbEngineConf.fileWriter.ioUring?"ENABLED":"DISABLED");
+
+  writeFun("| %-48s | %28s |\n",               "Measure stream - status",           vbEngineConf.measStream.enable?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %28s |\n",               "Measure stream - Socket",           vbEngineConf.measStream.socketPath);
+  writeFun("| %-48s | %28u |\n",               "Measure stream - Max subscribers",  vbEngineConf.measStream.maxSubscribers);
+  writeFun("| %-48s | %28u |\n",               "Measure stream - Buffer (KB)",      vbEngineConf.measStream.bufferBytes / 1024);
+
+  writeFun("| %-48s | %28s |\n",               "Xtalk sparsity - status",           vbEngineConf.xtalkSparsity.enable?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %28u |\n",               "Xtalk sparsity - Significance (dB)", vbEngineConf.xtalkSparsity.significanceThr);
+  writeFun("| %-48s | %28u |\n",               "Xtalk sparsity - Max error (dB/100)", vbEngineConf.xtalkSparsity.maxError);
+  writeFun("| %-48s | %28s |\n",               "Cluster partition - status",        vbEngineConf.clusterPartition.enable?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %28s |\n",               "Cluster partition - Apply",         vbEngineConf.clusterPartition.apply?"YES":"NO");
+  writeFun("| %-48s | %28u |\n",               "Cluster partition - Coupling (dB)", vbEngineConf.clusterPartition.couplingThr);
+  writeFun("| %-48s | %28u |\n",               "Cluster partition - Max lines",     vbEngineConf.clusterPartition.maxLines);
+  writeFun("| %-48s | %28u |\n",               "Cluster partition - Hold time (s)", vbEngineConf.clusterPartition.holdTime);
+  writeFun("| %-48s | %28s |\n",               "CFR resolution - status",           vbEngineConf.cfrResolution.enable?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %28u |\n",               "CFR resolution - Max decimation",   vbEngineConf.cfrResolution.maxDecimation);
+  writeFun("| %-48s | %28u |\n",               "CFR resolution - Max error (dB/100)", vbEngineConf.cfrResolution.maxError);
+  writeFun("| %-48s | %28u |\n",               "CFR resolution - Refresh plans",    vbEngineConf.cfrResolution.refreshPlans);
+  writeFun("| %-48s | %28s |\n",               "SNR tracking - status",             vbEngineConf.snrTracking.enable?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %28u |\n",               "SNR tracking - Period (ms)",        vbEngineConf.snrTracking.period);
+  writeFun("| %-48s | %28u |\n",               "SNR tracking - Lines per round",    vbEngineConf.snrTracking.linesPerRound);
+  writeFun("| %-48s | %28u |\n",               "SNR tracking - Error thr (dB/100)", vbEngineConf.snrTracking.errorThr);
+  writeFun("| %-48s | %28u |\n",               "SNR tracking - Escalate hold (s)",  vbEngineConf.snrTracking.escalateHold);
+  writeFun("| %-48s | %28s |\n",               "Boost damping - status",            vbEngineConf.boostDamping.enable?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %28u |\n",               "Boost damping - Node dwell (ms)",   vbEngineConf.boostDamping.nodeDwell);
+  writeFun("| %-48s | %28u |\n",               "Boost damping - Cluster dwell (ms)", vbEngineConf.boostDamping.clusterDwell);
+  writeFun("| %-48s | %28u |\n",               "Boost damping - Reconf per min",    vbEngineConf.boostDamping.reconfPerMin);
+  writeFun("| %-48s | %28u |\n",               "Boost damping - Burst",             vbEngineConf.boostDamping.burst);
+  writeFun("| %-48s | %28u |\n",               "Boost damping - Apply window (ms)", vbEngineConf.boostDamping.applyWindow);
+  writeFun("| %-48s | %28s |\n",               "Traffic forecast - status",         vbEngineConf.trafficForecast.enable?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %28u |\n",               "Traffic forecast - Horizon (s)",    vbEngineConf.trafficForecast.horizon);
+  writeFun("| %-48s | %28u |\n",               "Traffic forecast - Alpha (%)",      vbEngineConf.trafficForecast.alpha);
+  writeFun("| %-48s | %28u |\n",               "Traffic forecast - Beta (%)",       vbEngineConf.trafficForecast.beta);
+  writeFun("| %-48s | %28u |\n",               "Traffic forecast - Gamma (%)",      vbEngineConf.trafficForecast.gamma);
+  writeFun("| %-48s | %28u |\n",               "Traffic forecast - Season slots",   vbEngineConf.trafficForecast.seasonSlots);
+  writeFun("| %-48s | %28u |\n",               "Traffic forecast - Burst thr (dev/100)", vbEngineConf.trafficForecast.burstThr);
+  writeFun("| %-48s | %28u |\n",               "Traffic forecast - Burst hold (s)", vbEngineConf.trafficForecast.burstHold);
+  writeFun("| %-48s | %28s |\n",               "SNR linear cache - status",         vbEngineConf.snrLinearCache.enable?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %28s |\n",               "Measure history - status",          vbEngineConf.measHistory.enable?"ENABLED":"DISABLED");
+  writeFun("| %-48s | %28u |\n",               "Measure history - Depth (plans)",   vbEngineConf.measHistory.depth);
+  writeFun("| %-48s | %28u |\n",               "Measure history - Memory budget (KB)", vbEngineConf.measHistory.memoryBudget);
+  writeFun("| %-48s | %28u |\n",               "Measure history - Min plans",       vbEngineConf.measHistory.minPlans);
+  writeFun("| %-48s | %28u |\n",               "Measure history - Stable trend (dB/100)", vbEngineConf.measHistory.stableTrend);
+  writeFun("| %-48s | %28u |\n",               "Measure history - Stable deviation (dB/100)", vbEngineConf.measHistory.stableDeviation);
+  writeFun("| %-48s | %28s |\n",               "Measure history - Keep stable CFRs", vbEngineConf.measHistory.keepStable?"YES":"NO");
+  writeFun("| %-48s | %28s |\n",               "Thread placement - status",         vbEngineConf.threadPlacement.enable?"ENABLED":"DISABLED");
+
+  for (i = 0; i < VB_ENGINE_EVENT_CLASS_LAST; i++)
+  {
+    // Weight / max depth
+    writeFun("| %-17s %-30s | %19u / %6u |\n", "Event scheduler -", VbEngineEventClassToStr((t_vbEngineEventClass)i),
+        vbEngineConf.eventSched.classes[i].weight, vbEngineConf.eventSched.classes[i].maxDepth);
+  }
+
+  writeFun("| %-48s | %19u / %6u |\n",         "Event scheduler - Driver credits (meas / telem)",
+      vbEngineConf.eventSched.driverCredits[VB_EA_FLOW_CLASS_MEASURE], vbEngineConf.eventSched.driverCredits[VB_EA_FLOW_CLASS_TELEMETRY]);
+
   writeFun("| %-48s | %28s |\n",               "Socket Alive - status",  vbEngineConf.socketAlive.enable?"ENABLED":"DISABLED");
   writeFun("| %-48s | %28u |\n",               "Socket Alive - Period",  vbEngineConf.socketAlive.period);
   writeFun("| %-48s | %28u |\n",               "Socket Alive - Nlost",   vbEngineConf.socketAlive.nLostMsgThr);
@@ -1972,14 +3716,35 @@ BOOL VbEngineConfTrafficMetricsEnabledGet(void)
 
 BOOL VbEngineConfSaveMetricsEnabledGet(void)
 {
-  return vbEngineConf.saveMetricsEnabled;
+  return vbEngineConf.saveMetricsEnabled;
+}
+
+/*******************************************************************/
+
+INT32U VbEngineConfMaxMetricsLogSizeGet(void)
+{
+  return vbEngineConf.maxMetricsLogSize;
+}
+
+/*******************************************************************/
+
+INT32U VbEngineConfEAShmRingSizeGet(void)
+{
+  return vbEngineConf.eaShmRingSize;
+}
+
+/*******************************************************************/
+
+INT32U VbEngineConfClockFutureGuardGet(void)
+{
+  return vbEngineConf.clockFutureGuard;
 }
 
 /*******************************************************************/
 
-INT32U VbEngineConfMaxMetricsLogSizeGet(void)
+BOOLEAN VbEngineConfEAIoUringGet(void)
 {
-  return vbEngineConf.maxMetricsLogSize;
+  return vbEngineConf.eaIoUring;
 }
 
 /*******************************************************************/
@@ -2189,10 +3954,12 @@ INT32U VbEngineConfAlignPrioRefListSizeGet(void)
 
 /*******************************************************************/
 
-t_VB_engineErrorCode VbEngineConfAlignPrioRefItemGet(INT32U prioRefIdx, INT8U **prioRefMac)
+t_VB_engineErrorCode VbEngineConfAlignPrioRefItemGet(INT32U prioRefIdx, INT8U *prioRefMac)
 {
   t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
 
+  pthread_mutex_lock(&vbEngineConfListsMutex);
+
   if ((prioRefMac == NULL) ||
       (vbEngineConf.alignParams.prioRefList.list == NULL) ||
       (prioRefIdx >= vbEngineConf.alignParams.prioRefList.size))
@@ -2202,9 +3969,11 @@ t_VB_engineErrorCode VbEngineConfAlignPrioRefItemGet(INT32U prioRefIdx, INT8U **
 
   if (ret == VB_ENGINE_ERROR_NONE)
   {
-    *prioRefMac = vbEngineConf.alignParams.prioRefList.list + (prioRefIdx * ETH_ALEN);
+    memcpy(prioRefMac, vbEngineConf.alignParams.prioRefList.list + (prioRefIdx * ETH_ALEN), ETH_ALEN);
   }
 
+  pthread_mutex_unlock(&vbEngineConfListsMutex);
+
   return ret;
 }
 
@@ -2333,6 +4102,111 @@ BOOLEAN VbEngineConfPersistentLogIsCircular(void)
 
 /*******************************************************************/
 
+BOOLEAN VbEngineConfLineStateEnableGet(void)
+{
+  return vbEngineConf.lineState.enable;
+}
+
+/*******************************************************************/
+
+INT32U VbEngineConfLineStateMaxLinesGet(void)
+{
+  return vbEngineConf.lineState.maxLines;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbEngineConfLineStateTextFilesGet(void)
+{
+  return vbEngineConf.lineState.textFiles;
+}
+
+/*******************************************************************/
+
+const t_vbFileWriterConf *VbEngineConfFileWriterGet(void)
+{
+  return &vbEngineConf.fileWriter;
+}
+
+/*******************************************************************/
+
+const t_vbEngineMeasStreamConf *VbEngineConfMeasStreamGet(void)
+{
+  return &vbEngineConf.measStream;
+}
+
+/*******************************************************************/
+
+const t_vbEngineXtalkSparsityConf *VbEngineConfXtalkSparsityGet(void)
+{
+  return &vbEngineConf.xtalkSparsity;
+}
+
+/*******************************************************************/
+
+const t_vbEngineClusterPartitionConf *VbEngineConfClusterPartitionGet(void)
+{
+  return &vbEngineConf.clusterPartition;
+}
+
+/*******************************************************************/
+
+const t_vbEngineCfrResolutionConf *VbEngineConfCfrResolutionGet(void)
+{
+  return &vbEngineConf.cfrResolution;
+}
+
+/*******************************************************************/
+
+const t_vbEngineSnrTrackingConf *VbEngineConfSnrTrackingGet(void)
+{
+  return &vbEngineConf.snrTracking;
+}
+
+/*******************************************************************/
+
+const t_vbEngineBoostDampingConf *VbEngineConfBoostDampingGet(void)
+{
+  return &vbEngineConf.boostDamping;
+}
+
+/*******************************************************************/
+
+const t_vbEngineTrafficForecastConf *VbEngineConfTrafficForecastGet(void)
+{
+  return &vbEngineConf.trafficForecast;
+}
+
+/*******************************************************************/
+
+const t_vbEngineSnrLinearCacheConf *VbEngineConfSnrLinearCacheGet(void)
+{
+  return &vbEngineConf.snrLinearCache;
+}
+
+/*******************************************************************/
+
+const t_vbEngineMeasHistoryConf *VbEngineConfMeasHistoryGet(void)
+{
+  return &vbEngineConf.measHistory;
+}
+
+/*******************************************************************/
+
+const t_vbThreadPlacementConf *VbEngineConfThreadPlacementGet(void)
+{
+  return &vbEngineConf.threadPlacement;
+}
+
+/*******************************************************************/
+
+const t_vbEngineEventSchedConf *VbEngineConfEventSchedGet(void)
+{
+  return &vbEngineConf.eventSched;
+}
+
+/*******************************************************************/
+
 BOOLEAN VbEngineConfSocketAliveEnableGet(void)
 {
   return vbEngineConf.socketAlive.enable;
@@ -2354,29 +4228,32 @@ INT32U VbEngineConfSocketAliveNLostThrGet(void)
 
 /*******************************************************************/
 
-INT16U VbEngineConfSeedExcludedMacListSizeGet(void)
+BOOLEAN VbEngineConfSeedMacIsExcluded(const INT8U *mac)
 {
-  return vbEngineConf.seedConf.excludedMacListSize;
-}
+  BOOLEAN excluded = FALSE;
+  INT32U  idx;
 
-/*******************************************************************/
+  pthread_mutex_lock(&vbEngineConfListsMutex);
 
-INT8U *VbEngineConfSeedExcludedMacListGet(void)
-{
-  return vbEngineConf.seedConf.excludedMacList;
+  if ((mac != NULL) && (vbEngineConf.seedConf.excludedMacList != NULL))
+  {
+    for (idx = 0; (excluded == FALSE) && (idx < vbEngineConf.seedConf.excludedMacListSize); idx++)
+    {
+      excluded = (memcmp(vbEngineConf.seedConf.excludedMacList + (ETH_ALEN * idx), mac, ETH_ALEN) == 0)?TRUE:FALSE;
+    }
+  }
+
+  pthread_mutex_unlock(&vbEngineConfListsMutex);
+
+  return excluded;
 }
 
 /*******************************************************************/
 
 t_VB_engineErrorCode VbEngineConfReleaseResources(void)
 {
-  if (vbEngineConf.seedConf.excludedMacList != NULL)
-  {
-    free(vbEngineConf.seedConf.excludedMacList);
-    vbEngineConf.seedConf.excludedMacList = NULL;
-  }
-
-  VbEngineAlignCustomRelease();
+  VbEngineConfReloadCancel();
+  VbEngineConfListsRelease(&vbEngineConf);
 
   return VB_ENGINE_ERROR_NONE;
 }
@@ -2388,6 +4265,8 @@ BOOLEAN VbEngineConfAlignBlackListIsMacAllowed(INT8U *targetMac, INT8U *macToChe
   INT32U  entry_idx;
   BOOLEAN is_allowed = TRUE;
 
+  pthread_mutex_lock(&vbEngineConfListsMutex);
+
   if ((VbEngineConfAlignBlackListIsEnabled() == TRUE) &&
       (vbEngineConf.alignParams.nodeCustomList.entries != NULL))
   {
@@ -2404,14 +4283,7 @@ BOOLEAN VbEngineConfAlignBlackListIsMacAllowed(INT8U *targetMac, INT8U *macToChe
         {
           for (blacklist_idx = 0; blacklist_idx < entry->blackList.size; blacklist_idx++)
           {
-            t_VB_engineErrorCode err;
-            INT8U               *blacklist_mac;
-
-            // Get next MAC in black list
-            err = VbEngineAlignBlackListItemGet(entry_idx, blacklist_idx, &blacklist_mac);
-
-            if ((err == VB_ENGINE_ERROR_NONE) &&
-                (MACAddrQuickCmp(blacklist_mac, macToCheck) == TRUE))
+            if (MACAddrQuickCmp(entry->blackList.list + (blacklist_idx * ETH_ALEN), macToCheck) == TRUE)
             {
               // MAC found in blacklist
               is_allowed = FALSE;
@@ -2426,6 +4298,8 @@ BOOLEAN VbEngineConfAlignBlackListIsMacAllowed(INT8U *targetMac, INT8U *macToChe
     }
   }
 
+  pthread_mutex_unlock(&vbEngineConfListsMutex);
+
   return is_allowed;
 }
 
@@ -2442,6 +4316,300 @@ BOOLEAN VbEngineConfAlignBlackListIsEnabled(void)
 
 /*******************************************************************/
 
+t_VB_engineErrorCode VbEngineConfReloadPrepare(INT32U *changes, CHAR *reason, INT32U reasonLen)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_vbEngineConfReload *candidate = NULL;
+  const CHAR           *param;
+
+  if ((changes == NULL) || (reason == NULL) || (reasonLen == 0))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    *changes = 0;
+    reason[0] = '\0';
+
+    candidate = (t_vbEngineConfReload *)calloc(1, sizeof(t_vbEngineConfReload));
+
+    if (candidate == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbEngineConfReloadMutex);
+
+    if (vbEngineConfReloadPending != NULL)
+    {
+      snprintf(reason, reasonLen, "previous reload not applied yet");
+      ret = VB_ENGINE_ERROR_ALREADY_STARTED;
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      ret = VbEngineConfFileRead(vbEngineConfIniFile, &candidate->conf, TRUE);
+
+      if (ret != VB_ENGINE_ERROR_NONE)
+      {
+        snprintf(reason, reasonLen, "error %d parsing %s", ret, vbEngineConfIniFile);
+      }
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      param = VbEngineConfRestartParamFind(&vbEngineConf, &candidate->conf);
+
+      if (param != NULL)
+      {
+        snprintf(reason, reasonLen, "%s changed, engine restart required", param);
+        ret = VB_ENGINE_ERROR_RESTART_REQUIRED;
+      }
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      candidate->changes = VbEngineConfLiveChangesGet(&vbEngineConf, &candidate->conf);
+      *changes = candidate->changes;
+
+      if (candidate->changes != 0)
+      {
+        // Candidate is applied later from engine process thread
+        vbEngineConfReloadPending = candidate;
+        candidate = NULL;
+      }
+    }
+
+    pthread_mutex_unlock(&vbEngineConfReloadMutex);
+  }
+
+  if (candidate != NULL)
+  {
+    VbEngineConfListsRelease(&candidate->conf);
+    free(candidate);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEngineConfReloadChangesToStr(INT32U changes, CHAR *str, INT32U len)
+{
+  INT32U section;
+  INT32U pos = 0;
+
+  if ((str != NULL) && (len > 0))
+  {
+    str[0] = '\0';
+
+    for (section = 0; (section < VB_ENGINE_CONF_RELOAD_SECTION_LAST) && (pos < len); section++)
+    {
+      if (VB_ENGINE_CONF_RELOAD_CHANGED(changes, section))
+      {
+        pos += snprintf(str + pos, len - pos, "%s%s", (pos > 0)?", ":"", vbEngineConfReloadSectionString[section]);
+      }
+    }
+
+    if (str[0] == '\0')
+    {
+      snprintf(str, len, "none");
+    }
+  }
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineConfReloadApply(INT32U *changes)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_vbEngineConfReload *reload;
+  t_vbEngineConf       *candidate;
+
+  if (changes == NULL)
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    *changes = 0;
+
+    // Keep the lock while updating running configuration to serialize with a new reload request
+    pthread_mutex_lock(&vbEngineConfReloadMutex);
+    reload = vbEngineConfReloadPending;
+    vbEngineConfReloadPending = NULL;
+
+    if (reload == NULL)
+    {
+      pthread_mutex_unlock(&vbEngineConfReloadMutex);
+      ret = VB_ENGINE_ERROR_NOT_FOUND;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    candidate = &reload->conf;
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_VERBOSE))
+    {
+      vbEngineConf.verboseLevel = candidate->verboseLevel;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_BOOST_THR))
+    {
+      memcpy(vbEngineConf.boostThresholds, candidate->boostThresholds, sizeof(vbEngineConf.boostThresholds));
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_BOOST_PERIOD))
+    {
+      vbEngineConf.boostAlgPeriod = candidate->boostAlgPeriod;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_PROFILES))
+    {
+      memcpy(vbEngineConf.userProfile, candidate->userProfile, sizeof(vbEngineConf.userProfile));
+      vbEngineConf.sla = candidate->sla;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_CDTA))
+    {
+      vbEngineConf.cdtaConf = candidate->cdtaConf;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_MEAS_PLAN))
+    {
+      vbEngineConf.measPlanConf = candidate->measPlanConf;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_ALIGN))
+    {
+      t_macList           prio_ref_list = vbEngineConf.alignParams.prioRefList;
+      t_alignParamsCustom custom_list = vbEngineConf.alignParams.nodeCustomList;
+
+      vbEngineConf.alignParams.reliabilityThr = candidate->alignParams.reliabilityThr;
+      vbEngineConf.alignParams.minPow = candidate->alignParams.minPow;
+      vbEngineConf.alignParams.minPowHyst = candidate->alignParams.minPowHyst;
+      vbEngineConf.alignParams.metrics = candidate->alignParams.metrics;
+
+      // Swap lists, old ones are released with the candidate (no reader left once unlocked)
+      pthread_mutex_lock(&vbEngineConfListsMutex);
+      vbEngineConf.alignParams.prioRefList = candidate->alignParams.prioRefList;
+      vbEngineConf.alignParams.nodeCustomList = candidate->alignParams.nodeCustomList;
+      pthread_mutex_unlock(&vbEngineConfListsMutex);
+      candidate->alignParams.prioRefList = prio_ref_list;
+      candidate->alignParams.nodeCustomList = custom_list;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_SEED))
+    {
+      t_seedConf seed_conf = vbEngineConf.seedConf;
+
+      pthread_mutex_lock(&vbEngineConfListsMutex);
+      vbEngineConf.seedConf = candidate->seedConf;
+      pthread_mutex_unlock(&vbEngineConfListsMutex);
+      candidate->seedConf = seed_conf;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_SAVE_MEASURES))
+    {
+      vbEngineConf.saveMeasures = candidate->saveMeasures;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_XTALK_SPARSITY))
+    {
+      // Applies from next SNR computation
+      vbEngineConf.xtalkSparsity = candidate->xtalkSparsity;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_CLUSTER_PARTITION))
+    {
+      // Applies from next analysis
+      vbEngineConf.clusterPartition = candidate->clusterPartition;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_CFR_RESOLUTION))
+    {
+      // Applies from next measure plan
+      vbEngineConf.cfrResolution = candidate->cfrResolution;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_SNR_TRACKING))
+    {
+      // Applies from next tracking round
+      vbEngineConf.snrTracking = candidate->snrTracking;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_BOOST_DAMPING))
+    {
+      // Applies from next boost algorithm run
+      vbEngineConf.boostDamping = candidate->boostDamping;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_TRAFFIC_FORECAST))
+    {
+      // Applies from next traffic report
+      vbEngineConf.trafficForecast = candidate->trafficForecast;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_SNR_LINEAR_CACHE))
+    {
+      // Applies from next SNR calculation
+      vbEngineConf.snrLinearCache = candidate->snrLinearCache;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_MEAS_HISTORY))
+    {
+      // Applies from next measure plan
+      vbEngineConf.measHistory = candidate->measHistory;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_THREAD_PLACEMENT))
+    {
+      // Running threads are moved by the process thread
+      vbEngineConf.threadPlacement = candidate->threadPlacement;
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(reload->changes, VB_ENGINE_CONF_RELOAD_SECTION_EVENT_SCHED))
+    {
+      // Scheduler is updated by the process thread
+      vbEngineConf.eventSched = candidate->eventSched;
+    }
+
+    *changes = reload->changes;
+    pthread_mutex_unlock(&vbEngineConfReloadMutex);
+
+    VbEngineConfListsRelease(candidate);
+    free(reload);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEngineConfReloadCancel(void)
+{
+  t_vbEngineConfReload *reload;
+
+  pthread_mutex_lock(&vbEngineConfReloadMutex);
+  reload = vbEngineConfReloadPending;
+  vbEngineConfReloadPending = NULL;
+  pthread_mutex_unlock(&vbEngineConfReloadMutex);
+
+  if (reload != NULL)
+  {
+    VbEngineConfListsRelease(&reload->conf);
+    free(reload);
+  }
+}
+
+/*******************************************************************/
+
 /**
  * @}
  **/
@@ -60,6 +60,18 @@
 #include "vb_measure_utils.h"
 #include "vb_engine_cdta.h"
 #include "vb_engine_socket_alive.h"
+#include "vb_file_writer.h"
+#include "vb_engine_meas_stream.h"
+#include "vb_engine_xtalk_sparsity.h"
+#include "vb_engine_cluster_partition.h"
+#include "vb_engine_cfr_resolution.h"
+#include "vb_engine_snr_tracking.h"
+#include "vb_engine_boost_damping.h"
+#include "vb_engine_traffic_forecast.h"
+#include "vb_engine_snr_linear_cache.h"
+#include "vb_engine_meas_history.h"
+#include "vb_thread.h"
+#include "vb_engine_event_sched.h"
 
 /*
  ************************************************************************
@@ -96,6 +108,34 @@ typedef enum
   VB_BOOST_THR_TYPE_LAST
 } t_vbBoostThrType;
 
+/// Sections of vb_engine.ini that can be changed without restarting the engine
+typedef enum
+{
+  VB_ENGINE_CONF_RELOAD_SECTION_VERBOSE = 0,
+  VB_ENGINE_CONF_RELOAD_SECTION_BOOST_THR,
+  VB_ENGINE_CONF_RELOAD_SECTION_BOOST_PERIOD,
+  VB_ENGINE_CONF_RELOAD_SECTION_PROFILES,
+  VB_ENGINE_CONF_RELOAD_SECTION_CDTA,
+  VB_ENGINE_CONF_RELOAD_SECTION_MEAS_PLAN,
+  VB_ENGINE_CONF_RELOAD_SECTION_ALIGN,
+  VB_ENGINE_CONF_RELOAD_SECTION_SEED,
+  VB_ENGINE_CONF_RELOAD_SECTION_SAVE_MEASURES,
+  VB_ENGINE_CONF_RELOAD_SECTION_XTALK_SPARSITY,
+  VB_ENGINE_CONF_RELOAD_SECTION_CLUSTER_PARTITION,
+  VB_ENGINE_CONF_RELOAD_SECTION_CFR_RESOLUTION,
+  VB_ENGINE_CONF_RELOAD_SECTION_SNR_TRACKING,
+  VB_ENGINE_CONF_RELOAD_SECTION_BOOST_DAMPING,
+  VB_ENGINE_CONF_RELOAD_SECTION_TRAFFIC_FORECAST,
+  VB_ENGINE_CONF_RELOAD_SECTION_SNR_LINEAR_CACHE,
+  VB_ENGINE_CONF_RELOAD_SECTION_MEAS_HISTORY,
+  VB_ENGINE_CONF_RELOAD_SECTION_THREAD_PLACEMENT,
+  VB_ENGINE_CONF_RELOAD_SECTION_EVENT_SCHED,
+  VB_ENGINE_CONF_RELOAD_SECTION_LAST
+} t_vbEngineConfReloadSection;
+
+#define VB_ENGINE_CONF_RELOAD_STR_LEN                    (256)
+#define VB_ENGINE_CONF_RELOAD_CHANGED(changes, section)  (((changes) & (1U << (section))) != 0)
+
 /*
  ************************************************************************
  ** Public function definition
@@ -178,6 +218,24 @@ BOOL VbEngineConfSaveMetricsEnabledGet(void);
  **/
 INT32U VbEngineConfMaxMetricsLogSizeGet(void);
 
+/**
+ * @brief Gets ring size of shared memory EA transport, used with drivers running on the same host
+ * @return Ring size in bytes (0: disabled)
+ **/
+INT32U VbEngineConfEAShmRingSizeGet(void);
+
+/**
+ * @brief Gets whether EA sockets are read through io_uring (when kernel supports it)
+ * @return TRUE: io_uring receive; FALSE: blocking receive
+ **/
+BOOLEAN VbEngineConfEAIoUringGet(void);
+
+/**
+ * @brief Gets fixed guard added to future timestamps (on top of delivery time and clock prediction error)
+ * @return Guard time in ms
+ **/
+INT32U VbEngineConfClockFutureGuardGet(void);
+
 /**
  * @brief Returns the value of vdslCoexistence
  * @return TRUE or FALSE
@@ -286,16 +344,11 @@ INT16U VbEngineConfSeedMinIndexGet(void);
 INT16U VbEngineConfSeedMaxIndexGet(void);
 
 /**
- * @brief Gets the number of MACs in the seed excluded list
- * @return Number of MAC that will not received an automatic seed
- **/
-INT16U VbEngineConfSeedExcludedMacListSizeGet(void);
-
-/**
- * @brief Gets the list of MACs excluded from automatic seed functionality
- * @return Pointer to the beginning of the MAC excluded list
+ * @brief Checks if a MAC is in the list of MACs excluded from automatic seed functionality
+ * @param[in] mac MAC address to check
+ * @return TRUE if given MAC will not receive an automatic seed
  **/
-INT8U *VbEngineConfSeedExcludedMacListGet(void);
+BOOLEAN VbEngineConfSeedMacIsExcluded(const INT8U *mac);
 
 /**
  * @brief Release resources reserved by this component
@@ -344,10 +397,10 @@ INT32U VbEngineConfAlignPrioRefListSizeGet(void);
  * @brief Gets one item from the list of nodes with
  * high priority to be configured as sync reference.
  * @param[in] prioRefIdx   Index to get
- * @param[out] prioRefMac  MAC address with high priority to be reference node
+ * @param[out] prioRefMac  Copy of MAC address with high priority to be reference node (ETH_ALEN bytes)
  * @return @ref t_VB_engineErrorCode
  **/
-t_VB_engineErrorCode VbEngineConfAlignPrioRefItemGet(INT32U prioRefIdx, INT8U **prioRefMac);
+t_VB_engineErrorCode VbEngineConfAlignPrioRefItemGet(INT32U prioRefIdx, INT8U *prioRefMac);
 
 /**
  * @brief Shows if socket alive mechanism is enabled
@@ -385,6 +438,96 @@ t_vbLogLevel VbEngineConfPeristentLogVerboseLevelGet(void);
  **/
 BOOLEAN VbEngineConfPersistentLogIsCircular(void);
 
+/**
+ * @brief Shows if line state shared memory table is enabled
+ * @return TRUE: enabled; FALSE: otherwise
+ **/
+BOOLEAN VbEngineConfLineStateEnableGet(void);
+
+/**
+ * @brief Gets the maximum number of lines of the line state shared memory table
+ * @return Number of lines
+ **/
+INT32U VbEngineConfLineStateMaxLinesGet(void);
+
+/**
+ * @brief Shows if legacy per node line state text files shall be written
+ * @return TRUE: enabled; FALSE: otherwise
+ **/
+BOOLEAN VbEngineConfLineStateTextFilesGet(void);
+
+/**
+ * @brief Gets the file writer configuration
+ * @return Pointer to file writer configuration
+ **/
+const t_vbFileWriterConf *VbEngineConfFileWriterGet(void);
+
+/**
+ * @brief Gets the measurement stream configuration
+ * @return Pointer to measurement stream configuration
+ **/
+const t_vbEngineMeasStreamConf *VbEngineConfMeasStreamGet(void);
+
+/**
+ * @brief Gets the crosstalk sparsity configuration
+ * @return Pointer to crosstalk sparsity configuration
+ **/
+const t_vbEngineXtalkSparsityConf *VbEngineConfXtalkSparsityGet(void);
+
+/**
+ * @brief Gets the cluster partition configuration
+ * @return Pointer to cluster partition configuration
+ **/
+const t_vbEngineClusterPartitionConf *VbEngineConfClusterPartitionGet(void);
+
+/**
+ * @brief Gets the adaptive CFR resolution configuration
+ * @return Pointer to CFR resolution configuration
+ **/
+const t_vbEngineCfrResolutionConf *VbEngineConfCfrResolutionGet(void);
+
+/**
+ * @brief Gets the SNR probe tracking configuration
+ * @return Pointer to SNR tracking configuration
+ **/
+const t_vbEngineSnrTrackingConf *VbEngineConfSnrTrackingGet(void);
+
+/**
+ * @brief Gets the boost reconfiguration damping configuration
+ * @return Pointer to boost damping configuration
+ **/
+const t_vbEngineBoostDampingConf *VbEngineConfBoostDampingGet(void);
+
+/**
+ * @brief Gets the traffic forecast configuration
+ * @return Pointer to traffic forecast configuration
+ **/
+const t_vbEngineTrafficForecastConf *VbEngineConfTrafficForecastGet(void);
+
+/**
+ * @brief Gets the SNR linear cache configuration
+ * @return Pointer to SNR linear cache configuration
+ **/
+const t_vbEngineSnrLinearCacheConf *VbEngineConfSnrLinearCacheGet(void);
+
+/**
+ * @brief Gets the measure history configuration
+ * @return Pointer to measure history configuration
+ **/
+const t_vbEngineMeasHistoryConf *VbEngineConfMeasHistoryGet(void);
+
+/**
+ * @brief Gets the thread placement configuration
+ * @return Pointer to thread placement configuration (CPU set, scheduling policy and cgroup of each thread class)
+ **/
+const t_vbThreadPlacementConf *VbEngineConfThreadPlacementGet(void);
+
+/**
+ * @brief Gets the event scheduler configuration
+ * @return Pointer to weight and depth limit of each engine process event class
+ **/
+const t_vbEngineEventSchedConf *VbEngineConfEventSchedGet(void);
+
 /**
  * @brief Check if a given MAC is present in blacklist of a target node
  * @param[in] targetMac MAC address of the receiver node
@@ -399,5 +542,38 @@ BOOLEAN VbEngineConfAlignBlackListIsMacAllowed(INT8U *targetMac, INT8U *macToChe
  **/
 BOOLEAN VbEngineConfAlignBlackListIsEnabled(void);
 
+/**
+ * @brief Reads again the .ini file given at startup and compares it with the running configuration.
+ * Reload is rejected as a whole if any parameter requiring an engine restart has changed.
+ * Otherwise candidate configuration is kept pending until @ref VbEngineConfReloadApply is called.
+ * Running configuration is not modified.
+ * @param[out] changes Bitmap of @ref t_vbEngineConfReloadSection (0: nothing to apply)
+ * @param[out] reason Human readable rejection reason
+ * @param[in] reasonLen Size of reason buffer
+ * @return @ref t_VB_engineErrorCode (VB_ENGINE_ERROR_RESTART_REQUIRED if reload is rejected)
+ **/
+t_VB_engineErrorCode VbEngineConfReloadPrepare(INT32U *changes, CHAR *reason, INT32U reasonLen);
+
+/**
+ * @brief Builds a comma separated list with the names of the changed sections
+ * @param[in] changes Bitmap of @ref t_vbEngineConfReloadSection
+ * @param[out] str Output string
+ * @param[in] len Size of output string
+ **/
+void VbEngineConfReloadChangesToStr(INT32U changes, CHAR *str, INT32U len);
+
+/**
+ * @brief Copies the changed sections of the pending configuration to the running one.
+ * Shall be called from engine process thread.
+ * @param[out] changes Bitmap of applied @ref t_vbEngineConfReloadSection
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineConfReloadApply(INT32U *changes);
+
+/**
+ * @brief Discards the pending configuration (if any)
+ **/
+void VbEngineConfReloadCancel(void);
+
 #endif /* VB_ENGINE_CONF_H_ */
 
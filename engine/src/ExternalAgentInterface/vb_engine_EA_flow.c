@@ -0,0 +1,378 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost_engine
+ * @{
+ **/
+
+/**
+ * @file vb_engine_EA_flow.c
+ * @brief Credit based flow control of frames received from drivers
+ *
+ * @internal
+ *
+ * Every driver is granted, per EA flow class, a number of frames it may have
+ * pending in the engine (EventScheduler/DriverCredits). Each frame received
+ * uses one credit, which is returned once engine process dispatches the
+ * frame. Credits are returned in batches of a quarter of the window to keep
+ * the number of FlowCredit frames low. Drivers hold back frames of a class
+ * while they have no credits left for it; control frames are never held back.
+ *
+ * Drivers not supporting flow control just ignore the advertisement; their
+ * frames are still accepted and accounted as overruns.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_engine_datamodel.h"
+#include "vb_engine_drivers_list.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_EA_interface.h"
+#include "vb_engine_EA_flow.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_EA_FLOW_BATCH_DIV                (4)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  t_writeFun writeFun;
+  INT32U     numDrivers;
+} t_engineEAFlowConsoleArgs;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static pthread_mutex_t vbEngineEAFlowMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+static void EngineEAFlowStallEnd(t_DriverEAFlowClass *flowClass)
+{
+  struct timespec now;
+  INT64S          stall;
+
+  if (flowClass->stalled == TRUE)
+  {
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    stall = VbUtilElapsetimeTimespecUs(&flowClass->stallStartTs, &now);
+    stall = MAX(stall, 0);
+
+    flowClass->stallSum += (INT64U)stall;
+    flowClass->stallMax = MAX(flowClass->stallMax, (INT32U)MIN(stall, MAX_INT32U));
+    flowClass->stalled = FALSE;
+  }
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode EngineEAFlowCreditSend(t_VBDriver *driver, const t_vbEAFlowCredit *credit)
+{
+  t_VB_engineErrorCode ret;
+
+  ret = VbEngineEAInterfaceSendFrame(VB_EA_OPCODE_FLOW_CREDIT, (const INT8U *)credit, VB_EA_FLOW_CREDIT_SIZE, driver);
+
+  if ((ret != VB_ENGINE_ERROR_NONE) && (ret != VB_ENGINE_ERROR_NOT_READY))
+  {
+    VbLogPrintExt(VB_LOG_ERROR, driver->vbDriverID, "Error %d sending flow credits", ret);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode EngineEAFlowConsoleDriverCb(t_VBDriver *driver, void *args)
+{
+  t_VB_engineErrorCode       ret = VB_ENGINE_ERROR_NONE;
+  t_engineEAFlowConsoleArgs *console_args = (t_engineEAFlowConsoleArgs *)args;
+  t_DriverEAFlow             flow;
+  INT32U                     i;
+
+  if ((driver == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbEngineEAFlowMutex);
+    flow = driver->eaFlow;
+    pthread_mutex_unlock(&vbEngineEAFlowMutex);
+
+    for (i = VB_EA_FLOW_CLASS_MEASURE; i < VB_EA_FLOW_CLASS_LAST; i++)
+    {
+      t_DriverEAFlowClass *flow_class = &flow.classes[i];
+
+      if (flow_class->limited == TRUE)
+      {
+        console_args->writeFun("| %-20s | %-9s | %10u | %10u | %7u | %7d | %7u | %7u | %6u | %8llu ms | %7u ms |\n",
+            driver->vbDriverID,
+            VbEAFlowClassToStr((t_vbEAFlowClass)i),
+            flow_class->granted,
+            flow_class->received,
+            flow_class->received - flow_class->consumed,
+            (INT32S)(flow_class->granted - flow_class->received),
+            flow_class->grants,
+            flow_class->overruns,
+            flow_class->stalls,
+            (unsigned long long)(flow_class->stallSum / 1000),
+            flow_class->stallMax / 1000);
+      }
+      else
+      {
+        console_args->writeFun("| %-20s | %-9s | %10s | %10u | %7u | %7s | %7s | %7s | %6s | %11s | %10s |\n",
+            driver->vbDriverID,
+            VbEAFlowClassToStr((t_vbEAFlowClass)i),
+            "-",
+            flow_class->received,
+            flow_class->received - flow_class->consumed,
+            "-", "-", "-", "-", "-", "-");
+      }
+    }
+
+    console_args->numDrivers++;
+  }
+
+  return ret;
+}
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+t_VB_engineErrorCode VbEngineEAFlowStart(t_VBDriver *driver)
+{
+  t_VB_engineErrorCode            ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineEventSchedConf *conf;
+  t_vbEAFlowCredit                credit;
+  INT32U                          i;
+
+  if (driver == NULL)
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    conf = VbEngineConfEventSchedGet();
+
+    pthread_mutex_lock(&vbEngineEAFlowMutex);
+
+    bzero(&driver->eaFlow, sizeof(driver->eaFlow));
+
+    for (i = 0; i < VB_EA_FLOW_CLASS_LAST; i++)
+    {
+      t_DriverEAFlowClass *flow_class = &driver->eaFlow.classes[i];
+
+      if (conf->driverCredits[i] > 0)
+      {
+        flow_class->limited = TRUE;
+        flow_class->granted = conf->driverCredits[i];
+        flow_class->grants = 1;
+        credit.credits[i] = _htons((INT16U)conf->driverCredits[i]);
+      }
+      else
+      {
+        credit.credits[i] = _htons(VB_EA_FLOW_CREDIT_UNLIMITED);
+      }
+    }
+
+    pthread_mutex_unlock(&vbEngineEAFlowMutex);
+
+    ret = EngineEAFlowCreditSend(driver, &credit);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEngineEAFlowFrameRx(t_VBDriver *driver, t_vbEAOpcode opcode)
+{
+  t_DriverEAFlowClass *flow_class;
+  t_vbEAFlowClass      class_idx;
+
+  class_idx = VbEAFlowClassGet(opcode);
+
+  if ((driver != NULL) && (class_idx != VB_EA_FLOW_CLASS_CONTROL))
+  {
+    pthread_mutex_lock(&vbEngineEAFlowMutex);
+
+    flow_class = &driver->eaFlow.classes[class_idx];
+
+    if ((flow_class->limited == TRUE) && ((INT32S)(flow_class->granted - flow_class->received) <= 0))
+    {
+      // Driver is not honouring the advertised credits
+      flow_class->overruns++;
+    }
+
+    flow_class->received++;
+
+    if ((flow_class->limited == TRUE) && (flow_class->received == flow_class->granted))
+    {
+      flow_class->stalls++;
+      flow_class->stalled = TRUE;
+      clock_gettime(CLOCK_MONOTONIC, &flow_class->stallStartTs);
+    }
+
+    pthread_mutex_unlock(&vbEngineEAFlowMutex);
+  }
+}
+
+/*******************************************************************/
+
+void VbEngineEAFlowFrameDone(t_VBDriver *driver, t_vbEAOpcode opcode)
+{
+  const t_vbEngineEventSchedConf *conf;
+  t_DriverEAFlowClass            *flow_class;
+  t_vbEAFlowClass                 class_idx;
+  t_vbEAFlowCredit                credit;
+  INT32U                          window;
+  INT32U                          increment = 0;
+  INT32U                          i;
+
+  class_idx = VbEAFlowClassGet(opcode);
+
+  if ((driver != NULL) && (class_idx != VB_EA_FLOW_CLASS_CONTROL))
+  {
+    conf = VbEngineConfEventSchedGet();
+
+    pthread_mutex_lock(&vbEngineEAFlowMutex);
+
+    flow_class = &driver->eaFlow.classes[class_idx];
+    flow_class->consumed++;
+
+    if (flow_class->limited == TRUE)
+    {
+      // Window size changes (reload) apply to following grants; enabling or disabling a class needs a new connection
+      window = MAX(conf->driverCredits[class_idx], 1);
+
+      if ((INT32S)(flow_class->consumed + window - flow_class->granted) >= (INT32S)MAX(window / VB_ENGINE_EA_FLOW_BATCH_DIV, 1))
+      {
+        increment = flow_class->consumed + window - flow_class->granted;
+        increment = MIN(increment, VB_ENGINE_EVENT_SCHED_MAX_DRIVER_CREDITS);
+
+        flow_class->granted += increment;
+        flow_class->grants++;
+        EngineEAFlowStallEnd(flow_class);
+      }
+    }
+
+    pthread_mutex_unlock(&vbEngineEAFlowMutex);
+
+    if (increment > 0)
+    {
+      for (i = 0; i < VB_EA_FLOW_CLASS_LAST; i++)
+      {
+        credit.credits[i] = 0;
+      }
+
+      credit.credits[class_idx] = _htons((INT16U)increment);
+
+      EngineEAFlowCreditSend(driver, &credit);
+    }
+  }
+}
+
+/*******************************************************************/
+
+BOOL VbEngineEAFlowConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  t_engineEAFlowConsoleArgs console_args;
+
+  if ((cmd != NULL) && (cmd[1] != NULL))
+  {
+    writeFun("Usage:\n");
+    writeFun("eaflow : Shows per driver EA credits, frames pending in engine and time drivers spent without credits\n");
+  }
+  else
+  {
+    console_args.writeFun = writeFun;
+    console_args.numDrivers = 0;
+
+    writeFun("==========================================================================================================================================\n");
+    writeFun("| %-20s | %-9s | %10s | %10s | %7s | %7s | %7s | %7s | %6s | %11s | %10s |\n",
+        "Driver", "Class", "Granted", "Received", "Pending", "Credits", "Grants", "Overrun", "Stalls", "StallTime", "MaxStall");
+    writeFun("==========================================================================================================================================\n");
+
+    VbEngineDatamodelDriversLoop(EngineEAFlowConsoleDriverCb, &console_args);
+
+    if (console_args.numDrivers == 0)
+    {
+      writeFun("| %-134s |\n", "No drivers");
+    }
+
+    writeFun("==========================================================================================================================================\n");
+  }
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
@@ -0,0 +1,101 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost_engine
+ * @{
+ **/
+
+/**
+ * @file vb_engine_EA_flow.h
+ * @brief Credit based flow control of frames received from drivers
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_EA_FLOW_H_
+#define VB_ENGINE_EA_FLOW_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Resets flow control state of given driver and advertises the configured credits.
+ * Shall be called when the connection with the driver is established.
+ * @param[in] driver Driver
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineEAFlowStart(t_VBDriver *driver);
+
+/**
+ * @brief Accounts a frame received from given driver (called from its EA thread)
+ * @param[in] driver Driver
+ * @param[in] opcode Opcode of received frame
+ **/
+void VbEngineEAFlowFrameRx(t_VBDriver *driver, t_vbEAOpcode opcode);
+
+/**
+ * @brief Accounts a frame of given driver dispatched by engine process and
+ * returns credits to the driver when enough of them have been freed
+ * @param[in] driver Driver
+ * @param[in] opcode Opcode of dispatched frame
+ **/
+void VbEngineEAFlowFrameDone(t_VBDriver *driver, t_vbEAOpcode opcode);
+
+/**
+ * @brief Console command to show per driver credits, pending frames and stall times
+ * @param[in] arg Generic argument
+ * @param[in] writeFun Function to write output
+ * @param[in] cmd Command arguments
+ * @return TRUE
+ **/
+BOOL VbEngineEAFlowConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_EA_FLOW_H_ */
+
+/**
+ * @}
+ **/
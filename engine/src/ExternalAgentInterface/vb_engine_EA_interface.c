@@ -63,9 +63,11 @@
 #include "vb_engine_process.h"
 #include "vb_log.h"
 #include "vb_engine_EA_interface.h"
+#include "vb_engine_EA_flow.h"
 #include "vb_ea_communication.h"
 #include "vb_engine_drivers_list.h"
 #include "vb_counters.h"
+#include "vb_engine_conf.h"
 
 /*
  ************************************************************************
@@ -181,6 +183,9 @@ static void VbEngineEAFrameRxCb(t_vbEADesc *desc, INT8U *frameRx, INT32U size)
   {
     this_driver = (t_VBDriver *)desc->args;
 
+    // Account the credit used by this frame before engine process can dispatch it
+    VbEngineEAFlowFrameRx(this_driver, msg->opcode);
+
 #if (_VALGRIND_ == 1)
     ANNOTATE_HAPPENS_BEFORE(msg);
 #endif
@@ -246,6 +251,8 @@ static t_vbEAError VbEngineEAConnectCb(t_vbEADesc *desc, struct sockaddr_in6 dri
         this_driver->vbEAConnDesc.serverAddr     = desc->serverAddr;
         this_driver->vbEAConnDesc.sockFd         = sockFd;
         this_driver->vbEAConnDesc.args           = this_driver;
+        this_driver->vbEAConnDesc.shmRingSize    = VbEngineConfEAShmRingSizeGet();
+        this_driver->vbEAConnDesc.ioUring        = VbEngineConfEAIoUringGet();
       }
 
       if (engine_err == VB_ENGINE_ERROR_NONE)
@@ -361,6 +368,10 @@ t_VB_engineErrorCode VbEngineEAProtocolDriverThreadStart(t_VBDriver *vbDriver)
 
   if (ret == VB_ENGINE_ERROR_NONE)
   {
+    // Offered to the driver if it turns out to run on this host
+    vbDriver->vbEAConnDesc.shmRingSize = VbEngineConfEAShmRingSizeGet();
+    vbDriver->vbEAConnDesc.ioUring = VbEngineConfEAIoUringGet();
+
     ea_err = VbEAThreadStart(&vbDriver->vbEAConnDesc);
 
     if (ea_err != VB_EA_ERR_NONE)
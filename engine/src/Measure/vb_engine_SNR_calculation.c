@@ -72,6 +72,12 @@
 #include "vb_engine_measure.h"
 #include "vb_engine_communication.h"
 #include "vb_engine_cdta.h"
+#include "vb_engine_meas_stream.h"
+#include "vb_engine_xtalk_sparsity.h"
+#include "vb_engine_cluster_partition.h"
+#include "vb_engine_cfr_resolution.h"
+#include "vb_engine_snr_linear_cache.h"
+#include "vb_engine_meas_history.h"
 
 /*
  ************************************************************************
@@ -355,20 +361,65 @@ static INT8U SnrFloatToInt8U(float snrVal)
 
 /*******************************************************************/
 
+static BOOLEAN VbSnrXtalkSparsityIsUsable(const t_xtalkSparsity *sparsity, const t_crossMeasureList *cfrMeasureList)
+{
+  return ((sparsity != NULL) && (sparsity->valid == TRUE) && (sparsity->cfrIdx != NULL) &&
+          (sparsity->numBands > 0) && (sparsity->numCrossMeasures == cfrMeasureList->numCrossMeasures))?TRUE:FALSE;
+}
+
+/*******************************************************************/
+
+static INT32U VbSnrXtalkSparsityBandGet(const t_xtalkSparsity *sparsity, INT32U carrierIdx, INT32U band)
+{
+  // Carriers are walked in ascending order, so band only moves forward
+  while (((band + 1) < sparsity->numBands) && (carrierIdx >= sparsity->bandEnd[band]))
+  {
+    band++;
+  }
+
+  return band;
+}
+
+/*******************************************************************/
+
+static inline float VbSnrLinearGet(const t_snrLinearPlane *plane, const INT8U *measures, INT32U idx, INT8S compensation)
+{
+  float value;
+
+  if (plane != NULL)
+  {
+    value = VbEngineSnrLinearCacheValueGet(plane, idx);
+  }
+  else
+  {
+    value = VbEngineSnrLinearize(measures[idx], compensation);
+  }
+
+  return value;
+}
+
+/*******************************************************************/
+
 static t_VB_engineErrorCode VbSnrSISOIndCalculate(t_VBDriver *driver, t_node *node,
                                                   INT8U *snrCalculated, const t_crossMeasureList *cfrMeasureList,
-                                                  const t_processMeasure *bgnMeasure, INT32U lastXtalkCarrierIdx)
+                                                  const t_processMeasure *bgnMeasure, INT32U lastXtalkCarrierIdx,
+                                                  const t_xtalkSparsity *sparsity)
 {
   t_VB_engineErrorCode result = VB_ENGINE_ERROR_NONE;
   INT32U i;
+  INT32U j;
+  INT32U band = 0;
+  INT32U num_cfr;
+  const INT16U *cfr_idx = NULL;
+  float residual_rx1 = 0;
   INT32U last_cfr_xtalk_carrier;
   INT16U actual_carrier;
-  INT16U aux_value_index_table;
   float temp_float;
   t_crossMeasure* cfr_cross_measure;
   float sum_cks_linearized_rx1 = 0;
   float ci_rx1_direct = 0;
   float ni_linearized_rx1;
+  const t_snrLinearPlane *bgn_plane_rx1;
 
   if ((driver == NULL) || (node == NULL) || (snrCalculated == NULL) ||
       (cfrMeasureList == NULL) || (bgnMeasure == NULL))
@@ -378,18 +429,35 @@ static t_VB_engineErrorCode VbSnrSISOIndCalculate(t_VBDriver *driver, t_node *no
 
   if (result == VB_ENGINE_ERROR_NONE)
   {
+    num_cfr = cfrMeasureList->numCrossMeasures;
+
+    if (VbSnrXtalkSparsityIsUsable(sparsity, cfrMeasureList) == FALSE)
+    {
+      sparsity = NULL;
+    }
+
+    // Linear values from cache when available, otherwise from measures
+    bgn_plane_rx1 = VbEngineSnrLinearCacheBgnGet(node, FALSE);
+
     for(actual_carrier = 0 ; actual_carrier < bgnMeasure->numMeasures; actual_carrier++)
     {
       sum_cks_linearized_rx1 = 0;
       ci_rx1_direct = 0;
 
-      temp_float = (((float)(bgnMeasure->measuresRx1[actual_carrier]))/4)
-                - bgnMeasure->rxg1Compensation;
-      aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
-      ni_linearized_rx1 = LINEZLIZE_025GRID[aux_value_index_table];
+      if (sparsity != NULL)
+      {
+        // Accumulate only significant disturbers of current band
+        band = VbSnrXtalkSparsityBandGet(sparsity, actual_carrier, band);
+        cfr_idx = &sparsity->cfrIdx[band * sparsity->numCrossMeasures];
+        num_cfr = sparsity->numCfrIdx[band];
+        residual_rx1 = (actual_carrier < lastXtalkCarrierIdx)?sparsity->residualRx1[band]:0;
+      }
+
+      ni_linearized_rx1 = VbSnrLinearGet(bgn_plane_rx1, bgnMeasure->measuresRx1, actual_carrier, bgnMeasure->rxg1Compensation);
 
-      for(i=0; i < cfrMeasureList->numCrossMeasures; i++)
+      for(j=0; j < num_cfr; j++)
       {
+        i = (cfr_idx != NULL)?cfr_idx[j]:j;
         cfr_cross_measure = (t_crossMeasure*)&cfrMeasureList->crossMeasureArray[i];
         if(cfr_cross_measure->ownCFR)
         {
@@ -418,10 +486,9 @@ static t_VB_engineErrorCode VbSnrSISOIndCalculate(t_VBDriver *driver, t_node *no
             last_cfr_xtalk_carrier = MIN(lastXtalkCarrierIdx, cfr_cross_measure->measure.carrierGridIdxCutProfile);
             if(actual_carrier < last_cfr_xtalk_carrier)
             {
-              temp_float = (((float)(cfr_cross_measure->measure.measuresRx1[actual_carrier]))/4)
-                                    - cfr_cross_measure->measure.rxg1Compensation;
-              aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
-              sum_cks_linearized_rx1  += LINEZLIZE_025GRID[aux_value_index_table];
+              sum_cks_linearized_rx1  += VbSnrLinearGet(VbEngineSnrLinearCacheCfrGet(node, i, FALSE),
+                                                        cfr_cross_measure->measure.measuresRx1, actual_carrier,
+                                                        cfr_cross_measure->measure.rxg1Compensation);
             }
           }
         }
@@ -429,7 +496,7 @@ static t_VB_engineErrorCode VbSnrSISOIndCalculate(t_VBDriver *driver, t_node *no
 
       if(result == VB_ENGINE_ERROR_NONE)
       {
-        temp_float = ci_rx1_direct - 10*log10(ni_linearized_rx1 + sum_cks_linearized_rx1);
+        temp_float = ci_rx1_direct - 10*log10(ni_linearized_rx1 * (1 + residual_rx1) + sum_cks_linearized_rx1);
         snrCalculated[actual_carrier] = SnrFloatToInt8U(temp_float);
       }
 
@@ -448,13 +515,19 @@ static t_VB_engineErrorCode VbSnrSISOIndCalculate(t_VBDriver *driver, t_node *no
 static t_VB_engineErrorCode VbSnrMIMOIndCalculate(t_VBDriver *driver, t_node *node,
                                                   INT8U *snrCalculatedS1, INT8U *snrCalculatedS2,
                                                   const t_crossMeasureList *cfrMeasureList,
-                                                  const t_processMeasure *bgnMeasure, INT32U lastXtalkCarrierIdx)
+                                                  const t_processMeasure *bgnMeasure, INT32U lastXtalkCarrierIdx,
+                                                  const t_xtalkSparsity *sparsity)
 {
   t_VB_engineErrorCode result = VB_ENGINE_ERROR_NONE;
   INT32U i;
+  INT32U j;
+  INT32U band = 0;
+  INT32U num_cfr;
+  const INT16U *cfr_idx = NULL;
+  float residual_rx1 = 0;
+  float residual_rx2 = 0;
   INT32U last_cfr_xtalk_carrier;
   INT16U actual_carrier;
-  INT16U aux_value_index_table;
   BOOL crossed = FALSE;
   float temp_float;
   t_crossMeasure* cfr_cross_measure;
@@ -466,6 +539,9 @@ static t_VB_engineErrorCode VbSnrMIMOIndCalculate(t_VBDriver *driver, t_node *no
   float ci_rx2_crossed = 0;
   float ni_linearized_rx1;
   float ni_linearized_rx2;
+  const t_snrLinearPlane *bgn_plane_rx1;
+  const t_snrLinearPlane *bgn_plane_rx2;
+  const t_snrLinearPlane *cfr_plane;
 
   if ((driver == NULL) || (node == NULL) || (snrCalculatedS1 == NULL) ||
       (snrCalculatedS2 == NULL) || (cfrMeasureList == NULL) || (bgnMeasure == NULL))
@@ -475,28 +551,47 @@ static t_VB_engineErrorCode VbSnrMIMOIndCalculate(t_VBDriver *driver, t_node *no
 
   if (result == VB_ENGINE_ERROR_NONE)
   {
+    num_cfr = cfrMeasureList->numCrossMeasures;
+
+    if (VbSnrXtalkSparsityIsUsable(sparsity, cfrMeasureList) == FALSE)
+    {
+      sparsity = NULL;
+    }
+
+    // Linear values from cache when available, otherwise from measures
+    bgn_plane_rx1 = VbEngineSnrLinearCacheBgnGet(node, FALSE);
+    bgn_plane_rx2 = VbEngineSnrLinearCacheBgnGet(node, TRUE);
+
     for(actual_carrier = 0 ; actual_carrier < bgnMeasure->numMeasures ; actual_carrier+=2)
     {
       sum_cks_linearized_rx1 = 0;
       sum_cks_linearized_rx2 = 0;
 
+      if (sparsity != NULL)
+      {
+        // Accumulate only significant disturbers of current band
+        band = VbSnrXtalkSparsityBandGet(sparsity, actual_carrier, band);
+        cfr_idx = &sparsity->cfrIdx[band * sparsity->numCrossMeasures];
+        num_cfr = sparsity->numCfrIdx[band];
+        residual_rx1 = (actual_carrier < lastXtalkCarrierIdx)?sparsity->residualRx1[band]:0;
+        residual_rx2 = (actual_carrier < lastXtalkCarrierIdx)?sparsity->residualRx2[band]:0;
+      }
+
       ci_rx1_direct = 0;
       ci_rx1_crossed = 0;
       ci_rx2_direct = 0;
       ci_rx2_crossed = 0;
 
-      temp_float = (((float)(bgnMeasure->measuresRx1[actual_carrier]))/4)
-                               - bgnMeasure->rxg1Compensation;
-      aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
-      ni_linearized_rx1 = LINEZLIZE_025GRID[aux_value_index_table];
+      ni_linearized_rx1 = VbSnrLinearGet(bgn_plane_rx1, bgnMeasure->measuresRx1, actual_carrier, bgnMeasure->rxg1Compensation);
+      ni_linearized_rx2 = VbSnrLinearGet(bgn_plane_rx2, bgnMeasure->measuresRx2, actual_carrier, bgnMeasure->rxg2Compensation);
 
-      temp_float = (((float)(bgnMeasure->measuresRx2[actual_carrier]))/4)
-                              - bgnMeasure->rxg2Compensation;
-      aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
-      ni_linearized_rx2 = LINEZLIZE_025GRID[aux_value_index_table];
+      // Folded crosstalk is bounded as a fraction of BGN
+      ni_linearized_rx1 *= (1 + residual_rx1);
+      ni_linearized_rx2 *= (1 + residual_rx2);
 
-      for(i=0; i < cfrMeasureList->numCrossMeasures; i++)
+      for(j=0; j < num_cfr; j++)
       {
+        i = (cfr_idx != NULL)?cfr_idx[j]:j;
         cfr_cross_measure = (t_crossMeasure*)&cfrMeasureList->crossMeasureArray[i];
 
         if(cfr_cross_measure->ownCFR)
@@ -543,60 +638,46 @@ static t_VB_engineErrorCode VbSnrMIMOIndCalculate(t_VBDriver *driver, t_node *no
           if( (cfr_cross_measure->measure.measuresRx1 != NULL) &&
               (actual_carrier < last_cfr_xtalk_carrier) )
           {
+            cfr_plane = VbEngineSnrLinearCacheCfrGet(node, i, FALSE);
+
             if(cfr_cross_measure->measure.mimoMeas == TRUE)
             {
               // lin 10 ^ (h11/10)
-              temp_float = ((float)(cfr_cross_measure->measure.measuresRx1[actual_carrier])/4)
-                                             - cfr_cross_measure->measure.rxg1Compensation;
-
-              aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
-              sum_cks_linearized_rx1  += LINEZLIZE_025GRID[aux_value_index_table];
+              sum_cks_linearized_rx1  += VbSnrLinearGet(cfr_plane, cfr_cross_measure->measure.measuresRx1, actual_carrier,
+                                                        cfr_cross_measure->measure.rxg1Compensation);
 
               // lin 10 ^ (h12/10)
-              temp_float = ((float)(cfr_cross_measure->measure.measuresRx1[actual_carrier+1])/4)
-                                             - cfr_cross_measure->measure.rxg1Compensation;
-
-              aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
-              sum_cks_linearized_rx1  += LINEZLIZE_025GRID[aux_value_index_table];
+              sum_cks_linearized_rx1  += VbSnrLinearGet(cfr_plane, cfr_cross_measure->measure.measuresRx1, actual_carrier+1,
+                                                        cfr_cross_measure->measure.rxg1Compensation);
             }
             else
             {
               // actual_carrier already points to h11+h12
-              temp_float = ((float)(cfr_cross_measure->measure.measuresRx1[actual_carrier])/4)
-                                             - cfr_cross_measure->measure.rxg1Compensation;
-
-              aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
-              sum_cks_linearized_rx1  += LINEZLIZE_025GRID[aux_value_index_table];
+              sum_cks_linearized_rx1  += VbSnrLinearGet(cfr_plane, cfr_cross_measure->measure.measuresRx1, actual_carrier,
+                                                        cfr_cross_measure->measure.rxg1Compensation);
             }
           }
 
           if( (cfr_cross_measure->measure.measuresRx2 != NULL) &&
               (actual_carrier < last_cfr_xtalk_carrier) )
           {
+            cfr_plane = VbEngineSnrLinearCacheCfrGet(node, i, TRUE);
+
             if(cfr_cross_measure->measure.mimoMeas == TRUE)
             {
               // lin 10 ^ ((h22)/10)
-              temp_float = ((float)(cfr_cross_measure->measure.measuresRx2[actual_carrier])/4)
-                                             - cfr_cross_measure->measure.rxg2Compensation;
-
-              aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
-              sum_cks_linearized_rx2  += LINEZLIZE_025GRID[aux_value_index_table];
+              sum_cks_linearized_rx2  += VbSnrLinearGet(cfr_plane, cfr_cross_measure->measure.measuresRx2, actual_carrier,
+                                                        cfr_cross_measure->measure.rxg2Compensation);
 
               // lin 10 ^ ((h21)/10)
-              temp_float = ((float)(cfr_cross_measure->measure.measuresRx2[actual_carrier+1])/4)
-                                            - cfr_cross_measure->measure.rxg2Compensation;
-
-              aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
-              sum_cks_linearized_rx2  += LINEZLIZE_025GRID[aux_value_index_table];
+              sum_cks_linearized_rx2  += VbSnrLinearGet(cfr_plane, cfr_cross_measure->measure.measuresRx2, actual_carrier+1,
+                                                        cfr_cross_measure->measure.rxg2Compensation);
             }
             else
             {
               // actual_carrier already points to h22+h21
-              temp_float = ((float)(cfr_cross_measure->measure.measuresRx2[actual_carrier])/4)
-                                            - cfr_cross_measure->measure.rxg2Compensation;
-
-              aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
-              sum_cks_linearized_rx2  += LINEZLIZE_025GRID[aux_value_index_table];
+              sum_cks_linearized_rx2  += VbSnrLinearGet(cfr_plane, cfr_cross_measure->measure.measuresRx2, actual_carrier,
+                                                        cfr_cross_measure->measure.rxg2Compensation);
             }
           }
         }
@@ -653,6 +734,7 @@ static t_VB_engineErrorCode VbSnrMIMOIndCalculate(t_VBDriver *driver, t_node *no
  * @param[in] CFRMeasureList CFR measured
  * @param[in] SNRCalculated SNR calculated or NULL if error
  * @param[in] xtalkCutOffFreqCarrier frequency above which Crosstalk shall be ignored in the SNR computation
+ * @param[in] sparsity Significant disturbers per band or NULL to take into account all of them
  *
 **/
 static t_VB_engineErrorCode VbSnrDeviceCalculate(t_VBDriver *driver,
@@ -660,7 +742,8 @@ static t_VB_engineErrorCode VbSnrDeviceCalculate(t_VBDriver *driver,
                                                   const t_processMeasure *bgnMeasure,
                                                   const t_crossMeasureList *cfrMeasureList,
                                                   t_processMeasure *snrCalculated,
-                                                  INT32U xtalkCutOffFreqCarrier)
+                                                  INT32U xtalkCutOffFreqCarrier,
+                                                  const t_xtalkSparsity *sparsity)
 {
   t_VB_engineErrorCode result = VB_ENGINE_ERROR_NONE;
   BOOL linear_measures;
@@ -740,7 +823,7 @@ static t_VB_engineErrorCode VbSnrDeviceCalculate(t_VBDriver *driver,
             // Node measurer Mode is SISO
             // Look for Ni linearized,  Ci and sum of Cks linearizeds per carrier
             last_xtalk_carrier_idx = (xtalkCutOffFreqCarrier)/bgnMeasure->spacing;
-            result = VbSnrSISOIndCalculate(driver, node, snrCalculated->measuresRx1, cfrMeasureList, bgnMeasure, last_xtalk_carrier_idx);
+            result = VbSnrSISOIndCalculate(driver, node, snrCalculated->measuresRx1, cfrMeasureList, bgnMeasure, last_xtalk_carrier_idx, sparsity);
           }
           else
           {
@@ -781,7 +864,7 @@ static t_VB_engineErrorCode VbSnrDeviceCalculate(t_VBDriver *driver,
             snrCalculated->spacing <<= 1;
             last_xtalk_carrier_idx = (xtalkCutOffFreqCarrier)/bgnMeasure->spacing;
             result = VbSnrMIMOIndCalculate(driver, node, snrCalculated->measuresRx1, snrCalculated->measuresRx2,
-                cfrMeasureList, bgnMeasure, last_xtalk_carrier_idx);
+                cfrMeasureList, bgnMeasure, last_xtalk_carrier_idx, sparsity);
           }
         }
       }
@@ -856,6 +939,22 @@ static t_VB_engineErrorCode VbSnrCalculateNodeLoopCb(t_VBDriver *driver, t_domai
         }
       }
 
+      if ((ret == VB_ENGINE_ERROR_NONE) && (bgn_meas_is_valid == TRUE))
+      {
+        // Missing CFRs of stable pairs from history; on error they are ignored as before
+        VbEngineMeasHistoryCfrKeep(driver, node);
+
+        // Decimated CFRs back to BGN grid; on error SNR is computed with the CFRs as they are
+        VbEngineCfrResolutionReconstruct(driver, node);
+
+        // Classify disturbers of this plan; both SNR estimations below share it.
+        // On error sparsity info is invalidated and all disturbers are accumulated
+        VbEngineXtalkSparsityAnalyze(driver, node);
+
+        // Linear BGN and crosstalk planes; on error SNR linearizes the affected measures itself
+        VbEngineSnrLinearCacheUpdate(node);
+      }
+
       if ((ret == VB_ENGINE_ERROR_NONE) && (bgn_meas_is_valid == TRUE))
       {
         // Calculate SNR for given node with full interference
@@ -872,7 +971,8 @@ static t_VB_engineErrorCode VbSnrCalculateNodeLoopCb(t_VBDriver *driver, t_domai
                                    &(node->measures.BGNMeasure),
                                    &(node->measures.CFRMeasureList),
                                    &(node->measures.snrFullXtalk),
-                                   node->measures.BGNMeasure.numMeasures * node->measures.BGNMeasure.spacing);
+                                   node->measures.BGNMeasure.numMeasures * node->measures.BGNMeasure.spacing,
+                                   &(node->xtalkSparsity));
 
 #if VB_ENGINE_METRICS_ENABLED
         if(VbMetricsGetStatus())
@@ -890,6 +990,12 @@ static t_VB_engineErrorCode VbSnrCalculateNodeLoopCb(t_VBDriver *driver, t_domai
           }
         }
 #endif
+
+        if (ret == VB_ENGINE_ERROR_NONE)
+        {
+          VbEngineMeasStreamMeasurePublish(VB_MEAS_STREAM_TYPE_SNR_FULL, driver->clusterId, node->MAC, NULL,
+                                           &(node->measures.snrFullXtalk));
+        }
       }
 
       if ((ret == VB_ENGINE_ERROR_NONE) && (bgn_meas_is_valid == TRUE))
@@ -915,7 +1021,8 @@ static t_VB_engineErrorCode VbSnrCalculateNodeLoopCb(t_VBDriver *driver, t_domai
                                    &(node->measures.BGNMeasure),
                                    &(node->measures.CFRMeasureList),
                                    &(node->measures.snrLowXtalk),
-                                   low_band_idx_carrier);
+                                   low_band_idx_carrier,
+                                   &(node->xtalkSparsity));
 
 #if VB_ENGINE_METRICS_ENABLED
         if(VbMetricsGetStatus())
@@ -934,6 +1041,11 @@ static t_VB_engineErrorCode VbSnrCalculateNodeLoopCb(t_VBDriver *driver, t_domai
         }
 #endif
 
+        if (ret == VB_ENGINE_ERROR_NONE)
+        {
+          VbEngineMeasStreamMeasurePublish(VB_MEAS_STREAM_TYPE_SNR_LOW, driver->clusterId, node->MAC, NULL,
+                                           &(node->measures.snrLowXtalk));
+        }
       }
     }
   }
@@ -964,6 +1076,11 @@ static t_VB_engineErrorCode  VbSnrListDomainMacsCalculate(INT32U clusterId, BOOL
   {
     VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "SNR Calculation Error %d", ret);
   }
+  else if (*contCalc == TRUE)
+  {
+    // Plan measures and SNR are final, record them
+    VbEngineMeasHistoryRecord(clusterId);
+  }
 
   return ret;
 }
@@ -990,12 +1107,24 @@ static void *VbEngineSNRAndCapacityCompute(void *args)
     // Loop through all domains of cluster Id and calculate SNR (low band & Full)
     error = VbSnrListDomainMacsCalculate(clusterId, &cluster->snrComputationThreadRunning);
 
+    if ((error == VB_ENGINE_ERROR_NONE) && (cluster->snrComputationThreadRunning == TRUE))
+    {
+      // Select CFR resolution of next plans (informative, errors shall not abort boosting)
+      VbEngineCfrResolutionAnalyze(clusterId);
+    }
+
     if(error == VB_ENGINE_ERROR_NONE)
     {
       // Then compute channel capacities
       error = VbEngineChannelCapacityCalculate(clusterId, &cluster->snrComputationThreadRunning);
     }
 
+    if ((error == VB_ENGINE_ERROR_NONE) && (cluster->snrComputationThreadRunning == TRUE))
+    {
+      // Partition proposal is informative, errors shall not abort boosting
+      VbEngineClusterPartitionAnalyze(clusterId);
+    }
+
     if (cluster->snrComputationThreadRunning == TRUE)
     {
       if(error == VB_ENGINE_ERROR_NONE)
@@ -1343,6 +1472,11 @@ static t_VB_engineErrorCode VbChannelCapacityCalculateLoopCb(t_VBDriver *driver,
           }
         }
 
+        if (driver != NULL)
+        {
+          VbEngineMeasStreamCapacityPublish(driver->clusterId, node);
+        }
+
         if(cap_S1_per_bands != NULL)
         {
           free(cap_S1_per_bands);
@@ -1547,7 +1681,7 @@ t_VB_engineErrorCode VbCalculateSNRAndCapacityRun(INT32U clusterId)
 
 
     cluster->snrComputationThreadRunning = TRUE;
-    if (FALSE == VbThreadCreate(VB_ENGINE_COMPUTATION_THREAD_NAME, VbEngineSNRAndCapacityCompute, cluster, VB_ENGINE_COMPUTATION_THREAD_PRIORITY, &cluster->snrComputationThread))
+    if (FALSE == VbThreadCreate(VB_ENGINE_COMPUTATION_THREAD_NAME, VbEngineSNRAndCapacityCompute, cluster, VB_ENGINE_COMPUTATION_THREAD_CLASS, &cluster->snrComputationThread))
     {
       VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Can't create %s thread", VB_ENGINE_COMPUTATION_THREAD_NAME);
 
@@ -1655,6 +1789,19 @@ t_VB_engineErrorCode VbEngineSNRProbeForceRequest(t_VBDriver *driver, INT8U *mac
   return ret;
 }
 
+/*******************************************************************/
+
+float VbEngineSnrLinearize(INT8U value, INT8S compensation)
+{
+  float  temp_float;
+  INT16U aux_value_index_table;
+
+  temp_float = (((float)value)/4) - compensation;
+  aux_value_index_table = INDEX_LINEARIZE_TABLE(temp_float);
+
+  return LINEZLIZE_025GRID[aux_value_index_table];
+}
+
 
 
 
@@ -103,6 +103,14 @@ t_VB_engineErrorCode VbCalculateAllSNRAndCapacityStop(void);
  **/
 t_VB_engineErrorCode VbEngineSNRProbeForceRequest(t_VBDriver *driver, INT8U *mac);
 
+/**
+ * @brief Converts a quarter dB measure value to linear power
+ * @param[in] value Measure value (quarter dB)
+ * @param[in] compensation Rx gain compensation (dB)
+ * @return Linear power
+ **/
+float VbEngineSnrLinearize(INT8U value, INT8S compensation);
+
 
 /*******************************************************************/
 #endif /* VB_SNR_CALCULATION_H_ */
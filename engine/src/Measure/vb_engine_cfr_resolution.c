@@ -0,0 +1,661 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_cfr_resolution.c
+ * @brief Adaptive CFR measurement resolution
+ *
+ * @internal
+ *
+ * Crosstalk transfer functions are smooth across carriers, so CFRs can be
+ * measured on a coarser grid than BGN. Every RefreshPlans plans a full
+ * resolution plan is requested; from it, each decimation level is simulated
+ * (take one carrier out of N and interpolate back in linear domain) and the
+ * resulting error on the noise + crosstalk of every victim is translated to a
+ * worst case SNR error. Next plans request the highest decimation whose error
+ * stays under MaxError. Decimated CFRs are interpolated back to BGN grid
+ * before SNR computation.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_counters.h"
+#include "vb_engine_conf.h"
+#include "vb_measure_utils.h"
+#include "vb_engine_drivers_list.h"
+#include "vb_engine_cluster_list.h"
+#include "vb_engine_cfr_resolution.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_CFR_RESOLUTION_LUT_SIZE                  (MAX_INT8U + 1)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  INT32U  maxLog2;
+  INT32U  numNodes;
+  float   errorDb[VB_ENGINE_CFR_RESOLUTION_NUM_LEVELS];
+  float  *noise;                         ///< BGN + crosstalk per carrier (linear)
+  float  *error;                         ///< Crosstalk reconstruction error per level and carrier (linear)
+  INT32U  size;                          ///< Carriers allocated in noise
+} t_cfrResolutionErrorArgs;
+
+typedef struct
+{
+  t_writeFun writeFun;
+} t_cfrResolutionConsoleArgs;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static pthread_once_t vbEngineCfrResolutionLutOnce = PTHREAD_ONCE_INIT;
+static float          vbEngineCfrResolutionLut[VB_CFR_RESOLUTION_LUT_SIZE];
+
+/*
+ ************************************************************************
+ ** Private function definition
+ ************************************************************************
+ */
+
+static void CfrResolutionLutInit(void)
+{
+  INT32U v;
+
+  // Measures are given in quarters of dB
+  for (v = 0; v < VB_CFR_RESOLUTION_LUT_SIZE; v++)
+  {
+    vbEngineCfrResolutionLut[v] = powf(10, (float)v / 40);
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Linear factor of a receiver gain compensation, so that LUT value * factor equals
+ * VbEngineSnrLinearize(value, compensation) (compensation is subtracted in dB)
+ **/
+static float CfrResolutionCompensationLin(INT8S compensation)
+{
+  return powf(10, -(float)compensation / 10);
+}
+
+/*******************************************************************/
+
+static INT8U CfrResolutionLinToMeasure(float lin)
+{
+  INT8U ret = 0;
+  float value;
+
+  if (lin > 1)
+  {
+    value = roundf(40 * log10f(lin));
+    ret = (value > MAX_INT8U)?MAX_INT8U:(INT8U)value;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static INT32U CfrResolutionLog2Get(INT32U value)
+{
+  INT32U log2 = 0;
+
+  while (((value >> 1) > 0) && (log2 < (VB_ENGINE_CFR_RESOLUTION_NUM_LEVELS - 1)))
+  {
+    value >>= 1;
+    log2++;
+  }
+
+  return log2;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Interpolates a decimated measure array to a finer grid in linear domain
+ * @param[in] in Decimated measures
+ * @param[in] inSlots Number of carriers in decimated array
+ * @param[out] out Reconstructed measures
+ * @param[in] outSlots Number of carriers in reconstructed array
+ * @param[in] slotSize Measures per carrier (2 for MIMO measurers)
+ * @param[in] factor Decimation factor
+ **/
+static void CfrResolutionInterpolate(const INT8U *in, INT32U inSlots, INT8U *out, INT32U outSlots,
+                                     INT32U slotSize, INT32U factor)
+{
+  INT32U n;
+  INT32U e;
+  INT32U k0;
+  INT32U k1;
+  float  t;
+
+  for (n = 0; n < outSlots; n++)
+  {
+    k0 = MIN(n / factor, inSlots - 1);
+    k1 = MIN(k0 + 1, inSlots - 1);
+    t = (k1 > k0)?((float)(n - (k0 * factor)) / factor):0;
+
+    for (e = 0; e < slotSize; e++)
+    {
+      out[(n * slotSize) + e] = CfrResolutionLinToMeasure(
+          ((1 - t) * vbEngineCfrResolutionLut[in[(k0 * slotSize) + e]]) +
+          (t * vbEngineCfrResolutionLut[in[(k1 * slotSize) + e]]));
+    }
+  }
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode CfrResolutionMeasureReconstruct(t_processMeasure *cfr, const t_processMeasure *bgn)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT32U               slot_size = (bgn->mimoInd == TRUE)?2:1;
+  INT32U               factor = cfr->spacing / bgn->spacing;
+  INT32U               in_slots = cfr->numMeasures / slot_size;
+  INT32U               out_slots = bgn->numMeasures / slot_size;
+  INT8U               *rx1 = NULL;
+  INT8U               *rx2 = NULL;
+
+  if (in_slots == 0)
+  {
+    ret = VB_ENGINE_ERROR_PARAMS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    rx1 = (INT8U *)malloc(out_slots * slot_size);
+
+    if (rx1 == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (cfr->measuresRx2 != NULL))
+  {
+    rx2 = (INT8U *)malloc(out_slots * slot_size);
+
+    if (rx2 == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    CfrResolutionInterpolate(cfr->measuresRx1, in_slots, rx1, out_slots, slot_size, factor);
+
+    if (rx2 != NULL)
+    {
+      CfrResolutionInterpolate(cfr->measuresRx2, in_slots, rx2, out_slots, slot_size, factor);
+    }
+
+    free(cfr->measuresRx1);
+    free(cfr->measuresRx2);
+    cfr->measuresRx1 = rx1;
+    cfr->measuresRx2 = rx2;
+    cfr->numMeasures = out_slots * slot_size;
+    cfr->spacing = bgn->spacing;
+    cfr->carrierGridIdxCutProfile = FREQ2GRIDCARRIERIDX(cfr->freqCutProfile, cfr->spacing);
+  }
+  else
+  {
+    free(rx1);
+    free(rx2);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static BOOLEAN CfrResolutionBgnIsUsable(const t_processMeasure *bgn, const t_crossMeasureList *cfrMeasureList)
+{
+  return ((bgn->measuresRx1 != NULL) &&
+          ((bgn->mimoInd == FALSE) || (bgn->measuresRx2 != NULL)) &&
+          (bgn->numMeasures > 0) &&
+          (bgn->spacing > 0) &&
+          (cfrMeasureList->crossMeasureArray != NULL) &&
+          (cfrMeasureList->numCrossMeasures > 0))?TRUE:FALSE;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Accumulates, for one reception path of a victim, noise and reconstruction error of each decimation level
+ **/
+static void CfrResolutionPathErrorAdd(t_cfrResolutionErrorArgs *errorArgs, const t_processMeasure *bgn,
+                                      const t_crossMeasureList *cfrMeasureList, BOOLEAN rx2)
+{
+  const INT8U            *bgn_values = (rx2 == TRUE)?bgn->measuresRx2:bgn->measuresRx1;
+  const INT8U            *values;
+  const t_processMeasure *cfr;
+  INT32U                  slot_size = (bgn->mimoInd == TRUE)?2:1;
+  INT32U                  num_measures = bgn->numMeasures;
+  INT32U                  last;
+  INT32U                  factor;
+  INT32U                  slot;
+  INT32U                  n0;
+  INT32U                  n1;
+  INT32U                  c;
+  INT32U                  i;
+  INT32U                  l;
+  float                   scale;
+  float                   lin;
+  float                   rec;
+  float                   t;
+  float                   max_error[VB_ENGINE_CFR_RESOLUTION_NUM_LEVELS];
+
+  scale = CfrResolutionCompensationLin((rx2 == TRUE)?bgn->rxg2Compensation:bgn->rxg1Compensation);
+  for (c = 0; c < num_measures; c++)
+  {
+    errorArgs->noise[c] = vbEngineCfrResolutionLut[bgn_values[c]] * scale;
+  }
+  memset(errorArgs->error, 0, VB_ENGINE_CFR_RESOLUTION_NUM_LEVELS * num_measures * sizeof(float));
+
+  for (i = 0; i < cfrMeasureList->numCrossMeasures; i++)
+  {
+    cfr = &cfrMeasureList->crossMeasureArray[i].measure;
+    values = (rx2 == TRUE)?cfr->measuresRx2:cfr->measuresRx1;
+
+    // Only crosstalk measured at full resolution on BGN grid is useful here
+    if ((cfrMeasureList->crossMeasureArray[i].ownCFR == FALSE) && (values != NULL) &&
+        (cfr->spacing == bgn->spacing) && (cfr->firstCarrier == bgn->firstCarrier))
+    {
+      scale = CfrResolutionCompensationLin((rx2 == TRUE)?cfr->rxg2Compensation:cfr->rxg1Compensation);
+      last = MIN(num_measures, cfr->numMeasures);
+      last = MIN(last, cfr->carrierGridIdxCutProfile);
+
+      for (c = 0; c < last; c++)
+      {
+        lin = vbEngineCfrResolutionLut[values[c]];
+        errorArgs->noise[c & ~(slot_size - 1)] += lin * scale;
+
+        slot = c / slot_size;
+        for (l = 1; l <= errorArgs->maxLog2; l++)
+        {
+          // Same interpolation as applied to decimated CFRs, from samples 0, f, 2f...
+          factor = 1U << l;
+          n0 = (slot / factor) * factor;
+          n1 = n0 + factor;
+
+          if (((n1 * slot_size) + (c % slot_size)) < last)
+          {
+            t = (float)(slot - n0) / factor;
+            rec = ((1 - t) * vbEngineCfrResolutionLut[values[(n0 * slot_size) + (c % slot_size)]]) +
+                  (t * vbEngineCfrResolutionLut[values[(n1 * slot_size) + (c % slot_size)]]);
+          }
+          else
+          {
+            rec = vbEngineCfrResolutionLut[values[(n0 * slot_size) + (c % slot_size)]];
+          }
+
+          errorArgs->error[(l * num_measures) + (c & ~(slot_size - 1))] += fabsf(rec - lin) * scale;
+        }
+      }
+    }
+  }
+
+  memset(max_error, 0, sizeof(max_error));
+  for (c = 0; c < num_measures; c += slot_size)
+  {
+    for (l = 1; l <= errorArgs->maxLog2; l++)
+    {
+      max_error[l] = MAX(max_error[l], errorArgs->error[(l * num_measures) + c] / errorArgs->noise[c]);
+    }
+  }
+
+  for (l = 1; l <= errorArgs->maxLog2; l++)
+  {
+    errorArgs->errorDb[l] = MAX(errorArgs->errorDb[l], 10 * log10f(1 + max_error[l]));
+  }
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode CfrResolutionErrorNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode      ret = VB_ENGINE_ERROR_NONE;
+  t_cfrResolutionErrorArgs *error_args = (t_cfrResolutionErrorArgs *)args;
+  t_processMeasure         *bgn;
+  INT32U                    size;
+
+  if ((driver == NULL) || (node == NULL) || (error_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (CfrResolutionBgnIsUsable(&node->measures.BGNMeasure, &node->measures.CFRMeasureList) == TRUE)
+  {
+    bgn = &node->measures.BGNMeasure;
+
+    if (error_args->size < bgn->numMeasures)
+    {
+      size = bgn->numMeasures;
+
+      free(error_args->noise);
+      free(error_args->error);
+      error_args->noise = (float *)malloc(size * sizeof(float));
+      error_args->error = (float *)malloc(VB_ENGINE_CFR_RESOLUTION_NUM_LEVELS * size * sizeof(float));
+      error_args->size = size;
+
+      if ((error_args->noise == NULL) || (error_args->error == NULL))
+      {
+        error_args->size = 0;
+        ret = VB_ENGINE_ERROR_MALLOC;
+      }
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      CfrResolutionPathErrorAdd(error_args, bgn, &node->measures.CFRMeasureList, FALSE);
+
+      if (bgn->mimoInd == TRUE)
+      {
+        CfrResolutionPathErrorAdd(error_args, bgn, &node->measures.CFRMeasureList, TRUE);
+      }
+
+      error_args->numNodes++;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode CfrResolutionConsoleCb(t_VBCluster *cluster, void *args)
+{
+  t_VB_engineErrorCode        ret = VB_ENGINE_ERROR_NONE;
+  t_cfrResolutionConsoleArgs *console_args = (t_cfrResolutionConsoleArgs *)args;
+  t_cfrResolution            *resolution;
+  CHAR                        error_str[VB_ENGINE_CFR_RESOLUTION_NUM_LEVELS * 10 + 1];
+  INT32U                      l;
+
+  if ((cluster == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else
+  {
+    resolution = &cluster->cfrResolution;
+
+    error_str[0] = '\0';
+    for (l = 1; l < VB_ENGINE_CFR_RESOLUTION_NUM_LEVELS; l++)
+    {
+      if (resolution->errorValid == TRUE)
+      {
+        snprintf(error_str + strlen(error_str), sizeof(error_str) - strlen(error_str), "%9.3f ", resolution->errorDb[l]);
+      }
+      else
+      {
+        snprintf(error_str + strlen(error_str), sizeof(error_str) - strlen(error_str), "%9s ", "-");
+      }
+    }
+
+    console_args->writeFun("| %7u | %10u | %10u | %10u | %-30s |\n",
+        cluster->clusterInfo.clusterId,
+        1U << resolution->planDecimationLog2,
+        1U << resolution->decimationLog2,
+        resolution->plansLeft,
+        error_str);
+  }
+
+  return ret;
+}
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+INT8U VbEngineCfrResolutionPlanStart(INT32U clusterId)
+{
+  const t_vbEngineCfrResolutionConf *conf = VbEngineConfCfrResolutionGet();
+  t_VBCluster                       *cluster = NULL;
+  t_cfrResolution                   *resolution;
+  INT8U                              log2 = 0;
+
+  if (VbEngineClusterByIdGet(clusterId, &cluster) == VB_ENGINE_ERROR_NONE)
+  {
+    resolution = &cluster->cfrResolution;
+
+    if ((conf->enable == TRUE) && (resolution->plansLeft > 0))
+    {
+      // Decimation may have been lowered by configuration since it was selected
+      log2 = MIN(resolution->decimationLog2, CfrResolutionLog2Get(conf->maxDecimation));
+      resolution->plansLeft--;
+    }
+    else
+    {
+      // Full resolution plan, used to estimate the error of each decimation level
+      resolution->plansLeft = 0;
+    }
+
+    resolution->planDecimationLog2 = log2;
+
+    if (log2 > 0)
+    {
+      VbCounterIncrease(VB_ENGINE_COUNTER_MEASURE_PLAN_CFR_DECIMATED);
+    }
+  }
+
+  return log2;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineCfrResolutionReconstruct(t_VBDriver *driver, t_node *node)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_processMeasure     *bgn;
+  t_processMeasure     *cfr;
+  t_crossMeasureList   *cfr_measure_list;
+  INT32U                i;
+
+  if ((driver == NULL) || (node == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (CfrResolutionBgnIsUsable(&node->measures.BGNMeasure, &node->measures.CFRMeasureList) == TRUE)
+  {
+    pthread_once(&vbEngineCfrResolutionLutOnce, CfrResolutionLutInit);
+
+    bgn = &node->measures.BGNMeasure;
+    cfr_measure_list = &node->measures.CFRMeasureList;
+
+    for (i = 0; (i < cfr_measure_list->numCrossMeasures) && (ret == VB_ENGINE_ERROR_NONE); i++)
+    {
+      cfr = &cfr_measure_list->crossMeasureArray[i].measure;
+
+      if ((cfr->measuresRx1 != NULL) &&
+          (cfr->errorCode == VB_MEAS_ERRCODE_VALID) &&
+          (cfr->spacing > bgn->spacing) &&
+          ((cfr->spacing % bgn->spacing) == 0) &&
+          (cfr->firstCarrier == bgn->firstCarrier) &&
+          (cfr->mimoInd == bgn->mimoInd))
+      {
+        ret = CfrResolutionMeasureReconstruct(cfr, bgn);
+        VbCounterIncrease(VB_ENGINE_COUNTER_CFR_RECONSTRUCTED);
+      }
+    }
+
+    if (ret != VB_ENGINE_ERROR_NONE)
+    {
+      VbLogPrintExt(VB_LOG_ERROR, driver->vbDriverID, "%s MAC %s - CFR reconstruction error %d",
+          VbNodeTypeToStr(node->type), node->MACStr, ret);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineCfrResolutionAnalyze(INT32U clusterId)
+{
+  t_VB_engineErrorCode               ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineCfrResolutionConf *conf = VbEngineConfCfrResolutionGet();
+  t_VBCluster                       *cluster = NULL;
+  t_cfrResolution                   *resolution;
+  t_cfrResolutionErrorArgs           error_args;
+  INT32U                             log2 = 0;
+  INT32U                             l;
+
+  memset(&error_args, 0, sizeof(error_args));
+
+  ret = VbEngineClusterByIdGet(clusterId, &cluster);
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    resolution = &cluster->cfrResolution;
+
+    if ((conf->enable == FALSE) || (resolution->planDecimationLog2 > 0))
+    {
+      // Error can only be estimated from full resolution plans
+      ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_once(&vbEngineCfrResolutionLutOnce, CfrResolutionLutInit);
+
+    error_args.maxLog2 = CfrResolutionLog2Get(conf->maxDecimation);
+
+    ret = VbEngineDatamodelClusterXAllNodesLoop(CfrResolutionErrorNodeCb, clusterId, &error_args);
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (error_args.numNodes > 0))
+  {
+    // Highest decimation keeping error (and the error of every lower decimation) under threshold
+    for (l = 1; l <= error_args.maxLog2; l++)
+    {
+      if ((error_args.errorDb[l] * 100) > conf->maxError)
+      {
+        break;
+      }
+      log2 = l;
+    }
+
+    if (log2 != resolution->decimationLog2)
+    {
+      VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Cluster %u: CFR decimation %u -> %u (estimated SNR error %.3f dB)",
+          clusterId, 1U << resolution->decimationLog2, 1U << log2, error_args.errorDb[log2]);
+    }
+
+    memcpy(resolution->errorDb, error_args.errorDb, sizeof(resolution->errorDb));
+    resolution->errorValid = TRUE;
+    resolution->decimationLog2 = log2;
+    resolution->plansLeft = (log2 > 0)?conf->refreshPlans:0;
+  }
+
+  free(error_args.noise);
+  free(error_args.error);
+
+  if (ret == VB_ENGINE_ERROR_EXIT_LOOP_OK)
+  {
+    ret = VB_ENGINE_ERROR_NONE;
+  }
+  else if (ret != VB_ENGINE_ERROR_NONE)
+  {
+    VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Cluster %u: CFR resolution analysis error %d", clusterId, ret);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOL VbEngineCfrResolutionConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  const t_vbEngineCfrResolutionConf *conf = VbEngineConfCfrResolutionGet();
+  t_cfrResolutionConsoleArgs         console_args;
+
+  console_args.writeFun = writeFun;
+
+  writeFun("CFR resolution : %s (max decimation %u, max error %u.%02u dB, refresh each %u plans)\n",
+      (conf->enable == TRUE)?"ENABLED":"DISABLED",
+      conf->maxDecimation,
+      conf->maxError / 100, conf->maxError % 100,
+      conf->refreshPlans);
+
+  writeFun("===================================================================================\n");
+  writeFun("| %7s | %10s | %10s | %10s | %-30s |\n",
+      "Cluster", "Plan decim", "Next decim", "Plans left", "SNR error x2/x4/x8 (dB)");
+  writeFun("===================================================================================\n");
+
+  VbEngineDatamodelClustersLoop(CfrResolutionConsoleCb, &console_args);
+
+  writeFun("===================================================================================\n");
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
@@ -0,0 +1,123 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_cfr_resolution.h
+ * @brief Adaptive CFR measurement resolution
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_CFR_RESOLUTION_H_
+#define VB_ENGINE_CFR_RESOLUTION_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_CFR_RESOLUTION_DEFAULT_MAX_DECIMATION    (4)
+#define VB_ENGINE_CFR_RESOLUTION_DEFAULT_MAX_ERROR         (25)   // Hundredths of dB
+#define VB_ENGINE_CFR_RESOLUTION_DEFAULT_REFRESH_PLANS     (10)
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  BOOLEAN  enable;                       ///< Request decimated CFRs when allowed by estimated error
+  INT32U   maxDecimation;                ///< Highest CFR decimation factor (1, 2, 4 or 8)
+  INT32U   maxError;                     ///< Highest SNR error allowed (hundredths of dB)
+  INT32U   refreshPlans;                 ///< Decimated plans between full resolution plans
+} t_vbEngineCfrResolutionConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Selects the CFR resolution of a new measure plan.
+ * Shall be called once per measure plan built.
+ * @param[in] clusterId Cluster Id
+ * @return CFR decimation (log2) over BGN carrier grid
+ **/
+INT8U VbEngineCfrResolutionPlanStart(INT32U clusterId);
+
+/**
+ * @brief Reconstructs decimated CFRs of a node to BGN carrier grid, interpolating in linear domain.
+ * Shall be called before SNR computation of the node, with node domains locked.
+ * @param[in] driver Driver
+ * @param[in] node Victim node
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineCfrResolutionReconstruct(t_VBDriver *driver, t_node *node);
+
+/**
+ * @brief Estimates, from a full resolution plan, the SNR error of each decimation level
+ * and selects decimation of next plans.
+ * @param[in] clusterId Cluster Id
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineCfrResolutionAnalyze(INT32U clusterId);
+
+/**
+ * @brief Console command to show CFR resolution state
+ **/
+BOOL VbEngineCfrResolutionConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_CFR_RESOLUTION_H_ */
+
+/**
+ * @}
+ **/
@@ -0,0 +1,1160 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_meas_history.c
+ * @brief Measure plan history
+ *
+ * @internal
+ *
+ * For every node, the BGN, the CFR of every disturber (pair) and the SNR
+ * computed from them are recorded once per measure plan. Each pair keeps the
+ * values of its newest plan; older plans are stored as the difference against
+ * the next newer plan, which for a quasi static channel is mostly zero:
+ *
+ *   0x00-0x7F  run of 1-128 unchanged values
+ *   0x80-0xFE  value changed by -63..63 quarter dB (0xBF + delta)
+ *   0xFF       escape, next byte is the value itself
+ *
+ * The mean (dB) of every plan and the mean squared difference against the
+ * previous one are kept next to its encoding, so trend and variance queries
+ * need no decoding. While the memory of a cluster exceeds MemoryBudget,
+ * oldest plans of all pairs are dropped.
+ *
+ * A pair whose trend and plan to plan deviation stay under StableTrend and
+ * StableDeviation for MinPlans plans is flagged as stable; when its CFR is
+ * missing in a plan, the newest recorded CFR is kept instead of ignoring the
+ * disturber in SNR computation.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_mac_utils.h"
+#include "vb_counters.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_drivers_list.h"
+#include "vb_engine_cluster_list.h"
+#include "vb_engine_measure.h"
+#include "vb_measure_utils.h"
+#include "vb_engine_meas_history.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_MEAS_HISTORY_RUN_MAX                     (128)
+#define VB_MEAS_HISTORY_DELTA_ZERO                  (0xBF)
+#define VB_MEAS_HISTORY_DELTA_MAX                   (63)
+#define VB_MEAS_HISTORY_ESCAPE                      (0xFF)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  const t_vbEngineMeasHistoryConf *conf;
+  INT8U                            planId;
+  INT32U                           depth;
+  BOOLEAN                          recorded;
+  t_measHistoryInfo                info;
+} t_measHistoryLoopArgs;
+
+typedef struct
+{
+  t_writeFun writeFun;
+  INT8U      mac[ETH_ALEN];
+  BOOLEAN    found;
+} t_measHistoryConsoleArgs;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static pthread_mutex_t vbEngineMeasHistoryMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ ************************************************************************
+ ** Private function definition
+ ************************************************************************
+ */
+
+static INT32U MeasHistoryDeltaEncode(const INT8U *older, const INT8U *newer, INT32U numValues, INT8U *data)
+{
+  INT32U size = 0;
+  INT32U run;
+  INT32S delta;
+  INT32U i = 0;
+
+  while (i < numValues)
+  {
+    delta = (INT32S)older[i] - (INT32S)newer[i];
+
+    if (delta == 0)
+    {
+      run = 1;
+      while (((i + run) < numValues) && (run < VB_MEAS_HISTORY_RUN_MAX) && (older[i + run] == newer[i + run]))
+      {
+        run++;
+      }
+
+      data[size++] = (INT8U)(run - 1);
+      i += run;
+    }
+    else if ((delta >= -VB_MEAS_HISTORY_DELTA_MAX) && (delta <= VB_MEAS_HISTORY_DELTA_MAX))
+    {
+      data[size++] = (INT8U)(VB_MEAS_HISTORY_DELTA_ZERO + delta);
+      i++;
+    }
+    else
+    {
+      data[size++] = VB_MEAS_HISTORY_ESCAPE;
+      data[size++] = older[i];
+      i++;
+    }
+  }
+
+  return size;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode MeasHistoryDeltaApply(const INT8U *data, INT32U size, INT8U *values, INT32U numValues)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT32U               pos = 0;
+  INT32U               i = 0;
+  INT8U                token;
+
+  while ((pos < size) && (ret == VB_ENGINE_ERROR_NONE))
+  {
+    token = data[pos++];
+
+    if (token < VB_MEAS_HISTORY_RUN_MAX)
+    {
+      i += token + 1;
+    }
+    else if (token == VB_MEAS_HISTORY_ESCAPE)
+    {
+      if ((pos < size) && (i < numValues))
+      {
+        values[i++] = data[pos++];
+      }
+      else
+      {
+        ret = VB_ENGINE_ERROR_DATA_MODEL;
+      }
+    }
+    else if (i < numValues)
+    {
+      values[i] = (INT8U)((INT32S)values[i] + (INT32S)token - VB_MEAS_HISTORY_DELTA_ZERO);
+      i++;
+    }
+    else
+    {
+      ret = VB_ENGINE_ERROR_DATA_MODEL;
+    }
+
+    if (i > numValues)
+    {
+      ret = VB_ENGINE_ERROR_DATA_MODEL;
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (i != numValues))
+  {
+    ret = VB_ENGINE_ERROR_DATA_MODEL;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_measHistoryRecord *MeasHistoryRecordGet(t_measHistoryPair *pair, INT32U age)
+{
+  return &pair->records[(pair->newest + VB_ENGINE_MEAS_HISTORY_MAX_DEPTH - age) % VB_ENGINE_MEAS_HISTORY_MAX_DEPTH];
+}
+
+/*******************************************************************/
+
+static const t_measHistoryRecord *MeasHistoryRecordConstGet(const t_measHistoryPair *pair, INT32U age)
+{
+  return &pair->records[(pair->newest + VB_ENGINE_MEAS_HISTORY_MAX_DEPTH - age) % VB_ENGINE_MEAS_HISTORY_MAX_DEPTH];
+}
+
+/*******************************************************************/
+
+static void MeasHistoryPairTrim(t_measHistoryPair *pair, INT32U depth)
+{
+  t_measHistoryRecord *record;
+
+  while (pair->numRecords > depth)
+  {
+    record = MeasHistoryRecordGet(pair, pair->numRecords - 1);
+
+    if (record->data != NULL)
+    {
+      free(record->data);
+    }
+    memset(record, 0, sizeof(*record));
+
+    pair->numRecords--;
+  }
+}
+
+/*******************************************************************/
+
+static void MeasHistoryPairRelease(t_measHistoryPair *pair)
+{
+  MeasHistoryPairTrim(pair, 0);
+
+  if (pair->base != NULL)
+  {
+    free(pair->base);
+  }
+
+  memset(pair, 0, sizeof(*pair));
+}
+
+/*******************************************************************/
+
+static INT32U MeasHistoryPairBytesGet(const t_measHistoryPair *pair)
+{
+  INT32U bytes = sizeof(*pair) + pair->numValues;
+  INT32U age;
+
+  for (age = 0; age < pair->numRecords; age++)
+  {
+    bytes += MeasHistoryRecordConstGet(pair, age)->size;
+  }
+
+  return bytes;
+}
+
+/*******************************************************************/
+
+static float MeasHistoryMeanDbGet(t_measHistoryKind kind, const t_processMeasure *meta, const INT8U *values, INT32U numValues)
+{
+  INT32U sum[2] = {0, 0};
+  INT32U i;
+  float  mean = 0;
+
+  for (i = 0; i < numValues; i++)
+  {
+    sum[(i < meta->numMeasures)?0:1] += values[i];
+  }
+
+  if (numValues > 0)
+  {
+    mean = (float)(sum[0] + sum[1]) / (4 * numValues);
+
+    if (kind != VB_MEAS_HISTORY_KIND_SNR)
+    {
+      // Gain compensation of each Rx, weighted by its number of values
+      mean -= ((float)meta->rxg1Compensation * MIN(numValues, meta->numMeasures) +
+               (float)meta->rxg2Compensation * (numValues - MIN(numValues, meta->numMeasures))) / numValues;
+    }
+  }
+
+  return mean;
+}
+
+/*******************************************************************/
+
+static void MeasHistoryPairStableUpdate(t_measHistoryPair *pair, const t_vbEngineMeasHistoryConf *conf)
+{
+  float trend;
+  float variance;
+
+  pair->stable = FALSE;
+
+  if ((pair->numRecords >= MAX(conf->minPlans, 2)) &&
+      (VbEngineMeasHistoryTrendGet(pair, &trend) == TRUE) &&
+      (VbEngineMeasHistoryVarianceGet(pair, &variance) == TRUE))
+  {
+    if ((fabsf(trend) * 100 <= conf->stableTrend) &&
+        (sqrtf(variance) * 100 <= conf->stableDeviation))
+    {
+      pair->stable = TRUE;
+    }
+  }
+}
+
+/*******************************************************************/
+
+static t_measHistoryPair *MeasHistoryPairFind(t_measHistory *history, t_measHistoryKind kind, const INT8U *mac, INT32U hint)
+{
+  t_measHistoryPair *pair = NULL;
+  INT32U             i;
+
+  // CFR list order rarely changes between plans, try same position first
+  if ((hint < history->numPairs) &&
+      (history->pairs[hint].kind == kind) &&
+      (MACAddrQuickCmp(history->pairs[hint].MAC, mac) == TRUE))
+  {
+    pair = &history->pairs[hint];
+  }
+
+  for (i = 0; (i < history->numPairs) && (pair == NULL); i++)
+  {
+    if ((history->pairs[i].kind == kind) && (MACAddrQuickCmp(history->pairs[i].MAC, mac) == TRUE))
+    {
+      pair = &history->pairs[i];
+    }
+  }
+
+  return pair;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode MeasHistoryPairAdd(t_measHistory *history, t_measHistoryKind kind, const INT8U *mac, t_measHistoryPair **pair)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_measHistoryPair    *pairs;
+
+  pairs = (t_measHistoryPair *)realloc(history->pairs, (history->numPairs + 1) * sizeof(t_measHistoryPair));
+
+  if (pairs != NULL)
+  {
+    history->pairs = pairs;
+    *pair = &pairs[history->numPairs++];
+
+    memset(*pair, 0, sizeof(t_measHistoryPair));
+    (*pair)->kind = kind;
+    MACAddrClone((*pair)->MAC, mac);
+  }
+  else
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode MeasHistoryPairRecord(t_measHistoryPair *pair, const t_processMeasure *measure, BOOLEAN rx2,
+                                                  INT8U planId, const t_vbEngineMeasHistoryConf *conf)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_measHistoryRecord  *record;
+  INT8U                *values = NULL;
+  INT8U                *data = NULL;
+  INT32U                num_values;
+  INT32U                size = 0;
+  INT32U                i;
+  float                 diff;
+  float                 msd = 0;
+
+  num_values = (rx2 == TRUE)?(measure->numMeasures * 2):measure->numMeasures;
+
+  values = (INT8U *)malloc(num_values);
+
+  if (values == NULL)
+  {
+    ret = VB_ENGINE_ERROR_MALLOC;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    memcpy(values, measure->measuresRx1, measure->numMeasures);
+
+    if (rx2 == TRUE)
+    {
+      memcpy(values + measure->numMeasures, measure->measuresRx2, measure->numMeasures);
+    }
+
+    if ((pair->base != NULL) &&
+        ((pair->numValues != num_values) ||
+         (pair->meta.firstCarrier != measure->firstCarrier) ||
+         (pair->meta.spacing != measure->spacing)))
+    {
+      // Carrier grid changed, plans can not be compared
+      MeasHistoryPairTrim(pair, 0);
+      free(pair->base);
+      pair->base = NULL;
+    }
+
+    if (pair->base != NULL)
+    {
+      data = (INT8U *)malloc(2 * num_values);
+
+      if (data == NULL)
+      {
+        ret = VB_ENGINE_ERROR_MALLOC;
+      }
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (data != NULL))
+  {
+    // Previous newest plan is kept as the difference against this one
+    size = MeasHistoryDeltaEncode(pair->base, values, num_values, data);
+
+    record = MeasHistoryRecordGet(pair, 0);
+    record->data = (INT8U *)realloc(data, size);
+    if (record->data == NULL)
+    {
+      record->data = data;
+    }
+    record->size = size;
+    data = NULL;
+
+    for (i = 0; i < num_values; i++)
+    {
+      diff = ((float)pair->base[i] - (float)values[i]) / 4;
+      msd += diff * diff;
+    }
+    msd /= num_values;
+
+    // Oldest plan leaves the ring when full
+    MeasHistoryPairTrim(pair, MIN(conf->depth, VB_ENGINE_MEAS_HISTORY_MAX_DEPTH) - 1);
+    free(pair->base);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pair->newest = (pair->numRecords > 0)?((pair->newest + 1) % VB_ENGINE_MEAS_HISTORY_MAX_DEPTH):0;
+    pair->numRecords++;
+
+    record = MeasHistoryRecordGet(pair, 0);
+    memset(record, 0, sizeof(*record));
+    record->planId = planId;
+    record->meanDb = MeasHistoryMeanDbGet(pair->kind, measure, values, num_values);
+    record->msdDb = msd;
+    record->msdValid = (pair->numRecords > 1)?TRUE:FALSE;
+
+    pair->meta = *measure;
+    pair->meta.measures = NULL;
+    pair->meta.measuresRx1 = NULL;
+    pair->meta.measuresRx2 = NULL;
+    pair->numValues = num_values;
+    pair->base = values;
+    pair->numMissed = 0;
+    values = NULL;
+
+    MeasHistoryPairStableUpdate(pair, conf);
+  }
+
+  if (values != NULL)
+  {
+    free(values);
+  }
+
+  if (data != NULL)
+  {
+    free(data);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode MeasHistoryMeasureRecord(t_measHistory *history, t_measHistoryKind kind, const INT8U *mac,
+                                                     INT32U hint, const t_processMeasure *measure, BOOLEAN rx2,
+                                                     INT8U planId, const t_vbEngineMeasHistoryConf *conf)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_measHistoryPair    *pair;
+
+  if ((measure->measuresRx1 != NULL) && (measure->numMeasures > 0) &&
+      ((rx2 == FALSE) || (measure->measuresRx2 != NULL)))
+  {
+    pair = MeasHistoryPairFind(history, kind, mac, hint);
+
+    if (pair == NULL)
+    {
+      ret = MeasHistoryPairAdd(history, kind, mac, &pair);
+    }
+    else if (pair->kept == TRUE)
+    {
+      // Not measured in this plan, values come from history
+      pair->kept = FALSE;
+      ret = VB_ENGINE_ERROR_SKIP;
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      ret = MeasHistoryPairRecord(pair, measure, rx2, planId, conf);
+    }
+    else if (ret == VB_ENGINE_ERROR_SKIP)
+    {
+      ret = VB_ENGINE_ERROR_NONE;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode MeasHistoryNodeRecord(t_node *node, INT8U planId, const t_vbEngineMeasHistoryConf *conf)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_measHistory        *history = &node->measHistory;
+  t_crossMeasure       *cfr;
+  INT32U                i;
+
+  // Pairs recorded in this plan reset numMissed
+  for (i = 0; i < history->numPairs; i++)
+  {
+    history->pairs[i].numMissed++;
+  }
+
+  ret = MeasHistoryMeasureRecord(history, VB_MEAS_HISTORY_KIND_BGN, node->MAC, 0,
+                                 &node->measures.BGNMeasure, node->measures.BGNMeasure.mimoInd, planId, conf);
+
+  for (i = 0; (i < node->measures.CFRMeasureList.numCrossMeasures) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    cfr = &node->measures.CFRMeasureList.crossMeasureArray[i];
+
+    ret = MeasHistoryMeasureRecord(history, VB_MEAS_HISTORY_KIND_CFR, cfr->MAC, i + 1,
+                                   &cfr->measure, (cfr->measure.measuresRx2 != NULL)?TRUE:FALSE, planId, conf);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = MeasHistoryMeasureRecord(history, VB_MEAS_HISTORY_KIND_SNR, node->MAC, node->measures.CFRMeasureList.numCrossMeasures + 1,
+                                   &node->measures.snrFullXtalk, node->measures.snrFullXtalk.mimoInd, planId, conf);
+  }
+
+  // Pairs not measured for a whole history depth are forgotten (disturber left the cluster)
+  i = 0;
+  while (i < history->numPairs)
+  {
+    if (history->pairs[i].numMissed >= conf->depth)
+    {
+      MeasHistoryPairRelease(&history->pairs[i]);
+      history->pairs[i] = history->pairs[history->numPairs - 1];
+      history->numPairs--;
+    }
+    else
+    {
+      i++;
+    }
+  }
+
+  history->recorded = TRUE;
+  history->lastPlanId = planId;
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void MeasHistoryNodeInfoAdd(t_measHistory *history, t_measHistoryInfo *info)
+{
+  INT32U i;
+
+  history->numBytes = 0;
+
+  for (i = 0; i < history->numPairs; i++)
+  {
+    history->numBytes += MeasHistoryPairBytesGet(&history->pairs[i]);
+    info->numStable += (history->pairs[i].stable == TRUE)?1:0;
+  }
+
+  info->numPairs += history->numPairs;
+  info->numBytes += history->numBytes;
+  info->numKept += history->numKept;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode MeasHistoryRecordNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode   ret = VB_ENGINE_ERROR_NONE;
+  t_measHistoryLoopArgs *loop_args = (t_measHistoryLoopArgs *)args;
+
+  if ((driver == NULL) || (domain == NULL) || (node == NULL) || (loop_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    if ((VbEngineDatamodelDomainIsComplete(domain) == TRUE) &&
+        (VbMeasureIsValid(loop_args->planId, &node->measures.BGNMeasure) == TRUE) &&
+        (node->measures.snrFullXtalk.measuresRx1 != NULL) &&
+        ((node->measHistory.recorded == FALSE) || (node->measHistory.lastPlanId != loop_args->planId)))
+    {
+      ret = MeasHistoryNodeRecord(node, loop_args->planId, loop_args->conf);
+      loop_args->recorded = TRUE;
+
+      if (ret != VB_ENGINE_ERROR_NONE)
+      {
+        VbLogPrintExt(VB_LOG_ERROR, driver->vbDriverID, "%s MAC %s - Measure history record error %d",
+            VbNodeTypeToStr(node->type), node->MACStr, ret);
+
+        // Keep recording other nodes
+        ret = VB_ENGINE_ERROR_NONE;
+      }
+    }
+
+    MeasHistoryNodeInfoAdd(&node->measHistory, &loop_args->info);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode MeasHistoryTrimNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode   ret = VB_ENGINE_ERROR_NONE;
+  t_measHistoryLoopArgs *loop_args = (t_measHistoryLoopArgs *)args;
+  INT32U                 i;
+
+  if ((node == NULL) || (loop_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else
+  {
+    if (loop_args->conf == NULL)
+    {
+      // History disabled
+      VbEngineMeasHistoryRelease(&node->measHistory);
+    }
+
+    for (i = 0; i < node->measHistory.numPairs; i++)
+    {
+      if (node->measHistory.pairs[i].numRecords > loop_args->depth)
+      {
+        loop_args->info.numTrimmed++;
+      }
+
+      MeasHistoryPairTrim(&node->measHistory.pairs[i], loop_args->depth);
+      MeasHistoryPairStableUpdate(&node->measHistory.pairs[i], loop_args->conf);
+    }
+
+    MeasHistoryNodeInfoAdd(&node->measHistory, &loop_args->info);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode MeasHistoryConsoleClusterCb(t_VBCluster *cluster, void *args)
+{
+  t_VB_engineErrorCode      ret = VB_ENGINE_ERROR_NONE;
+  t_measHistoryConsoleArgs *console_args = (t_measHistoryConsoleArgs *)args;
+  t_measHistoryInfo         info;
+
+  if ((cluster == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else
+  {
+    pthread_mutex_lock(&vbEngineMeasHistoryMutex);
+    info = cluster->measHistory;
+    pthread_mutex_unlock(&vbEngineMeasHistoryMutex);
+
+    console_args->writeFun("| %7u | %5u | %8u | %8u | %8u | %10u | %8u | %8u |\n",
+        cluster->clusterInfo.clusterId,
+        info.depth,
+        info.numPlans,
+        info.numPairs,
+        info.numStable,
+        info.numBytes,
+        info.numTrimmed,
+        info.numKept);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode MeasHistoryConsoleNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode      ret = VB_ENGINE_ERROR_NONE;
+  t_measHistoryConsoleArgs *console_args = (t_measHistoryConsoleArgs *)args;
+  static const CHAR        *kind_str[VB_MEAS_HISTORY_KIND_LAST] = {"BGN", "CFR", "SNR"};
+  const t_measHistoryPair  *pair;
+  INT32U                    i;
+  float                     value;
+  CHAR                      mac_str[MAC_STR_LEN];
+  CHAR                      trend_str[12];
+  CHAR                      deviation_str[12];
+
+  if ((node == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (MACAddrQuickCmp(node->MAC, console_args->mac) == TRUE)
+  {
+    console_args->found = TRUE;
+
+    if (VbEngineMeasHistorySnrDriftGet(node, &value) == TRUE)
+    {
+      console_args->writeFun("%s MAC %s - SNR drift %.2f dB, %u bytes\n", VbNodeTypeToStr(node->type), node->MACStr, value,
+          node->measHistory.numBytes);
+    }
+    else
+    {
+      console_args->writeFun("%s MAC %s - SNR drift -, %u bytes\n", VbNodeTypeToStr(node->type), node->MACStr,
+          node->measHistory.numBytes);
+    }
+
+    console_args->writeFun("=========================================================================================\n");
+    console_args->writeFun("| %4s | %17s | %5s | %8s | %9s | %9s | %9s | %6s |\n",
+        "Kind", "MAC", "Plans", "Bytes", "Mean(dB)", "Trend", "Deviation", "Stable");
+    console_args->writeFun("=========================================================================================\n");
+
+    for (i = 0; i < node->measHistory.numPairs; i++)
+    {
+      pair = &node->measHistory.pairs[i];
+
+      MACAddrMem2str(mac_str, pair->MAC);
+
+      if (VbEngineMeasHistoryTrendGet(pair, &value) == TRUE)
+      {
+        snprintf(trend_str, sizeof(trend_str), "%9.3f", value);
+      }
+      else
+      {
+        snprintf(trend_str, sizeof(trend_str), "%9s", "-");
+      }
+
+      if (VbEngineMeasHistoryVarianceGet(pair, &value) == TRUE)
+      {
+        snprintf(deviation_str, sizeof(deviation_str), "%9.3f", sqrtf(value));
+      }
+      else
+      {
+        snprintf(deviation_str, sizeof(deviation_str), "%9s", "-");
+      }
+
+      console_args->writeFun("| %4s | %17s | %5u | %8u | %9.2f | %s | %s | %6s |\n",
+          kind_str[pair->kind],
+          mac_str,
+          pair->numRecords,
+          MeasHistoryPairBytesGet(pair),
+          (pair->numRecords > 0)?MeasHistoryRecordConstGet(pair, 0)->meanDb:0,
+          trend_str,
+          deviation_str,
+          pair->stable?"YES":"NO");
+    }
+
+    console_args->writeFun("=========================================================================================\n");
+    console_args->writeFun("Trend in dB per plan; deviation is RMS plan to plan difference (dB)\n");
+
+    ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+  }
+
+  return ret;
+}
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+t_VB_engineErrorCode VbEngineMeasHistoryRecord(INT32U clusterId)
+{
+  t_VB_engineErrorCode             ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineMeasHistoryConf *conf = VbEngineConfMeasHistoryGet();
+  t_VBCluster                     *cluster = NULL;
+  t_measHistoryLoopArgs            loop_args;
+  INT32U                           budget;
+
+  memset(&loop_args, 0, sizeof(loop_args));
+
+  ret = VbEngineClusterByIdGet(clusterId, &cluster);
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    if (conf->enable == FALSE)
+    {
+      if (cluster->measHistory.numPairs > 0)
+      {
+        // Release memory of recorded plans
+        ret = VbEngineDatamodelClusterXAllNodesLoop(MeasHistoryTrimNodeCb, clusterId, &loop_args);
+      }
+      else
+      {
+        ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+      }
+    }
+    else
+    {
+      loop_args.conf = conf;
+      loop_args.depth = MIN(conf->depth, VB_ENGINE_MEAS_HISTORY_MAX_DEPTH);
+
+      ret = VbEngineMeasurePlanIdGet(clusterId, &loop_args.planId);
+
+      if (ret == VB_ENGINE_ERROR_NONE)
+      {
+        ret = VbEngineDatamodelClusterXAllNodesLoop(MeasHistoryRecordNodeCb, clusterId, &loop_args);
+      }
+
+      // Drop oldest plan of every pair until cluster fits its memory budget
+      budget = conf->memoryBudget * 1024;
+      while ((ret == VB_ENGINE_ERROR_NONE) && (loop_args.info.numBytes > budget) && (loop_args.depth > 1))
+      {
+        loop_args.depth--;
+        memset(&loop_args.info, 0, sizeof(loop_args.info));
+
+        ret = VbEngineDatamodelClusterXAllNodesLoop(MeasHistoryTrimNodeCb, clusterId, &loop_args);
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbEngineMeasHistoryMutex);
+    loop_args.info.depth = loop_args.depth;
+    loop_args.info.numPlans = cluster->measHistory.numPlans + ((loop_args.recorded == TRUE)?1:0);
+    loop_args.info.numTrimmed += cluster->measHistory.numTrimmed;
+    cluster->measHistory = loop_args.info;
+    pthread_mutex_unlock(&vbEngineMeasHistoryMutex);
+  }
+  else if (ret == VB_ENGINE_ERROR_EXIT_LOOP_OK)
+  {
+    ret = VB_ENGINE_ERROR_NONE;
+  }
+  else
+  {
+    VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Cluster %u - Measure history error %d", clusterId, ret);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineMeasHistoryCfrKeep(t_VBDriver *driver, t_node *node)
+{
+  t_VB_engineErrorCode             ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineMeasHistoryConf *conf = VbEngineConfMeasHistoryGet();
+  t_measHistoryPair               *pair;
+  t_crossMeasure                  *cfr;
+  t_processMeasure                *measure;
+  INT32U                           i;
+
+  if ((driver == NULL) || (node == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if ((conf->enable == TRUE) && (conf->keepStable == TRUE))
+  {
+    for (i = 0; (i < node->measures.CFRMeasureList.numCrossMeasures) && (ret == VB_ENGINE_ERROR_NONE); i++)
+    {
+      cfr = &node->measures.CFRMeasureList.crossMeasureArray[i];
+      measure = &cfr->measure;
+
+      if ((cfr->ownCFR == FALSE) && (measure->measuresRx1 == NULL))
+      {
+        pair = MeasHistoryPairFind(&node->measHistory, VB_MEAS_HISTORY_KIND_CFR, cfr->MAC, i + 1);
+
+        if ((pair != NULL) && (pair->stable == TRUE) && (pair->base != NULL))
+        {
+          *measure = pair->meta;
+          measure->planID = node->measures.BGNMeasure.planID;
+          measure->errorCode = VB_MEAS_ERRCODE_VALID;
+          measure->measuresRx1 = (INT8U *)malloc(measure->numMeasures);
+
+          if ((measure->measuresRx1 != NULL) && (pair->numValues > measure->numMeasures))
+          {
+            measure->measuresRx2 = (INT8U *)malloc(measure->numMeasures);
+          }
+
+          if ((measure->measuresRx1 == NULL) ||
+              ((pair->numValues > measure->numMeasures) && (measure->measuresRx2 == NULL)))
+          {
+            VbDatamodelNodeProcessMeasureDestroy(measure);
+            memset(measure, 0, sizeof(*measure));
+            ret = VB_ENGINE_ERROR_MALLOC;
+          }
+          else
+          {
+            memcpy(measure->measuresRx1, pair->base, measure->numMeasures);
+
+            if (measure->measuresRx2 != NULL)
+            {
+              memcpy(measure->measuresRx2, pair->base + measure->numMeasures, measure->numMeasures);
+            }
+
+            pair->kept = TRUE;
+            node->measHistory.numKept++;
+            VbCounterIncrease(VB_ENGINE_COUNTER_MEAS_HISTORY_CFR_KEPT);
+          }
+        }
+      }
+    }
+
+    if (ret != VB_ENGINE_ERROR_NONE)
+    {
+      VbLogPrintExt(VB_LOG_ERROR, driver->vbDriverID, "%s MAC %s - Error keeping CFR from history %d",
+          VbNodeTypeToStr(node->type), node->MACStr, ret);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEngineMeasHistoryRelease(t_measHistory *history)
+{
+  INT32U i;
+
+  if (history != NULL)
+  {
+    for (i = 0; i < history->numPairs; i++)
+    {
+      MeasHistoryPairRelease(&history->pairs[i]);
+    }
+
+    if (history->pairs != NULL)
+    {
+      free(history->pairs);
+    }
+
+    memset(history, 0, sizeof(*history));
+  }
+}
+
+/*******************************************************************/
+
+const t_measHistoryPair *VbEngineMeasHistoryPairGet(const t_node *node, t_measHistoryKind kind, const INT8U *mac)
+{
+  const t_measHistoryPair *pair = NULL;
+
+  if ((node != NULL) && (kind < VB_MEAS_HISTORY_KIND_LAST))
+  {
+    pair = MeasHistoryPairFind((t_measHistory *)&node->measHistory, kind,
+                               ((kind == VB_MEAS_HISTORY_KIND_CFR) && (mac != NULL))?mac:node->MAC, 0);
+  }
+
+  return pair;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineMeasHistoryValuesGet(const t_measHistoryPair *pair, INT32U age, INT8U *values)
+{
+  t_VB_engineErrorCode       ret = VB_ENGINE_ERROR_NONE;
+  const t_measHistoryRecord *record;
+  INT32U                     a;
+
+  if ((pair == NULL) || (values == NULL) || (pair->base == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (age >= pair->numRecords)
+  {
+    ret = VB_ENGINE_ERROR_NOT_FOUND;
+  }
+  else
+  {
+    memcpy(values, pair->base, pair->numValues);
+
+    // Walk back from newest plan
+    for (a = 1; (a <= age) && (ret == VB_ENGINE_ERROR_NONE); a++)
+    {
+      record = MeasHistoryRecordConstGet(pair, a);
+      ret = MeasHistoryDeltaApply(record->data, record->size, values, pair->numValues);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbEngineMeasHistoryTrendGet(const t_measHistoryPair *pair, float *trend)
+{
+  BOOLEAN found = FALSE;
+  INT32U  age;
+  float   x;
+  float   mean_x;
+  float   mean_y = 0;
+  float   sxy = 0;
+  float   sxx = 0;
+
+  if ((pair != NULL) && (trend != NULL) && (pair->numRecords >= 2))
+  {
+    mean_x = (float)(pair->numRecords - 1) / 2;
+
+    for (age = 0; age < pair->numRecords; age++)
+    {
+      mean_y += MeasHistoryRecordConstGet(pair, age)->meanDb;
+    }
+    mean_y /= pair->numRecords;
+
+    for (age = 0; age < pair->numRecords; age++)
+    {
+      // Oldest plan first
+      x = (float)(pair->numRecords - 1 - age) - mean_x;
+      sxy += x * (MeasHistoryRecordConstGet(pair, age)->meanDb - mean_y);
+      sxx += x * x;
+    }
+
+    *trend = sxy / sxx;
+    found = TRUE;
+  }
+
+  return found;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbEngineMeasHistoryVarianceGet(const t_measHistoryPair *pair, float *variance)
+{
+  BOOLEAN                    found = FALSE;
+  const t_measHistoryRecord *record;
+  INT32U                     age;
+  INT32U                     num = 0;
+  float                      sum = 0;
+
+  if ((pair != NULL) && (variance != NULL))
+  {
+    for (age = 0; age < pair->numRecords; age++)
+    {
+      record = MeasHistoryRecordConstGet(pair, age);
+
+      if (record->msdValid == TRUE)
+      {
+        sum += record->msdDb;
+        num++;
+      }
+    }
+
+    if (num > 0)
+    {
+      *variance = sum / num;
+      found = TRUE;
+    }
+  }
+
+  return found;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbEngineMeasHistorySnrDriftGet(const t_node *node, float *drift)
+{
+  BOOLEAN                  found = FALSE;
+  const t_measHistoryPair *pair;
+
+  pair = VbEngineMeasHistoryPairGet(node, VB_MEAS_HISTORY_KIND_SNR, NULL);
+
+  if ((pair != NULL) && (drift != NULL) && (pair->numRecords >= 2))
+  {
+    *drift = MeasHistoryRecordConstGet(pair, 0)->meanDb - MeasHistoryRecordConstGet(pair, pair->numRecords - 1)->meanDb;
+    found = TRUE;
+  }
+
+  return found;
+}
+
+/*******************************************************************/
+
+BOOL VbEngineMeasHistoryConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  const t_vbEngineMeasHistoryConf *conf = VbEngineConfMeasHistoryGet();
+  t_measHistoryConsoleArgs         console_args;
+
+  memset(&console_args, 0, sizeof(console_args));
+  console_args.writeFun = writeFun;
+
+  if ((cmd != NULL) && (cmd[1] != NULL))
+  {
+    MACAddrStr2mem(console_args.mac, cmd[1]);
+    VbEngineDatamodelAllNodesLoop(MeasHistoryConsoleNodeCb, &console_args);
+
+    if (console_args.found == FALSE)
+    {
+      writeFun("Node %s not found\n", cmd[1]);
+    }
+  }
+  else
+  {
+    writeFun("Measure history : %s (depth %u, budget %u KB per cluster, stable after %u plans with trend <= %u.%02u dB and deviation <= %u.%02u dB, keep stable %s)\n",
+        (conf->enable == TRUE)?"ENABLED":"DISABLED",
+        conf->depth,
+        conf->memoryBudget,
+        conf->minPlans,
+        conf->stableTrend / 100, conf->stableTrend % 100,
+        conf->stableDeviation / 100, conf->stableDeviation % 100,
+        (conf->keepStable == TRUE)?"YES":"NO");
+
+    writeFun("=========================================================================================\n");
+    writeFun("| %7s | %5s | %8s | %8s | %8s | %10s | %8s | %8s |\n",
+        "Cluster", "Depth", "Plans", "Pairs", "Stable", "Bytes", "Trimmed", "Kept");
+    writeFun("=========================================================================================\n");
+    VbEngineDatamodelClustersLoop(MeasHistoryConsoleClusterCb, &console_args);
+    writeFun("=========================================================================================\n");
+    writeFun("Use 'mhist <MAC>' to show pairs of a node\n");
+  }
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
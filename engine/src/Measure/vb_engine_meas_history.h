@@ -0,0 +1,169 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_meas_history.h
+ * @brief Measure plan history
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_MEAS_HISTORY_H_
+#define VB_ENGINE_MEAS_HISTORY_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_MEAS_HISTORY_DEFAULT_DEPTH               (8)
+#define VB_ENGINE_MEAS_HISTORY_DEFAULT_MEMORY_BUDGET       (4096)  // KB per cluster
+#define VB_ENGINE_MEAS_HISTORY_DEFAULT_MIN_PLANS           (4)
+#define VB_ENGINE_MEAS_HISTORY_DEFAULT_STABLE_TREND        (5)     // Hundredths of dB per plan
+#define VB_ENGINE_MEAS_HISTORY_DEFAULT_STABLE_DEVIATION    (50)    // Hundredths of dB
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  BOOLEAN  enable;                       ///< Record BGN, CFR and SNR of last measure plans
+  INT32U   depth;                        ///< Plans kept per pair
+  INT32U   memoryBudget;                 ///< Memory per cluster (KB); oldest plans are dropped beyond it
+  INT32U   minPlans;                     ///< Plans needed to flag a pair as stable
+  INT32U   stableTrend;                  ///< Highest mean drift of a stable pair (hundredths of dB per plan)
+  INT32U   stableDeviation;              ///< Highest RMS plan to plan difference of a stable pair (hundredths of dB)
+  BOOLEAN  keepStable;                   ///< CFRs of stable pairs missing in a plan are kept from history
+} t_vbEngineMeasHistoryConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Records BGN, CFRs and SNR of current measure plan of every node of a cluster,
+ * and drops oldest plans while cluster memory budget is exceeded.
+ * Shall be called once SNR has been computed.
+ * @param[in] clusterId Cluster Id
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineMeasHistoryRecord(INT32U clusterId);
+
+/**
+ * @brief Fills CFRs missing in current measure plan with the newest recorded ones,
+ * for pairs flagged as stable. Shall be called with driver domains locked, before computing SNR.
+ * @param[in] driver Driver
+ * @param[in,out] node Victim node
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineMeasHistoryCfrKeep(t_VBDriver *driver, t_node *node);
+
+/**
+ * @brief Releases all memory of a node history
+ * @param[in,out] history History to release
+ **/
+void VbEngineMeasHistoryRelease(t_measHistory *history);
+
+/**
+ * @brief Gets the history of a measure pair of a node
+ * @param[in] node Victim node
+ * @param[in] kind Measure kind
+ * @param[in] mac Disturber MAC for CFR; ignored for BGN and SNR
+ * @return Pair or NULL if not recorded
+ **/
+const t_measHistoryPair *VbEngineMeasHistoryPairGet(const t_node *node, t_measHistoryKind kind, const INT8U *mac);
+
+/**
+ * @brief Rebuilds the values of a recorded plan
+ * @param[in] pair Pair
+ * @param[in] age 0 for newest plan, 1 for previous one...
+ * @param[out] values numValues of the pair (Rx1 values followed by Rx2 values if present)
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineMeasHistoryValuesGet(const t_measHistoryPair *pair, INT32U age, INT8U *values);
+
+/**
+ * @brief Gets the trend of a pair: least squares slope of mean value across recorded plans
+ * @param[in] pair Pair
+ * @param[out] trend dB per plan
+ * @return TRUE if at least two plans are recorded
+ **/
+BOOLEAN VbEngineMeasHistoryTrendGet(const t_measHistoryPair *pair, float *trend);
+
+/**
+ * @brief Gets the plan to plan variance of a pair: mean squared difference per value between consecutive plans
+ * @param[in] pair Pair
+ * @param[out] variance dB^2
+ * @return TRUE if at least two plans are recorded
+ **/
+BOOLEAN VbEngineMeasHistoryVarianceGet(const t_measHistoryPair *pair, float *variance);
+
+/**
+ * @brief Gets the SNR drift of a node: mean SNR of newest plan minus mean SNR of oldest recorded plan
+ * @param[in] node Node
+ * @param[out] drift dB
+ * @return TRUE if at least two plans are recorded
+ **/
+BOOLEAN VbEngineMeasHistorySnrDriftGet(const t_node *node, float *drift);
+
+/**
+ * @brief Console command to show measure history per cluster, or per pair of a node (mhist <MAC>)
+ **/
+BOOL VbEngineMeasHistoryConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_MEAS_HISTORY_H_ */
+
+/**
+ * @}
+ **/
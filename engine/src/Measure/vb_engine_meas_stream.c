@@ -0,0 +1,993 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_meas_stream.c
+ * @brief Live measurement stream to local subscribers (engine side)
+ *
+ * @internal
+ *
+ * Producers (EA process thread, SNR computation threads) copy records into
+ * the ring buffer of every interested subscriber and wake up the stream
+ * thread, which is the only one doing socket I/O. Each ring is bounded; when
+ * full, oldest records are dropped.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_thread.h"
+#include "vb_priorities.h"
+#include "vb_mac_utils.h"
+#include "vb_engine_meas_stream.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define MEAS_STREAM_THREAD_NAME                      ("MeasStream")
+#define MEAS_STREAM_POLL_TIMEOUT                     (1000)        // ms
+#define MEAS_STREAM_TX_BUFFER_SIZE                   (64 * 1024)   // Bytes
+#define MEAS_STREAM_MAX_SUBSCRIBERS                  (32)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  BOOLEAN                  inUse;
+  BOOLEAN                  subscribed;       ///< Valid subscription request received
+  BOOLEAN                  broken;
+  INT32S                   fd;
+  INT32U                   id;
+  t_vbMeasStreamSubscribe  filter;
+
+  // Ring buffer (protected by vbMeasStreamMutex)
+  INT8U                   *ring;
+  INT32U                   ringSize;
+  INT32U                   ringHead;         ///< Write position
+  INT32U                   ringTail;         ///< Read position (start of oldest record)
+  INT32U                   ringUsed;
+  INT32U                   seq;
+  INT64U                   numRecords;
+  INT64U                   numDropped;
+
+  // Stream thread only
+  INT8U                   *txBuffer;
+  INT32U                   txSize;
+  INT32U                   txLen;
+  INT32U                   txOffset;
+  INT64U                   numSentBytes;
+  t_vbMeasStreamSubscribe  request;
+  INT32U                   requestLen;
+} t_measStreamSubscriber;
+
+typedef struct
+{
+  t_vbEngineMeasStreamConf  conf;
+  BOOLEAN                   initialized;
+  BOOLEAN                   running;
+  pthread_t                 thread;
+  INT32S                    listenFd;
+  INT32S                    wakePipe[2];
+  INT32U                    nextId;
+  volatile INT32U           numSubscribed;   ///< Quick check for producers
+  t_measStreamSubscriber   *subscribers;
+} t_measStream;
+
+/// Copy of a subscriber state, printed once the mutex is released
+typedef struct
+{
+  INT32U                   id;
+  BOOLEAN                  subscribed;
+  t_vbMeasStreamSubscribe  filter;
+  INT64U                   numRecords;
+  INT64U                   numDropped;
+  INT32U                   ringUsed;
+} t_measStreamSubscriberSnapshot;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static t_measStream     vbMeasStream = { .listenFd = -1, .wakePipe = { -1, -1 } };
+static pthread_mutex_t  vbMeasStreamMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static const CHAR *vbMeasStreamTypeStr[VB_MEAS_STREAM_TYPE_LAST] =
+{
+  "CFR",
+  "BGN",
+  "SNR_PROBE",
+  "SNR_FULL",
+  "SNR_LOW",
+  "CAPACITY",
+};
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+static void MeasStreamRingWrite(t_measStreamSubscriber *sub, const void *data, INT32U len)
+{
+  INT32U chunk;
+
+  chunk = MIN(len, sub->ringSize - sub->ringHead);
+  memcpy(sub->ring + sub->ringHead, data, chunk);
+  memcpy(sub->ring, (const INT8U *)data + chunk, len - chunk);
+
+  sub->ringHead = (sub->ringHead + len) % sub->ringSize;
+  sub->ringUsed += len;
+}
+
+/*******************************************************************/
+
+static void MeasStreamRingRead(t_measStreamSubscriber *sub, void *data, INT32U len)
+{
+  INT32U chunk;
+
+  chunk = MIN(len, sub->ringSize - sub->ringTail);
+  memcpy(data, sub->ring + sub->ringTail, chunk);
+  memcpy((INT8U *)data + chunk, sub->ring, len - chunk);
+
+  sub->ringTail = (sub->ringTail + len) % sub->ringSize;
+  sub->ringUsed -= len;
+}
+
+/*******************************************************************/
+
+static INT32U MeasStreamRingNextRecordLen(t_measStreamSubscriber *sub)
+{
+  t_vbMeasStreamRecordHdr hdr;
+  INT32U                  tail = sub->ringTail;
+  INT32U                  used = sub->ringUsed;
+
+  // Peek header of oldest record
+  MeasStreamRingRead(sub, &hdr, sizeof(hdr));
+  sub->ringTail = tail;
+  sub->ringUsed = used;
+
+  return sizeof(hdr) + hdr.payloadLen;
+}
+
+/*******************************************************************/
+
+static void MeasStreamRingDrop(t_measStreamSubscriber *sub, INT32U len)
+{
+  sub->ringTail = (sub->ringTail + len) % sub->ringSize;
+  sub->ringUsed -= len;
+}
+
+/*******************************************************************/
+
+static BOOLEAN MeasStreamFilterMatch(const t_measStreamSubscriber *sub, t_vbMeasStreamType type,
+                                     INT32S clusterId, const INT8U *mac, const INT8U *refMac)
+{
+  BOOLEAN match = TRUE;
+
+  if ((sub->filter.typesMask != 0) && ((sub->filter.typesMask & (1 << type)) == 0))
+  {
+    match = FALSE;
+  }
+  else if ((sub->filter.clusterId != VB_MEAS_STREAM_ANY_CLUSTER) && (sub->filter.clusterId != clusterId))
+  {
+    match = FALSE;
+  }
+  else if ((sub->filter.macFilter != 0) &&
+           (memcmp(sub->filter.mac, mac, ETH_ALEN) != 0) &&
+           ((refMac == NULL) || (memcmp(sub->filter.mac, refMac, ETH_ALEN) != 0)))
+  {
+    match = FALSE;
+  }
+
+  return match;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Copies a record (header + up to two payload blocks) to the ring of
+ * every interested subscriber and wakes up stream thread
+ **/
+static void MeasStreamPublish(t_vbMeasStreamRecordHdr *hdr, const INT8U *mac, const INT8U *refMac,
+                              const void *data1, INT32U len1, const void *data2, INT32U len2)
+{
+  t_measStreamSubscriber *sub;
+  INT32U                  rec_len;
+  INT32U                  i;
+  BOOLEAN                 queued = FALSE;
+  struct timespec         ts;
+  INT8U                   wake = 0;
+
+  clock_gettime(CLOCK_REALTIME, &ts);
+
+  hdr->magic = VB_MEAS_STREAM_MAGIC;
+  hdr->version = VB_MEAS_STREAM_VERSION;
+  hdr->payloadLen = len1 + len2;
+  hdr->timestampNs = ((INT64U)ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+  rec_len = sizeof(*hdr) + hdr->payloadLen;
+
+  pthread_mutex_lock(&vbMeasStreamMutex);
+
+  for (i = 0; (vbMeasStream.running == TRUE) && (i < vbMeasStream.conf.maxSubscribers); i++)
+  {
+    sub = &vbMeasStream.subscribers[i];
+
+    if ((sub->inUse == FALSE) || (sub->subscribed == FALSE) ||
+        (MeasStreamFilterMatch(sub, hdr->type, hdr->clusterId, mac, refMac) == FALSE))
+    {
+      continue;
+    }
+
+    if (rec_len > MIN(sub->ringSize, sub->txSize))
+    {
+      // Would never fit in tx buffer, the stream would stall on it
+      sub->numDropped++;
+      continue;
+    }
+
+    // Drop oldest records until there is room for the new one
+    while ((sub->ringSize - sub->ringUsed) < rec_len)
+    {
+      MeasStreamRingDrop(sub, MeasStreamRingNextRecordLen(sub));
+      sub->numDropped++;
+    }
+
+    hdr->seq = sub->seq++;
+    MeasStreamRingWrite(sub, hdr, sizeof(*hdr));
+    if (len1 > 0)
+    {
+      MeasStreamRingWrite(sub, data1, len1);
+    }
+    if (len2 > 0)
+    {
+      MeasStreamRingWrite(sub, data2, len2);
+    }
+    sub->numRecords++;
+    queued = TRUE;
+  }
+
+  pthread_mutex_unlock(&vbMeasStreamMutex);
+
+  if (queued == TRUE)
+  {
+    // Pipe is non-blocking: if full, thread is already going to wake up
+    if (write(vbMeasStream.wakePipe[1], &wake, sizeof(wake)) < 0)
+    {
+      // Nothing to do
+    }
+  }
+}
+
+/*******************************************************************/
+
+static void MeasStreamSubscriberClose(t_measStreamSubscriber *sub)
+{
+  INT32S fd;
+
+  pthread_mutex_lock(&vbMeasStreamMutex);
+
+  if (sub->subscribed == TRUE)
+  {
+    vbMeasStream.numSubscribed--;
+  }
+
+  VbLogPrint(VB_LOG_INFO, "Measure stream subscriber %u closed (%llu records, %llu dropped, %llu bytes sent)",
+      sub->id, sub->numRecords, sub->numDropped, sub->numSentBytes);
+
+  fd = sub->fd;
+  free(sub->ring);
+  free(sub->txBuffer);
+  bzero(sub, sizeof(*sub));
+  sub->fd = -1;
+
+  pthread_mutex_unlock(&vbMeasStreamMutex);
+
+  close(fd);
+}
+
+/*******************************************************************/
+
+static void MeasStreamAccept(void)
+{
+  t_measStreamSubscriber *sub;
+  INT32S                  fd;
+  INT32U                  i;
+
+  for (;;)
+  {
+    fd = accept(vbMeasStream.listenFd, NULL, NULL);
+
+    if (fd < 0)
+    {
+      if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+      {
+        VbLogPrint(VB_LOG_ERROR, "Measure stream accept error [%s]", strerror(errno));
+      }
+      break;
+    }
+
+    sub = NULL;
+
+    pthread_mutex_lock(&vbMeasStreamMutex);
+
+    for (i = 0; i < vbMeasStream.conf.maxSubscribers; i++)
+    {
+      if (vbMeasStream.subscribers[i].inUse == FALSE)
+      {
+        sub = &vbMeasStream.subscribers[i];
+        break;
+      }
+    }
+
+    if (sub != NULL)
+    {
+      bzero(sub, sizeof(*sub));
+      sub->fd = fd;
+      sub->ringSize = vbMeasStream.conf.bufferBytes;
+      sub->ring = (INT8U *)malloc(sub->ringSize);
+      sub->txSize = MEAS_STREAM_TX_BUFFER_SIZE;
+      sub->txBuffer = (INT8U *)malloc(sub->txSize);
+
+      if ((sub->ring == NULL) || (sub->txBuffer == NULL) ||
+          (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK) < 0))
+      {
+        free(sub->ring);
+        free(sub->txBuffer);
+        bzero(sub, sizeof(*sub));
+        sub->fd = -1;
+        sub = NULL;
+      }
+      else
+      {
+        sub->inUse = TRUE;
+        sub->id = vbMeasStream.nextId++;
+      }
+    }
+
+    pthread_mutex_unlock(&vbMeasStreamMutex);
+
+    if (sub == NULL)
+    {
+      VbLogPrint(VB_LOG_WARNING, "Measure stream subscriber rejected (max %u)", vbMeasStream.conf.maxSubscribers);
+      close(fd);
+    }
+    else
+    {
+      VbLogPrint(VB_LOG_INFO, "New measure stream subscriber %u", sub->id);
+    }
+  }
+}
+
+/*******************************************************************/
+
+static void MeasStreamRequestRead(t_measStreamSubscriber *sub)
+{
+  ssize_t received;
+  BOOLEAN valid;
+
+  received = recv(sub->fd, (INT8U *)&sub->request + sub->requestLen, sizeof(sub->request) - sub->requestLen, 0);
+
+  if (received == 0)
+  {
+    sub->broken = TRUE;
+  }
+  else if (received < 0)
+  {
+    if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+    {
+      sub->broken = TRUE;
+    }
+  }
+  else
+  {
+    sub->requestLen += received;
+
+    if (sub->requestLen == sizeof(sub->request))
+    {
+      sub->requestLen = 0;
+      valid = ((sub->request.magic == VB_MEAS_STREAM_MAGIC) && (sub->request.version == VB_MEAS_STREAM_VERSION));
+
+      if (valid == FALSE)
+      {
+        VbLogPrint(VB_LOG_ERROR, "Measure stream subscriber %u: bad subscription request", sub->id);
+        sub->broken = TRUE;
+      }
+      else
+      {
+        pthread_mutex_lock(&vbMeasStreamMutex);
+
+        if (sub->subscribed == FALSE)
+        {
+          vbMeasStream.numSubscribed++;
+        }
+        sub->filter = sub->request;
+        sub->subscribed = TRUE;
+
+        pthread_mutex_unlock(&vbMeasStreamMutex);
+      }
+    }
+  }
+}
+
+/*******************************************************************/
+
+static void MeasStreamSend(t_measStreamSubscriber *sub)
+{
+  ssize_t sent;
+  INT32U  rec_len;
+  BOOLEAN more = TRUE;
+
+  while ((sub->broken == FALSE) && (more == TRUE))
+  {
+    if (sub->txOffset == sub->txLen)
+    {
+      // Move as many whole records as possible from ring to tx buffer
+      sub->txOffset = 0;
+      sub->txLen = 0;
+
+      pthread_mutex_lock(&vbMeasStreamMutex);
+
+      while (sub->ringUsed > 0)
+      {
+        rec_len = MeasStreamRingNextRecordLen(sub);
+
+        if ((sub->txLen + rec_len) > sub->txSize)
+        {
+          break;
+        }
+
+        MeasStreamRingRead(sub, sub->txBuffer + sub->txLen, rec_len);
+        sub->txLen += rec_len;
+      }
+
+      pthread_mutex_unlock(&vbMeasStreamMutex);
+    }
+
+    if (sub->txOffset == sub->txLen)
+    {
+      more = FALSE;
+    }
+    else
+    {
+      sent = send(sub->fd, sub->txBuffer + sub->txOffset, sub->txLen - sub->txOffset, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+      if (sent > 0)
+      {
+        sub->txOffset += sent;
+        sub->numSentBytes += sent;
+      }
+      else if ((sent < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+      {
+        more = FALSE;
+      }
+      else if ((sent < 0) && (errno == EINTR))
+      {
+        // Retry
+      }
+      else
+      {
+        sub->broken = TRUE;
+      }
+    }
+  }
+}
+
+/*******************************************************************/
+
+static void *MeasStreamThread(void *arg)
+{
+  struct pollfd           fds[MEAS_STREAM_MAX_SUBSCRIBERS + 2];
+  t_measStreamSubscriber *subs[MEAS_STREAM_MAX_SUBSCRIBERS + 2];
+  t_measStreamSubscriber *sub;
+  INT32U                  num_fds;
+  INT32U                  i;
+  INT32S                  res;
+  BOOLEAN                 pending;
+  INT8U                   drain[64];
+
+  while (vbMeasStream.running == TRUE)
+  {
+    num_fds = 0;
+
+    fds[num_fds].fd = vbMeasStream.listenFd;
+    fds[num_fds].events = POLLIN;
+    subs[num_fds++] = NULL;
+
+    fds[num_fds].fd = vbMeasStream.wakePipe[0];
+    fds[num_fds].events = POLLIN;
+    subs[num_fds++] = NULL;
+
+    for (i = 0; i < vbMeasStream.conf.maxSubscribers; i++)
+    {
+      sub = &vbMeasStream.subscribers[i];
+
+      if (sub->inUse == TRUE)
+      {
+        pthread_mutex_lock(&vbMeasStreamMutex);
+        pending = (sub->ringUsed > 0) || (sub->txOffset < sub->txLen);
+        pthread_mutex_unlock(&vbMeasStreamMutex);
+
+        fds[num_fds].fd = sub->fd;
+        fds[num_fds].events = POLLIN | (pending?POLLOUT:0);
+        subs[num_fds++] = sub;
+      }
+    }
+
+    for (i = 0; i < num_fds; i++)
+    {
+      fds[i].revents = 0;
+    }
+
+    res = poll(fds, num_fds, MEAS_STREAM_POLL_TIMEOUT);
+
+    if (res < 0)
+    {
+      if (errno != EINTR)
+      {
+        VbLogPrint(VB_LOG_ERROR, "Measure stream poll error [%s]", strerror(errno));
+      }
+      continue;
+    }
+
+    if (fds[1].revents & POLLIN)
+    {
+      while (read(vbMeasStream.wakePipe[0], drain, sizeof(drain)) > 0);
+    }
+
+    for (i = 2; i < num_fds; i++)
+    {
+      sub = subs[i];
+
+      if (fds[i].revents & (POLLIN | POLLHUP | POLLERR | POLLNVAL))
+      {
+        MeasStreamRequestRead(sub);
+      }
+
+      // Try to send on every wake up, new records may have been queued
+      MeasStreamSend(sub);
+
+      if (sub->broken == TRUE)
+      {
+        MeasStreamSubscriberClose(sub);
+      }
+    }
+
+    if (fds[0].revents & POLLIN)
+    {
+      MeasStreamAccept();
+    }
+  }
+
+  return NULL;
+}
+
+/*******************************************************************/
+
+static void MeasStreamResourcesRelease(void)
+{
+  if (vbMeasStream.listenFd != -1)
+  {
+    close(vbMeasStream.listenFd);
+    vbMeasStream.listenFd = -1;
+    unlink(vbMeasStream.conf.socketPath);
+  }
+
+  if (vbMeasStream.wakePipe[0] != -1)
+  {
+    close(vbMeasStream.wakePipe[0]);
+    close(vbMeasStream.wakePipe[1]);
+    vbMeasStream.wakePipe[0] = -1;
+    vbMeasStream.wakePipe[1] = -1;
+  }
+
+  free(vbMeasStream.subscribers);
+  vbMeasStream.subscribers = NULL;
+  vbMeasStream.initialized = FALSE;
+}
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+t_VB_engineErrorCode VbEngineMeasStreamInit(const t_vbEngineMeasStreamConf *conf)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  struct sockaddr_un   addr;
+  INT32U               i;
+
+  if (conf == NULL)
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if ((conf->enable == FALSE) || (vbMeasStream.initialized == TRUE))
+  {
+    // Nothing to do
+  }
+  else
+  {
+    vbMeasStream.conf = *conf;
+    vbMeasStream.conf.maxSubscribers = MIN(MAX(conf->maxSubscribers, 1), MEAS_STREAM_MAX_SUBSCRIBERS);
+    vbMeasStream.conf.bufferBytes = MAX(conf->bufferBytes, MEAS_STREAM_TX_BUFFER_SIZE);
+    vbMeasStream.numSubscribed = 0;
+
+    vbMeasStream.subscribers = (t_measStreamSubscriber *)calloc(vbMeasStream.conf.maxSubscribers, sizeof(t_measStreamSubscriber));
+
+    if (vbMeasStream.subscribers == NULL)
+    {
+      ret = VB_ENGINE_ERROR_NO_MEMORY;
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      for (i = 0; i < vbMeasStream.conf.maxSubscribers; i++)
+      {
+        vbMeasStream.subscribers[i].fd = -1;
+      }
+
+      if ((pipe(vbMeasStream.wakePipe) < 0) ||
+          (fcntl(vbMeasStream.wakePipe[0], F_SETFL, O_NONBLOCK) < 0) ||
+          (fcntl(vbMeasStream.wakePipe[1], F_SETFL, O_NONBLOCK) < 0))
+      {
+        VbLogPrint(VB_LOG_ERROR, "Measure stream pipe error [%s]", strerror(errno));
+        ret = VB_ENGINE_ERROR_UNKNOWN;
+      }
+    }
+
+    if ((ret == VB_ENGINE_ERROR_NONE) && (strlen(vbMeasStream.conf.socketPath) >= sizeof(addr.sun_path)))
+    {
+      VbLogPrint(VB_LOG_ERROR, "Measure stream socket path too long (max %u characters)", (INT32U)sizeof(addr.sun_path) - 1);
+      ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      bzero(&addr, sizeof(addr));
+      addr.sun_family = AF_UNIX;
+      memcpy(addr.sun_path, vbMeasStream.conf.socketPath, strlen(vbMeasStream.conf.socketPath));
+
+      // Remove socket left by a previous (crashed) execution
+      unlink(addr.sun_path);
+
+      vbMeasStream.listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+      if ((vbMeasStream.listenFd < 0) ||
+          (bind(vbMeasStream.listenFd, (struct sockaddr *)&addr, sizeof(addr)) < 0) ||
+          (listen(vbMeasStream.listenFd, vbMeasStream.conf.maxSubscribers) < 0) ||
+          (fcntl(vbMeasStream.listenFd, F_SETFL, O_NONBLOCK) < 0))
+      {
+        VbLogPrint(VB_LOG_ERROR, "Measure stream socket %s error [%s]", addr.sun_path, strerror(errno));
+        ret = VB_ENGINE_ERROR_UNKNOWN;
+      }
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      vbMeasStream.initialized = TRUE;
+    }
+    else
+    {
+      MeasStreamResourcesRelease();
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbEngineMeasStreamRun(void)
+{
+  BOOLEAN ret = TRUE;
+
+  if ((vbMeasStream.initialized == TRUE) && (vbMeasStream.running == FALSE))
+  {
+    VbLogPrint(VB_LOG_INFO, "Starting %s thread", MEAS_STREAM_THREAD_NAME);
+
+    pthread_mutex_lock(&vbMeasStreamMutex);
+    vbMeasStream.running = TRUE;
+    pthread_mutex_unlock(&vbMeasStreamMutex);
+
+    ret = VbThreadCreate(MEAS_STREAM_THREAD_NAME, MeasStreamThread, NULL, VB_MEAS_STREAM_THREAD_CLASS, &vbMeasStream.thread);
+
+    if (ret == FALSE)
+    {
+      VbLogPrint(VB_LOG_ERROR, "Can't create %s thread", MEAS_STREAM_THREAD_NAME);
+
+      pthread_mutex_lock(&vbMeasStreamMutex);
+      vbMeasStream.running = FALSE;
+      pthread_mutex_unlock(&vbMeasStreamMutex);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEngineMeasStreamStop(void)
+{
+  BOOLEAN was_running;
+  INT8U   wake = 0;
+  INT32U  i;
+
+  pthread_mutex_lock(&vbMeasStreamMutex);
+  was_running = vbMeasStream.running;
+  vbMeasStream.running = FALSE;
+  pthread_mutex_unlock(&vbMeasStreamMutex);
+
+  if (was_running == TRUE)
+  {
+    if (write(vbMeasStream.wakePipe[1], &wake, sizeof(wake)) < 0)
+    {
+      // Thread will wake up on poll timeout
+    }
+
+    VbThreadJoin(vbMeasStream.thread, MEAS_STREAM_THREAD_NAME);
+  }
+
+  if (vbMeasStream.initialized == TRUE)
+  {
+    for (i = 0; i < vbMeasStream.conf.maxSubscribers; i++)
+    {
+      if (vbMeasStream.subscribers[i].inUse == TRUE)
+      {
+        MeasStreamSubscriberClose(&vbMeasStream.subscribers[i]);
+      }
+    }
+
+    pthread_mutex_lock(&vbMeasStreamMutex);
+    MeasStreamResourcesRelease();
+    pthread_mutex_unlock(&vbMeasStreamMutex);
+  }
+}
+
+/*******************************************************************/
+
+BOOLEAN VbEngineMeasStreamSubscribedGet(void)
+{
+  return (vbMeasStream.numSubscribed > 0)?TRUE:FALSE;
+}
+
+/*******************************************************************/
+
+void VbEngineMeasStreamMeasurePublish(t_vbMeasStreamType type, INT32S clusterId, const INT8U *mac,
+                                      const INT8U *refMac, const t_processMeasure *measure)
+{
+  t_vbMeasStreamRecordHdr hdr;
+  INT32U                  len1 = 0;
+  INT32U                  len2 = 0;
+
+  if ((vbMeasStream.numSubscribed > 0) && (mac != NULL) && (measure != NULL) &&
+      (type < VB_MEAS_STREAM_TYPE_LAST))
+  {
+    bzero(&hdr, sizeof(hdr));
+    hdr.type = type;
+    hdr.errorCode = measure->errorCode;
+    hdr.clusterId = clusterId;
+    MACAddrClone(hdr.mac, mac);
+    if (refMac != NULL)
+    {
+      MACAddrClone(hdr.refMac, refMac);
+    }
+    hdr.firstCarrier = measure->firstCarrier;
+    hdr.numValues = measure->numMeasures;
+    hdr.planId = measure->planID;
+    hdr.spacing = measure->spacing;
+    hdr.mimoInd = measure->mimoInd;
+    hdr.mimoMeas = measure->mimoMeas;
+
+    if (measure->measuresRx1 != NULL)
+    {
+      len1 = measure->numMeasures;
+      hdr.numRx++;
+    }
+
+    if (measure->measuresRx2 != NULL)
+    {
+      len2 = measure->numMeasures;
+      hdr.numRx++;
+    }
+
+    MeasStreamPublish(&hdr, mac, refMac, measure->measuresRx1, len1, measure->measuresRx2, len2);
+  }
+}
+
+/*******************************************************************/
+
+void VbEngineMeasStreamCapacityPublish(INT32S clusterId, const t_node *node)
+{
+  t_vbMeasStreamRecordHdr hdr;
+  t_vbMeasStreamCapacity  capacity;
+
+  if ((vbMeasStream.numSubscribed > 0) && (node != NULL))
+  {
+    bzero(&hdr, sizeof(hdr));
+    hdr.type = VB_MEAS_STREAM_TYPE_CAPACITY;
+    hdr.clusterId = clusterId;
+    MACAddrClone(hdr.mac, node->MAC);
+    hdr.firstCarrier = node->channelSettings.firstValidCarrier;
+
+    capacity.maxCapacity = node->channelSettings.boostInfo.maxCapacity;
+    capacity.lowBandCapacity = node->channelSettings.boostInfo.lowBandCapacity;
+    capacity.firstValidCarrier = node->channelSettings.firstValidCarrier;
+    capacity.maxNumBands = node->channelSettings.boostInfo.maxNumBands;
+    capacity.valid = node->channelSettings.boostInfo.valid;
+
+    MeasStreamPublish(&hdr, node->MAC, NULL, &capacity, sizeof(capacity), NULL, 0);
+  }
+}
+
+/*******************************************************************/
+
+BOOL VbEngineMeasStreamConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  BOOL                            ret = FALSE;
+  BOOL                            show_help = FALSE;
+  t_measStreamSubscriberSnapshot  subs[MEAS_STREAM_MAX_SUBSCRIBERS];
+  t_measStreamSubscriberSnapshot *sub;
+  t_vbEngineMeasStreamConf        conf;
+  BOOLEAN                         running;
+  INT32U                          num_subscribed;
+  INT32U                          num_subs = 0;
+  CHAR                            types[64];
+  CHAR                            mac_str[MAC_STR_LEN];
+  INT32U                          i;
+  INT32U                          t;
+
+  if (cmd[1] == NULL)
+  {
+    // Print from a copy, console output shall not hold measure producers
+    pthread_mutex_lock(&vbMeasStreamMutex);
+
+    running = vbMeasStream.running;
+    conf = vbMeasStream.conf;
+    num_subscribed = vbMeasStream.numSubscribed;
+
+    for (i = 0; (vbMeasStream.subscribers != NULL) && (i < vbMeasStream.conf.maxSubscribers); i++)
+    {
+      if (vbMeasStream.subscribers[i].inUse == TRUE)
+      {
+        subs[num_subs].id = vbMeasStream.subscribers[i].id;
+        subs[num_subs].subscribed = vbMeasStream.subscribers[i].subscribed;
+        subs[num_subs].filter = vbMeasStream.subscribers[i].filter;
+        subs[num_subs].numRecords = vbMeasStream.subscribers[i].numRecords;
+        subs[num_subs].numDropped = vbMeasStream.subscribers[i].numDropped;
+        subs[num_subs].ringUsed = vbMeasStream.subscribers[i].ringUsed;
+        num_subs++;
+      }
+    }
+
+    pthread_mutex_unlock(&vbMeasStreamMutex);
+
+    writeFun("Measure stream     : %s\n", (running == TRUE)?"RUNNING":"STOPPED");
+    writeFun("Socket             : %s\n", conf.socketPath);
+    writeFun("Buffer size        : %u bytes per subscriber\n", conf.bufferBytes);
+    writeFun("Subscribers        : %u (max %u)\n", num_subscribed, conf.maxSubscribers);
+
+    writeFun("=========================================================================================================\n");
+    writeFun("|  Id  |  Cluster |        MAC        |        Types         |   Records  |   Dropped  |   Buffered  |\n");
+    writeFun("=========================================================================================================\n");
+
+    for (i = 0; i < num_subs; i++)
+    {
+      sub = &subs[i];
+
+      types[0] = '\0';
+      for (t = 0; t < VB_MEAS_STREAM_TYPE_LAST; t++)
+      {
+        if ((sub->filter.typesMask == 0) || (sub->filter.typesMask & (1 << t)))
+        {
+          snprintf(types + strlen(types), sizeof(types) - strlen(types), "%s%s", (types[0] != '\0')?",":"", vbMeasStreamTypeStr[t]);
+        }
+      }
+
+      if (sub->filter.macFilter != 0)
+      {
+        MACAddrMem2str(mac_str, sub->filter.mac);
+      }
+      else
+      {
+        strcpy(mac_str, "ANY");
+      }
+
+      writeFun("| %4u | %8d | %17s | %20.20s | %10llu | %10llu | %11u |\n",
+          sub->id,
+          sub->filter.clusterId,
+          mac_str,
+          (sub->subscribed == TRUE)?((sub->filter.typesMask == 0)?"ALL":types):"-",
+          sub->numRecords,
+          sub->numDropped,
+          sub->ringUsed);
+    }
+
+    writeFun("=========================================================================================================\n");
+
+    ret = TRUE;
+  }
+  else if (!strcmp(cmd[1], "h"))
+  {
+    show_help = TRUE;
+    ret = TRUE;
+  }
+
+  if ((ret == FALSE) || (show_help == TRUE))
+  {
+    writeFun("Usage:\n");
+    writeFun("mstream   : Shows measure stream subscribers\n");
+    writeFun("mstream h : Shows this help\n");
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/
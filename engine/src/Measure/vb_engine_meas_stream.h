@@ -0,0 +1,143 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_meas_stream.h
+ * @brief Live measurement stream to local subscribers (engine side)
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_MEAS_STREAM_H_
+#define VB_ENGINE_MEAS_STREAM_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_meas_stream.h"
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_MEAS_STREAM_DEFAULT_MAX_SUBSCRIBERS  (4)
+#define VB_ENGINE_MEAS_STREAM_DEFAULT_BUFFER           (1024 * 1024)  // Bytes per subscriber
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  BOOLEAN  enable;
+  CHAR     socketPath[VB_MEAS_STREAM_SOCKET_PATH_MAX];
+  INT32U   maxSubscribers;
+  INT32U   bufferBytes;                  ///< Ring buffer size per subscriber
+} t_vbEngineMeasStreamConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Initializes measurement stream component
+ * @param[in] conf Configuration
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineMeasStreamInit(const t_vbEngineMeasStreamConf *conf);
+
+/**
+ * @brief Starts measurement stream thread (if enabled)
+ * @return TRUE: running or disabled; FALSE: error
+ **/
+BOOLEAN VbEngineMeasStreamRun(void);
+
+/**
+ * @brief Stops measurement stream thread and closes all subscribers
+ **/
+void VbEngineMeasStreamStop(void);
+
+/**
+ * @brief Checks whether any subscriber is connected, so producers can skip
+ * preparing a copy of data to publish
+ * @return TRUE if there is at least one subscriber
+ **/
+BOOLEAN VbEngineMeasStreamSubscribedGet(void);
+
+/**
+ * @brief Publishes a measure to all interested subscribers.
+ * Data is copied to subscribers buffers and sent later by stream thread, so
+ * it never blocks caller. When there are no subscribers it returns immediately.
+ * @param[in] type Measure type
+ * @param[in] clusterId Cluster Id of node
+ * @param[in] mac Measurer node MAC
+ * @param[in] refMac Measured node MAC (CFR) or NULL
+ * @param[in] measure Measure to publish
+ **/
+void VbEngineMeasStreamMeasurePublish(t_vbMeasStreamType type, INT32S clusterId, const INT8U *mac,
+                                      const INT8U *refMac, const t_processMeasure *measure);
+
+/**
+ * @brief Publishes capacity computed for a node to all interested subscribers
+ * @param[in] clusterId Cluster Id of node
+ * @param[in] node Node
+ **/
+void VbEngineMeasStreamCapacityPublish(INT32S clusterId, const t_node *node);
+
+/**
+ * @brief Console command to show measurement stream subscribers
+ **/
+BOOL VbEngineMeasStreamConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_MEAS_STREAM_H_ */
+
+/**
+ * @}
+ **/
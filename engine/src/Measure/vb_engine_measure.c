@@ -57,6 +57,7 @@
 
 #include "vb_engine_datamodel.h"
 #include "vb_log.h"
+#include "vb_file_writer.h"
 #include "vb_engine_EA_interface.h"
 #include "vb_engine_communication.h"
 #include "vb_engine_process.h"
@@ -69,6 +70,10 @@
 #include "vb_counters.h"
 #include "vb_LCMP_paramId.h"
 #include "vb_engine_clock.h"
+#include "vb_engine_meas_stream.h"
+#include "vb_engine_cfr_resolution.h"
+#include "vb_engine_snr_tracking.h"
+#include "vb_engine_snr_linear_cache.h"
 
 /*
  ************************************************************************
@@ -90,6 +95,14 @@
 #define VB_MEASURE_BUFFER_TO_FILE_SIZE                     (5 * 1024 * 1024)
 #define VB_MEASURE_CLUSTER_ID_FMT                          ("Cluster_id_%06u_")
 #define VB_MEASURE_CLUSTER_ID_LEN                          (19)
+#define VB_MEASURE_CFR_VECTOR_LEN                          (16)
+
+// __builtin_shuffle is available since GCC 4.7
+#if defined(__GNUC__) && !defined(__clang__) && (((__GNUC__ * 100) + __GNUC_MINOR__) >= 407)
+#  define VB_MEASURE_CFR_VECTOR_ENABLED                    (1)
+#else
+#  define VB_MEASURE_CFR_VECTOR_ENABLED                    (0)
+#endif
 
 /*
  ************************************************************************
@@ -103,6 +116,10 @@ typedef struct s_measurePlanInfo
   INT16U seqNum;
 } t_measurePlanInfo;
 
+#if VB_MEASURE_CFR_VECTOR_ENABLED
+typedef INT8U t_cfrVector __attribute__ ((vector_size (VB_MEASURE_CFR_VECTOR_LEN)));
+#endif
+
 /*
  ************************************************************************
  ** Private variables
@@ -122,13 +139,8 @@ static INT32U vbMeasurePlanId;
 * param[in] this_driver Pointer to vbDriver data struct
 **/
 static t_VB_engineErrorCode VbEngineMeasurementPlanCreate( INT8U planid, INT16U seqNumStart, t_measconfdata *measconfdata,
-                                                           INT8U *payload, t_vbEngineNumNodes numNodes, INT16U *endSeqNum, INT32U clusterId );
-
-/**
-* @brief This function executes the VBCE measure part
-* param[in] this_driver Pointer to vbDriver data struct
-**/
-static t_VB_engineErrorCode VbEngineMeasureCfrSet(INT8U* macMeasurer, INT8U *macMeasured, t_VBDriver *thisDriver, t_processMeasure *measurePtr);
+                                                           INT8U cfrDecimationLog2, INT8U *payload, t_vbEngineNumNodes numNodes,
+                                                           INT16U *endSeqNum, INT32U clusterId );
 
 /**
 * @brief This function executes the VBCE measure part
@@ -312,11 +324,60 @@ static t_VB_engineErrorCode VbEngineMeasCollectRequestPerDriverCb(t_VBDriver *dr
 
 /*******************************************************************/
 
+static BOOLEAN VbEngineCfrMeasureListIsReusable(const t_crossMeasureList *cfrMeasureList, const INT8U *macMeasured, INT32U numMeasured)
+{
+  BOOLEAN reusable = FALSE;
+  INT32U  i;
+
+  if ((cfrMeasureList->crossMeasureArray != NULL) &&
+      (cfrMeasureList->numCrossMeasures == numMeasured))
+  {
+    reusable = TRUE;
+
+    for (i = 0; (i < numMeasured) && (reusable == TRUE); i++)
+    {
+      if (memcmp(cfrMeasureList->crossMeasureArray[i].MAC, macMeasured, ETH_ALEN) != 0)
+      {
+        reusable = FALSE;
+      }
+
+      macMeasured += ETH_ALEN;
+    }
+  }
+
+  return reusable;
+}
+
+/*******************************************************************/
+
+static void VbEngineCfrMeasureSpareKeep(t_crossMeasure *cfrMeasure)
+{
+  // Keep buffers of previous plan to receive next CFR without allocating memory
+  if (cfrMeasure->measure.measuresRx1 != NULL)
+  {
+    VbEngineDatamodelCrossMeasureSpareRelease(cfrMeasure);
+
+    cfrMeasure->spareRx1 = cfrMeasure->measure.measuresRx1;
+    cfrMeasure->spareRx2 = cfrMeasure->measure.measuresRx2;
+    cfrMeasure->spareSize = cfrMeasure->measure.numMeasures;
+  }
+  else
+  {
+    VbDatamodelNodeProcessMeasureDestroy(&(cfrMeasure->measure));
+  }
+
+  memset(&(cfrMeasure->measure), 0, sizeof(cfrMeasure->measure));
+}
+
+/*******************************************************************/
+
 static t_VB_engineErrorCode VbEngineCfrMeasureListCreateCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
 {
   t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
   t_nodesMacList      *all_nodes_macs_list = (t_nodesMacList *)args;
-  INT32U               num_measured;
+  INT8U               *mac_measured_ptr = NULL;
+  INT32U               num_measured = 0;
+  INT32U               i;
 
   if ((domain == NULL) || (node == NULL) || (all_nodes_macs_list == NULL))
   {
@@ -335,61 +396,50 @@ static t_VB_engineErrorCode VbEngineCfrMeasureListCreateCb(t_VBDriver *driver, t
 
   if (ret == VB_ENGINE_ERROR_NONE)
   {
-    // Release previously allocated memory
-    if (node->measures.CFRMeasureList.numCrossMeasures > 0)
-    {
-      VbEngineDatamodelNodeCrossMeasureListDestroy(&(node->measures.CFRMeasureList));
-    }
-  }
-
-  if (ret == VB_ENGINE_ERROR_NONE)
-  {
-    // Allocate memory for crossMeasureArray
     if (node->type == VB_NODE_DOMAIN_MASTER)
     {
       num_measured = all_nodes_macs_list->epsMacs.numNodes;
+      mac_measured_ptr = all_nodes_macs_list->epsMacs.ptr;
     }
     else
     {
       num_measured = all_nodes_macs_list->dmsMacs.numNodes;
+      mac_measured_ptr = all_nodes_macs_list->dmsMacs.ptr;
     }
 
-    node->measures.CFRMeasureList.crossMeasureArray = (t_crossMeasure *)calloc(1, num_measured * sizeof(t_crossMeasure));
-    if (node->measures.CFRMeasureList.crossMeasureArray == NULL)
+    // Measure buffers are recycled, linear planes shall not match new measures by address
+    VbEngineSnrLinearCacheInvalidate(node);
+
+    if (VbEngineCfrMeasureListIsReusable(&(node->measures.CFRMeasureList), mac_measured_ptr, num_measured) == TRUE)
     {
-      ret = VB_ENGINE_ERROR_MALLOC;
+      // Same measured nodes than previous plan, keep CFR buffers as spare
+      for (i = 0; i < num_measured; i++)
+      {
+        VbEngineCfrMeasureSpareKeep(&(node->measures.CFRMeasureList.crossMeasureArray[i]));
+      }
     }
-  }
-
-  if (ret == VB_ENGINE_ERROR_NONE)
-  {
-    // Allocate memory for each measured device
-    INT32U i;
-
-    node->measures.CFRMeasureList.numCrossMeasures = num_measured;
-
-    for (i = 0; i < num_measured; i++)
+    else
     {
-      node->measures.CFRMeasureList.crossMeasureArray[i].measure.measuresRx1 = NULL;
-      node->measures.CFRMeasureList.crossMeasureArray[i].measure.measuresRx2 = NULL;
+      // Release previously allocated memory
+      if (node->measures.CFRMeasureList.numCrossMeasures > 0)
+      {
+        VbEngineDatamodelNodeCrossMeasureListDestroy(&(node->measures.CFRMeasureList));
+      }
+
+      // Allocate memory for crossMeasureArray
+      node->measures.CFRMeasureList.crossMeasureArray = (t_crossMeasure *)calloc(1, num_measured * sizeof(t_crossMeasure));
+      if (node->measures.CFRMeasureList.crossMeasureArray == NULL)
+      {
+        ret = VB_ENGINE_ERROR_MALLOC;
+      }
     }
   }
 
   if (ret == VB_ENGINE_ERROR_NONE)
   {
-    // Fill each measured device MAC
-    INT8U *mac_measured_ptr;
-    INT32U i;
-
-    if (node->type == VB_NODE_DOMAIN_MASTER)
-    {
-      mac_measured_ptr = all_nodes_macs_list->epsMacs.ptr;
-    }
-    else
-    {
-      mac_measured_ptr = all_nodes_macs_list->dmsMacs.ptr;
-    }
+    node->measures.CFRMeasureList.numCrossMeasures = num_measured;
 
+    // Fill each measured device MAC
     for (i = 0; i < num_measured; i++)
     {
       // Compare with our linked node MAC
@@ -405,6 +455,8 @@ static t_VB_engineErrorCode VbEngineCfrMeasureListCreateCb(t_VBDriver *driver, t
       }
 
       MACAddrClone(node->measures.CFRMeasureList.crossMeasureArray[i].MAC, mac_measured_ptr);
+      node->measures.CFRMeasureList.crossMeasureArray[i].measure.measuresRx1 = NULL;
+      node->measures.CFRMeasureList.crossMeasureArray[i].measure.measuresRx2 = NULL;
       node->measures.CFRMeasureList.crossMeasureArray[i].measure.freqCutProfile = MAX_INT32U;
       mac_measured_ptr += ETH_ALEN;
     }
@@ -422,7 +474,8 @@ static t_VB_engineErrorCode VbEngineCfrMeasureListCreateCb(t_VBDriver *driver, t
 /*******************************************************************/
 
 static t_VB_engineErrorCode VbEngineMeasurementPlanCreate( INT8U planid, INT16U seqNumStart, t_measconfdata *measconfdata,
-                                                           INT8U *payload, t_vbEngineNumNodes numNodes, INT16U *endSeqNum, INT32U clusterId )
+                                                           INT8U cfrDecimationLog2, INT8U *payload, t_vbEngineNumNodes numNodes,
+                                                           INT16U *endSeqNum, INT32U clusterId )
 {
   t_VB_engineErrorCode             result = VB_ENGINE_ERROR_NONE;
   INT8U                           *pvalue;
@@ -471,7 +524,9 @@ static t_VB_engineErrorCode VbEngineMeasurementPlanCreate( INT8U planid, INT16U
     measure_configuration->storageType         = measconfdata->StorageType;
     measure_configuration->symbolsNumber       = measconfdata->SymbolsNumber;
     measure_configuration->time                = measconfdata->TimeAveraging & 0x0F;
-    measure_configuration->frequency           = measconfdata->FrecuencyAveraging;
+    // CFR grid is BGN grid (frequency averaging) coarsened by the CFR decimation of the plan
+    // (see vb_engine_cfr_resolution.c); frequency averaging setting itself is not changed
+    measure_configuration->frequency           = MIN(measconfdata->FrecuencyAveraging + cfrDecimationLog2, 0x0F);
     measure_configuration->offset              = _htonl_ghn(measconfdata->Offset);
     measure_configuration->duration            = _htonl_ghn(measconfdata->Duration);
 
@@ -604,76 +659,217 @@ static t_VB_engineErrorCode VbEngineMeasureBgnNoiseSet(INT8U* macMeasurer, t_VBD
 
 /*******************************************************************/
 
-static t_VB_engineErrorCode VbEngineMeasureCfrSet(INT8U* macMeasurer, INT8U *macMeasured, t_VBDriver *thisDriver, t_processMeasure *measurePtr )
+static t_crossMeasure *VbEngineMeasureCfrSlotFind(t_VBDriver *thisDriver, const INT8U *macMeasurer, const INT8U *macMeasured)
 {
-  INT32U i;
-  INT32U j;
-  INT32U k;
-  INT32U freq_cut_profile;
-  t_domain   *domain = NULL;
-  t_node     *domainEp = NULL;
-  t_crossMeasure *cfrMeasInfo = NULL;
-  t_domainsList *domainsList;
-  BOOL found = FALSE;
-  t_VB_engineErrorCode err = VB_ENGINE_ERROR_NONE;
+  t_crossMeasureList *cfr_list = NULL;
+  t_crossMeasure     *cfr_measure = NULL;
+  t_domain           *domain;
+  INT32U              i;
+  INT32U              j;
 
-  if ((thisDriver != NULL) && (measurePtr != NULL))
+  // Shall be called with domainsMutex locked
+  for (i = 0; (i < thisDriver->domainsList.numDomains) && (cfr_list == NULL); i++)
   {
-    pthread_mutex_lock(&(thisDriver->domainsMutex));
-    domainsList = &(thisDriver->domainsList);
+    domain = &(thisDriver->domainsList.domainsArray[i]);
 
-    for(i= 0; i < domainsList->numDomains; i++)
+    if (memcmp(domain->dm.MAC, macMeasurer, ETH_ALEN) == 0)
     {
-      domain = &(domainsList->domainsArray[i]);
-      if(memcmp(domain->dm.MAC, macMeasurer, ETH_ALEN) == 0)
+      cfr_list = &(domain->dm.measures.CFRMeasureList);
+    }
+    else
+    {
+      for (j = 0; (j < domain->eps.numEPs) && (cfr_list == NULL); j++)
       {
-        // Measurer is DM, search in measured MAC
-        for(j = 0; j < domain->dm.measures.CFRMeasureList.numCrossMeasures; j++)
+        if (memcmp(domain->eps.epsArray[j].MAC, macMeasurer, ETH_ALEN) == 0)
         {
-          cfrMeasInfo = &(domain->dm.measures.CFRMeasureList.crossMeasureArray[j]);
-          if(memcmp(cfrMeasInfo->MAC, macMeasured, ETH_ALEN) == 0)
-          {
-            freq_cut_profile = cfrMeasInfo->measure.freqCutProfile;
-            VbDatamodelNodeProcessMeasureDestroy(&(cfrMeasInfo->measure));
-            cfrMeasInfo->measure = *measurePtr;
-            cfrMeasInfo->measure.freqCutProfile = freq_cut_profile;
-            cfrMeasInfo->measure.carrierGridIdxCutProfile = FREQ2GRIDCARRIERIDX(freq_cut_profile, cfrMeasInfo->measure.spacing);
-            found = TRUE;
-          }
+          cfr_list = &(domain->eps.epsArray[j].measures.CFRMeasureList);
         }
       }
+    }
+  }
+
+  if ((cfr_list != NULL) && (cfr_list->crossMeasureArray != NULL))
+  {
+    for (i = 0; (i < cfr_list->numCrossMeasures) && (cfr_measure == NULL); i++)
+    {
+      if (memcmp(cfr_list->crossMeasureArray[i].MAC, macMeasured, ETH_ALEN) == 0)
+      {
+        cfr_measure = &(cfr_list->crossMeasureArray[i]);
+      }
+    }
+  }
+
+  return cfr_measure;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode VbEngineMeasureCfrBuffersGet(t_crossMeasure *cfrMeasure, INT32U size, BOOLEAN mimo)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_processMeasure     *measure = &(cfrMeasure->measure);
+
+  if ((measure->measuresRx1 != NULL) &&
+      ((measure->numMeasures != size) || ((measure->measuresRx2 != NULL) != mimo)))
+  {
+    // CFR already received with a different format
+    VbEngineCfrMeasureSpareKeep(cfrMeasure);
+  }
+
+  if ((measure->measuresRx1 == NULL) && (size > 0))
+  {
+    if ((cfrMeasure->spareRx1 != NULL) && (cfrMeasure->spareSize >= size) &&
+        ((mimo == FALSE) || (cfrMeasure->spareRx2 != NULL)))
+    {
+      // Reuse buffers of previous plan
+      measure->measuresRx1 = cfrMeasure->spareRx1;
+      cfrMeasure->spareRx1 = NULL;
+
+      if (mimo == TRUE)
+      {
+        measure->measuresRx2 = cfrMeasure->spareRx2;
+        cfrMeasure->spareRx2 = NULL;
+      }
+    }
+    else
+    {
+      measure->measuresRx1 = (INT8U *)malloc(size);
+
+      if ((measure->measuresRx1 != NULL) && (mimo == TRUE))
+      {
+        measure->measuresRx2 = (INT8U *)malloc(size);
+      }
+
+      if ((measure->measuresRx1 == NULL) || ((mimo == TRUE) && (measure->measuresRx2 == NULL)))
+      {
+        VbDatamodelNodeProcessMeasureDestroy(measure);
+        ret = VB_ENGINE_ERROR_MALLOC;
+      }
       else
       {
-        for(j = 0; j < domain->eps.numEPs; j++)
-        {
-          domainEp = &(domain->eps.epsArray[j]);
-          if(memcmp(domainEp->MAC, macMeasurer, ETH_ALEN) == 0)
-          {
-            for(k= 0; k < domainEp->measures.CFRMeasureList.numCrossMeasures; k++)
-            {
-              cfrMeasInfo = &(domainEp->measures.CFRMeasureList.crossMeasureArray[k]);
-              if(memcmp(cfrMeasInfo->MAC, macMeasured, ETH_ALEN) == 0)
-              {
-                freq_cut_profile = cfrMeasInfo->measure.freqCutProfile;
-                VbDatamodelNodeProcessMeasureDestroy(&(cfrMeasInfo->measure));
-                cfrMeasInfo->measure = *measurePtr;
-                cfrMeasInfo->measure.freqCutProfile = freq_cut_profile;
-                cfrMeasInfo->measure.carrierGridIdxCutProfile = FREQ2GRIDCARRIERIDX(freq_cut_profile, cfrMeasInfo->measure.spacing);
-                found = TRUE;
-              }
-            }
-          }
-        }
+        VbCounterIncrease(VB_ENGINE_COUNTER_CFR_BUFFERS_ALLOCATED);
       }
     }
-    pthread_mutex_unlock(&(thisDriver->domainsMutex));
+
+    // Spare buffers not reused are not needed anymore
+    VbEngineDatamodelCrossMeasureSpareRelease(cfrMeasure);
   }
 
-  if(found == FALSE)
+  return ret;
+}
+
+/*******************************************************************/
+
+static BOOLEAN VbEngineMeasureStreamCopy(const t_processMeasure *measure, t_processMeasure *copy)
+{
+  BOOLEAN ret = TRUE;
+
+  *copy = *measure;
+  copy->measures = NULL;
+  copy->measuresRx1 = NULL;
+  copy->measuresRx2 = NULL;
+
+  if (measure->measuresRx1 != NULL)
   {
-    err = VB_ENGINE_ERROR_NOT_FOUND;
+    copy->measuresRx1 = (INT8U *)malloc(MAX(measure->numMeasures, 1));
+    ret = (copy->measuresRx1 != NULL)?TRUE:FALSE;
+  }
+
+  if ((ret == TRUE) && (measure->measuresRx2 != NULL))
+  {
+    copy->measuresRx2 = (INT8U *)malloc(MAX(measure->numMeasures, 1));
+    ret = (copy->measuresRx2 != NULL)?TRUE:FALSE;
+  }
+
+  if (ret == TRUE)
+  {
+    if (copy->measuresRx1 != NULL)
+    {
+      memcpy(copy->measuresRx1, measure->measuresRx1, measure->numMeasures);
+    }
+
+    if (copy->measuresRx2 != NULL)
+    {
+      memcpy(copy->measuresRx2, measure->measuresRx2, measure->numMeasures);
+    }
+  }
+  else
+  {
+    VbDatamodelNodeProcessMeasureDestroy(copy);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void VbEngineMeasureCfrDeinterleave(const INT8U *src, INT32U numValues, BOOLEAN mimoMeas, INT8U *rx1, INT8U *rx2)
+{
+  INT32U i = 0;
+
+#if VB_MEASURE_CFR_VECTOR_ENABLED
+  const t_cfrVector rx1_mask = { 0,  2,  4,  6,  8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30};
+  const t_cfrVector rx2_mimo_mask = { 3,  1,  7,  5, 11,  9, 15, 13, 19, 17, 23, 21, 27, 25, 31, 29};
+  const t_cfrVector rx2_siso_mask = { 1,  3,  5,  7,  9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31};
+  t_cfrVector       lo;
+  t_cfrVector       hi;
+  t_cfrVector       out;
+
+  // Shuffle 32 received values (8 carriers in MIMO, 16 in SISO) into 16 values of each Rx
+  for (i = 0; (i + (2 * VB_MEASURE_CFR_VECTOR_LEN)) <= numValues; i += (2 * VB_MEASURE_CFR_VECTOR_LEN))
+  {
+    memcpy(&lo, &src[i], sizeof(lo));
+    memcpy(&hi, &src[i + VB_MEASURE_CFR_VECTOR_LEN], sizeof(hi));
+
+    out = __builtin_shuffle(lo, hi, rx1_mask);
+    memcpy(&rx1[i >> 1], &out, sizeof(out));
+
+    out = __builtin_shuffle(lo, hi, (mimoMeas == TRUE)?rx2_mimo_mask:rx2_siso_mask);
+    memcpy(&rx2[i >> 1], &out, sizeof(out));
+  }
+#endif
+
+  if (mimoMeas == TRUE)
+  {
+    // Node Measured was also in MIMO
+    // | | = 1 byte
+    //        *       ci      *      ci+2      *
+    // Change |h11|h21|h12|h22| ...
+    // To:
+    //              *  ci   *  ci+2 *
+    //      - Rx1 : |h11|h12|...
+    //      - Rx2 : |h22|h21|...
+    for (; (i + 4) <= numValues; i += 4)
+    {
+      rx1[(i >> 1) + 0] = src[i];
+      rx2[(i >> 1) + 1] = src[i + 1];
+      rx1[(i >> 1) + 1] = src[i + 2];
+      rx2[(i >> 1) + 0] = src[i + 3];
+    }
+
+    if ((i + 2) <= numValues)
+    {
+      // Incomplete last carrier, h22 not received
+      rx1[i >> 1] = src[i];
+      rx2[i >> 1] = 0;
+    }
+  }
+  else
+  {
+    // Node Measured was in SISO
+    // | | = 1 byte
+    //        *       ci      *     ci+1      *
+    // Change |h11+h12|h21+h22| ...
+    // To:
+    //              *  ci   *  ci+1 *
+    //      - Rx1 : |h11+h12|...
+    //      - Rx2 : |h21+h22|...
+    for (; (i + 2) <= numValues; i += 2)
+    {
+      rx1[i >> 1] = src[i];
+      rx2[i >> 1] = src[i + 1];
+    }
   }
-  return err;
 }
 
 /*******************************************************************/
@@ -1093,7 +1289,7 @@ static t_VB_engineErrorCode VbEngineMeasureSaveHelper ( const char *folder,
     if (buffer != NULL)
     {
       // Save to file
-      VbLogSaveBufferToTextFile(file_path, "w+", VB_MEASURE_BUFFER_TO_FILE_SIZE, buffer);
+      VbFileWriterWrite(file_path, TRUE, buffer, strnlen(buffer, VB_MEASURE_BUFFER_TO_FILE_SIZE));
     }
   }
 
@@ -1140,17 +1336,17 @@ static t_VB_engineErrorCode VbEngineProcessSnrProbesSaveMeasureSequenceHelper (
     {
       sprintf(file_path, "%s/Measures_Dev_MAC_%02X_%02X_%02X_%02X_%02X_%02X.csv", folder, macMeasurer[0], macMeasurer[1], macMeasurer[2], macMeasurer[3], macMeasurer[4], macMeasurer[5]);
 
-      VbLogSaveStringToTextFile(file_path, "w+", "MAC Measurer: " MAC_PRINTF_FORMAT "\n", MAC_PRINTF_DATA(macMeasurer));
-      VbLogSaveStringToTextFile(file_path, "a+", "Driver Id: %s\n", driverId);
-      VbLogSaveStringToTextFile(file_path, "a+", "Cluster Id: %d\n", clusterId);
-      VbLogSaveStringToTextFile(file_path, "a+", "First Carriers: %d\n",snrProbesMeasure->firstCarrier);
-      VbLogSaveStringToTextFile(file_path, "a+", "Spacing: %d\n",snrProbesMeasure->spacing);
-      VbLogSaveStringToTextFile(file_path, "a+", "Flags: %d\n",snrProbesMeasure->flags);
-      VbLogSaveStringToTextFile(file_path, "a+", "rxg1 compensation:\n%d\n",snrProbesMeasure->rxg1Compensation);
-      VbLogSaveStringToTextFile(file_path, "a+", "rxg2 compensation:\n%d\n",snrProbesMeasure->rxg2Compensation);
-      VbLogSaveStringToTextFile(file_path, "a+", "MIMO Ind:\n%d\n",snrProbesMeasure->mimoInd);
-      VbLogSaveStringToTextFile(file_path, "a+", "Measures\n");
-      VbLogSaveStringToTextFile(file_path, "a+", "SNR Probes;\n");
+      VbFileWriterPrintf(file_path, TRUE, "MAC Measurer: " MAC_PRINTF_FORMAT "\n", MAC_PRINTF_DATA(macMeasurer));
+      VbFileWriterPrintf(file_path, FALSE, "Driver Id: %s\n", driverId);
+      VbFileWriterPrintf(file_path, FALSE, "Cluster Id: %d\n", clusterId);
+      VbFileWriterPrintf(file_path, FALSE, "First Carriers: %d\n",snrProbesMeasure->firstCarrier);
+      VbFileWriterPrintf(file_path, FALSE, "Spacing: %d\n",snrProbesMeasure->spacing);
+      VbFileWriterPrintf(file_path, FALSE, "Flags: %d\n",snrProbesMeasure->flags);
+      VbFileWriterPrintf(file_path, FALSE, "rxg1 compensation:\n%d\n",snrProbesMeasure->rxg1Compensation);
+      VbFileWriterPrintf(file_path, FALSE, "rxg2 compensation:\n%d\n",snrProbesMeasure->rxg2Compensation);
+      VbFileWriterPrintf(file_path, FALSE, "MIMO Ind:\n%d\n",snrProbesMeasure->mimoInd);
+      VbFileWriterPrintf(file_path, FALSE, "Measures\n");
+      VbFileWriterPrintf(file_path, FALSE, "SNR Probes;\n");
 
       // Print DATA ENTRIES
       //
@@ -1163,7 +1359,7 @@ static t_VB_engineErrorCode VbEngineProcessSnrProbesSaveMeasureSequenceHelper (
             for(actual_carrier = 0 ; actual_carrier < snrProbesMeasure->numMeasures ; actual_carrier++)
             {
               temp_float_rx1 = (((float)(snrProbesMeasure->measuresRx1[actual_carrier]))/4) - snrProbesMeasure->rxg1Compensation;
-              VbLogSaveStringToTextFile(file_path, "a+", "%f;\n", temp_float_rx1);
+              VbFileWriterPrintf(file_path, FALSE, "%f;\n", temp_float_rx1);
             }
           }
           else
@@ -1172,7 +1368,7 @@ static t_VB_engineErrorCode VbEngineProcessSnrProbesSaveMeasureSequenceHelper (
             {
               temp_float_rx1 = (((float)(snrProbesMeasure->measuresRx1[actual_carrier]))/4) - snrProbesMeasure->rxg1Compensation;
               temp_float_rx2 = (((float)(snrProbesMeasure->measuresRx2[actual_carrier]))/4) - snrProbesMeasure->rxg2Compensation;
-              VbLogSaveStringToTextFile(file_path, "a+", "%f;%f;\n", temp_float_rx1, temp_float_rx2);
+              VbFileWriterPrintf(file_path, FALSE, "%f;%f;\n", temp_float_rx1, temp_float_rx2);
             }
           }
         }
@@ -1279,6 +1475,7 @@ t_VB_engineErrorCode VbEngineProcessMeasurePlanBuild(INT32U clusterId)
   t_reqMeasurement     *measurement_curr_meas = NULL;
   struct timespec      initial_ts_own_clock;
   t_vbEngineNumNodes    num_nodes;
+  INT8U                 cfr_decimation_log2;
 
   VbCounterIncrease(VB_ENGINE_COUNTER_MEASURE_PLAN_REQUESTED);
 
@@ -1337,9 +1534,13 @@ t_VB_engineErrorCode VbEngineProcessMeasurePlanBuild(INT32U clusterId)
 
   if (result == VB_ENGINE_ERROR_NONE)
   {
+    // Select CFR resolution, once per plan built
+    cfr_decimation_log2 = VbEngineCfrResolutionPlanStart(clusterId);
+
     result = VbEngineMeasurementPlanCreate(measurement_curr_meas->planId,
                                            measurement_curr_meas->initialSeqNumber,
                                            measure_conf_data,
+                                           cfr_decimation_log2,
                                            measurement_curr_meas->measurePlan.msg,
                                            num_nodes,
                                            &measurement_curr_meas->endSeqNumber,
@@ -1860,129 +2061,113 @@ t_VB_engineErrorCode VbEngineProcessMeasurePlanTimeToFinishGet(INT32U clusterId,
 t_VB_engineErrorCode    VbEngineCFRRespProcess(INT8U* payload, INT32U length, t_VBDriver *thisDriver)
 {
   t_VB_engineErrorCode vb_err = VB_ENGINE_ERROR_NONE;
-  t_vbEACFRMeasure *cfrRsp;
-  t_processMeasure measure;
+  t_vbEACFRMeasure *cfrRsp = NULL;
+  t_crossMeasure *cfr_measure;
+  t_processMeasure *measure;
   INT8U* pld_carriers_info;
-  INT32U i;
+  INT32U num_values = 0;
+  INT32U size;
+  INT32U freq_cut_profile;
+  t_processMeasure stream_measure;
+  BOOLEAN publish = FALSE;
 
-  if(payload != NULL)
+  if ((payload == NULL) || (thisDriver == NULL) || (length < VB_EA_CFRFRAME_MEASURE_HEADER_SIZE))
+  {
+    vb_err = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (vb_err == VB_ENGINE_ERROR_NONE)
   {
     cfrRsp = ( t_vbEACFRMeasure *)payload;
 
-    measure.measuresRx1 = NULL;
-    measure.measuresRx2 = NULL;
-    measure.errorCode = cfrRsp->ErrorCode;
+    if (cfrRsp->ErrorCode != VB_MEAS_ERRCODE_VALID)
+    {
+      vb_err = VB_ENGINE_ERROR_MEASURE_NODE;
+    }
+  }
 
-    if (measure.errorCode  == VB_MEAS_ERRCODE_VALID)
+  if (vb_err == VB_ENGINE_ERROR_NONE)
+  {
+    num_values = _ntohs(cfrRsp->numCarriers);
+
+    if (length < (VB_EA_CFRFRAME_MEASURE_HEADER_SIZE + num_values))
     {
-      measure.numMeasures = _ntohs(cfrRsp->numCarriers);
-      measure.rxg1Compensation = cfrRsp->rxg1Compensation;
-      measure.rxg2Compensation = cfrRsp->rxg2Compensation;
-      measure.mimoInd = cfrRsp->mimoInd;
-      measure.mimoMeas = cfrRsp->mimoMeas;
-      measure.firstCarrier = _ntohs(cfrRsp->firstCarrier);
-      measure.errorCode = cfrRsp->ErrorCode;
-      measure.spacing = cfrRsp->spacing;
-      measure.flags = cfrRsp->flags;
-      measure.planID = cfrRsp->planId;
-      measure.type = VB_MEAS_TYPE_CFR;
+      VbLogPrintExt(VB_LOG_ERROR, thisDriver->vbDriverID, "CFR frame too short (%lu bytes, %lu values)", length, num_values);
+      vb_err = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+    }
+  }
 
-      pld_carriers_info = (INT8U *)(payload + sizeof(t_vbEACFRMeasure));
+  if (vb_err == VB_ENGINE_ERROR_NONE)
+  {
+    // Values are split from the received payload directly into the CFR slot of the measurer node.
+    // In MIMO, each Rx receives half of the values
+    pld_carriers_info = (INT8U *)(payload + VB_EA_CFRFRAME_MEASURE_HEADER_SIZE);
+    size = (cfrRsp->mimoInd == FALSE)?num_values:(num_values >> 1);
 
-      if(measure.mimoInd == FALSE)
-      {
-        // Measurer node Mode is SISO, all measure info are related to Rx1
-        measure.measuresRx1 = calloc(1, measure.numMeasures);
-        measure.measuresRx2 = NULL;
+    pthread_mutex_lock(&(thisDriver->domainsMutex));
 
-        if(measure.measuresRx1)
-        {
-          memcpy(measure.measuresRx1, pld_carriers_info, measure.numMeasures);
-        }
-      }
-      else
-      {
-        // Measurer node Mode is MIMO
-        // Split received info in Rx1 and Rx2
+    cfr_measure = VbEngineMeasureCfrSlotFind(thisDriver, cfrRsp->MACMeasurer, cfrRsp->MACMeasured);
 
-        // Alloc memory for Rx1
-        measure.measuresRx1 = calloc(1, measure.numMeasures/2);
-        if(measure.measuresRx1 == NULL)
-        {
-          vb_err = VB_ENGINE_ERROR_MALLOC;
-        }
+    if (cfr_measure == NULL)
+    {
+      vb_err = VB_ENGINE_ERROR_NOT_FOUND;
+    }
 
-        // Alloc memory for Rx2
-        if(vb_err == VB_ENGINE_ERROR_NONE)
+    if (vb_err == VB_ENGINE_ERROR_NONE)
+    {
+      freq_cut_profile = cfr_measure->measure.freqCutProfile;
+      vb_err = VbEngineMeasureCfrBuffersGet(cfr_measure, size, (cfrRsp->mimoInd == FALSE)?FALSE:TRUE);
+    }
+
+    if (vb_err == VB_ENGINE_ERROR_NONE)
+    {
+      measure = &(cfr_measure->measure);
+
+      if (size > 0)
+      {
+        if (cfrRsp->mimoInd == FALSE)
         {
-          measure.measuresRx2 = calloc(1, measure.numMeasures/2);
-          if(measure.measuresRx2 == NULL)
-          {
-            vb_err = VB_ENGINE_ERROR_MALLOC;
-          }
+          // Measurer node Mode is SISO, all measure info are related to Rx1
+          memcpy(measure->measuresRx1, pld_carriers_info, size);
         }
-
-        if(vb_err == VB_ENGINE_ERROR_NONE)
+        else
         {
-          if(measure.mimoMeas)
-          {
-            // Node Measured was also in MIMO
-            // | | = 1 byte
-            //        *       ci      *      ci+2      *
-            // Change |h11|h21|h12|h22| ...
-            // To:
-            //              *  ci   *  ci+2 *
-            //      - Rx1 : |h11|h12|...
-            //      - Rx2 : |h22|h21|...
-            for(i=0; i < measure.numMeasures; i+=4)
-            {
-              measure.measuresRx1[(i>>1)+0] = pld_carriers_info[i];
-              measure.measuresRx2[(i>>1)+1] = pld_carriers_info[i+1];
-              measure.measuresRx1[(i>>1)+1] = pld_carriers_info[i+2];
-              measure.measuresRx2[(i>>1)+0] = pld_carriers_info[i+3];
-            }
-
-            // There are now numMeasures/2 in each Rxi
-            measure.numMeasures >>=1;
-          }
-          else
-          {
-            // Node Measured was in SISO
-            // | | = 1 byte
-            //        *       ci      *     ci+1      *
-            // Change |h11+h12|h21+h22| ...
-            // To:
-            //              *  ci   *  ci+1 *
-            //      - Rx1 : |h11+h12|...
-            //      - Rx2 : |h21+h22|...
-            for(i=0; i < measure.numMeasures; i+=2)
-            {
-              measure.measuresRx1[i>>1] = pld_carriers_info[i];
-              measure.measuresRx2[i>>1] = pld_carriers_info[i+1];
-            }
-
-            // There are now numMeasures/2 in each Rxi
-            measure.numMeasures >>=1;
-          }
+          // Measurer node Mode is MIMO
+          VbEngineMeasureCfrDeinterleave(pld_carriers_info, num_values, (cfrRsp->mimoMeas == FALSE)?FALSE:TRUE,
+                                         measure->measuresRx1, measure->measuresRx2);
         }
       }
 
-      vb_err = VbEngineMeasureCfrSet(cfrRsp->MACMeasurer, cfrRsp->MACMeasured, thisDriver, &measure);
-
-      if (vb_err == VB_ENGINE_ERROR_NOT_FOUND)
+      measure->numMeasures = size;
+      measure->rxg1Compensation = cfrRsp->rxg1Compensation;
+      measure->rxg2Compensation = cfrRsp->rxg2Compensation;
+      measure->mimoInd = cfrRsp->mimoInd;
+      measure->mimoMeas = cfrRsp->mimoMeas;
+      measure->firstCarrier = _ntohs(cfrRsp->firstCarrier);
+      measure->errorCode = cfrRsp->ErrorCode;
+      measure->spacing = cfrRsp->spacing;
+      measure->flags = cfrRsp->flags;
+      measure->planID = cfrRsp->planId;
+      measure->type = VB_MEAS_TYPE_CFR;
+      measure->freqCutProfile = freq_cut_profile;
+      measure->carrierGridIdxCutProfile = FREQ2GRIDCARRIERIDX(freq_cut_profile, measure->spacing);
+
+      if (VbEngineMeasStreamSubscribedGet() == TRUE)
       {
-        VbDatamodelNodeProcessMeasureDestroy(&measure);
+        // Published from a copy once domainsMutex is released
+        publish = VbEngineMeasureStreamCopy(measure, &stream_measure);
       }
     }
-    else
+
+    pthread_mutex_unlock(&(thisDriver->domainsMutex));
+
+    if (publish == TRUE)
     {
-      vb_err = VB_ENGINE_ERROR_MEASURE_NODE;
+      VbEngineMeasStreamMeasurePublish(VB_MEAS_STREAM_TYPE_CFR, thisDriver->clusterId, cfrRsp->MACMeasurer,
+                                       cfrRsp->MACMeasured, &stream_measure);
+      VbDatamodelNodeProcessMeasureDestroy(&stream_measure);
     }
   }
-  else
-  {
-    vb_err = VB_ENGINE_ERROR_BAD_ARGUMENTS;
-  }
 
   return vb_err;
 }
@@ -2030,6 +2215,8 @@ t_VB_engineErrorCode VbEngineBngNoiseRespProcess(INT8U* payload, INT32U length,
           measure.measuresRx2 = NULL;
           memcpy(measure.measuresRx1, pld_carriers_info,  measure.numMeasures);
 
+          VbEngineMeasStreamMeasurePublish(VB_MEAS_STREAM_TYPE_BGN, thisDriver->clusterId, bngRsp->MAC, NULL, &measure);
+
           vb_err = VbEngineMeasureBgnNoiseSet(bngRsp->MAC, thisDriver, &measure);
 
           if(vb_err == VB_ENGINE_ERROR_NOT_FOUND)
@@ -2078,6 +2265,8 @@ t_VB_engineErrorCode VbEngineBngNoiseRespProcess(INT8U* payload, INT32U length,
           // There are now numMeasures/2 in each Rxi
           measure.numMeasures >>=1;
 
+          VbEngineMeasStreamMeasurePublish(VB_MEAS_STREAM_TYPE_BGN, thisDriver->clusterId, bngRsp->MAC, NULL, &measure);
+
           vb_err = VbEngineMeasureBgnNoiseSet(bngRsp->MAC, thisDriver, &measure);
 
           if (vb_err == VB_ENGINE_ERROR_NOT_FOUND)
@@ -2185,6 +2374,14 @@ t_VB_engineErrorCode VbEngineSnrProbesRespProcess(INT8U* payload, INT32U length,
     vb_err = VB_ENGINE_ERROR_BAD_ARGUMENTS;
   }
 
+  if(vb_err == VB_ENGINE_ERROR_NONE)
+  {
+    VbEngineMeasStreamMeasurePublish(VB_MEAS_STREAM_TYPE_SNR_PROBE, thisDriver->clusterId, snrRsp->MAC, NULL, measurePtr);
+
+    // Compare with predicted SNR, a new measure plan may be requested
+    VbEngineSnrTrackingProbeCheck(thisDriver, snrRsp->MAC);
+  }
+
   if(vb_err == VB_ENGINE_ERROR_NONE)
   {
     CHAR            *file_path = NULL;
@@ -2295,20 +2492,14 @@ void VbEngineMeasureConfDump(t_writeFun writeFun)
 
 /*******************************************************************/
 
-t_VB_engineErrorCode VbEngineMeasureConfigurationParse( ezxml_t measure_conf )
+t_VB_engineErrorCode VbEngineMeasureConfigurationParse( ezxml_t measure_conf, t_measconfdata *measure_conf_data )
 {
-  t_VB_engineErrorCode err_code;
+  t_VB_engineErrorCode err_code = VB_ENGINE_ERROR_NONE;
   ezxml_t              ez_temp;
-  t_measconfdata       *measure_conf_data = NULL;
 
-  err_code = VbEngineConfMeasurePlanGet(&measure_conf_data);
-
-  if (err_code == VB_ENGINE_ERROR_NONE)
+  if ((measure_conf == NULL) || (measure_conf_data == NULL))
   {
-    if (measure_conf == NULL)
-    {
-      err_code = VB_ENGINE_ERROR_BAD_ARGUMENTS;
-    }
+    err_code = VB_ENGINE_ERROR_BAD_ARGUMENTS;
   }
 
   if (err_code == VB_ENGINE_ERROR_NONE)
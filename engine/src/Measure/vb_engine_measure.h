@@ -189,9 +189,10 @@ void VbEngineMeasureConfDump(t_writeFun writeFun);
 /**
  * @brief Parse the measure plan configuration bit in the vb_engine.ini
  * @param[in] measureConf measure configuration to parse
+ * @param[out] measConfData Measure plan configuration to fill
  * @return @ref t_VB_engineErrorCode
  **/
-t_VB_engineErrorCode VbEngineMeasureConfigurationParse( ezxml_t measureConf );
+t_VB_engineErrorCode VbEngineMeasureConfigurationParse( ezxml_t measureConf, t_measconfdata *measConfData );
 
 /**
  * @brief Notify the driver of an error occurred during the measure plan
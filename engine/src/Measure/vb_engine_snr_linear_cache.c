@@ -0,0 +1,533 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_snr_linear_cache.c
+ * @brief Linear domain cache of BGN and crosstalk measures
+ *
+ * @internal
+ *
+ * SNR calculation needs BGN and crosstalk CFR values in linear power, while
+ * measures are stored as quarter dB bytes. Every plane (BGN or CFR, per Rx) is
+ * converted once per measure and kept as bfloat16, half the size of a float
+ * plane. bfloat16 keeps the float exponent range (BGN values go down to
+ * 1e-20) with a relative error below 0.2%, i.e. less than 0.01 dB, well under
+ * the 0.25 dB grid of the computed SNR.
+ *
+ * A plane is identified by the buffer, length, plan Id and gain compensation
+ * of its measure; planes still matching their measure are reused by
+ * following SNR calculations. All planes of a node are invalidated when a new
+ * measure plan starts, as measure buffers are recycled between plans.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+
+#include "vb_util.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_drivers_list.h"
+#include "vb_engine_SNR_calculation.h"
+#include "vb_engine_snr_linear_cache.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_SNR_LINEAR_CACHE_LUT_SIZE                (256)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  INT32S clusterId;
+  INT32U numNodes;
+  INT32U numPlanes;
+  INT32U numBytes;
+  INT32U hits;
+  INT32U misses;
+} t_snrLinearCacheClusterStats;
+
+typedef struct
+{
+  t_snrLinearCacheClusterStats *stats;
+  INT32U                        numStats;
+  INT32U                        maxStats;
+  t_snrLinearCacheClusterStats *current;
+} t_snrLinearCacheConsoleArgs;
+
+/*
+ ************************************************************************
+ ** Private function definition
+ ************************************************************************
+ */
+
+static INT16U SnrLinearCacheBf16Get(float value)
+{
+  INT32U bits;
+
+  memcpy(&bits, &value, sizeof(bits));
+
+  // Round to nearest even
+  bits += 0x7FFF + ((bits >> 16) & 1);
+
+  return (INT16U)(bits >> 16);
+}
+
+/*******************************************************************/
+
+static void SnrLinearCachePlaneRelease(t_snrLinearPlane *plane)
+{
+  if (plane->values != NULL)
+  {
+    free(plane->values);
+  }
+
+  memset(plane, 0, sizeof(*plane));
+}
+
+/*******************************************************************/
+
+static void SnrLinearCacheCfrRelease(t_snrLinearCache *cache)
+{
+  INT32U i;
+
+  if (cache->cfr != NULL)
+  {
+    for (i = 0; i < (cache->numCfr << 1); i++)
+    {
+      SnrLinearCachePlaneRelease(&cache->cfr[i]);
+    }
+
+    free(cache->cfr);
+  }
+
+  cache->cfr = NULL;
+  cache->numCfr = 0;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode SnrLinearCachePlaneUpdate(t_snrLinearCache *cache, t_snrLinearPlane *plane,
+                                                      const INT8U *measures, INT16U numValues,
+                                                      INT8U planId, INT8S compensation)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT16U               lut[VB_SNR_LINEAR_CACHE_LUT_SIZE];
+  INT16U              *values;
+  INT32U               i;
+
+  if ((measures == NULL) || (numValues == 0))
+  {
+    plane->valid = FALSE;
+  }
+  else if ((plane->valid == TRUE) &&
+           (plane->src == measures) &&
+           (plane->numValues == numValues) &&
+           (plane->planId == planId) &&
+           (plane->compensation == compensation))
+  {
+    cache->hits++;
+  }
+  else
+  {
+    cache->misses++;
+    plane->valid = FALSE;
+
+    if (plane->capacity < numValues)
+    {
+      values = (INT16U *)realloc(plane->values, numValues * sizeof(INT16U));
+
+      if (values != NULL)
+      {
+        plane->values = values;
+        plane->capacity = numValues;
+      }
+      else
+      {
+        ret = VB_ENGINE_ERROR_MALLOC;
+      }
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      // Cheaper to convert every possible byte once than every measure value
+      for (i = 0; i < VB_SNR_LINEAR_CACHE_LUT_SIZE; i++)
+      {
+        lut[i] = SnrLinearCacheBf16Get(VbEngineSnrLinearize((INT8U)i, compensation));
+      }
+
+      for (i = 0; i < numValues; i++)
+      {
+        plane->values[i] = lut[measures[i]];
+      }
+
+      plane->src = measures;
+      plane->numValues = numValues;
+      plane->planId = planId;
+      plane->compensation = compensation;
+      plane->valid = TRUE;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void SnrLinearCacheStatsGet(const t_snrLinearCache *cache, INT32U *numPlanes, INT32U *numBytes)
+{
+  INT32U i;
+
+  *numPlanes = 0;
+  *numBytes = (cache->numCfr << 1) * sizeof(t_snrLinearPlane);
+
+  for (i = 0; i < 2; i++)
+  {
+    *numPlanes += (cache->bgn[i].valid == TRUE)?1:0;
+    *numBytes += cache->bgn[i].capacity * sizeof(INT16U);
+  }
+
+  for (i = 0; i < (cache->numCfr << 1); i++)
+  {
+    *numPlanes += (cache->cfr[i].valid == TRUE)?1:0;
+    *numBytes += cache->cfr[i].capacity * sizeof(INT16U);
+  }
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode SnrLinearCacheConsoleNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode         ret = VB_ENGINE_ERROR_NONE;
+  t_snrLinearCacheConsoleArgs *console_args = (t_snrLinearCacheConsoleArgs *)args;
+  INT32U                       num_planes;
+  INT32U                       num_bytes;
+
+  if ((node == NULL) || (console_args == NULL) || (console_args->current == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    SnrLinearCacheStatsGet(&node->snrLinearCache, &num_planes, &num_bytes);
+
+    console_args->current->numNodes++;
+    console_args->current->numPlanes += num_planes;
+    console_args->current->numBytes += num_bytes;
+    console_args->current->hits += node->snrLinearCache.hits;
+    console_args->current->misses += node->snrLinearCache.misses;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode SnrLinearCacheConsoleDriverCb(t_VBDriver *driver, void *args)
+{
+  t_VB_engineErrorCode         ret = VB_ENGINE_ERROR_NONE;
+  t_snrLinearCacheConsoleArgs *console_args = (t_snrLinearCacheConsoleArgs *)args;
+  INT32U                       i;
+
+  if ((driver == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    console_args->current = NULL;
+
+    for (i = 0; i < console_args->numStats; i++)
+    {
+      if (console_args->stats[i].clusterId == driver->clusterId)
+      {
+        console_args->current = &console_args->stats[i];
+        break;
+      }
+    }
+
+    if ((console_args->current == NULL) && (console_args->numStats < console_args->maxStats))
+    {
+      console_args->current = &console_args->stats[console_args->numStats++];
+      console_args->current->clusterId = driver->clusterId;
+    }
+
+    if (console_args->current != NULL)
+    {
+      ret = VbEngineDatamodelNodesLoop(driver, SnrLinearCacheConsoleNodeCb, args);
+    }
+  }
+
+  return ret;
+}
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+t_VB_engineErrorCode VbEngineSnrLinearCacheUpdate(t_node *node)
+{
+  t_VB_engineErrorCode                ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineSnrLinearCacheConf *conf = VbEngineConfSnrLinearCacheGet();
+  t_snrLinearCache                   *cache;
+  const t_processMeasure             *bgn_measure;
+  const t_crossMeasureList           *cfr_measure_list;
+  const t_processMeasure             *cfr_measure;
+  INT32U                              i;
+
+  if ((node == NULL) || (conf == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (conf->enable == FALSE)
+  {
+    // Keep no memory while disabled
+    VbEngineSnrLinearCacheRelease(&node->snrLinearCache);
+  }
+  else
+  {
+    cache = &node->snrLinearCache;
+    bgn_measure = &node->measures.BGNMeasure;
+    cfr_measure_list = &node->measures.CFRMeasureList;
+
+    if (SnrLinearCachePlaneUpdate(cache, &cache->bgn[0], bgn_measure->measuresRx1, bgn_measure->numMeasures,
+                                  bgn_measure->planID, bgn_measure->rxg1Compensation) != VB_ENGINE_ERROR_NONE)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+
+    if (bgn_measure->mimoInd == TRUE)
+    {
+      if (SnrLinearCachePlaneUpdate(cache, &cache->bgn[1], bgn_measure->measuresRx2, bgn_measure->numMeasures,
+                                    bgn_measure->planID, bgn_measure->rxg2Compensation) != VB_ENGINE_ERROR_NONE)
+      {
+        ret = VB_ENGINE_ERROR_MALLOC;
+      }
+    }
+    else
+    {
+      cache->bgn[1].valid = FALSE;
+    }
+
+    if (cache->numCfr != cfr_measure_list->numCrossMeasures)
+    {
+      SnrLinearCacheCfrRelease(cache);
+
+      if (cfr_measure_list->numCrossMeasures > 0)
+      {
+        cache->cfr = (t_snrLinearPlane *)calloc(cfr_measure_list->numCrossMeasures << 1, sizeof(t_snrLinearPlane));
+
+        if (cache->cfr != NULL)
+        {
+          cache->numCfr = cfr_measure_list->numCrossMeasures;
+        }
+        else
+        {
+          ret = VB_ENGINE_ERROR_MALLOC;
+        }
+      }
+    }
+
+    for (i = 0; i < cache->numCfr; i++)
+    {
+      cfr_measure = &cfr_measure_list->crossMeasureArray[i].measure;
+
+      if (cfr_measure_list->crossMeasureArray[i].ownCFR == TRUE)
+      {
+        // Own CFR is only used in dB
+        cache->cfr[i << 1].valid = FALSE;
+        cache->cfr[(i << 1) + 1].valid = FALSE;
+      }
+      else
+      {
+        if (SnrLinearCachePlaneUpdate(cache, &cache->cfr[i << 1], cfr_measure->measuresRx1, cfr_measure->numMeasures,
+                                      cfr_measure->planID, cfr_measure->rxg1Compensation) != VB_ENGINE_ERROR_NONE)
+        {
+          ret = VB_ENGINE_ERROR_MALLOC;
+        }
+
+        if (SnrLinearCachePlaneUpdate(cache, &cache->cfr[(i << 1) + 1], cfr_measure->measuresRx2, cfr_measure->numMeasures,
+                                      cfr_measure->planID, cfr_measure->rxg2Compensation) != VB_ENGINE_ERROR_NONE)
+        {
+          ret = VB_ENGINE_ERROR_MALLOC;
+        }
+      }
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEngineSnrLinearCacheInvalidate(t_node *node)
+{
+  INT32U i;
+
+  if (node != NULL)
+  {
+    node->snrLinearCache.bgn[0].valid = FALSE;
+    node->snrLinearCache.bgn[1].valid = FALSE;
+
+    for (i = 0; i < (node->snrLinearCache.numCfr << 1); i++)
+    {
+      node->snrLinearCache.cfr[i].valid = FALSE;
+    }
+  }
+}
+
+/*******************************************************************/
+
+void VbEngineSnrLinearCacheRelease(t_snrLinearCache *cache)
+{
+  if (cache != NULL)
+  {
+    SnrLinearCachePlaneRelease(&cache->bgn[0]);
+    SnrLinearCachePlaneRelease(&cache->bgn[1]);
+    SnrLinearCacheCfrRelease(cache);
+  }
+}
+
+/*******************************************************************/
+
+BOOL VbEngineSnrLinearCacheConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  const t_vbEngineSnrLinearCacheConf *conf = VbEngineConfSnrLinearCacheGet();
+  t_snrLinearCacheConsoleArgs         console_args;
+  t_snrLinearCacheClusterStats        total;
+  t_snrLinearCacheClusterStats       *stats;
+  INT32U                              i;
+  CHAR                                hit_rate_str[12];
+
+  memset(&console_args, 0, sizeof(console_args));
+  memset(&total, 0, sizeof(total));
+
+  writeFun("SNR linear cache : %s (bfloat16)\n", (conf->enable == TRUE)?"ENABLED":"DISABLED");
+
+  console_args.maxStats = VbEngineDataModelNumDriversGet();
+
+  if (console_args.maxStats > 0)
+  {
+    console_args.stats = (t_snrLinearCacheClusterStats *)calloc(console_args.maxStats, sizeof(t_snrLinearCacheClusterStats));
+
+    if (console_args.stats == NULL)
+    {
+      writeFun("Error allocating memory!\n");
+    }
+    else
+    {
+      VbEngineDatamodelDriversLoop(SnrLinearCacheConsoleDriverCb, &console_args);
+    }
+  }
+
+  writeFun("==========================================================================\n");
+  writeFun("| Cluster | Nodes | Planes |    Bytes   |    Hits    |   Misses   | Hit %% |\n");
+  writeFun("==========================================================================\n");
+
+  for (i = 0; i <= console_args.numStats; i++)
+  {
+    if (i < console_args.numStats)
+    {
+      stats = &console_args.stats[i];
+
+      total.numNodes += stats->numNodes;
+      total.numPlanes += stats->numPlanes;
+      total.numBytes += stats->numBytes;
+      total.hits += stats->hits;
+      total.misses += stats->misses;
+    }
+    else
+    {
+      writeFun("==========================================================================\n");
+      stats = &total;
+    }
+
+    if ((stats->hits + stats->misses) > 0)
+    {
+      snprintf(hit_rate_str, sizeof(hit_rate_str), "%5.1f", 100.0 * stats->hits / (stats->hits + stats->misses));
+    }
+    else
+    {
+      snprintf(hit_rate_str, sizeof(hit_rate_str), "    -");
+    }
+
+    if (stats == &total)
+    {
+      writeFun("|   Total | %5u | %6u | %10u | %10u | %10u | %s |\n",
+          stats->numNodes, stats->numPlanes, stats->numBytes, stats->hits, stats->misses, hit_rate_str);
+    }
+    else
+    {
+      writeFun("| %7d | %5u | %6u | %10u | %10u | %10u | %s |\n",
+          stats->clusterId, stats->numNodes, stats->numPlanes, stats->numBytes, stats->hits, stats->misses, hit_rate_str);
+    }
+  }
+
+  writeFun("==========================================================================\n");
+
+  if (console_args.stats != NULL)
+  {
+    free(console_args.stats);
+  }
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
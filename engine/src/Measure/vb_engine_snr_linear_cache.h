@@ -0,0 +1,162 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_snr_linear_cache.h
+ * @brief Linear domain cache of BGN and crosstalk measures
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_SNR_LINEAR_CACHE_H_
+#define VB_ENGINE_SNR_LINEAR_CACHE_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <string.h>
+
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  BOOLEAN  enable;                       ///< SNR calculation reads linear values from cache
+} t_vbEngineSnrLinearCacheConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Brings the linear planes of a node up to date with its BGN and CFR measures.
+ * Planes whose measure did not change are reused; the rest are computed again.
+ * Shall be called with driver domains locked, before computing SNR.
+ * If cache is disabled or memory is not available, SNR is computed from log scale measures.
+ * @param[in,out] node Node
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineSnrLinearCacheUpdate(t_node *node);
+
+/**
+ * @brief Invalidates all planes of a node (memory is kept for next measures)
+ * @param[in,out] node Node
+ **/
+void VbEngineSnrLinearCacheInvalidate(t_node *node);
+
+/**
+ * @brief Releases all memory of a node cache
+ * @param[in,out] cache Cache to release
+ **/
+void VbEngineSnrLinearCacheRelease(t_snrLinearCache *cache);
+
+/**
+ * @brief Console command to show cache footprint and hit rate per cluster
+ **/
+BOOL VbEngineSnrLinearCacheConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+/**
+ * @brief Gets the BGN plane of a node
+ * @param[in] node Node
+ * @param[in] rx2 TRUE for Rx2 plane
+ * @return Plane or NULL if not valid
+ **/
+static inline const t_snrLinearPlane *VbEngineSnrLinearCacheBgnGet(const t_node *node, BOOLEAN rx2)
+{
+  const t_snrLinearPlane *plane = &node->snrLinearCache.bgn[(rx2 == TRUE)?1:0];
+
+  return (plane->valid == TRUE)?plane:NULL;
+}
+
+/**
+ * @brief Gets the crosstalk plane of a CFR list entry of a node
+ * @param[in] node Node
+ * @param[in] cfrIdx CFR list index
+ * @param[in] rx2 TRUE for Rx2 plane
+ * @return Plane or NULL if not valid
+ **/
+static inline const t_snrLinearPlane *VbEngineSnrLinearCacheCfrGet(const t_node *node, INT32U cfrIdx, BOOLEAN rx2)
+{
+  const t_snrLinearPlane *plane = NULL;
+
+  if (cfrIdx < node->snrLinearCache.numCfr)
+  {
+    plane = &node->snrLinearCache.cfr[(cfrIdx << 1) + ((rx2 == TRUE)?1:0)];
+
+    if (plane->valid == FALSE)
+    {
+      plane = NULL;
+    }
+  }
+
+  return plane;
+}
+
+/**
+ * @brief Gets a linear value of a plane
+ * @param[in] plane Valid plane
+ * @param[in] idx Measure index
+ * @return Linear power
+ **/
+static inline float VbEngineSnrLinearCacheValueGet(const t_snrLinearPlane *plane, INT32U idx)
+{
+  INT32U bits = ((INT32U)plane->values[idx]) << 16;
+  float  value;
+
+  memcpy(&value, &bits, sizeof(value));
+
+  return value;
+}
+
+#endif /* VB_ENGINE_SNR_LINEAR_CACHE_H_ */
+
+/**
+ * @}
+ **/
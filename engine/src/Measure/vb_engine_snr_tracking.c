@@ -0,0 +1,625 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_snr_tracking.c
+ * @brief SNR probe tracking
+ *
+ * @internal
+ *
+ * A full measure plan stops the traffic of the whole cluster to measure BGN
+ * and every crosstalk path. Between plans, the SNR predicted for each node
+ * (snrFullXtalk) is tracked with SNR probes, which are measured by the node on
+ * live traffic. Every Period, LinesPerRound nodes of the cluster are probed in
+ * rotation, and a capacity degradation reported by traffic reports requests a
+ * probe of the degraded node instead of a new measure plan. When the mean
+ * deficit between predicted and probed SNR exceeds ErrorThr, a new measure
+ * plan is requested (at most once every EscalateHold seconds).
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_mac_utils.h"
+#include "vb_counters.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_drivers_list.h"
+#include "vb_engine_cluster_list.h"
+#include "vb_engine_communication.h"
+#include "vb_engine_process.h"
+#include "vb_engine_snr_tracking.h"
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  INT32U  numEligible;
+  INT32U  idx;                           ///< Rotation index of current eligible node
+  INT32U  first;                         ///< Rotation index of first node to probe
+  INT32U  count;                         ///< Nodes to probe
+  INT8U  *macs;                          ///< MACs of current driver to probe
+  INT32U  numMacs;
+  INT32U  numProbed;
+} t_snrTrackingRoundArgs;
+
+typedef struct
+{
+  t_writeFun writeFun;
+} t_snrTrackingConsoleArgs;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static pthread_mutex_t vbEngineSnrTrackingMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ ************************************************************************
+ ** Private function definition
+ ************************************************************************
+ */
+
+static BOOLEAN SnrTrackingNodeIsEligible(const t_node *node)
+{
+  const t_processMeasure *predicted = &node->measures.snrFullXtalk;
+
+  return ((predicted->errorCode == VB_MEAS_ERRCODE_VALID) &&
+          (predicted->measuresRx1 != NULL) &&
+          (predicted->numMeasures > 0) &&
+          (predicted->spacing > 0))?TRUE:FALSE;
+}
+
+/*******************************************************************/
+
+static void SnrTrackingCarrierAdd(INT8U predicted, INT8U probed, INT32S *sum, INT32U *numCarriers)
+{
+  // Null values are given for masked or unused carriers
+  if ((predicted > 0) && (probed > 0))
+  {
+    *sum += (INT32S)predicted - (INT32S)probed;
+    (*numCarriers)++;
+  }
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode SnrTrackingDeficitGet(const t_processMeasure *predicted, const t_processMeasure *probe, float *deficit)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  BOOLEAN              mimo;
+  INT32S               sum = 0;
+  INT32U               num_carriers = 0;
+  INT32U               carrier;
+  INT32U               idx;
+  INT32U               i;
+
+  if ((predicted == NULL) || (probe == NULL) || (deficit == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if ((probe->errorCode != VB_MEAS_ERRCODE_VALID) || (probe->measuresRx1 == NULL) ||
+           (probe->numMeasures == 0) || (probe->spacing == 0))
+  {
+    ret = VB_ENGINE_ERROR_MEASURE_NODE;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    mimo = ((predicted->mimoInd == TRUE) && (probe->mimoInd == TRUE) &&
+            (predicted->measuresRx2 != NULL) && (probe->measuresRx2 != NULL))?TRUE:FALSE;
+
+    // Both measures are given in quarters of dB, each one on its own carrier grid
+    for (i = 0; i < probe->numMeasures; i++)
+    {
+      carrier = probe->firstCarrier + (i * probe->spacing);
+
+      if (carrier < predicted->firstCarrier)
+      {
+        continue;
+      }
+
+      // Nearest carrier of predicted SNR
+      idx = (carrier - predicted->firstCarrier + (predicted->spacing / 2)) / predicted->spacing;
+      if (idx >= predicted->numMeasures)
+      {
+        break;
+      }
+
+      SnrTrackingCarrierAdd(predicted->measuresRx1[idx], probe->measuresRx1[i], &sum, &num_carriers);
+
+      if (mimo == TRUE)
+      {
+        SnrTrackingCarrierAdd(predicted->measuresRx2[idx], probe->measuresRx2[i], &sum, &num_carriers);
+      }
+    }
+
+    if (num_carriers == 0)
+    {
+      ret = VB_ENGINE_ERROR_NOT_FOUND;
+    }
+    else
+    {
+      *deficit = (float)sum / (4 * num_carriers);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode SnrTrackingCountNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_snrTrackingRoundArgs *round_args = (t_snrTrackingRoundArgs *)args;
+
+  if ((node != NULL) && (round_args != NULL) && (SnrTrackingNodeIsEligible(node) == TRUE))
+  {
+    round_args->numEligible++;
+  }
+
+  return VB_ENGINE_ERROR_NONE;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode SnrTrackingSelectNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_snrTrackingRoundArgs *round_args = (t_snrTrackingRoundArgs *)args;
+
+  if ((node != NULL) && (round_args != NULL) && (SnrTrackingNodeIsEligible(node) == TRUE))
+  {
+    // Selected when inside [first, first + count) of the rotation, taking wrap around into account
+    if ((round_args->numMacs < round_args->count) &&
+        ((((round_args->idx + round_args->numEligible) - round_args->first) % round_args->numEligible) < round_args->count))
+    {
+      memcpy(&round_args->macs[round_args->numMacs * ETH_ALEN], node->MAC, ETH_ALEN);
+      round_args->numMacs++;
+      node->snrTracking.pending = TRUE;
+    }
+
+    round_args->idx++;
+  }
+
+  return VB_ENGINE_ERROR_NONE;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode SnrTrackingRoundDriverCb(t_VBDriver *driver, void *args)
+{
+  t_VB_engineErrorCode    ret = VB_ENGINE_ERROR_NONE;
+  t_snrTrackingRoundArgs *round_args = (t_snrTrackingRoundArgs *)args;
+
+  if ((driver == NULL) || (round_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    round_args->numMacs = 0;
+    ret = VbEngineDatamodelNodesLoop(driver, SnrTrackingSelectNodeCb, round_args);
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (round_args->numMacs > 0))
+  {
+    ret = VbEngineProcessMeasureSnrProbesRequest(round_args->numMacs, round_args->macs, driver);
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      round_args->numProbed += round_args->numMacs;
+      VbCounterIncrease(VB_ENGINE_COUNTER_SNR_TRACKING_PROBES);
+    }
+    else
+    {
+      // Probe responses of other drivers are still useful
+      VbLogPrintExt(VB_LOG_ERROR, driver->vbDriverID, "SNR tracking: error %d requesting %u probes", ret, round_args->numMacs);
+      ret = VB_ENGINE_ERROR_NONE;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static BOOLEAN SnrTrackingEscalationAllowed(INT32U clusterId, INT32U escalateHold)
+{
+  t_VBCluster     *cluster = NULL;
+  t_snrTracking   *tracking;
+  struct timespec  now;
+  BOOLEAN          allowed = FALSE;
+
+  if (VbEngineClusterByIdGet(clusterId, &cluster) == VB_ENGINE_ERROR_NONE)
+  {
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    pthread_mutex_lock(&vbEngineSnrTrackingMutex);
+    tracking = &cluster->snrTracking;
+
+    if ((tracking->numEscalations == 0) ||
+        ((now.tv_sec - tracking->lastEscalation.tv_sec) >= (time_t)escalateHold))
+    {
+      tracking->lastEscalation = now;
+      tracking->numEscalations++;
+      allowed = TRUE;
+    }
+    pthread_mutex_unlock(&vbEngineSnrTrackingMutex);
+  }
+
+  return allowed;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode SnrTrackingConsoleClusterCb(t_VBCluster *cluster, void *args)
+{
+  t_VB_engineErrorCode      ret = VB_ENGINE_ERROR_NONE;
+  t_snrTrackingConsoleArgs *console_args = (t_snrTrackingConsoleArgs *)args;
+  t_snrTracking             tracking;
+
+  if ((cluster == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else
+  {
+    pthread_mutex_lock(&vbEngineSnrTrackingMutex);
+    tracking = cluster->snrTracking;
+    pthread_mutex_unlock(&vbEngineSnrTrackingMutex);
+
+    console_args->writeFun("| %7u | %10u | %10u | %10u | %11u |\n",
+        cluster->clusterInfo.clusterId,
+        tracking.numRounds,
+        tracking.numProbed,
+        tracking.nextNode,
+        tracking.numEscalations);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode SnrTrackingConsoleNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode      ret = VB_ENGINE_ERROR_NONE;
+  t_snrTrackingConsoleArgs *console_args = (t_snrTrackingConsoleArgs *)args;
+  CHAR                      deficit_str[12];
+
+  if ((driver == NULL) || (node == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else
+  {
+    if (node->snrTracking.valid == TRUE)
+    {
+      snprintf(deficit_str, sizeof(deficit_str), "%8.2f", node->snrTracking.deficit);
+    }
+    else
+    {
+      snprintf(deficit_str, sizeof(deficit_str), "%8s", "-");
+    }
+
+    console_args->writeFun("| %-20s | %7u | %2s | %17s | %7s | %8s | %8u | %8u |\n",
+        driver->vbDriverID,
+        driver->clusterId,
+        VbNodeTypeToStr(node->type),
+        node->MACStr,
+        node->snrTracking.pending?"YES":"NO",
+        deficit_str,
+        node->snrTracking.numProbes,
+        node->snrTracking.numOverThr);
+  }
+
+  return ret;
+}
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+t_VB_engineErrorCode VbEngineSnrTrackingRun(INT32U clusterId)
+{
+  t_VB_engineErrorCode             ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineSnrTrackingConf *conf = VbEngineConfSnrTrackingGet();
+  t_VBCluster                     *cluster = NULL;
+  t_snrTrackingRoundArgs           round_args;
+  struct timespec                  now;
+
+  memset(&round_args, 0, sizeof(round_args));
+
+  if (conf->enable == FALSE)
+  {
+    ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineClusterByIdGet(clusterId, &cluster);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    pthread_mutex_lock(&vbEngineSnrTrackingMutex);
+    if ((cluster->snrTracking.numRounds > 0) &&
+        (VbUtilElapsetimeTimespecMs(cluster->snrTracking.lastRound, now) < conf->period))
+    {
+      ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+    }
+    else
+    {
+      cluster->snrTracking.lastRound = now;
+      cluster->snrTracking.numRounds++;
+      round_args.first = cluster->snrTracking.nextNode;
+    }
+    pthread_mutex_unlock(&vbEngineSnrTrackingMutex);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineDatamodelClusterXAllNodesLoop(SnrTrackingCountNodeCb, clusterId, &round_args);
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (round_args.numEligible == 0))
+  {
+    // No SNR predicted yet
+    ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Nodes may have gone since last round
+    round_args.first %= round_args.numEligible;
+    round_args.count = MIN(MIN(conf->linesPerRound, round_args.numEligible), MAX_INT8U);
+
+    round_args.macs = (INT8U *)calloc(round_args.count, ETH_ALEN);
+    if (round_args.macs == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineDatamodelClusterXDriversLoop(SnrTrackingRoundDriverCb, clusterId, &round_args);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbEngineSnrTrackingMutex);
+    cluster->snrTracking.nextNode = (round_args.first + round_args.count) % round_args.numEligible;
+    cluster->snrTracking.numProbed += round_args.numProbed;
+    pthread_mutex_unlock(&vbEngineSnrTrackingMutex);
+  }
+
+  free(round_args.macs);
+
+  if (ret == VB_ENGINE_ERROR_EXIT_LOOP_OK)
+  {
+    ret = VB_ENGINE_ERROR_NONE;
+  }
+  else if (ret != VB_ENGINE_ERROR_NONE)
+  {
+    VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Cluster %u: SNR tracking round error %d", clusterId, ret);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineSnrTrackingDefer(t_VBDriver *driver, const INT8U *mac)
+{
+  t_VB_engineErrorCode             ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineSnrTrackingConf *conf = VbEngineConfSnrTrackingGet();
+  t_node                          *node = NULL;
+
+  if ((driver == NULL) || (mac == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (conf->enable == FALSE)
+  {
+    ret = VB_ENGINE_ERROR_NOT_STARTED;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineDatamodelNodeFind(driver, mac, &node);
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (SnrTrackingNodeIsEligible(node) == FALSE))
+  {
+    // Nothing to compare the probe with
+    ret = VB_ENGINE_ERROR_NOT_READY;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    ret = VbEngineProcessMeasureSnrProbesRequest(1, mac, driver);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    node->snrTracking.pending = TRUE;
+    VbCounterIncrease(VB_ENGINE_COUNTER_SNR_TRACKING_DEFERRED);
+
+    VbLogPrintExt(VB_LOG_INFO, driver->vbDriverID, "%s MAC %s - Capacity degradation, SNR probe requested",
+        VbNodeTypeToStr(node->type), node->MACStr);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineSnrTrackingProbeCheck(t_VBDriver *driver, const INT8U *mac)
+{
+  t_VB_engineErrorCode             ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineSnrTrackingConf *conf = VbEngineConfSnrTrackingGet();
+  t_node                          *node = NULL;
+  float                            deficit = 0;
+  BOOLEAN                          over_thr = FALSE;
+  CHAR                             mac_str[MAC_STR_LEN];
+
+  if ((driver == NULL) || (mac == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (conf->enable == FALSE)
+  {
+    ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_mutex_lock(&(driver->domainsMutex));
+
+    ret = VbEngineDatamodelNodeFind(driver, mac, &node);
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      node->snrTracking.pending = FALSE;
+
+      if (SnrTrackingNodeIsEligible(node) == FALSE)
+      {
+        ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+      }
+      else
+      {
+        ret = SnrTrackingDeficitGet(&node->measures.snrFullXtalk, &node->measures.SNRProbesMeasure, &deficit);
+      }
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      node->snrTracking.valid = TRUE;
+      node->snrTracking.deficit = deficit;
+      node->snrTracking.numProbes++;
+
+      if ((deficit * 100) > conf->errorThr)
+      {
+        node->snrTracking.numOverThr++;
+        over_thr = TRUE;
+      }
+    }
+
+    pthread_mutex_unlock(&(driver->domainsMutex));
+  }
+
+  if ((over_thr == TRUE) && (SnrTrackingEscalationAllowed(driver->clusterId, conf->escalateHold) == TRUE))
+  {
+    MACAddrMem2str(mac_str, mac);
+    VbLogPrintExt(VB_LOG_INFO, driver->vbDriverID, "MAC %s - SNR %.2f dB below prediction, new measure plan requested",
+        mac_str, deficit);
+    VbCounterIncrease(VB_ENGINE_COUNTER_SNR_TRACKING_ESCALATED);
+
+    // EP CHANGE will trigger a new measure plan
+    ret = VbEngineProcessClusterXDriversEvSend(ENGINE_EV_NETWORK_DIFF_EP_CHANGE, NULL, driver->clusterId);
+  }
+
+  if (ret == VB_ENGINE_ERROR_EXIT_LOOP_OK)
+  {
+    ret = VB_ENGINE_ERROR_NONE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOL VbEngineSnrTrackingConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  const t_vbEngineSnrTrackingConf *conf = VbEngineConfSnrTrackingGet();
+  t_snrTrackingConsoleArgs         console_args;
+
+  console_args.writeFun = writeFun;
+
+  writeFun("SNR tracking : %s (period %u ms, %u lines per round, error thr %u.%02u dB, escalate hold %u s)\n",
+      (conf->enable == TRUE)?"ENABLED":"DISABLED",
+      conf->period,
+      conf->linesPerRound,
+      conf->errorThr / 100, conf->errorThr % 100,
+      conf->escalateHold);
+
+  writeFun("==============================================================\n");
+  writeFun("| %7s | %10s | %10s | %10s | %11s |\n",
+      "Cluster", "Rounds", "Probed", "Next node", "Escalations");
+  writeFun("==============================================================\n");
+  VbEngineDatamodelClustersLoop(SnrTrackingConsoleClusterCb, &console_args);
+  writeFun("==============================================================\n");
+
+  writeFun("=================================================================================================================\n");
+  writeFun("| %-20s | %7s | %2s | %17s | %7s | %8s | %8s | %8s |\n",
+      "Driver Id", "Cluster", "Ty", "MAC", "Pending", "Deficit", "Probes", "Over thr");
+  writeFun("=================================================================================================================\n");
+  VbEngineDatamodelAllNodesLoop(SnrTrackingConsoleNodeCb, &console_args);
+  writeFun("=================================================================================================================\n");
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
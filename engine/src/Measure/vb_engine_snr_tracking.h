@@ -0,0 +1,126 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_snr_tracking.h
+ * @brief SNR probe tracking
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_SNR_TRACKING_H_
+#define VB_ENGINE_SNR_TRACKING_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_SNR_TRACKING_DEFAULT_PERIOD              (10000) // ms
+#define VB_ENGINE_SNR_TRACKING_DEFAULT_LINES_PER_ROUND     (4)
+#define VB_ENGINE_SNR_TRACKING_DEFAULT_ERROR_THR           (300)   // Hundredths of dB
+#define VB_ENGINE_SNR_TRACKING_DEFAULT_ESCALATE_HOLD       (300)   // s
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  BOOLEAN  enable;                       ///< Track SNR with probes and defer measure plans
+  INT32U   period;                       ///< Time between tracking rounds (ms)
+  INT32U   linesPerRound;                ///< Nodes probed per round
+  INT32U   errorThr;                     ///< Mean SNR deficit that triggers a measure plan (hundredths of dB)
+  INT32U   escalateHold;                 ///< Minimum time between measure plans requested by tracking (s)
+} t_vbEngineSnrTrackingConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Runs a tracking round if period has elapsed: requests SNR probes
+ * to the next nodes of the cluster.
+ * @param[in] clusterId Cluster Id
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineSnrTrackingRun(INT32U clusterId);
+
+/**
+ * @brief Requests a SNR probe to check a node instead of launching a new measure plan.
+ * Shall be called with driver domains locked.
+ * @param[in] driver Driver
+ * @param[in] mac Node MAC address
+ * @return VB_ENGINE_ERROR_NONE if probe has been requested; otherwise a new measure plan shall be launched
+ **/
+t_VB_engineErrorCode VbEngineSnrTrackingDefer(t_VBDriver *driver, const INT8U *mac);
+
+/**
+ * @brief Compares a received SNR probe with the SNR predicted from last measure plan
+ * and requests a new measure plan if deviation exceeds threshold.
+ * @param[in] driver Driver
+ * @param[in] mac Node MAC address
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineSnrTrackingProbeCheck(t_VBDriver *driver, const INT8U *mac);
+
+/**
+ * @brief Console command to show SNR tracking state
+ **/
+BOOL VbEngineSnrTrackingConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_SNR_TRACKING_H_ */
+
+/**
+ * @}
+ **/
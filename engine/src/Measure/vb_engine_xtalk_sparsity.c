@@ -0,0 +1,563 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_xtalk_sparsity.c
+ * @brief Crosstalk significance analysis
+ *
+ * @internal
+ *
+ * For every PSD band, the margin of a disturber is the highest value of its
+ * crosstalk CFR relative to victim BGN (dB) in the band. Disturbers whose
+ * margin is below -SignificanceThr are sorted by margin and folded while the
+ * sum of their linearized margins (residual) keeps the SNR error under
+ * MaxError. SNR computation then accumulates only the remaining disturbers and
+ * adds the residual to the BGN, so SNR can only be underestimated, never
+ * overestimated, and by at most MaxError.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_xtalk_sparsity.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_XTALK_SPARSITY_MARGIN_MIN                (-1000.0)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  INT16U cfrIdx;
+  float  margin;
+  float  weightRx1;
+  float  weightRx2;
+} t_xtalkCandidate;
+
+typedef struct
+{
+  t_writeFun writeFun;
+  INT32U     numNodes;
+  INT32U     numDisturbers;
+  INT32U     numSignificant;
+} t_xtalkSparsityConsoleArgs;
+
+/*
+ ************************************************************************
+ ** Private function definition
+ ************************************************************************
+ */
+
+static int XtalkCandidateCmp(const void *a, const void *b)
+{
+  const t_xtalkCandidate *cand_a = (const t_xtalkCandidate *)a;
+  const t_xtalkCandidate *cand_b = (const t_xtalkCandidate *)b;
+  int                     ret = 0;
+
+  if (cand_a->margin < cand_b->margin)
+  {
+    ret = -1;
+  }
+  else if (cand_a->margin > cand_b->margin)
+  {
+    ret = 1;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void XtalkSparsityBandsSet(t_xtalkSparsity *sparsity, const t_processMeasure *bgnMeasure)
+{
+  t_psdBandAllocation *bands_allocation = VbEngineConfPSDBandAllocationGet();
+  INT32U               num_bands = 1;
+  INT32U               band_end;
+  INT32U               b;
+
+  if (bands_allocation != NULL)
+  {
+    num_bands = MAX(1, MIN(bands_allocation->numBands200Mhz, VB_PSD_NUM_BANDS));
+  }
+
+  sparsity->numBands = num_bands;
+
+  for (b = 0; b < num_bands; b++)
+  {
+    if (b == (num_bands - 1))
+    {
+      // Last band covers the rest of the spectrum
+      band_end = bgnMeasure->numMeasures;
+    }
+    else if (bands_allocation->lastCarrier[b] < bgnMeasure->firstCarrier)
+    {
+      band_end = 0;
+    }
+    else
+    {
+      band_end = ((bands_allocation->lastCarrier[b] - bgnMeasure->firstCarrier) / bgnMeasure->spacing) + 1;
+      band_end = MIN(band_end, bgnMeasure->numMeasures);
+    }
+
+    if ((b > 0) && (band_end < sparsity->bandEnd[b - 1]))
+    {
+      band_end = sparsity->bandEnd[b - 1];
+    }
+
+    sparsity->bandEnd[b] = band_end;
+  }
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Gets the highest difference (quarters of dB, before rx gain compensation) between a crosstalk CFR and BGN
+ * @param[in] bgn BGN values
+ * @param[in] xtalk Crosstalk CFR values
+ * @param[in] first First measure index
+ * @param[in] last First measure index out of range
+ * @param[in] step Measure index increment
+ * @param[in] numValues Crosstalk values per BGN value (2 for MIMO disturbers of MIMO victims)
+ * @return Highest difference
+ **/
+static INT32S XtalkSparsityMaxDiffGet(const INT8U *bgn, const INT8U *xtalk, INT32U first, INT32U last,
+                                      INT32U step, INT32U numValues)
+{
+  INT32S max_diff = -MAX_INT8U;
+  INT32U c;
+  INT32U v;
+
+  // Integer domain keeps this loop cheap compared with SNR accumulation
+  for (c = first; c < last; c += step)
+  {
+    for (v = 0; v < numValues; v++)
+    {
+      max_diff = MAX(max_diff, (INT32S)xtalk[c + v] - (INT32S)bgn[c]);
+    }
+  }
+
+  return max_diff;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Gets the highest crosstalk to BGN ratio (dB) of a disturber in a range of measures
+ * @param[in] bgnMeasure Victim BGN
+ * @param[in] xtalk Disturber crosstalk CFR
+ * @param[in] first First measure index
+ * @param[in] last First measure index out of range
+ * @param[out] marginRx1 Margin in Rx1
+ * @param[out] marginRx2 Margin in Rx2 (only MIMO victims)
+ * @return TRUE if disturber contributes in given range; FALSE otherwise
+ **/
+static BOOLEAN XtalkSparsityMarginGet(const t_processMeasure *bgnMeasure, const t_processMeasure *xtalk,
+                                      INT32U first, INT32U last, float *marginRx1, float *marginRx2)
+{
+  BOOLEAN found = FALSE;
+  INT32U  step = (bgnMeasure->mimoInd == TRUE)?2:1;
+  INT32U  num_values = ((bgnMeasure->mimoInd == TRUE) && (xtalk->mimoMeas == TRUE))?2:1;
+  INT32S  max_diff;
+
+  *marginRx1 = VB_XTALK_SPARSITY_MARGIN_MIN;
+  *marginRx2 = VB_XTALK_SPARSITY_MARGIN_MIN;
+
+  last = MIN(last, xtalk->carrierGridIdxCutProfile);
+  last = MIN(last, (INT32U)(xtalk->numMeasures + 1 - num_values));
+
+  if (bgnMeasure->mimoInd == TRUE)
+  {
+    // Measures of MIMO victims are computed on even indexes
+    first = (first + 1) & ~1U;
+  }
+
+  if (first < last)
+  {
+    if (xtalk->measuresRx1 != NULL)
+    {
+      max_diff = XtalkSparsityMaxDiffGet(bgnMeasure->measuresRx1, xtalk->measuresRx1, first, last, step, num_values);
+      *marginRx1 = ((float)max_diff / 4) - xtalk->rxg1Compensation + bgnMeasure->rxg1Compensation;
+      found = TRUE;
+    }
+
+    if ((bgnMeasure->mimoInd == TRUE) && (xtalk->measuresRx2 != NULL))
+    {
+      max_diff = XtalkSparsityMaxDiffGet(bgnMeasure->measuresRx2, xtalk->measuresRx2, first, last, step, num_values);
+      *marginRx2 = ((float)max_diff / 4) - xtalk->rxg2Compensation + bgnMeasure->rxg2Compensation;
+      found = TRUE;
+    }
+  }
+
+  return found;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode XtalkSparsityBandAnalyze(t_xtalkSparsity *sparsity, const t_processMeasure *bgnMeasure,
+                                                     const t_crossMeasureList *cfrMeasureList, INT32U band,
+                                                     t_xtalkCandidate *candidates, float significanceThr, float budget)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  const t_crossMeasure *cfr_cross_measure;
+  INT16U               *row = &sparsity->cfrIdx[band * sparsity->numCrossMeasures];
+  INT32U                first = (band == 0)?0:sparsity->bandEnd[band - 1];
+  INT32U                last = sparsity->bandEnd[band];
+  INT32U                num_row = 0;
+  INT32U                num_candidates = 0;
+  INT32U                num_significant = 0;
+  INT32U                i;
+  float                 weight;
+  float                 margin_rx1;
+  float                 margin_rx2;
+  float                 residual_rx1 = 0;
+  float                 residual_rx2 = 0;
+
+  for (i = 0; i < cfrMeasureList->numCrossMeasures; i++)
+  {
+    cfr_cross_measure = &cfrMeasureList->crossMeasureArray[i];
+
+    if (cfr_cross_measure->ownCFR == TRUE)
+    {
+      row[num_row++] = i;
+    }
+    else if (XtalkSparsityMarginGet(bgnMeasure, &cfr_cross_measure->measure, first, last, &margin_rx1, &margin_rx2) == TRUE)
+    {
+      if (MAX(margin_rx1, margin_rx2) <= -significanceThr)
+      {
+        // Each carrier of a MIMO CFR adds its crosstalk twice to the victim
+        weight = ((bgnMeasure->mimoInd == TRUE) && (cfr_cross_measure->measure.mimoMeas == TRUE))?2:1;
+
+        candidates[num_candidates].cfrIdx = i;
+        candidates[num_candidates].margin = MAX(margin_rx1, margin_rx2);
+        candidates[num_candidates].weightRx1 = weight * powf(10, margin_rx1 / 10);
+        candidates[num_candidates].weightRx2 = weight * powf(10, margin_rx2 / 10);
+        num_candidates++;
+      }
+      else
+      {
+        row[num_row++] = i;
+        num_significant++;
+      }
+    }
+    // else: disturber has no crosstalk in this band, nothing to accumulate
+  }
+
+  // Fold weakest disturbers first while error budget allows it
+  qsort(candidates, num_candidates, sizeof(t_xtalkCandidate), XtalkCandidateCmp);
+
+  for (i = 0; i < num_candidates; i++)
+  {
+    if (((residual_rx1 + candidates[i].weightRx1) <= budget) &&
+        ((residual_rx2 + candidates[i].weightRx2) <= budget))
+    {
+      residual_rx1 += candidates[i].weightRx1;
+      residual_rx2 += candidates[i].weightRx2;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  for (; i < num_candidates; i++)
+  {
+    row[num_row++] = candidates[i].cfrIdx;
+    num_significant++;
+  }
+
+  sparsity->numCfrIdx[band] = num_row;
+  sparsity->numSignificant[band] = num_significant;
+  sparsity->residualRx1[band] = residual_rx1;
+  sparsity->residualRx2[band] = residual_rx2;
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode XtalkSparsityConsoleNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode        ret = VB_ENGINE_ERROR_NONE;
+  t_xtalkSparsityConsoleArgs *console_args = (t_xtalkSparsityConsoleArgs *)args;
+  t_xtalkSparsity            *sparsity;
+  INT32U                      num_significant = 0;
+  INT32U                      b;
+  float                       residual = 0;
+  CHAR                        bands_str[VB_PSD_NUM_BANDS * 6 + 1];
+
+  if ((driver == NULL) || (node == NULL) || (console_args == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (node->xtalkSparsity.valid == TRUE)
+  {
+    sparsity = &node->xtalkSparsity;
+
+    bands_str[0] = '\0';
+    for (b = 0; b < sparsity->numBands; b++)
+    {
+      snprintf(bands_str + strlen(bands_str), sizeof(bands_str) - strlen(bands_str), "%5u ", sparsity->numSignificant[b]);
+      num_significant += sparsity->numSignificant[b];
+      residual = MAX(residual, sparsity->residualRx1[b]);
+      residual = MAX(residual, sparsity->residualRx2[b]);
+    }
+
+    console_args->writeFun("| %17s | %2s | %10u | %-60s | %8.1f%% | %9.3f |\n",
+        node->MACStr,
+        VbNodeTypeToStr(node->type),
+        sparsity->numDisturbers,
+        bands_str,
+        (sparsity->numDisturbers > 0)?
+            (100.0 * (1.0 - ((float)num_significant / (sparsity->numDisturbers * sparsity->numBands)))):0.0,
+        10 * log10(1 + residual));
+
+    console_args->numNodes++;
+    console_args->numDisturbers += sparsity->numDisturbers * sparsity->numBands;
+    console_args->numSignificant += num_significant;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode XtalkSparsityConsoleDriverCb(t_VBDriver *driver, void *args)
+{
+  return VbEngineDatamodelNodesLoop(driver, XtalkSparsityConsoleNodeCb, args);
+}
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+t_VB_engineErrorCode VbEngineXtalkSparsityAnalyze(t_VBDriver *driver, t_node *node)
+{
+  t_VB_engineErrorCode               ret = VB_ENGINE_ERROR_NONE;
+  const t_vbEngineXtalkSparsityConf *conf = VbEngineConfXtalkSparsityGet();
+  t_xtalkSparsity                   *sparsity;
+  const t_processMeasure            *bgn_measure;
+  const t_crossMeasureList          *cfr_measure_list;
+  t_xtalkCandidate                  *candidates = NULL;
+  INT32U                             cfr_idx_size;
+  INT32U                             i;
+  INT32U                             b;
+  float                              budget;
+
+  if ((driver == NULL) || (node == NULL) || (conf == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    sparsity = &node->xtalkSparsity;
+    bgn_measure = &node->measures.BGNMeasure;
+    cfr_measure_list = &node->measures.CFRMeasureList;
+
+    sparsity->valid = FALSE;
+
+    if ((conf->enable == FALSE) ||
+        (bgn_measure->measuresRx1 == NULL) ||
+        ((bgn_measure->mimoInd == TRUE) && (bgn_measure->measuresRx2 == NULL)) ||
+        (bgn_measure->numMeasures == 0) ||
+        (bgn_measure->spacing == 0) ||
+        ((bgn_measure->flags & 0x01) != 0) ||
+        (cfr_measure_list->crossMeasureArray == NULL) ||
+        (cfr_measure_list->numCrossMeasures == 0))
+    {
+      // Nothing to analyse, SNR will be computed with all disturbers
+      ret = VB_ENGINE_ERROR_EXIT_LOOP_OK;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    XtalkSparsityBandsSet(sparsity, bgn_measure);
+
+    sparsity->numCrossMeasures = cfr_measure_list->numCrossMeasures;
+    cfr_idx_size = sparsity->numBands * sparsity->numCrossMeasures;
+
+    if (sparsity->cfrIdxSize < cfr_idx_size)
+    {
+      INT16U *cfr_idx = (INT16U *)realloc(sparsity->cfrIdx, cfr_idx_size * sizeof(INT16U));
+
+      if (cfr_idx != NULL)
+      {
+        sparsity->cfrIdx = cfr_idx;
+        sparsity->cfrIdxSize = cfr_idx_size;
+      }
+      else
+      {
+        ret = VB_ENGINE_ERROR_MALLOC;
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    candidates = (t_xtalkCandidate *)malloc(sparsity->numCrossMeasures * sizeof(t_xtalkCandidate));
+
+    if (candidates == NULL)
+    {
+      ret = VB_ENGINE_ERROR_MALLOC;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Highest linear residual keeping SNR error under MaxError (hundredths of dB)
+    budget = powf(10, (float)conf->maxError / 1000) - 1;
+
+    sparsity->numDisturbers = 0;
+    for (i = 0; i < cfr_measure_list->numCrossMeasures; i++)
+    {
+      if (cfr_measure_list->crossMeasureArray[i].ownCFR == FALSE)
+      {
+        sparsity->numDisturbers++;
+      }
+    }
+
+    for (b = 0; (b < sparsity->numBands) && (ret == VB_ENGINE_ERROR_NONE); b++)
+    {
+      ret = XtalkSparsityBandAnalyze(sparsity, bgn_measure, cfr_measure_list, b, candidates,
+                                     (float)conf->significanceThr, budget);
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      sparsity->valid = TRUE;
+    }
+  }
+
+  free(candidates);
+
+  if (ret == VB_ENGINE_ERROR_EXIT_LOOP_OK)
+  {
+    ret = VB_ENGINE_ERROR_NONE;
+  }
+  else if ((ret != VB_ENGINE_ERROR_NONE) && (driver != NULL) && (node != NULL))
+  {
+    VbLogPrintExt(VB_LOG_ERROR, driver->vbDriverID, "%s MAC %s - Crosstalk sparsity analysis error %d",
+        VbNodeTypeToStr(node->type), node->MACStr, ret);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbEngineXtalkMarginGet(const t_processMeasure *bgnMeasure, const t_processMeasure *xtalk, float *margin)
+{
+  BOOLEAN found = FALSE;
+  float   margin_rx1;
+  float   margin_rx2;
+
+  if ((bgnMeasure != NULL) && (xtalk != NULL) && (margin != NULL) &&
+      (bgnMeasure->measuresRx1 != NULL) &&
+      ((bgnMeasure->mimoInd == FALSE) || (bgnMeasure->measuresRx2 != NULL)))
+  {
+    found = XtalkSparsityMarginGet(bgnMeasure, xtalk, 0, bgnMeasure->numMeasures, &margin_rx1, &margin_rx2);
+    *margin = MAX(margin_rx1, margin_rx2);
+  }
+
+  return found;
+}
+
+/*******************************************************************/
+
+BOOL VbEngineXtalkSparsityConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  const t_vbEngineXtalkSparsityConf *conf = VbEngineConfXtalkSparsityGet();
+  t_xtalkSparsityConsoleArgs         console_args;
+
+  memset(&console_args, 0, sizeof(console_args));
+  console_args.writeFun = writeFun;
+
+  writeFun("Crosstalk sparsity : %s (threshold %u dB, max error %u.%02u dB)\n",
+      (conf->enable == TRUE)?"ENABLED":"DISABLED",
+      conf->significanceThr,
+      conf->maxError / 100, conf->maxError % 100);
+
+  writeFun("======================================================================================================================================\n");
+  writeFun("|        MAC        | Ty | Disturbers | Significant disturbers per band                              | Sparsity  | Bound(dB) |\n");
+  writeFun("======================================================================================================================================\n");
+
+  VbEngineDatamodelDriversLoop(XtalkSparsityConsoleDriverCb, &console_args);
+
+  writeFun("======================================================================================================================================\n");
+
+  if (console_args.numDisturbers > 0)
+  {
+    writeFun("Nodes %u; significant pairs %u of %u (sparsity %.1f%%)\n",
+        console_args.numNodes,
+        console_args.numSignificant,
+        console_args.numDisturbers,
+        100.0 * (1.0 - ((float)console_args.numSignificant / console_args.numDisturbers)));
+  }
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
@@ -0,0 +1,122 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_xtalk_sparsity.h
+ * @brief Crosstalk significance analysis
+ *
+ * @internal
+ *
+ * After each plan, (victim, disturber) pairs are classified per PSD band by
+ * their coupling relative to victim BGN. Only significant disturbers are
+ * accumulated in SNR computation; the rest are folded into a per band
+ * residual term bounded by a configurable SNR error.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_XTALK_SPARSITY_H_
+#define VB_ENGINE_XTALK_SPARSITY_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_datamodel.h"
+#include "vb_engine_drivers_list.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_XTALK_SPARSITY_DEFAULT_THR           (20)   // dB below BGN
+#define VB_ENGINE_XTALK_SPARSITY_DEFAULT_MAX_ERROR     (25)   // Hundredths of dB
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  BOOLEAN  enable;
+  INT32U   significanceThr;              ///< Disturbers coupling this many dB below BGN (or more) can be folded
+  INT32U   maxError;                     ///< Maximum SNR underestimation allowed per band (hundredths of dB)
+} t_vbEngineXtalkSparsityConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Classifies the crosstalk CFRs of a node per band and builds its sparse disturbers lists.
+ * Shall be called once BGN and CFR measures of a plan are available and before computing SNR.
+ * If feature is disabled or measures are not suitable, sparsity info is invalidated and
+ * SNR is computed with all disturbers.
+ * @param[in] driver Driver of node
+ * @param[in,out] node Victim node
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineXtalkSparsityAnalyze(t_VBDriver *driver, t_node *node);
+
+/**
+ * @brief Gets the highest crosstalk to BGN ratio of a disturber over the whole spectrum
+ * @param[in] bgnMeasure Victim BGN (log scale)
+ * @param[in] xtalk Disturber crosstalk CFR (log scale)
+ * @param[out] margin Highest crosstalk to BGN ratio (dB) among all carriers and receivers
+ * @return TRUE if disturber adds noise to the victim; FALSE otherwise
+ **/
+BOOLEAN VbEngineXtalkMarginGet(const t_processMeasure *bgnMeasure, const t_processMeasure *xtalk, float *margin);
+
+/**
+ * @brief Console command to show crosstalk sparsity per node
+ **/
+BOOL VbEngineXtalkSparsityConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_XTALK_SPARSITY_H_ */
+
+/**
+ * @}
+ **/
@@ -76,6 +76,7 @@
 #include "vb_engine_psd_shape.h"
 #include "vb_engine_cdta.h"
 #include "vb_engine_process.h"
+#include "vb_engine_traffic_forecast.h"
 
 
 /*
@@ -244,6 +245,7 @@ static t_VB_engineErrorCode    VbEngineDomainsRespProcess(INT8U* payload, INT32U
             domains_list.domainsArray[i].dm.channelSettings.psdShape.sendUpdate = FALSE;
 
             memset(&domains_list.domainsArray[i].dm.channelSettings.boostInfo, 0, sizeof(t_boostInfo));
+            memset(&domains_list.domainsArray[i].dm.channelSettings.cfgSync, 0, sizeof(t_nodeCfgSync));
             domains_list.domainsArray[i].dm.channelSettings.interferenceDetectionCounter = 0;
 
             memset(&domains_list.domainsArray[i].dm.cdtaInfo, 0, sizeof(t_nodeCdtaInfo));
@@ -322,6 +324,7 @@ static t_VB_engineErrorCode    VbEngineDomainsRespProcess(INT8U* payload, INT32U
                   domains_list.domainsArray[i].eps.epsArray[j].channelSettings.psdShape.numPSDBands = 0;
                   domains_list.domainsArray[i].eps.epsArray[j].channelSettings.psdShape.sendUpdate = FALSE;
                   memset(&domains_list.domainsArray[i].eps.epsArray[j].channelSettings.boostInfo, 0, sizeof(t_boostInfo));
+                  memset(&domains_list.domainsArray[i].eps.epsArray[j].channelSettings.cfgSync, 0, sizeof(t_nodeCfgSync));
                   domains_list.domainsArray[i].eps.epsArray[j].channelSettings.interferenceDetectionCounter = 0;
 
                   // Init Traffic report
@@ -954,6 +957,7 @@ static t_VB_engineErrorCode VbEngineTrafficAwarenessTrgProcess(INT8U* payload, I
         }
 
         traffic_report->neededL2Xput = l2_xput;
+        VbEngineTrafficForecastUpdate(traffic_report);
         traffic_report->macEfficiency = traffic_report_rsp->macEfficiency;
         traffic_report->nBandsBps = _ntohs(traffic_bps_report->nBands);
         memset(traffic_report->bpsBand, 0x0, sizeof(traffic_report->bpsBand));
@@ -970,7 +974,7 @@ static t_VB_engineErrorCode VbEngineTrafficAwarenessTrgProcess(INT8U* payload, I
         nodeChannelSettings = VbEngineChannelCapacityPtrGet(traffic_report_rsp->MAC,  &found, thisDriver);
         if ((found == TRUE) && (nodeChannelSettings != NULL))
         {
-          vb_err = VbEngineSnrCalculatedCheck(traffic_report, nodeChannelSettings, thisDriver);
+          vb_err = VbEngineSnrCalculatedCheck(traffic_report, nodeChannelSettings, thisDriver, traffic_report_rsp->MAC);
           if(vb_err == VB_ENGINE_ERROR_NONE)
           {
             if (traffic_report->nBandsBps > 0)
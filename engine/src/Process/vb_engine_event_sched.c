@@ -0,0 +1,849 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost_engine
+ * @{
+ **/
+
+/**
+ * @file vb_engine_event_sched.c
+ * @brief Engine process event scheduler
+ *
+ * @internal
+ *
+ * Events sent to engine process are queued in one FIFO per class instead of
+ * a single queue, so that a burst of measure responses does not delay an
+ * alignment or a timeout event. Engine process thread serves the classes
+ * in weighted round robin: each turn a class dispatches up to Weight events
+ * before moving to the next class with events pending.
+ *
+ * When a class reaches MaxDepth, producers block until engine process
+ * dispatches one of its events (backpressure towards EA sockets and timers).
+ * Events sent by engine process thread itself are never blocked; they are
+ * the next steps of the FSM and they are queued in the control class, in
+ * the order they were sent, whatever their event type.
+ *
+ * Ordering is kept within a class. Across classes it is kept around driver
+ * lifecycle events (connect, disconnect and kill) and timeout events: they
+ * are not dispatched while an older event of the same driver (or of any
+ * driver, for events targeting all drivers) is pending in another class, so
+ * the FSM never handles a timeout before a response queued earlier.
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_counters.h"
+#include "vb_ea_communication.h"
+#include "vb_engine_event_sched.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define VB_EVENT_SCHED_FREE_NODES_MAX               (512)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct s_eventSchedNode
+{
+  t_VBProcessMsg           msg;
+  INT64U                   seq;
+  struct timespec          queuedTs;
+  struct s_eventSchedNode *next;
+} t_eventSchedNode;
+
+typedef struct
+{
+  INT32U   queued;
+  INT32U   dispatched;
+  INT32U   peakDepth;
+  INT32U   blocked;
+  INT32U   overflow;
+  INT64U   waitSum;                      // us
+  INT32U   waitMax;                      // us
+} t_eventSchedStats;
+
+typedef struct
+{
+  t_eventSchedNode  *head;
+  t_eventSchedNode  *tail;
+  INT32U             depth;
+  INT32U             credit;
+  t_eventSchedStats  stats;
+} t_eventSchedQueue;
+
+typedef struct
+{
+  pthread_mutex_t           mutex;
+  pthread_cond_t            notEmpty;
+  pthread_cond_t            notFull;
+  BOOLEAN                   accepting;
+  BOOLEAN                   consumerSet;
+  pthread_t                 consumer;
+  t_vbEngineEventSchedConf  conf;
+  t_eventSchedQueue         queues[VB_ENGINE_EVENT_CLASS_LAST];
+  t_vbEngineEventClass      cursor;
+  INT32U                    pending;
+  INT64U                    seq;
+  INT32U                    barrierDrains;
+  t_eventSchedNode         *freeNodes;
+  INT32U                    numFreeNodes;
+} t_eventSched;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static t_eventSched vbEngineEventSched =
+{
+  .mutex    = PTHREAD_MUTEX_INITIALIZER,
+  .notEmpty = PTHREAD_COND_INITIALIZER,
+  .notFull  = PTHREAD_COND_INITIALIZER,
+};
+
+static const CHAR *vbEngineEventClassString[VB_ENGINE_EVENT_CLASS_LAST] =
+{
+  "control",
+  "alignment",
+  "timeout",
+  "measure",
+  "telemetry",
+};
+
+/*
+ ************************************************************************
+ ** Private function definition
+ ************************************************************************
+ */
+
+static BOOLEAN EventSchedIsBarrier(t_VB_Comm_Event event)
+{
+  BOOLEAN barrier;
+
+  switch (event)
+  {
+    case ENGINE_EV_KILL_ALL:
+    case ENGINE_EV_KILL:
+    case ENGINE_EV_CONNECT:
+    case ENGINE_EV_DISCONNECT:
+    {
+      barrier = TRUE;
+      break;
+    }
+
+    default:
+    {
+      // A timeout shall not overtake a response queued before it
+      barrier = (VbEngineEventClassGet(event) == VB_ENGINE_EVENT_CLASS_TIMEOUT)?TRUE:FALSE;
+      break;
+    }
+  }
+
+  return barrier;
+}
+
+/*******************************************************************/
+
+static BOOLEAN EventSchedIsConsumer(void)
+{
+  return ((vbEngineEventSched.consumerSet == TRUE) &&
+          (pthread_equal(pthread_self(), vbEngineEventSched.consumer) != 0))?TRUE:FALSE;
+}
+
+/*******************************************************************/
+
+static void EventSchedNodeRelease(t_eventSchedNode *node)
+{
+  if (vbEngineEventSched.numFreeNodes < VB_EVENT_SCHED_FREE_NODES_MAX)
+  {
+    node->next = vbEngineEventSched.freeNodes;
+    vbEngineEventSched.freeNodes = node;
+    vbEngineEventSched.numFreeNodes++;
+  }
+  else
+  {
+    free(node);
+  }
+}
+
+/*******************************************************************/
+
+static t_eventSchedNode *EventSchedNodeGet(void)
+{
+  t_eventSchedNode *node = vbEngineEventSched.freeNodes;
+
+  if (node != NULL)
+  {
+    vbEngineEventSched.freeNodes = node->next;
+    vbEngineEventSched.numFreeNodes--;
+  }
+  else
+  {
+    node = (t_eventSchedNode *)malloc(sizeof(t_eventSchedNode));
+  }
+
+  return node;
+}
+
+/*******************************************************************/
+
+/*
+ * Looks for the class to serve before a barrier event: the one whose head
+ * is the oldest pending event among those queued before the barrier event
+ * and belonging to the same driver (any driver if it targets all drivers).
+ */
+static BOOLEAN EventSchedBarrierClassGet(t_vbEngineEventClass barrierClass, t_vbEngineEventClass *eventClass)
+{
+  const t_eventSchedNode *barrier = vbEngineEventSched.queues[barrierClass].head;
+  const t_eventSchedNode *node;
+  BOOLEAN                 found = FALSE;
+  INT64U                  oldest = 0;
+  INT32U                  i;
+
+  for (i = 0; i < VB_ENGINE_EVENT_CLASS_LAST; i++)
+  {
+    if (i != barrierClass)
+    {
+      for (node = vbEngineEventSched.queues[i].head; (node != NULL) && (node->seq < barrier->seq); node = node->next)
+      {
+        if ((barrier->msg.senderDriver == NULL) || (node->msg.senderDriver == barrier->msg.senderDriver))
+        {
+          if ((found == FALSE) || (vbEngineEventSched.queues[i].head->seq < oldest))
+          {
+            oldest = vbEngineEventSched.queues[i].head->seq;
+            *eventClass = (t_vbEngineEventClass)i;
+            found = TRUE;
+          }
+
+          break;
+        }
+      }
+    }
+  }
+
+  return found;
+}
+
+/*******************************************************************/
+
+static t_vbEngineEventClass EventSchedClassPick(void)
+{
+  t_eventSchedQueue    *queue;
+  t_vbEngineEventClass  picked;
+  BOOLEAN               found = FALSE;
+  INT32U                i;
+
+  // Weighted round robin; pending > 0 guarantees a class is found within one round
+  for (i = 0; (i <= VB_ENGINE_EVENT_CLASS_LAST) && (found == FALSE); i++)
+  {
+    queue = &vbEngineEventSched.queues[vbEngineEventSched.cursor];
+
+    if ((queue->depth > 0) && (queue->credit > 0))
+    {
+      found = TRUE;
+    }
+    else
+    {
+      queue->credit = 0;
+      vbEngineEventSched.cursor = (vbEngineEventSched.cursor + 1) % VB_ENGINE_EVENT_CLASS_LAST;
+      vbEngineEventSched.queues[vbEngineEventSched.cursor].credit =
+          vbEngineEventSched.conf.classes[vbEngineEventSched.cursor].weight;
+    }
+  }
+
+  picked = vbEngineEventSched.cursor;
+  queue = &vbEngineEventSched.queues[picked];
+
+  if ((EventSchedIsBarrier(queue->head->msg.vbCommEvent) == TRUE) &&
+      (EventSchedBarrierClassGet(picked, &picked) == TRUE))
+  {
+    // Older events go first; turn credit is not consumed
+    vbEngineEventSched.barrierDrains++;
+  }
+  else
+  {
+    queue->credit--;
+  }
+
+  return picked;
+}
+
+/*******************************************************************/
+
+static void EventSchedStatsReset(void)
+{
+  INT32U i;
+
+  for (i = 0; i < VB_ENGINE_EVENT_CLASS_LAST; i++)
+  {
+    memset(&vbEngineEventSched.queues[i].stats, 0, sizeof(t_eventSchedStats));
+    vbEngineEventSched.queues[i].stats.peakDepth = vbEngineEventSched.queues[i].depth;
+  }
+
+  vbEngineEventSched.barrierDrains = 0;
+}
+
+/*******************************************************************/
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+t_vbEngineEventClass VbEngineEventClassGet(t_VB_Comm_Event event)
+{
+  t_vbEngineEventClass event_class;
+
+  switch (event)
+  {
+    case ENGINE_EV_ALIGN_CHECK_RESTART:
+    case ENGINE_EV_ALIGN_PERIODIC_CHECK:
+    case ENGINE_EV_ALIGN_CHECK:
+    case ENGINE_EV_ALIGN_ALL_CLUSTERS:
+    case ENGINE_EV_ALIGN_CLUSTER_I:
+    case ENGINE_EV_ALIGN_DONE:
+    case ENGINE_EV_ALIGN_DONE_SKIP_MEAS:
+    case ENGINE_EV_ALIGN_CHANGE:
+    case ENGINE_EV_ALIGN_CHANGE_SYNC:
+    case ENGINE_EV_ALIGN_WAIT:
+    case ENGINE_EV_ALIGN_RESTART:
+    case ENGINE_EV_ALIGN_CONF_SYNC:
+    case ENGINE_EV_CLOCK_REQ:
+    case ENGINE_EV_CLOCK_REQ_SYNC:
+    case ENGINE_EV_CLOCK_FORCE_REQ:
+    case ENGINE_EV_RX_CYCQUERY_RSP:
+    case ENGINE_EV_RX_CYCQUERY_RSP_KO:
+    case ENGINE_EV_RX_CYCQUERY_RSP_INV:
+    case ENGINE_EV_RX_CYCCHANGE_RSP:
+    case ENGINE_EV_RX_CYCCHANGE_RSP_KO:
+    case ENGINE_EV_RX_CLOCK_RSP:
+    case ENGINE_EV_RX_ALIGNMODE_RSP:
+    case ENGINE_EV_RX_ALIGNMODE_RSP_KO:
+    case ENGINE_EV_RX_ALIGN_SYNC_LOST_TRG:
+    case ENGINE_EV_RX_ALIGN_CLUSTER_STOP_RSP:
+    case ENGINE_EV_RX_ALIGN_CLUSTERS_ALL_STOP_SYNC:
+    case ENGINE_EV_RX_ALIGN_CLUSTER_I_STOP_SYNC:
+    case ENGINE_EV_RX_ALIGN_CLUSTER_STOP_FAIL:
+    {
+      event_class = VB_ENGINE_EVENT_CLASS_ALIGNMENT;
+      break;
+    }
+
+    case ENGINE_EV_DISC_VERS_TO:
+    case ENGINE_EV_DISC_STATE_TO:
+    case ENGINE_EV_DOMAINS_SYNC_TO:
+    case ENGINE_EV_CLOCK_RSP_TO:
+    case ENGINE_EV_ALIGN_CHECK_TO:
+    case ENGINE_EV_ALIGN_CHANGE_TO:
+    case ENGINE_EV_ALIGN_SYNC_TO:
+    case ENGINE_EV_MEASPLAN_RSP_TO:
+    case ENGINE_EV_MEAS_COMPLETE_TO:
+    case ENGINE_EV_MEAS_COLLECT_TO:
+    case ENGINE_EV_MEASPLAN_CANCEL_TO:
+    case ENGINE_EV_BOOST_UPDATE_END_TO:
+    case ENGINE_EV_BOOST_ALG_RUN_TO:
+    case ENGINE_EV_ALIGN_CONF_TO:
+    case ENGINE_EV_RX_ALIGN_CLUSTER_STOP_TO:
+    {
+      event_class = VB_ENGINE_EVENT_CLASS_TIMEOUT;
+      break;
+    }
+
+    case ENGINE_EV_MEASPLAN_FAIL:
+    case ENGINE_EV_MEASPLAN_RSP_SYNC:
+    case ENGINE_EV_MEASURE_END_SYNC:
+    case ENGINE_EV_MEAS_COLLECT_END_NO_LINES:
+    case ENGINE_EV_MEASPLAN_RESTART:
+    case ENGINE_EV_MEASPLAN_BUILD:
+    case ENGINE_EV_MEASPLAN_CANCEL_END_SYNC:
+    case ENGINE_EV_RX_MEASPLAN_RSP:
+    case ENGINE_EV_RX_MEASPLAN_CANCEL_RSP:
+    case ENGINE_EV_RX_MEASPLAN_ERR_TRG:
+    case ENGINE_EV_RX_MEASURE_BGN_RSP:
+    case ENGINE_EV_RX_MEASURE_CFR_RSP:
+    case ENGINE_EV_RX_MEAS_COLLECT_END_TRG:
+    case ENGINE_EV_RX_MEASURE_SNRPROBES_RSP:
+    {
+      event_class = VB_ENGINE_EVENT_CLASS_MEASURE;
+      break;
+    }
+
+    case ENGINE_EV_RX_TRAFFIC_AWARENESS_TRG:
+    case ENGINE_EV_RX_CDTA_RSP:
+    {
+      event_class = VB_ENGINE_EVENT_CLASS_TELEMETRY;
+      break;
+    }
+
+    default:
+    {
+      event_class = VB_ENGINE_EVENT_CLASS_CONTROL;
+      break;
+    }
+  }
+
+  return event_class;
+}
+
+/*******************************************************************/
+
+const CHAR *VbEngineEventClassToStr(t_vbEngineEventClass eventClass)
+{
+  const CHAR *ret = "--";
+
+  if (eventClass < VB_ENGINE_EVENT_CLASS_LAST)
+  {
+    ret = vbEngineEventClassString[eventClass];
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOLEAN VbEngineEventSchedConfCheck(const t_vbEngineEventSchedConf *conf)
+{
+  BOOLEAN valid = TRUE;
+  INT32U  i;
+
+  if (conf == NULL)
+  {
+    valid = FALSE;
+  }
+
+  for (i = 0; (i < VB_ENGINE_EVENT_CLASS_LAST) && (valid == TRUE); i++)
+  {
+    if ((conf->classes[i].weight < 1) ||
+        (conf->classes[i].weight > VB_ENGINE_EVENT_SCHED_MAX_WEIGHT) ||
+        (conf->classes[i].maxDepth < 1) ||
+        (conf->classes[i].maxDepth > VB_ENGINE_EVENT_SCHED_MAX_DEPTH))
+    {
+      valid = FALSE;
+    }
+  }
+
+  if (valid == TRUE)
+  {
+    // Control frames are never held back by drivers
+    valid = (conf->driverCredits[VB_EA_FLOW_CLASS_CONTROL] == 0)?TRUE:FALSE;
+  }
+
+  for (i = 0; (i < VB_EA_FLOW_CLASS_LAST) && (valid == TRUE); i++)
+  {
+    if (conf->driverCredits[i] > VB_ENGINE_EVENT_SCHED_MAX_DRIVER_CREDITS)
+    {
+      valid = FALSE;
+    }
+  }
+
+  return valid;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineEventSchedStart(const t_vbEngineEventSchedConf *conf)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT32U               i;
+
+  if (VbEngineEventSchedConfCheck(conf) == FALSE)
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Events left by a previous run (if any) are released
+    VbEngineEventSchedFlush();
+
+    pthread_mutex_lock(&vbEngineEventSched.mutex);
+
+    vbEngineEventSched.conf = *conf;
+    vbEngineEventSched.consumerSet = FALSE;
+    vbEngineEventSched.cursor = VB_ENGINE_EVENT_CLASS_CONTROL;
+    vbEngineEventSched.seq = 0;
+
+    for (i = 0; i < VB_ENGINE_EVENT_CLASS_LAST; i++)
+    {
+      vbEngineEventSched.queues[i].credit = 0;
+    }
+
+    vbEngineEventSched.queues[VB_ENGINE_EVENT_CLASS_CONTROL].credit = conf->classes[VB_ENGINE_EVENT_CLASS_CONTROL].weight;
+    EventSchedStatsReset();
+    vbEngineEventSched.accepting = TRUE;
+
+    pthread_mutex_unlock(&vbEngineEventSched.mutex);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEngineEventSchedStop(void)
+{
+  pthread_mutex_lock(&vbEngineEventSched.mutex);
+
+  vbEngineEventSched.accepting = FALSE;
+  pthread_cond_broadcast(&vbEngineEventSched.notFull);
+  pthread_cond_broadcast(&vbEngineEventSched.notEmpty);
+
+  pthread_mutex_unlock(&vbEngineEventSched.mutex);
+}
+
+/*******************************************************************/
+
+void VbEngineEventSchedFlush(void)
+{
+  t_eventSchedNode *node;
+  t_eventSchedNode *next;
+  INT32U            i;
+
+  pthread_mutex_lock(&vbEngineEventSched.mutex);
+
+  for (i = 0; i < VB_ENGINE_EVENT_CLASS_LAST; i++)
+  {
+    for (node = vbEngineEventSched.queues[i].head; node != NULL; node = next)
+    {
+      next = node->next;
+
+      if (node->msg.msg != NULL)
+      {
+        // Release attached message
+        VbEAMsgFree(&(node->msg.msg));
+      }
+
+      free(node);
+    }
+
+    vbEngineEventSched.queues[i].head = NULL;
+    vbEngineEventSched.queues[i].tail = NULL;
+    vbEngineEventSched.queues[i].depth = 0;
+  }
+
+  for (node = vbEngineEventSched.freeNodes; node != NULL; node = next)
+  {
+    next = node->next;
+    free(node);
+  }
+
+  vbEngineEventSched.freeNodes = NULL;
+  vbEngineEventSched.numFreeNodes = 0;
+  vbEngineEventSched.pending = 0;
+  pthread_cond_broadcast(&vbEngineEventSched.notFull);
+
+  pthread_mutex_unlock(&vbEngineEventSched.mutex);
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineEventSchedConfSet(const t_vbEngineEventSchedConf *conf)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+
+  if (VbEngineEventSchedConfCheck(conf) == FALSE)
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbEngineEventSched.mutex);
+
+    vbEngineEventSched.conf = *conf;
+
+    // Depth limits may have been raised
+    pthread_cond_broadcast(&vbEngineEventSched.notFull);
+
+    pthread_mutex_unlock(&vbEngineEventSched.mutex);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineEventSchedPush(const t_VBProcessMsg *msg)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_eventSchedQueue    *queue = NULL;
+  t_eventSchedNode     *node = NULL;
+  t_vbEngineEventClass  event_class = VB_ENGINE_EVENT_CLASS_CONTROL;
+  BOOLEAN               consumer;
+  BOOLEAN               blocked = FALSE;
+
+  if ((msg == NULL) || (msg->vbCommEvent >= ENGINE_EV_LAST))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbEngineEventSched.mutex);
+
+    consumer = EventSchedIsConsumer();
+
+    if (consumer == FALSE)
+    {
+      event_class = VbEngineEventClassGet(msg->vbCommEvent);
+    }
+
+    queue = &vbEngineEventSched.queues[event_class];
+
+    if (consumer == FALSE)
+    {
+      while ((vbEngineEventSched.accepting == TRUE) &&
+             (queue->depth >= vbEngineEventSched.conf.classes[event_class].maxDepth))
+      {
+        blocked = TRUE;
+        pthread_cond_wait(&vbEngineEventSched.notFull, &vbEngineEventSched.mutex);
+      }
+    }
+    else if (queue->depth >= vbEngineEventSched.conf.classes[event_class].maxDepth)
+    {
+      // Engine process can not wait for itself
+      queue->stats.overflow++;
+    }
+
+    if (vbEngineEventSched.accepting == FALSE)
+    {
+      ret = VB_ENGINE_ERROR_NOT_STARTED;
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      node = EventSchedNodeGet();
+
+      if (node == NULL)
+      {
+        ret = VB_ENGINE_ERROR_MALLOC;
+      }
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      node->msg = *msg;
+      node->seq = vbEngineEventSched.seq++;
+      node->next = NULL;
+      clock_gettime(CLOCK_MONOTONIC, &node->queuedTs);
+
+      if (queue->tail == NULL)
+      {
+        queue->head = node;
+      }
+      else
+      {
+        queue->tail->next = node;
+      }
+
+      queue->tail = node;
+      queue->depth++;
+      queue->stats.queued++;
+      queue->stats.peakDepth = MAX(queue->stats.peakDepth, queue->depth);
+      vbEngineEventSched.pending++;
+
+      if (blocked == TRUE)
+      {
+        queue->stats.blocked++;
+      }
+
+      pthread_cond_signal(&vbEngineEventSched.notEmpty);
+    }
+
+    pthread_mutex_unlock(&vbEngineEventSched.mutex);
+
+    if (blocked == TRUE)
+    {
+      VbCounterIncrease(VB_ENGINE_COUNTER_EVENT_SCHED_BLOCKED);
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineEventSchedPop(t_VBProcessMsg *msg)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_eventSchedQueue    *queue;
+  t_eventSchedNode     *node;
+  struct timespec       now;
+  INT64S                wait;
+
+  if (msg == NULL)
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    pthread_mutex_lock(&vbEngineEventSched.mutex);
+
+    vbEngineEventSched.consumer = pthread_self();
+    vbEngineEventSched.consumerSet = TRUE;
+
+    while ((vbEngineEventSched.accepting == TRUE) && (vbEngineEventSched.pending == 0))
+    {
+      pthread_cond_wait(&vbEngineEventSched.notEmpty, &vbEngineEventSched.mutex);
+    }
+
+    if (vbEngineEventSched.pending == 0)
+    {
+      ret = VB_ENGINE_ERROR_NOT_STARTED;
+    }
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      queue = &vbEngineEventSched.queues[EventSchedClassPick()];
+      node = queue->head;
+
+      queue->head = node->next;
+
+      if (queue->head == NULL)
+      {
+        queue->tail = NULL;
+      }
+
+      queue->depth--;
+      vbEngineEventSched.pending--;
+
+      clock_gettime(CLOCK_MONOTONIC, &now);
+      wait = ((INT64S)(now.tv_sec - node->queuedTs.tv_sec) * 1000000) + ((now.tv_nsec - node->queuedTs.tv_nsec) / 1000);
+      wait = MAX(wait, 0);
+
+      queue->stats.dispatched++;
+      queue->stats.waitSum += (INT64U)wait;
+      queue->stats.waitMax = MAX(queue->stats.waitMax, (INT32U)MIN(wait, MAX_INT32U));
+
+      *msg = node->msg;
+      EventSchedNodeRelease(node);
+
+      pthread_cond_broadcast(&vbEngineEventSched.notFull);
+    }
+
+    pthread_mutex_unlock(&vbEngineEventSched.mutex);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+BOOL VbEngineEventSchedConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  t_eventSchedQueue        queues[VB_ENGINE_EVENT_CLASS_LAST];
+  t_vbEngineEventSchedConf conf;
+  INT32U                   barrier_drains;
+  INT32U                   i;
+
+  if ((cmd != NULL) && (cmd[1] != NULL) && (strcmp(cmd[1], "reset") == 0))
+  {
+    pthread_mutex_lock(&vbEngineEventSched.mutex);
+    EventSchedStatsReset();
+    pthread_mutex_unlock(&vbEngineEventSched.mutex);
+
+    writeFun("Event scheduler statistics reset\n");
+  }
+  else if ((cmd != NULL) && (cmd[1] != NULL))
+  {
+    writeFun("Usage:\n");
+    writeFun("evsched       : Shows per class queue depth, dispatched events and waiting time\n");
+    writeFun("evsched reset : Resets statistics\n");
+  }
+  else
+  {
+    pthread_mutex_lock(&vbEngineEventSched.mutex);
+    memcpy(queues, vbEngineEventSched.queues, sizeof(queues));
+    conf = vbEngineEventSched.conf;
+    barrier_drains = vbEngineEventSched.barrierDrains;
+    pthread_mutex_unlock(&vbEngineEventSched.mutex);
+
+    writeFun("==================================================================================================================\n");
+    writeFun("| %-9s | %6s | %8s | %7s | %7s | %10s | %10s | %7s | %8s | %9s | %9s |\n",
+        "Class", "Weight", "MaxDepth", "Depth", "Peak", "Queued", "Dispatched", "Blocked", "Overflow", "AvgWait", "MaxWait");
+    writeFun("==================================================================================================================\n");
+
+    for (i = 0; i < VB_ENGINE_EVENT_CLASS_LAST; i++)
+    {
+      writeFun("| %-9s | %6u | %8u | %7u | %7u | %10u | %10u | %7u | %8u | %7llu us | %6u us |\n",
+          VbEngineEventClassToStr((t_vbEngineEventClass)i),
+          conf.classes[i].weight,
+          conf.classes[i].maxDepth,
+          queues[i].depth,
+          queues[i].stats.peakDepth,
+          queues[i].stats.queued,
+          queues[i].stats.dispatched,
+          queues[i].stats.blocked,
+          queues[i].stats.overflow,
+          (queues[i].stats.dispatched > 0)?(unsigned long long)(queues[i].stats.waitSum / queues[i].stats.dispatched):0ULL,
+          queues[i].stats.waitMax);
+    }
+
+    writeFun("==================================================================================================================\n");
+    writeFun("Events dispatched ahead of a connect/disconnect/kill event : %u\n", barrier_drains);
+  }
+
+  return TRUE;
+}
+
+/**
+ * @}
+ **/
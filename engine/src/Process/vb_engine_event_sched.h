@@ -0,0 +1,186 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost_engine
+ * @{
+ **/
+
+/**
+ * @file vb_engine_event_sched.h
+ * @brief Engine process event scheduler
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+#ifndef VB_ENGINE_EVENT_SCHED_H_
+#define VB_ENGINE_EVENT_SCHED_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public constants
+ ************************************************************************
+ */
+
+#define VB_ENGINE_EVENT_SCHED_MAX_WEIGHT                   (64)
+#define VB_ENGINE_EVENT_SCHED_MAX_DEPTH                    (65536)
+
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_CONTROL_WEIGHT       (8)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_CONTROL_DEPTH        (256)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_ALIGNMENT_WEIGHT     (8)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_ALIGNMENT_DEPTH      (256)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_TIMEOUT_WEIGHT       (4)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_TIMEOUT_DEPTH        (256)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_MEASURE_WEIGHT       (2)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_MEASURE_DEPTH        (1024)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_TELEMETRY_WEIGHT     (1)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_TELEMETRY_DEPTH      (256)
+#define VB_ENGINE_EVENT_SCHED_MAX_DRIVER_CREDITS           (VB_EA_FLOW_CREDIT_UNLIMITED - 1)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_MEASURE_CREDITS      (64)
+#define VB_ENGINE_EVENT_SCHED_DEFAULT_TELEMETRY_CREDITS    (16)
+
+/*
+ ************************************************************************
+ ** Public type definitions
+ ************************************************************************
+ */
+
+typedef enum
+{
+  VB_ENGINE_EVENT_CLASS_CONTROL = 0,     ///< Driver lifecycle, discovery, boost update and configuration
+  VB_ENGINE_EVENT_CLASS_ALIGNMENT,       ///< Alignment, clock and sync lost
+  VB_ENGINE_EVENT_CLASS_TIMEOUT,         ///< FSM timers
+  VB_ENGINE_EVENT_CLASS_MEASURE,         ///< Measure plan and measure responses (bulk)
+  VB_ENGINE_EVENT_CLASS_TELEMETRY,       ///< Traffic and capacity reports
+  VB_ENGINE_EVENT_CLASS_LAST
+} t_vbEngineEventClass;
+
+typedef struct
+{
+  INT32U   weight;                       ///< Events dispatched per round while the class has events pending
+  INT32U   maxDepth;                     ///< Pending events before producers other than engine process block
+} t_vbEngineEventClassConf;
+
+typedef struct
+{
+  t_vbEngineEventClassConf classes[VB_ENGINE_EVENT_CLASS_LAST];
+  INT32U                   driverCredits[VB_EA_FLOW_CLASS_LAST];  ///< EA frames each driver may have pending per flow class (0: not flow controlled)
+} t_vbEngineEventSchedConf;
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Resets the scheduler and starts accepting events. Shall be called before starting engine process thread.
+ * @param[in] conf Weights and depth limits
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineEventSchedStart(const t_vbEngineEventSchedConf *conf);
+
+/**
+ * @brief Stops accepting events and wakes up blocked producers
+ **/
+void VbEngineEventSchedStop(void);
+
+/**
+ * @brief Releases pending events (and their attached EA messages)
+ **/
+void VbEngineEventSchedFlush(void);
+
+/**
+ * @brief Changes weights and depth limits of a running scheduler
+ * @param[in] conf Weights and depth limits
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineEventSchedConfSet(const t_vbEngineEventSchedConf *conf);
+
+/**
+ * @brief Checks weights and depth limits
+ * @param[in] conf Weights and depth limits
+ * @return TRUE if valid
+ **/
+BOOLEAN VbEngineEventSchedConfCheck(const t_vbEngineEventSchedConf *conf);
+
+/**
+ * @brief Queues an event in the queue of its class.
+ * Blocks while the class is full, unless called from engine process thread.
+ * @param[in] msg Event; it is copied
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineEventSchedPush(const t_VBProcessMsg *msg);
+
+/**
+ * @brief Waits for the next event, chosen by weighted round robin among classes.
+ * Shall only be called from engine process thread.
+ * @param[out] msg Event
+ * @return @ref t_VB_engineErrorCode (VB_ENGINE_ERROR_NOT_STARTED once stopped)
+ **/
+t_VB_engineErrorCode VbEngineEventSchedPop(t_VBProcessMsg *msg);
+
+/**
+ * @brief Gets the class of an event
+ * @param[in] event Event
+ * @return Event class
+ **/
+t_vbEngineEventClass VbEngineEventClassGet(t_VB_Comm_Event event);
+
+/**
+ * @brief Gets the class name
+ * @param[in] eventClass Event class
+ * @return Class name
+ **/
+const CHAR *VbEngineEventClassToStr(t_vbEngineEventClass eventClass);
+
+/**
+ * @brief Console command to show per class queue depth, dispatch counts and waiting times
+ **/
+BOOL VbEngineEventSchedConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_EVENT_SCHED_H_ */
+
+/**
+ * @}
+ **/
@@ -65,6 +65,8 @@
 #include "vb_log.h"
 #include "vb_engine_communication.h"
 #include "vb_engine_process.h"
+#include "vb_engine_event_sched.h"
+#include "vb_engine_EA_flow.h"
 #include "vb_thread.h"
 #include "vb_priorities.h"
 #include "vb_console.h"
@@ -79,6 +81,9 @@
 #include "vb_engine_clock.h"
 #include "vb_engine_socket_alive.h"
 #include "vb_engine_measure.h"
+#include "vb_engine_cluster_partition.h"
+#include "vb_engine_snr_tracking.h"
+#include "vb_engine_boost_damping.h"
 #include "vb_engine_SNR_calculation.h"
 #include "vb_engine_l2rPSD_calculation.h"
 #include "vb_engine_psd_shape.h"
@@ -161,6 +166,7 @@ static t_VB_engineErrorCode VbeFSMDriverAlignClusterITransition( t_VBProcessMsg
 static t_VB_engineErrorCode VbeFSMDMRemBestActionMeasTransition(t_VBProcessMsg *processMsg);
 static t_VB_engineErrorCode VbeFSMDMRemBestActionBoostTransition(t_VBProcessMsg *processMsg);
 static t_VB_engineErrorCode VbeFSMAllDriversAliveSocketReqTransition(t_VBProcessMsg *processMsg);
+static t_VB_engineErrorCode VbeFSMAllConfReloadTransition(t_VBProcessMsg *processMsg);
 
 /**
 * @brief This function executes the FSM process
@@ -177,12 +183,6 @@ static t_VB_engineErrorCode VbEngineProcessCheckDriversSync(t_vbEngineProcessFSM
 /* Log current state */
 static void VbEngineProcessStateLogToFile(const t_VBDriver *thisDriver);
 
-/**
-* @brief Flush the engine_process message queue
-*
-**/
-static t_VB_engineErrorCode VbEngineProcessQueueFlush(void);
-
 /*
  ************************************************************************
  ** Private constants
@@ -226,7 +226,6 @@ typedef struct s_VbEngineProcess
   pthread_t        threadId;
   t_vbQueueName    queueName;
   mqd_t            rdWrQueueId;
-  mqd_t            wrOnlyQueueId;
 } t_VbEngineProcess;
 
 typedef struct
@@ -243,7 +242,6 @@ typedef struct
 
 static t_VbEngineProcess    vbEngineProcess;
 static t_VbEngineFSMStep    vbeFSMTransition[ENGINE_STT_LAST][ENGINE_EV_LAST];
-static CHAR                 vbEngineProcessMQBuffer[VB_ENGINE_PROCESS_MQ_MSG_SIZE];
 static t_VBDMsHistory       vbDMsHistory = { NULL, 0 };
 static pthread_mutex_t      vbDMsHistoryMutex;
 
@@ -367,7 +365,8 @@ static const CHAR *vbEngineEventString[ENGINE_EV_LAST] =
       "NETWORK_DIFF_EP_CHANGE",
       "NETWORK_DIFF_DM_REM",
       "ALIVE_SOCK_CHECK",
-      "ALIVE_SOCK_RSP"
+      "ALIVE_SOCK_RSP",
+      "CONF_RELOAD"
 
   };
 
@@ -415,7 +414,11 @@ static const t_VB_Comm_Event vb_EAI_lookup_events[VB_EA_OPCODE_LAST] =
     ENGINE_EV_RX_ALIGN_CLUSTER_STOP_RSP,         //VB_EA_OPCODE_ALIGN_STOP_CLUSTER_RESP = 0x26,
     ENGINE_EV_RX_NETWORK_CHANGE,                 //VB_EA_OPCODE_NETWORK_CHANGE_REPORT   = 0x27
     ENGINE_EV_LAST,                              //VB_EA_OPCODE_SOCKET_ALIVE_REQUEST    = 0x28
-    ENGINE_EV_RX_ALIVE_SOCK_RSP                  //VB_EA_OPCODE_SOCKET_ALIVE_RESP       = 0x29
+    ENGINE_EV_RX_ALIVE_SOCK_RSP,                 //VB_EA_OPCODE_SOCKET_ALIVE_RESP       = 0x29
+    ENGINE_EV_LAST,                              //VB_EA_OPCODE_FLOW_CREDIT             = 0x2A
+    ENGINE_EV_LAST,                              //VB_EA_OPCODE_SHM_REQ                 = 0x2B
+    ENGINE_EV_LAST,                              //VB_EA_OPCODE_SHM_RSP                 = 0x2C
+    ENGINE_EV_LAST                               //VB_EA_OPCODE_SHM_SWITCH_TRG          = 0x2D
 };
 
 /*
@@ -1394,6 +1397,7 @@ static void VbEngineProcessInit()
   vbeFSMTransition[ENGINE_STT_UNDEFINED]                          [ENGINE_EV_MEASPLAN_CANCEL_END_SYNC]        = (t_VbEngineFSMStep){ENGINE_STT_UNDEFINED,                           VbeFSMAllDriversMeasPlanCancelSyncTransition};
   vbeFSMTransition[ENGINE_STT_UNDEFINED]                          [ENGINE_EV_MEASPLAN_CANCEL_TO]              = (t_VbEngineFSMStep){ENGINE_STT_UNDEFINED,                           NULL};
   vbeFSMTransition[ENGINE_STT_UNDEFINED]                          [ENGINE_EV_ALIVE_SOCK_CHECK]                = (t_VbEngineFSMStep){ENGINE_STT_UNDEFINED,                           VbeFSMAllDriversAliveSocketReqTransition};
+  vbeFSMTransition[ENGINE_STT_UNDEFINED]                          [ENGINE_EV_CONF_RELOAD]                     = (t_VbEngineFSMStep){ENGINE_STT_UNDEFINED,                           VbeFSMAllConfReloadTransition};
 
 }
 
@@ -1510,56 +1514,6 @@ static t_VB_engineErrorCode VbEngineProcessCheckClustersSync(t_vbEngineProcessFS
 
 /*******************************************************************/
 
-static t_VB_engineErrorCode VbEngineProcessQueueFlush(void)
-{
-  t_VB_engineErrorCode result = VB_ENGINE_ERROR_NONE;
-  CHAR buffer[VB_ENGINE_PROCESS_MQ_MSG_SIZE];
-  t_VBProcessMsg *vb_process_msg = NULL;
-  BOOL flushing = TRUE;
-  ssize_t numRead = 0;
-  mqd_t queue_id;
-
-  queue_id =  mq_open(vbEngineProcess.queueName, O_NONBLOCK | O_RDONLY);
-
-  if (queue_id == (mqd_t) -1)
-  {
-    VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error opening process queue");
-    result = VB_ENGINE_ERROR_QUEUE;
-  }
-  else
-  {
-    //Clear queue
-    while(flushing)
-    {
-      numRead = mq_receive(queue_id, buffer, VB_ENGINE_PROCESS_MQ_MSG_SIZE, NULL);
-      if (numRead <= 0)
-      {
-        flushing = FALSE;
-      }
-      else if (numRead != VB_ENGINE_PROCESS_MQ_MSG_SIZE)
-      {
-        VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Cleanning queue numbytes received error");
-      }
-      else
-      {
-        vb_process_msg = (t_VBProcessMsg *)buffer;
-
-        if (vb_process_msg->msg != NULL)
-        {
-          // Release attached message
-          VbEAMsgFree(&(vb_process_msg->msg));
-        }
-      }
-    }
-
-    mq_close(queue_id);
-  }
-
-  return result;
-}
-
-/*******************************************************************/
-
 static t_VB_engineErrorCode DriverStateChange(t_VBDriver *driver, t_vbEngineProcessFSMState nextState, t_VB_Comm_Event event)
 {
   t_VB_engineErrorCode      ret = VB_ENGINE_ERROR_NONE;
@@ -1868,15 +1822,14 @@ static void VbEngineProcess( void *arg)
 {
   t_VB_engineErrorCode result = VB_ENGINE_ERROR_NONE;
   struct mq_attr attr;
-  ssize_t numRead = 0;
-  t_VBProcessMsg *vb_process_msg = NULL;
+  t_VBProcessMsg vb_process_msg;
 
   // Init data structures
   //
   VbEngineProcessInit();
 
-  // Create and configure the message queue for this driver to receive messages
-  // from the thread in charge of processing incomming TCP messages.
+  // Events are queued in the event scheduler. The message queue is still
+  // created because EA descriptors open it by name to validate the connection.
   //
   mq_unlink(vbEngineProcess.queueName);
 
@@ -1893,19 +1846,6 @@ static void VbEngineProcess( void *arg)
 
   if (result == VB_ENGINE_ERROR_NONE)
   {
-    vbEngineProcess.wrOnlyQueueId =  mq_open(vbEngineProcess.queueName, O_WRONLY);
-
-    if (vbEngineProcess.wrOnlyQueueId == (mqd_t) -1)
-    {
-      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error to create mqueue. errno: [%s]", strerror(errno));
-      result = VB_ENGINE_ERROR_QUEUE;
-    }
-  }
-
-  if (result == VB_ENGINE_ERROR_NONE)
-  {
-    VbEngineProcessQueueFlush();
-
     if (VbEngineConfServerConnModeGet())
     {
       // Start server thread
@@ -1922,28 +1862,30 @@ static void VbEngineProcess( void *arg)
   {
     while (vbEngineProcess.running == TRUE)
     {
-      numRead = mq_receive(vbEngineProcess.rdWrQueueId, vbEngineProcessMQBuffer, VB_ENGINE_PROCESS_MQ_MSG_SIZE, NULL);
+      // Wait for next event (weighted round robin among event classes)
+      result = VbEngineEventSchedPop(&vb_process_msg);
 
-      if (numRead < 0)
+      if (result != VB_ENGINE_ERROR_NONE)
       {
         // Fatal error thread
-        VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Process mq_receive error. errno %s", strerror(errno));
-      }
-      else if (numRead != VB_ENGINE_PROCESS_MQ_MSG_SIZE)
-      {
-        VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Process numbytes received error, NumRead %d", (int)numRead);
+        VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Process event scheduler error %d", result);
+        vbEngineProcess.running = FALSE;
       }
       else
       {
-        vb_process_msg = (t_VBProcessMsg *)vbEngineProcessMQBuffer;
+        if ((vb_process_msg.msg != NULL) && (vb_process_msg.senderDriver != NULL))
+        {
+          // Frame leaves the engine queues, give its credit back to the driver
+          VbEngineEAFlowFrameDone(vb_process_msg.senderDriver, vb_process_msg.msg->opcode);
+        }
 
         // Pass new event to FSM
-        result = VbEngineFSMEventDo(vb_process_msg);
+        result = VbEngineFSMEventDo(&vb_process_msg);
 
-        if (vb_process_msg->msg != NULL)
+        if (vb_process_msg.msg != NULL)
         {
           // Release attached message
-          VbEAMsgFree(&(vb_process_msg->msg));
+          VbEAMsgFree(&(vb_process_msg.msg));
         }
       }
     } // end while
@@ -1951,6 +1893,9 @@ static void VbEngineProcess( void *arg)
 
   // Clean up!
 
+  // Wake up producers blocked on a full event class before stopping EA threads
+  VbEngineEventSchedStop();
+
   VbCounterIncrease(VB_ENGINE_COUNTER_DISCONNECTED_STATUS);
 
   // Stop EA thread
@@ -1960,8 +1905,7 @@ static void VbEngineProcess( void *arg)
     VbEngineEAProtocolServerThreadStop();
   }
 
-  VbEngineProcessQueueFlush();
-  mq_close(vbEngineProcess.wrOnlyQueueId);
+  VbEngineEventSchedFlush();
   mq_close(vbEngineProcess.rdWrQueueId);
   mq_unlink(vbEngineProcess.queueName);
   pthread_mutex_destroy(&vbDMsHistoryMutex);
@@ -1993,6 +1937,8 @@ static t_VB_engineErrorCode BoostAlgorithmRun(INT32U clusterId)
     qos_rate_change = (current_qos_rate != next_qos_rate)? TRUE:FALSE;
     psd_l2r_args.qos = next_qos_rate;
     psd_l2r_args.psdBandsAllocation = VbEngineConfPSDBandAllocationGet();
+    psd_l2r_args.numSuppressed = 0;
+    psd_l2r_args.numMerged = 0;
 
     // Build PSD shapes as requested by CDTA algorithm
     ret = VbEngineDatamodelClusterXAllNodesLoop(VbEngineLeftToRightPSDShapeRun, clusterId, (void*)&psd_l2r_args);
@@ -2002,6 +1948,13 @@ static t_VB_engineErrorCode BoostAlgorithmRun(INT32U clusterId)
   {
     send_update = VbEnginePsdShapeSendCheck(clusterId);
 
+    // Hold reconfiguration if damping limits are exceeded, it is retried from next runs
+    ret = VbEngineBoostDampingGate(clusterId, psd_l2r_args.numSuppressed, psd_l2r_args.numMerged,
+        &send_update, &qos_rate_change);
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
     if ((send_update == TRUE) || (qos_rate_change == TRUE))
     {
       VbLogPrint(VB_LOG_INFO, "Algorithm send Update %u, qos rate change %u", send_update, next_qos_rate);
@@ -2421,6 +2374,7 @@ static t_VB_engineErrorCode VbeFSMConnectTransition(t_VBProcessMsg *processMsg)
    * ACTIONS:
    * - Inform all drivers that a new driver has joined the
    * system and we shall start from scratch.
+   * - Advertise EA receive credits.
    * - Request the Driver version and Driver Id.
    */
 
@@ -2432,6 +2386,9 @@ static t_VB_engineErrorCode VbeFSMConnectTransition(t_VBProcessMsg *processMsg)
 
   if (error == VB_ENGINE_ERROR_NONE)
   {
+    // Advertise receive credits before any bulk frame can be requested
+    VbEngineEAFlowStart(processMsg->senderDriver);
+
     // Send Discover Version request
     error = VbeFSMDiscoverVersionTransition(processMsg);
 
@@ -2832,17 +2789,26 @@ static t_VB_engineErrorCode VbeFSMAllDriversClockReqTransition(t_VBProcessMsg *p
 {
   t_VB_engineErrorCode      error = VB_ENGINE_ERROR_NONE;
 
+  BOOLEAN                   expired_only = (BOOLEAN)(VOIDP2INT(processMsg->args));
+
   /*
-   * Request a clock update from all drivers.
+   * Request a clock update from drivers.
    *
    * ACTIONS:
-   * - Request clock update.
+   * - Request clock update. Periodic monitor only polls drivers whose
+   *   clock model poll interval has expired; otherwise force all drivers.
    */
 
   if(error == VB_ENGINE_ERROR_NONE)
   {
-    // YYRR Review Force a clock update of all drivers
-    error = VbEngineClockAllDriversUpdate();
+    if (expired_only == TRUE)
+    {
+      error = VbEngineClockExpiredDriversUpdate();
+    }
+    else
+    {
+      error = VbEngineClockAllDriversUpdate();
+    }
 
     if (error == VB_ENGINE_ERROR_NONE)
     {
@@ -2900,6 +2866,72 @@ static t_VB_engineErrorCode VbeFSMAllDriversAliveSocketReqTransition(t_VBProcess
 
 /************************************************************************/
 
+static t_VB_engineErrorCode VbeFSMAllConfReloadTransition(t_VBProcessMsg *processMsg)
+{
+  t_VB_engineErrorCode      error;
+  INT32U                    changes = 0;
+
+  /*
+   * Apply a new configuration read from vb_engine.ini.
+   *
+   * ACTIONS:
+   * - Copy changed sections to running configuration.
+   * - Update the modules that cache configuration values.
+   * - Changes are picked up by the next boost algorithm run or measure plan. Event is not delivered to drivers.
+   */
+
+  error = VbEngineConfReloadApply(&changes);
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    CHAR changes_str[VB_ENGINE_CONF_RELOAD_STR_LEN];
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(changes, VB_ENGINE_CONF_RELOAD_SECTION_VERBOSE))
+    {
+      VbLogVerboseLevelSet(VbEngineConfVerboseLevelGet());
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(changes, VB_ENGINE_CONF_RELOAD_SECTION_CDTA))
+    {
+      t_cdtaConf *cdta_conf = NULL;
+
+      if (VbEngineConfCDTADataGet(&cdta_conf) == VB_ENGINE_ERROR_NONE)
+      {
+        VbEngineCDTAConfApply(cdta_conf);
+      }
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(changes, VB_ENGINE_CONF_RELOAD_SECTION_PROFILES))
+    {
+      error = VbEngineDatamodelAllNodesProfileUpdate();
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(changes, VB_ENGINE_CONF_RELOAD_SECTION_THREAD_PLACEMENT))
+    {
+      // Failures are logged, running threads keep the placement that could be applied
+      VbThreadPlacementConfSet(VbEngineConfThreadPlacementGet());
+    }
+
+    if (VB_ENGINE_CONF_RELOAD_CHANGED(changes, VB_ENGINE_CONF_RELOAD_SECTION_EVENT_SCHED))
+    {
+      // Pending events are kept; producers blocked on a raised limit are woken up
+      error = VbEngineEventSchedConfSet(VbEngineConfEventSchedGet());
+    }
+
+    VbEngineConfReloadChangesToStr(changes, changes_str, sizeof(changes_str));
+    VbLogPrintExt(VB_LOG_WARNING, VB_ENGINE_ALL_DRIVERS_STR, "Configuration reloaded (%s) err %d", changes_str, error);
+  }
+
+  if (error == VB_ENGINE_ERROR_NONE)
+  {
+    error = VB_ENGINE_ERROR_SKIP_ALL_DRIVERS_LOOP;
+  }
+
+  return error;
+}
+
+/************************************************************************/
+
 static t_VB_engineErrorCode VbeFSMAllDriversAlignCheckTOTransition(t_VBProcessMsg *processMsg)
 {
   t_VB_engineErrorCode      error = VB_ENGINE_ERROR_NONE;
@@ -4896,6 +4928,7 @@ static t_VB_engineErrorCode VbeFSMAllComputationOkTransition( t_VBProcessMsg *pr
   t_VB_engineErrorCode error = VB_ENGINE_ERROR_NONE;
   INT16U               boosting_alg_period;
   t_VBCluster         *cluster;
+  BOOLEAN              partition_applied = FALSE;
   /*
    * SNR and capacity calculated successfully.
    * Start boosting process.
@@ -4903,6 +4936,7 @@ static t_VB_engineErrorCode VbeFSMAllComputationOkTransition( t_VBProcessMsg *pr
    * ACTIONS:
    * - Stop SNR and capacity thread.
    * - Save measures to disk, if required.
+   * - Split cluster if a partition proposal is pending and allowed (boosting is skipped, cluster is realigned).
    * - Start a timer to run boosting algorithm each VbEngineConfBoostAlgPeriodGet ms.
    * - Run boosting algorithm.
    */
@@ -4925,24 +4959,26 @@ static t_VB_engineErrorCode VbeFSMAllComputationOkTransition( t_VBProcessMsg *pr
       VbEngineMeasureSave(processMsg->clusterCast.list[0]);
     }
 
+    VbEngineClusterPartitionApply(processMsg->clusterCast.list[0], &partition_applied);
+
     // Get algorithm period
     boosting_alg_period = VbEngineConfBoostAlgPeriodGet();
 
     VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Configuring boosting algorithm to run each %u ms", boosting_alg_period);
   }
 
-  if (error == VB_ENGINE_ERROR_NONE)
+  if ((error == VB_ENGINE_ERROR_NONE) && (partition_applied == FALSE))
   {
     // Configure a periodic timer to launch event to run boost algorithm
     cluster->timeoutCnf.clusterCast.numCLuster =1;
     cluster->timeoutCnf.clusterCast.list[0] = processMsg->clusterCast.list[0];
 
     error = VbEngineTimeoutStart(&(cluster->timeoutCnf), ENGINE_EV_BOOST_ALG_RUN_TO, boosting_alg_period, TRUE, "BoostAlgTO");
-  }
 
-  if (error == VB_ENGINE_ERROR_NONE)
-  {
-    error = BoostAlgorithmRun(processMsg->clusterCast.list[0]);
+    if (error == VB_ENGINE_ERROR_NONE)
+    {
+      error = BoostAlgorithmRun(processMsg->clusterCast.list[0]);
+    }
   }
 
   return error;
@@ -4961,7 +4997,7 @@ static t_VB_engineErrorCode VbeFSMAllBoostAlgRunTransition( t_VBProcessMsg *proc
    *
    * ACTIONS:
    * - Check if a new alignment check is required and launch it.
-   * - Or, run boosting algorithm.
+   * - Or, track SNR with probes (if enabled) and run boosting algorithm.
    */
 
   if (processMsg == NULL)
@@ -4989,6 +5025,9 @@ static t_VB_engineErrorCode VbeFSMAllBoostAlgRunTransition( t_VBProcessMsg *proc
     }
     else
     {
+      // Errors requesting probes shall not stop boosting
+      VbEngineSnrTrackingRun(processMsg->clusterCast.list[0]);
+
       error = BoostAlgorithmRun(processMsg->clusterCast.list[0]);
     }
   }
@@ -5639,7 +5678,7 @@ static t_VB_engineErrorCode VbEngineProcessFrameRxToEventTranslate(t_vbEAMsg *ms
 
 /*******************************************************************/
 
-static t_VB_engineErrorCode VbEngineGenericEvSend(mqd_t queue, t_VBProcessMsg *msg)
+static t_VB_engineErrorCode VbEngineGenericEvSend(t_VBProcessMsg *msg)
 {
   t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
 
@@ -5650,24 +5689,8 @@ static t_VB_engineErrorCode VbEngineGenericEvSend(mqd_t queue, t_VBProcessMsg *m
 
   if (ret == VB_ENGINE_ERROR_NONE)
   {
-    unsigned int msg_prio;
-    int          err;
-
-    if (msg->senderDriver == NULL)
-    {
-      msg_prio = VB_THREADMSG_HIGH_PRIORITY;
-    }
-    else
-    {
-      msg_prio = VB_THREADMSG_PRIORITY;
-    }
-
-    err = mq_send(queue, ((const char *)(msg)), VB_ENGINE_PROCESS_MQ_MSG_SIZE, msg_prio);
-
-    if (err != 0)
-    {
-      ret = VB_ENGINE_ERROR_QUEUE;
-    }
+    // Queued in the FIFO of its event class; blocks while the class is full
+    ret = VbEngineEventSchedPush(msg);
   }
 
   return ret;
@@ -5724,11 +5747,11 @@ t_VB_engineErrorCode VbEngineProcessEvSend(t_VBDriver *driver, t_VB_Comm_Event e
     vb_process_msg.args = args;
     vb_process_msg.clusterCast.numCLuster = 0; // Not needed here
 
-    ret = VbEngineGenericEvSend(vbEngineProcess.wrOnlyQueueId, &vb_process_msg);
+    ret = VbEngineGenericEvSend(&vb_process_msg);
 
     if (ret != VB_ENGINE_ERROR_NONE)
     {
-      VbLogPrintExt(VB_LOG_ERROR, driver->vbDriverID, "Error sending message to engine process Queue. errno: %s", strerror(errno));
+      VbLogPrintExt(VB_LOG_ERROR, driver->vbDriverID, "Error %d sending message to engine process Queue", ret);
     }
   }
 
@@ -5782,11 +5805,11 @@ t_VB_engineErrorCode VbEngineProcessEAFrameRx(t_vbEAMsg *msg, t_VBDriver *thisDr
     vb_process_msg.args = NULL;
     vb_process_msg.clusterCast.numCLuster = 0; // Not needed here
 
-    res = VbEngineGenericEvSend(thisDriver->vbEAConnDesc.queueId, &vb_process_msg);
+    res = VbEngineGenericEvSend(&vb_process_msg);
 
     if (res != VB_ENGINE_ERROR_NONE)
     {
-      VbLogPrintExt(VB_LOG_ERROR, thisDriver->vbDriverID, "Error sending message to engine process Queue. errno: %s", strerror(errno));
+      VbLogPrintExt(VB_LOG_ERROR, thisDriver->vbDriverID, "Error %d sending message to engine process Queue", res);
     }
   }
 
@@ -5827,11 +5850,56 @@ t_VB_engineErrorCode VbEngineProcessAllDriversEvSend(t_VB_Comm_Event event, void
     vb_process_msg.args = args;
     vb_process_msg.clusterCast.numCLuster = 0; // 0 and senderDriver == NULL -> TO ALL
 
-    ret = VbEngineGenericEvSend(vbEngineProcess.wrOnlyQueueId, &vb_process_msg);
+    ret = VbEngineGenericEvSend(&vb_process_msg);
+
+    if (ret != VB_ENGINE_ERROR_NONE)
+    {
+      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error %d sending message (EV_%s) to engine_process Queue", ret, FSMEvToStrGet(event));
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineProcessConfReload(CHAR *result, INT32U resultLen)
+{
+  t_VB_engineErrorCode ret;
+  INT32U               changes = 0;
+  CHAR                 reason[VB_ENGINE_CONF_RELOAD_STR_LEN];
+
+  ret = VbEngineConfReloadPrepare(&changes, reason, sizeof(reason));
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (changes != 0))
+  {
+    // Changes are applied from engine process thread
+    ret = VbEngineProcessAllDriversEvSend(ENGINE_EV_CONF_RELOAD, NULL);
 
     if (ret != VB_ENGINE_ERROR_NONE)
     {
-      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error sending message (EV_%s) to engine_process Queue. errno: %s", FSMEvToStrGet(event), strerror(errno));
+      VbEngineConfReloadCancel();
+      snprintf(reason, sizeof(reason), "error %d scheduling reload", ret);
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    VbEngineConfReloadChangesToStr(changes, reason, sizeof(reason));
+    VbLogPrint(VB_LOG_WARNING, "Configuration reload requested (changes: %s)", reason);
+
+    if (result != NULL)
+    {
+      snprintf(result, resultLen, "Configuration reload scheduled (changes: %s)", reason);
+    }
+  }
+  else
+  {
+    VbLogPrint(VB_LOG_ERROR, "Configuration reload rejected: %s", reason);
+
+    if (result != NULL)
+    {
+      snprintf(result, resultLen, "Configuration reload rejected: %s", reason);
     }
   }
 
@@ -5868,11 +5936,11 @@ t_VB_engineErrorCode VbEngineProcessClusterXDriversEvSend(t_VB_Comm_Event event,
     vb_process_msg.clusterCast.numCLuster = 1;
     vb_process_msg.clusterCast.list[0] = clusterId;
 
-    ret = VbEngineGenericEvSend(vbEngineProcess.wrOnlyQueueId, &vb_process_msg);
+    ret = VbEngineGenericEvSend(&vb_process_msg);
 
     if (ret != VB_ENGINE_ERROR_NONE)
     {
-      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error sending message (EV_%s) to engine_process Queue. errno: %s", FSMEvToStrGet(event), strerror(errno));
+      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error %d sending message (EV_%s) to engine_process Queue", ret, FSMEvToStrGet(event));
     }
   }
 
@@ -5908,11 +5976,11 @@ t_VB_engineErrorCode VbEngineProcessClustersListDriversEvSend(t_VB_Comm_Event ev
     vb_process_msg.args = args;
     vb_process_msg.clusterCast = clusters;
 
-    ret = VbEngineGenericEvSend(vbEngineProcess.wrOnlyQueueId, &vb_process_msg);
+    ret = VbEngineGenericEvSend(&vb_process_msg);
 
     if (ret != VB_ENGINE_ERROR_NONE)
     {
-      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error sending message (EV_%s) to engine_process Queue. errno: %s", FSMEvToStrGet(event), strerror(errno));
+      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error %d sending message (EV_%s) to engine_process Queue", ret, FSMEvToStrGet(event));
     }
   }
 
@@ -5941,12 +6009,22 @@ t_VB_engineErrorCode VbEngineProcessThreadExecute(void)
 
   VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Starting %s thread", VB_ENGINE_PROCESS_THREAD_NAME);
 
-  vbEngineProcess.running = TRUE;
+  result = VbEngineEventSchedStart(VbEngineConfEventSchedGet());
+
+  if (result != VB_ENGINE_ERROR_NONE)
+  {
+    VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Can't start event scheduler (%d)", result);
+  }
+  else
+  {
+    vbEngineProcess.running = TRUE;
+  }
 
-  if (FALSE == VbThreadCreate(VB_ENGINE_PROCESS_THREAD_NAME,
+  if ((result == VB_ENGINE_ERROR_NONE) &&
+      (FALSE == VbThreadCreate(VB_ENGINE_PROCESS_THREAD_NAME,
                               (void *)VbEngineProcess, NULL,
-                              VB_ENGINE_PROCESS_THREAD_PRIORITY,
-                              &(vbEngineProcess.threadId)))
+                              VB_ENGINE_PROCESS_THREAD_CLASS,
+                              &(vbEngineProcess.threadId))))
   {
     VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Can't create %s thread", VB_ENGINE_PROCESS_THREAD_NAME);
     result = VB_ENGINE_ERROR_EA_THREAD_CREATE;
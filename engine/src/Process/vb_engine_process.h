@@ -129,6 +129,15 @@ t_VB_engineErrorCode VbEngineProcessEAFrameRx(t_vbEAMsg *msg, t_VBDriver *thisDr
 **/
 t_VB_engineErrorCode VbEngineProcessAllDriversEvSend(t_VB_Comm_Event event, void *args);
 
+/**
+ * @brief Reads again vb_engine.ini and schedules the application of the changes in engine process thread.
+ * Request is rejected if any changed parameter requires an engine restart.
+ * @param[out] result Human readable result (can be NULL)
+ * @param[in] resultLen Size of result buffer
+ * @return @ref t_VB_engineErrorCode
+**/
+t_VB_engineErrorCode VbEngineProcessConfReload(CHAR *result, INT32U resultLen);
+
 /**
  * @brief Sends an event related to all drivers belonging to clusterId
  * @param[in] event Event to send
@@ -75,6 +75,20 @@
 #include "vb_engine_cluster_list.h"
 #include "vb_engine_measure.h"
 #include "vb_engine_cdta.h"
+#include "vb_engine_line_state.h"
+#include "vb_file_writer.h"
+#include "vb_engine_query.h"
+#include "vb_engine_meas_stream.h"
+#include "vb_engine_xtalk_sparsity.h"
+#include "vb_engine_cluster_partition.h"
+#include "vb_engine_cfr_resolution.h"
+#include "vb_engine_snr_tracking.h"
+#include "vb_engine_boost_damping.h"
+#include "vb_engine_traffic_forecast.h"
+#include "vb_engine_snr_linear_cache.h"
+#include "vb_engine_meas_history.h"
+#include "vb_engine_event_sched.h"
+#include "vb_engine_EA_flow.h"
 #include "vb_ea_communication.h"
 
 /*
@@ -1941,6 +1955,38 @@ static t_VB_engineErrorCode VbEngineConsoleClockReportDriversCb(t_VBDriver *driv
 
 /*******************************************************************/
 
+static t_VB_engineErrorCode VbEngineConsoleClockModelReportDriversCb(t_VBDriver *driver, void *args)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_consoleLoopArgs   *loop_args = (t_consoleLoopArgs *)args;
+
+  if ((loop_args == NULL) || (driver == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    t_ClockModel *model = &(driver->time.model);
+
+    loop_args->writeFun("|%-30s| %5s | %7u | %13.1f us | %9.3f ppm | %9.1f us | %9.3f ppm | %6u ms | %7u | %6u |\n",
+        driver->vbDriverID,
+        model->valid?"YES":"NO",
+        model->numSamples,
+        model->offsetUs,
+        model->driftPpm,
+        model->residualUs,
+        model->driftErrPpm,
+        model->pollIntervalMs,
+        model->numRejects,
+        model->numResets);
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
 static BOOL VbEngineConsoleClockReport(void *arg, t_writeFun writeFun, char **cmd)
 {
   t_VB_engineErrorCode err;
@@ -1988,6 +2034,15 @@ static BOOL VbEngineConsoleClockReport(void *arg, t_writeFun writeFun, char **cm
     VbEngineDatamodelDriversLoop(VbEngineConsoleClockReportDriversCb, &loop_args);
 
     writeFun("=============================================================================================================================================\n");
+
+    writeFun("Clock models:\n");
+    writeFun("=============================================================================================================================================\n");
+    writeFun("|             Driver           | Valid | Samples |       Offset     |      Drift    |   Residual  |   DriftErr    |    Poll   | Rejects | Resets |\n");
+    writeFun("=============================================================================================================================================\n");
+
+    VbEngineDatamodelDriversLoop(VbEngineConsoleClockModelReportDriversCb, &loop_args);
+
+    writeFun("=============================================================================================================================================\n");
   }
 
   if (err == VB_ENGINE_ERROR_NONE)
@@ -3050,6 +3105,14 @@ static BOOL VbEngineConfConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
       show_help = TRUE;
       ret = TRUE;
     }
+    else if (!strcmp(cmd[1], "reload"))
+    {
+      CHAR result[VB_ENGINE_CONF_RELOAD_STR_LEN * 2];
+
+      VbEngineProcessConfReload(result, sizeof(result));
+      writeFun("%s\n", result);
+      ret = TRUE;
+    }
     else
     {
       ret = FALSE;
@@ -3068,6 +3131,7 @@ static BOOL VbEngineConfConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
     writeFun("conf h                      : Shows this help\n");
     writeFun("conf                        : Dump current configuration\n");
     writeFun("conf bthr <decThr> <incThr> : Configures boost thresholds\n");
+    writeFun("conf reload                 : Reloads vb_engine.ini (also on SIGHUP)\n");
   }
 
   return ret;
@@ -3559,6 +3623,9 @@ static t_VB_engineErrorCode VbEngineConsoleEAMsgDumpDriver(t_VBDriver *driver, t
 
     // Dump EA statistics
     VbEADbgMsgDump(&table, writeFun);
+
+    writeFun("\n");
+    VbEATransportDump(&(driver->vbEAConnDesc), writeFun);
   }
 
   return ret;
@@ -3849,6 +3916,21 @@ t_VB_engineErrorCode VbEngineConsoleInit(INT16U port)
     VbConsoleCommandRegister("ea",         VbEngineEAConsoleCmd,            NULL);
     VbConsoleCommandRegister("cdta",       VbEngineCdtaDescConsoleCmd,      NULL);
     VbConsoleCommandRegister("log",        VbLogConsoleCmd,                 NULL);
+    VbConsoleCommandRegister("linestate",  VbEngineLineStateConsoleCmd,     NULL);
+    VbConsoleCommandRegister("fwriter",    VbFileWriterConsoleCmd,          NULL);
+    VbConsoleCommandRegister("query",      VbEngineQueryConsoleCmd,         NULL);
+    VbConsoleCommandRegister("mstream",    VbEngineMeasStreamConsoleCmd,    NULL);
+    VbConsoleCommandRegister("xtalk",      VbEngineXtalkSparsityConsoleCmd, NULL);
+    VbConsoleCommandRegister("cpart",      VbEngineClusterPartitionConsoleCmd, NULL);
+    VbConsoleCommandRegister("cfrres",     VbEngineCfrResolutionConsoleCmd, NULL);
+    VbConsoleCommandRegister("snrtrack",   VbEngineSnrTrackingConsoleCmd,   NULL);
+    VbConsoleCommandRegister("damping",    VbEngineBoostDampingConsoleCmd,  NULL);
+    VbConsoleCommandRegister("forecast",   VbEngineTrafficForecastConsoleCmd, NULL);
+    VbConsoleCommandRegister("lincache",   VbEngineSnrLinearCacheConsoleCmd, NULL);
+    VbConsoleCommandRegister("mhist",      VbEngineMeasHistoryConsoleCmd,   NULL);
+    VbConsoleCommandRegister("threads",    VbThreadConsoleCmd,              NULL);
+    VbConsoleCommandRegister("evsched",    VbEngineEventSchedConsoleCmd,    NULL);
+    VbConsoleCommandRegister("eaflow",     VbEngineEAFlowConsoleCmd,        NULL);
   }
 
   return ret;
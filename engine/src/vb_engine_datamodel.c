@@ -67,6 +67,8 @@
 #include "vb_timer.h"
 #include "vb_engine_metrics_reports.h"
 #include "vb_engine_drivers_list.h"
+#include "vb_engine_snr_linear_cache.h"
+#include "vb_engine_meas_history.h"
 
 /*
  ************************************************************************
@@ -162,6 +164,15 @@ static void VbEngineDatamodelNodeDestroy(t_node *node)
   if (node != NULL)
   {
     VbDatamodelNodeMeasuresDestroy(&(node->measures));
+
+    if (node->xtalkSparsity.cfrIdx != NULL)
+    {
+      free(node->xtalkSparsity.cfrIdx);
+    }
+    memset(&(node->xtalkSparsity), 0, sizeof(node->xtalkSparsity));
+    VbEngineSnrLinearCacheRelease(&(node->snrLinearCache));
+    VbEngineMeasHistoryRelease(&(node->measHistory));
+    memset(&(node->snrTracking), 0, sizeof(node->snrTracking));
   }
 }
 
@@ -316,6 +327,29 @@ static t_VB_engineErrorCode VbEngineBoostModeByMacSetLoopCb(t_VBDriver *driver,
 
 /*******************************************************************/
 
+static t_VB_engineErrorCode VbEngineProfileUpdateLoopCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode   ret = VB_ENGINE_ERROR_NONE;
+
+  if (node == NULL)
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Default profile is used when node is not in the list
+    VbEngineConfProfileGet(node->MAC,
+                           &(node->cdtaInfo.profile.userSLA),
+                           &(node->cdtaInfo.profile.slaWeight),
+                           &(node->cdtaInfo.profile.userWeight));
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
 static t_VB_engineErrorCode VbEngineSeedByMacSetLoopCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
 {
   t_VB_engineErrorCode   ret = VB_ENGINE_ERROR_NONE;
@@ -704,6 +738,12 @@ t_VB_engineErrorCode VbEngineDatamodelClusterMemFree(t_VBCluster *vbCluster)
       vbCluster->cdtaData = NULL;
     }
 
+    if(vbCluster->partitionData != NULL)
+    {
+      free(vbCluster->partitionData);
+      vbCluster->partitionData = NULL;
+    }
+
     if(vbCluster->measurePlanData != NULL)
     {
       t_reqMeasurement       *measurement_curr_meas = (t_reqMeasurement *)vbCluster->measurePlanData;
@@ -1359,6 +1399,13 @@ t_VB_engineErrorCode VbEngineBoostModeByMacSet(INT8U *nodeMac, t_vbEngineBoostMo
 
 /*******************************************************************/
 
+t_VB_engineErrorCode VbEngineDatamodelAllNodesProfileUpdate(void)
+{
+  return VbEngineDatamodelAllNodesLoop(VbEngineProfileUpdateLoopCb, NULL);
+}
+
+/*******************************************************************/
+
 t_VB_engineErrorCode VbEngineReqCapacityRatioCalc(INT16U needed, INT16U reference, INT32U *reqCap)
 {
   t_VB_engineErrorCode   ret = VB_ENGINE_ERROR_NONE;
@@ -2037,6 +2084,28 @@ void VbEngineDatamodelMacListRelease(t_nodesMacList *macList)
 
 /*******************************************************************/
 
+void VbEngineDatamodelCrossMeasureSpareRelease( t_crossMeasure *crossMeasure )
+{
+  if (crossMeasure != NULL)
+  {
+    if (crossMeasure->spareRx1 != NULL)
+    {
+      free(crossMeasure->spareRx1);
+      crossMeasure->spareRx1 = NULL;
+    }
+
+    if (crossMeasure->spareRx2 != NULL)
+    {
+      free(crossMeasure->spareRx2);
+      crossMeasure->spareRx2 = NULL;
+    }
+
+    crossMeasure->spareSize = 0;
+  }
+}
+
+/*******************************************************************/
+
 void VbEngineDatamodelNodeCrossMeasureListDestroy( t_crossMeasureList *crossMeasureList )
 {
   INT16U numCrossMeasures;
@@ -2048,6 +2117,7 @@ void VbEngineDatamodelNodeCrossMeasureListDestroy( t_crossMeasureList *crossMeas
       for (numCrossMeasures = 0; numCrossMeasures < crossMeasureList->numCrossMeasures; numCrossMeasures++)
       {
         VbDatamodelNodeProcessMeasureDestroy(&(crossMeasureList->crossMeasureArray[numCrossMeasures].measure));
+        VbEngineDatamodelCrossMeasureSpareRelease(&(crossMeasureList->crossMeasureArray[numCrossMeasures]));
       }
 
       free(crossMeasureList->crossMeasureArray);
@@ -2146,6 +2216,7 @@ t_VB_engineErrorCode VbEngineDatamodelListDomainsDMsAdd(t_VBDriver *driver, INT3
           new_domains[new_dm_idx].dm.measures.snrLowXtalk.measuresRx2   = NULL;
 
           memset(&new_domains[new_dm_idx].dm.channelSettings.boostInfo, 0, sizeof(t_boostInfo));
+          memset(&new_domains[new_dm_idx].dm.channelSettings.cfgSync, 0, sizeof(t_nodeCfgSync));
           new_domains[new_dm_idx].dm.channelSettings.interferenceDetectionCounter = 0;
 
           memset(&new_domains[new_dm_idx].dm.cdtaInfo, 0, sizeof(t_nodeCdtaInfo));
@@ -2262,6 +2333,7 @@ t_VB_engineErrorCode VbEngineDatamodelListDomainsEPsAdd(t_VBDriver *driver, INT3
                 node->channelSettings.psdShape.sendUpdate = FALSE;
 
                 memset(&node->channelSettings.boostInfo, 0, sizeof(t_boostInfo));
+                memset(&node->channelSettings.cfgSync, 0, sizeof(t_nodeCfgSync));
                 node->channelSettings.interferenceDetectionCounter = 0;
 
                 memset(&node->cdtaInfo, 0, sizeof(t_nodeCdtaInfo));
@@ -69,6 +69,10 @@
 #define VB_ENGINE_LAST_LOW_BAND_28MHZ_NUM_CARRIER_IDX    (504)
 #define VB_ENGINE_LAST_LOW_BAND_50MHZ_NUM_CARRIER_IDX    (952)
 #define VB_ENGINE_MAX_FILE_NAME_SIZE                     (50)
+#define VB_ENGINE_CLOCK_MODEL_SAMPLES                    (8)
+#define VB_ENGINE_CFR_RESOLUTION_NUM_LEVELS              (4)   // CFR decimation 1, 2, 4 and 8
+#define VB_ENGINE_MEAS_HISTORY_MAX_DEPTH                 (16)  // Plans kept per measure pair
+#define VB_ENGINE_TRAFFIC_FORECAST_MAX_SLOTS             (96)  // Time of day slots (15 min)
 
 #ifndef ENGINE_DISABLE_METRICS
 #  define VB_ENGINE_METRICS_ENABLED                      (1)
@@ -182,6 +186,18 @@ typedef enum
   VB_ENGINE_COUNTER_MEASURE_PLAN_REJECTED,
   VB_ENGINE_COUNTER_MEASURE_PLAN_SUCCESS,
   VB_ENGINE_COUNTER_MEASURE_PLAN_CANCELLED,
+  VB_ENGINE_COUNTER_MEASURE_PLAN_CFR_DECIMATED,
+  VB_ENGINE_COUNTER_CFR_RECONSTRUCTED,
+  VB_ENGINE_COUNTER_SNR_TRACKING_PROBES,
+  VB_ENGINE_COUNTER_SNR_TRACKING_DEFERRED,
+  VB_ENGINE_COUNTER_SNR_TRACKING_ESCALATED,
+  VB_ENGINE_COUNTER_BOOST_DAMPING_SUPPRESSED,
+  VB_ENGINE_COUNTER_BOOST_DAMPING_MERGED,
+  VB_ENGINE_COUNTER_BOOST_DAMPING_DEFERRED,
+  VB_ENGINE_COUNTER_TRAFFIC_FORECAST_BURSTS,
+  VB_ENGINE_COUNTER_CFR_BUFFERS_ALLOCATED,
+  VB_ENGINE_COUNTER_MEAS_HISTORY_CFR_KEPT,
+  VB_ENGINE_COUNTER_EVENT_SCHED_BLOCKED,
   VB_ENGINE_COUNTER_CDTA_CFG,
   VB_ENGINE_COUNTER_CDTA_FORCE_NO_CHANGE,
   VB_ENGINE_COUNTER_ERR_CREATING_NEW_DRIVER,
@@ -270,6 +286,7 @@ typedef enum {
   VB_ENGINE_ERROR_NO_MEMORY = -36,
   VB_ENGINE_ERROR_NO_AVAILABLE_SEED = -37,
   VB_ENGINE_ERROR_NO_AVAILABLE_DID = -38,
+  VB_ENGINE_ERROR_RESTART_REQUIRED = -39,
 
 } t_VB_engineErrorCode;
 
@@ -377,6 +394,7 @@ typedef enum {
   ENGINE_EV_NETWORK_DIFF_DM_REM,
   ENGINE_EV_ALIVE_SOCK_CHECK,
   ENGINE_EV_RX_ALIVE_SOCK_RSP,
+  ENGINE_EV_CONF_RELOAD,
   ENGINE_EV_LAST,
 
 } t_VB_Comm_Event;
@@ -443,6 +461,29 @@ typedef struct s_cdtaInfo
   t_cdtaUserProfile       profile;
 }t_nodeCdtaInfo;
 
+typedef struct s_trafficForecast
+{
+  BOOLEAN          valid;                                        ///< Model initialized
+  struct timespec  lastUpdate;                                   ///< Time of last report
+  float            level;                                        ///< Deseasonalized demand level (Mbps)
+  float            trend;                                        ///< Demand trend (Mbps/s)
+  float            deviation;                                    ///< Mean absolute one step error (Mbps)
+  INT32U           numSlots;                                     ///< Time of day slots in season
+  float            season[VB_ENGINE_TRAFFIC_FORECAST_MAX_SLOTS]; ///< Seasonal offset per time of day slot (Mbps)
+  BOOLEAN          seasonValid[VB_ENGINE_TRAFFIC_FORECAST_MAX_SLOTS];
+  BOOLEAN          burst;                                        ///< Burst in progress
+  struct timespec  burstStart;
+  INT16U           burstPeak;                                    ///< Peak demand of current burst (Mbps)
+  INT16U           demand;                                       ///< Forecast demand at horizon (Mbps)
+  BOOLEAN          pendingValid;                                 ///< A forecast is waiting to be scored
+  INT16U           pendingForecast;
+  struct timespec  pendingDue;
+  INT32U           numErrors;                                    ///< Forecasts scored
+  double           absErrorSum;                                  ///< Sum of absolute forecast errors (Mbps)
+  double           errorSum;                                     ///< Sum of forecast errors (Mbps)
+  INT32U           numBursts;
+}t_trafficForecast;
+
 typedef struct s_trafficReport
 {
   INT16U  ingressTrafficP0;
@@ -465,6 +506,7 @@ typedef struct s_trafficReport
   INT32U  rxReports;
   INT32U  consecL2XputSmaller;
   BOOLEAN reportsReceived;
+  t_trafficForecast forecast;
 }t_trafficReport;
 
 typedef struct s_bandInfo
@@ -501,6 +543,7 @@ typedef struct s_boostInfo
   INT16U               level;     ///< Amount of bands in use (Bands as defined in engineConf)
   INT16U               levelCnf;  ///< Amount of bands in use (in the CNF Message)
   INT16U               lastLevel; ///< Amount of bands previously in use
+  struct timespec      levelChangeTs; ///< Last level change decided (monotonic clock)
   INT32U               bandsAge[VB_PSD_NUM_BANDS];
   INT16U               perc;      ///< Percentage of spectrum in use
   INT32U               lowBandCapacity;
@@ -508,14 +551,113 @@ typedef struct s_boostInfo
   BOOLEAN              valid;
 } t_boostInfo;
 
+typedef struct s_nodeCfgSync
+{
+  INT32U               version;      ///< Version of the PSD / CDTA configuration computed for the node
+  INT32U               versionSent;  ///< Last version sent to the driver
+  INT32U               versionCnf;   ///< Last version confirmed by the driver (0: not confirmed)
+  INT16U               numPSDBands;
+  t_psdBandLevel       psdBandLevel[VB_PSD_NUM_BANDS];
+  INT32U               maxPhyRateUp;
+  INT32U               maxPhyRateDown;
+} t_nodeCfgSync;
+
 typedef struct s_nodeChannelSettings
 {
   t_psdShape           psdShape;
   t_boostInfo          boostInfo;
+  t_nodeCfgSync        cfgSync;
   INT16U               firstValidCarrier;
   INT8U                interferenceDetectionCounter;
 } t_nodeChannelSettings;
 
+typedef struct s_xtalkSparsity
+{
+  BOOLEAN               valid;                                  ///< TRUE when it matches current CFR list
+  INT16U                numBands;
+  INT16U                bandEnd[VB_PSD_NUM_BANDS];              ///< First measure index out of each band
+  INT16U                numCrossMeasures;                       ///< Size of CFR list analysed (own CFR included)
+  INT16U                numDisturbers;                          ///< Crosstalk CFRs analysed
+  INT16U                numSignificant[VB_PSD_NUM_BANDS];       ///< Significant disturbers per band
+  INT16U                numCfrIdx[VB_PSD_NUM_BANDS];            ///< Valid entries of each cfrIdx band row
+  INT16U               *cfrIdx;                                 ///< Per band, CFR list indexes to accumulate (own CFR and significant disturbers)
+  INT32U                cfrIdxSize;                             ///< Number of allocated entries of cfrIdx
+  float                 residualRx1[VB_PSD_NUM_BANDS];          ///< Folded crosstalk bound per band (fraction of BGN)
+  float                 residualRx2[VB_PSD_NUM_BANDS];          ///< Folded crosstalk bound per band (fraction of BGN)
+} t_xtalkSparsity;
+
+typedef struct s_snrLinearPlane
+{
+  BOOLEAN               valid;                                  ///< TRUE when it matches the measure it was computed from
+  const INT8U          *src;                                    ///< Measure values the plane was computed from
+  INT16U                numValues;
+  INT8U                 planId;
+  INT8S                 compensation;                           ///< Rx gain compensation applied
+  INT16U                capacity;                               ///< Number of allocated values
+  INT16U               *values;                                 ///< Linear power per measure value (bfloat16)
+} t_snrLinearPlane;
+
+typedef struct s_snrLinearCache
+{
+  t_snrLinearPlane      bgn[2];                                 ///< BGN planes of Rx1 and Rx2
+  t_snrLinearPlane     *cfr;                                    ///< Rx1 and Rx2 planes per CFR list entry (none for own CFR)
+  INT32U                numCfr;                                 ///< Number of CFR list entries in cfr
+  INT32U                hits;                                   ///< Planes reused by SNR calculation
+  INT32U                misses;                                 ///< Planes computed by SNR calculation
+} t_snrLinearCache;
+
+typedef enum
+{
+  VB_MEAS_HISTORY_KIND_BGN = 0,
+  VB_MEAS_HISTORY_KIND_CFR,
+  VB_MEAS_HISTORY_KIND_SNR,
+  VB_MEAS_HISTORY_KIND_LAST,
+} t_measHistoryKind;
+
+typedef struct s_measHistoryRecord
+{
+  INT8U                 planId;
+  BOOLEAN               msdValid;                               ///< TRUE when msdDb has been computed
+  float                 meanDb;                                 ///< Mean of plan values (dB)
+  float                 msdDb;                                  ///< Mean squared difference against previous plan (dB^2)
+  INT32U                size;                                   ///< Size of data
+  INT8U                *data;                                   ///< Delta encoding of this plan against next newer one (NULL for newest)
+} t_measHistoryRecord;
+
+typedef struct s_measHistoryPair
+{
+  t_measHistoryKind     kind;
+  INT8U                 MAC[ETH_ALEN];                          ///< Disturber MAC (CFR) or own MAC (BGN, SNR)
+  t_processMeasure      meta;                                   ///< Fields of newest measure (without values)
+  INT32U                numValues;                              ///< Rx1 values followed by Rx2 values if present
+  INT8U                *base;                                   ///< Values of newest plan
+  INT32U                newest;                                 ///< Index of newest plan in records
+  INT32U                numRecords;
+  INT32U                numMissed;                              ///< Consecutive plans without this measure
+  BOOLEAN               stable;                                 ///< Measure can be kept instead of remeasured
+  BOOLEAN               kept;                                   ///< CFR of current plan has been kept from history
+  t_measHistoryRecord   records[VB_ENGINE_MEAS_HISTORY_MAX_DEPTH];
+} t_measHistoryPair;
+
+typedef struct s_measHistory
+{
+  BOOLEAN               recorded;                               ///< TRUE when lastPlanId has been recorded
+  INT8U                 lastPlanId;
+  INT32U                numPairs;
+  t_measHistoryPair    *pairs;
+  INT32U                numBytes;                               ///< Memory used by pairs
+  INT32U                numKept;                                ///< Missing CFRs kept from history
+} t_measHistory;
+
+typedef struct s_snrTrackingInfo
+{
+  BOOLEAN               pending;                                ///< SNR probe requested, response not processed yet
+  BOOLEAN               valid;                                  ///< TRUE when deficit has been computed
+  float                 deficit;                                ///< Mean predicted minus probed SNR (dB) of last probe
+  INT32U                numProbes;
+  INT32U                numOverThr;                             ///< Probes whose deficit exceeded threshold
+} t_snrTrackingInfo;
+
 typedef struct s_node
 {
   INT8U                 MAC[ETH_ALEN];
@@ -525,6 +667,10 @@ typedef struct s_node
   t_nodeAlignInfo       nodeAlignInfo;
   t_additionalInfo1     addInfo1;
   t_nodeMeasures        measures;
+  t_xtalkSparsity       xtalkSparsity;
+  t_snrLinearCache      snrLinearCache;
+  t_measHistory         measHistory;
+  t_snrTrackingInfo     snrTracking;
   t_nodeChannelSettings channelSettings;
   t_trafficReport       trafficReports;
   t_vb_DevState         state;
@@ -551,6 +697,33 @@ typedef struct s_DomainsList
   t_domain *domainsArray;
 } t_domainsList;
 
+typedef struct s_ClockSample
+{
+  struct timespec  ownClock;                                   ///< Own clock when sample was taken
+  INT64S           offsetUs;                                   ///< Driver clock minus own clock (usecs)
+  INT64S           rttNs;                                      ///< RTT of related clock request
+} t_ClockSample;
+
+typedef struct s_ClockModel
+{
+  t_ClockSample    samples[VB_ENGINE_CLOCK_MODEL_SAMPLES];     ///< Last accepted samples (circular)
+  INT32U           numSamples;
+  INT32U           nextSample;
+  BOOLEAN          valid;                                      ///< Enough samples to predict driver clock
+  struct timespec  baseClock;                                  ///< Own clock of last accepted sample
+  double           offsetUs;                                   ///< Estimated offset at baseClock (usecs)
+  double           driftPpm;                                   ///< Estimated offset drift (usecs per sec)
+  double           residualUs;                                 ///< Std deviation of offsets around the model (usecs)
+  double           driftErrPpm;                                ///< Std error of estimated drift (usecs per sec)
+  INT64S           rttMinNs;                                   ///< Min RTT of accepted samples
+  INT64S           rttMaxNs;                                   ///< Max RTT of accepted samples
+  INT32U           consecutiveRejects;
+  INT32U           numRejects;                                 ///< Samples discarded as RTT outliers
+  INT32U           numResets;                                  ///< Model restarts due to clock steps
+  INT32U           pollIntervalMs;                             ///< Current clock request period
+  struct timespec  nextPollTS;                                 ///< Next clock request (monotonic clock)
+} t_ClockModel;
+
 typedef struct s_DriverTime
 {
   pthread_mutex_t  mutex;
@@ -563,8 +736,29 @@ typedef struct s_DriverTime
   INT64S           rttNs;
   INT64S           deviationAbs;
   INT64S           deviationRel;
+  t_ClockModel     model;                                      ///< Offset / drift model of driver clock
 } t_DriverTime;
 
+typedef struct s_DriverEAFlowClass
+{
+  BOOLEAN          limited;                                    ///< Credits advertised for this class (otherwise not flow controlled)
+  INT32U           granted;                                    ///< Credits granted since connection
+  INT32U           received;                                   ///< Frames received since connection
+  INT32U           consumed;                                   ///< Frames dispatched by engine process since connection
+  INT32U           grants;                                     ///< Credit frames sent
+  INT32U           overruns;                                   ///< Frames received with no credit left
+  INT32U           stalls;                                     ///< Times the driver ran out of credits
+  BOOLEAN          stalled;
+  struct timespec  stallStartTs;
+  INT64U           stallSum;                                   ///< Time without credits (usecs)
+  INT32U           stallMax;                                   ///< Longest time without credits (usecs)
+} t_DriverEAFlowClass;
+
+typedef struct s_DriverEAFlow
+{
+  t_DriverEAFlowClass classes[VB_EA_FLOW_CLASS_LAST];
+} t_DriverEAFlow;
+
 
 typedef struct
 {
@@ -599,6 +793,7 @@ struct s_VBDriver
   CHAR                       remoteStateFileName[VB_ENGINE_MAX_FILE_NAME_SIZE];
   CHAR                       fsmStateFileName[VB_ENGINE_MAX_FILE_NAME_SIZE];
   t_DriverTime               time;
+  t_DriverEAFlow             eaFlow;
   t_TimeoutCnf               timeoutCnf;
   INT32U                     attempts;
   INT32U                     transactionMinTime;
@@ -633,6 +828,50 @@ typedef struct
   struct timespec lastAlignCheck;
 }t_vbEngineClusterInfo;
 
+typedef struct s_cfrResolution
+{
+  INT8U                 decimationLog2;                                   ///< CFR decimation (log2) to request in next plans
+  INT8U                 planDecimationLog2;                               ///< CFR decimation (log2) requested in current plan
+  INT32U                plansLeft;                                        ///< Decimated plans left before next full resolution plan
+  BOOLEAN               errorValid;                                       ///< TRUE when errorDb has been estimated
+  float                 errorDb[VB_ENGINE_CFR_RESOLUTION_NUM_LEVELS];     ///< Worst SNR error per decimation level (last full resolution plan)
+} t_cfrResolution;
+
+typedef struct s_snrTracking
+{
+  INT32U                nextNode;                                         ///< Rotation index of next node to probe
+  struct timespec       lastRound;
+  struct timespec       lastEscalation;
+  INT32U                numRounds;
+  INT32U                numProbed;                                        ///< Nodes probed by rotation
+  INT32U                numEscalations;                                   ///< Measure plans requested by tracking
+} t_snrTracking;
+
+typedef struct s_measHistoryInfo
+{
+  INT32U                depth;                                            ///< Plans kept per pair after applying memory budget
+  INT32U                numPlans;                                         ///< Plans recorded
+  INT32U                numPairs;
+  INT32U                numStable;                                        ///< Pairs flagged as stable
+  INT32U                numBytes;
+  INT32U                numTrimmed;                                       ///< Plans dropped to fit memory budget
+  INT32U                numKept;                                          ///< Missing CFRs kept from history
+} t_measHistoryInfo;
+
+typedef struct s_boostDamping
+{
+  BOOLEAN               pending;                                          ///< Reconfiguration held by damping
+  BOOLEAN               qosRatePending;                                   ///< Held reconfiguration includes a QoS rate change
+  INT32U                pendingWindow;                                    ///< Apply window where held reconfiguration was first seen
+  INT32U                tokens;                                           ///< Reconfigurations allowed (thousandths)
+  struct timespec       lastRefill;
+  struct timespec       lastApply;
+  INT32U                numApplied;
+  INT32U                numDeferred;                                      ///< Boost runs whose reconfiguration was held
+  INT32U                numSuppressed;                                    ///< Node level changes suppressed by node dwell time
+  INT32U                numMerged;                                        ///< Node level changes replacing a pending one
+} t_boostDamping;
+
 typedef struct s_VBCluster t_VBCluster;
 
 struct s_VBCluster
@@ -640,6 +879,7 @@ struct s_VBCluster
   t_linkedElement            l;
   void                       *measurePlanData;
   void                       *cdtaData;
+  void                       *partitionData;
   INT8U                      *confReqBuffer;
   INT32U                     confReqBufferLen;
   struct timespec            applyOwnTs;
@@ -652,6 +892,10 @@ struct s_VBCluster
   BOOLEAN                    skipMeasPlan;
   BOOLEAN                    syncLostFlag;
   t_vbEngineClusterInfo      clusterInfo;
+  t_cfrResolution            cfrResolution;
+  t_snrTracking              snrTracking;
+  t_boostDamping             boostDamping;
+  t_measHistoryInfo          measHistory;
 };
 
 typedef struct s_VBDMsHistoryItem t_VBDMsHistoryItem;
@@ -802,6 +1046,13 @@ t_VB_engineErrorCode VbEngineDatamodelNodeFind(t_VBDriver *driver, const INT8U *
  **/
 t_VB_engineErrorCode VbEngineBoostModeByMacSet(INT8U *nodeMac, t_vbEngineBoostMode boostMode);
 
+/**
+ * @brief Reloads the user profile (SLA and weights) of all nodes from configuration
+ * @return @ref t_VB_engineErrorCode
+ * @remarks Domains mutex is grabbed inside this function
+ **/
+t_VB_engineErrorCode VbEngineDatamodelAllNodesProfileUpdate(void);
+
 /**
  * @brief Calculates the required capacity ratio of a given node
  * @param[in] node Pointer to node
@@ -931,6 +1182,12 @@ t_VB_engineErrorCode VbEngineDatamodelAllNodesMacGet(t_nodesMacList *macList, BO
  **/
 void VbEngineDatamodelMacListRelease(t_nodesMacList *macList);
 
+/**
+ * @brief Releases the buffers kept from a previous plan for reuse by next CFR
+ * @param[in] crossMeasure Pointer to cross measure
+ **/
+void VbEngineDatamodelCrossMeasureSpareRelease( t_crossMeasure *crossMeasure );
+
 /**
  * @brief Releases allocated memory for given cross measure list
  * @param[in] crossMeasureList Pointer to cross measure list to release
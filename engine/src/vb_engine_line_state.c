@@ -0,0 +1,648 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_line_state.c
+ * @brief Line state shared memory table (engine side)
+ *
+ * @internal
+ *
+ * The engine is the only writer of the table. Every main timer period all
+ * nodes are visited; a private MAC -> slot hash keeps each node in the same
+ * slot while present, and slots of nodes that disappear are reused.
+ *
+ * @author
+ * @date 2026-10-17
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "types.h"
+
+#include "vb_log.h"
+#include "vb_util.h"
+#include "vb_mac_utils.h"
+#include "vb_line_state.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_drivers_list.h"
+#include "vb_engine_line_state.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define LINE_STATE_HASH_EMPTY                        (-1)
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  INT32U numRefreshes;
+  INT32U numAdded;
+  INT32U numRemoved;
+  INT32U numOverflows;
+  INT32U numValid;
+  INT32U lastRefreshUs;
+  INT32U maxRefreshUs;
+} t_lineStateStats;
+
+typedef struct
+{
+  CHAR                 shmName[VB_QUEUE_NAME_LEN];
+  INT32S               fd;
+  size_t               mapSize;
+  t_vbLineStateHeader *header;
+  t_vbLineStateEntry  *entries;
+  INT32S              *hashTable;      ///< MAC -> slot (open addressing, linear probing)
+  INT32U               hashMask;
+  INT32U              *slotPass;       ///< Refresh pass in which each slot was last seen
+  INT32U              *freeSlots;      ///< Stack of released slots
+  INT32U               numFree;
+  INT32U               pass;
+  INT64U               passNs;
+  t_lineStateStats     stats;
+} t_lineState;
+
+/*
+ ************************************************************************
+ ** Private variables
+ ************************************************************************
+ */
+
+static t_lineState     vbLineState = { .fd = -1 };
+static pthread_mutex_t vbLineStateMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+static INT64U LineStateTimeNsGet(clockid_t clockId)
+{
+  struct timespec ts;
+
+  clock_gettime(clockId, &ts);
+
+  return ((INT64U)ts.tv_sec * 1000000000ULL) + (INT64U)ts.tv_nsec;
+}
+
+/*******************************************************************/
+
+static INT32U LineStateHash(const INT8U *mac)
+{
+  INT32U hash = 2166136261U;
+  INT32U i;
+
+  // FNV-1a
+  for (i = 0; i < ETH_ALEN; i++)
+  {
+    hash ^= mac[i];
+    hash *= 16777619U;
+  }
+
+  return hash & vbLineState.hashMask;
+}
+
+/*******************************************************************/
+
+static INT32S LineStateHashFind(const INT8U *mac, INT32U *pos)
+{
+  INT32U idx = LineStateHash(mac);
+  INT32S slot;
+
+  while ((slot = vbLineState.hashTable[idx]) != LINE_STATE_HASH_EMPTY)
+  {
+    if (memcmp(vbLineState.entries[slot].MAC, mac, ETH_ALEN) == 0)
+    {
+      break;
+    }
+
+    idx = (idx + 1) & vbLineState.hashMask;
+  }
+
+  // Returns position found or first empty position in probe sequence
+  *pos = idx;
+
+  return slot;
+}
+
+/*******************************************************************/
+
+static void LineStateHashRemove(INT32U pos)
+{
+  INT32U next = pos;
+  INT32U home;
+
+  // Backward shift deletion: keeps probe sequences intact without tombstones
+  vbLineState.hashTable[pos] = LINE_STATE_HASH_EMPTY;
+
+  for (;;)
+  {
+    next = (next + 1) & vbLineState.hashMask;
+
+    if (vbLineState.hashTable[next] == LINE_STATE_HASH_EMPTY)
+    {
+      break;
+    }
+
+    home = LineStateHash(vbLineState.entries[vbLineState.hashTable[next]].MAC);
+
+    // Move entry back if its home position is not cyclically in (pos, next]
+    if (((next > pos) && ((home <= pos) || (home > next))) ||
+        ((next < pos) && ((home <= pos) && (home > next))))
+    {
+      vbLineState.hashTable[pos] = vbLineState.hashTable[next];
+      vbLineState.hashTable[next] = LINE_STATE_HASH_EMPTY;
+      pos = next;
+    }
+  }
+}
+
+/*******************************************************************/
+
+static INT32S LineStateSlotAlloc(void)
+{
+  INT32S slot = -1;
+
+  if (vbLineState.numFree > 0)
+  {
+    vbLineState.numFree--;
+    slot = vbLineState.freeSlots[vbLineState.numFree];
+  }
+  else if (vbLineState.header->numEntries < vbLineState.header->maxEntries)
+  {
+    slot = vbLineState.header->numEntries;
+  }
+
+  return slot;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode LineStateNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  t_vbLineStateEntry  *entry;
+  INT32U               pos;
+  INT32S               slot;
+  BOOLEAN              new_entry = FALSE;
+  INT16U               payload_max;
+  INT16U               current_payload;
+
+  if ((driver == NULL) || (domain == NULL) || (node == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    slot = LineStateHashFind(node->MAC, &pos);
+
+    if (slot == LINE_STATE_HASH_EMPTY)
+    {
+      slot = LineStateSlotAlloc();
+
+      if (slot < 0)
+      {
+        // Table full, node is not published
+        vbLineState.stats.numOverflows++;
+        ret = VB_ENGINE_ERROR_NO_MEMORY;
+      }
+      else
+      {
+        vbLineState.hashTable[pos] = slot;
+        new_entry = TRUE;
+      }
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    entry = &(vbLineState.entries[slot]);
+
+    VbEngineLineStatePayloadGet(node, &payload_max, &current_payload);
+
+    VbLineStateEntryWriteBegin(entry);
+
+    if (new_entry == TRUE)
+    {
+      MACAddrClone(entry->MAC, node->MAC);
+      entry->valid = TRUE;
+      entry->lastChangeNs = vbLineState.passNs;
+    }
+    else if (entry->boostLevel != node->channelSettings.boostInfo.level)
+    {
+      entry->lastChangeNs = vbLineState.passNs;
+    }
+
+    entry->type = (INT8U)node->type;
+    entry->boostLevel = node->channelSettings.boostInfo.level;
+    entry->boostPerc = node->channelSettings.boostInfo.perc;
+    entry->payloadMax = payload_max;
+    entry->currentPayload = current_payload;
+    entry->clusterId = driver->clusterId;
+    entry->lastUpdateNs = vbLineState.passNs;
+    strncpy(entry->driverId, driver->vbDriverID, VB_LINE_STATE_DRIVER_ID_LEN - 1);
+    entry->driverId[VB_LINE_STATE_DRIVER_ID_LEN - 1] = '\0';
+
+    VbLineStateEntryWriteEnd(entry);
+
+    vbLineState.slotPass[slot] = vbLineState.pass;
+
+    if (new_entry == TRUE)
+    {
+      if ((INT32U)slot >= vbLineState.header->numEntries)
+      {
+        // Publish new high water mark once entry is complete
+        vbLineState.header->numEntries = slot + 1;
+      }
+
+      vbLineState.stats.numAdded++;
+    }
+  }
+  else if (ret == VB_ENGINE_ERROR_NO_MEMORY)
+  {
+    // Keep looping over remaining nodes
+    ret = VB_ENGINE_ERROR_NONE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void LineStateStaleEntriesRemove(void)
+{
+  t_vbLineStateEntry *entry;
+  INT32U              slot;
+  INT32U              pos;
+  INT32U              num_valid = 0;
+
+  for (slot = 0; slot < vbLineState.header->numEntries; slot++)
+  {
+    entry = &(vbLineState.entries[slot]);
+
+    if (entry->valid == FALSE)
+    {
+      continue;
+    }
+
+    if (vbLineState.slotPass[slot] == vbLineState.pass)
+    {
+      num_valid++;
+      continue;
+    }
+
+    if (LineStateHashFind(entry->MAC, &pos) == (INT32S)slot)
+    {
+      LineStateHashRemove(pos);
+    }
+
+    VbLineStateEntryWriteBegin(entry);
+    entry->valid = FALSE;
+    entry->lastChangeNs = vbLineState.passNs;
+    VbLineStateEntryWriteEnd(entry);
+
+    vbLineState.freeSlots[vbLineState.numFree++] = slot;
+    vbLineState.stats.numRemoved++;
+  }
+
+  vbLineState.stats.numValid = num_valid;
+}
+
+/*******************************************************************/
+
+static void LineStateResourcesFree(void)
+{
+  if (vbLineState.header != NULL)
+  {
+    munmap(vbLineState.header, vbLineState.mapSize);
+    vbLineState.header = NULL;
+    vbLineState.entries = NULL;
+  }
+
+  if (vbLineState.fd >= 0)
+  {
+    close(vbLineState.fd);
+    shm_unlink(vbLineState.shmName);
+    vbLineState.fd = -1;
+  }
+
+  free(vbLineState.hashTable);
+  free(vbLineState.slotPass);
+  free(vbLineState.freeSlots);
+  vbLineState.hashTable = NULL;
+  vbLineState.slotPass = NULL;
+  vbLineState.freeSlots = NULL;
+}
+
+/*******************************************************************/
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineLineStateInit(INT32U updatePeriodMs)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT32U               max_lines;
+  INT32U               hash_size = 1;
+
+  if (VbEngineConfLineStateEnableGet() == FALSE)
+  {
+    return VB_ENGINE_ERROR_NONE;
+  }
+
+  pthread_mutex_lock(&vbLineStateMutex);
+
+  LineStateResourcesFree();
+  bzero(&vbLineState, sizeof(vbLineState));
+  vbLineState.fd = -1;
+
+  max_lines = VbEngineConfLineStateMaxLinesGet();
+
+  // Hash table with load factor <= 0.5
+  while (hash_size < (2 * max_lines))
+  {
+    hash_size <<= 1;
+  }
+
+  vbLineState.hashMask = hash_size - 1;
+  vbLineState.hashTable = malloc(hash_size * sizeof(INT32S));
+  vbLineState.slotPass = calloc(max_lines, sizeof(INT32U));
+  vbLineState.freeSlots = malloc(max_lines * sizeof(INT32U));
+
+  if ((vbLineState.hashTable == NULL) || (vbLineState.slotPass == NULL) || (vbLineState.freeSlots == NULL))
+  {
+    ret = VB_ENGINE_ERROR_NO_MEMORY;
+  }
+  else
+  {
+    memset(vbLineState.hashTable, 0xFF, hash_size * sizeof(INT32S));
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    VbLineStateShmNameBuild(VbEngineConfEngineIdGet(), vbLineState.shmName);
+    vbLineState.mapSize = VbLineStateTableSizeGet(max_lines);
+
+    // Remove stale object left by a previous instance
+    shm_unlink(vbLineState.shmName);
+
+    vbLineState.fd = shm_open(vbLineState.shmName, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+    if (vbLineState.fd < 0)
+    {
+      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error creating shared memory %s (%s)", vbLineState.shmName, strerror(errno));
+      ret = VB_ENGINE_ERROR_UNKNOWN;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    if (ftruncate(vbLineState.fd, vbLineState.mapSize) != 0)
+    {
+      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error sizing shared memory %s (%s)", vbLineState.shmName, strerror(errno));
+      ret = VB_ENGINE_ERROR_UNKNOWN;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    void *map;
+
+    map = mmap(NULL, vbLineState.mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, vbLineState.fd, 0);
+
+    if (map == MAP_FAILED)
+    {
+      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error mapping shared memory %s (%s)", vbLineState.shmName, strerror(errno));
+      ret = VB_ENGINE_ERROR_UNKNOWN;
+    }
+    else
+    {
+      vbLineState.header = (t_vbLineStateHeader *)map;
+      vbLineState.entries = (t_vbLineStateEntry *)((INT8U *)map + sizeof(t_vbLineStateHeader));
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    t_vbLineStateHeader *header = vbLineState.header;
+
+    header->version = VB_LINE_STATE_LAYOUT_VERSION;
+    header->headerSize = sizeof(t_vbLineStateHeader);
+    header->entrySize = sizeof(t_vbLineStateEntry);
+    header->maxEntries = max_lines;
+    header->numEntries = 0;
+    header->lastUpdateNs = 0;
+    header->updatePeriodMs = updatePeriodMs;
+    header->writerPid = getpid();
+    strncpy(header->engineId, VbEngineConfEngineIdGet(), VB_ENGINE_ID_MAX_SIZE - 1);
+
+    // Magic is set last, readers reject the table until it is complete
+    __sync_synchronize();
+    header->magic = VB_LINE_STATE_MAGIC;
+
+    VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Line state table %s created (%u lines, %lu bytes)",
+        vbLineState.shmName, max_lines, (long unsigned int)vbLineState.mapSize);
+  }
+  else
+  {
+    LineStateResourcesFree();
+  }
+
+  pthread_mutex_unlock(&vbLineStateMutex);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEngineLineStateRelease(void)
+{
+  pthread_mutex_lock(&vbLineStateMutex);
+  LineStateResourcesFree();
+  pthread_mutex_unlock(&vbLineStateMutex);
+}
+
+/*******************************************************************/
+
+t_VB_engineErrorCode VbEngineLineStateRefresh(void)
+{
+  t_VB_engineErrorCode ret = VB_ENGINE_ERROR_NONE;
+  INT64U               start_ns;
+  INT32U               elapsed_us;
+
+  pthread_mutex_lock(&vbLineStateMutex);
+
+  if (vbLineState.header != NULL)
+  {
+    start_ns = LineStateTimeNsGet(CLOCK_MONOTONIC);
+
+    vbLineState.pass++;
+    vbLineState.passNs = LineStateTimeNsGet(CLOCK_REALTIME);
+
+    ret = VbEngineDatamodelAllNodesLoop(LineStateNodeCb, NULL);
+
+    if (ret == VB_ENGINE_ERROR_NONE)
+    {
+      // Only sweep after a complete pass, otherwise present nodes could be removed
+      LineStateStaleEntriesRemove();
+
+      __sync_synchronize();
+      vbLineState.header->lastUpdateNs = vbLineState.passNs;
+    }
+
+    elapsed_us = (INT32U)((LineStateTimeNsGet(CLOCK_MONOTONIC) - start_ns) / 1000);
+
+    vbLineState.stats.numRefreshes++;
+    vbLineState.stats.lastRefreshUs = elapsed_us;
+    vbLineState.stats.maxRefreshUs = MAX(vbLineState.stats.maxRefreshUs, elapsed_us);
+  }
+
+  pthread_mutex_unlock(&vbLineStateMutex);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+void VbEngineLineStatePayloadGet(const t_node *node, INT16U *payloadMax, INT16U *currentPayload)
+{
+  if ((node != NULL) && (payloadMax != NULL) && (currentPayload != NULL))
+  {
+    *payloadMax = (node->channelSettings.boostInfo.maxCapacity * node->trafficReports.macEfficiency) / 100;
+    *currentPayload = node->trafficReports.ingressTrafficP0 + node->trafficReports.ingressTrafficP1 +
+        node->trafficReports.ingressTrafficP2 + node->trafficReports.ingressTrafficP3;
+  }
+}
+
+/*******************************************************************/
+
+BOOL VbEngineLineStateConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  BOOL ret = FALSE;
+  BOOL show_help = FALSE;
+
+  if (cmd[1] == NULL)
+  {
+    pthread_mutex_lock(&vbLineStateMutex);
+
+    if (vbLineState.header == NULL)
+    {
+      writeFun("Line state table disabled\n");
+    }
+    else
+    {
+      writeFun("===================================================\n");
+      writeFun("| %-28s | %16s |\n", "Shared memory",       vbLineState.shmName);
+      writeFun("| %-28s | %16lu |\n", "Size (bytes)",       (long unsigned int)vbLineState.mapSize);
+      writeFun("| %-28s | %16u |\n", "Max entries",         vbLineState.header->maxEntries);
+      writeFun("| %-28s | %16u |\n", "Used entries",        vbLineState.header->numEntries);
+      writeFun("| %-28s | %16u |\n", "Valid entries",       vbLineState.stats.numValid);
+      writeFun("| %-28s | %16u |\n", "Free slots",          vbLineState.numFree);
+      writeFun("| %-28s | %16u |\n", "Refreshes",           vbLineState.stats.numRefreshes);
+      writeFun("| %-28s | %16u |\n", "Added",               vbLineState.stats.numAdded);
+      writeFun("| %-28s | %16u |\n", "Removed",             vbLineState.stats.numRemoved);
+      writeFun("| %-28s | %16u |\n", "Overflows",           vbLineState.stats.numOverflows);
+      writeFun("| %-28s | %16u |\n", "Last refresh (us)",   vbLineState.stats.lastRefreshUs);
+      writeFun("| %-28s | %16u |\n", "Max refresh (us)",    vbLineState.stats.maxRefreshUs);
+      writeFun("===================================================\n");
+    }
+
+    pthread_mutex_unlock(&vbLineStateMutex);
+    ret = TRUE;
+  }
+  else if (!strcmp(cmd[1], "r"))
+  {
+    pthread_mutex_lock(&vbLineStateMutex);
+    vbLineState.stats.numAdded = 0;
+    vbLineState.stats.numRemoved = 0;
+    vbLineState.stats.numOverflows = 0;
+    vbLineState.stats.maxRefreshUs = 0;
+    pthread_mutex_unlock(&vbLineStateMutex);
+    ret = TRUE;
+  }
+  else if (!strcmp(cmd[1], "h"))
+  {
+    show_help = TRUE;
+    ret = TRUE;
+  }
+
+  if ((ret == FALSE) || (show_help == TRUE))
+  {
+    writeFun("Usage:\n");
+    writeFun("linestate h     : Shows this help\n");
+    writeFun("linestate       : Shows line state shared memory table info\n");
+    writeFun("linestate r     : Resets line state statistics\n");
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/
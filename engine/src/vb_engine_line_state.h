@@ -0,0 +1,101 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_line_state.h
+ * @brief Line state shared memory table (engine side)
+ *
+ * @internal
+ *
+ * @author
+ * @date 2026-10-17
+ *
+ **/
+
+#ifndef VB_ENGINE_LINE_STATE_H_
+#define VB_ENGINE_LINE_STATE_H_
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include "vb_engine_datamodel.h"
+#include "vb_console.h"
+
+/*
+ ************************************************************************
+ ** Public function definition
+ ************************************************************************
+ */
+
+/**
+ * @brief Creates and maps the line state shared memory table (if enabled in vb_engine.ini)
+ * @param[in] updatePeriodMs Nominal refresh period
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineLineStateInit(INT32U updatePeriodMs);
+
+/**
+ * @brief Unmaps and removes the line state shared memory table
+ **/
+void VbEngineLineStateRelease(void);
+
+/**
+ * @brief Refreshes the line state table with the current state of all nodes.
+ * Entries of nodes no longer present are invalidated.
+ * @return @ref t_VB_engineErrorCode
+ **/
+t_VB_engineErrorCode VbEngineLineStateRefresh(void);
+
+/**
+ * @brief Calculates the payload figures reported for a given node
+ * @param[in] node Node
+ * @param[out] payloadMax Max L2 xput (Mbps)
+ * @param[out] currentPayload Current ingress traffic (Mbps)
+ **/
+void VbEngineLineStatePayloadGet(const t_node *node, INT16U *payloadMax, INT16U *currentPayload);
+
+/**
+ * @brief Console command to show line state table info
+ **/
+BOOL VbEngineLineStateConsoleCmd(void *arg, t_writeFun writeFun, char **cmd);
+
+#endif /* VB_ENGINE_LINE_STATE_H_ */
+
+/**
+ * @}
+ **/
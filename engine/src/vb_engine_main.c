@@ -76,6 +76,8 @@
 #include "vb_engine_cluster_list.h"
 #include "vb_engine_measure.h"
 #include "vb_engine_alignment.h"
+#include "vb_file_writer.h"
+#include "vb_engine_meas_stream.h"
 #include "vb_util.h"
 
 /*
@@ -185,6 +187,18 @@ static const char *VB_COUNTERS_NAME[] =
         "MEASURE_PLAN_REJECTED",
         "MEASURE_PLAN_SUCCESS",
         "MEASURE_PLAN_CANCELLED",
+        "MEASURE_PLAN_CFR_DECIMATED",
+        "CFR_RECONSTRUCTED",
+        "SNR_TRACKING_PROBES",
+        "SNR_TRACKING_DEFERRED",
+        "SNR_TRACKING_ESCALATED",
+        "BOOST_DAMPING_SUPPRESSED",
+        "BOOST_DAMPING_MERGED",
+        "BOOST_DAMPING_DEFERRED",
+        "TRAFFIC_FORECAST_BURSTS",
+        "CFR_BUFFERS_ALLOCATED",
+        "MEAS_HISTORY_CFR_KEPT",
+        "EVENT_SCHED_BLOCKED",
         "CDTA_CFG",
         "CDTA_FORCE_NO_CHANGE",
         "ERR_CREATING_NEW_DRIVER",
@@ -309,6 +323,10 @@ static void VbEngineSignalHandler(INT32U signum)
   {
     VbEngineKill();
   }
+  else if (signum == SIGHUP)
+  {
+    VbEngineProcessConfReload(NULL, 0);
+  }
 }
 
 /*******************************************************************/
@@ -367,6 +385,26 @@ static t_VB_engineErrorCode ComponentsInit(void)
     ret = VB_ENGINE_ERROR_NOT_STARTED;
   }
 
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Place threads in their classes (CPU set, scheduling policy and cgroup); failures are only logged
+    VbThreadPlacementConfSet(VbEngineConfThreadPlacementGet());
+
+    // Init file writer used by all reports
+    err = VbFileWriterInit(VbEngineConfOutputPathGet(), VbEngineConfFileWriterGet());
+
+    if (err != VB_FILE_WRITER_ERROR_NONE)
+    {
+      ret = VB_ENGINE_ERROR_NOT_STARTED;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    // Init measurement stream (only when enabled)
+    ret = VbEngineMeasStreamInit(VbEngineConfMeasStreamGet());
+  }
+
   if (ret == VB_ENGINE_ERROR_NONE)
   {
     // Init clock monitor
@@ -402,6 +440,26 @@ static t_VB_engineErrorCode ComponentsStart(void)
     ret = VB_ENGINE_ERROR_NOT_STARTED;
   }
 
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    running = VbFileWriterRun();
+
+    if (running == FALSE)
+    {
+      ret = VB_ENGINE_ERROR_NOT_STARTED;
+    }
+  }
+
+  if (ret == VB_ENGINE_ERROR_NONE)
+  {
+    running = VbEngineMeasStreamRun();
+
+    if (running == FALSE)
+    {
+      ret = VB_ENGINE_ERROR_NOT_STARTED;
+    }
+  }
+
   if (ret == VB_ENGINE_ERROR_NONE)
   {
     VbEngineDatamodelStart();
@@ -489,6 +547,10 @@ static void ComponentsStop(void)
   VbEngineProcessProtocolThreadStop();
   VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Process thread closed!");
 
+  VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Closing measure stream thread...");
+  VbEngineMeasStreamStop();
+  VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Measure stream thread closed!");
+
   // Stop console thread
   VbConsoleStop();
 
@@ -504,6 +566,10 @@ static void ComponentsStop(void)
   VbEngineCltListClustersDestroy();
 
   // Stop Log thread
+  VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Closing file writer thread...");
+  VbFileWriterStop();
+  VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "File writer thread closed!");
+
   VbLogStop();
   // From this point we should use "printf" instead of VbLogPrint
 
@@ -59,6 +59,8 @@
 #include "vb_thread.h"
 #include "vb_engine_main_timer.h"
 #include "vb_engine_drivers_list.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_line_state.h"
 
 /*
  ************************************************************************
@@ -107,9 +109,7 @@ static t_VB_engineErrorCode StateInfoToFilesCb(t_VBDriver *driver, t_domain *dom
     INT16U               max_xput;
     INT16U               current_xput;
 
-    max_xput = (node->channelSettings.boostInfo.maxCapacity * node->trafficReports.macEfficiency) / 100;
-    current_xput = node->trafficReports.ingressTrafficP0 + node->trafficReports.ingressTrafficP1 +
-        node->trafficReports.ingressTrafficP2 + node->trafficReports.ingressTrafficP3;
+    VbEngineLineStatePayloadGet(node, &max_xput, &current_xput);
 
     VbLogSaveStringToTextFile(node->stateFileName, "w+",
         "LineStatus=%u (%u%);PayloadMax=%d;CurrentPayload=%d\n",
@@ -127,12 +127,23 @@ static void VbEngineMainTimerCb(sigval_t sigval)
 {
   t_VB_engineErrorCode err;
 
-  // Save channel info to disk
-  err = VbEngineDatamodelAllNodesLoop(StateInfoToFilesCb, NULL);
+  // Publish channel info in shared memory table
+  err = VbEngineLineStateRefresh();
 
   if (err != VB_ENGINE_ERROR_NONE)
   {
-    VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error %d dumping drivers info to files", err);
+    VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error %d refreshing line state table", err);
+  }
+
+  if (VbEngineConfLineStateTextFilesGet() == TRUE)
+  {
+    // Legacy exporter: save channel info to disk
+    err = VbEngineDatamodelAllNodesLoop(StateInfoToFilesCb, NULL);
+
+    if (err != VB_ENGINE_ERROR_NONE)
+    {
+      VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error %d dumping drivers info to files", err);
+    }
   }
 }
 
@@ -157,6 +168,14 @@ BOOL VbEngineMainTimerRun(void)
 
   VbLogPrintExt(VB_LOG_INFO, VB_ENGINE_ALL_DRIVERS_STR, "Starting timer");
 
+  err = VbEngineLineStateInit(MAIN_TIMER_PERIOD);
+
+  if (err != VB_ENGINE_ERROR_NONE)
+  {
+    // Not fatal, timer still runs legacy exporter if enabled
+    VbLogPrintExt(VB_LOG_ERROR, VB_ENGINE_ALL_DRIVERS_STR, "Error %d creating line state table", err);
+  }
+
   // Create periodic task
   err = TimerPeriodicTaskSet(MAIN_TIMER_NAME, MAIN_TIMER_PERIOD, VbEngineMainTimerCb, NULL, &vbMainTimerId);
 
@@ -190,6 +209,8 @@ void VbEngineMainTimerStop(void)
       vbMainTimerEnabled = FALSE;
     }
   }
+
+  VbEngineLineStateRelease();
 }
 
 /*******************************************************************/
@@ -66,6 +66,7 @@
 #include "vb_engine_conf.h"
 #include "vb_engine_alignment_metrics.h"
 #include "vb_log.h"
+#include "vb_file_writer.h"
 
 /*
  ************************************************************************
@@ -1610,7 +1611,7 @@ void VbEngineDumpMetricsToFiles()
         VbMetricsTrafficHistReport(&ptr_to_write, &remaining_size);
 
         // Save to file
-        VbLogSaveBufferToTextFile(file_path, "w+", VB_METRICS_OUTPUT_BUFFER_SIZE, buffer);
+        VbFileWriterWrite(file_path, TRUE, buffer, strnlen(buffer, VB_METRICS_OUTPUT_BUFFER_SIZE));
       }
 
       if (vbMetricsEnableCPUTimingMetrics)
@@ -1629,7 +1630,7 @@ void VbEngineDumpMetricsToFiles()
         VbMetricsCPUCalculationReport(&ptr_to_write, &remaining_size);
 
         // Save to file
-        VbLogSaveBufferToTextFile(file_path, "w+", VB_METRICS_OUTPUT_BUFFER_SIZE, buffer);
+        VbFileWriterWrite(file_path, TRUE, buffer, strnlen(buffer, VB_METRICS_OUTPUT_BUFFER_SIZE));
       }
     }
     else
@@ -0,0 +1,824 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_engine_query.c
+ * @brief Structured (JSON) queries of engine state
+ *
+ * @internal
+ *
+ * @author
+ * @date 17/10/2026
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <arpa/inet.h>
+
+#include "types.h"
+
+#include "vb_util.h"
+#include "vb_counters.h"
+#include "vb_mac_utils.h"
+#include "vb_engine_datamodel.h"
+#include "vb_engine_drivers_list.h"
+#include "vb_engine_cluster_list.h"
+#include "vb_engine_process.h"
+#include "vb_engine_cdta.h"
+#include "vb_engine_conf.h"
+#include "vb_engine_query.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define QUERY_JSON_MAX_DEPTH                         (8)
+#define QUERY_JSON_BUFFER_SIZE                       (256)   // Shall be lower than VB_CONSOLE_BUFFER_SIZE
+#define QUERY_MAX_FIELDS                             (32)
+#define QUERY_RECORD_DEPTH                           (3)     // Root object -> "items" array -> item object
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  t_writeFun   writeFun;
+  CHAR         buffer[QUERY_JSON_BUFFER_SIZE];
+  INT32U       len;
+  INT32U       depth;
+  BOOL         first[QUERY_JSON_MAX_DEPTH + 1];
+  INT32U       skipDepth;                       ///< Depth of the container being skipped (0: none)
+  const CHAR  *fields[QUERY_MAX_FIELDS];
+  INT32U       numFields;
+} t_queryJson;
+
+typedef struct
+{
+  t_queryJson  json;
+  const CHAR  *driverId;
+  BOOL         clusterFilter;
+  INT32S       clusterId;
+  BOOL         macFilter;
+  INT8U        mac[ETH_ALEN];
+  INT32U       numItems;
+} t_queryArgs;
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+static void QueryJsonFlush(t_queryJson *json)
+{
+  if (json->len > 0)
+  {
+    json->buffer[json->len] = '\0';
+    json->writeFun("%s", json->buffer);
+    json->len = 0;
+  }
+}
+
+/*******************************************************************/
+
+static void QueryJsonRaw(t_queryJson *json, const CHAR *str, INT32U len)
+{
+  INT32U chunk;
+
+  while (len > 0)
+  {
+    if (json->len == (QUERY_JSON_BUFFER_SIZE - 1))
+    {
+      QueryJsonFlush(json);
+    }
+
+    chunk = MIN(len, (QUERY_JSON_BUFFER_SIZE - 1) - json->len);
+    memcpy(json->buffer + json->len, str, chunk);
+    json->len += chunk;
+    str += chunk;
+    len -= chunk;
+  }
+}
+
+/*******************************************************************/
+
+static void QueryJsonStrRaw(t_queryJson *json, const CHAR *str)
+{
+  CHAR esc[8];
+
+  QueryJsonRaw(json, "\"", 1);
+
+  for (; (str != NULL) && (*str != '\0'); str++)
+  {
+    if ((*str == '"') || (*str == '\\'))
+    {
+      esc[0] = '\\';
+      esc[1] = *str;
+      QueryJsonRaw(json, esc, 2);
+    }
+    else if ((INT8U)*str < 0x20)
+    {
+      snprintf(esc, sizeof(esc), "\\u%04x", (INT8U)*str);
+      QueryJsonRaw(json, esc, strlen(esc));
+    }
+    else
+    {
+      QueryJsonRaw(json, str, 1);
+    }
+  }
+
+  QueryJsonRaw(json, "\"", 1);
+}
+
+/*******************************************************************/
+
+static BOOL QueryFieldListed(const t_queryJson *json, const CHAR *key)
+{
+  BOOL   found = FALSE;
+  INT32U i;
+
+  for (i = 0; (i < json->numFields) && (found == FALSE); i++)
+  {
+    found = (strcmp(json->fields[i], key) == 0);
+  }
+
+  return found;
+}
+
+/*******************************************************************/
+
+/**
+ * @brief Writes separator and key of next value.
+ * @return TRUE if value shall be written; FALSE if it is filtered out by field projection
+ **/
+static BOOL QueryJsonKey(t_queryJson *json, const CHAR *key)
+{
+  BOOL wanted = TRUE;
+
+  if (json->skipDepth != 0)
+  {
+    wanted = FALSE;
+  }
+  else if ((key != NULL) && (json->depth == QUERY_RECORD_DEPTH) &&
+           (json->numFields > 0) && (QueryFieldListed(json, key) == FALSE))
+  {
+    wanted = FALSE;
+  }
+
+  if (wanted == TRUE)
+  {
+    if (json->first[json->depth] == FALSE)
+    {
+      QueryJsonRaw(json, ",", 1);
+    }
+    json->first[json->depth] = FALSE;
+
+    if (key != NULL)
+    {
+      QueryJsonStrRaw(json, key);
+      QueryJsonRaw(json, ":", 1);
+    }
+  }
+
+  return wanted;
+}
+
+/*******************************************************************/
+
+static void QueryJsonOpen(t_queryJson *json, const CHAR *key, CHAR bracket)
+{
+  BOOL wanted;
+
+  wanted = QueryJsonKey(json, key);
+
+  if (json->depth < QUERY_JSON_MAX_DEPTH)
+  {
+    json->depth++;
+    json->first[json->depth] = TRUE;
+
+    if (wanted == TRUE)
+    {
+      QueryJsonRaw(json, &bracket, 1);
+    }
+    else if (json->skipDepth == 0)
+    {
+      json->skipDepth = json->depth;
+    }
+  }
+}
+
+/*******************************************************************/
+
+static void QueryJsonClose(t_queryJson *json, CHAR bracket)
+{
+  if (json->depth > 0)
+  {
+    if (json->skipDepth == json->depth)
+    {
+      json->skipDepth = 0;
+    }
+    else if (json->skipDepth == 0)
+    {
+      QueryJsonRaw(json, &bracket, 1);
+    }
+
+    json->depth--;
+  }
+}
+
+/*******************************************************************/
+
+static void QueryJsonUInt(t_queryJson *json, const CHAR *key, INT64U value)
+{
+  CHAR str[24];
+
+  if (QueryJsonKey(json, key) == TRUE)
+  {
+    snprintf(str, sizeof(str), "%llu", (unsigned long long)value);
+    QueryJsonRaw(json, str, strlen(str));
+  }
+}
+
+/*******************************************************************/
+
+static void QueryJsonInt(t_queryJson *json, const CHAR *key, INT64S value)
+{
+  CHAR str[24];
+
+  if (QueryJsonKey(json, key) == TRUE)
+  {
+    snprintf(str, sizeof(str), "%lld", (long long)value);
+    QueryJsonRaw(json, str, strlen(str));
+  }
+}
+
+/*******************************************************************/
+
+static void QueryJsonBool(t_queryJson *json, const CHAR *key, BOOL value)
+{
+  if (QueryJsonKey(json, key) == TRUE)
+  {
+    QueryJsonRaw(json, value?"true":"false", value?4:5);
+  }
+}
+
+/*******************************************************************/
+
+static void QueryJsonStr(t_queryJson *json, const CHAR *key, const CHAR *value)
+{
+  if (QueryJsonKey(json, key) == TRUE)
+  {
+    if (value == NULL)
+    {
+      QueryJsonRaw(json, "null", 4);
+    }
+    else
+    {
+      QueryJsonStrRaw(json, value);
+    }
+  }
+}
+
+/*******************************************************************/
+
+static void QueryJsonMeasure(t_queryJson *json, const CHAR *key, const t_processMeasure *measure)
+{
+  INT32U i;
+
+  // Measurement vectors are big, so they are only returned on demand
+  if (QueryFieldListed(json, key) == TRUE)
+  {
+    QueryJsonOpen(json, key, '{');
+    QueryJsonUInt(json, "planId", measure->planID);
+    QueryJsonInt(json, "errorCode", measure->errorCode);
+    QueryJsonUInt(json, "firstCarrier", measure->firstCarrier);
+    QueryJsonUInt(json, "spacing", measure->spacing);
+    QueryJsonBool(json, "mimo", measure->mimoMeas);
+    QueryJsonUInt(json, "numMeasures", measure->numMeasures);
+    QueryJsonOpen(json, "rx1", '[');
+    if (measure->measuresRx1 != NULL)
+    {
+      for (i = 0; i < measure->numMeasures; i++)
+      {
+        QueryJsonUInt(json, NULL, measure->measuresRx1[i]);
+      }
+    }
+    QueryJsonClose(json, ']');
+    if (measure->measuresRx2 != NULL)
+    {
+      QueryJsonOpen(json, "rx2", '[');
+      for (i = 0; i < measure->numMeasures; i++)
+      {
+        QueryJsonUInt(json, NULL, measure->measuresRx2[i]);
+      }
+      QueryJsonClose(json, ']');
+    }
+    QueryJsonClose(json, '}');
+  }
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode QueryDriverCb(t_VBDriver *driver, void *args)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_queryArgs          *query = (t_queryArgs *)args;
+  t_queryJson          *json;
+  t_vbEngineNumNodes    num_nodes;
+  CHAR                  str_addr[INET6_ADDRSTRLEN];
+
+  if ((query == NULL) || (driver == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (((query->driverId != NULL) && (strcmp(query->driverId, driver->vbDriverID) != 0)) ||
+           ((query->clusterFilter == TRUE) && (query->clusterId != driver->clusterId)))
+  {
+    // Filtered out
+  }
+  else
+  {
+    json = &(query->json);
+
+    bzero(&num_nodes, sizeof(num_nodes));
+    VbEngineDatamodelNumNodesInDriverGet(driver, &num_nodes);
+
+    if (inet_ntop(AF_INET6, &driver->vbEAConnDesc.clientAddr.sin6_addr, str_addr, sizeof(str_addr)) == NULL)
+    {
+      strcpy(str_addr, "unknown");
+    }
+
+    QueryJsonOpen(json, NULL, '{');
+    QueryJsonStr(json, "id", driver->vbDriverID);
+    QueryJsonStr(json, "fsmState", FSMSttToStrGet(driver->FSMState));
+    QueryJsonStr(json, "remoteState", driver->remoteState);
+    QueryJsonStr(json, "version", driver->remoteVersion);
+    QueryJsonStr(json, "address", str_addr);
+    QueryJsonUInt(json, "port", ntohs(driver->vbEAConnDesc.clientAddr.sin6_port));
+    QueryJsonInt(json, "cluster", driver->clusterId);
+    QueryJsonUInt(json, "domains", driver->domainsList.numDomains);
+    QueryJsonUInt(json, "dms", num_nodes.numDms);
+    QueryJsonUInt(json, "eps", num_nodes.numEps);
+    QueryJsonUInt(json, "completeLines", num_nodes.numCompleteLines);
+    QueryJsonUInt(json, "transactionMinTime", driver->transactionMinTime);
+    QueryJsonClose(json, '}');
+
+    query->numItems++;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode QueryNodeCb(t_VBDriver *driver, t_domain *domain, t_node *node, void *args)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  t_queryArgs          *query = (t_queryArgs *)args;
+  t_queryJson          *json;
+  INT32U                i;
+
+  if ((query == NULL) || (driver == NULL) || (node == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else if (((query->driverId != NULL) && (strcmp(query->driverId, driver->vbDriverID) != 0)) ||
+           ((query->macFilter == TRUE) && (memcmp(query->mac, node->MAC, ETH_ALEN) != 0)))
+  {
+    // Filtered out
+  }
+  else
+  {
+    json = &(query->json);
+
+    QueryJsonOpen(json, NULL, '{');
+    QueryJsonStr(json, "mac", node->MACStr);
+    QueryJsonStr(json, "type", VbNodeTypeToStr(node->type));
+    QueryJsonStr(json, "driver", driver->vbDriverID);
+    QueryJsonInt(json, "cluster", driver->clusterId);
+    QueryJsonUInt(json, "devId", node->devID);
+    QueryJsonStr(json, "state", VbDevStateToStr(node->state));
+    QueryJsonStr(json, "linkedMac", (node->linkedNode != NULL)?node->linkedNode->MACStr:NULL);
+
+    QueryJsonUInt(json, "boostMode", node->channelSettings.boostInfo.mode);
+    QueryJsonUInt(json, "boostLevel", node->channelSettings.boostInfo.level);
+    QueryJsonUInt(json, "maxBands", node->channelSettings.boostInfo.maxNumBands);
+    QueryJsonUInt(json, "lowBandCapacity", node->channelSettings.boostInfo.lowBandCapacity);
+    QueryJsonUInt(json, "maxCapacity", node->channelSettings.boostInfo.maxCapacity);
+
+    QueryJsonUInt(json, "bpsCapacity", node->trafficReports.bpsCapacity);
+    QueryJsonUInt(json, "realCapacity", node->trafficReports.realCapacity);
+    QueryJsonUInt(json, "neededCapacity", node->trafficReports.neededTheoricCapacity);
+    QueryJsonUInt(json, "macEfficiency", node->trafficReports.macEfficiency);
+
+    QueryJsonOpen(json, "ingressTraffic", '[');
+    QueryJsonUInt(json, NULL, node->trafficReports.ingressTrafficP0);
+    QueryJsonUInt(json, NULL, node->trafficReports.ingressTrafficP1);
+    QueryJsonUInt(json, NULL, node->trafficReports.ingressTrafficP2);
+    QueryJsonUInt(json, NULL, node->trafficReports.ingressTrafficP3);
+    QueryJsonClose(json, ']');
+
+    QueryJsonOpen(json, "bpsBand", '[');
+    for (i = 0; i < VB_PSD_NUM_BANDS; i++)
+    {
+      QueryJsonUInt(json, NULL, node->trafficReports.bpsBand[i]);
+    }
+    QueryJsonClose(json, ']');
+
+    QueryJsonOpen(json, "cdta", '{');
+    QueryJsonUInt(json, "userSLA", node->cdtaInfo.profile.userSLA);
+    QueryJsonUInt(json, "slaWeight", node->cdtaInfo.profile.slaWeight);
+    QueryJsonUInt(json, "userWeight", node->cdtaInfo.profile.userWeight);
+    QueryJsonUInt(json, "bpsReportedNBands", node->cdtaInfo.bpsReportedNBands);
+    QueryJsonOpen(json, "capacityPerRate", '[');
+    for (i = 0; i < VB_ENGINE_QOS_RATE_LAST; i++)
+    {
+      QueryJsonUInt(json, NULL, node->cdtaInfo.capacityPerRate[i]);
+    }
+    QueryJsonClose(json, ']');
+    QueryJsonOpen(json, "rateAdequation", '[');
+    for (i = 0; i < VB_ENGINE_QOS_RATE_LAST; i++)
+    {
+      QueryJsonInt(json, NULL, node->cdtaInfo.rateAdequationValue[i]);
+    }
+    QueryJsonClose(json, ']');
+    QueryJsonClose(json, '}');
+
+    QueryJsonMeasure(json, "bgn", &(node->measures.BGNMeasure));
+    QueryJsonMeasure(json, "snrFull", &(node->measures.snrFullXtalk));
+    QueryJsonMeasure(json, "snrLow", &(node->measures.snrLowXtalk));
+    QueryJsonClose(json, '}');
+
+    query->numItems++;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode QueryClusterIdCb(t_VBCluster *cluster, void *args)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  INT32U              **cluster_id = (INT32U **)args;
+
+  if ((cluster == NULL) || (cluster_id == NULL))
+  {
+    ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+  }
+  else
+  {
+    **cluster_id = cluster->clusterInfo.clusterId;
+    (*cluster_id)++;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void QueryClusterDump(t_queryArgs *query, t_VBCluster *cluster)
+{
+  t_queryJson          *json = &(query->json);
+  t_vbEngineNumNodes    num_nodes;
+  BOOLEAN               sync_lost = FALSE;
+  INT32U                i;
+
+  bzero(&num_nodes, sizeof(num_nodes));
+  VbEngineDataModelNumNodesInClusterXGet(cluster->clusterInfo.clusterId, &num_nodes);
+  VbEngineClusterSyncLostGet(cluster->clusterInfo.clusterId, &sync_lost);
+
+  QueryJsonOpen(json, NULL, '{');
+  QueryJsonUInt(json, "id", cluster->clusterInfo.clusterId);
+  QueryJsonUInt(json, "alignRef", cluster->clusterInfo.alignRef);
+  QueryJsonUInt(json, "numLines", cluster->clusterInfo.numLines);
+  QueryJsonOpen(json, "relays", '[');
+  for (i = 0; i < MIN(cluster->clusterInfo.numRelays, VB_EA_ALIGN_GHN_MAX_RELAYS); i++)
+  {
+    QueryJsonUInt(json, NULL, cluster->clusterInfo.relays[i]);
+  }
+  QueryJsonClose(json, ']');
+  QueryJsonOpen(json, "relaysCandidate", '[');
+  for (i = 0; i < MIN(cluster->clusterInfo.numRelaysCandidate, VB_EA_ALIGN_GHN_MAX_RELAYS); i++)
+  {
+    QueryJsonUInt(json, NULL, cluster->clusterInfo.relaysCandidate[i]);
+  }
+  QueryJsonClose(json, ']');
+  QueryJsonUInt(json, "dms", num_nodes.numDms);
+  QueryJsonUInt(json, "eps", num_nodes.numEps);
+  QueryJsonUInt(json, "completeLines", num_nodes.numCompleteLines);
+  QueryJsonStr(json, "qosRate", VbEngineQosRateToStrGet(VbCdtaQosRateGet(cluster->clusterInfo.clusterId)));
+  QueryJsonBool(json, "syncLost", sync_lost);
+  QueryJsonBool(json, "skipMeasPlan", cluster->skipMeasPlan);
+  QueryJsonBool(json, "epChange", cluster->epChange);
+  QueryJsonClose(json, '}');
+
+  query->numItems++;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode QueryClustersDump(t_queryArgs *query)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  INT32U               *cluster_id_list = NULL;
+  INT32U               *cluster_id_ptr;
+  INT32U                num_clusters;
+  INT32U                idx;
+  t_VBCluster          *cluster;
+
+  // Cluster Ids are collected first and clusters dumped afterwards (outside
+  // clusters loop), as dumping calls other functions that lock clusters list
+  num_clusters = VbEngineDataModelNumClustersGet();
+
+  if (num_clusters > 0)
+  {
+    cluster_id_list = (INT32U *)calloc(num_clusters, sizeof(INT32U));
+
+    if (cluster_id_list == NULL)
+    {
+      ret = VB_ENGINE_ERROR_NO_MEMORY;
+    }
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (cluster_id_list != NULL))
+  {
+    cluster_id_ptr = cluster_id_list;
+    ret = VbEngineDatamodelClustersLoop(QueryClusterIdCb, &cluster_id_ptr);
+    num_clusters = MIN(num_clusters, (INT32U)(cluster_id_ptr - cluster_id_list));
+  }
+
+  if ((ret == VB_ENGINE_ERROR_NONE) && (cluster_id_list != NULL))
+  {
+    for (idx = 0; idx < num_clusters; idx++)
+    {
+      if ((query->clusterFilter == TRUE) && ((INT32S)cluster_id_list[idx] != query->clusterId))
+      {
+        continue;
+      }
+
+      if (VbEngineClusterByIdGet(cluster_id_list[idx], &cluster) == VB_ENGINE_ERROR_NONE)
+      {
+        QueryClusterDump(query, cluster);
+      }
+    }
+  }
+
+  free(cluster_id_list);
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void QueryCounterCb(const CHAR *name, INT32U value, void *args)
+{
+  t_queryArgs *query = (t_queryArgs *)args;
+
+  QueryJsonOpen(&(query->json), NULL, '{');
+  QueryJsonStr(&(query->json), "name", name);
+  QueryJsonUInt(&(query->json), "value", value);
+  QueryJsonClose(&(query->json), '}');
+
+  query->numItems++;
+}
+
+/*******************************************************************/
+
+static t_VB_engineErrorCode QueryArgsParse(t_queryArgs *query, char **cmd, CHAR *fieldsBuf, INT32U fieldsBufSize, const CHAR **errStr)
+{
+  t_VB_engineErrorCode  ret = VB_ENGINE_ERROR_NONE;
+  INT32U                i;
+  CHAR                 *value;
+  CHAR                 *end;
+  CHAR                 *save_ptr = NULL;
+  CHAR                 *field;
+
+  for (i = 2; (i < VB_CONSOLE_PARAMS_MAXNUM) && (cmd[i] != NULL) && (ret == VB_ENGINE_ERROR_NONE); i++)
+  {
+    value = strchr(cmd[i], '=');
+
+    if (value == NULL)
+    {
+      *errStr = "bad argument";
+      ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+    }
+    else
+    {
+      value++;
+
+      if (!strncmp(cmd[i], "driver=", 7))
+      {
+        query->driverId = value;
+      }
+      else if (!strncmp(cmd[i], "cluster=", 8))
+      {
+        query->clusterId = strtol(value, &end, 0);
+        query->clusterFilter = TRUE;
+
+        if ((*value == '\0') || (*end != '\0'))
+        {
+          *errStr = "bad cluster";
+          ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+        }
+      }
+      else if (!strncmp(cmd[i], "mac=", 4))
+      {
+        if (strlen(value) != (MAC_STR_LEN - 1))
+        {
+          *errStr = "bad mac";
+          ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+        }
+        else
+        {
+          MACAddrStr2mem(query->mac, value);
+          query->macFilter = TRUE;
+        }
+      }
+      else if (!strncmp(cmd[i], "fields=", 7))
+      {
+        strncpy(fieldsBuf, value, fieldsBufSize - 1);
+        fieldsBuf[fieldsBufSize - 1] = '\0';
+
+        for (field = strtok_r(fieldsBuf, ",", &save_ptr);
+             (field != NULL) && (query->json.numFields < QUERY_MAX_FIELDS);
+             field = strtok_r(NULL, ",", &save_ptr))
+        {
+          query->json.fields[query->json.numFields++] = field;
+        }
+      }
+      else
+      {
+        *errStr = "unknown argument";
+        ret = VB_ENGINE_ERROR_BAD_ARGUMENTS;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+BOOL VbEngineQueryConsoleCmd(void *arg, t_writeFun writeFun, char **cmd)
+{
+  BOOL                  ret = FALSE;
+  BOOL                  show_help = FALSE;
+  t_VB_engineErrorCode  err = VB_ENGINE_ERROR_NONE;
+  t_queryArgs          *query = NULL;
+  const CHAR           *err_str = NULL;
+  CHAR                  fields_buf[VB_CONSOLE_BUFFER_SIZE];
+  struct timespec       now;
+
+  if ((cmd[1] == NULL) || (!strcmp(cmd[1], "h")))
+  {
+    show_help = (cmd[1] != NULL);
+    ret = show_help;
+  }
+  else if (strcmp(cmd[1], "drivers") && strcmp(cmd[1], "nodes") &&
+           strcmp(cmd[1], "clusters") && strcmp(cmd[1], "counters"))
+  {
+    ret = FALSE;
+  }
+  else
+  {
+    query = (t_queryArgs *)calloc(1, sizeof(*query));
+
+    if (query == NULL)
+    {
+      err_str = "no memory";
+      writeFun("{\"query\":\"%s\",\"error\":\"%s\"}\n", cmd[1], err_str);
+    }
+    else
+    {
+      query->json.writeFun = writeFun;
+      query->json.first[0] = TRUE;
+      err = QueryArgsParse(query, cmd, fields_buf, sizeof(fields_buf), &err_str);
+
+      clock_gettime(CLOCK_REALTIME, &now);
+
+      QueryJsonOpen(&(query->json), NULL, '{');
+      QueryJsonStr(&(query->json), "query", cmd[1]);
+      QueryJsonStr(&(query->json), "engine", VbEngineConfEngineIdGet());
+      QueryJsonUInt(&(query->json), "ts", ((INT64U)now.tv_sec * 1000) + (now.tv_nsec / 1000000));
+
+      if (err == VB_ENGINE_ERROR_NONE)
+      {
+        QueryJsonOpen(&(query->json), "items", '[');
+
+        if (!strcmp(cmd[1], "drivers"))
+        {
+          err = VbEngineDatamodelDriversLoop(QueryDriverCb, query);
+        }
+        else if (!strcmp(cmd[1], "nodes"))
+        {
+          if (query->clusterFilter == TRUE)
+          {
+            err = VbEngineDatamodelClusterXAllNodesLoop(QueryNodeCb, query->clusterId, query);
+          }
+          else
+          {
+            err = VbEngineDatamodelAllNodesLoop(QueryNodeCb, query);
+          }
+        }
+        else if (!strcmp(cmd[1], "clusters"))
+        {
+          err = QueryClustersDump(query);
+        }
+        else
+        {
+          VbCountersLoop(QueryCounterCb, query);
+        }
+
+        QueryJsonClose(&(query->json), ']');
+        QueryJsonUInt(&(query->json), "count", query->numItems);
+
+        if (err != VB_ENGINE_ERROR_NONE)
+        {
+          err_str = "loop error";
+        }
+      }
+
+      if (err_str != NULL)
+      {
+        QueryJsonStr(&(query->json), "error", err_str);
+      }
+
+      QueryJsonClose(&(query->json), '}');
+      QueryJsonRaw(&(query->json), "\n", 1);
+      QueryJsonFlush(&(query->json));
+
+      ret = (err == VB_ENGINE_ERROR_NONE);
+
+      free(query);
+    }
+  }
+
+  if (((ret == FALSE) && (err_str == NULL)) || (show_help == TRUE))
+  {
+    writeFun("Usage:\n");
+    writeFun("query <object> [filters] [fields=<f1,f2,...>] : Returns engine state as JSON (single line)\n");
+    writeFun("  objects: drivers, clusters, nodes, counters\n");
+    writeFun("  filters: driver=<id> cluster=<id> mac=<xx:xx:xx:xx:xx:xx>\n");
+    writeFun("  node vectors (only returned if listed in fields): bgn, snrFull, snrLow\n");
+    writeFun("query h                                      : Shows this help\n");
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/
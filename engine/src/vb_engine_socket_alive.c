@@ -274,20 +274,14 @@ void VbEngineSocketAliveMonitorStop(void)
 
 /*******************************************************************/
 
-t_VB_engineErrorCode VbEngineSocketAliveConfigurationParse(ezxml_t socketAliveConf )
+t_VB_engineErrorCode VbEngineSocketAliveConfigurationParse(ezxml_t socketAliveConf, t_socketAlive *socket_alive_conf )
 {
-  t_VB_engineErrorCode err_code;
+  t_VB_engineErrorCode err_code = VB_ENGINE_ERROR_NONE;
   ezxml_t              ez_temp;
-  t_socketAlive        *socket_alive_conf = NULL;
 
-  err_code = VbEngineConfSocketAliveGet(&socket_alive_conf);
-
-  if (err_code == VB_ENGINE_ERROR_NONE)
+  if ((socketAliveConf == NULL) || (socket_alive_conf == NULL))
   {
-    if (socket_alive_conf == NULL)
-    {
-      err_code = VB_ENGINE_ERROR_BAD_ARGUMENTS;
-    }
+    err_code = VB_ENGINE_ERROR_BAD_ARGUMENTS;
   }
 
   if (err_code == VB_ENGINE_ERROR_NONE)
@@ -121,9 +121,10 @@ BOOLEAN VbEngineSocketAliveMonitorRun(void);
 /**
  * @brief Parse the socket alive in the vb_engine.ini
  * @param[in] socketAliveConf socket alive configuration to parse
+ * @param[out] socketAliveData Socket alive configuration to fill
  * @return @ref t_VB_engineErrorCode
  **/
-t_VB_engineErrorCode VbEngineSocketAliveConfigurationParse(ezxml_t socketAliveConf);
+t_VB_engineErrorCode VbEngineSocketAliveConfigurationParse(ezxml_t socketAliveConf, t_socketAlive *socketAliveData);
 
 
 
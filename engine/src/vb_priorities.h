@@ -59,11 +59,16 @@
  ************************************************************************
  */
 
-#define VB_ENGINE_PROCESS_THREAD_PRIORITY       (0)
-#define VB_ENGINE_COMPUTATION_THREAD_PRIORITY   (0)
-#define VB_CONSOLE_THREAD_PRIORITY              (0)
-#define VB_LOG_THREAD_PRIORITY                  (0)
-#define VB_SIGNALS_PROCESSING_PRIORITY          (0)
+// Thread classes (see t_vbThreadClass); placement of each class is configured in ThreadPlacement section of .ini file
+#define VB_ENGINE_PROCESS_THREAD_CLASS          (VB_THREAD_CLASS_FSM)
+#define VB_ENGINE_COMPUTATION_THREAD_CLASS      (VB_THREAD_CLASS_COMPUTE)
+#define VB_EA_THREAD_CLASS                      (VB_THREAD_CLASS_IO)
+#define VB_CONSOLE_THREAD_CLASS                 (VB_THREAD_CLASS_BACKGROUND)
+#define VB_METRICS_THREAD_CLASS                 (VB_THREAD_CLASS_BACKGROUND)
+#define VB_LOG_THREAD_CLASS                     (VB_THREAD_CLASS_BACKGROUND)
+#define VB_FILE_WRITER_THREAD_CLASS             (VB_THREAD_CLASS_BACKGROUND)
+#define VB_MEAS_STREAM_THREAD_CLASS             (VB_THREAD_CLASS_BACKGROUND)
+#define VB_SIGNALS_PROCESSING_CLASS             (VB_THREAD_CLASS_BACKGROUND)
 
 #define VB_THREADMSG_HIGH_PRIORITY              (1)
 #define VB_THREADMSG_PRIORITY                   (0)
@@ -0,0 +1,317 @@
+/*
+*  <legal_notice>
+*  * BSD License 2.0
+*  *
+*  * Copyright (c) 2021, MaxLinear, Inc.
+*  *
+*  * Redistribution and use in source and binary forms, with or without
+*  * modification, are permitted provided that the following conditions are met:
+*  * 1. Redistributions of source code must retain the above copyright notice, 
+*  *    this list of conditions and the following disclaimer.
+*  * 2. Redistributions in binary form must reproduce the above copyright notice, 
+*  *    this list of conditions and the following disclaimer in the documentation 
+*  *    and/or other materials provided with the distribution.
+*  * 3. Neither the name of the copyright holder nor the names of its contributors 
+*  *    may be used to endorse or promote products derived from this software 
+*  *    without specific prior written permission.
+*  *
+*  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+*  * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+*  * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+*  * IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+*  * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+*  * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+*  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+*  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+*  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+*  * POSSIBILITY OF SUCH DAMAGE.
+*  </legal_notice>
+*/
+
+/**
+ * @addtogroup vector_boost
+ * @{
+ **/
+
+/**
+ * @file vb_line_state_cli.c
+ * @brief Command line reader of the engine line state shared memory table
+ *
+ * @internal
+ *
+ * @author
+ * @date 2026-10-17
+ *
+ **/
+
+/*
+ ************************************************************************
+ ** Included files
+ ************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "types.h"
+#include "vb_types.h"
+#include "vb_util.h"
+#include "vb_line_state.h"
+
+/*
+ ************************************************************************
+ ** Private constants
+ ************************************************************************
+ */
+
+#define LINE_STATE_CLI_NAME                          ("vb_line_state")
+
+/*
+ ************************************************************************
+ ** Private type definitions
+ ************************************************************************
+ */
+
+typedef struct
+{
+  CHAR    shmName[VB_QUEUE_NAME_LEN];
+  BOOLEAN macFilter;
+  INT8U   mac[ETH_ALEN];
+  INT32U  watchPeriod;     ///< In seconds, 0 to dump once
+  BOOLEAN showInvalid;
+} t_lineStateCliArgs;
+
+/*
+ ************************************************************************
+ ** Private function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+static void LineStateCliUsage(void)
+{
+  printf("Command line:\n\t%s [-e ENGINEID | -s SHMNAME] [-m MAC] [-w SECONDS] [-a] [-h]\n", LINE_STATE_CLI_NAME);
+  printf("Where:\n");
+  printf("\t-e\tEngine Id as configured in vb_engine.ini\n");
+  printf("\t-s\tShared memory object name (default %s_<ENGINEID>)\n", VB_LINE_STATE_SHM_PREFIX);
+  printf("\t-m\tOnly show line with given MAC (xx:xx:xx:xx:xx:xx)\n");
+  printf("\t-w\tDump table every SECONDS\n");
+  printf("\t-a\tAlso show released entries\n");
+  printf("\t-h\tShow this help\n");
+}
+
+/*******************************************************************/
+
+static BOOLEAN LineStateCliArgsParse(int argc, char **argv, t_lineStateCliArgs *args)
+{
+  BOOLEAN ret = TRUE;
+  BOOLEAN name_set = FALSE;
+  int     opt;
+  int     num;
+
+  bzero(args, sizeof(*args));
+
+  while ((ret == TRUE) && ((opt = getopt(argc, argv, "e:s:m:w:ah")) != -1))
+  {
+    switch (opt)
+    {
+      case ('e'):
+      {
+        VbLineStateShmNameBuild(optarg, args->shmName);
+        name_set = TRUE;
+        break;
+      }
+      case ('s'):
+      {
+        strncpy(args->shmName, optarg, VB_QUEUE_NAME_LEN - 1);
+        name_set = TRUE;
+        break;
+      }
+      case ('m'):
+      {
+        num = sscanf(optarg, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx",
+            &args->mac[0], &args->mac[1], &args->mac[2], &args->mac[3], &args->mac[4], &args->mac[5]);
+        args->macFilter = TRUE;
+        ret = (num == ETH_ALEN)? TRUE:FALSE;
+        break;
+      }
+      case ('w'):
+      {
+        args->watchPeriod = strtoul(optarg, NULL, 0);
+        break;
+      }
+      case ('a'):
+      {
+        args->showInvalid = TRUE;
+        break;
+      }
+      default:
+      {
+        ret = FALSE;
+        break;
+      }
+    }
+  }
+
+  if (name_set == FALSE)
+  {
+    ret = FALSE;
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+static void LineStateCliTimeStr(INT64U timeNs, CHAR *str, size_t len)
+{
+  time_t    secs = (time_t)(timeNs / 1000000000ULL);
+  struct tm tm_info;
+
+  if (timeNs == 0)
+  {
+    snprintf(str, len, "-");
+  }
+  else
+  {
+    localtime_r(&secs, &tm_info);
+    strftime(str, len, "%Y-%m-%d %H:%M:%S", &tm_info);
+  }
+}
+
+/*******************************************************************/
+
+static void LineStateCliEntryPrint(const t_vbLineStateEntry *entry, INT32U idx)
+{
+  CHAR update_str[32];
+  CHAR change_str[32];
+
+  LineStateCliTimeStr(entry->lastUpdateNs, update_str, sizeof(update_str));
+  LineStateCliTimeStr(entry->lastChangeNs, change_str, sizeof(change_str));
+
+  printf("| %5u | %02x:%02x:%02x:%02x:%02x:%02x | %-2s | %-20s | %4d | %5u | %3u%% | %6u | %6u | %19s | %19s |%s\n",
+      idx,
+      entry->MAC[0], entry->MAC[1], entry->MAC[2], entry->MAC[3], entry->MAC[4], entry->MAC[5],
+      (entry->type == VB_NODE_DOMAIN_MASTER)? "DM":"EP",
+      entry->driverId,
+      entry->clusterId,
+      entry->boostLevel,
+      entry->boostPerc,
+      entry->payloadMax,
+      entry->currentPayload,
+      update_str,
+      change_str,
+      (entry->valid == TRUE)? "":" (released)");
+}
+
+/*******************************************************************/
+
+static t_vbLineStateError LineStateCliDump(const t_vbLineStateReader *reader, const t_lineStateCliArgs *args)
+{
+  t_vbLineStateError ret = VB_LINE_STATE_ERROR_NONE;
+  t_vbLineStateEntry entry;
+  CHAR               update_str[32];
+  INT32U             num_entries;
+  INT32U             idx;
+
+  LineStateCliTimeStr(reader->header->lastUpdateNs, update_str, sizeof(update_str));
+
+  printf("Engine %s (pid %u), %u/%u entries, refreshed every %u ms, last refresh %s\n",
+      reader->header->engineId, reader->header->writerPid, reader->header->numEntries,
+      reader->header->maxEntries, reader->header->updatePeriodMs, update_str);
+
+  if (args->macFilter == TRUE)
+  {
+    ret = VbLineStateEntryByMacRead(reader, args->mac, &entry);
+
+    if (ret == VB_LINE_STATE_ERROR_NONE)
+    {
+      LineStateCliEntryPrint(&entry, 0);
+    }
+    else if (ret == VB_LINE_STATE_ERROR_NOT_FOUND)
+    {
+      printf("MAC not found\n");
+      ret = VB_LINE_STATE_ERROR_NONE;
+    }
+  }
+  else
+  {
+    printf("| %5s | %-17s | %-2s | %-20s | %4s | %5s | %4s | %6s | %6s | %-19s | %-19s |\n",
+        "Idx", "MAC", "Ty", "Driver", "Clus", "Level", "Perc", "PayMax", "PayCur", "Updated", "Level changed");
+
+    num_entries = MIN(reader->header->numEntries, reader->header->maxEntries);
+
+    for (idx = 0; (idx < num_entries) && (ret == VB_LINE_STATE_ERROR_NONE); idx++)
+    {
+      ret = VbLineStateEntryRead(reader, idx, &entry);
+
+      if ((ret == VB_LINE_STATE_ERROR_NONE) && ((entry.valid == TRUE) || (args->showInvalid == TRUE)))
+      {
+        LineStateCliEntryPrint(&entry, idx);
+      }
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************/
+
+/*
+ ************************************************************************
+ ** Public function implementation
+ ************************************************************************
+ */
+
+/*******************************************************************/
+
+int main(int argc, char **argv)
+{
+  t_vbLineStateError  err;
+  t_vbLineStateReader reader;
+  t_lineStateCliArgs  args;
+
+  if (LineStateCliArgsParse(argc, argv, &args) == FALSE)
+  {
+    LineStateCliUsage();
+    return EXIT_FAILURE;
+  }
+
+  err = VbLineStateReaderOpen(args.shmName, &reader);
+
+  if (err != VB_LINE_STATE_ERROR_NONE)
+  {
+    printf("Error %d opening line state table %s\n", err, args.shmName);
+    return EXIT_FAILURE;
+  }
+
+  do
+  {
+    err = LineStateCliDump(&reader, &args);
+
+    if (err != VB_LINE_STATE_ERROR_NONE)
+    {
+      printf("Error %d reading line state table\n", err);
+    }
+
+    if (args.watchPeriod > 0)
+    {
+      printf("\n");
+      sleep(args.watchPeriod);
+    }
+  } while ((args.watchPeriod > 0) && (err == VB_LINE_STATE_ERROR_NONE));
+
+  VbLineStateReaderClose(&reader);
+
+  return (err == VB_LINE_STATE_ERROR_NONE)? EXIT_SUCCESS:EXIT_FAILURE;
+}
+
+/*******************************************************************/
+
+/**
+ * @}
+ **/